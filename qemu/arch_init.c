@@ -43,6 +43,7 @@
 #include "hw/smbios.h"
 
 #include "replay_fix.h"
+#include "rr_snapshot_ram.h"
 
 #ifdef TARGET_SPARC
 int graphic_width = 1024;
@@ -95,6 +96,7 @@ const uint32_t arch_type = QEMU_ARCH;
 #define RAM_SAVE_FLAG_PAGE     0x08
 #define RAM_SAVE_FLAG_EOS      0x10
 #define RAM_SAVE_FLAG_CONTINUE 0x20
+#define RAM_SAVE_FLAG_RR_SIDECAR 0x40 /* rr snapshot, see rr_snapshot_ram.h */
 
 static int is_dup_page(uint8_t *page, uint8_t ch)
 {
@@ -298,6 +300,15 @@ int ram_save_live(Monitor *mon, QEMUFile *f, int stage, void *opaque)
             qemu_put_buffer(f, (uint8_t *)block->idstr, strlen(block->idstr));
             qemu_put_be64(f, block->length);
         }
+
+        if (rr_snp_ram_save_active()) {
+            qemu_put_be64(f, RAM_SAVE_FLAG_RR_SIDECAR);
+            ret = rr_snp_ram_save(f);
+            if (ret < 0) {
+                qemu_file_set_error(f, ret);
+                return ret;
+            }
+        }
     }
 
     bytes_transferred_last = bytes_transferred;
@@ -434,6 +445,13 @@ int ram_load(QEMUFile *f, void *opaque, int version_id)
             }
         }
 
+        if (flags & RAM_SAVE_FLAG_RR_SIDECAR) {
+            error = rr_snp_ram_load(f);
+            if (error) {
+                return error;
+            }
+        }
+
         if (flags & RAM_SAVE_FLAG_COMPRESS) {
             void *host;
             uint8_t ch;
@@ -449,7 +467,9 @@ int ram_load(QEMUFile *f, void *opaque, int version_id)
             ch = qemu_get_byte(f);
             memset(host, ch, TARGET_PAGE_SIZE);
 #ifndef _WIN32
-            if (ch == 0 &&
+            // on a snapshot mapping, DONTNEED would bring back the
+            // snapshot's page rather than zeros
+            if (ch == 0 && !rr_snp_ram_mapped() &&
                 (!kvm_enabled() || kvm_has_sync_mmu())) {
                 qemu_madvise(host, TARGET_PAGE_SIZE, QEMU_MADV_DONTNEED);
             }
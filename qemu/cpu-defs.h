@@ -220,13 +220,18 @@ typedef struct CPUWatchpoint {
     int kvm_fd;                                                         \
     int kvm_vcpu_dirty;                                                 \
     /* record and replay */                                             \
+    /* instructions before the current TB, plus rr_insn_idx for the     \
+       instructions run in it; see gen_op_rr_tb_start() */              \
     uint64_t rr_guest_instr_count;                                      \
+    uint32_t rr_insn_idx;                                               \
+    struct TranslationBlock *rr_cur_tb;                                 \
     uint64_t rr_guest_pc;                                               \
     uint64_t panda_guest_pc;
 
 // record/replay
 #ifndef GUEST_ICOUNT
-#define GUEST_ICOUNT cpu_single_env->rr_guest_instr_count
+#define GUEST_ICOUNT (cpu_single_env->rr_guest_instr_count + \
+                      cpu_single_env->rr_insn_idx)
 #endif
 
 #endif
@@ -133,12 +133,62 @@ static void cpu_exec_nocache(CPUState *env, int max_cycles,
     tb_free(tb);
 }
 
+// tb_gen_code wrapped in the PANDA block translation callbacks
+static TranslationBlock *panda_tb_gen_code(CPUState *env, target_ulong pc,
+                                           target_ulong cs_base,
+                                           uint64_t flags, int cflags)
+{
+    panda_cb_list *plist;
+    TranslationBlock *tb;
+
+    for(plist = panda_cbs[PANDA_CB_BEFORE_BLOCK_TRANSLATE]; plist != NULL; plist = panda_cb_list_next(plist)) {
+        plist->entry.before_block_translate(env, pc);
+    }
+
+    tb = tb_gen_code(env, pc, cs_base, flags, cflags);
+
+    for(plist = panda_cbs[PANDA_CB_AFTER_BLOCK_TRANSLATE]; plist != NULL; plist = panda_cb_list_next(plist)) {
+        plist->entry.after_block_translate(env, tb);
+    }
+    return tb;
+}
+
+#ifdef CONFIG_SOFTMMU
+/* During replay a block may not run past the next interrupt.  Rather than
+   throwing the full block away and retranslating it short (which then
+   stays short in the cache, and re-lifts it for LLVM every time), run a
+   separate translation of its first len instructions.  These prefixes
+   live in the physical hash like any other TB, so they are found again
+   the next time an interrupt lands at the same distance and go away with
+   the code they were translated from, but tb_find_slow never returns
+   them. */
+static TranslationBlock *rr_tb_prefix(CPUState *env, TranslationBlock *tb,
+                                      int len)
+{
+    TranslationBlock *ptb;
+    tb_page_addr_t phys_pc;
+
+    phys_pc = tb->page_addr[0] + (tb->pc & ~TARGET_PAGE_MASK);
+    for (ptb = tb_phys_hash[tb_phys_hash_func(phys_pc)]; ptb != NULL;
+         ptb = ptb->phys_hash_next) {
+        if (ptb->pc == tb->pc &&
+            ptb->cflags == (CF_RR_PREFIX | len) &&
+            ptb->page_addr[0] == tb->page_addr[0] &&
+            ptb->cs_base == tb->cs_base &&
+            ptb->flags == tb->flags &&
+            (ptb->page_addr[1] == -1 || ptb->page_addr[1] == tb->page_addr[1]))
+            return ptb;
+    }
+    return panda_tb_gen_code(env, tb->pc, tb->cs_base, tb->flags,
+                             CF_RR_PREFIX | len);
+}
+#endif
+
 static TranslationBlock *tb_find_slow(CPUState *env,
                                       target_ulong pc,
                                       target_ulong cs_base,
                                       uint64_t flags)
 {
-    panda_cb_list *plist;
     TranslationBlock *tb, **ptb1;
     unsigned int h;
     tb_page_addr_t phys_pc, phys_page1;
@@ -156,6 +206,7 @@ static TranslationBlock *tb_find_slow(CPUState *env,
         if (!tb)
             goto not_found;
         if (tb->pc == pc &&
+            !(tb->cflags & CF_RR_PREFIX) &&
             tb->page_addr[0] == phys_page1 &&
             tb->cs_base == cs_base &&
             tb->flags == flags) {
@@ -177,15 +228,7 @@ static TranslationBlock *tb_find_slow(CPUState *env,
  not_found:
    /* if no translated code available, then translate it now */
 
-    for(plist = panda_cbs[PANDA_CB_BEFORE_BLOCK_TRANSLATE]; plist != NULL; plist = panda_cb_list_next(plist)) {
-        plist->entry.before_block_translate(env, pc);
-    }
-
-    tb = tb_gen_code(env, pc, cs_base, flags, 0);
-
-    for(plist = panda_cbs[PANDA_CB_AFTER_BLOCK_TRANSLATE]; plist != NULL; plist = panda_cb_list_next(plist)) {
-        plist->entry.after_block_translate(env, tb);
-    }
+    tb = panda_tb_gen_code(env, pc, cs_base, flags, 0);
 
  found:
     /* Move the last found TB to the head of the list */
@@ -253,6 +296,8 @@ void rr_quit_cpu_loop(void) {
 
 void rr_clear_rr_guest_instr_count(CPUState *cpu_state) {
   cpu_state->rr_guest_instr_count = 0;
+  cpu_state->rr_insn_idx = 0;
+  cpu_state->rr_cur_tb = NULL;
 }
 #endif
 
@@ -269,7 +314,7 @@ int cpu_exec(CPUState *env)
     unsigned long next_tb;
 
 #ifdef CONFIG_SOFTMMU
-    RR_prog_point saved_prog_point = rr_prog_point();
+    RR_prog_point saved_prog_point = {0};
     int rr_loop_tries = 20;
     
     //mz This is done once at the start of record and once at the start of
@@ -710,6 +755,11 @@ int cpu_exec(CPUState *env)
                     tb_flush(env);
                     tb_invalidated_flag = 1;
                 }
+#ifdef CONFIG_SOFTMMU
+                if (panda_invalidate_tb()) {
+                    tb_invalidated_flag = 1;
+                }
+#endif
 
                 spin_lock(&tb_lock);
 
@@ -717,13 +767,14 @@ int cpu_exec(CPUState *env)
                 tb = tb_find_fast(env);
 
 #ifdef CONFIG_SOFTMMU
-                RR_prog_point pp = rr_prog_point();
-                qemu_log_mask(CPU_LOG_RR, 
-			      "Prog point: 0x" TARGET_FMT_lx " {guest_instr_count=%llu, pc=%08llx, secondary=%08llx}\n",
-                  tb->pc,
-                 (unsigned long long)pp.guest_instr_count,
-                  (unsigned long long)pp.pc,
-                  (unsigned long long)pp.secondary);
+                if (qemu_loglevel_mask(CPU_LOG_RR)) {
+                    RR_prog_point pp = rr_prog_point();
+                    qemu_log("Prog point: 0x" TARGET_FMT_lx " {guest_instr_count=%llu, pc=%08llx, secondary=%08llx}\n",
+                      tb->pc,
+                     (unsigned long long)pp.guest_instr_count,
+                      (unsigned long long)pp.pc,
+                      (unsigned long long)pp.secondary);
+                }
 #endif
 
                 // PANDA instrumentation: before basic block exec (with option
@@ -733,26 +784,34 @@ int cpu_exec(CPUState *env)
                 // So we guard the callback execution with bb_invalidate_done, which
                 // will get cleared when we actually get to execute the basic block.
                 panda_cb_list *plist;
-                bool panda_invalidate_tb = false;
+                bool invalidate_after_cb = false;
                 if (unlikely(!bb_invalidate_done)) {
                     for(plist = panda_cbs[PANDA_CB_BEFORE_BLOCK_EXEC_INVALIDATE_OPT];
                             plist != NULL; plist = panda_cb_list_next(plist)) {
-                        panda_invalidate_tb |=
+                        invalidate_after_cb |=
                             plist->entry.before_block_exec_invalidate_opt(env, tb);
                     }
                     bb_invalidate_done = true;
                 }
 
 #ifdef CONFIG_SOFTMMU
+                // -rr-state-hash. Done before until_interrupt is computed,
+                // since consuming a hash in replay refills the queue.
+                if (unlikely(rr_state_hash_due())) {
+                    rr_state_hash(env);
+                }
                 uint64_t until_interrupt = rr_num_instr_before_next_interrupt();
-                if (panda_invalidate_tb ||
-                        (rr_mode == RR_REPLAY && until_interrupt > 0 &&
-                         tb->num_guest_insns > until_interrupt)) {
+                if (invalidate_after_cb) {
                     //mz invalidate current TB and retranslate
                     invalidate_single_tb(env, tb->pc);
                     //mz try again.
                     tb = tb_find_fast(env);
                 }
+                if (rr_mode == RR_REPLAY && until_interrupt > 0 &&
+                        tb->num_guest_insns > until_interrupt) {
+                    // only run up to the interrupt, keeping the full TB
+                    tb = rr_tb_prefix(env, tb, until_interrupt);
+                }
 
                 /* Note: we do it here to avoid a gcc bug on Mac OS X when
                    doing it in tb_find_slow */
@@ -813,8 +872,10 @@ int cpu_exec(CPUState *env)
                 }
 
                 // Check for replay failure (otherwise infinite loop would result)
+                // (the pc of the block about to run stands in for the
+                // last instruction's pc, which may need a retranslation)
                 if (rr_mode == RR_REPLAY) {
-                    RR_prog_point pp = rr_prog_point();
+                    RR_prog_point pp = rr_block_prog_point(tb);
                     if (pp.pc == saved_prog_point.pc &&
                             pp.secondary == saved_prog_point.secondary &&
                             pp.guest_instr_count == saved_prog_point.guest_instr_count) {
@@ -828,7 +889,7 @@ int cpu_exec(CPUState *env)
                     if (!rr_loop_tries) {
                         // Signal failure
                         printf("Infinite loop detected during replay, aborting.\n");
-                        rr_spit_prog_point(pp);
+                        rr_spit_prog_point(rr_prog_point());
                         rr_do_end_replay(1);
                     }
                 }
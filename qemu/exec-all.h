@@ -99,6 +99,8 @@ int cpu_gen_code(CPUState *env, struct TranslationBlock *tb,
                  int *gen_code_size_ptr);
 int cpu_restore_state(struct TranslationBlock *tb,
                       CPUState *env, unsigned long searched_pc);
+uint64_t rr_get_guest_pc(CPUState *env);
+void rr_forget_tb(struct TranslationBlock *tb);
 void cpu_resume_from_signal(CPUState *env1, void *puc);
 void cpu_io_recompile(CPUState *env, void *retaddr);
 TranslationBlock *tb_gen_code(CPUState *env, 
@@ -109,6 +111,10 @@ void QEMU_NORETURN cpu_loop_exit(CPUState *env1);
 int page_unprotect(target_ulong address, unsigned long pc, void *puc);
 void tb_invalidate_phys_page_range(tb_page_addr_t start, tb_page_addr_t end,
                                    int is_cpu_write_access);
+#if !defined(CONFIG_USER_ONLY)
+void tb_invalidate_phys_addr_range(target_phys_addr_t start,
+                                   target_phys_addr_t end);
+#endif
 void tlb_flush_page(CPUState *env, target_ulong addr);
 void tlb_flush(CPUState *env, int flush_global);
 #if !defined(CONFIG_USER_ONLY)
@@ -156,9 +162,11 @@ struct TranslationBlock {
     uint64_t flags; /* flags defining in which context the code was generated */
     uint16_t size;      /* size of target code for this block (1 <=
                            size <= TARGET_PAGE_SIZE) */
-    uint16_t cflags;    /* compile flags */
+    uint32_t cflags;    /* compile flags */
 #define CF_COUNT_MASK  0x7fff
 #define CF_LAST_IO     0x8000 /* Last insn may be an IO access.  */
+#define CF_RR_PREFIX   0x10000 /* Replay-only prefix of a longer block,
+                                  never returned by tb_find_slow.  */
 
     uint8_t *tc_ptr;    /* pointer to the translated code */
     /* next matching tb for physical address. */
@@ -224,6 +232,21 @@ static inline unsigned int tb_phys_hash_func(tb_page_addr_t pc)
 
 void tb_free(TranslationBlock *tb);
 void tb_flush(CPUState *env);
+
+/* Translation cache counters, for sizing -tb-size. */
+typedef struct TBStats {
+    unsigned long code_gen_buffer_size;
+    unsigned long code_gen_used;    /* bytes of host code since last flush */
+    int nb_tbs;
+    int max_tbs;
+    int flush_count;                /* every tb_flush */
+    int flush_full_count;           /* of those, because the buffer filled */
+    int invalidate_count;           /* TBs invalidated one by one */
+    uint64_t gen_count;             /* TBs translated */
+    int64_t gen_time_ns;            /* time spent translating them */
+} TBStats;
+
+void tb_get_stats(TBStats *stats);
 void tb_link_page(TranslationBlock *tb,
                   tb_page_addr_t phys_pc, tb_page_addr_t phys_page2);
 void tb_phys_invalidate(TranslationBlock *tb, tb_page_addr_t page_addr);
@@ -75,6 +75,7 @@
 #include "rr_log.h"
 #endif
 #include "panda_plugin.h"
+#include "panda_common.h"
 
 #ifdef CONFIG_LLVM
 //#include "tcg-llvm.h"
@@ -249,7 +250,10 @@ static int log_append = 0;
 static int tlb_flush_count;
 #endif
 static int tb_flush_count;
+static int tb_flush_full_count;
 static int tb_phys_invalidate_count;
+static uint64_t tb_gen_count;
+static int64_t tb_gen_time_ns;
 
 #ifdef _WIN32
 static void map_exec(void *addr, long size)
@@ -513,9 +517,11 @@ static void code_gen_alloc(unsigned long tb_size)
         flags = MAP_PRIVATE | MAP_ANONYMOUS;
 #if defined(__x86_64__)
         //        flags |= MAP_32BIT;
-        /* Cannot map more than that */
-        if (code_gen_buffer_size > (800 * 1024 * 1024))
-            code_gen_buffer_size = (800 * 1024 * 1024);
+        /* Without MAP_32BIT the only limit is that direct jumps between
+           TBs are rel32, so the whole buffer must be within +-2G.
+           Instrumented replays (memcb, LLVM) fill a smaller one fast. */
+        if (code_gen_buffer_size > (2047ul * 1024 * 1024))
+            code_gen_buffer_size = (2047ul * 1024 * 1024);
 #elif defined(__sparc_v9__)
         // Map the buffer below 2G, so we can use direct calls and branches
         flags |= MAP_FIXED;
@@ -789,6 +795,7 @@ void tb_flush(CPUState *env1)
     }
 #endif
 
+    rr_forget_tb(NULL);
     nb_tbs = 0;
 
     for(env = first_cpu; env != NULL; env = env->next_cpu) {
@@ -940,6 +947,7 @@ void tb_phys_invalidate(TranslationBlock *tb, tb_page_addr_t page_addr)
     }
 
     tb_invalidated_flag = 1;
+    rr_forget_tb(tb);
 
     /* remove the TB from the hash list */
     h = tb_jmp_cache_hash_func(tb->pc);
@@ -1033,6 +1041,7 @@ TranslationBlock *tb_gen_code(CPUState *env,
     tb_page_addr_t phys_pc, phys_page2;
     target_ulong virt_page2;
     int code_gen_size;
+    int64_t gen_start;
 #ifdef CONFIG_LLVM
     int i;
 #endif
@@ -1042,6 +1051,7 @@ TranslationBlock *tb_gen_code(CPUState *env,
     if (!tb) {
         /* flush must be done */
         tb_flush(env);
+        tb_flush_full_count++;
         /* cannot fail at this point */
         tb = tb_alloc(pc);
         /* Don't forget to invalidate previous TB info.  */
@@ -1052,7 +1062,10 @@ TranslationBlock *tb_gen_code(CPUState *env,
     tb->cs_base = cs_base;
     tb->flags = flags;
     tb->cflags = cflags;
+    gen_start = get_clock();
     cpu_gen_code(env, tb, &code_gen_size);
+    tb_gen_time_ns += get_clock() - gen_start;
+    tb_gen_count++;
 #ifdef CONFIG_LLVM
     // Sanity check. We had a bug before where we were misrecording
     // translated code sizes, and so TC blocks appeared to overlap.
@@ -1510,6 +1523,32 @@ static void breakpoint_invalidate(CPUState *env, target_ulong pc)
 #endif
 #endif /* TARGET_HAS_ICE */
 
+#if !defined(CONFIG_USER_ONLY)
+/* invalidate all TBs with code in the guest physical range [start;end[,
+   one page at a time.  Unlike tb_flush, every other TB (and its LLVM
+   function) is left alone. */
+void tb_invalidate_phys_addr_range(target_phys_addr_t start,
+                                   target_phys_addr_t end)
+{
+    while (start < end) {
+        target_phys_addr_t next = (start & TARGET_PAGE_MASK) + TARGET_PAGE_SIZE;
+        PhysPageDesc *p = phys_page_find(start >> TARGET_PAGE_BITS);
+        ram_addr_t pd = p ? p->phys_offset : IO_MEM_UNASSIGNED;
+
+        if (next > end || next < start) {
+            next = end;
+        }
+        /* code can only come from RAM and ROM */
+        if ((pd & ~TARGET_PAGE_MASK) <= IO_MEM_ROM || (pd & IO_MEM_ROMD)) {
+            ram_addr_t ram_addr = (pd & TARGET_PAGE_MASK) +
+                (start & ~TARGET_PAGE_MASK);
+            tb_invalidate_phys_page_range(ram_addr, ram_addr + (next - start), 0);
+        }
+        start = next;
+    }
+}
+#endif
+
 #if defined(CONFIG_USER_ONLY)
 void cpu_watchpoint_remove_all(CPUState *env, int mask)
 
@@ -2115,6 +2154,85 @@ static CPUTLBEntry s_cputlb_empty_entry = {
     .addend     = -1,
 };
 
+/* Software TLB for the PANDA virtual memory helpers
+   (panda_virtual_memory_rw() and friends). cpu_get_phys_page_debug() does
+   a full guest page table walk per call, and introspection plugins make
+   lots of small reads from the same few pages. Translations are cached per
+   (asid, page). The cache is emptied by tlb_flush(), which the targets
+   call on CR3 writes and paging mode changes, and tlb_flush_page() drops
+   entries around the flushed address, so an entry goes stale exactly
+   when the guest's own TLB entry would. Failed walks are not cached. */
+#define PANDA_TLB_BITS 8
+#define PANDA_TLB_SIZE (1 << PANDA_TLB_BITS)
+/* Set in tag for valid entries; page addresses never have it set. */
+#define PANDA_TLB_VALID 1
+/* The walk may have gone through a large page, so flushing one page
+   drops every entry within the largest page size we expect (4M). */
+#define PANDA_TLB_FLUSH_MASK (~(target_ulong)((1 << 22) - 1))
+
+typedef struct PandaTLBEntry {
+    target_ulong tag;
+    target_ulong asid;
+    target_phys_addr_t phys_page;
+} PandaTLBEntry;
+
+static PandaTLBEntry panda_tlb[PANDA_TLB_SIZE];
+static bool panda_tlb_in_use;
+
+static inline target_ulong panda_tlb_asid(CPUState *env)
+{
+#if defined(TARGET_ARM)
+    /* TTBR writes don't flush the TLB on ARM, so the tag has to be the
+       user page table base itself. TTBR1 only changes at boot. */
+    return env->cp15.c2_base0;
+#else
+    return panda_current_asid(env);
+#endif
+}
+
+static void panda_tlb_flush(void)
+{
+    if (!panda_tlb_in_use)
+        return;
+    memset(panda_tlb, 0, sizeof(panda_tlb));
+    panda_tlb_in_use = false;
+}
+
+static void panda_tlb_flush_page(target_ulong addr)
+{
+    int i;
+
+    if (!panda_tlb_in_use)
+        return;
+    for (i = 0; i < PANDA_TLB_SIZE; i++) {
+        if (((panda_tlb[i].tag ^ addr) & PANDA_TLB_FLUSH_MASK) == 0)
+            panda_tlb[i].tag = 0;
+    }
+}
+
+/* Returns the physical address of virtual page 'page' of the current
+   address space, or -1 if it is not mapped. */
+static target_phys_addr_t panda_tlb_get_phys_page(CPUState *env,
+                                                  target_ulong page)
+{
+    PandaTLBEntry *e;
+    target_ulong asid = panda_tlb_asid(env);
+    target_phys_addr_t phys_page;
+
+    e = &panda_tlb[(page >> TARGET_PAGE_BITS) & (PANDA_TLB_SIZE - 1)];
+    if (likely(e->tag == (page | PANDA_TLB_VALID) && e->asid == asid))
+        return e->phys_page;
+
+    phys_page = cpu_get_phys_page_debug(env, page);
+    if (phys_page == -1)
+        return -1;
+    e->tag = page | PANDA_TLB_VALID;
+    e->asid = asid;
+    e->phys_page = phys_page;
+    panda_tlb_in_use = true;
+    return phys_page;
+}
+
 /* NOTE: if flush_global is true, also flush global entries (not
    implemented yet) */
 void tlb_flush(CPUState *env, int flush_global)
@@ -2140,6 +2258,8 @@ void tlb_flush(CPUState *env, int flush_global)
     env->tlb_flush_addr = -1;
     env->tlb_flush_mask = 0;
     tlb_flush_count++;
+
+    panda_tlb_flush();
 }
 
 static inline void tlb_flush_entry(CPUTLBEntry *tlb_entry, target_ulong addr)
@@ -2176,6 +2296,8 @@ void tlb_flush_page(CPUState *env, target_ulong addr)
        links while we are modifying them */
     env->current_tb = NULL;
 
+    panda_tlb_flush_page(addr);
+
     addr &= TARGET_PAGE_MASK;
     i = (addr >> TARGET_PAGE_BITS) & (CPU_TLB_SIZE - 1);
     for (mmu_idx = 0; mmu_idx < NB_MMU_MODES; mmu_idx++)
@@ -4105,6 +4227,12 @@ int panda_virtual_memory_rw(CPUState *env, target_ulong addr,
     return -1;
 }
 
+int panda_virtual_memory_read_bulk(CPUState *env, target_ulong addr,
+                                   uint8_t *buf, int len) {
+    // XXX Unimplemented for linux user mode
+    return 0;
+}
+
 #else
 
 // addr is a physical addr.
@@ -5080,7 +5208,7 @@ target_phys_addr_t panda_virt_to_phys(CPUState *env, target_ulong addr){
     target_ulong page;
     target_phys_addr_t phys_addr;
     page = addr & TARGET_PAGE_MASK;
-    phys_addr = cpu_get_phys_page_debug(env, page);
+    phys_addr = panda_tlb_get_phys_page(env, page);
     /* if no physical page mapped, return an error */
     if (phys_addr == -1)
         return -1;
@@ -5098,7 +5226,7 @@ int panda_virtual_memory_rw(CPUState *env, target_ulong addr,
 
     while (len > 0) {
         page = addr & TARGET_PAGE_MASK;
-        phys_addr = cpu_get_phys_page_debug(env, page);
+        phys_addr = panda_tlb_get_phys_page(env, page);
         /* if no physical page mapped, return an error */
         if (phys_addr == -1)
             return -1;
@@ -5119,6 +5247,43 @@ int panda_virtual_memory_rw(CPUState *env, target_ulong addr,
     return 0;
 }
 
+/* Reads as much of [addr, addr + len) as is mapped, stopping at the first
+   unmapped page, and returns the number of bytes read. Runs of virtual
+   pages that are also physically contiguous are read with a single
+   physical access. */
+int panda_virtual_memory_read_bulk(CPUState *env, target_ulong addr,
+                                   uint8_t *buf, int len)
+{
+    int done = 0;
+    int l;
+    target_phys_addr_t start, phys_addr, next_phys;
+    target_ulong page;
+
+    while (done < len) {
+        page = addr & TARGET_PAGE_MASK;
+        phys_addr = panda_tlb_get_phys_page(env, page);
+        if (phys_addr == -1)
+            break;
+        start = phys_addr + (addr & ~TARGET_PAGE_MASK);
+        l = (page + TARGET_PAGE_SIZE) - addr;
+        while (done + l < len) {
+            next_phys = panda_tlb_get_phys_page(env, page + TARGET_PAGE_SIZE);
+            if (next_phys != phys_addr + TARGET_PAGE_SIZE)
+                break;
+            page += TARGET_PAGE_SIZE;
+            phys_addr = next_phys;
+            l += TARGET_PAGE_SIZE;
+        }
+        if (l > len - done)
+            l = len - done;
+        if (panda_physical_memory_rw(start, buf + done, l, 0) < 0)
+            break;
+        done += l;
+        addr += l;
+    }
+    return done;
+}
+
 #endif
 
 /* in deterministic execution mode, instructions doing device I/Os
@@ -5191,6 +5356,19 @@ void cpu_io_recompile(CPUState *env, void *retaddr)
 
 #if !defined(CONFIG_USER_ONLY)
 
+void tb_get_stats(TBStats *stats)
+{
+    stats->code_gen_buffer_size = code_gen_buffer_size;
+    stats->code_gen_used = code_gen_ptr - code_gen_buffer;
+    stats->nb_tbs = nb_tbs;
+    stats->max_tbs = code_gen_max_blocks;
+    stats->flush_count = tb_flush_count;
+    stats->flush_full_count = tb_flush_full_count;
+    stats->invalidate_count = tb_phys_invalidate_count;
+    stats->gen_count = tb_gen_count;
+    stats->gen_time_ns = tb_gen_time_ns;
+}
+
 void dump_exec_info(FILE *f, fprintf_function cpu_fprintf)
 {
     int i, target_code_size, max_target_code_size;
@@ -5237,8 +5415,11 @@ void dump_exec_info(FILE *f, fprintf_function cpu_fprintf)
                 direct_jmp2_count,
                 nb_tbs ? (direct_jmp2_count * 100) / nb_tbs : 0);
     cpu_fprintf(f, "\nStatistics:\n");
-    cpu_fprintf(f, "TB flush count      %d\n", tb_flush_count);
+    cpu_fprintf(f, "TB flush count      %d (buffer full: %d)\n",
+                tb_flush_count, tb_flush_full_count);
     cpu_fprintf(f, "TB invalidate count %d\n", tb_phys_invalidate_count);
+    cpu_fprintf(f, "TB gen count        %" PRIu64 " (%" PRId64 " ms)\n",
+                tb_gen_count, tb_gen_time_ns / 1000000);
     cpu_fprintf(f, "TLB flush count     %d\n", tlb_flush_count);
     tcg_dump_info(f, cpu_fprintf);
 }
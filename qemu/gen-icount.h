@@ -48,17 +48,49 @@ static inline void gen_io_end(void)
 }
 
 // Record and replay
-static inline void gen_op_update_rr_icount(void)
+//
+// The guest instruction count is kept at block granularity.  Each TB starts
+// by folding the index of the last instruction run in the previous block
+// into rr_guest_instr_count, and each instruction then only stores its own
+// (constant) index within the block into rr_insn_idx.  The exact count is
+// the sum of the two (see rr_get_guest_instr_count()), which stays right
+// whether the previous block ran to the end, was left through an exception
+// or jumped straight into this one through a chained jump.  rr_cur_tb lets
+// rr_get_guest_pc() recover the pc of that instruction on demand.
+static inline void gen_op_rr_tb_start(TranslationBlock *tb)
 {
-    TCGv_i64 count;
+    TCGv_i64 count, idx;
+    TCGv_i32 zero;
+    TCGv_ptr tb_ptr;
 
     count = tcg_temp_new_i64();
+    idx = tcg_temp_new_i64();
 
     tcg_gen_ld_i64(count, cpu_env, offsetof(CPUState, rr_guest_instr_count));
-    tcg_gen_addi_i64(count, count, 1);
+    tcg_gen_ld32u_i64(idx, cpu_env, offsetof(CPUState, rr_insn_idx));
+    tcg_gen_add_i64(count, count, idx);
     tcg_gen_st_i64(count, cpu_env, offsetof(CPUState, rr_guest_instr_count));
 
+    tcg_temp_free_i64(idx);
     tcg_temp_free_i64(count);
+
+    // nothing of this block has run yet (a breakpoint or an interrupt
+    // check may still leave before the first instruction)
+    zero = tcg_const_i32(0);
+    tcg_gen_st_i32(zero, cpu_env, offsetof(CPUState, rr_insn_idx));
+    tcg_temp_free_i32(zero);
+
+    tb_ptr = tcg_const_ptr((tcg_target_long)tb);
+    tcg_gen_st_ptr(tb_ptr, cpu_env, offsetof(CPUState, rr_cur_tb));
+    tcg_temp_free_ptr(tb_ptr);
+}
+
+// idx is the 1-based position of the instruction about to run in its TB
+static inline void gen_op_update_rr_insn_idx(uint32_t idx)
+{
+    TCGv_i32 tmp = tcg_const_i32(idx);
+    tcg_gen_st_i32(tmp, cpu_env, offsetof(CPUState, rr_insn_idx));
+    tcg_temp_free_i32(tmp);
 }
 
 static inline void gen_op_update_panda_pc(uint64_t new_pc)
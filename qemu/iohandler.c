@@ -93,6 +93,7 @@ int qemu_set_fd_handler(int fd,
 }
 
 extern bool is_monitor_device(const void *opaque);
+extern bool is_main_loop_fd(int fd);
 
 void qemu_iohandler_fill(int *pnfds, fd_set *readfds, fd_set *writefds, fd_set *xfds)
 {
@@ -110,7 +111,8 @@ void qemu_iohandler_fill(int *pnfds, fd_set *readfds, fd_set *writefds, fd_set *
         //mz monitor device. if not, continue (only in replay)
         if (rr_in_replay() || rr_replay_requested) {
             //mz lives in monitor.c. opaque is CharDriverState *?
-            if ( !is_monitor_device(ioh->opaque) && !is_gdb_device(ioh->opaque))
+            if ( !is_monitor_device(ioh->opaque) && !is_gdb_device(ioh->opaque)
+                 && !is_main_loop_fd(ioh->fd))
                 continue;
         }
         if (ioh->fd_read &&
@@ -36,6 +36,10 @@
 
 static int io_thread_fd = -1;
 
+/* read ends of the notify pipe and of the signalfd, see is_main_loop_fd */
+static int io_thread_read_fd = -1;
+static int sigfd_read_fd = -1;
+
 void qemu_notify_event(void)
 {
     /* Write 8 bytes to be compatible with eventfd.  */
@@ -90,6 +94,7 @@ static int qemu_event_init(void)
                          (void *)(intptr_t)fds[0]);
 
     io_thread_fd = fds[1];
+    io_thread_read_fd = fds[0];
     return 0;
 
 fail:
@@ -163,6 +168,7 @@ static int qemu_signal_init(void)
 
     qemu_set_fd_handler2(sigfd, NULL, sigfd_handler, NULL,
                          (void *)(intptr_t)sigfd);
+    sigfd_read_fd = sigfd;
 
     return 0;
 }
@@ -220,6 +226,18 @@ int qemu_init_main_loop(void)
     return 0;
 }
 
+/* The main loop's own fds.  Replay skips device and chardev handlers, but
+   must still service these: the notify pipe is what wakes select() for
+   qemu_notify_event(), and the signalfd delivers host signals. */
+bool is_main_loop_fd(int fd)
+{
+#ifndef _WIN32
+    return fd != -1 && (fd == io_thread_read_fd || fd == sigfd_read_fd);
+#else
+    return false;
+#endif
+}
+
 
 static GPollFD poll_fds[1024 * 2]; /* this is probably overkill */
 static int n_poll_fds;
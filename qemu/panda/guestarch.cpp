@@ -29,6 +29,9 @@ PANDAENDCOMMENT */
  */
 
 #include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
 #include <math.h>
 
 extern "C" {
@@ -644,6 +647,42 @@ void fprintf_spec(Addr *a, FILE *fp){}
 
 #endif
 
+/*
+ * get_cpustate_val() evaluated once for every byte offset into the CPUState.
+ * Everything past the last register byte is irrelevant, so the table stops
+ * there; for i386 that leaves out the TLBs, which are most of the struct.
+ */
+static int16_t *cpustate_val_table = NULL;
+static uint32_t cpustate_val_table_size = 0;
+
+static void init_cpustate_val_table(void){
+    init_regs();
+    uint32_t size = 0;
+    for (uint32_t off = 0; off < sizeof(CPUState); off++){
+        if (get_cpustate_val((uintptr_t)env + off) >= 0){
+            size = off + 1;
+        }
+    }
+    cpustate_val_table = (int16_t *) malloc((size ? size : 1) * sizeof(int16_t));
+    for (uint32_t off = 0; off < size; off++){
+        int val = get_cpustate_val((uintptr_t)env + off);
+        assert(val <= 0x7fff);
+        cpustate_val_table[off] = val;
+    }
+    cpustate_val_table_size = size;
+}
+
+int lookup_cpustate_val(uintptr_t dynval){
+    if (unlikely(cpustate_val_table == NULL)){
+        init_cpustate_val_table();
+    }
+    uintptr_t off = dynval - (uintptr_t)env;
+    if (off >= cpustate_val_table_size){
+        return -1;
+    }
+    return cpustate_val_table[off];
+}
+
 /*
 void guestStoreTaint(LAddr localSrc, GReg guestDst, int len,
     TaintOpBuffer *buf){
@@ -772,6 +772,13 @@ extern uintptr_t r15_reg;
 void init_regs(void);
 int get_cpustate_val(uintptr_t dynval);
 
+/*
+ * Same answer as get_cpustate_val() for an address inside of env, but from a
+ * table indexed by offset into the CPUState instead of a chain of compares.
+ * The table is built (and init_regs() called) on first use.
+ */
+int lookup_cpustate_val(uintptr_t dynval);
+
 void fprintf_reg(Addr *a, FILE *fp);
 void fprintf_spec(Addr *a, FILE *fp);
 
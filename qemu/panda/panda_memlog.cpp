@@ -14,6 +14,7 @@
 
 #include <math.h>
 #include <stdio.h>
+#include <string.h>
 
 extern"C" {
 #include "config.h"
@@ -36,8 +37,14 @@ extern int tubtf_on;
 
 FILE *memlog;
 
+// llvm_trace writes a few hundred bytes per basic block
+#define MEMLOG_BUF_SIZE (1 << 20)
+
 void open_memlog(char *path){
     memlog = fopen(path, "w");
+    if (memlog){
+        setvbuf(memlog, NULL, _IOFBF, MEMLOG_BUF_SIZE);
+    }
 }
 
 void close_memlog(void){
@@ -49,142 +56,109 @@ void close_memlog(void){
 
 #ifdef CONFIG_LLVM // These functions are for LLVM code
 
-bool regs_inited = false;
-
-static void log_dyn_load(DynValBuffer *dynval_buf, uintptr_t dynval){
-    if (unlikely(!regs_inited)){
-        init_regs();
-        regs_inited = true;
-    }
+static void log_addr(DynValBuffer *dynval_buf, uintptr_t dynval, LogOp op){
+    DynValEntry dventry;
+    dventry.entrytype = ADDRENTRY;
+    dventry.entry.memaccess.op = op;
+    Addr *addr = &dventry.entry.memaccess.addr;
+    addr->typ = MADDR;
+    addr->val.ma = 0;
+    addr->off = 0;
+    addr->flag = (AddrFlag) 0;
 
     if (dynval == (uintptr_t)(&env)){
         // location of env is irrelevant
-        DynValEntry dventry;
-        memset(&dventry, 0, sizeof(DynValEntry));
-        Addr addr;
-        memset(&addr, 0, sizeof(Addr));
-        addr.typ = MADDR;
-        addr.flag = IRRELEVANT;
-        dventry.entrytype = ADDRENTRY;
-        dventry.entry.memaccess.op = LOAD;
-        dventry.entry.memaccess.addr = addr;
-        write_dynval_buffer(dynval_buf, &dventry);
-    }
-    else if ((dynval >= (uintptr_t)env) &&
-            (dynval < ((uintptr_t)env + sizeof(CPUState)))){
-        // inside of CPUState
-        DynValEntry dventry;
-        memset(&dventry, 0, sizeof(DynValEntry));
-        Addr addr;
-        memset(&addr, 0, sizeof(Addr));
-        int val = get_cpustate_val(dynval);
-        if (val < 0){
-            addr.flag = IRRELEVANT;
-        }
-        else if (val < NUMREGS){
-            addr.typ = GREG;
-            addr.val.gr = val;
-        }
-        else if (val >= NUMREGS){
-            addr.typ = GSPEC;
-            addr.val.gs = val;
-        }
-        dventry.entrytype = ADDRENTRY;
-        dventry.entry.memaccess.op = LOAD;
-        dventry.entry.memaccess.addr = addr;
-        write_dynval_buffer(dynval_buf, &dventry);
-    }
-    else {
-        // else, must be a memory address
-        DynValEntry dventry;
-        memset(&dventry, 0, sizeof(DynValEntry));
-        Addr addr;
-        memset(&addr, 0, sizeof(Addr));
-        addr.typ = MADDR;
-        addr.val.ma = dynval;
-        dventry.entrytype = ADDRENTRY;
-        dventry.entry.memaccess.op = LOAD;
-        dventry.entry.memaccess.addr = addr;
-        write_dynval_buffer(dynval_buf, &dventry);
-    }
-}
-
-static void log_dyn_store(DynValBuffer *dynval_buf, uintptr_t dynval){
-    if (unlikely(!regs_inited)){
-        init_regs();
-        regs_inited = true;
-    }
-
-    if (dynval == (uintptr_t)(&env)){
-        DynValEntry dventry;
-        memset(&dventry, 0, sizeof(DynValEntry));
-        Addr addr;
-        memset(&addr, 0, sizeof(Addr));
-        addr.typ = MADDR;
-        addr.flag = IRRELEVANT;
-        dventry.entrytype = ADDRENTRY;
-        dventry.entry.memaccess.op = STORE;
-        dventry.entry.memaccess.addr = addr;
-        write_dynval_buffer(dynval_buf, &dventry);
+        addr->flag = IRRELEVANT;
     }
     else if ((dynval >= (uintptr_t)env) &&
             (dynval < ((uintptr_t)env + sizeof(CPUState)))){
         // inside of CPUState
-        DynValEntry dventry;
-        memset(&dventry, 0, sizeof(DynValEntry));
-        Addr addr;
-        memset(&addr, 0, sizeof(Addr));
-        int val = get_cpustate_val(dynval);
+        int val = lookup_cpustate_val(dynval);
         if (val < 0){
-            addr.flag = IRRELEVANT;
+            addr->flag = IRRELEVANT;
         }
         else if (val < NUMREGS){
-            addr.typ = GREG;
-            addr.val.gr = val;
+            addr->typ = GREG;
+            addr->val.gr = val;
         }
-        else if (val >= NUMREGS){
-            addr.typ = GSPEC;
-            addr.val.gs = val;
+        else {
+            addr->typ = GSPEC;
+            addr->val.gs = val;
         }
-        dventry.entrytype = ADDRENTRY;
-        dventry.entry.memaccess.op = STORE;
-        dventry.entry.memaccess.addr = addr;
-        write_dynval_buffer(dynval_buf, &dventry);
     }
     else {
         // else, must be a memory address
-        DynValEntry dventry;
-        memset(&dventry, 0, sizeof(DynValEntry));
-        Addr addr;
-        memset(&addr, 0, sizeof(Addr));
-        addr.typ = MADDR;
-        addr.val.ma = dynval;
-        dventry.entrytype = ADDRENTRY;
-        dventry.entry.memaccess.op = STORE;
-        dventry.entry.memaccess.addr = addr;
-        write_dynval_buffer(dynval_buf, &dventry);
+        addr->val.ma = dynval;
     }
+    write_dynval_buffer(dynval_buf, &dventry);
 }
 
 static void log_paddr(DynValBuffer *dynval_buf, uintptr_t dynval, uint32_t op){
-    if (unlikely(!regs_inited)){
-        init_regs();
-        regs_inited = true;
-    }
     DynValEntry dventry;
-    memset(&dventry, 0, sizeof(DynValEntry));
-    Addr addr;
-    memset(&addr, 0, sizeof(Addr));
-    addr.typ = PADDR;
-    addr.val.pa = dynval;
     dventry.entrytype = PADDRENTRY;
     dventry.entry.portaccess.op = (LogOp) op;
-    dventry.entry.portaccess.addr = addr;
+    Addr *addr = &dventry.entry.portaccess.addr;
+    addr->typ = PADDR;
+    addr->val.pa = dynval;
+    addr->off = 0;
+    addr->flag = (AddrFlag) 0;
     write_dynval_buffer(dynval_buf, &dventry);
 }
 
 #endif // CONFIG_LLVM
 
+// Encoder for the format described in panda_memlog.h
+
+static inline uint8_t *put_varint(uint8_t *p, uint64_t v){
+    while (v >= 0x80){
+        *p++ = (v & 0x7f) | 0x80;
+        v >>= 7;
+    }
+    *p++ = v;
+    return p;
+}
+
+static uint32_t encode_dynval(uint8_t *buf, DynValEntry *entry){
+    uint8_t *p = buf;
+    uint8_t hdr = entry->entrytype & DV_TYPE_MASK;
+    switch (entry->entrytype){
+        case ADDRENTRY:
+        case PADDRENTRY:
+            {
+                // memaccess and portaccess have the same layout
+                Addr *a = &entry->entry.memaccess.addr;
+                hdr |= entry->entry.memaccess.op << 3;
+                if (a->off){
+                    hdr |= DV_HAS_OFF;
+                }
+                *p++ = hdr;
+                *p++ = (a->typ & 0xf) | ((a->flag & 0xf) << 4);
+                p = put_varint(p, a->val.ua);
+                if (a->off){
+                    p = put_varint(p, a->off);
+                }
+                break;
+            }
+        case BRANCHENTRY:
+            *p++ = hdr | (entry->entry.branch.br << 3);
+            break;
+        case SELECTENTRY:
+            *p++ = hdr | (entry->entry.select.sel << 3);
+            break;
+        case SWITCHENTRY:
+            {
+                int64_t cond = entry->entry.switchstmt.cond;
+                *p++ = hdr;
+                p = put_varint(p, ((uint64_t)cond << 1) ^ (uint64_t)(cond >> 63));
+                break;
+            }
+        case EXCEPTIONENTRY:
+            *p++ = hdr;
+            break;
+    }
+    return p - buf;
+}
+
 DynValBuffer *create_dynval_buffer(uint32_t size){
     DynValBuffer *buf = (DynValBuffer *) malloc(sizeof(DynValBuffer));
     buf->max_size = size;
@@ -316,9 +290,8 @@ void write_dynval_buffer(DynValBuffer *dynval_buf, DynValEntry *entry){
     }
     else {
         uint32_t bytes_used = dynval_buf->ptr - dynval_buf->start;
-        assert(dynval_buf->max_size - bytes_used >= sizeof(DynValEntry));
-        memcpy(dynval_buf->ptr, entry, sizeof(DynValEntry));
-        dynval_buf->ptr += sizeof(DynValEntry);
+        assert(dynval_buf->max_size - bytes_used >= DV_MAX_ENCODED);
+        dynval_buf->ptr += encode_dynval((uint8_t *) dynval_buf->ptr, entry);
         dynval_buf->cur_size = dynval_buf->ptr - dynval_buf->start;
     }
 }
@@ -327,10 +300,12 @@ void write_dynval_buffer(DynValBuffer *dynval_buf, DynValEntry *entry){
 
 void read_dynval_buffer(DynValBuffer *dynval_buf, DynValEntry *entry){
     assert (tubtf_on == 0);
-    uint32_t bytes_used = dynval_buf->ptr - dynval_buf->start;
-    assert(dynval_buf->max_size - bytes_used >= sizeof(DynValEntry));
-    memcpy(entry, dynval_buf->ptr, sizeof(DynValEntry));
-    dynval_buf->ptr += sizeof(DynValEntry);
+    DynValMemSource src;
+    src.p = (const uint8_t *) dynval_buf->ptr;
+    src.end = (const uint8_t *) dynval_buf->start + dynval_buf->cur_size;
+    bool ok = decode_dynval(src, entry);
+    assert(ok);
+    dynval_buf->ptr = (char *) src.p;
 }
 
 void clear_dynval_buffer(DynValBuffer *dynval_buf){
@@ -348,15 +323,11 @@ void log_dynval(DynValBuffer *dynval_buf, DynValEntryType type, LogOp op,
         uintptr_t dynval){
     assert(dynval_buf);
     DynValEntry dventry;
-    memset(&dventry, 0, sizeof(DynValEntry));
     if (dynval_buf){
         switch (type){
             case ADDRENTRY:
-                if (op == LOAD){
-                    log_dyn_load(dynval_buf, dynval);
-                }
-                else if (op == STORE){
-                    log_dyn_store(dynval_buf, dynval);
+                if (op == LOAD || op == STORE){
+                    log_addr(dynval_buf, dynval, op);
                 }
                 break;
 
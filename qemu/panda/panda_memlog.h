@@ -15,6 +15,8 @@ PANDAENDCOMMENT */
 #ifndef PANDA_MEMLOG_H
 #define PANDA_MEMLOG_H
 
+#include <stdio.h>
+#include <string.h>
 #include <inttypes.h>
 
 void open_memlog(char *path);
@@ -61,6 +63,122 @@ typedef struct dyn_val_entry_struct {
     } entry;
 } DynValEntry;
 
+/*
+ * DynValBuffers (and so llvm-memlog.log, which is just the buffers written
+ * out back to back) hold a compact encoding of DynValEntry rather than the
+ * struct itself.  Every entry starts with a header byte that has the entry
+ * type in its low three bits:
+ *
+ *   ADDRENTRY, PADDRENTRY  hdr | op << 3 (| DV_HAS_OFF), then a byte of
+ *                          typ | flag << 4, then val as a varint, then off
+ *                          as a varint if DV_HAS_OFF is set
+ *   BRANCHENTRY            hdr | br << 3
+ *   SELECTENTRY            hdr | sel << 3
+ *   SWITCHENTRY            hdr, then cond as a zigzag varint
+ *   EXCEPTIONENTRY         hdr
+ *
+ * Varints are LEB128: seven bits per byte, low bits first, high bit set on
+ * every byte but the last.  A register access is three bytes and a guest
+ * memory access usually seven, against 40 for the struct.
+ */
+
+#define DV_TYPE_MASK 0x07
+#define DV_HAS_OFF 0x80
+
+// header + typ/flag + 64-bit varint + 16-bit varint
+#define DV_MAX_ENCODED (1 + 1 + 10 + 3)
+
+// Byte sources for decode_dynval.  next() returns -1 at the end.
+struct DynValMemSource {
+    const uint8_t *p, *end;
+    inline int next(){ return (p < end) ? *p++ : -1; }
+};
+
+struct DynValFileSource {
+    FILE *f;
+    inline int next(){ return getc(f); }
+};
+
+template<typename Source>
+static inline bool dynval_get_varint(Source &src, uint64_t *v){
+    uint64_t result = 0;
+    for (int shift = 0; shift < 64; shift += 7){
+        int c = src.next();
+        if (c < 0){
+            return false;
+        }
+        result |= (uint64_t)(c & 0x7f) << shift;
+        if (!(c & 0x80)){
+            *v = result;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Returns false if the source ends before a whole entry has been read.
+template<typename Source>
+static inline bool decode_dynval(Source &src, DynValEntry *entry){
+    int hdr = src.next();
+    if (hdr < 0){
+        return false;
+    }
+    memset(entry, 0, sizeof(DynValEntry));
+    entry->entrytype = (DynValEntryType) (hdr & DV_TYPE_MASK);
+    switch (entry->entrytype){
+        case ADDRENTRY:
+        case PADDRENTRY:
+            {
+                Addr *a = &entry->entry.memaccess.addr;
+                entry->entry.memaccess.op = (LogOp) ((hdr >> 3) & 0xf);
+                int tf = src.next();
+                if (tf < 0){
+                    return false;
+                }
+                a->typ = (AddrType) (tf & 0xf);
+                a->flag = (AddrFlag) (tf >> 4);
+                if (!dynval_get_varint(src, &a->val.ua)){
+                    return false;
+                }
+                if (hdr & DV_HAS_OFF){
+                    uint64_t off;
+                    if (!dynval_get_varint(src, &off)){
+                        return false;
+                    }
+                    a->off = off;
+                }
+                return true;
+            }
+        case BRANCHENTRY:
+            entry->entry.branch.br = (hdr >> 3) & 1;
+            return true;
+        case SELECTENTRY:
+            entry->entry.select.sel = (hdr >> 3) & 1;
+            return true;
+        case SWITCHENTRY:
+            {
+                uint64_t z;
+                if (!dynval_get_varint(src, &z)){
+                    return false;
+                }
+                entry->entry.switchstmt.cond = (int64_t)(z >> 1) ^ -(int64_t)(z & 1);
+                return true;
+            }
+        case EXCEPTIONENTRY:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Read the next entry from a file of DynValBuffer contents, like
+// llvm-memlog.log.  Returns false at the end of the file.
+static inline bool fread_dynval(FILE *f, DynValEntry *entry){
+    DynValFileSource src;
+    src.f = f;
+    return decode_dynval(src, entry);
+}
+
 // Create a new DynValBuffer
 DynValBuffer *create_dynval_buffer(uint32_t size);
 
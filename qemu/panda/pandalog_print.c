@@ -227,6 +227,13 @@ void pprint_tainted_instr(Panda__TaintedInstr *ti) {
     printf (")");
 }
 
+void pprint_taint_label_range(Panda__TaintLabelRange *tlr) {
+    printf ("(taint_label_range,");
+    printf ("va=0x%" PRIx64 ",pa=0x%" PRIx64 ",len=%u,tl=%u%s)",
+            tlr->virtual_addr, tlr->physical_addr, tlr->len, tlr->first_label,
+            tlr->positional ? "+" : "");
+}
+
 void pprint_tainted_instr_summary(Panda__TaintedInstrSummary *tis) {
     printf ("(tainted_instr_summary,");
     printf ("%" PRIx64 ",%" PRIx64 ")", tis->asid, tis->pc);
@@ -293,6 +300,9 @@ void pprint_ple(Panda__LogEntry *ple) {
     if (ple->has_taint_label_physical_addr) {
         printf (" pa=0x%" PRIx64 , ple->taint_label_physical_addr);
     }
+    if (ple->taint_label_range) {
+        pprint_taint_label_range(ple->taint_label_range);
+    }
 
     if (ple->call_stack) {
         pprint_call_stack(ple->call_stack);
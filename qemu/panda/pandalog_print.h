@@ -24,4 +24,5 @@ void pprint_tainted_branch_summary(Panda__TaintedBranchSummary *tbs);
 void pprint_tainted_branch(Panda__TaintedBranch *tb);
 void pprint_tainted_instr(Panda__TaintedInstr *tb);
 void pprint_tainted_instr_summary(Panda__TaintedInstrSummary *tb);
+void pprint_taint_label_range(Panda__TaintLabelRange *tlr);
 void pprint_dwarf(Panda__DwarfCall *d);
@@ -11,4 +11,4 @@
  * See the COPYING file in the top-level directory. 
  * 
 PANDAENDCOMMENT */
-DEF_HELPER_1(panda_insn_exec, void, tl);
+DEF_HELPER_2(panda_insn_exec, void, tl, i32);
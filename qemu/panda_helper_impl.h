@@ -11,11 +11,14 @@
  * See the COPYING file in the top-level directory. 
  * 
 PANDAENDCOMMENT */
-void helper_panda_insn_exec(target_ulong pc) {
-    // PANDA instrumentation: before basic block 
+void helper_panda_insn_exec(target_ulong pc, uint32_t owners) {
+    // PANDA instrumentation: before instruction, only for the plugins whose
+    // insn_translate asked for it (see panda_insn_translate)
     panda_cb_list *plist;
     for(plist = panda_cbs[PANDA_CB_INSN_EXEC]; plist != NULL; plist = panda_cb_list_next(plist)) {
-        plist->entry.insn_exec(env, pc);
+        if (plist->owner_bit & owners) {
+            plist->entry.insn_exec(env, pc);
+        }
     }
 }
 
@@ -52,6 +52,14 @@ int nb_panda_plugins_loaded = 0;
 char *panda_plugins_loaded[MAX_PANDA_PLUGINS];
 
 bool panda_please_flush_tb = false;
+#ifdef CONFIG_SOFTMMU
+// guest physical [start, end) ranges from panda_do_invalidate_tb_*
+typedef struct {
+    target_phys_addr_t start, end;
+} panda_tb_range;
+static panda_tb_range *panda_tb_ranges;
+static int panda_nb_tb_ranges, panda_max_tb_ranges;
+#endif
 bool panda_update_pc = false;
 bool panda_use_memcb = false;
 bool panda_tb_chaining = true;
@@ -197,6 +205,47 @@ void * panda_get_plugin_by_name(const char *plugin_name) {
     return NULL;
 }
 
+// INSN_TRANSLATE and INSN_EXEC callbacks are paired up by owner: each owner
+// that registers one gets a bit, the translator embeds the bits of the
+// owners whose insn_translate said yes into the helper call as a constant,
+// and helper_panda_insn_exec only calls the insn_exec callbacks with those
+// bits. With more owners than bits the extras share all of them, which is
+// the old broadcast behaviour.
+static void *insn_cb_owners[32];
+
+static uint32_t panda_insn_owner_bit(void *owner) {
+    int i, free_slot = -1;
+    for (i = 0; i < 32; i++) {
+        if (insn_cb_owners[i] == owner) return 1u << i;
+        if (insn_cb_owners[i] == NULL && free_slot < 0) free_slot = i;
+    }
+    if (free_slot < 0) return ~0u;
+    insn_cb_owners[free_slot] = owner;
+    return 1u << free_slot;
+}
+
+static void panda_insn_owner_release(void *owner) {
+    int i;
+    for (i = 0; i < 32; i++) {
+        if (insn_cb_owners[i] == owner) {
+            insn_cb_owners[i] = NULL;
+            // the bit may be handed out again, so no TB may still carry it
+            panda_do_flush_tb();
+        }
+    }
+}
+
+uint32_t panda_insn_translate(CPUState *env, target_ulong pc) {
+    uint32_t owners = 0;
+    panda_cb_list *plist;
+    for(plist = panda_cbs[PANDA_CB_INSN_TRANSLATE]; plist != NULL; plist = panda_cb_list_next(plist)) {
+        if (plist->entry.insn_translate(env, pc)) {
+            owners |= plist->owner_bit;
+        }
+    }
+    return owners;
+}
+
 void panda_register_callback(void *plugin, panda_cb_type type, panda_cb cb) {
     panda_cb_list *new_list = g_new0(panda_cb_list,1);
     new_list->entry = cb;
@@ -204,6 +253,9 @@ void panda_register_callback(void *plugin, panda_cb_type type, panda_cb cb) {
     new_list->prev = NULL;
     new_list->next = NULL;
     new_list->enabled = true;
+    if (type == PANDA_CB_INSN_TRANSLATE || type == PANDA_CB_INSN_EXEC) {
+        new_list->owner_bit = panda_insn_owner_bit(plugin);
+    }
     if(panda_cbs[type] != NULL) {
         new_list->next = panda_cbs[type];
         panda_cbs[type]->prev = new_list;
@@ -266,6 +318,7 @@ void panda_unregister_callbacks(void *plugin) {
         // update head
         panda_cbs[i] = plist_head;
     }
+    panda_insn_owner_release(plugin);
     //  printf ("panda_unregister_callbacks(%x) exit\n", plugin);  spit_cbs();  printf ("\n\n");
 }
 
@@ -323,6 +376,47 @@ void panda_do_flush_tb(void) {
     panda_please_flush_tb = true;
 }
 
+#ifdef CONFIG_SOFTMMU
+void panda_do_invalidate_tb_phys(target_phys_addr_t start, target_phys_addr_t len) {
+    if (len == 0) return;
+    if (panda_nb_tb_ranges == panda_max_tb_ranges) {
+        panda_max_tb_ranges = panda_max_tb_ranges ? 2 * panda_max_tb_ranges : 16;
+        panda_tb_ranges = g_renew(panda_tb_range, panda_tb_ranges, panda_max_tb_ranges);
+    }
+    panda_tb_ranges[panda_nb_tb_ranges].start = start;
+    panda_tb_ranges[panda_nb_tb_ranges].end = start + len;
+    panda_nb_tb_ranges++;
+}
+
+void panda_do_invalidate_tb_virt(CPUState *env, target_ulong start, target_ulong len) {
+    target_ulong end = start + len;
+    while (start != end) {
+        target_ulong next = (start & TARGET_PAGE_MASK) + TARGET_PAGE_SIZE;
+        target_phys_addr_t phys = panda_virt_to_phys(env, start);
+        if (next - start > end - start) {
+            next = end;
+        }
+        if (phys != -1) {
+            panda_do_invalidate_tb_phys(phys, next - start);
+        }
+        start = next;
+    }
+}
+
+// Called from cpu_exec next to panda_flush_tb. Returns true if anything
+// was invalidated.
+bool panda_invalidate_tb(void) {
+    int i;
+    if (panda_nb_tb_ranges == 0) return false;
+    for (i = 0; i < panda_nb_tb_ranges; i++) {
+        tb_invalidate_phys_addr_range(panda_tb_ranges[i].start,
+                                      panda_tb_ranges[i].end);
+    }
+    panda_nb_tb_ranges = 0;
+    return true;
+}
+#endif
+
 void panda_enable_precise_pc(void) {
     panda_update_pc = true;
 }
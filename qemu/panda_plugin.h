@@ -191,7 +191,10 @@ typedef union panda_cb {
         This instrumentation is implemented by generating a call to a
         helper function just before the instruction itself is generated.
         This is fairly expensive, which is why it's only enabled via
-        the PANDA_CB_INSN_TRANSLATE callback.
+        the PANDA_CB_INSN_TRANSLATE callback. Only the insn_exec callbacks
+        of plugins whose own insn_translate returned true for this pc are
+        called, so a plugin does not need to check the pc again unless
+        its insn_translate answer depends on more than the pc.
     
     */
     int (*insn_exec)(CPUState *env, target_ulong pc);
@@ -702,6 +705,7 @@ struct _panda_cb_list {
     panda_cb_list *next;
     panda_cb_list *prev;
     bool enabled;
+    uint32_t owner_bit; // INSN_TRANSLATE/INSN_EXEC only, see panda_insn_translate
 };
 panda_cb_list* panda_cb_list_next(panda_cb_list* plist);
 void panda_enable_plugin(void *plugin);
@@ -714,6 +718,9 @@ typedef struct panda_plugin {
 } panda_plugin;
 
 void   panda_register_callback(void *plugin, panda_cb_type type, panda_cb cb);
+// Run the INSN_TRANSLATE callbacks for pc and return the owner bits of the
+// ones that want instrumentation, for the generated panda_insn_exec call.
+uint32_t panda_insn_translate(CPUState *env, target_ulong pc);
 void   panda_unregister_callbacks(void *plugin);
 bool   panda_load_plugin(const char *filename);
 bool   panda_add_arg(const char *arg, int arglen);
@@ -733,9 +740,24 @@ target_phys_addr_t panda_virt_to_phys(CPUState *env, target_ulong addr);
 // is_write == 0 is a read from that addr into buf.  
 int panda_virtual_memory_rw(CPUState *env, target_ulong addr, uint8_t *buf, int len, int is_write);
 
+// Reads as much of [addr, addr+len) as is mapped and returns the number of
+// bytes read, instead of failing outright when some page isn't mapped.
+int panda_virtual_memory_read_bulk(CPUState *env, target_ulong addr, uint8_t *buf, int len);
+
 bool panda_flush_tb(void);
 
 void panda_do_flush_tb(void);
+
+// Throw away just the translations of code in a range, instead of the
+// whole cache, e.g. to re-instrument one function. Like panda_do_flush_tb
+// this takes effect before the next block is looked up. The virtual
+// version translates each page with the current mapping, and skips pages
+// that aren't mapped.
+#ifdef CONFIG_SOFTMMU
+void panda_do_invalidate_tb_phys(target_phys_addr_t start, target_phys_addr_t len);
+void panda_do_invalidate_tb_virt(CPUState *env, target_ulong start, target_ulong len);
+bool panda_invalidate_tb(void);
+#endif
 void panda_enable_precise_pc(void);
 void panda_disable_precise_pc(void);
 void panda_enable_memcb(void);
@@ -3,6 +3,7 @@
 #define __PANDA_PLUGIN_PLUGIN_H_
 
 #include <dlfcn.h>
+#include <stdbool.h>
 
 /*
 
@@ -40,6 +41,27 @@ in the list at the right point.
   
 #define PPP_MAX_CB 256
 
+/*
+  Callbacks for each event are kept packed at the front of their array, in
+  the order they will run, so PPP_RUN_CB just walks ppp_<cb>_num_cb entries
+  and PPP_CHECK_CB (anyone registered?) is a single load.
+
+  Callbacks may be added or removed from inside a callback, including the
+  running one.  Each PPP_RUN_CB in progress puts its position on the
+  event's ppp_cb_iter list, and add/remove move those positions along with
+  the entries they shift: a callback removed during a run is not called
+  if it hasn't been yet, one added during a run is called only if it lands
+  after the current position, and nothing is skipped or called twice.
+
+  A callback must return normally: leaving through longjmp (e.g.
+  cpu_loop_exit) skips the pop at the end of PPP_RUN_CB and leaves
+  ppp_<cb>_iter pointing into a dead stack frame.
+*/
+
+typedef struct ppp_cb_iter {
+  int ind;
+  struct ppp_cb_iter *outer;
+} ppp_cb_iter;
 
 // use this at head of A plugin
 #ifdef __cplusplus
@@ -47,11 +69,13 @@ in the list at the right point.
 extern "C" { \
 void ppp_add_cb_##cb_name(cb_name##_t fptr) ;				\
 void ppp_add_cb_##cb_name##_slot(cb_name##_t fptr, int slot_num) ; \
+bool ppp_remove_cb_##cb_name(cb_name##_t fptr) ;			\
 }
 #else
 #define PPP_PROT_REG_CB(cb_name) \
 void ppp_add_cb_##cb_name(cb_name##_t fptr) ;				\
-void ppp_add_cb_##cb_name##_slot(cb_name##_t fptr, int slot_num) ;
+void ppp_add_cb_##cb_name##_slot(cb_name##_t fptr, int slot_num) ; \
+bool ppp_remove_cb_##cb_name(cb_name##_t fptr) ;
 #endif
 
 /*
@@ -61,29 +85,58 @@ void ppp_add_cb_##cb_name##_slot(cb_name##_t fptr, int slot_num) ;
   3. create fn for registering a callback
   4. creates a fn for registering a callback in a particlular slot.  Since the
   callbacks are in an array and we will call them in order, one may want to
-  take advantage of that fact by ordering them carefully.  However, be careful
-  as there isnt any attempt, here, to detect if you leave a slot empty
+  take advantage of that fact by ordering them carefully.  The callback is
+  inserted before whatever is at slot_num; a slot past the end appends.
+  5. creates a fn for removing a callback, which returns false if fptr
+  was not registered
 */
 
 #define PPP_CB_BOILERPLATE(cb_name)		\
 cb_name##_t ppp_##cb_name##_cb[PPP_MAX_CB];	\
 int ppp_##cb_name##_num_cb = 0;				\
+ppp_cb_iter *ppp_##cb_name##_iter = NULL;		\
 							\
-void ppp_add_cb_##cb_name(cb_name##_t fptr) {			\
+void ppp_add_cb_##cb_name##_slot(cb_name##_t fptr, int slot_num) {	\
+  ppp_cb_iter *it;							\
+  int i;								\
   assert (ppp_##cb_name##_num_cb < PPP_MAX_CB);				\
-  ppp_##cb_name##_cb[ppp_##cb_name##_num_cb] = fptr;			\
+  assert (slot_num >= 0);						\
+  if (slot_num > ppp_##cb_name##_num_cb) slot_num = ppp_##cb_name##_num_cb; \
+  for (i = ppp_##cb_name##_num_cb; i > slot_num; i--) {		\
+    ppp_##cb_name##_cb[i] = ppp_##cb_name##_cb[i-1];			\
+  }									\
+  ppp_##cb_name##_cb[slot_num] = fptr;					\
   ppp_##cb_name##_num_cb += 1;						\
+  for (it = ppp_##cb_name##_iter; it; it = it->outer) {		\
+    if (slot_num <= it->ind) it->ind++;				\
+  }									\
 }									\
 									\
-void ppp_add_cb_##cb_name##_slot(cb_name##_t fptr, int slot_num) {	\
-  assert (slot_num < PPP_MAX_CB);					\
-  ppp_##cb_name##_cb[slot_num] = fptr;					\
-  ppp_##cb_name##_num_cb = MAX(slot_num, ppp_##cb_name##_num_cb);	\
-}									
+void ppp_add_cb_##cb_name(cb_name##_t fptr) {			\
+  ppp_add_cb_##cb_name##_slot(fptr, ppp_##cb_name##_num_cb);		\
+}									\
+									\
+bool ppp_remove_cb_##cb_name(cb_name##_t fptr) {			\
+  ppp_cb_iter *it;							\
+  int i, j;								\
+  for (i = 0; i < ppp_##cb_name##_num_cb; i++) {			\
+    if (ppp_##cb_name##_cb[i] == fptr) break;				\
+  }									\
+  if (i == ppp_##cb_name##_num_cb) return false;			\
+  for (j = i; j < ppp_##cb_name##_num_cb - 1; j++) {			\
+    ppp_##cb_name##_cb[j] = ppp_##cb_name##_cb[j+1];			\
+  }									\
+  ppp_##cb_name##_num_cb -= 1;						\
+  for (it = ppp_##cb_name##_iter; it; it = it->outer) {		\
+    if (i <= it->ind) it->ind--;					\
+  }									\
+  return true;								\
+}
 
 #define PPP_CB_EXTERN(cb_name) \
 extern cb_name##_t ppp_##cb_name##_cb[PPP_MAX_CB]; \
-extern int ppp_##cb_name##_num_cb;
+extern int ppp_##cb_name##_num_cb; \
+extern ppp_cb_iter *ppp_##cb_name##_iter;
 
 /*
   And employ this where you want the callback functions to be called 
@@ -91,14 +144,19 @@ extern int ppp_##cb_name##_num_cb;
  
 #define PPP_RUN_CB(cb_name, ...)					\
   {									\
-    int ppp_cb_ind;							\
-    for (ppp_cb_ind = 0; ppp_cb_ind < ppp_##cb_name##_num_cb; ppp_cb_ind++) { \
-      if (ppp_##cb_name##_cb[ppp_cb_ind] != NULL) {			\
-	ppp_##cb_name##_cb[ppp_cb_ind]( __VA_ARGS__ ) ;			\
+    if (ppp_##cb_name##_num_cb > 0) {					\
+      ppp_cb_iter ppp_it = { 0, ppp_##cb_name##_iter };		\
+      ppp_##cb_name##_iter = &ppp_it;					\
+      for (; ppp_it.ind < ppp_##cb_name##_num_cb; ppp_it.ind++) {	\
+	ppp_##cb_name##_cb[ppp_it.ind]( __VA_ARGS__ ) ;			\
       }									\
+      ppp_##cb_name##_iter = ppp_it.outer;				\
     }									\
   }
 
+// True if anything is registered for cb_name. Check this before doing
+// work that only feeds the callbacks, e.g. reading their arguments out of
+// the guest.
 #define PPP_CHECK_CB(cb_name) (ppp_##cb_name##_num_cb > 0)
 
 /****************************************************************
@@ -122,6 +180,21 @@ to add a callback to be run inside of plugin A.
     add_cb (cb_func);							\
   }
 
+// Undo a PPP_REG_CB, e.g. from plugin B's uninit_plugin or once it has
+// seen what it was waiting for.
+#define PPP_REMOVE_CB(other_plugin, cb_name, cb_func)			\
+  {									\
+    dlerror();								\
+    void *op = panda_get_plugin_by_name("panda_" other_plugin ".so");	\
+    if (!op) {								\
+      printf("In trying to remove plugin callback, couldn't load %s plugin\n", other_plugin); \
+      assert (op);							\
+    }									\
+    bool (*remove_cb)(cb_name##_t fptr) = (bool (*)(cb_name##_t)) dlsym(op, "ppp_remove_cb_" #cb_name); \
+    assert (remove_cb != 0); \
+    remove_cb (cb_func);						\
+  }
+
 
 
 
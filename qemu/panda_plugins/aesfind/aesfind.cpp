@@ -25,6 +25,7 @@ extern "C" {
 #include "disas.h"
 
 #include "panda_plugin.h"
+#include "panda_common.h"
 
 }
 
@@ -40,6 +41,7 @@ extern "C" {
 #include <algorithm>
 
 #include "../common/prog_point.h"
+#include "../common/open_hash.h"
 #include "pandalog.h"
 #include "../callstack_instr/callstack_instr_ext.h"
 
@@ -103,28 +105,6 @@ int cb_write(CPUState *env, target_ulong pc, target_ulong addr, target_ulong siz
 }
 */
 
-std::map< target_ulong, std::deque< uint32_t > > past_reads;
-std::deque< std::pair < uint32_t, std::vector< uint32_t > > > current_keys;
-
-int cb_read(CPUState *env, target_ulong pc, target_ulong addr, target_ulong size, void *buf) {
-
-  if (size != 4) {
-    return 0;
-  }
-
-  prog_point pp = {};
-  auto cbuf = (unsigned char*) buf;
-  get_prog_point(env, &pp);
-  auto &cur = past_reads[pp.cr3];
-
-  uint32_t val = *((uint32_t*) buf);
-  cur.push_front(val);
-  if (cur.size() > CACHE_LEN) {
-    cur.resize(CACHE_LEN);
-  }
-
-}
-
 // Some code from https://sources.debian.net/src/nettle/2.7.1-5%2Bdeb8u1/aes-internal.h/ and https://sources.debian.net/src/nettle/2.7.1-5%2Bdeb8u1/macros.h/
 #define B0(x) ((x) & 0xff)
 #define B1(x) (((x) >> 8) & 0xff)
@@ -136,53 +116,142 @@ int cb_read(CPUState *env, target_ulong pc, target_ulong addr, target_ulong size
 		      | ((uint32_t)(box)[B3(x)] << 24))
 #define ROTL32(n,x) (((x)<<(n)) | ((x)>>(32-(n))))
 
-static inline bool test_schedule_core(const uint32_t prev, const uint32_t key, const uint32_t res, const prog_point pp, const int round) {
+#define ROUND 1
+
+// A key schedule step is res = SubWord(RotWord(key)) ^ rcon ^ prev, for a
+// key word and a prev word read shortly before res is written. Rather than
+// trying every (key, prev) pair on each write, the SubWord side is worked
+// out once for each read as it comes in; a write then only needs to look
+// for prev = res ^ core(key) among the recent reads.
+struct read_word {
+    uint32_t val;
+    // core(val), and the same for the byte-swapped word, swapped back
+    uint32_t core, core_bs;
+    // Memory areas filled with the same byte often generate false
+    // positives; we exclude all the keys whose four bytes have the same
+    // value
+    bool ok, ok_bs;
+};
+
+static inline bool distinct_bytes(uint32_t key) {
+    return !(B0(key) == B1(key) || B0(key) == B2(key) || B0(key) == B3(key));
+}
 
-  // Memory areas filled with the same byte often generate false
-  // positives; we exclude all the keys whose four bytes have the same
-  // value
-  if (B0(key) == B1(key) || B0(key) == B2(key) || B0(key) == B3(key)) {
-    return false;
-  }
-  if (res == (SUBBYTE(ROTL32(24, key), sbox) ^ rcon[round] ^ prev)) {
-    printf("Found match! %08x %08x %08x\n", prev, key, res);
-    printf("%s\n", pp.to_string().c_str());
-    return true;
-  } else {
-    return false;
-  }
+static inline uint32_t schedule_core(uint32_t key) {
+    return SUBBYTE(ROTL32(24, key), sbox) ^ rcon[ROUND];
+}
+
+// The last CACHE_LEN 4-byte reads in one address space, newest first when
+// walked with at(). bloom has a bit set for a hash of each word in the
+// ring, so most writes are turned away without looking at the words.
+struct read_ring {
+    read_word words[CACHE_LEN];
+    unsigned head, count;
+    uint64_t bloom;
+
+    read_ring() : head(0), count(0), bloom(0) {}
+
+    static inline uint64_t bloom_bit(uint32_t v) {
+        return 1ULL << ((v * 0x9e3779b1U) >> 26);
+    }
 
+    const read_word &at(unsigned i) const {
+        return words[(head + CACHE_LEN - 1 - i) % CACHE_LEN];
+    }
+
+    void push(uint32_t val) {
+        read_word &w = words[head];
+        w.val = val;
+        w.core = schedule_core(val);
+        w.ok = distinct_bytes(val);
+        uint32_t bs = __bswap_32(val);
+        w.core_bs = __bswap_32(schedule_core(bs));
+        w.ok_bs = distinct_bytes(bs);
+        head = (head + 1) % CACHE_LEN;
+        if (count < CACHE_LEN) count++;
+        bloom = 0;
+        for (unsigned i = 0; i < count; i++) bloom |= bloom_bit(at(i).val);
+    }
+
+    bool may_contain(uint32_t v) const { return bloom & bloom_bit(v); }
+};
+
+OpenHashMap< target_ulong, read_ring > past_reads;
+std::deque< std::pair < uint32_t, std::vector< uint32_t > > > current_keys;
+
+static target_ulong last_asid = 0;
+static read_ring *last_ring = NULL;
+
+// Same address space as get_prog_point() reports, without the callstack
+// lookup, which is only needed when there is a match to print.
+static read_ring &ring_for(CPUState *env) {
+    target_ulong asid = panda_in_kernel(env) ? 0 : panda_current_asid(env);
+    if (!last_ring || asid != last_asid) {
+        last_ring = &past_reads[asid];
+        last_asid = asid;
+    }
+    return *last_ring;
 }
 
-int cb_write(CPUState *env, target_ulong pc, target_ulong addr, target_ulong size, void *buf) {
+int cb_read(CPUState *env, target_ulong pc, target_ulong addr, target_ulong size, void *buf) {
 
   if (size != 4) {
     return 0;
   }
 
+  uint32_t val = *((uint32_t*) buf);
+  ring_for(env).push(val);
+
+  return 0;
+}
+
+static void report_match(CPUState *env, uint32_t prev, uint32_t key, uint32_t res) {
   prog_point pp = {};
-  auto cbuf = (unsigned char*) buf;
   get_prog_point(env, &pp);
-  auto &cur = past_reads[pp.cr3];
+  printf("Found match! %08x %08x %08x\n", prev, key, res);
+  printf("%s\n", pp.to_string().c_str());
+}
+
+int cb_write(CPUState *env, target_ulong pc, target_ulong addr, target_ulong size, void *buf) {
+
+  if (size != 4) {
+    return 0;
+  }
+
+  // A write into an address space we have not seen a read in can't match
+  // anything, so don't create a ring for it.
+  target_ulong asid = panda_in_kernel(env) ? 0 : panda_current_asid(env);
+  if (!(last_ring && asid == last_asid) && !past_reads.contains(asid)) {
+    return 0;
+  }
+  const read_ring &cur = ring_for(env);
 
   uint32_t val = *((uint32_t*) buf);
-  for (auto &key : cur) {
-    //test_schedule_core(0, key, val, pp, 1);
-    //test_schedule_core(0, __bswap_32(key), __bswap_32(val), pp, 1);
-    for (auto &prev : cur) {
-      if (test_schedule_core(prev, key, val, pp, 1)) {
+  for (unsigned i = 0; i < cur.count; i++) {
+    const read_word &key = cur.at(i);
+    uint32_t want = val ^ key.core;
+    uint32_t want_bs = val ^ key.core_bs;
+    bool try_le = key.ok && cur.may_contain(want);
+    bool try_be = key.ok_bs && cur.may_contain(want_bs);
+    if (!try_le && !try_be) continue;
+    for (unsigned j = 0; j < cur.count; j++) {
+      uint32_t prev = cur.at(j).val;
+      if (try_le && prev == want) {
+        report_match(env, prev, key.val, val);
         std::vector< uint32_t > v;
-        v.push_back(key);
+        v.push_back(key.val);
         current_keys.push_front(make_pair(val, v));
       }
-      if (test_schedule_core(__bswap_32(prev), __bswap_32(key), __bswap_32(val), pp, 1)) {
+      if (try_be && prev == want_bs) {
+        report_match(env, __bswap_32(prev), __bswap_32(key.val), __bswap_32(val));
         std::vector< uint32_t > v;
-        v.push_back(key);
+        v.push_back(key.val);
         current_keys.push_front(make_pair(val, v));
       }
     }
   }
 
+  return 0;
 }
 
 bool init_plugin(void *self) {
@@ -31,11 +31,12 @@ extern "C" {
 #include <stdlib.h>
 #include <ctype.h>
 #include <math.h>
-#include <map>
-#include <list>
+#include <vector>
 #include <algorithm>
 
 #include "../common/prog_point.h"
+#include "../common/open_hash.h"
+#include "../common/prog_point_table.h"
 #include "pandalog.h"
 #include "../callstack_instr/callstack_instr_ext.h"
 
@@ -53,14 +54,52 @@ int mem_read_callback(CPUState *env, target_ulong pc, target_ulong addr, target_
 uint64_t bytes_read, bytes_written;
 uint64_t num_reads, num_writes;
 
+// Most tap points only ever see a few hundred distinct bigrams, so they
+// start out with a small hash table and only get a dense 64K-entry array
+// once that table would be about as big.
+#define BIGRAM_DENSE_THRESHOLD 8192
+
 struct text_counter {
     bool started;
     int num_bytes;
     unsigned char prev_char;
-    std::map<unsigned short,unsigned int> hist;
+    OpenHashMap<unsigned short,unsigned int> sparse;
+    std::vector<unsigned int> dense;
+
+    text_counter() : started(false), num_bytes(0), prev_char(0), sparse(16) {}
+
+    inline void count(unsigned short bigram) {
+        if (!dense.empty()) {
+            dense[bigram]++;
+            return;
+        }
+        sparse[bigram]++;
+        if (sparse.size() > BIGRAM_DENSE_THRESHOLD) {
+            dense.assign(1 << 16, 0);
+            sparse.for_each([&](unsigned short k, unsigned int v) { dense[k] = v; });
+            sparse = OpenHashMap<unsigned short,unsigned int>(16);
+        }
+    }
+
+    // (bigram, count) pairs in increasing bigram order
+    std::vector<std::pair<unsigned short,unsigned int>> sorted_hist() {
+        std::vector<std::pair<unsigned short,unsigned int>> out;
+        if (!dense.empty()) {
+            for (unsigned int i = 0; i < dense.size(); i++) {
+                if (dense[i]) out.push_back(std::make_pair((unsigned short)i, dense[i]));
+            }
+        }
+        else {
+            out.reserve(sparse.size());
+            sparse.for_each([&](unsigned short k, unsigned int v) { out.push_back(std::make_pair(k, v)); });
+            std::sort(out.begin(), out.end());
+        }
+        return out;
+    }
 };
 
-std::map<prog_point,text_counter> text_tracker;
+// Counters are heap-allocated so growing the table doesn't copy histograms.
+ProgPointTable<text_counter *> text_tracker;
 //FILE *text_memlog;
 
 int mem_write_callback(CPUState *env, target_ulong pc, target_ulong addr,
@@ -71,23 +110,25 @@ int mem_write_callback(CPUState *env, target_ulong pc, target_ulong addr,
 
     get_prog_point(env, &p);
 
-    text_counter &tc = text_tracker[p];    
+    text_counter *&slot = text_tracker[p];
+    if (!slot) slot = new text_counter();
+    text_counter &tc = *slot;
 
-    for (unsigned int i = 0; i < size; i++) {
-        unsigned char val = ((unsigned char *)buf)[i];
-        //fprintf(text_memlog, TARGET_FMT_lx "." TARGET_FMT_lx " " TARGET_FMT_lx " %02x\n" , p.pc, p.caller, addr+i, val);
-        if (!tc.started) {
-            tc.prev_char = val;
-            tc.started = true;
-        } 
-        else {
-            unsigned short bigram;
-            bigram = (tc.prev_char << 8) | val;
-            tc.hist[bigram]++;
-            tc.prev_char = val;
-        }
-        tc.num_bytes++;
+    unsigned char *bytes = (unsigned char *)buf;
+    unsigned int i = 0;
+    if (!tc.started && size > 0) {
+        tc.prev_char = bytes[0];
+        tc.started = true;
+        i = 1;
+    }
+    unsigned char prev = tc.prev_char;
+    for (; i < size; i++) {
+        //fprintf(text_memlog, TARGET_FMT_lx "." TARGET_FMT_lx " " TARGET_FMT_lx " %02x\n" , p.pc, p.caller, addr+i, bytes[i]);
+        tc.count((prev << 8) | bytes[i]);
+        prev = bytes[i];
     }
+    tc.prev_char = prev;
+    tc.num_bytes += size;
  
     return 1;
 }
@@ -128,29 +169,28 @@ void uninit_plugin(void *self) {
     uint32_t target_ulong_size = sizeof(target_ulong);
     fwrite(&target_ulong_size, sizeof(uint32_t), 1, mem_report);
 
-    std::map<prog_point,text_counter>::iterator it;
-    for(it = text_tracker.begin(); it != text_tracker.end(); it++) {
+    // Same (sorted) order the report always had
+    text_tracker.for_each_sorted([&](const prog_point &p, text_counter *tc) {
         // Skip low-data entries
-        if (it->second.num_bytes < 80) continue;
+        if (tc->num_bytes < 80) return;
 
-        unsigned int hist_keys = 0;
-        hist_keys = it->second.hist.size();
+        std::vector<std::pair<unsigned short,unsigned int>> hist = tc->sorted_hist();
+        unsigned int hist_keys = hist.size();
 
         // Write the program point
-        fwrite(&it->first, sizeof(prog_point), 1, mem_report);
+        fwrite(&p, sizeof(prog_point), 1, mem_report);
 
         // Write the number of keys
         fwrite(&hist_keys, sizeof(hist_keys), 1, mem_report);
         
         // Write each key/value of the (hopefully sparse) histogram
-        std::map<unsigned short,unsigned int>::iterator it2;
-        for(it2 = it->second.hist.begin(); it2 != it->second.hist.end(); it2++) {
-            fwrite(&it2->first, sizeof(it2->first), 1, mem_report);   // Key: unsigned short
-            fwrite(&it2->second, sizeof(it2->second), 1, mem_report); // Value: unsigned int
+        for (auto &kv : hist) {
+            fwrite(&kv.first, sizeof(kv.first), 1, mem_report);   // Key: unsigned short
+            fwrite(&kv.second, sizeof(kv.second), 1, mem_report); // Value: unsigned int
         }
         //printf("Wrote histogram with %d entries (%ld bytes)\n", 
         //    hist_keys, (sizeof(unsigned short)+sizeof(unsigned long))*hist_keys + sizeof(prog_point) + sizeof(hist_keys));
-    }
+    });
     fclose(mem_report);
     
     //fclose(text_memlog);
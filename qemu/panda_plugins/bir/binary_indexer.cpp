@@ -112,6 +112,8 @@ int main (int argc, char **argv) {
     printf ("marshalling inv index\n");  
     indc->filename_prefix = filename_prefix;
     marshall_invindex(indc, inv);
+    printf ("marshalling postings\n");
+    marshall_postings(indc, inv);
     printf ("total_bytes = %ld\n", total_bytes);
     printf ("indexing complete\n");
     
@@ -93,6 +93,10 @@ int main (int argc, char **argv) {
         }
     }
     printf ("done unmarshalling inv\n");
+    // (re)write flat posting lists so that indexes made before they
+    // existed can be used by the bir plugin's fast path.  NB: do this
+    // before the scoring below, which adds empty entries to docs_with_word
+    marshall_postings(indc, inv);
 
     std::vector < double > scoring_params(indc->max_n_gram + 1);
     double sum = 0.0;
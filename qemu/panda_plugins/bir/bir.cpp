@@ -74,6 +74,9 @@ uint32_t binary_len = 0;
 bool use_cache = false;
 std::vector < double > scoring_params;
 std::vector<FILE *>fpinv;
+// mmapped posting lists for max_n_gram, if the index has them
+Postings *post = NULL;
+ScoreAcc *score_acc = NULL;
 uint64_t first_instr=0;
 
 // map from filename to binary contents
@@ -315,12 +318,13 @@ int bir_before_block_exec(CPUState *env, TranslationBlock *tb) {
 
     target_ulong asid = panda_current_asid(env);
     AsidPc asidpc = std::make_pair(asid,tb->pc);
-    if (use_cache && bircache.count(asidpc) != 0) {
+    auto cached = use_cache ? bircache.find(asidpc) : bircache.end();
+    if (cached != bircache.end()) {
         // its in the cache
-        auto psginfo = bircache[asidpc];
-        Filename filename = std::get<0>(psginfo);
+        PsgInfo &psginfo = cached->second;
+        Filename &filename = std::get<0>(psginfo);
         Offset offset = std::get<1>(psginfo);
-        Score score = std::get<2>(psginfo);
+        Score &score = std::get<2>(psginfo);
         if (filename == UNKNOWN) {
             run_stats();
             run_length = 0;
@@ -347,14 +351,24 @@ int bir_before_block_exec(CPUState *env, TranslationBlock *tb) {
         //        else {
         {
             // actually copy the code into the query buffer at the correct place
-            int ret = panda_virtual_memory_rw(env, tb->pc, query_buffer, indc->passage_len_bytes, 0);    
-            Passage query_passage = index_passage (indc, /* update_lexicon = */ false,
-                                                   query_buffer, query_len,
-                                                   /* note: we dont really care about passage ind */
-                                                   /* passage_ind = */ 0xdeadbeef);
-            std::vector<uint32_t> best_uind;
-            std::vector<Score> scores = std::vector<Score>(indc->num_uind);
-            Score best_score = query_with_passage(indc, inv, fpinv, query_passage, scoring_params, scores, best_uind);
+            // read enough for both the query and the offset search below.
+            // leave 8 bytes of slack since gram64 reads a whole uint64_t
+            uint32_t read_len = std::min(std::max(query_len, indc->passage_len_bytes), 4096U - 8);
+            memset(query_buffer + read_len, 0, 8);
+            int ret = panda_virtual_memory_rw(env, tb->pc, query_buffer, read_len, 0);    
+            Score best_score;
+            if (post) {
+                best_score = query_with_postings(indc, post, score_acc, query_buffer, std::min(query_len, read_len));
+            }
+            else {
+                Passage query_passage = index_passage (indc, /* update_lexicon = */ false,
+                                                       query_buffer, query_len,
+                                                       /* note: we dont really care about passage ind */
+                                                       /* passage_ind = */ 0xdeadbeef);
+                std::vector<uint32_t> best_uind;
+                std::vector<Score> scores = std::vector<Score>(indc->num_uind);
+                best_score = query_with_passage(indc, inv, fpinv, query_passage, scoring_params, scores, best_uind);
+            }
             fprintf (output, "bestscore=%f sumsize=%d -- ", best_score.val, best_score.sumsize);
             if ( (best_score.sumsize > query_len / 2) && (best_score.val < 0.2) ) {           
             
@@ -530,6 +544,15 @@ bool init_plugin(void *self) {
             for (uint32_t n = 0; n <= indc->max_n_gram; n++) {
                 scoring_params[n] /= psum;
             }
+            // query_with_passage only ever scores max_n_gram, so that is
+            // the only posting file we need
+            post = unmarshall_postings(pfx, indc->max_n_gram);
+            if (post) {
+                score_acc = new_score_acc(indc);
+            }
+            else {
+                printf ("bir: no posting file for n=%d, reading rows from the inv files\n", indc->max_n_gram);
+            }
             // open up all the inv files
             printf ("opening inv files\n");
             fpinv = std::vector < FILE * >(indc->max_n_gram + 1);
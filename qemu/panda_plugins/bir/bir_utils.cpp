@@ -6,6 +6,8 @@ extern "C"{
 #include <unistd.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
 #include <assert.h>
 #include <string.h>
 #include <math.h>
@@ -1107,6 +1109,162 @@ Score query_with_passage(IndexCommon * indc,
 
 
 
+void marshall_postings(IndexCommon *indc, InvIndex *inv) {
+    std::string pfx = indc->filename_prefix;
+    for (uint32_t n=indc->min_n_gram; n<=indc->max_n_gram; n++) {
+        std::map < Gram, std::map < uint32_t, uint32_t > > &dw = inv->docs_with_word[n];
+        PostingsHeader hdr = {};
+        hdr.magic = POSTINGS_MAGIC;
+        hdr.version = POSTINGS_VERSION;
+        hdr.n = n;
+        for ( auto &kvp : dw ) {
+            if (kvp.second.size() == 0) continue;
+            hdr.num_grams ++;
+            hdr.num_counts += kvp.second.size();
+        }
+        // keep load factor under 3/4, same as OpenHashMap
+        hdr.table_size = 16;
+        while (hdr.num_grams * 4 > hdr.table_size * 3) hdr.table_size <<= 1;
+        uint64_t mask = hdr.table_size - 1;
+        std::vector < PostingSlot > slots(hdr.table_size);
+        memset(&slots[0], 0, sizeof(PostingSlot) * hdr.table_size);
+        uint64_t start = 0;
+        for ( auto &kvp : dw ) {
+            if (kvp.second.size() == 0) continue;
+            uint64_t i = open_hash_mix(kvp.first) & mask;
+            while (slots[i].len != 0) i = (i + 1) & mask;
+            slots[i].gram = kvp.first;
+            slots[i].start = start;
+            slots[i].len = kvp.second.size();
+            start += kvp.second.size();
+        }
+        std::string filename = pfx + ".post-" + std::to_string(n);
+        printf ("marshalling postings for %d-grams: %ld grams %ld counts\n", n, hdr.num_grams, hdr.num_counts);
+        FILE *fp = fopen((char *) filename.c_str(), "w");
+        assert (fp != NULL);
+        WU(hdr);
+        fwrite(&slots[0], sizeof(PostingSlot), hdr.table_size, fp);
+        // rows in the same (gram) order the starts were handed out in
+        for ( auto &kvp : dw ) {
+            for ( auto &pc : kvp.second ) {
+                CountPair cp = {pc.first, pc.second};
+                WU(cp);
+            }
+        }
+        fclose(fp);
+    }
+}
+
+
+// returns NULL if there is no (valid) posting file for n
+Postings *unmarshall_postings(std::string pfx, uint32_t n) {
+    std::string filename = pfx + ".post-" + std::to_string(n);
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+    struct stat st;
+    fstat(fd, &st);
+    if ((size_t) st.st_size < sizeof(PostingsHeader)) {
+        close(fd);
+        return NULL;
+    }
+    void *map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        return NULL;
+    }
+    PostingsHeader *hdr = (PostingsHeader *) map;
+    size_t want = sizeof(PostingsHeader) + hdr->table_size * sizeof(PostingSlot)
+        + hdr->num_counts * sizeof(CountPair);
+    if (hdr->magic != POSTINGS_MAGIC || hdr->version != POSTINGS_VERSION
+        || hdr->n != n || want != (size_t) st.st_size) {
+        printf ("%s is not a valid posting file\n", filename.c_str());
+        munmap(map, st.st_size);
+        return NULL;
+    }
+    // rows are read in gram-hash order, i.e. randomly
+    madvise(map, st.st_size, MADV_RANDOM);
+    Postings *post = new Postings;
+    post->n = n;
+    post->mask = hdr->table_size - 1;
+    post->slots = (PostingSlot *) (hdr + 1);
+    post->counts = (CountPair *) (post->slots + hdr->table_size);
+    post->map = map;
+    post->map_len = st.st_size;
+    printf ("mapped %s: %ld grams %ld counts\n", filename.c_str(), hdr->num_grams, hdr->num_counts);
+    return post;
+}
+
+
+ScoreAcc *new_score_acc(IndexCommon *indc) {
+    ScoreAcc *acc = new ScoreAcc;
+    acc->val = std::vector < double >(indc->num_uind, 0.0);
+    acc->sumsize = std::vector < uint32_t >(indc->num_uind, 0);
+    // a gram can't occur more often than there are bytes in the passage
+    uint32_t L = indc->passage_len_bytes;
+    acc->logc = std::vector < double >(L + 1);
+    acc->logc[0] = 0.0;
+    for (uint32_t c=1; c<=L; c++) {
+        acc->logc[c] = log(((double) c) / L);
+    }
+    return acc;
+}
+
+
+Score query_with_postings(IndexCommon *indc, Postings *post, ScoreAcc *acc,
+                          uint8_t *buf, uint32_t len) {
+    uint32_t n = post->n;
+    uint32_t L = indc->passage_len_bytes;
+    double inv_L = 1.0 / L;
+    // max_n-gram counts for the query
+    acc->query_counts.clear();
+    for (uint32_t i=0; i+n<=len; i++) {
+        acc->query_counts[gram64(buf+i, n)] ++;
+    }
+    double *val = &acc->val[0];
+    uint32_t *sumsize = &acc->sumsize[0];
+    const double *logc = &acc->logc[0];
+    acc->query_counts.for_each([&](const Gram &gram, uint32_t gram_count) {
+        uint32_t row_len;
+        const CountPair *row = postings_row(post, gram, &row_len);
+        // same on-the-fly pruning as unmarshall_row_fp
+        if (row == NULL || row_len > max_row_length) return;
+        // pq*log(pq/pu) + pu*log(pu/pq) == (pq - pu) * (log pq - log pu),
+        // and log pu comes out of a table, so the inner loop has no calls
+        // or branches apart from noticing a uind for the first time
+        double pq = ((double) gram_count) * inv_L;
+        double log_pq = log(pq);
+        for (uint32_t i=0; i<row_len; i++) {
+            uint32_t uind = row[i].passage_ind;
+            uint32_t c = row[i].count;
+            double pu = c * inv_L;
+            double log_pu = (c <= L) ? logc[c] : log(pu);
+            if (sumsize[uind] == 0) acc->touched.push_back(uind);
+            val[uind] += (pq - pu) * (log_pq - log_pu);
+            sumsize[uind] ++;
+        }
+    });
+    // same ordering as query_with_passage: max sumsize, then min val, then
+    // lowest uind.  If nothing matched, that is uind 0 with an empty score.
+    Score best_score = {0, 0.0, 0};
+    for ( auto uind : acc->touched ) {
+        Score sc = {uind, val[uind], sumsize[uind]};
+        if (sc.sumsize > best_score.sumsize
+            || (sc.sumsize == best_score.sumsize
+                && (sc.val < best_score.val
+                    || (sc.val == best_score.val && sc.uind < best_score.uind)))) {
+            best_score = sc;
+        }
+        val[uind] = 0.0;
+        sumsize[uind] = 0;
+    }
+    acc->touched.clear();
+    return best_score;
+}
+
+
+
 
 #if 0
 
@@ -11,6 +11,8 @@ extern "C"{
 #include <vector>
 #include <string>
 
+#include "../common/open_hash.h"
+
 
 
 
@@ -141,6 +143,72 @@ typedef struct pp_score_struct {
 
 
 
+// Flat posting lists for one value of n, written by marshall_postings to
+// <pfx>.post-<n> and mmapped at query time.  The file is
+//
+//   PostingsHeader
+//   PostingSlot[table_size]   open-addressed gram -> row table
+//   CountPair[num_counts]     all rows, back to back
+//
+// The slot table is hashed with open_hash_mix and probed linearly, so a
+// gram lookup is one or two cache lines straight out of the page cache and
+// nothing has to be built at startup.  An empty slot has len 0 (empty rows
+// are not written).
+#define POSTINGS_MAGIC 0x50524942   // "BIRP"
+#define POSTINGS_VERSION 1
+
+typedef struct postings_header_struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t n;
+    uint32_t pad;
+    uint64_t num_grams;
+    uint64_t table_size;   // power of 2
+    uint64_t num_counts;
+} PostingsHeader;
+
+typedef struct posting_slot_struct {
+    Gram gram;
+    uint64_t start;        // index of first CountPair in row
+    uint32_t len;          // 0 means empty slot
+    uint32_t pad;
+} PostingSlot;
+
+typedef struct postings_struct {
+    uint32_t n;
+    uint64_t mask;
+    const PostingSlot *slots;
+    const CountPair *counts;
+    void *map;
+    size_t map_len;
+} Postings;
+
+// row of (uind, count) pairs for gram, or NULL if gram has none
+static inline const CountPair *postings_row(const Postings *post, Gram gram, uint32_t *len) {
+    uint64_t i = open_hash_mix(gram) & post->mask;
+    while (post->slots[i].len != 0) {
+        if (post->slots[i].gram == gram) {
+            *len = post->slots[i].len;
+            return post->counts + post->slots[i].start;
+        }
+        i = (i + 1) & post->mask;
+    }
+    *len = 0;
+    return NULL;
+}
+
+// scratch space for query_with_postings, reused across queries so that a
+// query only ever touches the uinds that share a gram with it
+typedef struct score_acc_struct {
+    std::vector < double > val;
+    std::vector < uint32_t > sumsize;
+    std::vector < uint32_t > touched;
+    // logc[c] = log(c / passage_len_bytes)
+    std::vector < double > logc;
+    OpenHashMap < Gram, uint32_t > query_counts;
+} ScoreAcc;
+
+
 #define RU(u)                                                  \
     {                                                          \
         size_t nnn = fread(&(u), sizeof(u), 1, fp);              \
@@ -296,6 +364,20 @@ Passage index_passage (IndexCommon *indc, bool update,
                        uint32_t uind);
 
 
+// write / map the flat posting lists (see PostingsHeader)
+void marshall_postings(IndexCommon *indc, InvIndex *inv);
+Postings *unmarshall_postings(std::string pfx, uint32_t n);
+
+ScoreAcc *new_score_acc(IndexCommon *indc);
+
+/*
+  Same scoring as query_with_passage, but straight from the query bytes
+  (max_n-grams only, which is all query_with_passage looks at) and against
+  the mmapped posting lists.
+*/
+Score query_with_postings(IndexCommon *indc, Postings *post, ScoreAcc *acc,
+                          uint8_t *buf, uint32_t len);
+
 std::map < uint64_t, uint64_t > unmarshall_uint64_uint64_map(std::string filename) ;
 void marshall_uint64_uint64_map(std::string filename, std::map < uint64_t, uint64_t > &uumap) ;
 
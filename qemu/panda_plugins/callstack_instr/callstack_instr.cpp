@@ -103,6 +103,22 @@ std::map<stackid, std::vector<target_ulong>> function_stacks;
 std::map<target_ulong, instr_type> call_cache;
 int last_ret_size = 0;
 
+// Innermost caller for get_prog_point. The shadow stacks only change in
+// before_block_exec and after_block_exec, so every memory access in a block
+// would otherwise repeat the same two map lookups to get the same answer;
+// tap plugins call get_prog_point on every one of them. Filled in by the
+// first lookup in a block and dropped whenever a stack changes. Keyed on
+// the ASID too, since an exception can switch address spaces without a
+// block boundary in between. The stack heuristic picks a stack by SP,
+// which can move within a block, so it always does the full lookup.
+struct caller_cache_t {
+    bool valid;
+    target_ulong asid;
+    int n_callers;
+    target_ulong caller;
+};
+static caller_cache_t caller_cache;
+
 static inline bool in_kernelspace(CPUState *env) {
 #if defined(TARGET_I386)
     return ((env->hflags & HF_CPL_MASK) == 0);
@@ -294,6 +310,8 @@ int after_block_translate(CPUState *env, TranslationBlock *tb) {
 }
 
 int before_block_exec(CPUState *env, TranslationBlock *tb) {
+    caller_cache.valid = false;
+
     std::vector<stack_entry> &v = callstacks[get_stackid(env,tb->pc)];
     std::vector<target_ulong> &w = function_stacks[get_stackid(env,tb->pc)];
     if (v.empty()) return 1;
@@ -307,6 +325,8 @@ int before_block_exec(CPUState *env, TranslationBlock *tb) {
             PPP_RUN_CB(on_ret, env, w[i]);
             v.erase(v.begin()+i, v.end());
             w.erase(w.begin()+i, w.end());
+            // on_ret callbacks may have looked up the caller before the pop
+            caller_cache.valid = false;
 
             break;
         }
@@ -318,6 +338,8 @@ int before_block_exec(CPUState *env, TranslationBlock *tb) {
 int after_block_exec(CPUState *env, TranslationBlock *tb, TranslationBlock *next) {
     instr_type tb_type = call_cache[tb->pc];
 
+    caller_cache.valid = false;
+
     if (tb_type == INSTR_CALL) {
         stack_entry se = {tb->pc+tb->size,tb_type};
         callstacks[get_stackid(env,tb->pc)].push_back(se);
@@ -407,7 +429,19 @@ void get_prog_point(CPUState *env, prog_point *p) {
 
     // Try to get the caller
     int n_callers = 0;
-    n_callers = get_callers(&p->caller, 1, env);
+    if (caller_cache.valid && caller_cache.asid == asid) {
+        n_callers = caller_cache.n_callers;
+        if (n_callers) p->caller = caller_cache.caller;
+    }
+    else {
+        n_callers = get_callers(&p->caller, 1, env);
+#ifndef USE_STACK_HEURISTIC
+        caller_cache.valid = true;
+#endif
+        caller_cache.asid = asid;
+        caller_cache.n_callers = n_callers;
+        caller_cache.caller = p->caller;
+    }
 
     if (n_callers == 0) {
 #ifdef TARGET_I386
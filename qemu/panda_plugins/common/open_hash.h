@@ -0,0 +1,196 @@
+/* PANDABEGINCOMMENT
+ *
+ * Authors:
+ *  Tim Leek               tleek@ll.mit.edu
+ *  Ryan Whelan            rwhelan@ll.mit.edu
+ *  Joshua Hodosh          josh.hodosh@ll.mit.edu
+ *  Michael Zhivich        mzhivich@ll.mit.edu
+ *  Brendan Dolan-Gavitt   brendandg@gatech.edu
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+
+#ifndef __OPEN_HASH_H_
+#define __OPEN_HASH_H_
+
+// Open-addressed hash table with linear probing, for the hot lookups that
+// plugins do on every block or memory access. Everything lives in one flat
+// array, so a lookup is a hash plus (usually) a single cache line, and
+// there is no per-entry allocation. Erase uses backward-shift deletion, so
+// no tombstones build up in tables with a lot of churn.
+//
+// Pointers returned by find()/operator[] are invalidated by any insert
+// that grows the table and by erase().
+
+#include <stdint.h>
+#include <stddef.h>
+#include <utility>
+#include <vector>
+#include <functional>
+
+// std::hash on integers is the identity, which is terrible with a
+// power-of-two mask (guest addresses share their low bits), so all hashes
+// go through a 64-bit finalizer first.
+static inline size_t open_hash_mix(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return (size_t)h;
+}
+
+// OpenHashMap mixes whatever this returns, so a cheap combine is enough.
+template<typename A, typename B>
+struct open_hash_pair {
+    size_t operator()(const std::pair<A,B> &p) const {
+        return std::hash<A>()(p.first) * 31 + std::hash<B>()(p.second);
+    }
+};
+
+template<typename K, typename V, typename Hash = std::hash<K>>
+class OpenHashMap {
+public:
+    typedef std::pair<K,V> value_type;
+
+    explicit OpenHashMap(size_t initial_capacity = 16) : count(0) {
+        size_t cap = 16;
+        while (cap < initial_capacity) cap <<= 1;
+        slots.resize(cap);
+        used.assign(cap, 0);
+        mask = cap - 1;
+    }
+
+    V *find(const K &key) {
+        size_t i = home(key);
+        while (used[i]) {
+            if (slots[i].first == key) return &slots[i].second;
+            i = (i + 1) & mask;
+        }
+        return NULL;
+    }
+
+    const V *find(const K &key) const {
+        return const_cast<OpenHashMap *>(this)->find(key);
+    }
+
+    bool contains(const K &key) const { return find(key) != NULL; }
+
+    // Returns the value for key, default-constructing it if absent.
+    V &operator[](const K &key) {
+        V *v = find(key);
+        if (v) return *v;
+        return *insert_new(key, V());
+    }
+
+    // Insert or overwrite. Returns true if the key was not present.
+    bool insert(const K &key, const V &val) {
+        V *v = find(key);
+        if (v) {
+            *v = val;
+            return false;
+        }
+        insert_new(key, val);
+        return true;
+    }
+
+    bool erase(const K &key) {
+        size_t i = home(key);
+        while (used[i]) {
+            if (slots[i].first == key) break;
+            i = (i + 1) & mask;
+        }
+        if (!used[i]) return false;
+
+        // Backward-shift: pull later members of the probe run into the
+        // hole as long as that doesn't move them before their home slot.
+        size_t hole = i;
+        size_t j = i;
+        for (;;) {
+            j = (j + 1) & mask;
+            if (!used[j]) break;
+            size_t h = home(slots[j].first);
+            if (((j - h) & mask) >= ((j - hole) & mask)) {
+                slots[hole] = std::move(slots[j]);
+                hole = j;
+            }
+        }
+        used[hole] = 0;
+        slots[hole] = value_type();
+        count--;
+        return true;
+    }
+
+    void clear() {
+        for (size_t i = 0; i <= mask; i++) {
+            if (used[i]) slots[i] = value_type();
+        }
+        used.assign(mask + 1, 0);
+        count = 0;
+    }
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    size_t capacity() const { return mask + 1; }
+
+    // Visit every entry as f(key, value), in table order.
+    template<typename F>
+    void for_each(F f) {
+        for (size_t i = 0; i <= mask; i++) {
+            if (used[i]) f(slots[i].first, slots[i].second);
+        }
+    }
+
+    template<typename F>
+    void for_each(F f) const {
+        for (size_t i = 0; i <= mask; i++) {
+            if (used[i]) f(slots[i].first, slots[i].second);
+        }
+    }
+
+private:
+    std::vector<value_type> slots;
+    std::vector<uint8_t> used;
+    size_t mask;
+    size_t count;
+    Hash hasher;
+
+    inline size_t home(const K &key) const {
+        return open_hash_mix(hasher(key)) & mask;
+    }
+
+    V *insert_new(const K &key, const V &val) {
+        // Keep the load factor under 3/4 so probe runs stay short.
+        if ((count + 1) * 4 > (mask + 1) * 3) grow();
+        size_t i = home(key);
+        while (used[i]) i = (i + 1) & mask;
+        used[i] = 1;
+        slots[i].first = key;
+        slots[i].second = val;
+        count++;
+        return &slots[i].second;
+    }
+
+    void grow() {
+        std::vector<value_type> old_slots;
+        std::vector<uint8_t> old_used;
+        old_slots.swap(slots);
+        old_used.swap(used);
+        size_t old_cap = mask + 1;
+
+        slots.resize(old_cap * 2);
+        used.assign(old_cap * 2, 0);
+        mask = old_cap * 2 - 1;
+        for (size_t i = 0; i < old_cap; i++) {
+            if (!old_used[i]) continue;
+            size_t j = home(old_slots[i].first);
+            while (used[j]) j = (j + 1) & mask;
+            used[j] = 1;
+            slots[j] = std::move(old_slots[i]);
+        }
+    }
+};
+
+#endif
@@ -12,6 +12,9 @@
  * 
 PANDAENDCOMMENT */
 
+#ifndef __PROG_POINT_H_
+#define __PROG_POINT_H_
+
 // From http://stackoverflow.com/a/32821650/807307
 #include <cstdio>
 #include <string>
@@ -57,9 +60,12 @@ struct hash_prog_point{
         size_t h1 = std::hash<target_ulong>()(p.caller);
         size_t h2 = std::hash<target_ulong>()(p.pc);
         size_t h3 = std::hash<target_ulong>()(p.cr3);
-        return h1 ^ h2 ^ h3;
+        // Plain xor cancels out any two equal fields and makes a prog
+        // point collide with every permutation of itself.
+        return (h1 * 31 + h2) * 31 + h3;
     }
 };
 
+#endif
 
 #endif
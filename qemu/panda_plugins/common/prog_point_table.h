@@ -0,0 +1,106 @@
+/* PANDABEGINCOMMENT
+ *
+ * Authors:
+ *  Tim Leek               tleek@ll.mit.edu
+ *  Ryan Whelan            rwhelan@ll.mit.edu
+ *  Joshua Hodosh          josh.hodosh@ll.mit.edu
+ *  Michael Zhivich        mzhivich@ll.mit.edu
+ *  Brendan Dolan-Gavitt   brendandg@gatech.edu
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+
+#ifndef __PROG_POINT_TABLE_H_
+#define __PROG_POINT_TABLE_H_
+
+// Per-tap-point state for the plugins that aggregate memory accesses by
+// prog point (tapindex, memdump, unigrams, bigrams, stringsearch, ...).
+//
+// Values are kept in one dense array in insertion order and the hash table
+// only maps a prog point to its index, so big values (histograms) never
+// move when the table grows. The last prog point looked up is remembered:
+// memory callbacks come in runs from the same instruction (rep movs, a
+// copy loop), and those skip the hash entirely.
+//
+// References returned by operator[] and find() are invalidated by the next
+// insert of a new prog point.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <vector>
+#include <algorithm>
+
+#include "prog_point.h"
+#include "open_hash.h"
+
+template<typename V>
+class ProgPointTable {
+public:
+    explicit ProgPointTable(size_t initial_capacity = 1024)
+        : index(initial_capacity), last_idx(NONE) {}
+
+    V *find(const prog_point &p) {
+        if (last_idx != NONE && keys[last_idx] == p) return &values[last_idx];
+        uint32_t *i = index.find(p);
+        if (!i) return NULL;
+        last_idx = *i;
+        return &values[*i];
+    }
+
+    bool contains(const prog_point &p) { return find(p) != NULL; }
+
+    // Returns the value for p, default-constructing it if absent.
+    V &operator[](const prog_point &p) {
+        V *v = find(p);
+        if (v) return *v;
+        last_idx = keys.size();
+        index.insert(p, last_idx);
+        keys.push_back(p);
+        values.push_back(V());
+        return values.back();
+    }
+
+    size_t size() const { return keys.size(); }
+    bool empty() const { return keys.empty(); }
+
+    // Visit every entry as f(prog_point, value) in insertion order.
+    template<typename F>
+    void for_each(F f) {
+        for (size_t i = 0; i < keys.size(); i++) f(keys[i], values[i]);
+    }
+
+    // Visit every entry as f(prog_point, value) in prog_point order, which
+    // is the order the old std::map trackers wrote their reports in.
+    template<typename F>
+    void for_each_sorted(F f) {
+        std::vector<uint32_t> order(keys.size());
+        for (uint32_t i = 0; i < order.size(); i++) order[i] = i;
+        std::sort(order.begin(), order.end(),
+                [this](uint32_t a, uint32_t b) { return keys[a] < keys[b]; });
+        for (auto i : order) f(keys[i], values[i]);
+    }
+
+    // Bulk dump as sorted (prog_point, V) records, the .idx/.bin layout the
+    // analysis scripts read. Only meaningful for plain-data V.
+    bool dump(FILE *f) {
+        bool ok = true;
+        for_each_sorted([&](const prog_point &p, const V &v) {
+            if (!ok) return;
+            ok = fwrite(&p, sizeof(prog_point), 1, f) == 1
+                && fwrite(&v, sizeof(V), 1, f) == 1;
+        });
+        return ok;
+    }
+
+private:
+    enum : uint32_t { NONE = (uint32_t)-1 };
+
+    OpenHashMap<prog_point,uint32_t,hash_prog_point> index;
+    std::vector<prog_point> keys;
+    std::vector<V> values;
+    uint32_t last_idx;
+};
+
+#endif
@@ -64,46 +64,6 @@ std::map< std::pair<uint32_t, uint32_t>, char *> asidfd_to_filename;
 
 std::map <target_ulong, OsiProc> running_procs;
 
-
-
-// label this virtual address.  might fail, so
-// returns true iff byte was labeled
-bool label_byte(CPUState *env, target_ulong virt_addr, uint32_t label_num) {
-    target_phys_addr_t pa = panda_virt_to_phys(env, virt_addr);
-    if (pa == (target_phys_addr_t) -1) {
-        printf ("label_byte: virtual addr " TARGET_FMT_lx " not available\n", virt_addr);
-        return false;
-    }
-    if (no_taint) {
-        // don't print a message -- you'd have too many in this case
-        return false;
-    }
-    if (positional_labels) {
-        taint2_label_ram(pa, label_num);
-    }
-    else {
-        taint2_label_ram(pa, 1);
-    }
-    if (pandalog) {
-        Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
-        ple.has_taint_label_virtual_addr = 1;
-        ple.has_taint_label_physical_addr = 1;
-        ple.has_taint_label_number = 1;
-        ple.taint_label_virtual_addr = virt_addr;
-        ple.taint_label_physical_addr = pa;
-        if (positional_labels) {
-            ple.taint_label_number = label_num;
-        }
-        else {
-            ple.taint_label_number = 1;
-        }
-        pandalog_write_entry(&ple);           
-    }
-    return true;
-}
-
-
-
 char *last_open_filename;
 uint32_t last_open_asid;
 
@@ -186,7 +146,7 @@ std::string the_windows_filename;
 
 // 179 NTSTATUS NtOpenFile (PHANDLE FileHandle, ACCESS_MASK DesiredAccess, POBJECT_ATTRIBUTES ObjectAttributes, PIO_STATUS_BLOCK IoStatusBlock, ULONG ShareAccess, ULONG OpenOptions);
 // typedef void (*on_NtOpenFile_enter_t)(CPUState* env,target_ulong pc,uint32_t FileHandle,uint32_t DesiredAccess,uint32_t ObjectAttributes,uint32_t IoStatusBlock,uint32_t ShareAccess,uint32_t OpenOptions);
-void windows_open_enter(CPUState* env, target_ulong pc, uint32_t FileHandle, uint32_t DesiredAccess, uint32_t ObjectAttributes, uint32_t IoStatusBlock, uint32_t ShareAccess, uint32_t OpenOptions) {
+void windows_open_enter(CPUState* env, target_ulong pc, target_ulong FileHandle, uint32_t DesiredAccess, target_ulong ObjectAttributes, target_ulong IoStatusBlock, uint32_t ShareAccess, uint32_t OpenOptions) {
     char the_filename[MAX_FILENAME];
     OBJECT_ATTRIBUTES obj_attrs;
     UNICODE_STRING unicode_string;
@@ -202,10 +162,10 @@ void windows_open_enter(CPUState* env, target_ulong pc, uint32_t FileHandle, uin
 }
 
 // typedef void (*on_NtOpenFile_return_t)(CPUState* env,target_ulong pc,uint32_t FileHandle,uint32_t DesiredAccess,uint32_t ObjectAttributes,uint32_t IoStatusBlock,uint32_t ShareAccess,uint32_t OpenOptions);
-void windows_open_return(CPUState* env, target_ulong pc, uint32_t FileHandle, uint32_t DesiredAccess, uint32_t ObjectAttributes, uint32_t IoStatusBlock, uint32_t ShareAccess, uint32_t OpenOptions) {
+void windows_open_return(CPUState* env, target_ulong pc, target_ulong FileHandle, uint32_t DesiredAccess, target_ulong ObjectAttributes, target_ulong IoStatusBlock, uint32_t ShareAccess, uint32_t OpenOptions) {
     uint32_t Handle;
     panda_virtual_memory_rw(env, FileHandle, (uint8_t *)&Handle, 4, 0);
-    if (debug) printf ("asid=0x%x filehandle=%d filename=[%s]\n", (uint)panda_current_asid(env), FileHandle, the_windows_filename.c_str());
+    if (debug) printf ("asid=0x%x filehandle=" TARGET_FMT_lx " filename=[%s]\n", (uint)panda_current_asid(env), FileHandle, the_windows_filename.c_str());
     windows_filenames[panda_current_asid(env)][FileHandle] = the_windows_filename;
     open_return(env, Handle);
 }
@@ -214,10 +174,10 @@ uint32_t the_buf;
 uint32_t the_count;
 bool saw_read = false;
 
-uint32_t last_read_buf;
+target_ulong last_read_buf;
 uint64_t last_pos = (uint64_t) -1;
 
-void read_enter(CPUState* env, target_ulong pc, std::string filename, uint64_t pos, uint32_t buf, uint32_t count) { 
+void read_enter(CPUState* env, target_ulong pc, std::string filename, uint64_t pos, target_ulong buf, uint32_t count) { 
     // these things are only known at enter of read call
     the_asid = panda_current_asid(env);
     last_read_buf = buf;
@@ -233,7 +193,7 @@ void read_enter(CPUState* env, target_ulong pc, std::string filename, uint64_t p
 
 // 3 long sys_read(unsigned int fd, char __user *buf, size_t count);
 // typedef void (*on_sys_read_return_t)(CPUState* env,target_ulong pc,uint32_t fd,target_ulong buf,uint32_t count);
-void read_return(CPUState* env, target_ulong pc, uint32_t buf, uint32_t actual_count) {
+void read_return(CPUState* env, target_ulong pc, target_ulong buf, uint32_t actual_count) {
     if (saw_read && panda_current_asid(env) == the_asid) {
         // These are the start and end of the current range of labels.
         uint32_t read_start = last_pos;
@@ -247,14 +207,14 @@ void read_return(CPUState* env, target_ulong pc, uint32_t buf, uint32_t actual_c
                     positional_labels ? "positional" : "uniform",
                     range_start, range_end - 1, rr_get_guest_instr_count());
             uint32_t num_labeled = 0;
-            uint32_t i = 0;
-            for (uint32_t l = range_start; l < range_end; l++) {
-                if (label_byte(env, last_read_buf + i,
-                               positional_labels ? l : 1))
-                    num_labeled ++;
-                i ++;
+            if (!no_taint) {
+                num_labeled = taint2_label_ram_range(env,
+                        last_read_buf + (range_start - read_start),
+                        range_end - range_start,
+                        positional_labels ? range_start : 1,
+                        positional_labels);
             }
-            printf("%u bytes labeled for this read\n", range_end - range_start);
+            printf("%u bytes labeled for this read\n", num_labeled);
         }
         last_pos += actual_count;
         //        printf (" ... done applying labels\n");
@@ -265,7 +225,7 @@ void read_return(CPUState* env, target_ulong pc, uint32_t buf, uint32_t actual_c
 // 273 NTSTATUS NtReadFile (HANDLE FileHandle, HANDLE Event, PIO_APC_ROUTINE UserApcRoutine, PVOID UserApcContext, PIO_STATUS_BLOCK IoStatusBlock, PVOID Buffer, ULONG BufferLength, PLARGE_INTEGER ByteOffset, PULONG Key);
 // typedef void (*on_NtReadFile_enter_t)(CPUState* env,target_ulong pc,uint32_t FileHandle,uint32_t Event,uint32_t UserApcRoutine,uint32_t UserApcContext,uint32_t IoStatusBlock,uint32_t Buffer,uint32_t BufferLength,uint32_t ByteOffset,uint32_t Key);
 
-void windows_read_enter(CPUState* env, target_ulong pc, uint32_t FileHandle, uint32_t Event, uint32_t UserApcRoutine, uint32_t UserApcContext, uint32_t IoStatusBlock, uint32_t Buffer, uint32_t BufferLength, uint32_t ByteOffset, uint32_t Key) {
+void windows_read_enter(CPUState* env, target_ulong pc, target_ulong FileHandle, target_ulong Event, target_ulong UserApcRoutine, target_ulong UserApcContext, target_ulong IoStatusBlock, target_ulong Buffer, uint32_t BufferLength, target_ulong ByteOffset, target_ulong Key) {
     int64_t offset = -1;
     if (ByteOffset != 0) {
         // Byte offset into file is specified (pointer to LARGE_INTEGER). Read and interpret.
@@ -294,7 +254,7 @@ typedef struct _IO_STATUS_BLOCK {
     uint32_t Information;
 } IO_STATUS_BLOCK;
 
-void windows_read_return(CPUState* env, target_ulong pc, uint32_t FileHandle, uint32_t Event, uint32_t UserApcRoutine, uint32_t UserApcContext, uint32_t IoStatusBlock, uint32_t Buffer, uint32_t BufferLength, uint32_t ByteOffset, uint32_t Key) {
+void windows_read_return(CPUState* env, target_ulong pc, target_ulong FileHandle, target_ulong Event, target_ulong UserApcRoutine, target_ulong UserApcContext, target_ulong IoStatusBlock, target_ulong Buffer, uint32_t BufferLength, target_ulong ByteOffset, target_ulong Key) {
     if (EAX != STATUS_SUCCESS) return;
     IO_STATUS_BLOCK io_status_block;
     uint32_t actual_count = BufferLength;
@@ -308,18 +268,18 @@ void windows_read_return(CPUState* env, target_ulong pc, uint32_t FileHandle, ui
 
 // 66 NTSTATUS NtCreateFile (PHANDLE FileHandle, ACCESS_MASK DesiredAccess, POBJECT_ATTRIBUTES ObjectAttributes, PIO_STATUS_BLOCK IoStatusBlock, PLARGE_INTEGER AllocationSize, ULONG FileAttributes, ULONG ShareAccess, ULONG CreateDisposition, ULONG CreateOptions, PVOID EaBuffer, ULONG EaLength);
 // typedef void (*on_NtCreateFile_enter_t)(CPUState* env,target_ulong pc,uint32_t FileHandle,uint32_t DesiredAccess,uint32_t ObjectAttributes,uint32_t IoStatusBlock,uint32_t AllocationSize,uint32_t FileAttributes,uint32_t ShareAccess,uint32_t CreateDisposition,uint32_t CreateOptions,uint32_t EaBuffer,uint32_t EaLength);
-void windows_create_enter(CPUState* env, target_ulong pc, uint32_t FileHandle, uint32_t DesiredAccess, uint32_t ObjectAttributes, uint32_t IoStatusBlock, uint32_t AllocationSize, uint32_t FileAttributes, uint32_t ShareAccess, uint32_t CreateDisposition, uint32_t CreateOptions, uint32_t EaBuffer, uint32_t EaLength) {
+void windows_create_enter(CPUState* env, target_ulong pc, target_ulong FileHandle, uint32_t DesiredAccess, target_ulong ObjectAttributes, target_ulong IoStatusBlock, target_ulong AllocationSize, uint32_t FileAttributes, uint32_t ShareAccess, uint32_t CreateDisposition, uint32_t CreateOptions, target_ulong EaBuffer, uint32_t EaLength) {
     windows_open_enter(env, pc, FileHandle, DesiredAccess, ObjectAttributes, IoStatusBlock, ShareAccess, CreateOptions);
 }
 
 // typedef void (*on_NtCreateFile_return_t)(CPUState* env,target_ulong pc,uint32_t FileHandle,uint32_t DesiredAccess,uint32_t ObjectAttributes,uint32_t IoStatusBlock,uint32_t AllocationSize,uint32_t FileAttributes,uint32_t ShareAccess,uint32_t CreateDisposition,uint32_t CreateOptions,uint32_t EaBuffer,uint32_t EaLength);
-void windows_create_return(CPUState* env, target_ulong pc, uint32_t FileHandle, uint32_t DesiredAccess, uint32_t ObjectAttributes, uint32_t IoStatusBlock, uint32_t AllocationSize, uint32_t FileAttributes, uint32_t ShareAccess, uint32_t CreateDisposition, uint32_t CreateOptions, uint32_t EaBuffer, uint32_t EaLength) {
+void windows_create_return(CPUState* env, target_ulong pc, target_ulong FileHandle, uint32_t DesiredAccess, target_ulong ObjectAttributes, target_ulong IoStatusBlock, target_ulong AllocationSize, uint32_t FileAttributes, uint32_t ShareAccess, uint32_t CreateDisposition, uint32_t CreateOptions, target_ulong EaBuffer, uint32_t EaLength) {
     windows_open_return(env, pc, FileHandle, DesiredAccess, ObjectAttributes, IoStatusBlock, ShareAccess, CreateOptions);
 }
 
  
 
-void linux_read_enter(CPUState *env, target_ulong pc, uint32_t fd, uint32_t buf, uint32_t count) {
+void linux_read_enter(CPUState *env, target_ulong pc, uint32_t fd, target_ulong buf, target_ulong count) {
     target_ulong asid = panda_current_asid(env);
     if (running_procs.count(asid) == 0) {
         if (debug) printf ("linux_read_enter for asid=0x%x fd=%d -- dont know about that asid.  discarding \n", (unsigned int) asid, (int) fd);
@@ -338,7 +298,7 @@ void linux_read_enter(CPUState *env, target_ulong pc, uint32_t fd, uint32_t buf,
     read_enter(env, pc, filename, pos, buf, count);
 }
 
-void linux_read_return(CPUState *env, target_ulong pc, uint32_t fd, uint32_t buf, uint32_t count) {
+void linux_read_return(CPUState *env, target_ulong pc, uint32_t fd, target_ulong buf, target_ulong count) {
     read_return(env, pc, buf, EAX);
 }
 
@@ -358,7 +318,7 @@ int file_taint_enable(CPUState *env, target_ulong pc) {
 
 
 #ifdef TARGET_I386
-void linux_open_enter(CPUState *env, target_ulong pc, uint32_t filename, int32_t flags, int32_t mode) {
+void linux_open_enter(CPUState *env, target_ulong pc, target_ulong filename, int32_t flags, int32_t mode) {
     char the_filename[MAX_FILENAME];
     guest_strncpy(env, the_filename, MAX_FILENAME, filename);    
     if (debug) printf ("linux open asid=0x%x filename=[%s]\n", (unsigned int) panda_current_asid(env), the_filename);
@@ -34,6 +34,8 @@ extern "C" {
 #include <map>
 
 #include "../common/prog_point.h"
+#include "../common/prog_point_table.h"
+#include "../common/open_hash.h"
 #include "pandalog.h"
 #include "../callstack_instr/callstack_instr_ext.h"
     
@@ -84,21 +86,36 @@ const EVP_CIPHER *g_ciph = NULL;
 const EVP_MD *g_md = NULL;
 
 bool have_candidates = true;
-std::unordered_set <prog_point, hash_prog_point > candidates;
+OpenHashMap <prog_point, uint8_t, hash_prog_point > candidates;
 
 // Optimization
 std::unordered_set <target_ulong> cr3s;
 std::vector <target_ulong> eips;
 
-// Ringbuf-like structure
+// Ringbuf-like structure. Every byte is stored twice, MASTER_SECRET_SIZE
+// apart, so the last MASTER_SECRET_SIZE bytes are always contiguous at
+// key + start. hash is a rolling hash of that window.
 struct key_buf {
-    uint8_t key[MASTER_SECRET_SIZE];
+    uint8_t key[2*MASTER_SECRET_SIZE];
     int start;
     bool filled;
+    uint64_t hash;
 };
 
+#define WINDOW_HASH_BASE 0x100000001b3ULL
+
+// WINDOW_HASH_BASE ^ MASTER_SECRET_SIZE, for dropping the oldest byte
+static uint64_t window_hash_out;
+
+// Windows already run through check_key() without a match, keyed by the
+// window's hash and the prog point. Direct-mapped, so a collision only
+// costs a repeated check. Tight loops that rewrite the same buffer would
+// otherwise pay for the full TLS PRF and decryption on every byte.
+#define CHECKED_BITS 16
+static uint64_t checked_windows[1 << CHECKED_BITS];
+
 std::set<prog_point> matches;
-std::map<prog_point,key_buf> key_tracker;
+ProgPointTable<key_buf> key_tracker;
 
 bool check_key(StringInfo *master_secret, StringInfo *client_random, StringInfo *server_random,
                StringInfo *enc_msg, StringInfo *version, StringInfo *content_type,
@@ -206,7 +223,7 @@ int mem_write_callback(CPUState *env, target_ulong pc, target_ulong addr,
     get_prog_point(env, &p);
 
     // Only use candidates found in config (pre-filtered for key-ness)
-    if (have_candidates && candidates.find(p) == candidates.end()) {
+    if (have_candidates && !candidates.contains(p)) {
         //printf("Skipping " TARGET_FMT_lx "\n", p.pc);
         return 1;
     }
@@ -214,24 +231,29 @@ int mem_write_callback(CPUState *env, target_ulong pc, target_ulong addr,
     // XXX DEBUG: Just check the one we KNOW is correct
     //if(p.caller != 0x0000000074ce9788 || p.pc != 0x0000000074ce82ef || p.cr3 != 0x000000003f9650e0) return 1;
 
+    key_buf *k = &key_tracker[p];
+    uint64_t pp_hash = hash_prog_point()(p);
     for (unsigned int i = 0; i < size; i++) {
         uint8_t val = ((uint8_t *)buf)[i];
-        key_buf *k = &key_tracker[p];
-        k->key[k->start++] = val;
-        if (k->start == sizeof(k->key)) {
+        // The byte leaving the window is the one being overwritten (zero
+        // until the buffer has filled, which leaves the hash unchanged)
+        uint8_t old = k->key[k->start];
+        k->hash = k->hash * WINDOW_HASH_BASE + val - old * window_hash_out;
+        k->key[k->start] = val;
+        k->key[k->start + MASTER_SECRET_SIZE] = val;
+        k->start++;
+        if (k->start == MASTER_SECRET_SIZE) {
             k->start = 0;
             if (unlikely(!k->filled)) {
                 k->filled = true;
             }
         }
         if (likely(k->filled)) {
-            // Copy it out of the ring buffer
-            int key_bytes_left = sizeof(k->key) - k->start;
-            int key_bytes_right = k->start;
-            memcpy(g_master_secret.data, k->key+k->start, key_bytes_left);
-            if(key_bytes_right) {
-                memcpy(g_master_secret.data+key_bytes_left, k->key, key_bytes_right);
-            }
+            uint64_t tag = open_hash_mix(k->hash ^ pp_hash) | 1;
+            uint64_t &slot = checked_windows[tag >> (64 - CHECKED_BITS)];
+            if (slot == tag) continue;
+
+            memcpy(g_master_secret.data, k->key + k->start, MASTER_SECRET_SIZE);
 
             bool match = check_key(&g_master_secret, &g_client_random, &g_server_random,
                            &g_enc_msg, &g_version, &g_content_type, g_md, g_ciph);
@@ -245,6 +267,9 @@ int mem_write_callback(CPUState *env, target_ulong pc, target_ulong addr,
                 fprintf(stderr, "\n");
                 matches.insert(p);
             }
+            else {
+                slot = tag;
+            }
         }
     }
  
@@ -347,7 +372,7 @@ bool init_plugin(void *self) {
 
             //printf("Adding tap point (" TARGET_FMT_lx "," TARGET_FMT_lx "," TARGET_FMT_lx ")\n",
             //       p.caller, p.pc, p.cr3);
-            candidates.insert(p);
+            candidates.insert(p, 1);
         }
         printf("keyfind: Will check for keys on %ld taps.\n", candidates.size());
         taps.close();
@@ -459,6 +484,9 @@ bool init_plugin(void *self) {
     if (!found_cipher) { fprintf(stderr, "Cipher not found in config file, aborting.\n"); return false; }
     if (!found_mac) { fprintf(stderr, "MAC not found in config file, aborting.\n"); return false; }
 
+    window_hash_out = 1;
+    for (int i = 0; i < MASTER_SECRET_SIZE; i++) window_hash_out *= WINDOW_HASH_BASE;
+
     // Global data. Init it once here so we don't have to
     // re-alloc each time.
     ssl_data_alloc(&g_master_secret, MASTER_SECRET_SIZE);
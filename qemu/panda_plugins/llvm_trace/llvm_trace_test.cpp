@@ -51,7 +51,7 @@ void TestInstVisitor::visitLoadInst(LoadInst &I){
 
     //printf("load\n");
     DynValEntry entry;
-    size_t n = fread(&entry, sizeof(DynValEntry), 1, dlog);
+    fread_dynval(dlog, &entry);
     if (entry.entrytype == EXCEPTIONENTRY){
         except = true;
         return;
@@ -67,7 +67,7 @@ void TestInstVisitor::visitStoreInst(StoreInst &I){
 
     //printf("store\n");
     DynValEntry entry;
-    size_t n = fread(&entry, sizeof(DynValEntry), 1, dlog);
+    fread_dynval(dlog, &entry);
     if (entry.entrytype == EXCEPTIONENTRY){
         except = true;
         return;
@@ -83,7 +83,7 @@ void TestInstVisitor::visitBranchInst(BranchInst &I){
 
     //printf("branch\n");
     DynValEntry entry;
-    size_t n = fread(&entry, sizeof(DynValEntry), 1, dlog);
+    fread_dynval(dlog, &entry);
     if (entry.entrytype == EXCEPTIONENTRY){
         except = true;
         return;
@@ -113,7 +113,7 @@ void TestInstVisitor::visitSelectInst(SelectInst &I){
 
     //printf("select\n");
     DynValEntry entry;
-    size_t n = fread(&entry, sizeof(DynValEntry), 1, dlog);
+    fread_dynval(dlog, &entry);
     if (entry.entrytype == EXCEPTIONENTRY){
         except = true;
         return;
@@ -132,7 +132,7 @@ void TestInstVisitor::visitCallInst(CallInst &I){
         || (I.getCalledFunction()->getName() == "__ldq_mmu_panda")){
 
         DynValEntry entry;
-        size_t n = fread(&entry, sizeof(DynValEntry), 1, dlog);
+        fread_dynval(dlog, &entry);
         if (entry.entrytype == EXCEPTIONENTRY){
             except = true;
             return;
@@ -147,7 +147,7 @@ void TestInstVisitor::visitCallInst(CallInst &I){
         || (I.getCalledFunction()->getName() == "__stq_mmu_panda")){
 
         DynValEntry entry;
-        size_t n = fread(&entry, sizeof(DynValEntry), 1, dlog);
+        fread_dynval(dlog, &entry);
         if (entry.entrytype == EXCEPTIONENTRY){
             except = true;
             return;
@@ -175,7 +175,7 @@ void TestInstVisitor::visitSwitchInst(SwitchInst &I){
     }
 
     DynValEntry entry;
-    size_t n = fread(&entry, sizeof(DynValEntry), 1, dlog);
+    fread_dynval(dlog, &entry);
     if (entry.entrytype == EXCEPTIONENTRY){
         except = true;
         return;
@@ -91,7 +91,7 @@ uint32_t guest_strncpy(CPUState *env, char *buf, size_t maxlen, target_ulong gue
     return i;
 }
 #if defined(TARGET_I386)
-void linux_mmap_pgoff_return(CPUState *env,target_ulong pc,uint32_t addr,uint32_t len,uint32_t prot,uint32_t flags,uint32_t fd,uint32_t pgoff) {
+void linux_mmap_pgoff_return(CPUState *env,target_ulong pc,target_ulong addr,target_ulong len,target_ulong prot,target_ulong flags,target_ulong fd,target_ulong pgoff) {
     target_ulong asid = panda_current_asid(env);
     if (running_procs.count(asid) == 0) {
         //printf ("linux_mmap_pgoff_enter for asid=0x%x fd=%d -- dont know about that asid.  discarding \n", (unsigned int) asid, (int) fd);
@@ -31,7 +31,6 @@ extern "C" {
 #include <stdlib.h>
 #include <ctype.h>
 #include <math.h>
-#include <map>
 #include <list>
 #include <algorithm>
 #include <sys/mman.h>
@@ -50,27 +49,30 @@ int mem_read_callback(CPUState *env, target_ulong pc, target_ulong addr, target_
 }
 
 #include "../common/prog_point.h"
+#include "../common/prog_point_table.h"
 #include "pandalog.h"
 #include "../callstack_instr/callstack_instr_ext.h"
 #include "panda_plugin_plugin.h"
 
 struct fpos { unsigned long off; };
-std::map<prog_point,fpos> read_tracker;
-std::map<prog_point,fpos> write_tracker;
+ProgPointTable<fpos> read_tracker;
+ProgPointTable<fpos> write_tracker;
 FILE *read_log, *write_log;
 unsigned char *read_buf, *write_buf;
 unsigned long read_sz, write_sz;
 
 int mem_callback(CPUState *env, target_ulong pc, target_ulong addr,
                        target_ulong size, void *buf,
-                       std::map<prog_point,fpos> &tracker, unsigned char *log) {
+                       ProgPointTable<fpos> &tracker, unsigned char *log) {
     prog_point p = {};
     get_prog_point(env, &p);
     //fseek(log, tracker[p].off, SEEK_SET);
     //fwrite((unsigned char *)buf, size, 1, log);
-    fpos &fp = tracker[p];
-    memcpy(log+fp.off, buf, size);
-    fp.off += size;
+    // Tap points tapindex never saw have no room reserved in the log
+    fpos *fp = tracker.find(p);
+    if (!fp) return 1;
+    memcpy(log+fp->off, buf, size);
+    fp->off += size;
 
     return 1;
 }
@@ -105,9 +107,8 @@ bool init_plugin(void *self) {
     if (read_idx) {
         printf("Calculating read indices...\n");
         fseek(read_idx, 4, SEEK_SET);
-        while (!feof(read_idx)) {
-            fread(&p, sizeof(p), 1, read_idx);
-            fread(&size, sizeof(target_ulong), 1, read_idx);
+        while (fread(&p, sizeof(p), 1, read_idx) == 1 &&
+               fread(&size, sizeof(target_ulong), 1, read_idx) == 1) {
             read_tracker[p].off = off;
             off += size;
         }
@@ -135,9 +136,8 @@ bool init_plugin(void *self) {
     if (write_idx) {
         printf("Calculating write indices...\n");
         fseek(write_idx, 4, SEEK_SET);
-        while (!feof(write_idx)) {
-            fread(&p, sizeof(p), 1, write_idx);
-            fread(&size, sizeof(target_ulong), 1, write_idx);
+        while (fread(&p, sizeof(p), 1, write_idx) == 1 &&
+               fread(&size, sizeof(target_ulong), 1, write_idx) == 1) {
             write_tracker[p].off = off;
             off += size;
         }
@@ -31,9 +31,17 @@ extern "C" {
 #include <zlib.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <ctype.h>
 #include <math.h>
-#include <map>
+#include <vector>
+#include <algorithm>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "../common/open_hash.h"
 
 // These need to be extern "C" so that the ABI is compatible with
 // QEMU/PANDA, which is written in C
@@ -58,39 +66,194 @@ struct ustring_pos {
     uint16_t ch[MAX_STRLEN];
 };
 
-std::map<target_ulong,string_pos> read_text_tracker;
-std::map<target_ulong,string_pos> write_text_tracker;
-std::map<target_ulong,ustring_pos> read_utext_tracker;
-std::map<target_ulong,ustring_pos> write_utext_tracker;
+// Candidate strings being built up by one PC.
+struct pc_strings {
+    target_ulong pc;
+    string_pos sp;
+    ustring_pos usp;
+};
+
+// PC -> candidate strings. The strings live in one array in the order the
+// PCs were first seen; the hash only maps a PC to its slot. Memory callbacks
+// come in runs from the same instruction, so the last PC is remembered.
+struct string_tracker {
+    OpenHashMap<target_ulong,uint32_t> index;
+    std::vector<pc_strings> strings;
+    target_ulong last_pc;
+    uint32_t last_idx;
+
+    string_tracker() : index(4096), last_pc(0), last_idx((uint32_t)-1) {}
+
+    pc_strings &operator[](target_ulong pc) {
+        if (last_idx != (uint32_t)-1 && pc == last_pc) return strings[last_idx];
+        uint32_t *i = index.find(pc);
+        if (i) {
+            last_idx = *i;
+        } else {
+            last_idx = strings.size();
+            index.insert(pc, last_idx);
+            strings.emplace_back();
+            strings.back().pc = pc;
+            strings.back().sp.nch = 0;
+            strings.back().usp.nch = 0;
+        }
+        last_pc = pc;
+        return strings[last_idx];
+    }
+
+    // All entries in PC order.
+    std::vector<pc_strings *> sorted() {
+        std::vector<pc_strings *> out;
+        for (auto &strs : strings) out.push_back(&strs);
+        std::sort(out.begin(), out.end(),
+                [](pc_strings *a, pc_strings *b) { return a->pc < b->pc; });
+        return out;
+    }
+};
+
+string_tracker read_tracker;
+string_tracker write_tracker;
 
 gzFile mem_report = NULL;
 int min_strlen;
 
-int mem_callback(CPUState *env, target_ulong pc, target_ulong addr,
-                       target_ulong size, void *buf, bool is_write) {
+// isprint() and iswprint() for every byte and UTF-16 code unit, looked up
+// once at startup instead of going through the locale on every access.
+static bool printable[256];
+static uint8_t uprintable[65536 / 8];
 
-    string_pos &sp = is_write ? write_text_tracker[pc] : read_text_tracker[pc];
-    ustring_pos &usp = is_write ? write_utext_tracker[pc] : read_utext_tracker[pc];
+static inline bool is_uprintable(uint16_t val) {
+    return (uprintable[val >> 3] >> (val & 7)) & 1;
+}
 
-    // ASCII
-    for (unsigned int i = 0; i < size; i++) {
-        uint8_t val = ((uint8_t *)buf)[i];
-        if (isprint(val)) {
-            sp.ch[sp.nch++] = val;
-            // If we max out the string, chop it
-            if (sp.nch == MAX_STRLEN - 1) {
-                gzprintf(mem_report, "%llu:%.*s\n", rr_get_guest_instr_count(), sp.nch, sp.ch);
-                sp.nch = 0;
-            }
+static void init_printable_tables(void) {
+    for (int i = 0; i < 256; i++) printable[i] = isprint(i);
+    for (int i = 0; i < 65536; i++) {
+        if (iswprint(i)) uprintable[i >> 3] |= 1 << (i & 7);
+    }
+}
+
+// Bit i set if byte i of p (n <= 64) is printable.
+static uint64_t printable_mask(const uint8_t *p, unsigned n) {
+    uint64_t mask = 0;
+    unsigned i = 0;
+#ifdef __SSE2__
+    // printable ASCII is 0x20..0x7e: (c - 0x20) < 0x5f unsigned, done as a
+    // signed compare with the sign bit flipped
+    const __m128i lo = _mm_set1_epi8(0x20);
+    const __m128i flip = _mm_set1_epi8((char)0x80);
+    const __m128i lim = _mm_set1_epi8((char)(0x5f ^ 0x80));
+    for (; i + 16 <= n; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(p + i));
+        v = _mm_xor_si128(_mm_sub_epi8(v, lo), flip);
+        uint64_t m = (uint16_t)_mm_movemask_epi8(_mm_cmplt_epi8(v, lim));
+        mask |= m << i;
+    }
+#endif
+    for (; i < n; i++) {
+        mask |= (uint64_t)printable[p[i]] << i;
+    }
+    return mask;
+}
+
+// Bit i set if UTF-16-LE code unit i of p (n <= 64 units) is printable.
+static uint64_t uprintable_mask(const uint8_t *p, unsigned n) {
+    uint64_t mask = 0;
+    unsigned i = 0;
+#ifdef __SSE2__
+    // Fast path for eight units of plain ASCII text at a time.
+    const __m128i below = _mm_set1_epi16(0x1f);
+    const __m128i above = _mm_set1_epi16(0x7f);
+    for (; i + 8 <= n; i += 8) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(p + 2*i));
+        __m128i ok = _mm_and_si128(_mm_cmpgt_epi16(v, below),
+                                   _mm_cmplt_epi16(v, above));
+        if (_mm_movemask_epi8(ok) == 0xffff) {
+            mask |= (uint64_t)0xff << i;
+            continue;
         }
-        else {
+        for (unsigned j = i; j < i + 8; j++) {
+            uint16_t val = p[2*j] | (p[2*j+1] << 8);
+            mask |= (uint64_t)is_uprintable(val) << j;
+        }
+    }
+#endif
+    for (; i < n; i++) {
+        uint16_t val = p[2*i] | (p[2*i+1] << 8);
+        mask |= (uint64_t)is_uprintable(val) << i;
+    }
+    return mask;
+}
+
+static void emit(string_pos &sp) {
+    gzprintf(mem_report, "%llu:%.*s\n", rr_get_guest_instr_count(), sp.nch, sp.ch);
+}
+
+static void emit(ustring_pos &usp) {
+    gsize bytes_written = 0;
+    gchar *out_str = g_convert((gchar *)usp.ch, usp.nch*2,
+        "UTF-8", "UTF-16LE", NULL, &bytes_written, NULL);
+    gzprintf(mem_report, "%llu:%s\n", rr_get_guest_instr_count(), out_str);
+    g_free(out_str);
+}
+
+static inline void get_unit(uint8_t *dst, const uint8_t *p) { *dst = *p; }
+static inline void get_unit(uint16_t *dst, const uint8_t *p) { *dst = p[0] | (p[1] << 8); }
+
+// Feed n units (n <= 64) of p, classified by mask, into the candidate
+// string s. Runs of printable units are appended in bulk, chopping the
+// string when it fills up; a non-printable unit ends the string and
+// reports it if it is long enough.
+template<typename S>
+static void scan_runs(S &s, const uint8_t *p, unsigned n, uint64_t mask) {
+    const unsigned unit = sizeof(s.ch[0]);
+    unsigned pos = 0;
+    while (pos < n) {
+        uint64_t rest = mask >> pos;
+        if (rest & 1) {
+            unsigned run = (~rest == 0) ? 64 : __builtin_ctzll(~rest);
+            run = std::min(run, n - pos);
+            for (unsigned k = 0; k < run; ) {
+                unsigned take = std::min(run - k, (unsigned)(MAX_STRLEN - 1 - s.nch));
+                if (unit == 1) {
+                    memcpy(&s.ch[s.nch], p + pos + k, take);
+                } else {
+                    for (unsigned t = 0; t < take; t++) {
+                        get_unit(&s.ch[s.nch + t], p + unit*(pos + k + t));
+                    }
+                }
+                s.nch += take;
+                k += take;
+                // If we max out the string, chop it
+                if (s.nch == MAX_STRLEN - 1) {
+                    emit(s);
+                    s.nch = 0;
+                }
+            }
+            pos += run;
+        } else {
+            unsigned gap = (rest == 0) ? n - pos : __builtin_ctzll(rest);
             // Don't bother with strings shorter than min
-            if (sp.nch >= min_strlen) {
-                gzprintf(mem_report, "%llu:%.*s\n", rr_get_guest_instr_count(), sp.nch, sp.ch);
+            if (s.nch >= min_strlen) {
+                emit(s);
             }
-            sp.nch = 0;
+            s.nch = 0;
+            pos += std::min(gap, n - pos);
         }
     }
+}
+
+int mem_callback(CPUState *env, target_ulong pc, target_ulong addr,
+                       target_ulong size, void *buf, bool is_write) {
+
+    pc_strings &strs = is_write ? write_tracker[pc] : read_tracker[pc];
+    const uint8_t *p = (const uint8_t *)buf;
+
+    // ASCII
+    for (target_ulong off = 0; off < size; off += 64) {
+        unsigned n = std::min((target_ulong)64, size - off);
+        scan_runs(strs.sp, p + off, n, printable_mask(p + off, n));
+    }
 
     // Don't consider one-byte reads/writes for UTF-16
     if (size < 2) {
@@ -98,33 +261,10 @@ int mem_callback(CPUState *env, target_ulong pc, target_ulong addr,
     }
 
     // UTF-16-LE
-    for (unsigned int i = 0; i < size; i+=2) {
-        uint8_t vall = ((uint8_t *)buf)[i];
-        uint8_t valh = ((uint8_t *)buf)[i+1];
-        uint16_t val = (valh << 8) | vall;
-        if (iswprint(val)) {
-            usp.ch[usp.nch++] = val;
-            // If we max out the string, chop it
-            if (usp.nch == MAX_STRLEN - 1) {
-                gsize bytes_written = 0;
-                gchar *out_str = g_convert((gchar *)usp.ch, usp.nch*2,
-                    "UTF-8", "UTF-16LE", NULL, &bytes_written, NULL);
-                gzprintf(mem_report, "%llu:%s\n", rr_get_guest_instr_count(), out_str);
-                g_free(out_str);
-                usp.nch = 0;
-            }
-        }
-        else {
-            // Don't bother with strings shorter than min
-            if (usp.nch >= min_strlen) {
-                gsize bytes_written = 0;
-                gchar *out_str = g_convert((gchar *)usp.ch, usp.nch*2,
-                    "UTF-8", "UTF-16LE", NULL, &bytes_written, NULL);
-                gzprintf(mem_report, "%llu:%s\n", rr_get_guest_instr_count(), out_str);
-                g_free(out_str);
-            }
-            usp.nch = 0;
-        }
+    target_ulong units = size / 2;
+    for (target_ulong off = 0; off < units; off += 64) {
+        unsigned n = std::min((target_ulong)64, units - off);
+        scan_runs(strs.usp, p + 2*off, n, uprintable_mask(p + 2*off, n));
     }
 
     return 1;
@@ -151,6 +291,8 @@ bool init_plugin(void *self) {
     const char *prefix = panda_parse_string(args, "name", "memstrings");
     min_strlen = panda_parse_ulong(args, "len", 4);
 
+    init_printable_tables();
+
     char matchfile[128] = {};
     sprintf(matchfile, "%s_strings.txt.gz", prefix);
     mem_report = gzopen(matchfile, "w");
@@ -175,33 +317,19 @@ bool init_plugin(void *self) {
 
 void uninit_plugin(void *self) {
     // Save any that we haven't flushed yet
-    for (auto &kvp : read_text_tracker) {
-        if (kvp.second.nch > min_strlen) {
-            gzprintf(mem_report, "%llu:%.*s\n", rr_get_guest_instr_count(), kvp.second.nch, kvp.second.ch);
-        }
+    std::vector<pc_strings *> reads = read_tracker.sorted();
+    std::vector<pc_strings *> writes = write_tracker.sorted();
+    for (auto strs : reads) {
+        if (strs->sp.nch > min_strlen) emit(strs->sp);
     }
-    for (auto &kvp : write_text_tracker) {
-        if (kvp.second.nch > min_strlen) {
-            gzprintf(mem_report, "%llu:%.*s\n", rr_get_guest_instr_count(), kvp.second.nch, kvp.second.ch);
-        }
+    for (auto strs : writes) {
+        if (strs->sp.nch > min_strlen) emit(strs->sp);
     }
-    for (auto &kvp : read_utext_tracker) {
-        if (kvp.second.nch > min_strlen) {
-            gsize bytes_written = 0;
-            gchar *out_str = g_convert((gchar *)kvp.second.ch, kvp.second.nch*2,
-                "UTF-8", "UTF-16LE", NULL, &bytes_written, NULL);
-            gzprintf(mem_report, "%llu:%s\n", rr_get_guest_instr_count(), out_str);
-            g_free(out_str);
-        }
+    for (auto strs : reads) {
+        if (strs->usp.nch > min_strlen) emit(strs->usp);
     }
-    for (auto &kvp : write_utext_tracker) {
-        if (kvp.second.nch > min_strlen) {
-            gsize bytes_written = 0;
-            gchar *out_str = g_convert((gchar *)kvp.second.ch, kvp.second.nch*2,
-                "UTF-8", "UTF-16LE", NULL, &bytes_written, NULL);
-            gzprintf(mem_report, "%llu:%s\n", rr_get_guest_instr_count(), out_str);
-            g_free(out_str);
-        }
+    for (auto strs : writes) {
+        if (strs->usp.nch > min_strlen) emit(strs->usp);
     }
 
     gzclose(mem_report);
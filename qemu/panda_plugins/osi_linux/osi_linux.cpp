@@ -30,6 +30,9 @@ extern "C" {
 #include "osi_linux.h"						/* must come after kernelinfo.h */
 }
 
+#include <vector>
+#include "../common/open_hash.h"
+
 
 /*
  * Functions interfacing with QEMU/PANDA should be linked as C.
@@ -123,24 +126,6 @@ static uint64_t get_fd_pos(CPUState *env, PTR task_struct, int fd) {
 }
 
 
-/**
- * @brief Fills an OsiProc struct.
- */
-static void fill_osiproc(CPUState *env, OsiProc *p, PTR task_addr) {
-	p->offset = task_addr;	// XXX: Not sure what this is. Storing task_addr here seems logical.
-	p->name = get_name(env, task_addr, p->name);
-	p->pid = get_pid(env, task_addr);
-	p->ppid = get_real_parent_pid(env, task_addr);
-	p->pages = NULL;		// OsiPage - TODO
-
-	panda_memory_errors = 0;
-	p->asid = get_pgd(env, task_addr);
-
-#if (defined OSI_LINUX_TEST)
-	LOG_INFO(TARGET_FMT_PTR ":" TARGET_FMT_PID ":" TARGET_FMT_PID ":" TARGET_FMT_PTR ":%s", task_addr, (int)p->ppid, (int)p->pid, p->asid, p->name);
-#endif
-}
-
 /**
  * @brief Fills an OsiModule struct.
  */
@@ -189,8 +174,174 @@ static void fill_osimodule(CPUState *env, OsiModule *m, PTR vma_addr) {
 }
 
 
-#include <map>
+/**
+ * @brief Fields of a task_struct used for filling OsiProc structs and
+ * walking the process list.
+ */
+struct task_snap {
+	PTR tasks;			/**< tasks.next */
+	PTR thread_group;	/**< thread_group.next */
+	PTR mm;
+	PTR real_parent;
+	int pid;
+	const char *comm;	/**< ki.task.comm_size bytes, not necessarily terminated */
+};
+
+/**
+ * @brief Cached information for a task_struct.
+ *
+ * An entry is reused as long as the pid, mm, real_parent and comm read from
+ * the task_struct are unchanged. A new mm means an exec, a new pid means the
+ * task_struct has been recycled by a fork, and a new real_parent means the
+ * task has been reparented. Only when one of them changes are the ppid and
+ * pgd, which need two extra reads each, fetched again.
+ */
+struct task_cache_entry {
+	PTR mm;
+	PTR real_parent;
+	int pid;
+	int ppid;
+	PTR pgd;
+	char *comm;			/**< ki.task.comm_size bytes */
+	uint32_t walk;		/**< last process list walk that saw this task */
+};
+
+typedef std::pair<target_ulong, PTR> asid_task_t;
+
+/** @brief Cached task info, keyed by task_struct address. */
+static OpenHashMap<PTR, task_cache_entry> task_cache;
+
+/**
+ * @brief (asid, task_struct) pairs known to be valid in task_cache.
+ * Cleared every time an entry in task_cache changes. This is what lets
+ * on_get_current_process() read only the pid and comm of the task_struct
+ * instead of all of it. See current_task_unchanged().
+ */
+static OpenHashMap<asid_task_t, bool, open_hash_pair<target_ulong, PTR>> current_cache;
+
+static uint32_t walk_count = 0;
+static uint8_t *task_buf = NULL;	/**< scratch buffer of ki.task.size bytes */
+static char *comm_buf = NULL;		/**< scratch buffer of ki.task.comm_size bytes */
+
+template<typename T>
+static inline T task_buf_field(int offset) {
+	T v;
+	memcpy(&v, task_buf + offset, sizeof(T));
+	return v;
+}
+
+/**
+ * @brief Reads the fields of a task_struct we care about.
+ *
+ * The whole struct is fetched with a single read, which costs one or two
+ * page walks instead of one per field. If that fails, e.g. because the
+ * struct straddles an unmapped page, fall back to reading each field.
+ */
+static void read_task(CPUState *env, PTR ts, task_snap *s) {
+	if (-1 != panda_virtual_memory_rw(env, ts, task_buf, ki.task.size, 0)) {
+		s->tasks = task_buf_field<PTR>(ki.task.tasks_offset);
+		s->thread_group = task_buf_field<PTR>(ki.task.thread_group_offset);
+		s->mm = task_buf_field<PTR>(ki.task.mm_offset);
+		s->real_parent = task_buf_field<PTR>(ki.task.real_parent_offset);
+		s->pid = task_buf_field<int>(ki.task.pid_offset);
+		s->comm = (const char *)task_buf + ki.task.comm_offset;
+		return;
+	}
+
+	s->tasks = get_tasks(env, ts);
+	s->thread_group = get_thread_group(env, ts);
+	s->mm = get_mm(env, ts);
+	s->real_parent = get_real_parent(env, ts);
+	s->pid = get_pid(env, ts);
+	if (-1 == panda_virtual_memory_rw(env, ts + ki.task.comm_offset, (uint8_t *)comm_buf, ki.task.comm_size * sizeof(char), 0)) {
+		panda_memory_errors++;
+		memset(comm_buf, 0, ki.task.comm_size * sizeof(char));
+		strncpy(comm_buf, "N/A", ki.task.comm_size*sizeof(char));
+	}
+	s->comm = comm_buf;
+}
+
+/**
+ * @brief Returns the cached info for task_struct ts, refreshing it from
+ * the snapshot s if the task has changed since it was cached.
+ *
+ * @note The returned pointer is only valid until the next lookup.
+ */
+static task_cache_entry *get_task_info(CPUState *env, PTR ts, const task_snap *s) {
+	task_cache_entry *t = task_cache.find(ts);
+
+	if (t != NULL && t->pid == s->pid && t->mm == s->mm && t->real_parent == s->real_parent &&
+			memcmp(t->comm, s->comm, ki.task.comm_size) == 0) {
+		t->walk = walk_count;
+		return t;
+	}
+
+	if (t == NULL) {
+		t = &task_cache[ts];
+		t->comm = (char *)g_malloc(ki.task.comm_size * sizeof(char));
+	}
+	t->pid = s->pid;
+	t->mm = s->mm;
+	t->real_parent = s->real_parent;
+	memcpy(t->comm, s->comm, ki.task.comm_size * sizeof(char));
+	t->ppid = (t->real_parent != (PTR)NULL) ? get_pid(env, t->real_parent) : -1;
+	t->pgd = (t->mm != (PTR)NULL) ? get_mm_pgd(env, t->mm) : 0;
+	t->walk = walk_count;
+
+	// Anything cached for the current process may now be stale.
+	current_cache.clear();
+
+	return t;
+}
 
+/**
+ * @brief Checks a current_cache hit against the task_struct. A task_struct
+ * recycled for a new thread of the same address space has a new pid, and a
+ * prctl(PR_SET_NAME) a new comm; neither changes the cache key.
+ */
+static bool current_task_unchanged(CPUState *env, PTR ts, const task_cache_entry *t) {
+	int pid;
+	if (-1 == panda_virtual_memory_rw(env, ts + ki.task.pid_offset, (uint8_t *)&pid, sizeof(pid), 0) || pid != t->pid) {
+		return false;
+	}
+	if (-1 == panda_virtual_memory_rw(env, ts + ki.task.comm_offset, (uint8_t *)comm_buf, ki.task.comm_size * sizeof(char), 0)) {
+		return false;
+	}
+	return memcmp(comm_buf, t->comm, ki.task.comm_size) == 0;
+}
+
+/**
+ * @brief Drops cached tasks that were not seen by the last process list walk.
+ */
+static void prune_task_cache(void) {
+	std::vector<PTR> gone;
+	task_cache.for_each([&](const PTR &ts, task_cache_entry &t) {
+		if (t.walk != walk_count) gone.push_back(ts);
+	});
+	if (gone.empty()) return;
+
+	for (auto ts : gone) {
+		g_free(task_cache.find(ts)->comm);
+		task_cache.erase(ts);
+	}
+	current_cache.clear();
+}
+
+/**
+ * @brief Fills an OsiProc struct from cached task info.
+ */
+static void fill_osiproc(OsiProc *p, PTR task_addr, const task_cache_entry *t) {
+	p->offset = task_addr;	// XXX: Not sure what this is. Storing task_addr here seems logical.
+	p->name = g_strndup(t->comm, ki.task.comm_size);
+	p->pid = t->pid;
+	p->ppid = t->ppid;
+	p->pages = NULL;		// OsiPage - TODO
+	p->asid = t->pgd;
+
+#if (defined OSI_LINUX_TEST)
+	LOG_INFO(TARGET_FMT_PTR ":" TARGET_FMT_PID ":" TARGET_FMT_PID ":" TARGET_FMT_PTR ":%s", task_addr, (int)p->ppid, (int)p->pid, p->asid, p->name);
+#endif
+}
 
 
 /* ******************************************************************
@@ -204,25 +355,39 @@ void on_get_current_process(CPUState *env, OsiProc **out_p) {
 	OsiProc *p = NULL;
 	PTR ts;
 
-	//	target_long asid = panda_current_asid(env);
 	ts = get_task_struct(env, (_ESP & THREADINFO_MASK));
 	if (ts) {
 		// valid task struct
 		// got a reasonable looking process.
-		// return it and save in cache
+		// serve it from the cache if nothing changed since it was read
+		asid_task_t key(panda_current_asid(env), ts);
+		task_cache_entry *t = NULL;
+		if (current_cache.contains(key)) t = task_cache.find(ts);
+		if (t != NULL && !current_task_unchanged(env, ts, t)) t = NULL;
+		if (t == NULL) {
+			task_snap s;
+			read_task(env, ts, &s);
+			t = get_task_info(env, ts, &s);
+			current_cache.insert(key, true);
+		}
 		p = (OsiProc *)g_malloc0(sizeof(OsiProc));
-		fill_osiproc(env, p, ts);
+		fill_osiproc(p, ts, t);
 	}
 	*out_p = p;
 }
 
 /**
  * @brief PPP callback to retrieve process list from the running OS.
+ *
+ * The list itself is always walked, but each task_struct costs a single
+ * read unless it changed since the previous walk. See task_cache_entry.
  */
 void on_get_processes(CPUState *env, OsiProcs **out_ps) {
-	PTR ts_first, ts_current;
+	PTR ts_first, ts_current, ts_next;
 	OsiProcs *ps;
 	OsiProc *p;
+	task_snap s;
+	task_cache_entry *t;
 	uint32_t ps_capacity = 16;
 #ifdef OSI_LINUX_LIST_THREADS
 	PTR tg_first, tg_next;
@@ -244,28 +409,34 @@ void on_get_processes(CPUState *env, OsiProcs **out_ps) {
 
 	ps = (OsiProcs *)g_malloc0(sizeof(OsiProcs));
 	ps->proc = g_new(OsiProc, ps_capacity);
+	walk_count++;
 	do {
 		if (ps->num == ps_capacity) {
 			ps_capacity *= 2;
 			ps->proc = g_renew(OsiProc, ps->proc, ps_capacity);
 		}
+		read_task(env, ts_current, &s);
+		t = get_task_info(env, ts_current, &s);
 		p = &ps->proc[ps->num++];
-		memset(p, 0, sizeof(OsiProc));	// fill_osiproc() expects p to be zeroed-out.
-		fill_osiproc(env, p, ts_current);
+		memset(p, 0, sizeof(OsiProc));
+		fill_osiproc(p, ts_current, t);
+		ts_next = (s.tasks != (PTR)NULL) ? s.tasks-ki.task.tasks_offset : (PTR)NULL;
 
 #ifdef OSI_LINUX_LIST_THREADS
 		// Traverse thread group list.
 		// It is assumed that ts_current is a thread group leader.
 		tg_first = ts_current+ki.task.thread_group_offset;
-		while ((tg_next = get_thread_group(env, ts_current)) != tg_first) {
+		while ((tg_next = s.thread_group) != tg_first) {
 			ts_current = tg_next-ki.task.thread_group_offset;
 			if (ps->num == ps_capacity) {
 				ps_capacity *= 2;
 				ps->proc = g_renew(OsiProc, ps->proc, ps_capacity);
 			}
+			read_task(env, ts_current, &s);
+			t = get_task_info(env, ts_current, &s);
 			p = &ps->proc[ps->num++];
-			memset(p, 0, sizeof(OsiProc)); // fill_osiproc() expects p to be zeroed-out.
-			fill_osiproc(env, p, ts_current);
+			memset(p, 0, sizeof(OsiProc));
+			fill_osiproc(p, ts_current, t);
 		}
 		ts_current = tg_first-ki.task.thread_group_offset;
 #endif
@@ -282,12 +453,13 @@ void on_get_processes(CPUState *env, OsiProcs **out_ps) {
 		/*********************************************************/
 #endif
 
-		ts_current = get_task_struct_next(env, ts_current);
+		ts_current = ts_next;
 	} while(ts_current != (PTR)NULL && ts_current != ts_first);
 
 	// memory read error
 	if (ts_current == (PTR)NULL) goto error1;
 
+	prune_task_cache();
 	*out_ps = ps;
 	return;
 
@@ -532,6 +704,9 @@ bool init_plugin(void *self) {
 	g_free(kconf_file);
 	g_free(kconf_group);
 
+	task_buf = (uint8_t *)g_malloc(ki.task.size);
+	comm_buf = (char *)g_malloc(ki.task.comm_size * sizeof(char));
+
 	PPP_REG_CB("osi", on_get_current_process, on_get_current_process);
 	PPP_REG_CB("osi", on_get_processes, on_get_processes);
 	PPP_REG_CB("osi", on_free_osiproc, on_free_osiproc);
@@ -553,7 +728,11 @@ error:
  */
 void uninit_plugin(void *self) {
 #if defined(TARGET_I386) || defined(TARGET_ARM)
-	// Nothing to do...
+	task_cache.for_each([](const PTR &ts, task_cache_entry &t) { g_free(t.comm); });
+	task_cache.clear();
+	current_cache.clear();
+	g_free(task_buf);
+	g_free(comm_buf);
 #endif
 	return;
 }
@@ -155,6 +155,11 @@ IMPLEMENT_OFFSET_GET(get_stack, task_struct, PTR, ki.task.stack_offset, 0)
  */
 IMPLEMENT_OFFSET_GET2L(get_real_parent_pid, task_struct, PTR, ki.task.real_parent_offset, int, ki.task.pid_offset, -1)
 
+/**
+ * @brief Retrieves the address of the original parent task_struct from a task_struct.
+ */
+IMPLEMENT_OFFSET_GET(get_real_parent, task_struct, PTR, ki.task.real_parent_offset, 0)
+
 /**
  * @brief Retrieves the current parent pid (that will receive SIGCHLD, SIGWAIT) from task_struct.
  */
@@ -171,6 +176,11 @@ IMPLEMENT_OFFSET_GET2L(get_pgd, task_struct, PTR, ki.task.mm_offset, PTR, ki.mm.
  */
 IMPLEMENT_OFFSET_GET(get_mm, task_struct, PTR, ki.task.mm_offset, 0)
 
+/**
+ * @brief Retrieves the address of the page directory from an mm_struct.
+ */
+IMPLEMENT_OFFSET_GET(get_mm_pgd, mm_struct, PTR, ki.mm.pgd_offset, 0)
+
 /**
  * @brief Retrieves the address of the mm_struct from a task_struct.
  */
@@ -0,0 +1,251 @@
+/* PANDABEGINCOMMENT
+ *
+ * Authors:
+ *  Tim Leek               tleek@ll.mit.edu
+ *  Ryan Whelan            rwhelan@ll.mit.edu
+ *  Joshua Hodosh          josh.hodosh@ll.mit.edu
+ *  Michael Zhivich        mzhivich@ll.mit.edu
+ *  Brendan Dolan-Gavitt   brendandg@gatech.edu
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+
+#ifndef __DWARF_INDEX_H_
+#define __DWARF_INDEX_H_
+
+// Line/function index for pri_dwarf.
+//
+// Walking the DWARF of a large binary with libdwarf takes a long time, and
+// most of what pri_dwarf needs from it is the line table and the function
+// names. DwarfIndexFile is a compact on-disk copy of exactly that: a sorted
+// array of line ranges, an array of functions, and a string pool that both
+// refer to by offset. Addresses are stored relative to the module's load
+// bias so one index serves any load address. The file is mmapped read-only
+// and strings are handed out as pointers into the mapping.
+//
+// DwarfLineTable is the in-memory structure the plugin actually searches
+// on every instruction: the low pcs live in their own array so the binary
+// search only touches 8 bytes per probe, and the search itself compiles to
+// conditional moves.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#define DWARF_INDEX_MAGIC "PRIDWIX"
+#define DWARF_INDEX_VERSION 1
+
+// function_addr of a range that is not inside any known function
+#define DWARF_INDEX_NO_FUNC ((uint64_t)-1)
+// string offset meaning "no string"
+#define DWARF_INDEX_NO_STR ((uint32_t)-1)
+
+struct DwarfIndexHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t num_ranges;
+    uint32_t num_funcs;
+    uint32_t strtab_size;
+    // size and mtime of the debug file the index was built from, so a
+    // rebuilt binary does not pick up a stale index
+    uint64_t src_size;
+    uint64_t src_mtime;
+};
+
+struct DwarfIndexRange {
+    uint64_t lowpc, highpc, function_addr;
+    uint32_t line;
+    uint32_t line_off;
+    uint32_t file;
+    uint32_t pad;
+};
+
+struct DwarfIndexFunc {
+    uint64_t lowpc, highpc;
+    uint32_t name;
+    // line and file of the function's first line range, DWARF_INDEX_NO_STR
+    // in file if the line table has no row at lowpc
+    uint32_t line;
+    uint32_t line_off;
+    uint32_t file;
+};
+
+// Builds the string pool and writes an index out.
+class DwarfIndexWriter {
+public:
+    uint32_t add_string(const char *s) {
+        if (!s) return DWARF_INDEX_NO_STR;
+        auto it = str_offs.find(s);
+        if (it != str_offs.end()) return it->second;
+        uint32_t off = strtab.size();
+        strtab.append(s, strlen(s) + 1);
+        str_offs[s] = off;
+        return off;
+    }
+
+    // ranges must already be sorted by lowpc
+    bool write(const char *path, const struct stat &src,
+            const std::vector<DwarfIndexRange> &ranges,
+            const std::vector<DwarfIndexFunc> &funcs) {
+        DwarfIndexHeader hdr = {};
+        memcpy(hdr.magic, DWARF_INDEX_MAGIC, sizeof(DWARF_INDEX_MAGIC));
+        hdr.version = DWARF_INDEX_VERSION;
+        hdr.num_ranges = ranges.size();
+        hdr.num_funcs = funcs.size();
+        hdr.strtab_size = strtab.size();
+        hdr.src_size = src.st_size;
+        hdr.src_mtime = src.st_mtime;
+
+        // write to a temp file and rename so a concurrent run never maps a
+        // half-written index
+        std::string tmp = std::string(path) + ".tmp";
+        FILE *f = fopen(tmp.c_str(), "wb");
+        if (!f) return false;
+        bool ok = fwrite(&hdr, sizeof(hdr), 1, f) == 1;
+        if (ok && !ranges.empty())
+            ok = fwrite(&ranges[0], sizeof(DwarfIndexRange), ranges.size(), f) == ranges.size();
+        if (ok && !funcs.empty())
+            ok = fwrite(&funcs[0], sizeof(DwarfIndexFunc), funcs.size(), f) == funcs.size();
+        if (ok && !strtab.empty())
+            ok = fwrite(strtab.data(), 1, strtab.size(), f) == strtab.size();
+        ok = (fclose(f) == 0) && ok;
+        if (!ok || rename(tmp.c_str(), path) != 0) {
+            unlink(tmp.c_str());
+            return false;
+        }
+        return true;
+    }
+
+private:
+    std::string strtab;
+    std::unordered_map<std::string, uint32_t> str_offs;
+};
+
+// Read-only view of an index file. The mapping stays valid until close(),
+// including the strings returned by str().
+class DwarfIndexFile {
+public:
+    DwarfIndexFile() : base(NULL), len(0), hdr(NULL) {}
+    ~DwarfIndexFile() { close(); }
+
+    // Returns false if the file is missing, malformed, or was built from a
+    // different version of src.
+    bool open(const char *path, const struct stat &src) {
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(DwarfIndexHeader)) {
+            ::close(fd);
+            return false;
+        }
+        void *m = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (m == MAP_FAILED) return false;
+        base = (const uint8_t *)m;
+        len = st.st_size;
+        hdr = (const DwarfIndexHeader *)base;
+
+        size_t want = sizeof(DwarfIndexHeader)
+            + (size_t)hdr->num_ranges * sizeof(DwarfIndexRange)
+            + (size_t)hdr->num_funcs * sizeof(DwarfIndexFunc)
+            + hdr->strtab_size;
+        if (memcmp(hdr->magic, DWARF_INDEX_MAGIC, sizeof(DWARF_INDEX_MAGIC)) != 0
+                || hdr->version != DWARF_INDEX_VERSION
+                || want != len
+                || hdr->src_size != (uint64_t)src.st_size
+                || hdr->src_mtime != (uint64_t)src.st_mtime) {
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    void close() {
+        if (base) munmap((void *)base, len);
+        base = NULL;
+        len = 0;
+        hdr = NULL;
+    }
+
+    uint32_t num_ranges() const { return hdr->num_ranges; }
+    uint32_t num_funcs() const { return hdr->num_funcs; }
+
+    const DwarfIndexRange *ranges() const {
+        return (const DwarfIndexRange *)(base + sizeof(DwarfIndexHeader));
+    }
+    const DwarfIndexFunc *funcs() const {
+        return (const DwarfIndexFunc *)(ranges() + hdr->num_ranges);
+    }
+    const char *str(uint32_t off) const {
+        if (off == DWARF_INDEX_NO_STR || off >= hdr->strtab_size) return NULL;
+        return (const char *)(funcs() + hdr->num_funcs) + off;
+    }
+
+private:
+    const uint8_t *base;
+    size_t len;
+    const DwarfIndexHeader *hdr;
+};
+
+struct DwarfLineEntry {
+    uint64_t lowpc, highpc, function_addr;
+    char *filename;
+    const char *funct_name;
+    unsigned long line_number;
+};
+
+// Sorted, non-overlapping table of line ranges. add() must be called in
+// lowpc order; of several ranges starting at the same pc the widest one
+// wins, so an empty row never hides the real line. Empty ranges that are
+// alone at their pc (.plt stubs) only match their exact address.
+class DwarfLineTable {
+public:
+    void clear() {
+        lows.clear();
+        entries.clear();
+    }
+
+    void add(const DwarfLineEntry &e) {
+        if (!lows.empty() && lows.back() == e.lowpc) {
+            DwarfLineEntry &prev = entries.back();
+            if (e.highpc - e.lowpc > prev.highpc - prev.lowpc) prev = e;
+            return;
+        }
+        lows.push_back(e.lowpc);
+        entries.push_back(e);
+    }
+
+    // Index of the entry containing pc, or -1.
+    int32_t find(uint64_t pc) const {
+        size_t n = lows.size();
+        if (n == 0 || pc < lows[0]) return -1;
+        const uint64_t *first = &lows[0];
+        while (n > 1) {
+            size_t half = n / 2;
+            first = (first[half] <= pc) ? first + half : first;
+            n -= half;
+        }
+        int32_t i = first - &lows[0];
+        const DwarfLineEntry &e = entries[i];
+        if (pc < e.highpc || pc == e.lowpc) return i;
+        return -1;
+    }
+
+    const DwarfLineEntry &operator[](int32_t i) const { return entries[i]; }
+    size_t size() const { return lows.size(); }
+
+private:
+    std::vector<uint64_t> lows;
+    std::vector<DwarfLineEntry> entries;
+};
+
+#endif
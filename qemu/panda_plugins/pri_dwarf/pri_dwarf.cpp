@@ -77,6 +77,8 @@ void on_global_livevar_iter(CPUState *env, target_ulong pc, liveVarCB f, void *a
 #include "../callstack_instr/callstack_instr.h"
 #include "../common/prog_point.h"
 #include "../callstack_instr/callstack_instr_ext.h"
+#include "../common/open_hash.h"
+#include "dwarf_index.h"
 
 const char *guest_debug_path = NULL;
 const char *host_debug_path = NULL;
@@ -179,6 +181,31 @@ std::vector<LineRange> line_range_list;
 std::vector<LineRange> fn_start_line_range_list;
 std::map<std::string, LineRange> fn_name_to_line_info;
 
+// Flat copy of line_range_list that the per-instruction callbacks search.
+// Rebuilt lazily the next time a lookup happens after line_range_list
+// changed (i.e. after a library was loaded).
+DwarfLineTable line_table;
+bool line_table_dirty = true;
+// pc -> index into line_table, or -1 if pc has no line info. Filled in at
+// translation time, so exec and the pri callbacks are a single probe.
+OpenHashMap<target_ulong, int32_t> line_lookup_cache(1 << 12);
+
+// With use_index, line and function info is read from / written to a
+// <debugfile>.pdx index next to each debug file (see dwarf_index.h).
+bool use_index = false;
+std::vector<DwarfIndexFile *> mapped_indexes;
+
+// Functions found while loading a module, collected for the index writer.
+struct IndexedFunc {
+    std::string name;
+    Dwarf_Addr lowpc, highpc;
+    // first line of the function, filename is NULL if there was none
+    unsigned long line_number;
+    char *filename;
+    Dwarf_Unsigned line_off;
+};
+std::vector<IndexedFunc> *index_funcs = NULL;
+
 // don't need this, but may want it in the future
 //std::map<Dwarf_Addr, Dwarf_Unsigned> funct_to_cu_base;
 // use this to calculate a the value of a function's base pointer at a given pc
@@ -189,21 +216,35 @@ std::map<Dwarf_Addr,std::pair<Dwarf_Locdesc**, Dwarf_Signed>> funct_to_framepoin
 bool sortRange(const LineRange &x1,
                const LineRange &x2){
     return x1.lowpc < x2.lowpc ||
-           x1.highpc < x2.highpc;
+           (x1.lowpc == x2.lowpc && x1.highpc < x2.highpc);
 }
 
-struct CompareRangeAndPC
-{
-    bool operator () (const LineRange &ln_info,
-                    const Dwarf_Addr &pc) const{
-        //if (ln_info.lowpc <= pc && ln_info.highpc >= pc){
-        if (ln_info.lowpc <= pc && ln_info.highpc > pc){
-            return 0;
-        }
-        else
-            return ln_info.lowpc < pc;
+void rebuild_line_table() {
+    line_table.clear();
+    for (auto &r : line_range_list) {
+        auto fn = funcaddrs.find(r.function_addr);
+        DwarfLineEntry e = { r.lowpc, r.highpc, r.function_addr, r.filename,
+            fn == funcaddrs.end() ? NULL : fn->second.c_str(), r.line_number };
+        line_table.add(e);
     }
-};
+    line_lookup_cache.clear();
+    line_table_dirty = false;
+}
+
+// Line info for pc, or NULL if we have no DWARF information for it.
+const DwarfLineEntry *line_lookup(target_ulong pc) {
+    if (line_table_dirty) rebuild_line_table();
+    int32_t i;
+    int32_t *cached = line_lookup_cache.find(pc);
+    if (cached) {
+        i = *cached;
+    }
+    else {
+        i = line_table.find(pc);
+        line_lookup_cache.insert(pc, i);
+    }
+    return i < 0 ? NULL : &line_table[i];
+}
 /*
     required string file_callee = 1;
     required string function_name_callee = 2;
@@ -483,6 +524,7 @@ uint64_t elf_get_baseaddr(const char *fname, const char *basename, target_ulong
     }
     // sort the line_range_list because we changed it
     std::sort(line_range_list.begin(), line_range_list.end(), sortRange);
+    line_table_dirty = true;
 
     return load_addr;
 }
@@ -1159,6 +1201,23 @@ int get_die_loc_info(Dwarf_Debug dbg, Dwarf_Die the_die, Dwarf_Half attr, Dwarf_
 
 }
 
+// Point the .plt stubs of already processed libraries that call fn_name at
+// the function's first line.
+void link_plt_stubs(const std::string &fn_name, const LineRange &fn_line) {
+    for (auto lib_name : processed_libs) {
+        auto it = dynl_functions.find(lib_name + ":plt!" + fn_name);
+        if (it != dynl_functions.end()){
+            Dwarf_Addr plt_addr = it->second;
+            line_range_list.push_back(LineRange(plt_addr,
+                                                plt_addr,
+                                                fn_line.line_number,
+                                                fn_line.filename,
+                                                fn_line.function_addr,
+                                                fn_line.line_off));
+        }
+    }
+}
+
 void load_func_from_die(Dwarf_Debug *dbg, Dwarf_Die the_die,
         const char *basename,  uint64_t base_address,uint64_t cu_base_address, bool needs_reloc){
     char* die_name = 0;
@@ -1264,35 +1323,27 @@ void load_func_from_die(Dwarf_Debug *dbg, Dwarf_Die the_die,
             // when resolving dwarf information for .plt functions
             // NOTE: this assumes that all function names are unique.
 
-            fn_name_to_line_info.insert(std::make_pair(std::string(die_name),
-                        LineRange(lowpc,
-                            highpc,
-                            funct_line_it->line_number,
-                            funct_line_it->filename,
-                            lowpc,
-                            funct_line_it->line_off)));
+            LineRange fn_line(lowpc,
+                    highpc,
+                    funct_line_it->line_number,
+                    funct_line_it->filename,
+                    lowpc,
+                    funct_line_it->line_off);
+            fn_name_to_line_info.insert(std::make_pair(std::string(die_name), fn_line));
 
             // now check if current function we are processing is in dynl_functions if so
             // point the dynl_function to this function's line number, filename, and line_off
-            for (auto lib_name : processed_libs) {
-                if (dynl_functions.find(lib_name + ":plt!" + std::string(die_name)) != dynl_functions.end()){
-                    //printf("Trying to match function to %s\n",(lib_name + ":plt!" + std::string(die_name)).c_str());
-                    Dwarf_Addr plt_addr = dynl_functions[lib_name + ":plt!" + std::string(die_name)];
-                    //printf("Found it at 0x%llx, adding to line_range_list\n", plt_addr);
-                    //printf(" found a plt function defintion for %s\n", basename);
-
-                    line_range_list.push_back(LineRange(plt_addr,
-                                                        plt_addr,
-                                                        funct_line_it->line_number,
-                                                        funct_line_it->filename,
-                                                        lowpc,
-                                                        funct_line_it->line_off));
-
-                }
+            link_plt_stubs(die_name, fn_line);
+            if (index_funcs) {
+                index_funcs->push_back(IndexedFunc{die_name, lowpc, highpc,
+                        funct_line_it->line_number, funct_line_it->filename, funct_line_it->line_off});
             }
         }
         else {
             printf("Could not find start of function [%s] in line number table something went wrong\n", die_name);
+            if (index_funcs) {
+                index_funcs->push_back(IndexedFunc{die_name, lowpc, highpc, 0, NULL, 0});
+            }
         }
 
         // this is if we want the start of the function to be one PAST the line that represents start of function
@@ -1483,11 +1534,11 @@ bool load_debug_info(Dwarf_Debug *dbg, const char *basename, uint64_t base_addre
                     if (needs_reloc){
                         line_range_list.push_back(LineRange(base_address+lower_bound_addr,
                                                             base_address+upper_bound_addr,
-                                                            line_num, filenm_line, line_off, 0));
+                                                            line_num, filenm_line, 0, line_off));
                     }
                     else{
                         line_range_list.push_back(LineRange(lower_bound_addr, upper_bound_addr, line_num,
-                                                            filenm_line, line_off, 0));
+                                                            filenm_line, 0, line_off));
                     }
                     //printf("line no: %lld at addr: 0x%llx\n", line_num, lower_bound_addr);
                 }
@@ -1554,7 +1605,99 @@ bool load_debug_info(Dwarf_Debug *dbg, const char *basename, uint64_t base_addre
     return true;
 }
 
+/* Write the line ranges in line_range_list (which must hold only the module
+   that was just loaded) and the module's functions to an index file.
+*/
+void write_debug_index(const char *index_path, const struct stat &src,
+        const std::vector<IndexedFunc> &funcs, uint64_t bias) {
+    DwarfIndexWriter writer;
+    std::vector<DwarfIndexRange> ranges;
+    std::vector<DwarfIndexFunc> ifuncs;
+    for (auto &r : line_range_list) {
+        // skip empty rows, and .plt stubs of other libraries that point
+        // into this one -- those depend on where the other library is
+        if (r.lowpc == r.highpc) continue;
+        DwarfIndexRange ir = {};
+        ir.lowpc = r.lowpc - bias;
+        ir.highpc = r.highpc - bias;
+        ir.function_addr = r.function_addr ? r.function_addr - bias : DWARF_INDEX_NO_FUNC;
+        ir.line = r.line_number;
+        ir.line_off = r.line_off;
+        ir.file = writer.add_string(r.filename);
+        ranges.push_back(ir);
+    }
+    for (auto &f : funcs) {
+        DwarfIndexFunc ifn = {};
+        ifn.lowpc = f.lowpc - bias;
+        ifn.highpc = f.highpc - bias;
+        ifn.name = writer.add_string(f.name.c_str());
+        ifn.line = f.line_number;
+        ifn.line_off = f.line_off;
+        ifn.file = writer.add_string(f.filename);
+        ifuncs.push_back(ifn);
+    }
+    if (!writer.write(index_path, src, ranges, ifuncs)) {
+        printf("Could not write DWARF index %s\n", index_path);
+        return;
+    }
+    printf("Wrote DWARF index %s (%lu line ranges, %lu functions)\n",
+            index_path, ranges.size(), ifuncs.size());
+}
+
+/* Load line and function info for a module from its index instead of
+   parsing the DWARF. Variable and frame base information is not in the
+   index, so the livevar APIs have nothing to report for such a module.
+*/
+bool load_debug_index(const char *index_path, const struct stat &src,
+        const char *basename, uint64_t bias) {
+    DwarfIndexFile *idx = new DwarfIndexFile();
+    if (!idx->open(index_path, src)) {
+        delete idx;
+        return false;
+    }
+
+    const DwarfIndexFunc *funcs = idx->funcs();
+    for (uint32_t i = 0; i < idx->num_funcs(); i++) {
+        const DwarfIndexFunc &f = funcs[i];
+        const char *name = idx->str(f.name);
+        Dwarf_Addr lowpc = f.lowpc + bias;
+        funcaddrs[lowpc] = std::string(basename) + "!" + name;
+        if (f.file == DWARF_INDEX_NO_STR) continue;
+        LineRange fn_line(lowpc, f.highpc + bias, f.line,
+                (char *) idx->str(f.file), lowpc, f.line_off);
+        fn_start_line_range_list.push_back(fn_line);
+        fn_name_to_line_info.insert(std::make_pair(std::string(name), fn_line));
+        link_plt_stubs(name, fn_line);
+    }
+
+    const DwarfIndexRange *ranges = idx->ranges();
+    line_range_list.reserve(line_range_list.size() + idx->num_ranges());
+    for (uint32_t i = 0; i < idx->num_ranges(); i++) {
+        const DwarfIndexRange &r = ranges[i];
+        Dwarf_Addr function_addr = (r.function_addr == DWARF_INDEX_NO_FUNC) ? 0 : r.function_addr + bias;
+        line_range_list.push_back(LineRange(r.lowpc + bias, r.highpc + bias, r.line,
+                    (char *) idx->str(r.file), function_addr, r.line_off));
+    }
+    std::sort(fn_start_line_range_list.begin(), fn_start_line_range_list.end(), sortRange);
+    std::sort(line_range_list.begin(), line_range_list.end(), sortRange);
+    line_table_dirty = true;
+
+    // filenames point into the mapping, so it stays around
+    mapped_indexes.push_back(idx);
+    printf("Loaded DWARF index %s for %s (%u line ranges, %u functions)\n",
+            index_path, basename, idx->num_ranges(), idx->num_funcs());
+    return true;
+}
+
 bool read_debug_info(const char* dbgfile, const char *basename, uint64_t base_address, bool needs_reloc) {
+    uint64_t bias = needs_reloc ? base_address : 0;
+    std::string index_path = std::string(dbgfile) + ".pdx";
+    struct stat src;
+    bool have_src = use_index && stat(dbgfile, &src) == 0;
+    if (have_src && load_debug_index(index_path.c_str(), src, basename, bias)) {
+        return true;
+    }
+
     Dwarf_Debug *dbg = (Dwarf_Debug *) malloc(sizeof(Dwarf_Debug));
     Dwarf_Error err;
     int fd = -1;
@@ -1568,7 +1711,24 @@ bool read_debug_info(const char* dbgfile, const char *basename, uint64_t base_ad
         return false;
     }
 
-    if (!load_debug_info(dbg, basename, base_address, needs_reloc)){
+    // Load into an empty line_range_list so that only this module's ranges
+    // end up in the index, then merge the earlier modules back in. This
+    // also keeps the per-function passes in load_func_from_die from walking
+    // every line of every library loaded so far.
+    std::vector<LineRange> prev_ranges;
+    prev_ranges.swap(line_range_list);
+    std::vector<IndexedFunc> funcs;
+    if (have_src) index_funcs = &funcs;
+    bool loaded = load_debug_info(dbg, basename, base_address, needs_reloc);
+    index_funcs = NULL;
+    if (loaded && have_src) {
+        write_debug_index(index_path.c_str(), src, funcs, bias);
+    }
+    line_range_list.insert(line_range_list.end(), prev_ranges.begin(), prev_ranges.end());
+    std::sort(line_range_list.begin(), line_range_list.end(), sortRange);
+    line_table_dirty = true;
+
+    if (!loaded){
         fprintf(stderr, "Failed DWARF loading\n");
         return false;
     }
@@ -1722,54 +1882,15 @@ target_ulong get_cur_fp(CPUState *env, target_ulong pc){
 
 bool dwarf_in_target_code(CPUState *env, target_ulong pc){
     if (!correct_asid(env)) return false;
-    auto it = std::lower_bound(line_range_list.begin(), line_range_list.end(), pc, CompareRangeAndPC());
-    if (pc < it->lowpc || it == line_range_list.end())
-        return false;
-    return true;
+    return line_lookup(pc) != NULL;
 }
 
 bool translate_callback_dwarf(CPUState *env, target_ulong pc) {
     if (!correct_asid(env)) return false;
 
-    auto it2 = std::lower_bound(line_range_list.begin(), line_range_list.end(), pc, CompareRangeAndPC());
-    /*
-    // these are just checks to make sure the lower_bound returns the same value as lower_bound
-    // after checking this through a recording, I am pretty sure that I have ironed all the kinks out
-    // in implementing lower_bound for a vector of ranges
-    auto addressInRange = [pc](std::tuple<Dwarf_Addr, Dwarf_Addr, Dwarf_Unsigned, char *, Dwarf_Addr> x) {
-        return pc >= std::get<0>(x) && pc < std::get<1>(x);
-    };
-    auto it = find_if(line_range_list.begin(), line_range_list.end(), addressInRange);
-    if (it == line_range_list.end())
-        return false;
-    */
-    /*
-    // debugging print statements
-    printf(" pc: 0x%x, addr1: 0x%llx-0x%llx addr2: 0x%llx-0x%llx\n", pc,std::get<0>(*it), std::get<1>(*it),
-            std::get<0>(*it2), std::get<1>(*it2));
-    //printf(" pc: 0x%x, addr2: 0x%llx-0x%llx\n", pc, std::get<0>(*it2), std::get<1>(*it2));
-    if (std::get<0>(*it) != std::get<0>(*it2)) {
-        auto before_it1 = it - 1;
-        auto after_it1 = it + 1;
-        auto before_it2 = it2 - 1;
-        auto after_it2 = it2 + 1;
-        printf(" before linear it: 0x%llx-0x%llx binary search it: 0x%llx-0x%llx\n",
-                std::get<0>(*before_it1), std::get<1>(*before_it1),
-                std::get<0>(*before_it2), std::get<1>(*before_it2));
-        printf(" after linear it: 0x%llx-0x%llx binary search it: 0x%llx-0x%llx\n",
-                std::get<0>(*after_it1), std::get<1>(*after_it1),
-                std::get<0>(*after_it2), std::get<1>(*after_it2));
-        abort();
-    }
-    */
-    // after the call to lower_bound the `pc` should be between it2->lowpc and it2->highpc
-    // if it2 == line_range_list.end() we know we definitely didn't find out pc in our line_range_list
-    if (pc < it2->lowpc || it2 == line_range_list.end())
-        return false;
-
-
-    return true;
-
+    // this also fills line_lookup_cache, so exec_callback_dwarf and the
+    // pri callbacks for this pc don't need to search
+    return line_lookup(pc) != NULL;
 }
 
 void dwarf_log_callsite(CPUState *env, char *file_callee, char *fn_callee, uint64_t lno_callee, bool isCall){
@@ -1781,16 +1902,14 @@ void dwarf_log_callsite(CPUState *env, char *file_callee, char *fn_callee, uint6
     }
 
     ra -= 5; // subtract 5 to get address of call instead of return address
-    auto it = std::lower_bound(line_range_list.begin(), line_range_list.end(), ra, CompareRangeAndPC());
-    if (ra < it->lowpc || it == line_range_list.end()){
+    const DwarfLineEntry *it = line_lookup(ra);
+    if (!it){
         //printf("No DWARF information for callsite 0x%x for current function.\n", ra);
         //printf("Callsite must be in an external library we do not have DWARF information for.\n");
         return;
     }
-    Dwarf_Addr call_site_fn = it->function_addr;
     char *file_name = it->filename;
     Dwarf_Unsigned lno = it->line_number;
-    std::string funct_name = funcaddrs[call_site_fn];
 
     //void pri_dwarf_plog(char *file_callee, char *fn_callee, uint64_t lno_callee, char *file_caller, uint64_t lno_caller, bool isCall)
     pri_dwarf_plog(file_callee, fn_callee, lno_callee, file_name, lno, isCall);
@@ -1807,21 +1926,21 @@ void dwarf_log_callsite(CPUState *env, char *file_callee, char *fn_callee, uint6
 
 void on_call(CPUState *env, target_ulong pc) {
     if (!correct_asid(env)) return;
-    auto it = std::lower_bound(line_range_list.begin(), line_range_list.end(), pc, CompareRangeAndPC());
-    if (pc < it->lowpc || it == line_range_list.end()){
+    const DwarfLineEntry *it = line_lookup(pc);
+    if (!it){
         /* printf("RET: Could not find line info for 0x%x\n", pc); */
         return;
     }
     cur_function = it->function_addr;
     char *file_name = it->filename;
-    std::string funct_name = funcaddrs[cur_function];
+    const char *funct_name = it->funct_name ? it->funct_name : "";
     cur_line = it->line_number;
     if (it->lowpc == it->highpc){
         //printf("Calling %s through .plt\n",file_name);
     }
-    //printf("CALL: [%s] [0x%llx]-%s(), ln: %4lld, pc @ 0x%x\n",file_name,cur_function, funct_name.c_str(),cur_line,pc);
-    dwarf_log_callsite(env, file_name,(char *)funct_name.c_str(), cur_line, true);
-    pri_runcb_on_fn_start(env, pc, file_name, funct_name.c_str(), cur_line);
+    //printf("CALL: [%s] [0x%llx]-%s(), ln: %4lld, pc @ 0x%x\n",file_name,cur_function, funct_name,cur_line,pc);
+    dwarf_log_callsite(env, file_name,(char *)funct_name, cur_line, true);
+    pri_runcb_on_fn_start(env, pc, file_name, funct_name, cur_line);
 
     /*
     if (funcaddrs.find(pc) != funcaddrs.end()){
@@ -1852,17 +1971,17 @@ void on_call(CPUState *env, target_ulong pc) {
 void on_ret(CPUState *env, target_ulong pc_func) {
     if (!correct_asid(env)) return;
     //printf(" on_ret address: %x\n", func);
-    auto it = std::lower_bound(line_range_list.begin(), line_range_list.end(), pc_func, CompareRangeAndPC());
-    if (pc_func < it->lowpc || it == line_range_list.end()){
+    const DwarfLineEntry *it = line_lookup(pc_func);
+    if (!it){
         /* printf("RET: Could not find line info for 0x%x\n", pc_func); */
         return;
     }
     cur_function = it->function_addr;
     char *file_name = it->filename;
-    std::string funct_name = funcaddrs[cur_function];
+    const char *funct_name = it->funct_name ? it->funct_name : "";
     cur_line = it->line_number;
-    //printf("RET: [%s] [0x%llx]-%s(), ln: %4lld, pc @ 0x%x\n",file_name,cur_function, funct_name.c_str(),cur_line,pc_func);
-    dwarf_log_callsite(env, file_name,(char *)funct_name.c_str(), cur_line, false);
+    //printf("RET: [%s] [0x%llx]-%s(), ln: %4lld, pc @ 0x%x\n",file_name,cur_function, funct_name,cur_line,pc_func);
+    dwarf_log_callsite(env, file_name,(char *)funct_name, cur_line, false);
 }
 
 void __livevar_iter(CPUState *env,
@@ -1976,8 +2095,8 @@ void dwarf_get_vma_symbol (CPUState *env, target_ulong pc, target_ulong vma, cha
     }
     target_ulong fn_address;
 
-    auto it = std::lower_bound(line_range_list.begin(), line_range_list.end(), pc, CompareRangeAndPC());
-    if (pc < it->lowpc || it == line_range_list.end() ) {
+    const DwarfLineEntry *it = line_lookup(pc);
+    if (!it) {
         *symbol_name = NULL;
         return;
     }
@@ -2007,8 +2126,8 @@ void dwarf_get_pc_source_info(CPUState *env, target_ulong pc, SrcInfo *info, int
         *rc = -1;
         return;
     }
-    auto it = std::lower_bound(line_range_list.begin(), line_range_list.end(), pc, CompareRangeAndPC());
-    if (pc < it->lowpc || it == line_range_list.end()){
+    const DwarfLineEntry *it = line_lookup(pc);
+    if (!it){
         auto it_dyn = addr_to_dynl_function.find(pc);
         if (it_dyn != addr_to_dynl_function.end()){
             //printf("In a a plt function\n");
@@ -2029,11 +2148,10 @@ void dwarf_get_pc_source_info(CPUState *env, target_ulong pc, SrcInfo *info, int
         return;
     }
     // we are in dwarf-land, so populate info struct
-    Dwarf_Addr call_site_fn = it->function_addr;
     info->filename = it->filename;
     info->line_number = it->line_number;
-    std::string funct_name = funcaddrs[call_site_fn];
-    info->funct_name = funct_name.c_str();
+    // points into funcaddrs, so it stays valid after we return
+    info->funct_name = it->funct_name ? it->funct_name : "";
     *rc = 0;
     return;
 }
@@ -2080,8 +2198,8 @@ void dwarf_global_livevar_iter(CPUState *env,
 int exec_callback_dwarf(CPUState *env, target_ulong pc) {
     inExecutableSource = false;
     if (!correct_asid(env)) return 0;
-    auto it2 = std::lower_bound(line_range_list.begin(), line_range_list.end(), pc, CompareRangeAndPC());
-    if (it2 == line_range_list.end() || pc < it2->lowpc)
+    const DwarfLineEntry *it2 = line_lookup(pc);
+    if (!it2)
         return 0;
     inExecutableSource = true;
     if (it2->lowpc == it2->highpc) {
@@ -2089,23 +2207,23 @@ int exec_callback_dwarf(CPUState *env, target_ulong pc) {
     }
     cur_function = it2->function_addr;
     char *file_name = it2->filename;
-    std::string funct_name = funcaddrs[cur_function];
+    const char *funct_name = it2->funct_name;
     cur_line = it2->line_number;
 
-    //printf("[%s] [0x%llx]-%s(), ln: %4lld, pc @ 0x%x\n",file_name,cur_function, funct_name.c_str(),cur_line,pc);
-    if (funcaddrs.find(cur_function) == funcaddrs.end())
+    //printf("[%s] [0x%llx]-%s(), ln: %4lld, pc @ 0x%x\n",file_name,cur_function, funct_name,cur_line,pc);
+    if (!funct_name)
         return 0;
     if (cur_function == 0)
         return 0;
-    //printf("[%s] [0x%llx]-%s(), ln: %4lld, pc @ 0x%x\n",file_name,cur_function, funct_name.c_str(),cur_line,pc);
+    //printf("[%s] [0x%llx]-%s(), ln: %4lld, pc @ 0x%x\n",file_name,cur_function, funct_name,cur_line,pc);
     //__livevar_iter(env, pc, funcvars[cur_function], push_var_if_live);
     //__livevar_iter(env, pc, global_var_list, push_var_if_live);
     //__livevar_iter(env, pc, global_var_list, print_var_if_live);
     if (cur_line != prev_line){
-        //printf("[%s] %s(), ln: %4lld, pc @ 0x%x\n",file_name, funct_name.c_str(),cur_line,pc);
+        //printf("[%s] %s(), ln: %4lld, pc @ 0x%x\n",file_name, funct_name,cur_line,pc);
         pri_runcb_on_after_line_change(env,pc,prev_file_name,prev_funct_name.c_str(), prev_line);
-        pri_runcb_on_before_line_change(env, pc, file_name, funct_name.c_str(), cur_line);
-        PPP_RUN_CB(on_pri_dwarf_line_change, env, pc, file_name, funct_name.c_str(), cur_line);
+        pri_runcb_on_before_line_change(env, pc, file_name, funct_name, cur_line);
+        PPP_RUN_CB(on_pri_dwarf_line_change, env, pc, file_name, funct_name, cur_line);
 
         // reset previous line information
         prev_file_name = file_name;
@@ -2209,6 +2327,7 @@ bool init_plugin(void *self) {
     guest_debug_path = panda_parse_string(args, "g_debugpath", "dbg");
     host_debug_path = panda_parse_string(args, "h_debugpath", "dbg");
     proc_to_monitor = panda_parse_string(args, "proc", "None");
+    use_index = panda_parse_bool(args, "use_index");
     // panda plugin plugin includes
     panda_require("callstack_instr");
     panda_require("osi");
@@ -196,6 +196,14 @@ static RR_prog_point copy_entry(void) {
                 }
             }
             break;
+        case RR_STATE_HASH:
+            // the seed keeps the original count, so the cut log samples
+            // the same pages
+            sassert(fread(&(item->variant.state_hash),
+                        sizeof(item->variant.state_hash), 1, oldlog) == 1);
+            sassert(fwrite(&(item->variant.state_hash),
+                        sizeof(item->variant.state_hash), 1, newlog) == 1);
+            break;
         case RR_LAST:
         case RR_DEBUG:
             //mz nothing to read
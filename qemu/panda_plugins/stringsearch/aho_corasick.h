@@ -0,0 +1,256 @@
+/* PANDABEGINCOMMENT
+ *
+ * Authors:
+ *  Tim Leek               tleek@ll.mit.edu
+ *  Ryan Whelan            rwhelan@ll.mit.edu
+ *  Joshua Hodosh          josh.hodosh@ll.mit.edu
+ *  Michael Zhivich        mzhivich@ll.mit.edu
+ *  Brendan Dolan-Gavitt   brendandg@gatech.edu
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+
+#ifndef __AHO_CORASICK_H_
+#define __AHO_CORASICK_H_
+
+// Multi-pattern matcher used by stringsearch. All search strings are
+// compiled into a single Aho-Corasick automaton, which is then flattened
+// into a DFA over a reduced alphabet (bytes that never occur in any
+// pattern share one column), as far as a memory budget allows. The only state a caller has to keep between
+// memory accesses is a single uint32_t, so it is cheap to keep one per
+// prog point.
+
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+#include <algorithm>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+class AhoCorasick {
+public:
+    enum : uint32_t { ROOT = 0 };
+
+    AhoCorasick() : nclasses(1), ready(false) {
+        memset(byte_class, 0, sizeof(byte_class));
+        memset(is_first, 0, sizeof(is_first));
+        trie.push_back(TrieNode());
+    }
+
+    // Returns the pattern index, which is what gets reported on a match.
+    int add_pattern(const uint8_t *pat, uint32_t len) {
+        uint32_t s = ROOT;
+        for (uint32_t i = 0; i < len; i++) {
+            uint8_t c = pat[i];
+            int next = -1;
+            for (auto &e : trie[s].edges) {
+                if (e.first == c) { next = e.second; break; }
+            }
+            if (next < 0) {
+                next = trie.size();
+                trie[s].edges.push_back(std::make_pair(c, (uint32_t)next));
+                trie.push_back(TrieNode());
+            }
+            s = next;
+        }
+        int idx = npatterns++;
+        trie[s].out.push_back(idx);
+        if (len > 0) is_first[pat[0]] = 1;
+        return idx;
+    }
+
+    // Build failure links and flatten the trie into a transition table.
+    // Must be called once after the last add_pattern().
+    //
+    // The dense table costs a row of num_classes() entries per state,
+    // which for tens of thousands of patterns runs to gigabytes. States are
+    // numbered breadth-first and only the first max_table_bytes worth get
+    // dense rows; deeper states keep their trie edges and a failure link.
+    // Scans spend nearly all their time in the shallow states, so this only
+    // slows down the rare long partial matches.
+    void compile(size_t max_table_bytes = DEFAULT_MAX_TABLE_BYTES) {
+        // Alphabet reduction: every byte used by some pattern gets its own
+        // column, everything else goes to column 0.
+        for (auto &n : trie) {
+            for (auto &e : n.edges) {
+                if (byte_class[e.first] == 0) byte_class[e.first] = nclasses++;
+            }
+        }
+
+        // BFS numbering: a state's failure target is shallower, so it is
+        // numbered (and finished) before the state itself, and the dense
+        // states are exactly the shallowest ones.
+        uint32_t nstates = trie.size();
+        std::vector<uint32_t> order;
+        order.reserve(nstates);
+        order.push_back(ROOT);
+        for (size_t i = 0; i < order.size(); i++) {
+            for (auto &e : trie[order[i]].edges) order.push_back(e.second);
+        }
+        std::vector<uint32_t> id(nstates);
+        for (uint32_t i = 0; i < nstates; i++) id[order[i]] = i;
+
+        size_t row_bytes = (size_t)nclasses * sizeof(uint32_t);
+        size_t max_dense = std::max<size_t>(1, max_table_bytes / row_bytes);
+        ndense = std::min<size_t>(nstates, max_dense);
+        delta.assign((size_t)ndense * nclasses, ROOT);
+        std::vector<uint32_t> link(nstates, ROOT);   // failure links
+        fail.assign(nstates - ndense, ROOT);
+        sparse_start.assign(nstates - ndense + 1, 0);
+        sparse.clear();
+
+        for (uint32_t s = 0; s < nstates; s++) {
+            TrieNode &node = trie[order[s]];
+            uint32_t f = link[s];
+            if (s != ROOT) {
+                // Inherit outputs along the failure chain so a single lookup
+                // yields every pattern ending here, overlapping ones included.
+                TrieNode &fnode = trie[order[f]];
+                node.out.insert(node.out.end(), fnode.out.begin(), fnode.out.end());
+                if (s < ndense) {
+                    memcpy(&delta[(size_t)s * nclasses], &delta[(size_t)f * nclasses],
+                            nclasses * sizeof(uint32_t));
+                }
+            }
+            if (s >= ndense) sparse_start[s - ndense] = sparse.size();
+            for (auto &e : node.edges) {
+                uint32_t col = byte_class[e.first];
+                uint32_t child = id[e.second];
+                link[child] = (s == ROOT) ? ROOT : step_class(f, col);
+                if (child >= ndense) fail[child - ndense] = link[child];
+                if (s < ndense) {
+                    delta[(size_t)s * nclasses + col] = child;
+                } else {
+                    sparse.push_back(std::make_pair(col, child));
+                }
+            }
+        }
+        sparse_start[nstates - ndense] = sparse.size();
+
+        out_start.resize(nstates + 1);
+        for (uint32_t s = 0; s < nstates; s++) {
+            TrieNode &node = trie[order[s]];
+            out_start[s] = out.size();
+            out.insert(out.end(), node.out.begin(), node.out.end());
+        }
+        out_start[nstates] = out.size();
+
+        first_bytes.clear();
+        for (int c = 0; c < 256; c++) {
+            if (is_first[c]) first_bytes.push_back(c);
+        }
+
+        // The trie is no longer needed once the DFA exists.
+        std::vector<TrieNode>().swap(trie);
+        ready = true;
+    }
+
+    inline uint32_t step(uint32_t s, uint8_t c) const {
+        return step_class(s, byte_class[c]);
+    }
+
+    inline bool has_output(uint32_t s) const {
+        return out_start[s] != out_start[s+1];
+    }
+
+    inline const int *outputs_begin(uint32_t s) const { return &out[0] + out_start[s]; }
+    inline const int *outputs_end(uint32_t s) const { return &out[0] + out_start[s+1]; }
+
+    // From the root state nothing can happen until we see a byte that
+    // starts some pattern, so skip straight to it. Returns len if there
+    // is no such byte.
+    inline uint32_t skip_to_first(const uint8_t *buf, uint32_t i, uint32_t len) const {
+#ifdef __SSE2__
+        if (first_bytes.size() <= MAX_SIMD_FIRST) {
+            while (i + 16 <= len) {
+                __m128i chunk = _mm_loadu_si128((const __m128i *)(buf + i));
+                __m128i hit = _mm_setzero_si128();
+                for (auto c : first_bytes) {
+                    hit = _mm_or_si128(hit, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(c)));
+                }
+                int mask = _mm_movemask_epi8(hit);
+                if (mask) return i + __builtin_ctz(mask);
+                i += 16;
+            }
+        }
+#endif
+        while (i < len && !is_first[buf[i]]) i++;
+        return i;
+    }
+
+    // Run the automaton over buf starting in state s, calling
+    // on_match(pattern_idx) for every pattern occurrence. Returns the new
+    // state.
+    template<typename F>
+    uint32_t scan(uint32_t s, const uint8_t *buf, uint32_t len, F on_match) const {
+        uint32_t i = 0;
+        while (i < len) {
+            if (s == ROOT) {
+                i = skip_to_first(buf, i, len);
+                if (i == len) break;
+            }
+            s = step(s, buf[i++]);
+            if (has_output(s)) {
+                for (const int *p = outputs_begin(s); p != outputs_end(s); p++)
+                    on_match(*p);
+            }
+        }
+        return s;
+    }
+
+    uint32_t num_states() const { return out_start.size() - 1; }
+    uint32_t num_dense_states() const { return ndense; }
+    uint32_t num_classes() const { return nclasses; }
+    int num_patterns() const { return npatterns; }
+    bool compiled() const { return ready; }
+
+    // Default memory budget of the dense transition table.
+    static const size_t DEFAULT_MAX_TABLE_BYTES = (size_t)256 << 20;
+
+private:
+    // Above this many distinct first bytes the SSE compare chain costs
+    // more than the scalar table lookup.
+    enum { MAX_SIMD_FIRST = 8 };
+
+    inline uint32_t step_class(uint32_t s, uint32_t col) const {
+        while (s >= ndense) {
+            uint32_t i = sparse_start[s - ndense], end = sparse_start[s - ndense + 1];
+            for (; i < end; i++) {
+                if (sparse[i].first == col) return sparse[i].second;
+            }
+            s = fail[s - ndense];
+        }
+        return delta[(size_t)s * nclasses + col];
+    }
+
+    struct TrieNode {
+        std::vector<std::pair<uint8_t,uint32_t>> edges;
+        std::vector<int> out;
+    };
+
+    std::vector<TrieNode> trie;
+    int npatterns = 0;
+
+    uint8_t byte_class[256];
+    uint32_t nclasses;
+    // states [0, ndense) have a row in delta; the rest have their edges as
+    // (class, state) in sparse[sparse_start[s - ndense]...] and a failure
+    // link in fail[s - ndense]
+    uint32_t ndense = 0;
+    std::vector<uint32_t> delta;
+    std::vector<uint32_t> sparse_start;
+    std::vector<std::pair<uint32_t,uint32_t>> sparse;
+    std::vector<uint32_t> fail;
+    std::vector<uint32_t> out_start;
+    std::vector<int> out;
+
+    uint8_t is_first[256];
+    std::vector<uint8_t> first_bytes;
+    bool ready;
+};
+
+#endif
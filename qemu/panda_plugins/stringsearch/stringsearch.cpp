@@ -33,6 +33,7 @@ extern "C" {
 #include <ctype.h>
 #include <math.h>
 #include <map>
+#include <vector>
 #include <fstream>
 #include <sstream>
 #include <string>
@@ -41,6 +42,8 @@ extern "C" {
 using namespace std;
 
 #include "../common/prog_point.h"
+#include "../common/prog_point_table.h"
+#include "aho_corasick.h"
 #include "pandalog.h"
 #include "../callstack_instr/callstack_instr_ext.h"
 #include "panda_plugin_plugin.h"
@@ -59,15 +62,6 @@ PPP_PROT_REG_CB(on_ssm);
 
 }
 
-// Silly: since we use these as map values, they have to be
-// copy constructible. Plain arrays aren't, but structs containing
-// arrays are. So we make these goofy wrappers.
-struct match_strings {
-    int val[MAX_STRINGS];
-};
-struct string_pos {
-    uint32_t val[MAX_STRINGS];
-};
 struct fullstack {
     int n;
     target_ulong callers[MAX_CALLERS];
@@ -75,12 +69,16 @@ struct fullstack {
     target_ulong asid;
 };
 
+// Per prog point we only need to remember the automaton state, so a table
+// of uint32_t replaces the old per-string position arrays.
+typedef ProgPointTable<uint32_t> text_tracker_t;
+
 std::map<prog_point,fullstack> matchstacks;
-std::map<prog_point,match_strings> matches;
-std::map<prog_point,string_pos> read_text_tracker;
-std::map<prog_point,string_pos> write_text_tracker;
-uint8_t tofind[MAX_STRINGS][MAX_STRLEN];
-uint32_t strlens[MAX_STRINGS];
+std::map<prog_point,std::vector<int>> matches;
+text_tracker_t read_text_tracker;
+text_tracker_t write_text_tracker;
+std::vector<std::string> tofind;
+AhoCorasick search_automaton;
 int num_strings = 0;
 int n_callers = 16;
 
@@ -92,41 +90,31 @@ PPP_CB_BOILERPLATE(on_ssm)
 
 int mem_callback(CPUState *env, target_ulong pc, target_ulong addr,
                        target_ulong size, void *buf, bool is_write,
-                       std::map<prog_point,string_pos> &text_tracker) {
+                       text_tracker_t &text_tracker) {
     prog_point p = {};
     get_prog_point(env, &p);
 
-    string_pos &sp = text_tracker[p];
-
-    for (unsigned int i = 0; i < size; i++) {
-        uint8_t val = ((uint8_t *)buf)[i];
-        for(int str_idx = 0; str_idx < num_strings; str_idx++) {
-            if (tofind[str_idx][sp.val[str_idx]] == val)
-                sp.val[str_idx]++;
-            else
-                sp.val[str_idx] = 0;
-
-            if (sp.val[str_idx] == strlens[str_idx]) {
-                // Victory!
-                printf("%s Match of str %d at: instr_count=%lu :  " TARGET_FMT_lx " " TARGET_FMT_lx " " TARGET_FMT_lx "\n",
-                       (is_write ? "WRITE" : "READ"), str_idx, rr_get_guest_instr_count(), p.caller, p.pc, p.cr3);
-                matches[p].val[str_idx]++;
-                sp.val[str_idx] = 0;
-
-                // Also get the full stack here
-                fullstack f = {0};
-                f.n = get_callers(f.callers, n_callers, env);
-                f.pc = p.pc;
-                f.asid = p.cr3;
-                matchstacks[p] = f;
-
-                // call the i-found-a-match registered callbacks here
-                PPP_RUN_CB(on_ssm, env, pc, addr, tofind[str_idx], strlens[str_idx], is_write)
+    uint32_t &state = text_tracker[p];
+
+    state = search_automaton.scan(state, (uint8_t *)buf, size, [&](int str_idx) {
+        // Victory!
+        printf("%s Match of str %d at: instr_count=%lu :  " TARGET_FMT_lx " " TARGET_FMT_lx " " TARGET_FMT_lx "\n",
+               (is_write ? "WRITE" : "READ"), str_idx, rr_get_guest_instr_count(), p.caller, p.pc, p.cr3);
+        std::vector<int> &m = matches[p];
+        if (m.empty()) m.resize(num_strings);
+        m[str_idx]++;
+
+        // Also get the full stack here
+        fullstack f = {0};
+        f.n = get_callers(f.callers, n_callers, env);
+        f.pc = p.pc;
+        f.asid = p.cr3;
+        matchstacks[p] = f;
+
+        // call the i-found-a-match registered callbacks here
+        PPP_RUN_CB(on_ssm, env, pc, addr, (uint8_t *)tofind[str_idx].data(), tofind[str_idx].size(), is_write)
+    });
 
-            }
-        }
-    }
- 
     return 1;
 }
 
@@ -153,16 +141,16 @@ bool init_plugin(void *self) {
     panda_arg_list *args = panda_get_args("stringsearch");
 
     const char *arg_str = panda_parse_string(args, "str", "");
-    size_t arg_len = strlen(arg_str);
-    if (arg_len > 0) {
-        memcpy(tofind[num_strings], arg_str, arg_len);
-        strlens[num_strings] = arg_len;
+    if (strlen(arg_str) > 0) {
+        tofind.push_back(arg_str);
         num_strings++;
     }
 
     n_callers = panda_parse_uint64(args, "callers", 16);
     if (n_callers > MAX_CALLERS) n_callers = MAX_CALLERS;
 
+    uint64_t max_table_mb = panda_parse_uint64(args, "max_table_mb",
+            AhoCorasick::DEFAULT_MAX_TABLE_BYTES >> 20);
     const char *prefix = panda_parse_string(args, "name", "stringsearch");
     char stringsfile[128] = {};
     sprintf(stringsfile, "%s_search_strings.txt", prefix);
@@ -181,25 +169,31 @@ bool init_plugin(void *self) {
     std::string line;
     while(std::getline(search_strings, line)) {
         std::istringstream iss(line);
+        std::string pat;
+
+        if (line.empty()) continue;
 
         if (line[0] == '"') {
             size_t len = line.size() - 2;
-            memcpy(tofind[num_strings], line.substr(1, len).c_str(), len);
-            strlens[num_strings] = len;
+            if (len > MAX_STRLEN) {
+                printf("WARN: Reached max number of characters (%d) on string %d, truncating.\n", MAX_STRLEN, num_strings);
+                len = MAX_STRLEN;
+            }
+            pat = line.substr(1, len);
         } else {
             std::string x;
-            int i = 0;
             while (std::getline(iss, x, ':')) {
-                tofind[num_strings][i++] = (uint8_t)strtoul(x.c_str(), NULL, 16);
-                if (i >= MAX_STRLEN) {
+                pat.push_back((char)strtoul(x.c_str(), NULL, 16));
+                if (pat.size() >= MAX_STRLEN) {
                     printf("WARN: Reached max number of characters (%d) on string %d, truncating.\n", MAX_STRLEN, num_strings);
                     break;
                 }
             }
-            strlens[num_strings] = i;
         }
- 
-        printf("stringsearch: added string of length %d to search set\n", strlens[num_strings]);
+        if (pat.empty()) continue;
+        tofind.push_back(pat);
+
+        printf("stringsearch: added string of length %zu to search set\n", pat.size());
 
         if(++num_strings >= MAX_STRINGS) {
             printf("WARN: maximum number of strings (%d) reached, will not load any more.\n", MAX_STRINGS);
@@ -207,6 +201,14 @@ bool init_plugin(void *self) {
         }
     }
 
+    for (auto &pat : tofind) {
+        search_automaton.add_pattern((const uint8_t *)pat.data(), pat.size());
+    }
+    search_automaton.compile(max_table_mb << 20);
+    printf("stringsearch: %d strings compiled into %u automaton states (%u byte classes, %u in the dense table)\n",
+            num_strings, search_automaton.num_states(), search_automaton.num_classes(),
+            search_automaton.num_dense_states());
+
     char matchfile[128] = {};
     sprintf(matchfile, "%s_string_matches.txt", prefix);
     mem_report = fopen(matchfile, "w");
@@ -233,7 +235,7 @@ bool init_plugin(void *self) {
 }
 
 void uninit_plugin(void *self) {
-    std::map<prog_point,match_strings>::iterator it;
+    std::map<prog_point,std::vector<int>>::iterator it;
     for(it = matches.begin(); it != matches.end(); it++) {
         // Print prog point
 
@@ -248,7 +250,7 @@ void uninit_plugin(void *self) {
 
         // Print strings that matched and how many times
         for(int i = 0; i < num_strings; i++)
-            fprintf(mem_report, " %d", it->second.val[i]);
+            fprintf(mem_report, " %d", it->second[i]);
         fprintf(mem_report, "\n");
     }
     fclose(mem_report);
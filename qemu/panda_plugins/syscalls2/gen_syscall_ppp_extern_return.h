@@ -339,6 +339,7 @@ PPP_CB_EXTERN(on_sys_timer_getoverrun_return)
 PPP_CB_EXTERN(on_sys_fsetxattr_return)
 PPP_CB_EXTERN(on_NtSetInformationTransactionManager_return)
 PPP_CB_EXTERN(on_NtQuerySystemEnvironmentValue_return)
+PPP_CB_EXTERN(on_sys_nfsservctl_return)
 PPP_CB_EXTERN(on_NtPrivilegeObjectAuditAlarm_return)
 PPP_CB_EXTERN(on_NtCreateKeyTransacted_return)
 PPP_CB_EXTERN(on_sys_link_return)
@@ -402,6 +403,7 @@ PPP_CB_EXTERN(on_NtCreateThreadEx_return)
 PPP_CB_EXTERN(on_sys_epoll_create1_return)
 PPP_CB_EXTERN(on_NtLockRegistryKey_return)
 PPP_CB_EXTERN(on_sys_uname_return)
+PPP_CB_EXTERN(on_sys_shmget_return)
 PPP_CB_EXTERN(on_sys_openat_return)
 PPP_CB_EXTERN(on_NtOpenSession_return)
 PPP_CB_EXTERN(on_NtQueryLicenseValue_return)
@@ -414,12 +416,14 @@ PPP_CB_EXTERN(on_sys_lgetxattr_return)
 PPP_CB_EXTERN(on_NtFreeUserPhysicalPages_return)
 PPP_CB_EXTERN(on_sys_sendfile64_return)
 PPP_CB_EXTERN(on_NtImpersonateAnonymousToken_return)
+PPP_CB_EXTERN(on_sys_semget_return)
 PPP_CB_EXTERN(on_sys_rmdir_return)
 PPP_CB_EXTERN(on_NtRemoveProcessDebug_return)
 PPP_CB_EXTERN(on_NtSetDefaultLocale_return)
 PPP_CB_EXTERN(on_NtRollforwardTransactionManager_return)
 PPP_CB_EXTERN(on_sys_getgid_return)
 PPP_CB_EXTERN(on_NtPrepareComplete_return)
+PPP_CB_EXTERN(on_sys_socket_return)
 PPP_CB_EXTERN(on_NtCreatePort_return)
 PPP_CB_EXTERN(on_NtCancelSynchronousIoFile_return)
 PPP_CB_EXTERN(on_NtSetTimerResolution_return)
@@ -442,10 +446,12 @@ PPP_CB_EXTERN(on_sys_exit_return)
 PPP_CB_EXTERN(on_NtSetHighWaitLowEventPair_return)
 PPP_CB_EXTERN(on_NtDebugActiveProcess_return)
 PPP_CB_EXTERN(on_NtCreateDirectoryObject_return)
+PPP_CB_EXTERN(on_sys_sendto_return)
 PPP_CB_EXTERN(on_sys_gettid_return)
 PPP_CB_EXTERN(on_NtSetEaFile_return)
 PPP_CB_EXTERN(on_sys_stat_return)
 PPP_CB_EXTERN(on_sys_open_by_handle_at_return)
+PPP_CB_EXTERN(on_sys_msgrcv_return)
 PPP_CB_EXTERN(on_sys_epoll_pwait_return)
 PPP_CB_EXTERN(on_sys_brk_return)
 PPP_CB_EXTERN(on_NtOpenJobObject_return)
@@ -572,27 +578,33 @@ PPP_CB_EXTERN(on_NtSaveKeyEx_return)
 PPP_CB_EXTERN(on_NtWaitHighEventPair_return)
 PPP_CB_EXTERN(on_sys_getxattr_return)
 PPP_CB_EXTERN(on_NtQueryVolumeInformationFile_return)
+PPP_CB_EXTERN(on_sys_getsockopt_return)
 PPP_CB_EXTERN(on_sys_fadvise64_64_return)
 PPP_CB_EXTERN(on_NtQueryEvent_return)
 PPP_CB_EXTERN(on_NtSetSystemInformation_return)
 PPP_CB_EXTERN(on_NtOpenFile_return)
 PPP_CB_EXTERN(on_NtPulseEvent_return)
+PPP_CB_EXTERN(on_sys_shutdown_return)
 PPP_CB_EXTERN(on_sys_getpgrp_return)
 PPP_CB_EXTERN(on_NtQueryInstallUILanguage_return)
+PPP_CB_EXTERN(on_sys_shmat_return)
 PPP_CB_EXTERN(on_NtAlpcOpenSenderProcess_return)
 PPP_CB_EXTERN(on_NtSetContextThread_return)
 PPP_CB_EXTERN(on_NtOpenSemaphore_return)
 PPP_CB_EXTERN(on_sys_timer_settime_return)
+PPP_CB_EXTERN(on_sys_msgctl_return)
 PPP_CB_EXTERN(on_NtEnumerateValueKey_return)
 PPP_CB_EXTERN(on_sys_kexec_load_return)
 PPP_CB_EXTERN(on_NtInitiatePowerAction_return)
 PPP_CB_EXTERN(on_sys_open_return)
 PPP_CB_EXTERN(on_NtSetInformationObject_return)
 PPP_CB_EXTERN(on_sys_setgroups_return)
+PPP_CB_EXTERN(on_sys_connect_return)
 PPP_CB_EXTERN(on_sys_getrusage_return)
 PPP_CB_EXTERN(on_NtQueryObject_return)
 PPP_CB_EXTERN(on_sys_eventfd2_return)
 PPP_CB_EXTERN(on_NtSignalAndWaitForSingleObject_return)
+PPP_CB_EXTERN(on_sys_newfstatat_return)
 PPP_CB_EXTERN(on_sys_old_select_return)
 PPP_CB_EXTERN(on_NtLoadKey_return)
 PPP_CB_EXTERN(on_NtAddBootEntry_return)
@@ -602,6 +614,7 @@ PPP_CB_EXTERN(on_NtQuerySemaphore_return)
 PPP_CB_EXTERN(on_sys_inotify_init_return)
 PPP_CB_EXTERN(on_sys_fgetxattr_return)
 PPP_CB_EXTERN(on_sys_io_cancel_return)
+PPP_CB_EXTERN(on_sys_semctl_return)
 PPP_CB_EXTERN(on_NtSetEvent_return)
 PPP_CB_EXTERN(on_NtQuerySystemInformationEx_return)
 PPP_CB_EXTERN(on_NtThawTransactions_return)
@@ -631,6 +644,7 @@ PPP_CB_EXTERN(on_NtImpersonateClientOfPort_return)
 PPP_CB_EXTERN(on_sys_process_vm_readv_return)
 PPP_CB_EXTERN(on_sys_capget_return)
 PPP_CB_EXTERN(on_NtSetInformationEnlistment_return)
+PPP_CB_EXTERN(on_sys_recvfrom_return)
 PPP_CB_EXTERN(on_NtCreateProcess_return)
 PPP_CB_EXTERN(on_sys_fchmod_return)
 PPP_CB_EXTERN(on_sys_swapoff_return)
@@ -665,6 +679,7 @@ PPP_CB_EXTERN(on_rt_sigaction_return)
 PPP_CB_EXTERN(on_sys_process_vm_writev_return)
 PPP_CB_EXTERN(on_NtDeleteObjectAuditAlarm_return)
 PPP_CB_EXTERN(on_sys_readlinkat_return)
+PPP_CB_EXTERN(on_sys_bind_return)
 PPP_CB_EXTERN(on_NtPrivilegeCheck_return)
 PPP_CB_EXTERN(on_NtQuerySecurityObject_return)
 PPP_CB_EXTERN(on_sys_signal_return)
@@ -724,6 +739,7 @@ PPP_CB_EXTERN(on_sys_lseek_return)
 PPP_CB_EXTERN(on_NtAlpcDeletePortSection_return)
 PPP_CB_EXTERN(on_sys_sgetmask_return)
 PPP_CB_EXTERN(on_NtRegisterThreadTerminatePort_return)
+PPP_CB_EXTERN(on_sys_semtimedop_return)
 PPP_CB_EXTERN(on_NtDeleteKey_return)
 PPP_CB_EXTERN(on_sys_faccessat_return)
 PPP_CB_EXTERN(on_sys_sched_getscheduler_return)
@@ -731,6 +747,7 @@ PPP_CB_EXTERN(on_sys_name_to_handle_at_return)
 PPP_CB_EXTERN(on_sys_access_return)
 PPP_CB_EXTERN(on_NtWriteVirtualMemory_return)
 PPP_CB_EXTERN(on_NtTerminateJobObject_return)
+PPP_CB_EXTERN(on_sys_socketpair_return)
 PPP_CB_EXTERN(on_sys_setresgid_return)
 PPP_CB_EXTERN(on_NtSetThreadExecutionState_return)
 PPP_CB_EXTERN(on_NtSetBootOptions_return)
@@ -763,6 +780,7 @@ PPP_CB_EXTERN(on_NtQueryQuotaInformationFile_return)
 PPP_CB_EXTERN(on_sys_mq_notify_return)
 PPP_CB_EXTERN(on_get_thread_area_return)
 PPP_CB_EXTERN(on_sys_getuid16_return)
+PPP_CB_EXTERN(on_sys_getpeername_return)
 PPP_CB_EXTERN(on_NtSetInformationWorkerFactory_return)
 PPP_CB_EXTERN(on_NtLockVirtualMemory_return)
 PPP_CB_EXTERN(on_NtDeleteFile_return)
@@ -781,6 +799,7 @@ PPP_CB_EXTERN(on_sys_readahead_return)
 PPP_CB_EXTERN(on_NtAcceptConnectPort_return)
 PPP_CB_EXTERN(on_sys_get_mempolicy_return)
 PPP_CB_EXTERN(on_sys_mincore_return)
+PPP_CB_EXTERN(on_sys_mmap_return)
 PPP_CB_EXTERN(on_sys_fchmodat_return)
 PPP_CB_EXTERN(on_NtFreezeRegistry_return)
 PPP_CB_EXTERN(on_sys_keyctl_return)
@@ -807,6 +826,7 @@ PPP_CB_EXTERN(on_NtAlpcDeleteSecurityContext_return)
 PPP_CB_EXTERN(on_NtSetValueKey_return)
 PPP_CB_EXTERN(on_NtShutdownSystem_return)
 PPP_CB_EXTERN(on_sys_sched_setaffinity_return)
+PPP_CB_EXTERN(on_sys_setsockopt_return)
 PPP_CB_EXTERN(on_NtQueryValueKey_return)
 PPP_CB_EXTERN(on_sys_llistxattr_return)
 PPP_CB_EXTERN(on_NtOpenIoCompletion_return)
@@ -829,6 +849,7 @@ PPP_CB_EXTERN(on_NtConnectPort_return)
 PPP_CB_EXTERN(on_NtAlpcCreatePort_return)
 PPP_CB_EXTERN(on_NtCreateFile_return)
 PPP_CB_EXTERN(on_sys_lstat_return)
+PPP_CB_EXTERN(on_sys_recvmsg_return)
 PPP_CB_EXTERN(on_sys_pause_return)
 PPP_CB_EXTERN(on_NtRollbackTransaction_return)
 PPP_CB_EXTERN(on_NtOpenKeyTransacted_return)
@@ -847,6 +868,7 @@ PPP_CB_EXTERN(on_NtNotifyChangeKey_return)
 PPP_CB_EXTERN(on_sys_clone_return)
 PPP_CB_EXTERN(on_sys_vm86_return)
 PPP_CB_EXTERN(on_sys_lstat64_return)
+PPP_CB_EXTERN(on_sys_arch_prctl_return)
 PPP_CB_EXTERN(on_NtStopProfile_return)
 PPP_CB_EXTERN(on_sys_restart_syscall_return)
 PPP_CB_EXTERN(on_sys_lsetxattr_return)
@@ -861,6 +883,7 @@ PPP_CB_EXTERN(on_NtGetPlugPlayEvent_return)
 PPP_CB_EXTERN(on_sys_munlockall_return)
 PPP_CB_EXTERN(on_sys_getegid16_return)
 PPP_CB_EXTERN(on_NtAddDriverEntry_return)
+PPP_CB_EXTERN(on_sys_msgsnd_return)
 PPP_CB_EXTERN(on_sys_execve_return)
 PPP_CB_EXTERN(on_sys_tkill_return)
 PPP_CB_EXTERN(on_sys_sync_file_range_return)
@@ -886,6 +909,7 @@ PPP_CB_EXTERN(on_NtUnloadDriver_return)
 PPP_CB_EXTERN(on_sys_timer_gettime_return)
 PPP_CB_EXTERN(on_NtOpenTransaction_return)
 PPP_CB_EXTERN(on_sys_getgid16_return)
+PPP_CB_EXTERN(on_sys_sendmsg_return)
 PPP_CB_EXTERN(on_sys_sync_return)
 PPP_CB_EXTERN(on_NtUnloadKey2_return)
 PPP_CB_EXTERN(on_NtRegisterProtocolAddressInformation_return)
@@ -963,6 +987,7 @@ PPP_CB_EXTERN(on_sys_getcwd_return)
 PPP_CB_EXTERN(on_NtPowerInformation_return)
 PPP_CB_EXTERN(on_sys_acct_return)
 PPP_CB_EXTERN(on_sys_prctl_return)
+PPP_CB_EXTERN(on_sys_msgget_return)
 PPP_CB_EXTERN(on_sys_setgroups16_return)
 PPP_CB_EXTERN(on_sys_sysfs_return)
 PPP_CB_EXTERN(on_NtUnlockVirtualMemory_return)
@@ -981,6 +1006,7 @@ PPP_CB_EXTERN(on_NtReleaseWorkerFactoryWorker_return)
 PPP_CB_EXTERN(on_sys_munlock_return)
 PPP_CB_EXTERN(on_sys_futex_return)
 PPP_CB_EXTERN(on_sys_timerfd_settime_return)
+PPP_CB_EXTERN(on_sys_getsockname_return)
 PPP_CB_EXTERN(on_NtReplaceKey_return)
 PPP_CB_EXTERN(on_sys_request_key_return)
 PPP_CB_EXTERN(on_sys_reboot_return)
@@ -991,6 +1017,7 @@ PPP_CB_EXTERN(on_NtAlpcCancelMessage_return)
 PPP_CB_EXTERN(on_sys_setuid16_return)
 PPP_CB_EXTERN(on_NtOpenTransactionManager_return)
 PPP_CB_EXTERN(on_sys_setgid_return)
+PPP_CB_EXTERN(on_sys_shmdt_return)
 PPP_CB_EXTERN(on_sys_fremovexattr_return)
 PPP_CB_EXTERN(on_sys_ipc_return)
 PPP_CB_EXTERN(on_sys_flock_return)
@@ -999,14 +1026,18 @@ PPP_CB_EXTERN(on_NtQueryOpenSubKeys_return)
 PPP_CB_EXTERN(on_sys_ioprio_get_return)
 PPP_CB_EXTERN(on_NtCreateJobSet_return)
 PPP_CB_EXTERN(on_sys_mremap_return)
+PPP_CB_EXTERN(on_sys_listen_return)
 PPP_CB_EXTERN(on_sys_vmsplice_return)
 PPP_CB_EXTERN(on_sys_statfs_return)
 PPP_CB_EXTERN(on_sys_sigprocmask_return)
+PPP_CB_EXTERN(on_sys_accept4_return)
 PPP_CB_EXTERN(on_NtResetEvent_return)
 PPP_CB_EXTERN(on_sys_setresuid_return)
 PPP_CB_EXTERN(on_sys_ssetmask_return)
 PPP_CB_EXTERN(on_sys_umount_return)
+PPP_CB_EXTERN(on_sys_accept_return)
 PPP_CB_EXTERN(on_NtAllocateVirtualMemory_return)
+PPP_CB_EXTERN(on_sys_semop_return)
 PPP_CB_EXTERN(on_sys_setpriority_return)
 PPP_CB_EXTERN(on_NtWaitForSingleObject_return)
 PPP_CB_EXTERN(on_NtSerializeBoot_return)
@@ -1024,6 +1055,7 @@ PPP_CB_EXTERN(on_NtOpenMutant_return)
 PPP_CB_EXTERN(on_sys_lookup_dcookie_return)
 PPP_CB_EXTERN(on_NtSetSecurityObject_return)
 PPP_CB_EXTERN(on_NtReadVirtualMemory_return)
+PPP_CB_EXTERN(on_sys_shmctl_return)
 PPP_CB_EXTERN(on_sys_getpriority_return)
 PPP_CB_EXTERN(on_NtInitializeNlsFiles_return)
 PPP_CB_EXTERN(on_sys_removexattr_return)
@@ -348,6 +348,7 @@ PPP_PROT_REG_CB(on_NtThawRegistry_enter)
 PPP_PROT_REG_CB(on_NtWaitForWorkViaWorkerFactory_enter)
 PPP_PROT_REG_CB(on_sys_select_enter)
 PPP_PROT_REG_CB(on_sys_setreuid16_enter)
+PPP_PROT_REG_CB(on_sys_connect_enter)
 PPP_PROT_REG_CB(on_sys_fgetxattr_enter)
 PPP_PROT_REG_CB(on_sys_getpgid_enter)
 PPP_PROT_REG_CB(on_NtGetWriteWatch_enter)
@@ -384,8 +385,10 @@ PPP_PROT_REG_CB(on_NtQueryIntervalProfile_enter)
 PPP_PROT_REG_CB(on_sys_timerfd_settime_enter)
 PPP_PROT_REG_CB(on_sys_getitimer_enter)
 PPP_PROT_REG_CB(on_NtSetInformationProcess_enter)
+PPP_PROT_REG_CB(on_sys_socketpair_enter)
 PPP_PROT_REG_CB(on_sys_ssetmask_enter)
 PPP_PROT_REG_CB(on_sys_setfsuid16_enter)
+PPP_PROT_REG_CB(on_sys_bind_enter)
 PPP_PROT_REG_CB(on_NtResumeThread_enter)
 PPP_PROT_REG_CB(on_NtAlpcOpenSenderThread_enter)
 PPP_PROT_REG_CB(on_NtQueryOpenSubKeysEx_enter)
@@ -417,6 +420,7 @@ PPP_PROT_REG_CB(on_NtSetSystemEnvironmentValueEx_enter)
 PPP_PROT_REG_CB(on_sys_sysfs_enter)
 PPP_PROT_REG_CB(on_sys_set_robust_list_enter)
 PPP_PROT_REG_CB(on_NtPrepareComplete_enter)
+PPP_PROT_REG_CB(on_sys_setsockopt_enter)
 PPP_PROT_REG_CB(on_NtReplaceKey_enter)
 PPP_PROT_REG_CB(on_NtImpersonateAnonymousToken_enter)
 PPP_PROT_REG_CB(on_sys_swapon_enter)
@@ -431,6 +435,7 @@ PPP_PROT_REG_CB(on_sys_getrlimit_enter)
 PPP_PROT_REG_CB(on_sys_umount_enter)
 PPP_PROT_REG_CB(on_NtCreateTransactionManager_enter)
 PPP_PROT_REG_CB(on_NtPropagationComplete_enter)
+PPP_PROT_REG_CB(on_sys_semctl_enter)
 PPP_PROT_REG_CB(on_NtAddDriverEntry_enter)
 PPP_PROT_REG_CB(on_sys_llseek_enter)
 PPP_PROT_REG_CB(on_NtUnloadKey_enter)
@@ -444,6 +449,7 @@ PPP_PROT_REG_CB(on_NtUnmapViewOfSection_enter)
 PPP_PROT_REG_CB(on_NtConnectPort_enter)
 PPP_PROT_REG_CB(on_sys_time_enter)
 PPP_PROT_REG_CB(on_sys_signal_enter)
+PPP_PROT_REG_CB(on_sys_getpeername_enter)
 PPP_PROT_REG_CB(on_sys_inotify_add_watch_enter)
 PPP_PROT_REG_CB(on_sys_sched_setscheduler_enter)
 PPP_PROT_REG_CB(on_sys_symlinkat_enter)
@@ -453,10 +459,12 @@ PPP_PROT_REG_CB(on_NtGetContextThread_enter)
 PPP_PROT_REG_CB(on_sys_nice_enter)
 PPP_PROT_REG_CB(on_sys_ftruncate64_enter)
 PPP_PROT_REG_CB(on_sys_epoll_pwait_enter)
+PPP_PROT_REG_CB(on_sys_msgrcv_enter)
 PPP_PROT_REG_CB(on_sys_getppid_enter)
 PPP_PROT_REG_CB(on_NtQuerySystemInformationEx_enter)
 PPP_PROT_REG_CB(on_sys_dup3_enter)
 PPP_PROT_REG_CB(on_NtExtendSection_enter)
+PPP_PROT_REG_CB(on_sys_accept_enter)
 PPP_PROT_REG_CB(on_NtFindAtom_enter)
 PPP_PROT_REG_CB(on_sys_sgetmask_enter)
 PPP_PROT_REG_CB(on_sys_dup2_enter)
@@ -487,12 +495,14 @@ PPP_PROT_REG_CB(on_NtQueryValueKey_enter)
 PPP_PROT_REG_CB(on_NtApphelpCacheControl_enter)
 PPP_PROT_REG_CB(on_NtYieldExecution_enter)
 PPP_PROT_REG_CB(on_sys_tkill_enter)
+PPP_PROT_REG_CB(on_sys_shutdown_enter)
 PPP_PROT_REG_CB(on_NtCreateMailslotFile_enter)
 PPP_PROT_REG_CB(on_NtFreezeTransactions_enter)
 PPP_PROT_REG_CB(on_NtCompactKeys_enter)
 PPP_PROT_REG_CB(on_sys_getdents64_enter)
 PPP_PROT_REG_CB(on_sys_fanotify_init_enter)
 PPP_PROT_REG_CB(on_NtDeviceIoControlFile_enter)
+PPP_PROT_REG_CB(on_sys_mmap_enter)
 PPP_PROT_REG_CB(on_NtImpersonateClientOfPort_enter)
 PPP_PROT_REG_CB(on_sys_open_enter)
 PPP_PROT_REG_CB(on_sys_mq_notify_enter)
@@ -544,6 +554,7 @@ PPP_PROT_REG_CB(on_NtQueryDebugFilterState_enter)
 PPP_PROT_REG_CB(on_sys_socketcall_enter)
 PPP_PROT_REG_CB(on_sys_capget_enter)
 PPP_PROT_REG_CB(on_sys_bdflush_enter)
+PPP_PROT_REG_CB(on_sys_semtimedop_enter)
 PPP_PROT_REG_CB(on_NtSetSecurityObject_enter)
 PPP_PROT_REG_CB(on_sys_rt_tgsigqueueinfo_enter)
 PPP_PROT_REG_CB(on_NtUnloadKey2_enter)
@@ -558,6 +569,7 @@ PPP_PROT_REG_CB(on_NtGetCurrentProcessorNumber_enter)
 PPP_PROT_REG_CB(on_NtAlpcCreatePort_enter)
 PPP_PROT_REG_CB(on_NtQueryVolumeInformationFile_enter)
 PPP_PROT_REG_CB(on_sys_migrate_pages_enter)
+PPP_PROT_REG_CB(on_sys_arch_prctl_enter)
 PPP_PROT_REG_CB(on_NtOpenIoCompletion_enter)
 PPP_PROT_REG_CB(on_NtAlertThread_enter)
 PPP_PROT_REG_CB(on_NtAcceptConnectPort_enter)
@@ -596,6 +608,7 @@ PPP_PROT_REG_CB(on_NtCreateJobObject_enter)
 PPP_PROT_REG_CB(on_NtStopProfile_enter)
 PPP_PROT_REG_CB(on_sys_eventfd_enter)
 PPP_PROT_REG_CB(on_sys_name_to_handle_at_enter)
+PPP_PROT_REG_CB(on_sys_msgget_enter)
 PPP_PROT_REG_CB(on_sys_setpriority_enter)
 PPP_PROT_REG_CB(on_NtOpenPrivateNamespace_enter)
 PPP_PROT_REG_CB(on_sys_prlimit64_enter)
@@ -607,6 +620,7 @@ PPP_PROT_REG_CB(on_NtSetEventBoostPriority_enter)
 PPP_PROT_REG_CB(on_sys_sched_setaffinity_enter)
 PPP_PROT_REG_CB(on_sys_sendfile_enter)
 PPP_PROT_REG_CB(on_NtSetValueKey_enter)
+PPP_PROT_REG_CB(on_sys_getsockname_enter)
 PPP_PROT_REG_CB(on_NtSetSystemInformation_enter)
 PPP_PROT_REG_CB(on_sys_sysctl_enter)
 PPP_PROT_REG_CB(on_sys_lstat64_enter)
@@ -617,6 +631,8 @@ PPP_PROT_REG_CB(on_NtOpenThread_enter)
 PPP_PROT_REG_CB(on_NtRecoverResourceManager_enter)
 PPP_PROT_REG_CB(on_NtQueryTimerResolution_enter)
 PPP_PROT_REG_CB(on_NtClearEvent_enter)
+PPP_PROT_REG_CB(on_sys_recvmsg_enter)
+PPP_PROT_REG_CB(on_sys_sendmsg_enter)
 PPP_PROT_REG_CB(on_sys_getgid16_enter)
 PPP_PROT_REG_CB(on_sys_sync_enter)
 PPP_PROT_REG_CB(on_sys_utime_enter)
@@ -653,6 +669,7 @@ PPP_PROT_REG_CB(on_NtCreateJobSet_enter)
 PPP_PROT_REG_CB(on_sys_setfsgid_enter)
 PPP_PROT_REG_CB(on_sys_setuid_enter)
 PPP_PROT_REG_CB(on_sys_sethostname_enter)
+PPP_PROT_REG_CB(on_sys_newfstatat_enter)
 PPP_PROT_REG_CB(on_sys_inotify_init1_enter)
 PPP_PROT_REG_CB(on_sys_rt_sigsuspend_enter)
 PPP_PROT_REG_CB(on_NtQueryEvent_enter)
@@ -664,6 +681,7 @@ PPP_PROT_REG_CB(on_NtPrivilegeObjectAuditAlarm_enter)
 PPP_PROT_REG_CB(on_NtFilterToken_enter)
 PPP_PROT_REG_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_enter)
 PPP_PROT_REG_CB(on_NtCreateSection_enter)
+PPP_PROT_REG_CB(on_sys_sendto_enter)
 PPP_PROT_REG_CB(on_NtQuerySecurityAttributesToken_enter)
 PPP_PROT_REG_CB(on_sys_vhangup_enter)
 PPP_PROT_REG_CB(on_NtAlpcCreateResourceReserve_enter)
@@ -690,6 +708,7 @@ PPP_PROT_REG_CB(on_NtAllocateUuids_enter)
 PPP_PROT_REG_CB(on_NtQueryOpenSubKeys_enter)
 PPP_PROT_REG_CB(on_NtSetInformationResourceManager_enter)
 PPP_PROT_REG_CB(on_NtSetTimer_enter)
+PPP_PROT_REG_CB(on_sys_shmat_enter)
 PPP_PROT_REG_CB(on_sys_epoll_create1_enter)
 PPP_PROT_REG_CB(on_NtFlushVirtualMemory_enter)
 PPP_PROT_REG_CB(on_sys_mincore_enter)
@@ -724,6 +743,7 @@ PPP_PROT_REG_CB(on_NtOpenKeyedEvent_enter)
 PPP_PROT_REG_CB(on_sys_getgroups16_enter)
 PPP_PROT_REG_CB(on_sys_symlink_enter)
 PPP_PROT_REG_CB(on_sys_newfstat_enter)
+PPP_PROT_REG_CB(on_sys_socket_enter)
 PPP_PROT_REG_CB(on_NtAccessCheckAndAuditAlarm_enter)
 PPP_PROT_REG_CB(on_NtQueryQuotaInformationFile_enter)
 PPP_PROT_REG_CB(on_sys_getxattr_enter)
@@ -754,6 +774,7 @@ PPP_PROT_REG_CB(on_NtReleaseKeyedEvent_enter)
 PPP_PROT_REG_CB(on_sys_rename_enter)
 PPP_PROT_REG_CB(on_NtQueryObject_enter)
 PPP_PROT_REG_CB(on_NtGetPlugPlayEvent_enter)
+PPP_PROT_REG_CB(on_sys_msgctl_enter)
 PPP_PROT_REG_CB(on_NtCreateResourceManager_enter)
 PPP_PROT_REG_CB(on_sys_fremovexattr_enter)
 PPP_PROT_REG_CB(on_NtAlpcImpersonateClientOfPort_enter)
@@ -768,10 +789,12 @@ PPP_PROT_REG_CB(on_sys_clock_nanosleep_enter)
 PPP_PROT_REG_CB(on_sys_setpgid_enter)
 PPP_PROT_REG_CB(on_NtPrePrepareComplete_enter)
 PPP_PROT_REG_CB(on_NtNotifyChangeMultipleKeys_enter)
+PPP_PROT_REG_CB(on_sys_nfsservctl_enter)
 PPP_PROT_REG_CB(on_NtContinue_enter)
 PPP_PROT_REG_CB(on_NtStartProfile_enter)
 PPP_PROT_REG_CB(on_NtOpenKeyTransacted_enter)
 PPP_PROT_REG_CB(on_sys_splice_enter)
+PPP_PROT_REG_CB(on_sys_recvfrom_enter)
 PPP_PROT_REG_CB(on_NtOpenEnlistment_enter)
 PPP_PROT_REG_CB(on_sys_init_module_enter)
 PPP_PROT_REG_CB(on_sys_readlinkat_enter)
@@ -818,6 +841,7 @@ PPP_PROT_REG_CB(on_sys_delete_module_enter)
 PPP_PROT_REG_CB(on_sys_flistxattr_enter)
 PPP_PROT_REG_CB(on_sys_setregid16_enter)
 PPP_PROT_REG_CB(on_NtReleaseMutant_enter)
+PPP_PROT_REG_CB(on_sys_semget_enter)
 PPP_PROT_REG_CB(on_sys_capset_enter)
 PPP_PROT_REG_CB(on_sys_setitimer_enter)
 PPP_PROT_REG_CB(on_sys_lremovexattr_enter)
@@ -838,6 +862,7 @@ PPP_PROT_REG_CB(on_sys_sched_yield_enter)
 PPP_PROT_REG_CB(on_NtDisplayString_enter)
 PPP_PROT_REG_CB(on_sys_reboot_enter)
 PPP_PROT_REG_CB(on_sys_timer_settime_enter)
+PPP_PROT_REG_CB(on_sys_semop_enter)
 PPP_PROT_REG_CB(on_NtEnumerateBootEntries_enter)
 PPP_PROT_REG_CB(on_NtMakeTemporaryObject_enter)
 PPP_PROT_REG_CB(on_sys_readlink_enter)
@@ -848,6 +873,7 @@ PPP_PROT_REG_CB(on_NtCreateSemaphore_enter)
 PPP_PROT_REG_CB(on_NtGetNextProcess_enter)
 PPP_PROT_REG_CB(on_NtAccessCheckByTypeResultList_enter)
 PPP_PROT_REG_CB(on_NtWaitForSingleObject_enter)
+PPP_PROT_REG_CB(on_sys_listen_enter)
 PPP_PROT_REG_CB(on_sys_ioperm_enter)
 PPP_PROT_REG_CB(on_NtCreateDirectoryObject_enter)
 PPP_PROT_REG_CB(on_sys_execve_enter)
@@ -877,6 +903,7 @@ PPP_PROT_REG_CB(on_sys_chdir_enter)
 PPP_PROT_REG_CB(on_NtGetNextThread_enter)
 PPP_PROT_REG_CB(on_NtOpenTransaction_enter)
 PPP_PROT_REG_CB(on_sys_kill_enter)
+PPP_PROT_REG_CB(on_sys_shmctl_enter)
 PPP_PROT_REG_CB(on_sys_tee_enter)
 PPP_PROT_REG_CB(on_sys_fdatasync_enter)
 PPP_PROT_REG_CB(on_sys_syslog_enter)
@@ -924,6 +951,7 @@ PPP_PROT_REG_CB(on_NtOpenDirectoryObject_enter)
 PPP_PROT_REG_CB(on_NtCreateNamedPipeFile_enter)
 PPP_PROT_REG_CB(on_NtAlertResumeThread_enter)
 PPP_PROT_REG_CB(on_NtQueryInformationAtom_enter)
+PPP_PROT_REG_CB(on_sys_msgsnd_enter)
 PPP_PROT_REG_CB(on_NtSetInformationFile_enter)
 PPP_PROT_REG_CB(on_NtMapUserPhysicalPages_enter)
 PPP_PROT_REG_CB(on_NtModifyDriverEntry_enter)
@@ -935,6 +963,7 @@ PPP_PROT_REG_CB(on_sys_readv_enter)
 PPP_PROT_REG_CB(on_NtQuerySymbolicLinkObject_enter)
 PPP_PROT_REG_CB(on_NtCreateIoCompletion_enter)
 PPP_PROT_REG_CB(on_sys_madvise_enter)
+PPP_PROT_REG_CB(on_sys_accept4_enter)
 PPP_PROT_REG_CB(on_NtAllocateLocallyUniqueId_enter)
 PPP_PROT_REG_CB(on_NtSetInformationTransaction_enter)
 PPP_PROT_REG_CB(on_sys_listxattr_enter)
@@ -958,6 +987,7 @@ PPP_PROT_REG_CB(on_NtRequestWaitReplyPort_enter)
 PPP_PROT_REG_CB(on_NtCloseObjectAuditAlarm_enter)
 PPP_PROT_REG_CB(on_NtRequestPort_enter)
 PPP_PROT_REG_CB(on_NtGetNotificationResourceManager_enter)
+PPP_PROT_REG_CB(on_sys_getsockopt_enter)
 PPP_PROT_REG_CB(on_NtQueryInformationProcess_enter)
 PPP_PROT_REG_CB(on_NtGetDevicePowerState_enter)
 PPP_PROT_REG_CB(on_sys_clock_adjtime_enter)
@@ -972,6 +1002,7 @@ PPP_PROT_REG_CB(on_sys_lchown_enter)
 PPP_PROT_REG_CB(on_sys_flock_enter)
 PPP_PROT_REG_CB(on_sys_swapoff_enter)
 PPP_PROT_REG_CB(on_sys_mlock_enter)
+PPP_PROT_REG_CB(on_sys_shmget_enter)
 PPP_PROT_REG_CB(on_NtSaveKey_enter)
 PPP_PROT_REG_CB(on_NtAlpcConnectPort_enter)
 PPP_PROT_REG_CB(on_sys_oldumount_enter)
@@ -991,6 +1022,7 @@ PPP_PROT_REG_CB(on_NtOpenObjectAuditAlarm_enter)
 PPP_PROT_REG_CB(on_NtLockVirtualMemory_enter)
 PPP_PROT_REG_CB(on_sys_fstatat64_enter)
 PPP_PROT_REG_CB(on_sys_alarm_enter)
+PPP_PROT_REG_CB(on_sys_shmdt_enter)
 PPP_PROT_REG_CB(on_sys_unshare_enter)
 PPP_PROT_REG_CB(on_NtDeleteDriverEntry_enter)
 PPP_PROT_REG_CB(on_sys_times_enter)
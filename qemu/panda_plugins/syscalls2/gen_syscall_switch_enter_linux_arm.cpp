@@ -16,7 +16,9 @@ extern "C" {
 
 void syscall_enter_switch_linux_arm ( CPUState *env, target_ulong pc ) {  // osarch
 #ifdef TARGET_ARM                                          // GUARD
-    ReturnPoint rp;
+    // zeroed so a return callback registered after this enter sees 0s,
+    // not stack garbage, for args nobody asked us to save
+    ReturnPoint rp = {};
     rp.ordinal = env->regs[7];                        // CALLNO
     rp.proc_id = panda_current_asid(env);
     rp.retaddr = calc_retaddr(env, pc);
@@ -29,11 +31,13 @@ PPP_RUN_CB(on_sys_restart_syscall_enter, env,pc) ;
 }; break;
 // 1 long sys_exit ['int error_code']
 case 1: {
+if (PPP_CHECK_CB(on_sys_exit_enter) || PPP_CHECK_CB(on_sys_exit_return)) {
 int32_t arg0 = get_s32(env, 0);
 if (PPP_CHECK_CB(on_sys_exit_return)) {
 memcpy(rp.params[0], &arg0, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_exit_enter, env,pc,arg0) ; 
+}
 }; break;
 // 2 unsigned long fork ['void']
 case 2: {
@@ -43,6 +47,7 @@ PPP_RUN_CB(on_fork_enter, env,pc) ;
 }; break;
 // 3 long sys_read ['unsigned int fd', ' char __user *buf', ' size_t count']
 case 3: {
+if (PPP_CHECK_CB(on_sys_read_enter) || PPP_CHECK_CB(on_sys_read_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -52,9 +57,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_read_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 4 long sys_write ['unsigned int fd', ' const char __user *buf', 'size_t count']
 case 4: {
+if (PPP_CHECK_CB(on_sys_write_enter) || PPP_CHECK_CB(on_sys_write_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -64,9 +71,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_write_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 5 long sys_open ['const char __user *filename', 'int flags', ' int mode']
 case 5: {
+if (PPP_CHECK_CB(on_sys_open_enter) || PPP_CHECK_CB(on_sys_open_return)) {
 uint32_t arg0 = get_32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -76,17 +85,21 @@ memcpy(rp.params[1], &arg1, sizeof(int32_t));
 memcpy(rp.params[2], &arg2, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_open_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 6 long sys_close ['unsigned int fd']
 case 6: {
+if (PPP_CHECK_CB(on_sys_close_enter) || PPP_CHECK_CB(on_sys_close_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_close_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_close_enter, env,pc,arg0) ; 
+}
 }; break;
 // 8 long sys_creat ['const char __user *pathname', ' int mode']
 case 8: {
+if (PPP_CHECK_CB(on_sys_creat_enter) || PPP_CHECK_CB(on_sys_creat_return)) {
 uint32_t arg0 = get_32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 if (PPP_CHECK_CB(on_sys_creat_return)) {
@@ -94,9 +107,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_creat_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 9 long sys_link ['const char __user *oldname', 'const char __user *newname']
 case 9: {
+if (PPP_CHECK_CB(on_sys_link_enter) || PPP_CHECK_CB(on_sys_link_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_link_return)) {
@@ -104,17 +119,21 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_link_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 10 long sys_unlink ['const char __user *pathname']
 case 10: {
+if (PPP_CHECK_CB(on_sys_unlink_enter) || PPP_CHECK_CB(on_sys_unlink_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_unlink_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_unlink_enter, env,pc,arg0) ; 
+}
 }; break;
 // 11 unsigned long execve ['const char *filename', ' char *const argv[]', ' char *const envp[]']
 case 11: {
+if (PPP_CHECK_CB(on_execve_enter) || PPP_CHECK_CB(on_execve_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -124,17 +143,21 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_execve_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 12 long sys_chdir ['const char __user *filename']
 case 12: {
+if (PPP_CHECK_CB(on_sys_chdir_enter) || PPP_CHECK_CB(on_sys_chdir_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_chdir_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_chdir_enter, env,pc,arg0) ; 
+}
 }; break;
 // 14 long sys_mknod ['const char __user *filename', ' int mode', 'unsigned dev']
 case 14: {
+if (PPP_CHECK_CB(on_sys_mknod_enter) || PPP_CHECK_CB(on_sys_mknod_return)) {
 uint32_t arg0 = get_32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -144,9 +167,11 @@ memcpy(rp.params[1], &arg1, sizeof(int32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_mknod_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 15 long sys_chmod ['const char __user *filename', ' mode_t mode']
 case 15: {
+if (PPP_CHECK_CB(on_sys_chmod_enter) || PPP_CHECK_CB(on_sys_chmod_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_chmod_return)) {
@@ -154,9 +179,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_chmod_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 16 long sys_lchown16 ['const char __user *filename', 'old_uid_t user', ' old_gid_t group']
 case 16: {
+if (PPP_CHECK_CB(on_sys_lchown16_enter) || PPP_CHECK_CB(on_sys_lchown16_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -166,9 +193,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_lchown16_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 19 long sys_lseek ['unsigned int fd', ' off_t offset', 'unsigned int origin']
 case 19: {
+if (PPP_CHECK_CB(on_sys_lseek_enter) || PPP_CHECK_CB(on_sys_lseek_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -178,6 +207,7 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_lseek_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 20 long sys_getpid ['void']
 case 20: {
@@ -187,6 +217,7 @@ PPP_RUN_CB(on_sys_getpid_enter, env,pc) ;
 }; break;
 // 21 long sys_mount ['char __user *dev_name', ' char __user *dir_name', 'char __user *type', ' unsigned long flags', 'void __user *data']
 case 21: {
+if (PPP_CHECK_CB(on_sys_mount_enter) || PPP_CHECK_CB(on_sys_mount_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -200,14 +231,17 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_mount_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 23 long sys_setuid16 ['old_uid_t uid']
 case 23: {
+if (PPP_CHECK_CB(on_sys_setuid16_enter) || PPP_CHECK_CB(on_sys_setuid16_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_setuid16_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_setuid16_enter, env,pc,arg0) ; 
+}
 }; break;
 // 24 long sys_getuid16 ['void']
 case 24: {
@@ -217,6 +251,7 @@ PPP_RUN_CB(on_sys_getuid16_enter, env,pc) ;
 }; break;
 // 26 long sys_ptrace ['long request', ' long pid', ' long addr', ' long data']
 case 26: {
+if (PPP_CHECK_CB(on_sys_ptrace_enter) || PPP_CHECK_CB(on_sys_ptrace_return)) {
 int32_t arg0 = get_s32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -228,6 +263,7 @@ memcpy(rp.params[2], &arg2, sizeof(int32_t));
 memcpy(rp.params[3], &arg3, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_ptrace_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 29 long sys_pause ['void']
 case 29: {
@@ -237,6 +273,7 @@ PPP_RUN_CB(on_sys_pause_enter, env,pc) ;
 }; break;
 // 33 long sys_access ['const char __user *filename', ' int mode']
 case 33: {
+if (PPP_CHECK_CB(on_sys_access_enter) || PPP_CHECK_CB(on_sys_access_return)) {
 uint32_t arg0 = get_32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 if (PPP_CHECK_CB(on_sys_access_return)) {
@@ -244,14 +281,17 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_access_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 34 long sys_nice ['int increment']
 case 34: {
+if (PPP_CHECK_CB(on_sys_nice_enter) || PPP_CHECK_CB(on_sys_nice_return)) {
 int32_t arg0 = get_s32(env, 0);
 if (PPP_CHECK_CB(on_sys_nice_return)) {
 memcpy(rp.params[0], &arg0, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_nice_enter, env,pc,arg0) ; 
+}
 }; break;
 // 36 long sys_sync ['void']
 case 36: {
@@ -261,6 +301,7 @@ PPP_RUN_CB(on_sys_sync_enter, env,pc) ;
 }; break;
 // 37 long sys_kill ['int pid', ' int sig']
 case 37: {
+if (PPP_CHECK_CB(on_sys_kill_enter) || PPP_CHECK_CB(on_sys_kill_return)) {
 int32_t arg0 = get_s32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 if (PPP_CHECK_CB(on_sys_kill_return)) {
@@ -268,9 +309,11 @@ memcpy(rp.params[0], &arg0, sizeof(int32_t));
 memcpy(rp.params[1], &arg1, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_kill_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 38 long sys_rename ['const char __user *oldname', 'const char __user *newname']
 case 38: {
+if (PPP_CHECK_CB(on_sys_rename_enter) || PPP_CHECK_CB(on_sys_rename_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_rename_return)) {
@@ -278,9 +321,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_rename_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 39 long sys_mkdir ['const char __user *pathname', ' int mode']
 case 39: {
+if (PPP_CHECK_CB(on_sys_mkdir_enter) || PPP_CHECK_CB(on_sys_mkdir_return)) {
 uint32_t arg0 = get_32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 if (PPP_CHECK_CB(on_sys_mkdir_return)) {
@@ -288,54 +333,67 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_mkdir_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 40 long sys_rmdir ['const char __user *pathname']
 case 40: {
+if (PPP_CHECK_CB(on_sys_rmdir_enter) || PPP_CHECK_CB(on_sys_rmdir_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_rmdir_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_rmdir_enter, env,pc,arg0) ; 
+}
 }; break;
 // 41 long sys_dup ['unsigned int fildes']
 case 41: {
+if (PPP_CHECK_CB(on_sys_dup_enter) || PPP_CHECK_CB(on_sys_dup_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_dup_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_dup_enter, env,pc,arg0) ; 
+}
 }; break;
 // 42 long sys_pipe ['int __user *']
 case 42: {
+if (PPP_CHECK_CB(on_sys_pipe_enter) || PPP_CHECK_CB(on_sys_pipe_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_pipe_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_pipe_enter, env,pc,arg0) ; 
+}
 }; break;
 // 43 long sys_times ['struct tms __user *tbuf']
 case 43: {
+if (PPP_CHECK_CB(on_sys_times_enter) || PPP_CHECK_CB(on_sys_times_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_times_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_times_enter, env,pc,arg0) ; 
+}
 }; break;
 // 45 long sys_brk ['unsigned long brk']
 case 45: {
+if (PPP_CHECK_CB(on_sys_brk_enter) || PPP_CHECK_CB(on_sys_brk_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_brk_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_brk_enter, env,pc,arg0) ; 
+}
 }; break;
 // 46 long sys_setgid16 ['old_gid_t gid']
 case 46: {
+if (PPP_CHECK_CB(on_sys_setgid16_enter) || PPP_CHECK_CB(on_sys_setgid16_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_setgid16_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_setgid16_enter, env,pc,arg0) ; 
+}
 }; break;
 // 47 long sys_getgid16 ['void']
 case 47: {
@@ -357,14 +415,17 @@ PPP_RUN_CB(on_sys_getegid16_enter, env,pc) ;
 }; break;
 // 51 long sys_acct ['const char __user *name']
 case 51: {
+if (PPP_CHECK_CB(on_sys_acct_enter) || PPP_CHECK_CB(on_sys_acct_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_acct_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_acct_enter, env,pc,arg0) ; 
+}
 }; break;
 // 52 long sys_umount ['char __user *name', ' int flags']
 case 52: {
+if (PPP_CHECK_CB(on_sys_umount_enter) || PPP_CHECK_CB(on_sys_umount_return)) {
 uint32_t arg0 = get_32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 if (PPP_CHECK_CB(on_sys_umount_return)) {
@@ -372,9 +433,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_umount_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 54 long sys_ioctl ['unsigned int fd', ' unsigned int cmd', 'unsigned long arg']
 case 54: {
+if (PPP_CHECK_CB(on_sys_ioctl_enter) || PPP_CHECK_CB(on_sys_ioctl_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -384,9 +447,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_ioctl_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 55 long sys_fcntl ['unsigned int fd', ' unsigned int cmd', ' unsigned long arg']
 case 55: {
+if (PPP_CHECK_CB(on_sys_fcntl_enter) || PPP_CHECK_CB(on_sys_fcntl_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -396,9 +461,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_fcntl_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 57 long sys_setpgid ['pid_t pid', ' pid_t pgid']
 case 57: {
+if (PPP_CHECK_CB(on_sys_setpgid_enter) || PPP_CHECK_CB(on_sys_setpgid_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_setpgid_return)) {
@@ -406,25 +473,31 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_setpgid_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 60 long sys_umask ['int mask']
 case 60: {
+if (PPP_CHECK_CB(on_sys_umask_enter) || PPP_CHECK_CB(on_sys_umask_return)) {
 int32_t arg0 = get_s32(env, 0);
 if (PPP_CHECK_CB(on_sys_umask_return)) {
 memcpy(rp.params[0], &arg0, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_umask_enter, env,pc,arg0) ; 
+}
 }; break;
 // 61 long sys_chroot ['const char __user *filename']
 case 61: {
+if (PPP_CHECK_CB(on_sys_chroot_enter) || PPP_CHECK_CB(on_sys_chroot_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_chroot_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_chroot_enter, env,pc,arg0) ; 
+}
 }; break;
 // 62 long sys_ustat ['unsigned dev', ' struct ustat __user *ubuf']
 case 62: {
+if (PPP_CHECK_CB(on_sys_ustat_enter) || PPP_CHECK_CB(on_sys_ustat_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_ustat_return)) {
@@ -432,9 +505,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_ustat_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 63 long sys_dup2 ['unsigned int oldfd', ' unsigned int newfd']
 case 63: {
+if (PPP_CHECK_CB(on_sys_dup2_enter) || PPP_CHECK_CB(on_sys_dup2_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_dup2_return)) {
@@ -442,6 +517,7 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_dup2_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 64 long sys_getppid ['void']
 case 64: {
@@ -463,6 +539,7 @@ PPP_RUN_CB(on_sys_setsid_enter, env,pc) ;
 }; break;
 // 67 int sigaction ['int sig', ' const struct old_sigaction __user *act', ' struct old_sigaction __user *oact']
 case 67: {
+if (PPP_CHECK_CB(on_sigaction_enter) || PPP_CHECK_CB(on_sigaction_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -472,9 +549,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sigaction_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 70 long sys_setreuid16 ['old_uid_t ruid', ' old_uid_t euid']
 case 70: {
+if (PPP_CHECK_CB(on_sys_setreuid16_enter) || PPP_CHECK_CB(on_sys_setreuid16_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_setreuid16_return)) {
@@ -482,9 +561,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_setreuid16_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 71 long sys_setregid16 ['old_gid_t rgid', ' old_gid_t egid']
 case 71: {
+if (PPP_CHECK_CB(on_sys_setregid16_enter) || PPP_CHECK_CB(on_sys_setregid16_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_setregid16_return)) {
@@ -492,9 +573,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_setregid16_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 72 long sigsuspend ['int restart', ' unsigned long oldmask', ' old_sigset_t mask']
 case 72: {
+if (PPP_CHECK_CB(on_sigsuspend_enter) || PPP_CHECK_CB(on_sigsuspend_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -504,17 +587,21 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sigsuspend_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 73 long sys_sigpending ['old_sigset_t __user *set']
 case 73: {
+if (PPP_CHECK_CB(on_sys_sigpending_enter) || PPP_CHECK_CB(on_sys_sigpending_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_sigpending_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_sigpending_enter, env,pc,arg0) ; 
+}
 }; break;
 // 74 long sys_sethostname ['char __user *name', ' int len']
 case 74: {
+if (PPP_CHECK_CB(on_sys_sethostname_enter) || PPP_CHECK_CB(on_sys_sethostname_return)) {
 uint32_t arg0 = get_32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 if (PPP_CHECK_CB(on_sys_sethostname_return)) {
@@ -522,9 +609,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_sethostname_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 75 long sys_setrlimit ['unsigned int resource', 'struct rlimit __user *rlim']
 case 75: {
+if (PPP_CHECK_CB(on_sys_setrlimit_enter) || PPP_CHECK_CB(on_sys_setrlimit_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_setrlimit_return)) {
@@ -532,9 +621,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_setrlimit_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 77 long sys_getrusage ['int who', ' struct rusage __user *ru']
 case 77: {
+if (PPP_CHECK_CB(on_sys_getrusage_enter) || PPP_CHECK_CB(on_sys_getrusage_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_getrusage_return)) {
@@ -542,9 +633,11 @@ memcpy(rp.params[0], &arg0, sizeof(int32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_getrusage_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 78 long sys_gettimeofday ['struct timeval __user *tv', 'struct timezone __user *tz']
 case 78: {
+if (PPP_CHECK_CB(on_sys_gettimeofday_enter) || PPP_CHECK_CB(on_sys_gettimeofday_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_gettimeofday_return)) {
@@ -552,9 +645,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_gettimeofday_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 79 long sys_settimeofday ['struct timeval __user *tv', 'struct timezone __user *tz']
 case 79: {
+if (PPP_CHECK_CB(on_sys_settimeofday_enter) || PPP_CHECK_CB(on_sys_settimeofday_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_settimeofday_return)) {
@@ -562,9 +657,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_settimeofday_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 80 long sys_getgroups16 ['int gidsetsize', ' old_gid_t __user *grouplist']
 case 80: {
+if (PPP_CHECK_CB(on_sys_getgroups16_enter) || PPP_CHECK_CB(on_sys_getgroups16_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_getgroups16_return)) {
@@ -572,9 +669,11 @@ memcpy(rp.params[0], &arg0, sizeof(int32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_getgroups16_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 81 long sys_setgroups16 ['int gidsetsize', ' old_gid_t __user *grouplist']
 case 81: {
+if (PPP_CHECK_CB(on_sys_setgroups16_enter) || PPP_CHECK_CB(on_sys_setgroups16_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_setgroups16_return)) {
@@ -582,9 +681,11 @@ memcpy(rp.params[0], &arg0, sizeof(int32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_setgroups16_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 83 long sys_symlink ['const char __user *old', ' const char __user *new']
 case 83: {
+if (PPP_CHECK_CB(on_sys_symlink_enter) || PPP_CHECK_CB(on_sys_symlink_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_symlink_return)) {
@@ -592,9 +693,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_symlink_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 85 long sys_readlink ['const char __user *path', 'char __user *buf', ' int bufsiz']
 case 85: {
+if (PPP_CHECK_CB(on_sys_readlink_enter) || PPP_CHECK_CB(on_sys_readlink_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -604,17 +707,21 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_readlink_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 86 long sys_uselib ['const char __user *library']
 case 86: {
+if (PPP_CHECK_CB(on_sys_uselib_enter) || PPP_CHECK_CB(on_sys_uselib_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_uselib_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_uselib_enter, env,pc,arg0) ; 
+}
 }; break;
 // 87 long sys_swapon ['const char __user *specialfile', ' int swap_flags']
 case 87: {
+if (PPP_CHECK_CB(on_sys_swapon_enter) || PPP_CHECK_CB(on_sys_swapon_return)) {
 uint32_t arg0 = get_32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 if (PPP_CHECK_CB(on_sys_swapon_return)) {
@@ -622,9 +729,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_swapon_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 88 long sys_reboot ['int magic1', ' int magic2', ' unsigned int cmd', 'void __user *arg']
 case 88: {
+if (PPP_CHECK_CB(on_sys_reboot_enter) || PPP_CHECK_CB(on_sys_reboot_return)) {
 int32_t arg0 = get_s32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -636,9 +745,11 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_reboot_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 91 long sys_munmap ['unsigned long addr', ' size_t len']
 case 91: {
+if (PPP_CHECK_CB(on_sys_munmap_enter) || PPP_CHECK_CB(on_sys_munmap_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_munmap_return)) {
@@ -646,9 +757,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_munmap_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 92 long sys_truncate ['const char __user *path', 'unsigned long length']
 case 92: {
+if (PPP_CHECK_CB(on_sys_truncate_enter) || PPP_CHECK_CB(on_sys_truncate_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_truncate_return)) {
@@ -656,9 +769,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_truncate_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 93 long sys_ftruncate ['unsigned int fd', ' unsigned long length']
 case 93: {
+if (PPP_CHECK_CB(on_sys_ftruncate_enter) || PPP_CHECK_CB(on_sys_ftruncate_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_ftruncate_return)) {
@@ -666,9 +781,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_ftruncate_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 94 long sys_fchmod ['unsigned int fd', ' mode_t mode']
 case 94: {
+if (PPP_CHECK_CB(on_sys_fchmod_enter) || PPP_CHECK_CB(on_sys_fchmod_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_fchmod_return)) {
@@ -676,9 +793,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_fchmod_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 95 long sys_fchown16 ['unsigned int fd', ' old_uid_t user', ' old_gid_t group']
 case 95: {
+if (PPP_CHECK_CB(on_sys_fchown16_enter) || PPP_CHECK_CB(on_sys_fchown16_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -688,9 +807,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_fchown16_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 96 long sys_getpriority ['int which', ' int who']
 case 96: {
+if (PPP_CHECK_CB(on_sys_getpriority_enter) || PPP_CHECK_CB(on_sys_getpriority_return)) {
 int32_t arg0 = get_s32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 if (PPP_CHECK_CB(on_sys_getpriority_return)) {
@@ -698,9 +819,11 @@ memcpy(rp.params[0], &arg0, sizeof(int32_t));
 memcpy(rp.params[1], &arg1, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_getpriority_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 97 long sys_setpriority ['int which', ' int who', ' int niceval']
 case 97: {
+if (PPP_CHECK_CB(on_sys_setpriority_enter) || PPP_CHECK_CB(on_sys_setpriority_return)) {
 int32_t arg0 = get_s32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -710,9 +833,11 @@ memcpy(rp.params[1], &arg1, sizeof(int32_t));
 memcpy(rp.params[2], &arg2, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_setpriority_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 99 long sys_statfs ['const char __user * path', 'struct statfs __user *buf']
 case 99: {
+if (PPP_CHECK_CB(on_sys_statfs_enter) || PPP_CHECK_CB(on_sys_statfs_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_statfs_return)) {
@@ -720,9 +845,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_statfs_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 100 long sys_fstatfs ['unsigned int fd', ' struct statfs __user *buf']
 case 100: {
+if (PPP_CHECK_CB(on_sys_fstatfs_enter) || PPP_CHECK_CB(on_sys_fstatfs_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_fstatfs_return)) {
@@ -730,9 +857,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_fstatfs_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 103 long sys_syslog ['int type', ' char __user *buf', ' int len']
 case 103: {
+if (PPP_CHECK_CB(on_sys_syslog_enter) || PPP_CHECK_CB(on_sys_syslog_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -742,9 +871,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_syslog_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 104 long sys_setitimer ['int which', 'struct itimerval __user *value', 'struct itimerval __user *ovalue']
 case 104: {
+if (PPP_CHECK_CB(on_sys_setitimer_enter) || PPP_CHECK_CB(on_sys_setitimer_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -754,9 +885,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_setitimer_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 105 long sys_getitimer ['int which', ' struct itimerval __user *value']
 case 105: {
+if (PPP_CHECK_CB(on_sys_getitimer_enter) || PPP_CHECK_CB(on_sys_getitimer_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_getitimer_return)) {
@@ -764,9 +897,11 @@ memcpy(rp.params[0], &arg0, sizeof(int32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_getitimer_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 106 long sys_newstat ['char __user *filename', 'struct stat __user *statbuf']
 case 106: {
+if (PPP_CHECK_CB(on_sys_newstat_enter) || PPP_CHECK_CB(on_sys_newstat_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_newstat_return)) {
@@ -774,9 +909,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_newstat_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 107 long sys_newlstat ['char __user *filename', 'struct stat __user *statbuf']
 case 107: {
+if (PPP_CHECK_CB(on_sys_newlstat_enter) || PPP_CHECK_CB(on_sys_newlstat_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_newlstat_return)) {
@@ -784,9 +921,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_newlstat_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 108 long sys_newfstat ['unsigned int fd', ' struct stat __user *statbuf']
 case 108: {
+if (PPP_CHECK_CB(on_sys_newfstat_enter) || PPP_CHECK_CB(on_sys_newfstat_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_newfstat_return)) {
@@ -794,6 +933,7 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_newfstat_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 111 long sys_vhangup ['void']
 case 111: {
@@ -803,6 +943,7 @@ PPP_RUN_CB(on_sys_vhangup_enter, env,pc) ;
 }; break;
 // 114 long sys_wait4 ['pid_t pid', ' int __user *stat_addr', 'int options', ' struct rusage __user *ru']
 case 114: {
+if (PPP_CHECK_CB(on_sys_wait4_enter) || PPP_CHECK_CB(on_sys_wait4_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -814,30 +955,37 @@ memcpy(rp.params[2], &arg2, sizeof(int32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_wait4_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 115 long sys_swapoff ['const char __user *specialfile']
 case 115: {
+if (PPP_CHECK_CB(on_sys_swapoff_enter) || PPP_CHECK_CB(on_sys_swapoff_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_swapoff_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_swapoff_enter, env,pc,arg0) ; 
+}
 }; break;
 // 116 long sys_sysinfo ['struct sysinfo __user *info']
 case 116: {
+if (PPP_CHECK_CB(on_sys_sysinfo_enter) || PPP_CHECK_CB(on_sys_sysinfo_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_sysinfo_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_sysinfo_enter, env,pc,arg0) ; 
+}
 }; break;
 // 118 long sys_fsync ['unsigned int fd']
 case 118: {
+if (PPP_CHECK_CB(on_sys_fsync_enter) || PPP_CHECK_CB(on_sys_fsync_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_fsync_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_fsync_enter, env,pc,arg0) ; 
+}
 }; break;
 // 119 int sigreturn ['void']
 case 119: {
@@ -847,6 +995,7 @@ PPP_RUN_CB(on_sigreturn_enter, env,pc) ;
 }; break;
 // 120 unsigned long clone ['unsigned long clone_flags', ' unsigned long newsp', ' int __user *parent_tidptr', ' int tls_val', ' int __user *child_tidptr', ' struct pt_regs *regs']
 case 120: {
+if (PPP_CHECK_CB(on_clone_enter) || PPP_CHECK_CB(on_clone_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -862,9 +1011,11 @@ memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_clone_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 121 long sys_setdomainname ['char __user *name', ' int len']
 case 121: {
+if (PPP_CHECK_CB(on_sys_setdomainname_enter) || PPP_CHECK_CB(on_sys_setdomainname_return)) {
 uint32_t arg0 = get_32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 if (PPP_CHECK_CB(on_sys_setdomainname_return)) {
@@ -872,25 +1023,31 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_setdomainname_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 122 long sys_newuname ['struct new_utsname __user *name']
 case 122: {
+if (PPP_CHECK_CB(on_sys_newuname_enter) || PPP_CHECK_CB(on_sys_newuname_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_newuname_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_newuname_enter, env,pc,arg0) ; 
+}
 }; break;
 // 124 long sys_adjtimex ['struct timex __user *txc_p']
 case 124: {
+if (PPP_CHECK_CB(on_sys_adjtimex_enter) || PPP_CHECK_CB(on_sys_adjtimex_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_adjtimex_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_adjtimex_enter, env,pc,arg0) ; 
+}
 }; break;
 // 125 long sys_mprotect ['unsigned long start', ' size_t len', 'unsigned long prot']
 case 125: {
+if (PPP_CHECK_CB(on_sys_mprotect_enter) || PPP_CHECK_CB(on_sys_mprotect_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -900,9 +1057,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_mprotect_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 126 long sys_sigprocmask ['int how', ' old_sigset_t __user *set', 'old_sigset_t __user *oset']
 case 126: {
+if (PPP_CHECK_CB(on_sys_sigprocmask_enter) || PPP_CHECK_CB(on_sys_sigprocmask_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -912,9 +1071,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_sigprocmask_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 128 long sys_init_module ['void __user *umod', ' unsigned long len', 'const char __user *uargs']
 case 128: {
+if (PPP_CHECK_CB(on_sys_init_module_enter) || PPP_CHECK_CB(on_sys_init_module_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -924,9 +1085,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_init_module_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 129 long sys_delete_module ['const char __user *name_user', 'unsigned int flags']
 case 129: {
+if (PPP_CHECK_CB(on_sys_delete_module_enter) || PPP_CHECK_CB(on_sys_delete_module_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_delete_module_return)) {
@@ -934,9 +1097,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_delete_module_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 131 long sys_quotactl ['unsigned int cmd', ' const char __user *special', 'qid_t id', ' void __user *addr']
 case 131: {
+if (PPP_CHECK_CB(on_sys_quotactl_enter) || PPP_CHECK_CB(on_sys_quotactl_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -948,25 +1113,31 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_quotactl_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 132 long sys_getpgid ['pid_t pid']
 case 132: {
+if (PPP_CHECK_CB(on_sys_getpgid_enter) || PPP_CHECK_CB(on_sys_getpgid_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_getpgid_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_getpgid_enter, env,pc,arg0) ; 
+}
 }; break;
 // 133 long sys_fchdir ['unsigned int fd']
 case 133: {
+if (PPP_CHECK_CB(on_sys_fchdir_enter) || PPP_CHECK_CB(on_sys_fchdir_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_fchdir_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_fchdir_enter, env,pc,arg0) ; 
+}
 }; break;
 // 134 long sys_bdflush ['int func', ' long data']
 case 134: {
+if (PPP_CHECK_CB(on_sys_bdflush_enter) || PPP_CHECK_CB(on_sys_bdflush_return)) {
 int32_t arg0 = get_s32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 if (PPP_CHECK_CB(on_sys_bdflush_return)) {
@@ -974,9 +1145,11 @@ memcpy(rp.params[0], &arg0, sizeof(int32_t));
 memcpy(rp.params[1], &arg1, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_bdflush_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 135 long sys_sysfs ['int option', 'unsigned long arg1', ' unsigned long arg2']
 case 135: {
+if (PPP_CHECK_CB(on_sys_sysfs_enter) || PPP_CHECK_CB(on_sys_sysfs_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -986,33 +1159,41 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_sysfs_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 136 long sys_personality ['u_long personality']
 case 136: {
+if (PPP_CHECK_CB(on_sys_personality_enter) || PPP_CHECK_CB(on_sys_personality_return)) {
 int32_t arg0 = get_s32(env, 0);
 if (PPP_CHECK_CB(on_sys_personality_return)) {
 memcpy(rp.params[0], &arg0, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_personality_enter, env,pc,arg0) ; 
+}
 }; break;
 // 138 long sys_setfsuid16 ['old_uid_t uid']
 case 138: {
+if (PPP_CHECK_CB(on_sys_setfsuid16_enter) || PPP_CHECK_CB(on_sys_setfsuid16_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_setfsuid16_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_setfsuid16_enter, env,pc,arg0) ; 
+}
 }; break;
 // 139 long sys_setfsgid16 ['old_gid_t gid']
 case 139: {
+if (PPP_CHECK_CB(on_sys_setfsgid16_enter) || PPP_CHECK_CB(on_sys_setfsgid16_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_setfsgid16_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_setfsgid16_enter, env,pc,arg0) ; 
+}
 }; break;
 // 140 long sys_llseek ['unsigned int fd', ' unsigned long offset_high', 'unsigned long offset_low', ' loff_t __user *result', 'unsigned int origin']
 case 140: {
+if (PPP_CHECK_CB(on_sys_llseek_enter) || PPP_CHECK_CB(on_sys_llseek_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1026,9 +1207,11 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_llseek_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 141 long sys_getdents ['unsigned int fd', 'struct linux_dirent __user *dirent', 'unsigned int count']
 case 141: {
+if (PPP_CHECK_CB(on_sys_getdents_enter) || PPP_CHECK_CB(on_sys_getdents_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1038,9 +1221,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_getdents_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 142 long sys_select ['int n', ' fd_set __user *inp', ' fd_set __user *outp', 'fd_set __user *exp', ' struct timeval __user *tvp']
 case 142: {
+if (PPP_CHECK_CB(on_sys_select_enter) || PPP_CHECK_CB(on_sys_select_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1054,9 +1239,11 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_select_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 143 long sys_flock ['unsigned int fd', ' unsigned int cmd']
 case 143: {
+if (PPP_CHECK_CB(on_sys_flock_enter) || PPP_CHECK_CB(on_sys_flock_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_flock_return)) {
@@ -1064,9 +1251,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_flock_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 144 long sys_msync ['unsigned long start', ' size_t len', ' int flags']
 case 144: {
+if (PPP_CHECK_CB(on_sys_msync_enter) || PPP_CHECK_CB(on_sys_msync_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -1076,9 +1265,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_msync_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 145 long sys_readv ['unsigned long fd', 'const struct iovec __user *vec', 'unsigned long vlen']
 case 145: {
+if (PPP_CHECK_CB(on_sys_readv_enter) || PPP_CHECK_CB(on_sys_readv_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1088,9 +1279,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_readv_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 146 long sys_writev ['unsigned long fd', 'const struct iovec __user *vec', 'unsigned long vlen']
 case 146: {
+if (PPP_CHECK_CB(on_sys_writev_enter) || PPP_CHECK_CB(on_sys_writev_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1100,33 +1293,41 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_writev_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 147 long sys_getsid ['pid_t pid']
 case 147: {
+if (PPP_CHECK_CB(on_sys_getsid_enter) || PPP_CHECK_CB(on_sys_getsid_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_getsid_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_getsid_enter, env,pc,arg0) ; 
+}
 }; break;
 // 148 long sys_fdatasync ['unsigned int fd']
 case 148: {
+if (PPP_CHECK_CB(on_sys_fdatasync_enter) || PPP_CHECK_CB(on_sys_fdatasync_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_fdatasync_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_fdatasync_enter, env,pc,arg0) ; 
+}
 }; break;
 // 149 long sys_sysctl ['struct __sysctl_args __user *args']
 case 149: {
+if (PPP_CHECK_CB(on_sys_sysctl_enter) || PPP_CHECK_CB(on_sys_sysctl_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_sysctl_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_sysctl_enter, env,pc,arg0) ; 
+}
 }; break;
 // 150 long sys_mlock ['unsigned long start', ' size_t len']
 case 150: {
+if (PPP_CHECK_CB(on_sys_mlock_enter) || PPP_CHECK_CB(on_sys_mlock_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_mlock_return)) {
@@ -1134,9 +1335,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_mlock_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 151 long sys_munlock ['unsigned long start', ' size_t len']
 case 151: {
+if (PPP_CHECK_CB(on_sys_munlock_enter) || PPP_CHECK_CB(on_sys_munlock_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_munlock_return)) {
@@ -1144,14 +1347,17 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_munlock_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 152 long sys_mlockall ['int flags']
 case 152: {
+if (PPP_CHECK_CB(on_sys_mlockall_enter) || PPP_CHECK_CB(on_sys_mlockall_return)) {
 int32_t arg0 = get_s32(env, 0);
 if (PPP_CHECK_CB(on_sys_mlockall_return)) {
 memcpy(rp.params[0], &arg0, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_mlockall_enter, env,pc,arg0) ; 
+}
 }; break;
 // 153 long sys_munlockall ['void']
 case 153: {
@@ -1161,6 +1367,7 @@ PPP_RUN_CB(on_sys_munlockall_enter, env,pc) ;
 }; break;
 // 154 long sys_sched_setparam ['pid_t pid', 'struct sched_param __user *param']
 case 154: {
+if (PPP_CHECK_CB(on_sys_sched_setparam_enter) || PPP_CHECK_CB(on_sys_sched_setparam_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_sched_setparam_return)) {
@@ -1168,9 +1375,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_sched_setparam_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 155 long sys_sched_getparam ['pid_t pid', 'struct sched_param __user *param']
 case 155: {
+if (PPP_CHECK_CB(on_sys_sched_getparam_enter) || PPP_CHECK_CB(on_sys_sched_getparam_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_sched_getparam_return)) {
@@ -1178,9 +1387,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_sched_getparam_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 156 long sys_sched_setscheduler ['pid_t pid', ' int policy', 'struct sched_param __user *param']
 case 156: {
+if (PPP_CHECK_CB(on_sys_sched_setscheduler_enter) || PPP_CHECK_CB(on_sys_sched_setscheduler_return)) {
 uint32_t arg0 = get_32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1190,14 +1401,17 @@ memcpy(rp.params[1], &arg1, sizeof(int32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_sched_setscheduler_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 157 long sys_sched_getscheduler ['pid_t pid']
 case 157: {
+if (PPP_CHECK_CB(on_sys_sched_getscheduler_enter) || PPP_CHECK_CB(on_sys_sched_getscheduler_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_sched_getscheduler_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_sched_getscheduler_enter, env,pc,arg0) ; 
+}
 }; break;
 // 158 long sys_sched_yield ['void']
 case 158: {
@@ -1207,22 +1421,27 @@ PPP_RUN_CB(on_sys_sched_yield_enter, env,pc) ;
 }; break;
 // 159 long sys_sched_get_priority_max ['int policy']
 case 159: {
+if (PPP_CHECK_CB(on_sys_sched_get_priority_max_enter) || PPP_CHECK_CB(on_sys_sched_get_priority_max_return)) {
 int32_t arg0 = get_s32(env, 0);
 if (PPP_CHECK_CB(on_sys_sched_get_priority_max_return)) {
 memcpy(rp.params[0], &arg0, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_sched_get_priority_max_enter, env,pc,arg0) ; 
+}
 }; break;
 // 160 long sys_sched_get_priority_min ['int policy']
 case 160: {
+if (PPP_CHECK_CB(on_sys_sched_get_priority_min_enter) || PPP_CHECK_CB(on_sys_sched_get_priority_min_return)) {
 int32_t arg0 = get_s32(env, 0);
 if (PPP_CHECK_CB(on_sys_sched_get_priority_min_return)) {
 memcpy(rp.params[0], &arg0, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_sched_get_priority_min_enter, env,pc,arg0) ; 
+}
 }; break;
 // 161 long sys_sched_rr_get_interval ['pid_t pid', 'struct timespec __user *interval']
 case 161: {
+if (PPP_CHECK_CB(on_sys_sched_rr_get_interval_enter) || PPP_CHECK_CB(on_sys_sched_rr_get_interval_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_sched_rr_get_interval_return)) {
@@ -1230,9 +1449,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_sched_rr_get_interval_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 162 long sys_nanosleep ['struct timespec __user *rqtp', ' struct timespec __user *rmtp']
 case 162: {
+if (PPP_CHECK_CB(on_sys_nanosleep_enter) || PPP_CHECK_CB(on_sys_nanosleep_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_nanosleep_return)) {
@@ -1240,9 +1461,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_nanosleep_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 163 unsigned long arm_mremap ['unsigned long addr', ' unsigned long old_len', ' unsigned long new_len', ' unsigned long flags', ' unsigned long new_addr']
 case 163: {
+if (PPP_CHECK_CB(on_arm_mremap_enter) || PPP_CHECK_CB(on_arm_mremap_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1256,9 +1479,11 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_arm_mremap_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 164 long sys_setresuid16 ['old_uid_t ruid', ' old_uid_t euid', ' old_uid_t suid']
 case 164: {
+if (PPP_CHECK_CB(on_sys_setresuid16_enter) || PPP_CHECK_CB(on_sys_setresuid16_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1268,9 +1493,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_setresuid16_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 165 long sys_getresuid16 ['old_uid_t __user *ruid', 'old_uid_t __user *euid', ' old_uid_t __user *suid']
 case 165: {
+if (PPP_CHECK_CB(on_sys_getresuid16_enter) || PPP_CHECK_CB(on_sys_getresuid16_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1280,9 +1507,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_getresuid16_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 168 long sys_poll ['struct pollfd __user *ufds', ' unsigned int nfds', 'long timeout']
 case 168: {
+if (PPP_CHECK_CB(on_sys_poll_enter) || PPP_CHECK_CB(on_sys_poll_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -1292,9 +1521,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_poll_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 169 long sys_nfsservctl ['int cmd', 'struct nfsctl_arg __user *arg', 'void __user *res']
 case 169: {
+if (PPP_CHECK_CB(on_sys_nfsservctl_enter) || PPP_CHECK_CB(on_sys_nfsservctl_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1304,9 +1535,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_nfsservctl_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 170 long sys_setresgid16 ['old_gid_t rgid', ' old_gid_t egid', ' old_gid_t sgid']
 case 170: {
+if (PPP_CHECK_CB(on_sys_setresgid16_enter) || PPP_CHECK_CB(on_sys_setresgid16_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1316,9 +1549,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_setresgid16_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 171 long sys_getresgid16 ['old_gid_t __user *rgid', 'old_gid_t __user *egid', ' old_gid_t __user *sgid']
 case 171: {
+if (PPP_CHECK_CB(on_sys_getresgid16_enter) || PPP_CHECK_CB(on_sys_getresgid16_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1328,9 +1563,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_getresgid16_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 172 long sys_prctl ['int option', ' unsigned long arg2', ' unsigned long arg3', 'unsigned long arg4', ' unsigned long arg5']
 case 172: {
+if (PPP_CHECK_CB(on_sys_prctl_enter) || PPP_CHECK_CB(on_sys_prctl_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1344,6 +1581,7 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_prctl_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 173 int sigreturn ['void']
 case 173: {
@@ -1353,6 +1591,7 @@ PPP_RUN_CB(on_sigreturn_enter, env,pc) ;
 }; break;
 // 174 long rt_sigaction ['int sig', ' const struct sigaction __user * act', ' struct sigaction __user * oact', '  size_t sigsetsize']
 case 174: {
+if (PPP_CHECK_CB(on_rt_sigaction_enter) || PPP_CHECK_CB(on_rt_sigaction_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1364,9 +1603,11 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_rt_sigaction_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 175 long sys_rt_sigprocmask ['int how', ' sigset_t __user *set', 'sigset_t __user *oset', ' size_t sigsetsize']
 case 175: {
+if (PPP_CHECK_CB(on_sys_rt_sigprocmask_enter) || PPP_CHECK_CB(on_sys_rt_sigprocmask_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1378,9 +1619,11 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_rt_sigprocmask_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 176 long sys_rt_sigpending ['sigset_t __user *set', ' size_t sigsetsize']
 case 176: {
+if (PPP_CHECK_CB(on_sys_rt_sigpending_enter) || PPP_CHECK_CB(on_sys_rt_sigpending_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_rt_sigpending_return)) {
@@ -1388,9 +1631,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_rt_sigpending_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 177 long sys_rt_sigtimedwait ['const sigset_t __user *uthese', 'siginfo_t __user *uinfo', 'const struct timespec __user *uts', 'size_t sigsetsize']
 case 177: {
+if (PPP_CHECK_CB(on_sys_rt_sigtimedwait_enter) || PPP_CHECK_CB(on_sys_rt_sigtimedwait_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1402,9 +1647,11 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_rt_sigtimedwait_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 178 long sys_rt_sigqueueinfo ['int pid', ' int sig', ' siginfo_t __user *uinfo']
 case 178: {
+if (PPP_CHECK_CB(on_sys_rt_sigqueueinfo_enter) || PPP_CHECK_CB(on_sys_rt_sigqueueinfo_return)) {
 int32_t arg0 = get_s32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1414,9 +1661,11 @@ memcpy(rp.params[1], &arg1, sizeof(int32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_rt_sigqueueinfo_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 179 int sys_rt_sigsuspend ['sigset_t __user *unewset', ' size_t sigsetsize']
 case 179: {
+if (PPP_CHECK_CB(on_sys_rt_sigsuspend_enter) || PPP_CHECK_CB(on_sys_rt_sigsuspend_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_rt_sigsuspend_return)) {
@@ -1424,9 +1673,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_rt_sigsuspend_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 180 long sys_pread64 ['unsigned int fd', ' char __user *buf', 'size_t count', ' loff_t pos']
 case 180: {
+if (PPP_CHECK_CB(on_sys_pread64_enter) || PPP_CHECK_CB(on_sys_pread64_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1438,9 +1689,11 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint64_t));
 }
 PPP_RUN_CB(on_sys_pread64_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 181 long sys_pwrite64 ['unsigned int fd', ' const char __user *buf', 'size_t count', ' loff_t pos']
 case 181: {
+if (PPP_CHECK_CB(on_sys_pwrite64_enter) || PPP_CHECK_CB(on_sys_pwrite64_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1452,9 +1705,11 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint64_t));
 }
 PPP_RUN_CB(on_sys_pwrite64_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 182 long sys_chown16 ['const char __user *filename', 'old_uid_t user', ' old_gid_t group']
 case 182: {
+if (PPP_CHECK_CB(on_sys_chown16_enter) || PPP_CHECK_CB(on_sys_chown16_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1464,9 +1719,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_chown16_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 183 long sys_getcwd ['char __user *buf', ' unsigned long size']
 case 183: {
+if (PPP_CHECK_CB(on_sys_getcwd_enter) || PPP_CHECK_CB(on_sys_getcwd_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_getcwd_return)) {
@@ -1474,9 +1731,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_getcwd_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 184 long sys_capget ['cap_user_header_t header', 'cap_user_data_t dataptr']
 case 184: {
+if (PPP_CHECK_CB(on_sys_capget_enter) || PPP_CHECK_CB(on_sys_capget_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_capget_return)) {
@@ -1484,9 +1743,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_capget_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 185 long sys_capset ['cap_user_header_t header', 'const cap_user_data_t data']
 case 185: {
+if (PPP_CHECK_CB(on_sys_capset_enter) || PPP_CHECK_CB(on_sys_capset_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_capset_return)) {
@@ -1494,9 +1755,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_capset_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 186 int do_sigaltstack ['const stack_t __user *uss', ' stack_t __user *uoss']
 case 186: {
+if (PPP_CHECK_CB(on_do_sigaltstack_enter) || PPP_CHECK_CB(on_do_sigaltstack_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_do_sigaltstack_return)) {
@@ -1504,9 +1767,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_do_sigaltstack_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 187 long sys_sendfile ['int out_fd', ' int in_fd', 'off_t __user *offset', ' size_t count']
 case 187: {
+if (PPP_CHECK_CB(on_sys_sendfile_enter) || PPP_CHECK_CB(on_sys_sendfile_return)) {
 int32_t arg0 = get_s32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1518,6 +1783,7 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_sendfile_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 190 unsigned long vfork ['void']
 case 190: {
@@ -1527,6 +1793,7 @@ PPP_RUN_CB(on_vfork_enter, env,pc) ;
 }; break;
 // 191 long sys_getrlimit ['unsigned int resource', 'struct rlimit __user *rlim']
 case 191: {
+if (PPP_CHECK_CB(on_sys_getrlimit_enter) || PPP_CHECK_CB(on_sys_getrlimit_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_getrlimit_return)) {
@@ -1534,9 +1801,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_getrlimit_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 192 long do_mmap2 ['unsigned long addr', ' unsigned long len', ' unsigned long prot', ' unsigned long flags', ' unsigned long fd', ' unsigned long pgoff']
 case 192: {
+if (PPP_CHECK_CB(on_do_mmap2_enter) || PPP_CHECK_CB(on_do_mmap2_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1552,9 +1821,11 @@ memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_do_mmap2_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 193 long sys_truncate64 ['const char __user *path', ' loff_t length']
 case 193: {
+if (PPP_CHECK_CB(on_sys_truncate64_enter) || PPP_CHECK_CB(on_sys_truncate64_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint64_t arg1 = get_64(env, 1);
 if (PPP_CHECK_CB(on_sys_truncate64_return)) {
@@ -1562,9 +1833,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint64_t));
 }
 PPP_RUN_CB(on_sys_truncate64_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 194 long sys_ftruncate64 ['unsigned int fd', ' loff_t length']
 case 194: {
+if (PPP_CHECK_CB(on_sys_ftruncate64_enter) || PPP_CHECK_CB(on_sys_ftruncate64_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint64_t arg1 = get_64(env, 1);
 if (PPP_CHECK_CB(on_sys_ftruncate64_return)) {
@@ -1572,9 +1845,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint64_t));
 }
 PPP_RUN_CB(on_sys_ftruncate64_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 195 long sys_stat64 ['char __user *filename', 'struct stat64 __user *statbuf']
 case 195: {
+if (PPP_CHECK_CB(on_sys_stat64_enter) || PPP_CHECK_CB(on_sys_stat64_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_stat64_return)) {
@@ -1582,9 +1857,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_stat64_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 196 long sys_lstat64 ['char __user *filename', 'struct stat64 __user *statbuf']
 case 196: {
+if (PPP_CHECK_CB(on_sys_lstat64_enter) || PPP_CHECK_CB(on_sys_lstat64_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_lstat64_return)) {
@@ -1592,9 +1869,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_lstat64_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 197 long sys_fstat64 ['unsigned long fd', ' struct stat64 __user *statbuf']
 case 197: {
+if (PPP_CHECK_CB(on_sys_fstat64_enter) || PPP_CHECK_CB(on_sys_fstat64_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_fstat64_return)) {
@@ -1602,9 +1881,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_fstat64_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 198 long sys_lchown ['const char __user *filename', 'uid_t user', ' gid_t group']
 case 198: {
+if (PPP_CHECK_CB(on_sys_lchown_enter) || PPP_CHECK_CB(on_sys_lchown_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1614,6 +1895,7 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_lchown_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 199 long sys_getuid ['void']
 case 199: {
@@ -1641,6 +1923,7 @@ PPP_RUN_CB(on_sys_getegid_enter, env,pc) ;
 }; break;
 // 203 long sys_setreuid ['uid_t ruid', ' uid_t euid']
 case 203: {
+if (PPP_CHECK_CB(on_sys_setreuid_enter) || PPP_CHECK_CB(on_sys_setreuid_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_setreuid_return)) {
@@ -1648,9 +1931,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_setreuid_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 204 long sys_setregid ['gid_t rgid', ' gid_t egid']
 case 204: {
+if (PPP_CHECK_CB(on_sys_setregid_enter) || PPP_CHECK_CB(on_sys_setregid_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_setregid_return)) {
@@ -1658,9 +1943,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_setregid_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 205 long sys_getgroups ['int gidsetsize', ' gid_t __user *grouplist']
 case 205: {
+if (PPP_CHECK_CB(on_sys_getgroups_enter) || PPP_CHECK_CB(on_sys_getgroups_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_getgroups_return)) {
@@ -1668,9 +1955,11 @@ memcpy(rp.params[0], &arg0, sizeof(int32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_getgroups_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 206 long sys_setgroups ['int gidsetsize', ' gid_t __user *grouplist']
 case 206: {
+if (PPP_CHECK_CB(on_sys_setgroups_enter) || PPP_CHECK_CB(on_sys_setgroups_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_setgroups_return)) {
@@ -1678,9 +1967,11 @@ memcpy(rp.params[0], &arg0, sizeof(int32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_setgroups_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 207 long sys_fchown ['unsigned int fd', ' uid_t user', ' gid_t group']
 case 207: {
+if (PPP_CHECK_CB(on_sys_fchown_enter) || PPP_CHECK_CB(on_sys_fchown_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1690,9 +1981,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_fchown_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 208 long sys_setresuid ['uid_t ruid', ' uid_t euid', ' uid_t suid']
 case 208: {
+if (PPP_CHECK_CB(on_sys_setresuid_enter) || PPP_CHECK_CB(on_sys_setresuid_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1702,9 +1995,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_setresuid_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 209 long sys_getresuid ['uid_t __user *ruid', ' uid_t __user *euid', ' uid_t __user *suid']
 case 209: {
+if (PPP_CHECK_CB(on_sys_getresuid_enter) || PPP_CHECK_CB(on_sys_getresuid_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1714,9 +2009,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_getresuid_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 210 long sys_setresgid ['gid_t rgid', ' gid_t egid', ' gid_t sgid']
 case 210: {
+if (PPP_CHECK_CB(on_sys_setresgid_enter) || PPP_CHECK_CB(on_sys_setresgid_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1726,9 +2023,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_setresgid_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 211 long sys_getresgid ['gid_t __user *rgid', ' gid_t __user *egid', ' gid_t __user *sgid']
 case 211: {
+if (PPP_CHECK_CB(on_sys_getresgid_enter) || PPP_CHECK_CB(on_sys_getresgid_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1738,9 +2037,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_getresgid_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 212 long sys_chown ['const char __user *filename', 'uid_t user', ' gid_t group']
 case 212: {
+if (PPP_CHECK_CB(on_sys_chown_enter) || PPP_CHECK_CB(on_sys_chown_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1750,41 +2051,51 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_chown_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 213 long sys_setuid ['uid_t uid']
 case 213: {
+if (PPP_CHECK_CB(on_sys_setuid_enter) || PPP_CHECK_CB(on_sys_setuid_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_setuid_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_setuid_enter, env,pc,arg0) ; 
+}
 }; break;
 // 214 long sys_setgid ['gid_t gid']
 case 214: {
+if (PPP_CHECK_CB(on_sys_setgid_enter) || PPP_CHECK_CB(on_sys_setgid_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_setgid_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_setgid_enter, env,pc,arg0) ; 
+}
 }; break;
 // 215 long sys_setfsuid ['uid_t uid']
 case 215: {
+if (PPP_CHECK_CB(on_sys_setfsuid_enter) || PPP_CHECK_CB(on_sys_setfsuid_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_setfsuid_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_setfsuid_enter, env,pc,arg0) ; 
+}
 }; break;
 // 216 long sys_setfsgid ['gid_t gid']
 case 216: {
+if (PPP_CHECK_CB(on_sys_setfsgid_enter) || PPP_CHECK_CB(on_sys_setfsgid_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_setfsgid_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_setfsgid_enter, env,pc,arg0) ; 
+}
 }; break;
 // 217 long sys_getdents64 ['unsigned int fd', 'struct linux_dirent64 __user *dirent', 'unsigned int count']
 case 217: {
+if (PPP_CHECK_CB(on_sys_getdents64_enter) || PPP_CHECK_CB(on_sys_getdents64_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1794,9 +2105,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_getdents64_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 218 long sys_pivot_root ['const char __user *new_root', 'const char __user *put_old']
 case 218: {
+if (PPP_CHECK_CB(on_sys_pivot_root_enter) || PPP_CHECK_CB(on_sys_pivot_root_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_pivot_root_return)) {
@@ -1804,9 +2117,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_pivot_root_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 219 long sys_mincore ['unsigned long start', ' size_t len', 'unsigned char __user * vec']
 case 219: {
+if (PPP_CHECK_CB(on_sys_mincore_enter) || PPP_CHECK_CB(on_sys_mincore_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1816,9 +2131,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_mincore_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 220 long sys_madvise ['unsigned long start', ' size_t len', ' int behavior']
 case 220: {
+if (PPP_CHECK_CB(on_sys_madvise_enter) || PPP_CHECK_CB(on_sys_madvise_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -1828,9 +2145,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_madvise_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 221 long sys_fcntl64 ['unsigned int fd', 'unsigned int cmd', ' unsigned long arg']
 case 221: {
+if (PPP_CHECK_CB(on_sys_fcntl64_enter) || PPP_CHECK_CB(on_sys_fcntl64_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1840,6 +2159,7 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_fcntl64_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 224 long sys_gettid ['void']
 case 224: {
@@ -1849,6 +2169,7 @@ PPP_RUN_CB(on_sys_gettid_enter, env,pc) ;
 }; break;
 // 225 long sys_readahead ['int fd', ' loff_t offset', ' size_t count']
 case 225: {
+if (PPP_CHECK_CB(on_sys_readahead_enter) || PPP_CHECK_CB(on_sys_readahead_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint64_t arg1 = get_64(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1858,9 +2179,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint64_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_readahead_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 226 long sys_setxattr ['const char __user *path', ' const char __user *name', 'const void __user *value', ' size_t size', ' int flags']
 case 226: {
+if (PPP_CHECK_CB(on_sys_setxattr_enter) || PPP_CHECK_CB(on_sys_setxattr_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1874,9 +2197,11 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_setxattr_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 227 long sys_lsetxattr ['const char __user *path', ' const char __user *name', 'const void __user *value', ' size_t size', ' int flags']
 case 227: {
+if (PPP_CHECK_CB(on_sys_lsetxattr_enter) || PPP_CHECK_CB(on_sys_lsetxattr_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1890,9 +2215,11 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_lsetxattr_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 228 long sys_fsetxattr ['int fd', ' const char __user *name', 'const void __user *value', ' size_t size', ' int flags']
 case 228: {
+if (PPP_CHECK_CB(on_sys_fsetxattr_enter) || PPP_CHECK_CB(on_sys_fsetxattr_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1906,9 +2233,11 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_fsetxattr_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 229 long sys_getxattr ['const char __user *path', ' const char __user *name', 'void __user *value', ' size_t size']
 case 229: {
+if (PPP_CHECK_CB(on_sys_getxattr_enter) || PPP_CHECK_CB(on_sys_getxattr_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1920,9 +2249,11 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_getxattr_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 230 long sys_lgetxattr ['const char __user *path', ' const char __user *name', 'void __user *value', ' size_t size']
 case 230: {
+if (PPP_CHECK_CB(on_sys_lgetxattr_enter) || PPP_CHECK_CB(on_sys_lgetxattr_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1934,9 +2265,11 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_lgetxattr_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 231 long sys_fgetxattr ['int fd', ' const char __user *name', 'void __user *value', ' size_t size']
 case 231: {
+if (PPP_CHECK_CB(on_sys_fgetxattr_enter) || PPP_CHECK_CB(on_sys_fgetxattr_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1948,9 +2281,11 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_fgetxattr_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 232 long sys_listxattr ['const char __user *path', ' char __user *list', 'size_t size']
 case 232: {
+if (PPP_CHECK_CB(on_sys_listxattr_enter) || PPP_CHECK_CB(on_sys_listxattr_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1960,9 +2295,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_listxattr_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 233 long sys_llistxattr ['const char __user *path', ' char __user *list', 'size_t size']
 case 233: {
+if (PPP_CHECK_CB(on_sys_llistxattr_enter) || PPP_CHECK_CB(on_sys_llistxattr_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1972,9 +2309,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_llistxattr_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 234 long sys_flistxattr ['int fd', ' char __user *list', ' size_t size']
 case 234: {
+if (PPP_CHECK_CB(on_sys_flistxattr_enter) || PPP_CHECK_CB(on_sys_flistxattr_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1984,9 +2323,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_flistxattr_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 235 long sys_removexattr ['const char __user *path', 'const char __user *name']
 case 235: {
+if (PPP_CHECK_CB(on_sys_removexattr_enter) || PPP_CHECK_CB(on_sys_removexattr_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_removexattr_return)) {
@@ -1994,9 +2335,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_removexattr_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 236 long sys_lremovexattr ['const char __user *path', 'const char __user *name']
 case 236: {
+if (PPP_CHECK_CB(on_sys_lremovexattr_enter) || PPP_CHECK_CB(on_sys_lremovexattr_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_lremovexattr_return)) {
@@ -2004,9 +2347,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_lremovexattr_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 237 long sys_fremovexattr ['int fd', ' const char __user *name']
 case 237: {
+if (PPP_CHECK_CB(on_sys_fremovexattr_enter) || PPP_CHECK_CB(on_sys_fremovexattr_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_fremovexattr_return)) {
@@ -2014,9 +2359,11 @@ memcpy(rp.params[0], &arg0, sizeof(int32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_fremovexattr_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 238 long sys_tkill ['int pid', ' int sig']
 case 238: {
+if (PPP_CHECK_CB(on_sys_tkill_enter) || PPP_CHECK_CB(on_sys_tkill_return)) {
 int32_t arg0 = get_s32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 if (PPP_CHECK_CB(on_sys_tkill_return)) {
@@ -2024,9 +2371,11 @@ memcpy(rp.params[0], &arg0, sizeof(int32_t));
 memcpy(rp.params[1], &arg1, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_tkill_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 239 long sys_sendfile64 ['int out_fd', ' int in_fd', 'loff_t __user *offset', ' size_t count']
 case 239: {
+if (PPP_CHECK_CB(on_sys_sendfile64_enter) || PPP_CHECK_CB(on_sys_sendfile64_return)) {
 int32_t arg0 = get_s32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2038,9 +2387,11 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_sendfile64_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 240 long sys_futex ['u32 __user *uaddr', ' int op', ' u32 val', 'struct timespec __user *utime', ' u32 __user *uaddr2', 'u32 val3']
 case 240: {
+if (PPP_CHECK_CB(on_sys_futex_enter) || PPP_CHECK_CB(on_sys_futex_return)) {
 uint32_t arg0 = get_32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2056,9 +2407,11 @@ memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_futex_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 241 long sys_sched_setaffinity ['pid_t pid', ' unsigned int len', 'unsigned long __user *user_mask_ptr']
 case 241: {
+if (PPP_CHECK_CB(on_sys_sched_setaffinity_enter) || PPP_CHECK_CB(on_sys_sched_setaffinity_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2068,9 +2421,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_sched_setaffinity_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 242 long sys_sched_getaffinity ['pid_t pid', ' unsigned int len', 'unsigned long __user *user_mask_ptr']
 case 242: {
+if (PPP_CHECK_CB(on_sys_sched_getaffinity_enter) || PPP_CHECK_CB(on_sys_sched_getaffinity_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2080,9 +2435,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_sched_getaffinity_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 243 long sys_io_setup ['unsigned nr_reqs', ' aio_context_t __user *ctx']
 case 243: {
+if (PPP_CHECK_CB(on_sys_io_setup_enter) || PPP_CHECK_CB(on_sys_io_setup_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_io_setup_return)) {
@@ -2090,17 +2447,21 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_io_setup_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 244 long sys_io_destroy ['aio_context_t ctx']
 case 244: {
+if (PPP_CHECK_CB(on_sys_io_destroy_enter) || PPP_CHECK_CB(on_sys_io_destroy_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_io_destroy_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_io_destroy_enter, env,pc,arg0) ; 
+}
 }; break;
 // 245 long sys_io_getevents ['aio_context_t ctx_id', 'long min_nr', 'long nr', 'struct io_event __user *events', 'struct timespec __user *timeout']
 case 245: {
+if (PPP_CHECK_CB(on_sys_io_getevents_enter) || PPP_CHECK_CB(on_sys_io_getevents_return)) {
 uint32_t arg0 = get_32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -2114,9 +2475,11 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_io_getevents_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 246 long sys_io_submit ['aio_context_t', ' long', 'struct iocb __user * __user *']
 case 246: {
+if (PPP_CHECK_CB(on_sys_io_submit_enter) || PPP_CHECK_CB(on_sys_io_submit_return)) {
 uint32_t arg0 = get_32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2126,9 +2489,11 @@ memcpy(rp.params[1], &arg1, sizeof(int32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_io_submit_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 247 long sys_io_cancel ['aio_context_t ctx_id', ' struct iocb __user *iocb', 'struct io_event __user *result']
 case 247: {
+if (PPP_CHECK_CB(on_sys_io_cancel_enter) || PPP_CHECK_CB(on_sys_io_cancel_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2138,17 +2503,21 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_io_cancel_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 248 long sys_exit_group ['int error_code']
 case 248: {
+if (PPP_CHECK_CB(on_sys_exit_group_enter) || PPP_CHECK_CB(on_sys_exit_group_return)) {
 int32_t arg0 = get_s32(env, 0);
 if (PPP_CHECK_CB(on_sys_exit_group_return)) {
 memcpy(rp.params[0], &arg0, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_exit_group_enter, env,pc,arg0) ; 
+}
 }; break;
 // 249 long sys_lookup_dcookie ['u64 cookie64', ' char __user *buf', ' size_t len']
 case 249: {
+if (PPP_CHECK_CB(on_sys_lookup_dcookie_enter) || PPP_CHECK_CB(on_sys_lookup_dcookie_return)) {
 uint64_t arg0 = get_64(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2158,17 +2527,21 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_lookup_dcookie_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 250 long sys_epoll_create ['int size']
 case 250: {
+if (PPP_CHECK_CB(on_sys_epoll_create_enter) || PPP_CHECK_CB(on_sys_epoll_create_return)) {
 int32_t arg0 = get_s32(env, 0);
 if (PPP_CHECK_CB(on_sys_epoll_create_return)) {
 memcpy(rp.params[0], &arg0, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_epoll_create_enter, env,pc,arg0) ; 
+}
 }; break;
 // 251 long sys_epoll_ctl ['int epfd', ' int op', ' int fd', 'struct epoll_event __user *event']
 case 251: {
+if (PPP_CHECK_CB(on_sys_epoll_ctl_enter) || PPP_CHECK_CB(on_sys_epoll_ctl_return)) {
 int32_t arg0 = get_s32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -2180,9 +2553,11 @@ memcpy(rp.params[2], &arg2, sizeof(int32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_epoll_ctl_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 252 long sys_epoll_wait ['int epfd', ' struct epoll_event __user *events', 'int maxevents', ' int timeout']
 case 252: {
+if (PPP_CHECK_CB(on_sys_epoll_wait_enter) || PPP_CHECK_CB(on_sys_epoll_wait_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -2194,9 +2569,11 @@ memcpy(rp.params[2], &arg2, sizeof(int32_t));
 memcpy(rp.params[3], &arg3, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_epoll_wait_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 253 long sys_remap_file_pages ['unsigned long start', ' unsigned long size', 'unsigned long prot', ' unsigned long pgoff', 'unsigned long flags']
 case 253: {
+if (PPP_CHECK_CB(on_sys_remap_file_pages_enter) || PPP_CHECK_CB(on_sys_remap_file_pages_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2210,17 +2587,21 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_remap_file_pages_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 256 long sys_set_tid_address ['int __user *tidptr']
 case 256: {
+if (PPP_CHECK_CB(on_sys_set_tid_address_enter) || PPP_CHECK_CB(on_sys_set_tid_address_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_set_tid_address_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_set_tid_address_enter, env,pc,arg0) ; 
+}
 }; break;
 // 257 long sys_timer_create ['clockid_t which_clock', 'struct sigevent __user *timer_event_spec', 'timer_t __user * created_timer_id']
 case 257: {
+if (PPP_CHECK_CB(on_sys_timer_create_enter) || PPP_CHECK_CB(on_sys_timer_create_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2230,9 +2611,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_timer_create_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 258 long sys_timer_settime ['timer_t timer_id', ' int flags', 'const struct itimerspec __user *new_setting', 'struct itimerspec __user *old_setting']
 case 258: {
+if (PPP_CHECK_CB(on_sys_timer_settime_enter) || PPP_CHECK_CB(on_sys_timer_settime_return)) {
 uint32_t arg0 = get_32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2244,9 +2627,11 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_timer_settime_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 259 long sys_timer_gettime ['timer_t timer_id', 'struct itimerspec __user *setting']
 case 259: {
+if (PPP_CHECK_CB(on_sys_timer_gettime_enter) || PPP_CHECK_CB(on_sys_timer_gettime_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_timer_gettime_return)) {
@@ -2254,25 +2639,31 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_timer_gettime_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 260 long sys_timer_getoverrun ['timer_t timer_id']
 case 260: {
+if (PPP_CHECK_CB(on_sys_timer_getoverrun_enter) || PPP_CHECK_CB(on_sys_timer_getoverrun_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_timer_getoverrun_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_timer_getoverrun_enter, env,pc,arg0) ; 
+}
 }; break;
 // 261 long sys_timer_delete ['timer_t timer_id']
 case 261: {
+if (PPP_CHECK_CB(on_sys_timer_delete_enter) || PPP_CHECK_CB(on_sys_timer_delete_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_timer_delete_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_timer_delete_enter, env,pc,arg0) ; 
+}
 }; break;
 // 262 long sys_clock_settime ['clockid_t which_clock', 'const struct timespec __user *tp']
 case 262: {
+if (PPP_CHECK_CB(on_sys_clock_settime_enter) || PPP_CHECK_CB(on_sys_clock_settime_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_clock_settime_return)) {
@@ -2280,9 +2671,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_clock_settime_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 263 long sys_clock_gettime ['clockid_t which_clock', 'struct timespec __user *tp']
 case 263: {
+if (PPP_CHECK_CB(on_sys_clock_gettime_enter) || PPP_CHECK_CB(on_sys_clock_gettime_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_clock_gettime_return)) {
@@ -2290,9 +2683,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_clock_gettime_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 264 long sys_clock_getres ['clockid_t which_clock', 'struct timespec __user *tp']
 case 264: {
+if (PPP_CHECK_CB(on_sys_clock_getres_enter) || PPP_CHECK_CB(on_sys_clock_getres_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_clock_getres_return)) {
@@ -2300,9 +2695,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_clock_getres_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 265 long sys_clock_nanosleep ['clockid_t which_clock', ' int flags', 'const struct timespec __user *rqtp', 'struct timespec __user *rmtp']
 case 265: {
+if (PPP_CHECK_CB(on_sys_clock_nanosleep_enter) || PPP_CHECK_CB(on_sys_clock_nanosleep_return)) {
 uint32_t arg0 = get_32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2314,9 +2711,11 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_clock_nanosleep_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 266 long sys_statfs64 ['const char __user *path', ' size_t sz', 'struct statfs64 __user *buf']
 case 266: {
+if (PPP_CHECK_CB(on_sys_statfs64_enter) || PPP_CHECK_CB(on_sys_statfs64_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2326,9 +2725,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_statfs64_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 267 long sys_fstatfs64 ['unsigned int fd', ' size_t sz', 'struct statfs64 __user *buf']
 case 267: {
+if (PPP_CHECK_CB(on_sys_fstatfs64_enter) || PPP_CHECK_CB(on_sys_fstatfs64_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2338,9 +2739,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_fstatfs64_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 268 long sys_tgkill ['int tgid', ' int pid', ' int sig']
 case 268: {
+if (PPP_CHECK_CB(on_sys_tgkill_enter) || PPP_CHECK_CB(on_sys_tgkill_return)) {
 int32_t arg0 = get_s32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -2350,9 +2753,11 @@ memcpy(rp.params[1], &arg1, sizeof(int32_t));
 memcpy(rp.params[2], &arg2, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_tgkill_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 269 long sys_utimes ['char __user *filename', 'struct timeval __user *utimes']
 case 269: {
+if (PPP_CHECK_CB(on_sys_utimes_enter) || PPP_CHECK_CB(on_sys_utimes_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_utimes_return)) {
@@ -2360,9 +2765,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_utimes_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 270 long sys_arm_fadvise64_64 ['int fd', ' int advice', ' loff_t offset', ' loff_t len']
 case 270: {
+if (PPP_CHECK_CB(on_sys_arm_fadvise64_64_enter) || PPP_CHECK_CB(on_sys_arm_fadvise64_64_return)) {
 int32_t arg0 = get_s32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 uint64_t arg2 = get_64(env, 2);
@@ -2374,9 +2781,11 @@ memcpy(rp.params[2], &arg2, sizeof(uint64_t));
 memcpy(rp.params[3], &arg3, sizeof(uint64_t));
 }
 PPP_RUN_CB(on_sys_arm_fadvise64_64_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 271 long sys_pciconfig_iobase ['long which', ' unsigned long bus', ' unsigned long devfn']
 case 271: {
+if (PPP_CHECK_CB(on_sys_pciconfig_iobase_enter) || PPP_CHECK_CB(on_sys_pciconfig_iobase_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2386,9 +2795,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_pciconfig_iobase_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 272 long sys_pciconfig_read ['unsigned long bus', ' unsigned long dfn', 'unsigned long off', ' unsigned long len', 'void __user *buf']
 case 272: {
+if (PPP_CHECK_CB(on_sys_pciconfig_read_enter) || PPP_CHECK_CB(on_sys_pciconfig_read_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2402,9 +2813,11 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_pciconfig_read_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 273 long sys_pciconfig_write ['unsigned long bus', ' unsigned long dfn', 'unsigned long off', ' unsigned long len', 'void __user *buf']
 case 273: {
+if (PPP_CHECK_CB(on_sys_pciconfig_write_enter) || PPP_CHECK_CB(on_sys_pciconfig_write_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2418,9 +2831,11 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_pciconfig_write_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 274 long sys_mq_open ['const char __user *name', ' int oflag', ' mode_t mode', ' struct mq_attr __user *attr']
 case 274: {
+if (PPP_CHECK_CB(on_sys_mq_open_enter) || PPP_CHECK_CB(on_sys_mq_open_return)) {
 uint32_t arg0 = get_32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2432,17 +2847,21 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_mq_open_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 275 long sys_mq_unlink ['const char __user *name']
 case 275: {
+if (PPP_CHECK_CB(on_sys_mq_unlink_enter) || PPP_CHECK_CB(on_sys_mq_unlink_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_mq_unlink_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_mq_unlink_enter, env,pc,arg0) ; 
+}
 }; break;
 // 276 long sys_mq_timedsend ['mqd_t mqdes', ' const char __user *msg_ptr', ' size_t msg_len', ' unsigned int msg_prio', ' const struct timespec __user *abs_timeout']
 case 276: {
+if (PPP_CHECK_CB(on_sys_mq_timedsend_enter) || PPP_CHECK_CB(on_sys_mq_timedsend_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2456,9 +2875,11 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_mq_timedsend_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 277 long sys_mq_timedreceive ['mqd_t mqdes', ' char __user *msg_ptr', ' size_t msg_len', ' unsigned int __user *msg_prio', ' const struct timespec __user *abs_timeout']
 case 277: {
+if (PPP_CHECK_CB(on_sys_mq_timedreceive_enter) || PPP_CHECK_CB(on_sys_mq_timedreceive_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2472,9 +2893,11 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_mq_timedreceive_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 278 long sys_mq_notify ['mqd_t mqdes', ' const struct sigevent __user *notification']
 case 278: {
+if (PPP_CHECK_CB(on_sys_mq_notify_enter) || PPP_CHECK_CB(on_sys_mq_notify_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_mq_notify_return)) {
@@ -2482,9 +2905,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_mq_notify_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 279 long sys_mq_getsetattr ['mqd_t mqdes', ' const struct mq_attr __user *mqstat', ' struct mq_attr __user *omqstat']
 case 279: {
+if (PPP_CHECK_CB(on_sys_mq_getsetattr_enter) || PPP_CHECK_CB(on_sys_mq_getsetattr_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2494,9 +2919,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_mq_getsetattr_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 280 long sys_waitid ['int which', ' pid_t pid', 'struct siginfo __user *infop', 'int options', ' struct rusage __user *ru']
 case 280: {
+if (PPP_CHECK_CB(on_sys_waitid_enter) || PPP_CHECK_CB(on_sys_waitid_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2510,9 +2937,11 @@ memcpy(rp.params[3], &arg3, sizeof(int32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_waitid_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 281 long sys_socket ['int', ' int', ' int']
 case 281: {
+if (PPP_CHECK_CB(on_sys_socket_enter) || PPP_CHECK_CB(on_sys_socket_return)) {
 int32_t arg0 = get_s32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -2522,9 +2951,11 @@ memcpy(rp.params[1], &arg1, sizeof(int32_t));
 memcpy(rp.params[2], &arg2, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_socket_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 282 long sys_bind ['int', ' struct sockaddr __user *', ' int']
 case 282: {
+if (PPP_CHECK_CB(on_sys_bind_enter) || PPP_CHECK_CB(on_sys_bind_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -2534,9 +2965,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_bind_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 283 long sys_connect ['int', ' struct sockaddr __user *', ' int']
 case 283: {
+if (PPP_CHECK_CB(on_sys_connect_enter) || PPP_CHECK_CB(on_sys_connect_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -2546,9 +2979,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_connect_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 284 long sys_listen ['int', ' int']
 case 284: {
+if (PPP_CHECK_CB(on_sys_listen_enter) || PPP_CHECK_CB(on_sys_listen_return)) {
 int32_t arg0 = get_s32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 if (PPP_CHECK_CB(on_sys_listen_return)) {
@@ -2556,9 +2991,11 @@ memcpy(rp.params[0], &arg0, sizeof(int32_t));
 memcpy(rp.params[1], &arg1, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_listen_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 285 long sys_accept ['int', ' struct sockaddr __user *', ' int __user *']
 case 285: {
+if (PPP_CHECK_CB(on_sys_accept_enter) || PPP_CHECK_CB(on_sys_accept_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2568,9 +3005,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_accept_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 286 long sys_getsockname ['int', ' struct sockaddr __user *', ' int __user *']
 case 286: {
+if (PPP_CHECK_CB(on_sys_getsockname_enter) || PPP_CHECK_CB(on_sys_getsockname_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2580,9 +3019,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_getsockname_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 287 long sys_getpeername ['int', ' struct sockaddr __user *', ' int __user *']
 case 287: {
+if (PPP_CHECK_CB(on_sys_getpeername_enter) || PPP_CHECK_CB(on_sys_getpeername_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2592,9 +3033,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_getpeername_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 288 long sys_socketpair ['int', ' int', ' int', ' int __user *']
 case 288: {
+if (PPP_CHECK_CB(on_sys_socketpair_enter) || PPP_CHECK_CB(on_sys_socketpair_return)) {
 int32_t arg0 = get_s32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -2606,9 +3049,11 @@ memcpy(rp.params[2], &arg2, sizeof(int32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_socketpair_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 289 long sys_send ['int', ' void __user *', ' size_t', ' unsigned']
 case 289: {
+if (PPP_CHECK_CB(on_sys_send_enter) || PPP_CHECK_CB(on_sys_send_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2620,9 +3065,11 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_send_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 290 long sys_sendto ['int', ' void __user *', ' size_t', ' unsigned', 'struct sockaddr __user *', ' int']
 case 290: {
+if (PPP_CHECK_CB(on_sys_sendto_enter) || PPP_CHECK_CB(on_sys_sendto_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2638,9 +3085,11 @@ memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_sendto_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 291 long sys_recv ['int', ' void __user *', ' size_t', ' unsigned']
 case 291: {
+if (PPP_CHECK_CB(on_sys_recv_enter) || PPP_CHECK_CB(on_sys_recv_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2652,9 +3101,11 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_recv_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 292 long sys_recvfrom ['int', ' void __user *', ' size_t', ' unsigned', 'struct sockaddr __user *', ' int __user *']
 case 292: {
+if (PPP_CHECK_CB(on_sys_recvfrom_enter) || PPP_CHECK_CB(on_sys_recvfrom_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2670,9 +3121,11 @@ memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_recvfrom_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 293 long sys_shutdown ['int', ' int']
 case 293: {
+if (PPP_CHECK_CB(on_sys_shutdown_enter) || PPP_CHECK_CB(on_sys_shutdown_return)) {
 int32_t arg0 = get_s32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 if (PPP_CHECK_CB(on_sys_shutdown_return)) {
@@ -2680,9 +3133,11 @@ memcpy(rp.params[0], &arg0, sizeof(int32_t));
 memcpy(rp.params[1], &arg1, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_shutdown_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 294 long sys_setsockopt ['int fd', ' int level', ' int optname', 'char __user *optval', ' int optlen']
 case 294: {
+if (PPP_CHECK_CB(on_sys_setsockopt_enter) || PPP_CHECK_CB(on_sys_setsockopt_return)) {
 int32_t arg0 = get_s32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -2696,9 +3151,11 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_setsockopt_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 295 long sys_getsockopt ['int fd', ' int level', ' int optname', 'char __user *optval', ' int __user *optlen']
 case 295: {
+if (PPP_CHECK_CB(on_sys_getsockopt_enter) || PPP_CHECK_CB(on_sys_getsockopt_return)) {
 int32_t arg0 = get_s32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -2712,9 +3169,11 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_getsockopt_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 296 long sys_sendmsg ['int fd', ' struct msghdr __user *msg', ' unsigned flags']
 case 296: {
+if (PPP_CHECK_CB(on_sys_sendmsg_enter) || PPP_CHECK_CB(on_sys_sendmsg_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2724,9 +3183,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_sendmsg_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 297 long sys_recvmsg ['int fd', ' struct msghdr __user *msg', ' unsigned flags']
 case 297: {
+if (PPP_CHECK_CB(on_sys_recvmsg_enter) || PPP_CHECK_CB(on_sys_recvmsg_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2736,9 +3197,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_recvmsg_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 298 long sys_semop ['int semid', ' struct sembuf __user *sops', 'unsigned nsops']
 case 298: {
+if (PPP_CHECK_CB(on_sys_semop_enter) || PPP_CHECK_CB(on_sys_semop_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2748,9 +3211,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_semop_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 299 long sys_semget ['key_t key', ' int nsems', ' int semflg']
 case 299: {
+if (PPP_CHECK_CB(on_sys_semget_enter) || PPP_CHECK_CB(on_sys_semget_return)) {
 uint32_t arg0 = get_32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -2760,9 +3225,11 @@ memcpy(rp.params[1], &arg1, sizeof(int32_t));
 memcpy(rp.params[2], &arg2, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_semget_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 300 long sys_semctl ['int semid', ' int semnum', ' int cmd', ' union semun arg']
 case 300: {
+if (PPP_CHECK_CB(on_sys_semctl_enter) || PPP_CHECK_CB(on_sys_semctl_return)) {
 int32_t arg0 = get_s32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -2774,9 +3241,11 @@ memcpy(rp.params[2], &arg2, sizeof(int32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_semctl_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 301 long sys_msgsnd ['int msqid', ' struct msgbuf __user *msgp', 'size_t msgsz', ' int msgflg']
 case 301: {
+if (PPP_CHECK_CB(on_sys_msgsnd_enter) || PPP_CHECK_CB(on_sys_msgsnd_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2788,9 +3257,11 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_msgsnd_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 302 long sys_msgrcv ['int msqid', ' struct msgbuf __user *msgp', 'size_t msgsz', ' long msgtyp', ' int msgflg']
 case 302: {
+if (PPP_CHECK_CB(on_sys_msgrcv_enter) || PPP_CHECK_CB(on_sys_msgrcv_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2804,9 +3275,11 @@ memcpy(rp.params[3], &arg3, sizeof(int32_t));
 memcpy(rp.params[4], &arg4, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_msgrcv_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 303 long sys_msgget ['key_t key', ' int msgflg']
 case 303: {
+if (PPP_CHECK_CB(on_sys_msgget_enter) || PPP_CHECK_CB(on_sys_msgget_return)) {
 uint32_t arg0 = get_32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 if (PPP_CHECK_CB(on_sys_msgget_return)) {
@@ -2814,9 +3287,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_msgget_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 304 long sys_msgctl ['int msqid', ' int cmd', ' struct msqid_ds __user *buf']
 case 304: {
+if (PPP_CHECK_CB(on_sys_msgctl_enter) || PPP_CHECK_CB(on_sys_msgctl_return)) {
 int32_t arg0 = get_s32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2826,9 +3301,11 @@ memcpy(rp.params[1], &arg1, sizeof(int32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_msgctl_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 305 long sys_shmat ['int shmid', ' char __user *shmaddr', ' int shmflg']
 case 305: {
+if (PPP_CHECK_CB(on_sys_shmat_enter) || PPP_CHECK_CB(on_sys_shmat_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -2838,17 +3315,21 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_shmat_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 306 long sys_shmdt ['char __user *shmaddr']
 case 306: {
+if (PPP_CHECK_CB(on_sys_shmdt_enter) || PPP_CHECK_CB(on_sys_shmdt_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_shmdt_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_shmdt_enter, env,pc,arg0) ; 
+}
 }; break;
 // 307 long sys_shmget ['key_t key', ' size_t size', ' int flag']
 case 307: {
+if (PPP_CHECK_CB(on_sys_shmget_enter) || PPP_CHECK_CB(on_sys_shmget_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -2858,9 +3339,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_shmget_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 308 long sys_shmctl ['int shmid', ' int cmd', ' struct shmid_ds __user *buf']
 case 308: {
+if (PPP_CHECK_CB(on_sys_shmctl_enter) || PPP_CHECK_CB(on_sys_shmctl_return)) {
 int32_t arg0 = get_s32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2870,9 +3353,11 @@ memcpy(rp.params[1], &arg1, sizeof(int32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_shmctl_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 309 long sys_add_key ['const char __user *_type', 'const char __user *_description', 'const void __user *_payload', 'size_t plen', 'key_serial_t destringid']
 case 309: {
+if (PPP_CHECK_CB(on_sys_add_key_enter) || PPP_CHECK_CB(on_sys_add_key_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2886,9 +3371,11 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_add_key_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 310 long sys_request_key ['const char __user *_type', 'const char __user *_description', 'const char __user *_callout_info', 'key_serial_t destringid']
 case 310: {
+if (PPP_CHECK_CB(on_sys_request_key_enter) || PPP_CHECK_CB(on_sys_request_key_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2900,9 +3387,11 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_request_key_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 311 long sys_keyctl ['int cmd', ' unsigned long arg2', ' unsigned long arg3', 'unsigned long arg4', ' unsigned long arg5']
 case 311: {
+if (PPP_CHECK_CB(on_sys_keyctl_enter) || PPP_CHECK_CB(on_sys_keyctl_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2916,9 +3405,11 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_keyctl_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 312 long sys_semtimedop ['int semid', ' struct sembuf __user *sops', 'unsigned nsops', 'const struct timespec __user *timeout']
 case 312: {
+if (PPP_CHECK_CB(on_sys_semtimedop_enter) || PPP_CHECK_CB(on_sys_semtimedop_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2930,9 +3421,11 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_semtimedop_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 314 long sys_ioprio_set ['int which', ' int who', ' int ioprio']
 case 314: {
+if (PPP_CHECK_CB(on_sys_ioprio_set_enter) || PPP_CHECK_CB(on_sys_ioprio_set_return)) {
 int32_t arg0 = get_s32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -2942,9 +3435,11 @@ memcpy(rp.params[1], &arg1, sizeof(int32_t));
 memcpy(rp.params[2], &arg2, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_ioprio_set_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 315 long sys_ioprio_get ['int which', ' int who']
 case 315: {
+if (PPP_CHECK_CB(on_sys_ioprio_get_enter) || PPP_CHECK_CB(on_sys_ioprio_get_return)) {
 int32_t arg0 = get_s32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 if (PPP_CHECK_CB(on_sys_ioprio_get_return)) {
@@ -2952,6 +3447,7 @@ memcpy(rp.params[0], &arg0, sizeof(int32_t));
 memcpy(rp.params[1], &arg1, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_ioprio_get_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 316 long sys_inotify_init ['void']
 case 316: {
@@ -2961,6 +3457,7 @@ PPP_RUN_CB(on_sys_inotify_init_enter, env,pc) ;
 }; break;
 // 317 long sys_inotify_add_watch ['int fd', ' const char __user *path', 'u32 mask']
 case 317: {
+if (PPP_CHECK_CB(on_sys_inotify_add_watch_enter) || PPP_CHECK_CB(on_sys_inotify_add_watch_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2970,9 +3467,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_inotify_add_watch_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 318 long sys_inotify_rm_watch ['int fd', ' __s32 wd']
 case 318: {
+if (PPP_CHECK_CB(on_sys_inotify_rm_watch_enter) || PPP_CHECK_CB(on_sys_inotify_rm_watch_return)) {
 int32_t arg0 = get_s32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 if (PPP_CHECK_CB(on_sys_inotify_rm_watch_return)) {
@@ -2980,9 +3479,11 @@ memcpy(rp.params[0], &arg0, sizeof(int32_t));
 memcpy(rp.params[1], &arg1, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_inotify_rm_watch_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 319 long sys_mbind ['unsigned long start', ' unsigned long len', 'unsigned long mode', 'unsigned long __user *nmask', 'unsigned long maxnode', 'unsigned flags']
 case 319: {
+if (PPP_CHECK_CB(on_sys_mbind_enter) || PPP_CHECK_CB(on_sys_mbind_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2998,9 +3499,11 @@ memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_mbind_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 320 long sys_get_mempolicy ['int __user *policy', 'unsigned long __user *nmask', 'unsigned long maxnode', 'unsigned long addr', ' unsigned long flags']
 case 320: {
+if (PPP_CHECK_CB(on_sys_get_mempolicy_enter) || PPP_CHECK_CB(on_sys_get_mempolicy_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3014,9 +3517,11 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_get_mempolicy_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 321 long sys_set_mempolicy ['int mode', ' unsigned long __user *nmask', 'unsigned long maxnode']
 case 321: {
+if (PPP_CHECK_CB(on_sys_set_mempolicy_enter) || PPP_CHECK_CB(on_sys_set_mempolicy_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3026,9 +3531,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_set_mempolicy_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 322 long sys_openat ['int dfd', ' const char __user *filename', ' int flags', 'int mode']
 case 322: {
+if (PPP_CHECK_CB(on_sys_openat_enter) || PPP_CHECK_CB(on_sys_openat_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -3040,9 +3547,11 @@ memcpy(rp.params[2], &arg2, sizeof(int32_t));
 memcpy(rp.params[3], &arg3, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_openat_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 323 long sys_mkdirat ['int dfd', ' const char __user * pathname', ' int mode']
 case 323: {
+if (PPP_CHECK_CB(on_sys_mkdirat_enter) || PPP_CHECK_CB(on_sys_mkdirat_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -3052,9 +3561,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_mkdirat_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 324 long sys_mknodat ['int dfd', ' const char __user * filename', ' int mode', 'unsigned dev']
 case 324: {
+if (PPP_CHECK_CB(on_sys_mknodat_enter) || PPP_CHECK_CB(on_sys_mknodat_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -3066,9 +3577,11 @@ memcpy(rp.params[2], &arg2, sizeof(int32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_mknodat_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 325 long sys_fchownat ['int dfd', ' const char __user *filename', ' uid_t user', 'gid_t group', ' int flag']
 case 325: {
+if (PPP_CHECK_CB(on_sys_fchownat_enter) || PPP_CHECK_CB(on_sys_fchownat_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3082,9 +3595,11 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_fchownat_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 326 long sys_futimesat ['int dfd', ' char __user *filename', 'struct timeval __user *utimes']
 case 326: {
+if (PPP_CHECK_CB(on_sys_futimesat_enter) || PPP_CHECK_CB(on_sys_futimesat_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3094,9 +3609,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_futimesat_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 327 long sys_fstatat64 ['int dfd', ' char __user *filename', 'struct stat64 __user *statbuf', ' int flag']
 case 327: {
+if (PPP_CHECK_CB(on_sys_fstatat64_enter) || PPP_CHECK_CB(on_sys_fstatat64_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3108,9 +3625,11 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_fstatat64_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 328 long sys_unlinkat ['int dfd', ' const char __user * pathname', ' int flag']
 case 328: {
+if (PPP_CHECK_CB(on_sys_unlinkat_enter) || PPP_CHECK_CB(on_sys_unlinkat_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -3120,9 +3639,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_unlinkat_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 329 long sys_renameat ['int olddfd', ' const char __user * oldname', 'int newdfd', ' const char __user * newname']
 case 329: {
+if (PPP_CHECK_CB(on_sys_renameat_enter) || PPP_CHECK_CB(on_sys_renameat_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -3134,9 +3655,11 @@ memcpy(rp.params[2], &arg2, sizeof(int32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_renameat_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 330 long sys_linkat ['int olddfd', ' const char __user *oldname', 'int newdfd', ' const char __user *newname', ' int flags']
 case 330: {
+if (PPP_CHECK_CB(on_sys_linkat_enter) || PPP_CHECK_CB(on_sys_linkat_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -3150,9 +3673,11 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_linkat_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 331 long sys_symlinkat ['const char __user * oldname', 'int newdfd', ' const char __user * newname']
 case 331: {
+if (PPP_CHECK_CB(on_sys_symlinkat_enter) || PPP_CHECK_CB(on_sys_symlinkat_return)) {
 uint32_t arg0 = get_32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3162,9 +3687,11 @@ memcpy(rp.params[1], &arg1, sizeof(int32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_symlinkat_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 332 long sys_readlinkat ['int dfd', ' const char __user *path', ' char __user *buf', 'int bufsiz']
 case 332: {
+if (PPP_CHECK_CB(on_sys_readlinkat_enter) || PPP_CHECK_CB(on_sys_readlinkat_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3176,9 +3703,11 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_readlinkat_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 333 long sys_fchmodat ['int dfd', ' const char __user * filename', 'mode_t mode']
 case 333: {
+if (PPP_CHECK_CB(on_sys_fchmodat_enter) || PPP_CHECK_CB(on_sys_fchmodat_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3188,9 +3717,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_fchmodat_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 334 long sys_faccessat ['int dfd', ' const char __user *filename', ' int mode']
 case 334: {
+if (PPP_CHECK_CB(on_sys_faccessat_enter) || PPP_CHECK_CB(on_sys_faccessat_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -3200,17 +3731,21 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_faccessat_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 337 long sys_unshare ['unsigned long unshare_flags']
 case 337: {
+if (PPP_CHECK_CB(on_sys_unshare_enter) || PPP_CHECK_CB(on_sys_unshare_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_unshare_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_unshare_enter, env,pc,arg0) ; 
+}
 }; break;
 // 338 long sys_set_robust_list ['struct robust_list_head __user *head', 'size_t len']
 case 338: {
+if (PPP_CHECK_CB(on_sys_set_robust_list_enter) || PPP_CHECK_CB(on_sys_set_robust_list_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_set_robust_list_return)) {
@@ -3218,9 +3753,11 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_set_robust_list_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 339 long sys_get_robust_list ['int pid', 'struct robust_list_head __user * __user *head_ptr', 'size_t __user *len_ptr']
 case 339: {
+if (PPP_CHECK_CB(on_sys_get_robust_list_enter) || PPP_CHECK_CB(on_sys_get_robust_list_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3230,9 +3767,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_get_robust_list_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 340 long sys_splice ['int fd_in', ' loff_t __user *off_in', 'int fd_out', ' loff_t __user *off_out', 'size_t len', ' unsigned int flags']
 case 340: {
+if (PPP_CHECK_CB(on_sys_splice_enter) || PPP_CHECK_CB(on_sys_splice_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -3248,9 +3787,11 @@ memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_splice_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 341 long sys_sync_file_range2 ['int fd', ' unsigned int flags', 'loff_t offset', ' loff_t nbytes']
 case 341: {
+if (PPP_CHECK_CB(on_sys_sync_file_range2_enter) || PPP_CHECK_CB(on_sys_sync_file_range2_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint64_t arg2 = get_64(env, 2);
@@ -3262,9 +3803,11 @@ memcpy(rp.params[2], &arg2, sizeof(uint64_t));
 memcpy(rp.params[3], &arg3, sizeof(uint64_t));
 }
 PPP_RUN_CB(on_sys_sync_file_range2_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 342 long sys_tee ['int fdin', ' int fdout', ' size_t len', ' unsigned int flags']
 case 342: {
+if (PPP_CHECK_CB(on_sys_tee_enter) || PPP_CHECK_CB(on_sys_tee_return)) {
 int32_t arg0 = get_s32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3276,9 +3819,11 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_tee_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 343 long sys_vmsplice ['int fd', ' const struct iovec __user *iov', 'unsigned long nr_segs', ' unsigned int flags']
 case 343: {
+if (PPP_CHECK_CB(on_sys_vmsplice_enter) || PPP_CHECK_CB(on_sys_vmsplice_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3290,9 +3835,11 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_vmsplice_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 344 long sys_move_pages ['pid_t pid', ' unsigned long nr_pages', 'const void __user * __user *pages', 'const int __user *nodes', 'int __user *status', 'int flags']
 case 344: {
+if (PPP_CHECK_CB(on_sys_move_pages_enter) || PPP_CHECK_CB(on_sys_move_pages_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3308,9 +3855,11 @@ memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_move_pages_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 345 long sys_getcpu ['unsigned __user *cpu', ' unsigned __user *node', ' struct getcpu_cache __user *cache']
 case 345: {
+if (PPP_CHECK_CB(on_sys_getcpu_enter) || PPP_CHECK_CB(on_sys_getcpu_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3320,9 +3869,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_getcpu_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 347 long sys_kexec_load ['unsigned long entry', ' unsigned long nr_segments', 'struct kexec_segment __user *segments', 'unsigned long flags']
 case 347: {
+if (PPP_CHECK_CB(on_sys_kexec_load_enter) || PPP_CHECK_CB(on_sys_kexec_load_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3334,9 +3885,11 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_kexec_load_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 348 long sys_utimensat ['int dfd', ' char __user *filename', 'struct timespec __user *utimes', ' int flags']
 case 348: {
+if (PPP_CHECK_CB(on_sys_utimensat_enter) || PPP_CHECK_CB(on_sys_utimensat_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3348,9 +3901,11 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_utimensat_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 349 long sys_signalfd ['int ufd', ' sigset_t __user *user_mask', ' size_t sizemask']
 case 349: {
+if (PPP_CHECK_CB(on_sys_signalfd_enter) || PPP_CHECK_CB(on_sys_signalfd_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3360,9 +3915,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_signalfd_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 350 long sys_timerfd_create ['int clockid', ' int flags']
 case 350: {
+if (PPP_CHECK_CB(on_sys_timerfd_create_enter) || PPP_CHECK_CB(on_sys_timerfd_create_return)) {
 int32_t arg0 = get_s32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 if (PPP_CHECK_CB(on_sys_timerfd_create_return)) {
@@ -3370,17 +3927,21 @@ memcpy(rp.params[0], &arg0, sizeof(int32_t));
 memcpy(rp.params[1], &arg1, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_timerfd_create_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 351 long sys_eventfd ['unsigned int count']
 case 351: {
+if (PPP_CHECK_CB(on_sys_eventfd_enter) || PPP_CHECK_CB(on_sys_eventfd_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_sys_eventfd_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_eventfd_enter, env,pc,arg0) ; 
+}
 }; break;
 // 352 long sys_fallocate ['int fd', ' int mode', ' loff_t offset', ' loff_t len']
 case 352: {
+if (PPP_CHECK_CB(on_sys_fallocate_enter) || PPP_CHECK_CB(on_sys_fallocate_return)) {
 int32_t arg0 = get_s32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 uint64_t arg2 = get_64(env, 2);
@@ -3392,9 +3953,11 @@ memcpy(rp.params[2], &arg2, sizeof(uint64_t));
 memcpy(rp.params[3], &arg3, sizeof(uint64_t));
 }
 PPP_RUN_CB(on_sys_fallocate_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 353 long sys_timerfd_settime ['int ufd', ' int flags', 'const struct itimerspec __user *utmr', 'struct itimerspec __user *otmr']
 case 353: {
+if (PPP_CHECK_CB(on_sys_timerfd_settime_enter) || PPP_CHECK_CB(on_sys_timerfd_settime_return)) {
 int32_t arg0 = get_s32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3406,9 +3969,11 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_timerfd_settime_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 354 long sys_timerfd_gettime ['int ufd', ' struct itimerspec __user *otmr']
 case 354: {
+if (PPP_CHECK_CB(on_sys_timerfd_gettime_enter) || PPP_CHECK_CB(on_sys_timerfd_gettime_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_sys_timerfd_gettime_return)) {
@@ -3416,9 +3981,11 @@ memcpy(rp.params[0], &arg0, sizeof(int32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_sys_timerfd_gettime_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 355 long sys_signalfd4 ['int ufd', ' sigset_t __user *user_mask', ' size_t sizemask', ' int flags']
 case 355: {
+if (PPP_CHECK_CB(on_sys_signalfd4_enter) || PPP_CHECK_CB(on_sys_signalfd4_return)) {
 int32_t arg0 = get_s32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3430,9 +3997,11 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_signalfd4_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 356 long sys_eventfd2 ['unsigned int count', ' int flags']
 case 356: {
+if (PPP_CHECK_CB(on_sys_eventfd2_enter) || PPP_CHECK_CB(on_sys_eventfd2_return)) {
 uint32_t arg0 = get_32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 if (PPP_CHECK_CB(on_sys_eventfd2_return)) {
@@ -3440,17 +4009,21 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_eventfd2_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 357 long sys_epoll_create1 ['int flags']
 case 357: {
+if (PPP_CHECK_CB(on_sys_epoll_create1_enter) || PPP_CHECK_CB(on_sys_epoll_create1_return)) {
 int32_t arg0 = get_s32(env, 0);
 if (PPP_CHECK_CB(on_sys_epoll_create1_return)) {
 memcpy(rp.params[0], &arg0, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_epoll_create1_enter, env,pc,arg0) ; 
+}
 }; break;
 // 358 long sys_dup3 ['unsigned int oldfd', ' unsigned int newfd', ' int flags']
 case 358: {
+if (PPP_CHECK_CB(on_sys_dup3_enter) || PPP_CHECK_CB(on_sys_dup3_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 int32_t arg2 = get_s32(env, 2);
@@ -3460,9 +4033,11 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_dup3_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 359 long sys_pipe2 ['int __user *', ' int']
 case 359: {
+if (PPP_CHECK_CB(on_sys_pipe2_enter) || PPP_CHECK_CB(on_sys_pipe2_return)) {
 uint32_t arg0 = get_32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 if (PPP_CHECK_CB(on_sys_pipe2_return)) {
@@ -3470,14 +4045,17 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_pipe2_enter, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 360 long sys_inotify_init1 ['int flags']
 case 360: {
+if (PPP_CHECK_CB(on_sys_inotify_init1_enter) || PPP_CHECK_CB(on_sys_inotify_init1_return)) {
 int32_t arg0 = get_s32(env, 0);
 if (PPP_CHECK_CB(on_sys_inotify_init1_return)) {
 memcpy(rp.params[0], &arg0, sizeof(int32_t));
 }
 PPP_RUN_CB(on_sys_inotify_init1_enter, env,pc,arg0) ; 
+}
 }; break;
 // 10420225 long ARM_breakpoint ['']
 case 10420225: {
@@ -3487,6 +4065,7 @@ PPP_RUN_CB(on_ARM_breakpoint_enter, env,pc) ;
 }; break;
 // 10420226 long ARM_cacheflush ['unsigned long start', ' unsigned long end', ' unsigned long flags']
 case 10420226: {
+if (PPP_CHECK_CB(on_ARM_cacheflush_enter) || PPP_CHECK_CB(on_ARM_cacheflush_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3496,6 +4075,7 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_ARM_cacheflush_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 10420227 long ARM_user26_mode ['']
 case 10420227: {
@@ -3511,14 +4091,17 @@ PPP_RUN_CB(on_ARM_usr32_mode_enter, env,pc) ;
 }; break;
 // 10420229 long ARM_set_tls ['unsigned long arg']
 case 10420229: {
+if (PPP_CHECK_CB(on_ARM_set_tls_enter) || PPP_CHECK_CB(on_ARM_set_tls_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_ARM_set_tls_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_ARM_set_tls_enter, env,pc,arg0) ; 
+}
 }; break;
 // 10485744 int ARM_cmpxchg ['unsigned long val', ' unsigned long src', ' unsigned long* dest']
 case 10485744: {
+if (PPP_CHECK_CB(on_ARM_cmpxchg_enter) || PPP_CHECK_CB(on_ARM_cmpxchg_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3528,6 +4111,7 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
 PPP_RUN_CB(on_ARM_cmpxchg_enter, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 10420224 long ARM_null_segfault ['']
 case 10420224: {
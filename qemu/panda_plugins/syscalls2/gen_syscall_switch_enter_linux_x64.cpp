@@ -0,0 +1,4008 @@
+
+
+extern "C" {
+#include "panda_plugin.h" 
+}
+
+#include "syscalls2.h" 
+#include "panda_common.h"
+#include "panda_plugin_plugin.h"
+
+extern "C" {
+#include "gen_syscalls_ext_typedefs.h"
+#include "gen_syscall_ppp_extern_enter.h"
+#include "gen_syscall_ppp_extern_return.h"
+}
+
+void syscall_enter_switch_linux_x64 ( CPUState *env, target_ulong pc ) {  // osarch
+#ifdef TARGET_X86_64                                          // GUARD
+    // zeroed so a return callback registered after this enter sees 0s,
+    // not stack garbage, for args nobody asked us to save
+    ReturnPoint rp = {};
+    rp.ordinal = EAX;                        // CALLNO
+    rp.proc_id = panda_current_asid(env);
+    rp.retaddr = calc_retaddr(env, pc);
+    switch( EAX ) {                          // CALLNO
+// 0 long sys_read ['unsigned int fd', ' char __user *buf', ' size_t count']
+case 0: {
+if (PPP_CHECK_CB(on_sys_read_enter) || PPP_CHECK_CB(on_sys_read_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_read_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_read_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 1 long sys_write ['unsigned int fd', ' const char __user *buf', 'size_t count']
+case 1: {
+if (PPP_CHECK_CB(on_sys_write_enter) || PPP_CHECK_CB(on_sys_write_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_write_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_write_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 2 long sys_open ['const char __user *filename', 'int flags', ' int mode']
+case 2: {
+if (PPP_CHECK_CB(on_sys_open_enter) || PPP_CHECK_CB(on_sys_open_return)) {
+target_ulong arg0 = get_64(env, 0);
+int32_t arg1 = get_s32(env, 1);
+int32_t arg2 = get_s32(env, 2);
+if (PPP_CHECK_CB(on_sys_open_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_open_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 3 long sys_close ['unsigned int fd']
+case 3: {
+if (PPP_CHECK_CB(on_sys_close_enter) || PPP_CHECK_CB(on_sys_close_return)) {
+uint32_t arg0 = get_32(env, 0);
+if (PPP_CHECK_CB(on_sys_close_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_close_enter, env,pc,arg0) ; 
+}
+}; break;
+// 4 long sys_newstat ['const char __user *filename', 'struct stat __user *statbuf']
+case 4: {
+if (PPP_CHECK_CB(on_sys_newstat_enter) || PPP_CHECK_CB(on_sys_newstat_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_newstat_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_newstat_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 5 long sys_newfstat ['unsigned int fd', ' struct stat __user *statbuf']
+case 5: {
+if (PPP_CHECK_CB(on_sys_newfstat_enter) || PPP_CHECK_CB(on_sys_newfstat_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_newfstat_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_newfstat_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 6 long sys_newlstat ['const char __user *filename', 'struct stat __user *statbuf']
+case 6: {
+if (PPP_CHECK_CB(on_sys_newlstat_enter) || PPP_CHECK_CB(on_sys_newlstat_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_newlstat_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_newlstat_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 7 long sys_poll ['struct pollfd __user *ufds', ' unsigned int nfds', 'long timeout']
+case 7: {
+if (PPP_CHECK_CB(on_sys_poll_enter) || PPP_CHECK_CB(on_sys_poll_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_long arg2 = get_s64(env, 2);
+if (PPP_CHECK_CB(on_sys_poll_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_long));
+}
+PPP_RUN_CB(on_sys_poll_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 8 long sys_lseek ['unsigned int fd', ' off_t offset', 'unsigned int origin']
+case 8: {
+if (PPP_CHECK_CB(on_sys_lseek_enter) || PPP_CHECK_CB(on_sys_lseek_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+if (PPP_CHECK_CB(on_sys_lseek_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_lseek_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 9 long sys_mmap ['unsigned long addr', ' unsigned long len', ' unsigned long prot', ' unsigned long flags', ' unsigned long fd', ' unsigned long off']
+case 9: {
+if (PPP_CHECK_CB(on_sys_mmap_enter) || PPP_CHECK_CB(on_sys_mmap_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_sys_mmap_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_mmap_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 10 long sys_mprotect ['unsigned long start', ' size_t len', 'unsigned long prot']
+case 10: {
+if (PPP_CHECK_CB(on_sys_mprotect_enter) || PPP_CHECK_CB(on_sys_mprotect_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_mprotect_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_mprotect_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 11 long sys_munmap ['unsigned long addr', ' size_t len']
+case 11: {
+if (PPP_CHECK_CB(on_sys_munmap_enter) || PPP_CHECK_CB(on_sys_munmap_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_munmap_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_munmap_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 12 long sys_brk ['unsigned long brk']
+case 12: {
+if (PPP_CHECK_CB(on_sys_brk_enter) || PPP_CHECK_CB(on_sys_brk_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_sys_brk_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_brk_enter, env,pc,arg0) ; 
+}
+}; break;
+// 13 long rt_sigaction ['int sig', ' const struct sigaction __user * act', ' struct sigaction __user * oact', '  size_t sigsetsize']
+case 13: {
+if (PPP_CHECK_CB(on_rt_sigaction_enter) || PPP_CHECK_CB(on_rt_sigaction_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_rt_sigaction_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_rt_sigaction_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 14 long sys_rt_sigprocmask ['int how', ' sigset_t __user *set', 'sigset_t __user *oset', ' size_t sigsetsize']
+case 14: {
+if (PPP_CHECK_CB(on_sys_rt_sigprocmask_enter) || PPP_CHECK_CB(on_sys_rt_sigprocmask_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_sys_rt_sigprocmask_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_rt_sigprocmask_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 15 int sys_rt_sigreturn ['unsigned long __unused']
+case 15: {
+if (PPP_CHECK_CB(on_sys_rt_sigreturn_enter) || PPP_CHECK_CB(on_sys_rt_sigreturn_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_sys_rt_sigreturn_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_rt_sigreturn_enter, env,pc,arg0) ; 
+}
+}; break;
+// 16 long sys_ioctl ['unsigned int fd', ' unsigned int cmd', 'unsigned long arg']
+case 16: {
+if (PPP_CHECK_CB(on_sys_ioctl_enter) || PPP_CHECK_CB(on_sys_ioctl_return)) {
+uint32_t arg0 = get_32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_ioctl_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_ioctl_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 17 long sys_pread64 ['unsigned int fd', ' char __user *buf', 'size_t count', ' loff_t pos']
+case 17: {
+if (PPP_CHECK_CB(on_sys_pread64_enter) || PPP_CHECK_CB(on_sys_pread64_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint64_t arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_sys_pread64_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint64_t));
+}
+PPP_RUN_CB(on_sys_pread64_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 18 long sys_pwrite64 ['unsigned int fd', ' const char __user *buf', 'size_t count', ' loff_t pos']
+case 18: {
+if (PPP_CHECK_CB(on_sys_pwrite64_enter) || PPP_CHECK_CB(on_sys_pwrite64_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint64_t arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_sys_pwrite64_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint64_t));
+}
+PPP_RUN_CB(on_sys_pwrite64_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 19 long sys_readv ['unsigned long fd', 'const struct iovec __user *vec', 'unsigned long vlen']
+case 19: {
+if (PPP_CHECK_CB(on_sys_readv_enter) || PPP_CHECK_CB(on_sys_readv_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_readv_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_readv_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 20 long sys_writev ['unsigned long fd', 'const struct iovec __user *vec', 'unsigned long vlen']
+case 20: {
+if (PPP_CHECK_CB(on_sys_writev_enter) || PPP_CHECK_CB(on_sys_writev_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_writev_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_writev_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 21 long sys_access ['const char __user *filename', ' int mode']
+case 21: {
+if (PPP_CHECK_CB(on_sys_access_enter) || PPP_CHECK_CB(on_sys_access_return)) {
+target_ulong arg0 = get_64(env, 0);
+int32_t arg1 = get_s32(env, 1);
+if (PPP_CHECK_CB(on_sys_access_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_access_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 22 long sys_pipe ['int __user *fildes']
+case 22: {
+if (PPP_CHECK_CB(on_sys_pipe_enter) || PPP_CHECK_CB(on_sys_pipe_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_sys_pipe_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_pipe_enter, env,pc,arg0) ; 
+}
+}; break;
+// 23 long sys_select ['int n', ' fd_set __user *inp', ' fd_set __user *outp', 'fd_set __user *exp', ' struct timeval __user *tvp']
+case 23: {
+if (PPP_CHECK_CB(on_sys_select_enter) || PPP_CHECK_CB(on_sys_select_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_sys_select_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_select_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 24 long sys_sched_yield ['void']
+case 24: {
+if (PPP_CHECK_CB(on_sys_sched_yield_return)) {
+}
+PPP_RUN_CB(on_sys_sched_yield_enter, env,pc) ; 
+}; break;
+// 25 long sys_mremap ['unsigned long addr', 'unsigned long old_len', ' unsigned long new_len', 'unsigned long flags', ' unsigned long new_addr']
+case 25: {
+if (PPP_CHECK_CB(on_sys_mremap_enter) || PPP_CHECK_CB(on_sys_mremap_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_sys_mremap_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_mremap_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 26 long sys_msync ['unsigned long start', ' size_t len', ' int flags']
+case 26: {
+if (PPP_CHECK_CB(on_sys_msync_enter) || PPP_CHECK_CB(on_sys_msync_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+int32_t arg2 = get_s32(env, 2);
+if (PPP_CHECK_CB(on_sys_msync_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_msync_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 27 long sys_mincore ['unsigned long start', ' size_t len', 'unsigned char __user * vec']
+case 27: {
+if (PPP_CHECK_CB(on_sys_mincore_enter) || PPP_CHECK_CB(on_sys_mincore_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_mincore_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_mincore_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 28 long sys_madvise ['unsigned long start', ' size_t len', ' int behavior']
+case 28: {
+if (PPP_CHECK_CB(on_sys_madvise_enter) || PPP_CHECK_CB(on_sys_madvise_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+int32_t arg2 = get_s32(env, 2);
+if (PPP_CHECK_CB(on_sys_madvise_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_madvise_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 29 long sys_shmget ['key_t key', ' size_t size', ' int flag']
+case 29: {
+if (PPP_CHECK_CB(on_sys_shmget_enter) || PPP_CHECK_CB(on_sys_shmget_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+int32_t arg2 = get_s32(env, 2);
+if (PPP_CHECK_CB(on_sys_shmget_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_shmget_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 30 long sys_shmat ['int shmid', ' char __user *shmaddr', ' int shmflg']
+case 30: {
+if (PPP_CHECK_CB(on_sys_shmat_enter) || PPP_CHECK_CB(on_sys_shmat_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+int32_t arg2 = get_s32(env, 2);
+if (PPP_CHECK_CB(on_sys_shmat_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_shmat_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 31 long sys_shmctl ['int shmid', ' int cmd', ' struct shmid_ds __user *buf']
+case 31: {
+if (PPP_CHECK_CB(on_sys_shmctl_enter) || PPP_CHECK_CB(on_sys_shmctl_return)) {
+int32_t arg0 = get_s32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_shmctl_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_shmctl_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 32 long sys_dup ['unsigned int fildes']
+case 32: {
+if (PPP_CHECK_CB(on_sys_dup_enter) || PPP_CHECK_CB(on_sys_dup_return)) {
+uint32_t arg0 = get_32(env, 0);
+if (PPP_CHECK_CB(on_sys_dup_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_dup_enter, env,pc,arg0) ; 
+}
+}; break;
+// 33 long sys_dup2 ['unsigned int oldfd', ' unsigned int newfd']
+case 33: {
+if (PPP_CHECK_CB(on_sys_dup2_enter) || PPP_CHECK_CB(on_sys_dup2_return)) {
+uint32_t arg0 = get_32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+if (PPP_CHECK_CB(on_sys_dup2_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_dup2_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 34 long sys_pause ['void']
+case 34: {
+if (PPP_CHECK_CB(on_sys_pause_return)) {
+}
+PPP_RUN_CB(on_sys_pause_enter, env,pc) ; 
+}; break;
+// 35 long sys_nanosleep ['struct timespec __user *rqtp', ' struct timespec __user *rmtp']
+case 35: {
+if (PPP_CHECK_CB(on_sys_nanosleep_enter) || PPP_CHECK_CB(on_sys_nanosleep_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_nanosleep_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_nanosleep_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 36 long sys_getitimer ['int which', ' struct itimerval __user *value']
+case 36: {
+if (PPP_CHECK_CB(on_sys_getitimer_enter) || PPP_CHECK_CB(on_sys_getitimer_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_getitimer_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_getitimer_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 37 long sys_alarm ['unsigned int seconds']
+case 37: {
+if (PPP_CHECK_CB(on_sys_alarm_enter) || PPP_CHECK_CB(on_sys_alarm_return)) {
+uint32_t arg0 = get_32(env, 0);
+if (PPP_CHECK_CB(on_sys_alarm_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_alarm_enter, env,pc,arg0) ; 
+}
+}; break;
+// 38 long sys_setitimer ['int which', 'struct itimerval __user *value', 'struct itimerval __user *ovalue']
+case 38: {
+if (PPP_CHECK_CB(on_sys_setitimer_enter) || PPP_CHECK_CB(on_sys_setitimer_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_setitimer_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_setitimer_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 39 long sys_getpid ['void']
+case 39: {
+if (PPP_CHECK_CB(on_sys_getpid_return)) {
+}
+PPP_RUN_CB(on_sys_getpid_enter, env,pc) ; 
+}; break;
+// 40 long sys_sendfile64 ['int out_fd', ' int in_fd', 'loff_t __user *offset', ' size_t count']
+case 40: {
+if (PPP_CHECK_CB(on_sys_sendfile64_enter) || PPP_CHECK_CB(on_sys_sendfile64_return)) {
+int32_t arg0 = get_s32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_sys_sendfile64_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_sendfile64_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 41 long sys_socket ['int', ' int', ' int']
+case 41: {
+if (PPP_CHECK_CB(on_sys_socket_enter) || PPP_CHECK_CB(on_sys_socket_return)) {
+int32_t arg0 = get_s32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+int32_t arg2 = get_s32(env, 2);
+if (PPP_CHECK_CB(on_sys_socket_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_socket_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 42 long sys_connect ['int', ' struct sockaddr __user *', ' int']
+case 42: {
+if (PPP_CHECK_CB(on_sys_connect_enter) || PPP_CHECK_CB(on_sys_connect_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+int32_t arg2 = get_s32(env, 2);
+if (PPP_CHECK_CB(on_sys_connect_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_connect_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 43 long sys_accept ['int', ' struct sockaddr __user *', ' int __user *']
+case 43: {
+if (PPP_CHECK_CB(on_sys_accept_enter) || PPP_CHECK_CB(on_sys_accept_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_accept_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_accept_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 44 long sys_sendto ['int', ' void __user *', ' size_t', ' unsigned', 'struct sockaddr __user *', ' int']
+case 44: {
+if (PPP_CHECK_CB(on_sys_sendto_enter) || PPP_CHECK_CB(on_sys_sendto_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+int32_t arg5 = get_s32(env, 5);
+if (PPP_CHECK_CB(on_sys_sendto_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_sendto_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 45 long sys_recvfrom ['int', ' void __user *', ' size_t', ' unsigned', 'struct sockaddr __user *', ' int __user *']
+case 45: {
+if (PPP_CHECK_CB(on_sys_recvfrom_enter) || PPP_CHECK_CB(on_sys_recvfrom_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_sys_recvfrom_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_recvfrom_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 46 long sys_sendmsg ['int fd', ' struct msghdr __user *msg', ' unsigned flags']
+case 46: {
+if (PPP_CHECK_CB(on_sys_sendmsg_enter) || PPP_CHECK_CB(on_sys_sendmsg_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+if (PPP_CHECK_CB(on_sys_sendmsg_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_sendmsg_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 47 long sys_recvmsg ['int fd', ' struct msghdr __user *msg', ' unsigned flags']
+case 47: {
+if (PPP_CHECK_CB(on_sys_recvmsg_enter) || PPP_CHECK_CB(on_sys_recvmsg_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+if (PPP_CHECK_CB(on_sys_recvmsg_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_recvmsg_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 48 long sys_shutdown ['int', ' int']
+case 48: {
+if (PPP_CHECK_CB(on_sys_shutdown_enter) || PPP_CHECK_CB(on_sys_shutdown_return)) {
+int32_t arg0 = get_s32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+if (PPP_CHECK_CB(on_sys_shutdown_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_shutdown_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 49 long sys_bind ['int', ' struct sockaddr __user *', ' int']
+case 49: {
+if (PPP_CHECK_CB(on_sys_bind_enter) || PPP_CHECK_CB(on_sys_bind_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+int32_t arg2 = get_s32(env, 2);
+if (PPP_CHECK_CB(on_sys_bind_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_bind_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 50 long sys_listen ['int', ' int']
+case 50: {
+if (PPP_CHECK_CB(on_sys_listen_enter) || PPP_CHECK_CB(on_sys_listen_return)) {
+int32_t arg0 = get_s32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+if (PPP_CHECK_CB(on_sys_listen_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_listen_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 51 long sys_getsockname ['int', ' struct sockaddr __user *', ' int __user *']
+case 51: {
+if (PPP_CHECK_CB(on_sys_getsockname_enter) || PPP_CHECK_CB(on_sys_getsockname_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_getsockname_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_getsockname_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 52 long sys_getpeername ['int', ' struct sockaddr __user *', ' int __user *']
+case 52: {
+if (PPP_CHECK_CB(on_sys_getpeername_enter) || PPP_CHECK_CB(on_sys_getpeername_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_getpeername_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_getpeername_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 53 long sys_socketpair ['int', ' int', ' int', ' int __user *']
+case 53: {
+if (PPP_CHECK_CB(on_sys_socketpair_enter) || PPP_CHECK_CB(on_sys_socketpair_return)) {
+int32_t arg0 = get_s32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+int32_t arg2 = get_s32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_sys_socketpair_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_socketpair_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 54 long sys_setsockopt ['int fd', ' int level', ' int optname', 'char __user *optval', ' int optlen']
+case 54: {
+if (PPP_CHECK_CB(on_sys_setsockopt_enter) || PPP_CHECK_CB(on_sys_setsockopt_return)) {
+int32_t arg0 = get_s32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+int32_t arg2 = get_s32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+int32_t arg4 = get_s32(env, 4);
+if (PPP_CHECK_CB(on_sys_setsockopt_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_setsockopt_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 55 long sys_getsockopt ['int fd', ' int level', ' int optname', 'char __user *optval', ' int __user *optlen']
+case 55: {
+if (PPP_CHECK_CB(on_sys_getsockopt_enter) || PPP_CHECK_CB(on_sys_getsockopt_return)) {
+int32_t arg0 = get_s32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+int32_t arg2 = get_s32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_sys_getsockopt_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_getsockopt_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 56 long sys_clone ['unsigned long flags', ' void *child_stack', ' void *ptid', ' void *ctid', ' unsigned long tls']
+case 56: {
+if (PPP_CHECK_CB(on_sys_clone_enter) || PPP_CHECK_CB(on_sys_clone_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_sys_clone_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_clone_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 57 pid_t sys_fork ['']
+case 57: {
+if (PPP_CHECK_CB(on_sys_fork_return)) {
+}
+PPP_RUN_CB(on_sys_fork_enter, env,pc) ; 
+}; break;
+// 58 pid_t sys_vfork ['']
+case 58: {
+if (PPP_CHECK_CB(on_sys_vfork_return)) {
+}
+PPP_RUN_CB(on_sys_vfork_enter, env,pc) ; 
+}; break;
+// 59 int sys_execve ['const char *filename', ' const char *argv[]', ' const char *const envp[]']
+case 59: {
+if (PPP_CHECK_CB(on_sys_execve_enter) || PPP_CHECK_CB(on_sys_execve_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_execve_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_execve_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 60 long sys_exit ['int error_code']
+case 60: {
+if (PPP_CHECK_CB(on_sys_exit_enter) || PPP_CHECK_CB(on_sys_exit_return)) {
+int32_t arg0 = get_s32(env, 0);
+if (PPP_CHECK_CB(on_sys_exit_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_exit_enter, env,pc,arg0) ; 
+}
+}; break;
+// 61 long sys_wait4 ['pid_t pid', ' int __user *stat_addr', 'int options', ' struct rusage __user *ru']
+case 61: {
+if (PPP_CHECK_CB(on_sys_wait4_enter) || PPP_CHECK_CB(on_sys_wait4_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+int32_t arg2 = get_s32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_sys_wait4_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_wait4_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 62 long sys_kill ['int pid', ' int sig']
+case 62: {
+if (PPP_CHECK_CB(on_sys_kill_enter) || PPP_CHECK_CB(on_sys_kill_return)) {
+int32_t arg0 = get_s32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+if (PPP_CHECK_CB(on_sys_kill_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_kill_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 63 long sys_newuname ['struct new_utsname __user *name']
+case 63: {
+if (PPP_CHECK_CB(on_sys_newuname_enter) || PPP_CHECK_CB(on_sys_newuname_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_sys_newuname_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_newuname_enter, env,pc,arg0) ; 
+}
+}; break;
+// 64 long sys_semget ['key_t key', ' int nsems', ' int semflg']
+case 64: {
+if (PPP_CHECK_CB(on_sys_semget_enter) || PPP_CHECK_CB(on_sys_semget_return)) {
+uint32_t arg0 = get_32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+int32_t arg2 = get_s32(env, 2);
+if (PPP_CHECK_CB(on_sys_semget_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_semget_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 65 long sys_semop ['int semid', ' struct sembuf __user *sops', 'unsigned nsops']
+case 65: {
+if (PPP_CHECK_CB(on_sys_semop_enter) || PPP_CHECK_CB(on_sys_semop_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+if (PPP_CHECK_CB(on_sys_semop_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_semop_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 66 long sys_semctl ['int semid', ' int semnum', ' int cmd', ' union semun arg']
+case 66: {
+if (PPP_CHECK_CB(on_sys_semctl_enter) || PPP_CHECK_CB(on_sys_semctl_return)) {
+int32_t arg0 = get_s32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+int32_t arg2 = get_s32(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_sys_semctl_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_semctl_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 67 long sys_shmdt ['char __user *shmaddr']
+case 67: {
+if (PPP_CHECK_CB(on_sys_shmdt_enter) || PPP_CHECK_CB(on_sys_shmdt_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_sys_shmdt_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_shmdt_enter, env,pc,arg0) ; 
+}
+}; break;
+// 68 long sys_msgget ['key_t key', ' int msgflg']
+case 68: {
+if (PPP_CHECK_CB(on_sys_msgget_enter) || PPP_CHECK_CB(on_sys_msgget_return)) {
+uint32_t arg0 = get_32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+if (PPP_CHECK_CB(on_sys_msgget_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_msgget_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 69 long sys_msgsnd ['int msqid', ' struct msgbuf __user *msgp', 'size_t msgsz', ' int msgflg']
+case 69: {
+if (PPP_CHECK_CB(on_sys_msgsnd_enter) || PPP_CHECK_CB(on_sys_msgsnd_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+int32_t arg3 = get_s32(env, 3);
+if (PPP_CHECK_CB(on_sys_msgsnd_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_msgsnd_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 70 long sys_msgrcv ['int msqid', ' struct msgbuf __user *msgp', 'size_t msgsz', ' long msgtyp', ' int msgflg']
+case 70: {
+if (PPP_CHECK_CB(on_sys_msgrcv_enter) || PPP_CHECK_CB(on_sys_msgrcv_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_long arg3 = get_s64(env, 3);
+int32_t arg4 = get_s32(env, 4);
+if (PPP_CHECK_CB(on_sys_msgrcv_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_long));
+memcpy(rp.params[4], &arg4, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_msgrcv_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 71 long sys_msgctl ['int msqid', ' int cmd', ' struct msqid_ds __user *buf']
+case 71: {
+if (PPP_CHECK_CB(on_sys_msgctl_enter) || PPP_CHECK_CB(on_sys_msgctl_return)) {
+int32_t arg0 = get_s32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_msgctl_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_msgctl_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 72 long sys_fcntl ['unsigned int fd', ' unsigned int cmd', ' unsigned long arg']
+case 72: {
+if (PPP_CHECK_CB(on_sys_fcntl_enter) || PPP_CHECK_CB(on_sys_fcntl_return)) {
+uint32_t arg0 = get_32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_fcntl_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_fcntl_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 73 long sys_flock ['unsigned int fd', ' unsigned int cmd']
+case 73: {
+if (PPP_CHECK_CB(on_sys_flock_enter) || PPP_CHECK_CB(on_sys_flock_return)) {
+uint32_t arg0 = get_32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+if (PPP_CHECK_CB(on_sys_flock_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_flock_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 74 long sys_fsync ['unsigned int fd']
+case 74: {
+if (PPP_CHECK_CB(on_sys_fsync_enter) || PPP_CHECK_CB(on_sys_fsync_return)) {
+uint32_t arg0 = get_32(env, 0);
+if (PPP_CHECK_CB(on_sys_fsync_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_fsync_enter, env,pc,arg0) ; 
+}
+}; break;
+// 75 long sys_fdatasync ['unsigned int fd']
+case 75: {
+if (PPP_CHECK_CB(on_sys_fdatasync_enter) || PPP_CHECK_CB(on_sys_fdatasync_return)) {
+uint32_t arg0 = get_32(env, 0);
+if (PPP_CHECK_CB(on_sys_fdatasync_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_fdatasync_enter, env,pc,arg0) ; 
+}
+}; break;
+// 76 long sys_truncate ['const char __user *path', ' long length']
+case 76: {
+if (PPP_CHECK_CB(on_sys_truncate_enter) || PPP_CHECK_CB(on_sys_truncate_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_long arg1 = get_s64(env, 1);
+if (PPP_CHECK_CB(on_sys_truncate_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_long));
+}
+PPP_RUN_CB(on_sys_truncate_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 77 long sys_ftruncate ['unsigned int fd', ' unsigned long length']
+case 77: {
+if (PPP_CHECK_CB(on_sys_ftruncate_enter) || PPP_CHECK_CB(on_sys_ftruncate_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_ftruncate_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_ftruncate_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 78 long sys_getdents ['unsigned int fd', 'struct linux_dirent __user *dirent', 'unsigned int count']
+case 78: {
+if (PPP_CHECK_CB(on_sys_getdents_enter) || PPP_CHECK_CB(on_sys_getdents_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+if (PPP_CHECK_CB(on_sys_getdents_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_getdents_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 79 long sys_getcwd ['char __user *buf', ' unsigned long size']
+case 79: {
+if (PPP_CHECK_CB(on_sys_getcwd_enter) || PPP_CHECK_CB(on_sys_getcwd_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_getcwd_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_getcwd_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 80 long sys_chdir ['const char __user *filename']
+case 80: {
+if (PPP_CHECK_CB(on_sys_chdir_enter) || PPP_CHECK_CB(on_sys_chdir_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_sys_chdir_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_chdir_enter, env,pc,arg0) ; 
+}
+}; break;
+// 81 long sys_fchdir ['unsigned int fd']
+case 81: {
+if (PPP_CHECK_CB(on_sys_fchdir_enter) || PPP_CHECK_CB(on_sys_fchdir_return)) {
+uint32_t arg0 = get_32(env, 0);
+if (PPP_CHECK_CB(on_sys_fchdir_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_fchdir_enter, env,pc,arg0) ; 
+}
+}; break;
+// 82 long sys_rename ['const char __user *oldname', 'const char __user *newname']
+case 82: {
+if (PPP_CHECK_CB(on_sys_rename_enter) || PPP_CHECK_CB(on_sys_rename_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_rename_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_rename_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 83 long sys_mkdir ['const char __user *pathname', ' int mode']
+case 83: {
+if (PPP_CHECK_CB(on_sys_mkdir_enter) || PPP_CHECK_CB(on_sys_mkdir_return)) {
+target_ulong arg0 = get_64(env, 0);
+int32_t arg1 = get_s32(env, 1);
+if (PPP_CHECK_CB(on_sys_mkdir_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_mkdir_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 84 long sys_rmdir ['const char __user *pathname']
+case 84: {
+if (PPP_CHECK_CB(on_sys_rmdir_enter) || PPP_CHECK_CB(on_sys_rmdir_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_sys_rmdir_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_rmdir_enter, env,pc,arg0) ; 
+}
+}; break;
+// 85 long sys_creat ['const char __user *pathname', ' int mode']
+case 85: {
+if (PPP_CHECK_CB(on_sys_creat_enter) || PPP_CHECK_CB(on_sys_creat_return)) {
+target_ulong arg0 = get_64(env, 0);
+int32_t arg1 = get_s32(env, 1);
+if (PPP_CHECK_CB(on_sys_creat_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_creat_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 86 long sys_link ['const char __user *oldname', 'const char __user *newname']
+case 86: {
+if (PPP_CHECK_CB(on_sys_link_enter) || PPP_CHECK_CB(on_sys_link_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_link_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_link_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 87 long sys_unlink ['const char __user *pathname']
+case 87: {
+if (PPP_CHECK_CB(on_sys_unlink_enter) || PPP_CHECK_CB(on_sys_unlink_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_sys_unlink_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_unlink_enter, env,pc,arg0) ; 
+}
+}; break;
+// 88 long sys_symlink ['const char __user *old', ' const char __user *new']
+case 88: {
+if (PPP_CHECK_CB(on_sys_symlink_enter) || PPP_CHECK_CB(on_sys_symlink_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_symlink_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_symlink_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 89 long sys_readlink ['const char __user *path', 'char __user *buf', ' int bufsiz']
+case 89: {
+if (PPP_CHECK_CB(on_sys_readlink_enter) || PPP_CHECK_CB(on_sys_readlink_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+int32_t arg2 = get_s32(env, 2);
+if (PPP_CHECK_CB(on_sys_readlink_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_readlink_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 90 long sys_chmod ['const char __user *filename', ' mode_t mode']
+case 90: {
+if (PPP_CHECK_CB(on_sys_chmod_enter) || PPP_CHECK_CB(on_sys_chmod_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+if (PPP_CHECK_CB(on_sys_chmod_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_chmod_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 91 long sys_fchmod ['unsigned int fd', ' mode_t mode']
+case 91: {
+if (PPP_CHECK_CB(on_sys_fchmod_enter) || PPP_CHECK_CB(on_sys_fchmod_return)) {
+uint32_t arg0 = get_32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+if (PPP_CHECK_CB(on_sys_fchmod_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_fchmod_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 92 long sys_chown ['const char __user *filename', 'uid_t user', ' gid_t group']
+case 92: {
+if (PPP_CHECK_CB(on_sys_chown_enter) || PPP_CHECK_CB(on_sys_chown_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+uint32_t arg2 = get_32(env, 2);
+if (PPP_CHECK_CB(on_sys_chown_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_chown_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 93 long sys_fchown ['unsigned int fd', ' uid_t user', ' gid_t group']
+case 93: {
+if (PPP_CHECK_CB(on_sys_fchown_enter) || PPP_CHECK_CB(on_sys_fchown_return)) {
+uint32_t arg0 = get_32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+uint32_t arg2 = get_32(env, 2);
+if (PPP_CHECK_CB(on_sys_fchown_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_fchown_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 94 long sys_lchown ['const char __user *filename', 'uid_t user', ' gid_t group']
+case 94: {
+if (PPP_CHECK_CB(on_sys_lchown_enter) || PPP_CHECK_CB(on_sys_lchown_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+uint32_t arg2 = get_32(env, 2);
+if (PPP_CHECK_CB(on_sys_lchown_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_lchown_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 95 long sys_umask ['int mask']
+case 95: {
+if (PPP_CHECK_CB(on_sys_umask_enter) || PPP_CHECK_CB(on_sys_umask_return)) {
+int32_t arg0 = get_s32(env, 0);
+if (PPP_CHECK_CB(on_sys_umask_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_umask_enter, env,pc,arg0) ; 
+}
+}; break;
+// 96 long sys_gettimeofday ['struct timeval __user *tv', 'struct timezone __user *tz']
+case 96: {
+if (PPP_CHECK_CB(on_sys_gettimeofday_enter) || PPP_CHECK_CB(on_sys_gettimeofday_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_gettimeofday_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_gettimeofday_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 97 long sys_getrlimit ['unsigned int resource', 'struct rlimit __user *rlim']
+case 97: {
+if (PPP_CHECK_CB(on_sys_getrlimit_enter) || PPP_CHECK_CB(on_sys_getrlimit_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_getrlimit_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_getrlimit_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 98 long sys_getrusage ['int who', ' struct rusage __user *ru']
+case 98: {
+if (PPP_CHECK_CB(on_sys_getrusage_enter) || PPP_CHECK_CB(on_sys_getrusage_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_getrusage_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_getrusage_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 99 long sys_sysinfo ['struct sysinfo __user *info']
+case 99: {
+if (PPP_CHECK_CB(on_sys_sysinfo_enter) || PPP_CHECK_CB(on_sys_sysinfo_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_sys_sysinfo_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_sysinfo_enter, env,pc,arg0) ; 
+}
+}; break;
+// 100 long sys_times ['struct tms __user *tbuf']
+case 100: {
+if (PPP_CHECK_CB(on_sys_times_enter) || PPP_CHECK_CB(on_sys_times_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_sys_times_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_times_enter, env,pc,arg0) ; 
+}
+}; break;
+// 101 long sys_ptrace ['long request', ' long pid', ' unsigned long addr', 'unsigned long data']
+case 101: {
+if (PPP_CHECK_CB(on_sys_ptrace_enter) || PPP_CHECK_CB(on_sys_ptrace_return)) {
+target_long arg0 = get_s64(env, 0);
+target_long arg1 = get_s64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_sys_ptrace_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_long));
+memcpy(rp.params[1], &arg1, sizeof(target_long));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_ptrace_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 102 long sys_getuid ['void']
+case 102: {
+if (PPP_CHECK_CB(on_sys_getuid_return)) {
+}
+PPP_RUN_CB(on_sys_getuid_enter, env,pc) ; 
+}; break;
+// 103 long sys_syslog ['int type', ' char __user *buf', ' int len']
+case 103: {
+if (PPP_CHECK_CB(on_sys_syslog_enter) || PPP_CHECK_CB(on_sys_syslog_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+int32_t arg2 = get_s32(env, 2);
+if (PPP_CHECK_CB(on_sys_syslog_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_syslog_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 104 long sys_getgid ['void']
+case 104: {
+if (PPP_CHECK_CB(on_sys_getgid_return)) {
+}
+PPP_RUN_CB(on_sys_getgid_enter, env,pc) ; 
+}; break;
+// 105 long sys_setuid ['uid_t uid']
+case 105: {
+if (PPP_CHECK_CB(on_sys_setuid_enter) || PPP_CHECK_CB(on_sys_setuid_return)) {
+uint32_t arg0 = get_32(env, 0);
+if (PPP_CHECK_CB(on_sys_setuid_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_setuid_enter, env,pc,arg0) ; 
+}
+}; break;
+// 106 long sys_setgid ['gid_t gid']
+case 106: {
+if (PPP_CHECK_CB(on_sys_setgid_enter) || PPP_CHECK_CB(on_sys_setgid_return)) {
+uint32_t arg0 = get_32(env, 0);
+if (PPP_CHECK_CB(on_sys_setgid_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_setgid_enter, env,pc,arg0) ; 
+}
+}; break;
+// 107 long sys_geteuid ['void']
+case 107: {
+if (PPP_CHECK_CB(on_sys_geteuid_return)) {
+}
+PPP_RUN_CB(on_sys_geteuid_enter, env,pc) ; 
+}; break;
+// 108 long sys_getegid ['void']
+case 108: {
+if (PPP_CHECK_CB(on_sys_getegid_return)) {
+}
+PPP_RUN_CB(on_sys_getegid_enter, env,pc) ; 
+}; break;
+// 109 long sys_setpgid ['pid_t pid', ' pid_t pgid']
+case 109: {
+if (PPP_CHECK_CB(on_sys_setpgid_enter) || PPP_CHECK_CB(on_sys_setpgid_return)) {
+uint32_t arg0 = get_32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+if (PPP_CHECK_CB(on_sys_setpgid_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_setpgid_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 110 long sys_getppid ['void']
+case 110: {
+if (PPP_CHECK_CB(on_sys_getppid_return)) {
+}
+PPP_RUN_CB(on_sys_getppid_enter, env,pc) ; 
+}; break;
+// 111 long sys_getpgrp ['void']
+case 111: {
+if (PPP_CHECK_CB(on_sys_getpgrp_return)) {
+}
+PPP_RUN_CB(on_sys_getpgrp_enter, env,pc) ; 
+}; break;
+// 112 long sys_setsid ['void']
+case 112: {
+if (PPP_CHECK_CB(on_sys_setsid_return)) {
+}
+PPP_RUN_CB(on_sys_setsid_enter, env,pc) ; 
+}; break;
+// 113 long sys_setreuid ['uid_t ruid', ' uid_t euid']
+case 113: {
+if (PPP_CHECK_CB(on_sys_setreuid_enter) || PPP_CHECK_CB(on_sys_setreuid_return)) {
+uint32_t arg0 = get_32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+if (PPP_CHECK_CB(on_sys_setreuid_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_setreuid_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 114 long sys_setregid ['gid_t rgid', ' gid_t egid']
+case 114: {
+if (PPP_CHECK_CB(on_sys_setregid_enter) || PPP_CHECK_CB(on_sys_setregid_return)) {
+uint32_t arg0 = get_32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+if (PPP_CHECK_CB(on_sys_setregid_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_setregid_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 115 long sys_getgroups ['int gidsetsize', ' gid_t __user *grouplist']
+case 115: {
+if (PPP_CHECK_CB(on_sys_getgroups_enter) || PPP_CHECK_CB(on_sys_getgroups_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_getgroups_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_getgroups_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 116 long sys_setgroups ['int gidsetsize', ' gid_t __user *grouplist']
+case 116: {
+if (PPP_CHECK_CB(on_sys_setgroups_enter) || PPP_CHECK_CB(on_sys_setgroups_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_setgroups_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_setgroups_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 117 long sys_setresuid ['uid_t ruid', ' uid_t euid', ' uid_t suid']
+case 117: {
+if (PPP_CHECK_CB(on_sys_setresuid_enter) || PPP_CHECK_CB(on_sys_setresuid_return)) {
+uint32_t arg0 = get_32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+uint32_t arg2 = get_32(env, 2);
+if (PPP_CHECK_CB(on_sys_setresuid_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_setresuid_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 118 long sys_getresuid ['uid_t __user *ruid', ' uid_t __user *euid', ' uid_t __user *suid']
+case 118: {
+if (PPP_CHECK_CB(on_sys_getresuid_enter) || PPP_CHECK_CB(on_sys_getresuid_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_getresuid_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_getresuid_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 119 long sys_setresgid ['gid_t rgid', ' gid_t egid', ' gid_t sgid']
+case 119: {
+if (PPP_CHECK_CB(on_sys_setresgid_enter) || PPP_CHECK_CB(on_sys_setresgid_return)) {
+uint32_t arg0 = get_32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+uint32_t arg2 = get_32(env, 2);
+if (PPP_CHECK_CB(on_sys_setresgid_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_setresgid_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 120 long sys_getresgid ['gid_t __user *rgid', ' gid_t __user *egid', ' gid_t __user *sgid']
+case 120: {
+if (PPP_CHECK_CB(on_sys_getresgid_enter) || PPP_CHECK_CB(on_sys_getresgid_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_getresgid_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_getresgid_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 121 long sys_getpgid ['pid_t pid']
+case 121: {
+if (PPP_CHECK_CB(on_sys_getpgid_enter) || PPP_CHECK_CB(on_sys_getpgid_return)) {
+uint32_t arg0 = get_32(env, 0);
+if (PPP_CHECK_CB(on_sys_getpgid_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_getpgid_enter, env,pc,arg0) ; 
+}
+}; break;
+// 122 long sys_setfsuid ['uid_t uid']
+case 122: {
+if (PPP_CHECK_CB(on_sys_setfsuid_enter) || PPP_CHECK_CB(on_sys_setfsuid_return)) {
+uint32_t arg0 = get_32(env, 0);
+if (PPP_CHECK_CB(on_sys_setfsuid_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_setfsuid_enter, env,pc,arg0) ; 
+}
+}; break;
+// 123 long sys_setfsgid ['gid_t gid']
+case 123: {
+if (PPP_CHECK_CB(on_sys_setfsgid_enter) || PPP_CHECK_CB(on_sys_setfsgid_return)) {
+uint32_t arg0 = get_32(env, 0);
+if (PPP_CHECK_CB(on_sys_setfsgid_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_setfsgid_enter, env,pc,arg0) ; 
+}
+}; break;
+// 124 long sys_getsid ['pid_t pid']
+case 124: {
+if (PPP_CHECK_CB(on_sys_getsid_enter) || PPP_CHECK_CB(on_sys_getsid_return)) {
+uint32_t arg0 = get_32(env, 0);
+if (PPP_CHECK_CB(on_sys_getsid_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_getsid_enter, env,pc,arg0) ; 
+}
+}; break;
+// 125 long sys_capget ['cap_user_header_t header', 'cap_user_data_t dataptr']
+case 125: {
+if (PPP_CHECK_CB(on_sys_capget_enter) || PPP_CHECK_CB(on_sys_capget_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_capget_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_capget_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 126 long sys_capset ['cap_user_header_t header', 'const cap_user_data_t data']
+case 126: {
+if (PPP_CHECK_CB(on_sys_capset_enter) || PPP_CHECK_CB(on_sys_capset_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_capset_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_capset_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 127 long sys_rt_sigpending ['sigset_t __user *set', ' size_t sigsetsize']
+case 127: {
+if (PPP_CHECK_CB(on_sys_rt_sigpending_enter) || PPP_CHECK_CB(on_sys_rt_sigpending_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_rt_sigpending_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_rt_sigpending_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 128 long sys_rt_sigtimedwait ['const sigset_t __user *uthese', 'siginfo_t __user *uinfo', 'const struct timespec __user *uts', 'size_t sigsetsize']
+case 128: {
+if (PPP_CHECK_CB(on_sys_rt_sigtimedwait_enter) || PPP_CHECK_CB(on_sys_rt_sigtimedwait_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_sys_rt_sigtimedwait_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_rt_sigtimedwait_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 129 long sys_rt_sigqueueinfo ['int pid', ' int sig', ' siginfo_t __user *uinfo']
+case 129: {
+if (PPP_CHECK_CB(on_sys_rt_sigqueueinfo_enter) || PPP_CHECK_CB(on_sys_rt_sigqueueinfo_return)) {
+int32_t arg0 = get_s32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_rt_sigqueueinfo_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_rt_sigqueueinfo_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 130 int sys_rt_sigsuspend ['sigset_t __user *unewset', ' size_t sigsetsize']
+case 130: {
+if (PPP_CHECK_CB(on_sys_rt_sigsuspend_enter) || PPP_CHECK_CB(on_sys_rt_sigsuspend_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_rt_sigsuspend_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_rt_sigsuspend_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 131 int sys_sigaltstack ['const stack_t *ss', ' stack_t *oss']
+case 131: {
+if (PPP_CHECK_CB(on_sys_sigaltstack_enter) || PPP_CHECK_CB(on_sys_sigaltstack_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_sigaltstack_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_sigaltstack_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 132 long sys_utime ['char __user *filename', 'struct utimbuf __user *times']
+case 132: {
+if (PPP_CHECK_CB(on_sys_utime_enter) || PPP_CHECK_CB(on_sys_utime_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_utime_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_utime_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 133 long sys_mknod ['const char __user *filename', ' int mode', 'unsigned dev']
+case 133: {
+if (PPP_CHECK_CB(on_sys_mknod_enter) || PPP_CHECK_CB(on_sys_mknod_return)) {
+target_ulong arg0 = get_64(env, 0);
+int32_t arg1 = get_s32(env, 1);
+uint32_t arg2 = get_32(env, 2);
+if (PPP_CHECK_CB(on_sys_mknod_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_mknod_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 134 long sys_uselib ['const char __user *library']
+case 134: {
+if (PPP_CHECK_CB(on_sys_uselib_enter) || PPP_CHECK_CB(on_sys_uselib_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_sys_uselib_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_uselib_enter, env,pc,arg0) ; 
+}
+}; break;
+// 135 long sys_personality ['unsigned int personality']
+case 135: {
+if (PPP_CHECK_CB(on_sys_personality_enter) || PPP_CHECK_CB(on_sys_personality_return)) {
+uint32_t arg0 = get_32(env, 0);
+if (PPP_CHECK_CB(on_sys_personality_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_personality_enter, env,pc,arg0) ; 
+}
+}; break;
+// 136 long sys_ustat ['unsigned dev', ' struct ustat __user *ubuf']
+case 136: {
+if (PPP_CHECK_CB(on_sys_ustat_enter) || PPP_CHECK_CB(on_sys_ustat_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_ustat_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_ustat_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 137 long sys_statfs ['const char __user * path', 'struct statfs __user *buf']
+case 137: {
+if (PPP_CHECK_CB(on_sys_statfs_enter) || PPP_CHECK_CB(on_sys_statfs_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_statfs_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_statfs_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 138 long sys_fstatfs ['unsigned int fd', ' struct statfs __user *buf']
+case 138: {
+if (PPP_CHECK_CB(on_sys_fstatfs_enter) || PPP_CHECK_CB(on_sys_fstatfs_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_fstatfs_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_fstatfs_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 139 long sys_sysfs ['int option', 'unsigned long arg1', ' unsigned long arg2']
+case 139: {
+if (PPP_CHECK_CB(on_sys_sysfs_enter) || PPP_CHECK_CB(on_sys_sysfs_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_sysfs_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_sysfs_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 140 long sys_getpriority ['int which', ' int who']
+case 140: {
+if (PPP_CHECK_CB(on_sys_getpriority_enter) || PPP_CHECK_CB(on_sys_getpriority_return)) {
+int32_t arg0 = get_s32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+if (PPP_CHECK_CB(on_sys_getpriority_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_getpriority_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 141 long sys_setpriority ['int which', ' int who', ' int niceval']
+case 141: {
+if (PPP_CHECK_CB(on_sys_setpriority_enter) || PPP_CHECK_CB(on_sys_setpriority_return)) {
+int32_t arg0 = get_s32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+int32_t arg2 = get_s32(env, 2);
+if (PPP_CHECK_CB(on_sys_setpriority_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_setpriority_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 142 long sys_sched_setparam ['pid_t pid', 'struct sched_param __user *param']
+case 142: {
+if (PPP_CHECK_CB(on_sys_sched_setparam_enter) || PPP_CHECK_CB(on_sys_sched_setparam_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_sched_setparam_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_sched_setparam_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 143 long sys_sched_getparam ['pid_t pid', 'struct sched_param __user *param']
+case 143: {
+if (PPP_CHECK_CB(on_sys_sched_getparam_enter) || PPP_CHECK_CB(on_sys_sched_getparam_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_sched_getparam_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_sched_getparam_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 144 long sys_sched_setscheduler ['pid_t pid', ' int policy', 'struct sched_param __user *param']
+case 144: {
+if (PPP_CHECK_CB(on_sys_sched_setscheduler_enter) || PPP_CHECK_CB(on_sys_sched_setscheduler_return)) {
+uint32_t arg0 = get_32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_sched_setscheduler_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_sched_setscheduler_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 145 long sys_sched_getscheduler ['pid_t pid']
+case 145: {
+if (PPP_CHECK_CB(on_sys_sched_getscheduler_enter) || PPP_CHECK_CB(on_sys_sched_getscheduler_return)) {
+uint32_t arg0 = get_32(env, 0);
+if (PPP_CHECK_CB(on_sys_sched_getscheduler_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_sched_getscheduler_enter, env,pc,arg0) ; 
+}
+}; break;
+// 146 long sys_sched_get_priority_max ['int policy']
+case 146: {
+if (PPP_CHECK_CB(on_sys_sched_get_priority_max_enter) || PPP_CHECK_CB(on_sys_sched_get_priority_max_return)) {
+int32_t arg0 = get_s32(env, 0);
+if (PPP_CHECK_CB(on_sys_sched_get_priority_max_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_sched_get_priority_max_enter, env,pc,arg0) ; 
+}
+}; break;
+// 147 long sys_sched_get_priority_min ['int policy']
+case 147: {
+if (PPP_CHECK_CB(on_sys_sched_get_priority_min_enter) || PPP_CHECK_CB(on_sys_sched_get_priority_min_return)) {
+int32_t arg0 = get_s32(env, 0);
+if (PPP_CHECK_CB(on_sys_sched_get_priority_min_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_sched_get_priority_min_enter, env,pc,arg0) ; 
+}
+}; break;
+// 148 long sys_sched_rr_get_interval ['pid_t pid', 'struct timespec __user *interval']
+case 148: {
+if (PPP_CHECK_CB(on_sys_sched_rr_get_interval_enter) || PPP_CHECK_CB(on_sys_sched_rr_get_interval_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_sched_rr_get_interval_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_sched_rr_get_interval_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 149 long sys_mlock ['unsigned long start', ' size_t len']
+case 149: {
+if (PPP_CHECK_CB(on_sys_mlock_enter) || PPP_CHECK_CB(on_sys_mlock_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_mlock_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_mlock_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 150 long sys_munlock ['unsigned long start', ' size_t len']
+case 150: {
+if (PPP_CHECK_CB(on_sys_munlock_enter) || PPP_CHECK_CB(on_sys_munlock_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_munlock_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_munlock_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 151 long sys_mlockall ['int flags']
+case 151: {
+if (PPP_CHECK_CB(on_sys_mlockall_enter) || PPP_CHECK_CB(on_sys_mlockall_return)) {
+int32_t arg0 = get_s32(env, 0);
+if (PPP_CHECK_CB(on_sys_mlockall_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_mlockall_enter, env,pc,arg0) ; 
+}
+}; break;
+// 152 long sys_munlockall ['void']
+case 152: {
+if (PPP_CHECK_CB(on_sys_munlockall_return)) {
+}
+PPP_RUN_CB(on_sys_munlockall_enter, env,pc) ; 
+}; break;
+// 153 long sys_vhangup ['void']
+case 153: {
+if (PPP_CHECK_CB(on_sys_vhangup_return)) {
+}
+PPP_RUN_CB(on_sys_vhangup_enter, env,pc) ; 
+}; break;
+// 154 int sys_modify_ldt ['int func', ' void *ptr', ' unsigned long bytecount']
+case 154: {
+if (PPP_CHECK_CB(on_sys_modify_ldt_enter) || PPP_CHECK_CB(on_sys_modify_ldt_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_modify_ldt_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_modify_ldt_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 155 long sys_pivot_root ['const char __user *new_root', 'const char __user *put_old']
+case 155: {
+if (PPP_CHECK_CB(on_sys_pivot_root_enter) || PPP_CHECK_CB(on_sys_pivot_root_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_pivot_root_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_pivot_root_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 156 long sys_sysctl ['struct __sysctl_args __user *args']
+case 156: {
+if (PPP_CHECK_CB(on_sys_sysctl_enter) || PPP_CHECK_CB(on_sys_sysctl_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_sys_sysctl_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_sysctl_enter, env,pc,arg0) ; 
+}
+}; break;
+// 157 long sys_prctl ['int option', ' unsigned long arg2', ' unsigned long arg3', 'unsigned long arg4', ' unsigned long arg5']
+case 157: {
+if (PPP_CHECK_CB(on_sys_prctl_enter) || PPP_CHECK_CB(on_sys_prctl_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_sys_prctl_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_prctl_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 158 long sys_arch_prctl ['int code', ' unsigned long addr']
+case 158: {
+if (PPP_CHECK_CB(on_sys_arch_prctl_enter) || PPP_CHECK_CB(on_sys_arch_prctl_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_arch_prctl_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_arch_prctl_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 159 long sys_adjtimex ['struct timex __user *txc_p']
+case 159: {
+if (PPP_CHECK_CB(on_sys_adjtimex_enter) || PPP_CHECK_CB(on_sys_adjtimex_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_sys_adjtimex_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_adjtimex_enter, env,pc,arg0) ; 
+}
+}; break;
+// 160 long sys_setrlimit ['unsigned int resource', 'struct rlimit __user *rlim']
+case 160: {
+if (PPP_CHECK_CB(on_sys_setrlimit_enter) || PPP_CHECK_CB(on_sys_setrlimit_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_setrlimit_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_setrlimit_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 161 long sys_chroot ['const char __user *filename']
+case 161: {
+if (PPP_CHECK_CB(on_sys_chroot_enter) || PPP_CHECK_CB(on_sys_chroot_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_sys_chroot_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_chroot_enter, env,pc,arg0) ; 
+}
+}; break;
+// 162 long sys_sync ['void']
+case 162: {
+if (PPP_CHECK_CB(on_sys_sync_return)) {
+}
+PPP_RUN_CB(on_sys_sync_enter, env,pc) ; 
+}; break;
+// 163 long sys_acct ['const char __user *name']
+case 163: {
+if (PPP_CHECK_CB(on_sys_acct_enter) || PPP_CHECK_CB(on_sys_acct_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_sys_acct_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_acct_enter, env,pc,arg0) ; 
+}
+}; break;
+// 164 long sys_settimeofday ['struct timeval __user *tv', 'struct timezone __user *tz']
+case 164: {
+if (PPP_CHECK_CB(on_sys_settimeofday_enter) || PPP_CHECK_CB(on_sys_settimeofday_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_settimeofday_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_settimeofday_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 165 long sys_mount ['char __user *dev_name', ' char __user *dir_name', 'char __user *type', ' unsigned long flags', 'void __user *data']
+case 165: {
+if (PPP_CHECK_CB(on_sys_mount_enter) || PPP_CHECK_CB(on_sys_mount_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_sys_mount_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_mount_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 166 long sys_umount ['char __user *name', ' int flags']
+case 166: {
+if (PPP_CHECK_CB(on_sys_umount_enter) || PPP_CHECK_CB(on_sys_umount_return)) {
+target_ulong arg0 = get_64(env, 0);
+int32_t arg1 = get_s32(env, 1);
+if (PPP_CHECK_CB(on_sys_umount_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_umount_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 167 long sys_swapon ['const char __user *specialfile', ' int swap_flags']
+case 167: {
+if (PPP_CHECK_CB(on_sys_swapon_enter) || PPP_CHECK_CB(on_sys_swapon_return)) {
+target_ulong arg0 = get_64(env, 0);
+int32_t arg1 = get_s32(env, 1);
+if (PPP_CHECK_CB(on_sys_swapon_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_swapon_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 168 long sys_swapoff ['const char __user *specialfile']
+case 168: {
+if (PPP_CHECK_CB(on_sys_swapoff_enter) || PPP_CHECK_CB(on_sys_swapoff_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_sys_swapoff_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_swapoff_enter, env,pc,arg0) ; 
+}
+}; break;
+// 169 long sys_reboot ['int magic1', ' int magic2', ' unsigned int cmd', 'void __user *arg']
+case 169: {
+if (PPP_CHECK_CB(on_sys_reboot_enter) || PPP_CHECK_CB(on_sys_reboot_return)) {
+int32_t arg0 = get_s32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_sys_reboot_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_reboot_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 170 long sys_sethostname ['char __user *name', ' int len']
+case 170: {
+if (PPP_CHECK_CB(on_sys_sethostname_enter) || PPP_CHECK_CB(on_sys_sethostname_return)) {
+target_ulong arg0 = get_64(env, 0);
+int32_t arg1 = get_s32(env, 1);
+if (PPP_CHECK_CB(on_sys_sethostname_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_sethostname_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 171 long sys_setdomainname ['char __user *name', ' int len']
+case 171: {
+if (PPP_CHECK_CB(on_sys_setdomainname_enter) || PPP_CHECK_CB(on_sys_setdomainname_return)) {
+target_ulong arg0 = get_64(env, 0);
+int32_t arg1 = get_s32(env, 1);
+if (PPP_CHECK_CB(on_sys_setdomainname_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_setdomainname_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 172 int sys_iopl ['int level']
+case 172: {
+if (PPP_CHECK_CB(on_sys_iopl_enter) || PPP_CHECK_CB(on_sys_iopl_return)) {
+int32_t arg0 = get_s32(env, 0);
+if (PPP_CHECK_CB(on_sys_iopl_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_iopl_enter, env,pc,arg0) ; 
+}
+}; break;
+// 173 long sys_ioperm ['unsigned long from', ' unsigned long num', ' int on']
+case 173: {
+if (PPP_CHECK_CB(on_sys_ioperm_enter) || PPP_CHECK_CB(on_sys_ioperm_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+int32_t arg2 = get_s32(env, 2);
+if (PPP_CHECK_CB(on_sys_ioperm_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_ioperm_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 175 long sys_init_module ['void __user *umod', ' unsigned long len', 'const char __user *uargs']
+case 175: {
+if (PPP_CHECK_CB(on_sys_init_module_enter) || PPP_CHECK_CB(on_sys_init_module_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_init_module_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_init_module_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 176 long sys_delete_module ['const char __user *name_user', 'unsigned int flags']
+case 176: {
+if (PPP_CHECK_CB(on_sys_delete_module_enter) || PPP_CHECK_CB(on_sys_delete_module_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+if (PPP_CHECK_CB(on_sys_delete_module_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_delete_module_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 179 long sys_quotactl ['unsigned int cmd', ' const char __user *special', 'qid_t id', ' void __user *addr']
+case 179: {
+if (PPP_CHECK_CB(on_sys_quotactl_enter) || PPP_CHECK_CB(on_sys_quotactl_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_sys_quotactl_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_quotactl_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 180 long sys_nfsservctl ['int cmd', 'struct nfsctl_arg __user *arg', 'void __user *res']
+case 180: {
+if (PPP_CHECK_CB(on_sys_nfsservctl_enter) || PPP_CHECK_CB(on_sys_nfsservctl_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_nfsservctl_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_nfsservctl_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 186 long sys_gettid ['void']
+case 186: {
+if (PPP_CHECK_CB(on_sys_gettid_return)) {
+}
+PPP_RUN_CB(on_sys_gettid_enter, env,pc) ; 
+}; break;
+// 187 long sys_readahead ['int fd', ' loff_t offset', ' size_t count']
+case 187: {
+if (PPP_CHECK_CB(on_sys_readahead_enter) || PPP_CHECK_CB(on_sys_readahead_return)) {
+int32_t arg0 = get_s32(env, 0);
+uint64_t arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_readahead_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint64_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_readahead_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 188 long sys_setxattr ['const char __user *path', ' const char __user *name', 'const void __user *value', ' size_t size', ' int flags']
+case 188: {
+if (PPP_CHECK_CB(on_sys_setxattr_enter) || PPP_CHECK_CB(on_sys_setxattr_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+int32_t arg4 = get_s32(env, 4);
+if (PPP_CHECK_CB(on_sys_setxattr_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_setxattr_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 189 long sys_lsetxattr ['const char __user *path', ' const char __user *name', 'const void __user *value', ' size_t size', ' int flags']
+case 189: {
+if (PPP_CHECK_CB(on_sys_lsetxattr_enter) || PPP_CHECK_CB(on_sys_lsetxattr_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+int32_t arg4 = get_s32(env, 4);
+if (PPP_CHECK_CB(on_sys_lsetxattr_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_lsetxattr_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 190 long sys_fsetxattr ['int fd', ' const char __user *name', 'const void __user *value', ' size_t size', ' int flags']
+case 190: {
+if (PPP_CHECK_CB(on_sys_fsetxattr_enter) || PPP_CHECK_CB(on_sys_fsetxattr_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+int32_t arg4 = get_s32(env, 4);
+if (PPP_CHECK_CB(on_sys_fsetxattr_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_fsetxattr_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 191 long sys_getxattr ['const char __user *path', ' const char __user *name', 'void __user *value', ' size_t size']
+case 191: {
+if (PPP_CHECK_CB(on_sys_getxattr_enter) || PPP_CHECK_CB(on_sys_getxattr_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_sys_getxattr_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_getxattr_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 192 long sys_lgetxattr ['const char __user *path', ' const char __user *name', 'void __user *value', ' size_t size']
+case 192: {
+if (PPP_CHECK_CB(on_sys_lgetxattr_enter) || PPP_CHECK_CB(on_sys_lgetxattr_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_sys_lgetxattr_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_lgetxattr_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 193 long sys_fgetxattr ['int fd', ' const char __user *name', 'void __user *value', ' size_t size']
+case 193: {
+if (PPP_CHECK_CB(on_sys_fgetxattr_enter) || PPP_CHECK_CB(on_sys_fgetxattr_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_sys_fgetxattr_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_fgetxattr_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 194 long sys_listxattr ['const char __user *path', ' char __user *list', 'size_t size']
+case 194: {
+if (PPP_CHECK_CB(on_sys_listxattr_enter) || PPP_CHECK_CB(on_sys_listxattr_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_listxattr_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_listxattr_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 195 long sys_llistxattr ['const char __user *path', ' char __user *list', 'size_t size']
+case 195: {
+if (PPP_CHECK_CB(on_sys_llistxattr_enter) || PPP_CHECK_CB(on_sys_llistxattr_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_llistxattr_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_llistxattr_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 196 long sys_flistxattr ['int fd', ' char __user *list', ' size_t size']
+case 196: {
+if (PPP_CHECK_CB(on_sys_flistxattr_enter) || PPP_CHECK_CB(on_sys_flistxattr_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_flistxattr_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_flistxattr_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 197 long sys_removexattr ['const char __user *path', 'const char __user *name']
+case 197: {
+if (PPP_CHECK_CB(on_sys_removexattr_enter) || PPP_CHECK_CB(on_sys_removexattr_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_removexattr_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_removexattr_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 198 long sys_lremovexattr ['const char __user *path', 'const char __user *name']
+case 198: {
+if (PPP_CHECK_CB(on_sys_lremovexattr_enter) || PPP_CHECK_CB(on_sys_lremovexattr_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_lremovexattr_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_lremovexattr_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 199 long sys_fremovexattr ['int fd', ' const char __user *name']
+case 199: {
+if (PPP_CHECK_CB(on_sys_fremovexattr_enter) || PPP_CHECK_CB(on_sys_fremovexattr_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_fremovexattr_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_fremovexattr_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 200 long sys_tkill ['int pid', ' int sig']
+case 200: {
+if (PPP_CHECK_CB(on_sys_tkill_enter) || PPP_CHECK_CB(on_sys_tkill_return)) {
+int32_t arg0 = get_s32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+if (PPP_CHECK_CB(on_sys_tkill_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_tkill_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 201 long sys_time ['time_t __user *tloc']
+case 201: {
+if (PPP_CHECK_CB(on_sys_time_enter) || PPP_CHECK_CB(on_sys_time_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_sys_time_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_time_enter, env,pc,arg0) ; 
+}
+}; break;
+// 202 long sys_futex ['u32 __user *uaddr', ' int op', ' u32 val', 'struct timespec __user *utime', ' u32 __user *uaddr2', 'u32 val3']
+case 202: {
+if (PPP_CHECK_CB(on_sys_futex_enter) || PPP_CHECK_CB(on_sys_futex_return)) {
+target_ulong arg0 = get_64(env, 0);
+int32_t arg1 = get_s32(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+uint32_t arg5 = get_32(env, 5);
+if (PPP_CHECK_CB(on_sys_futex_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_futex_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 203 long sys_sched_setaffinity ['pid_t pid', ' unsigned int len', 'unsigned long __user *user_mask_ptr']
+case 203: {
+if (PPP_CHECK_CB(on_sys_sched_setaffinity_enter) || PPP_CHECK_CB(on_sys_sched_setaffinity_return)) {
+uint32_t arg0 = get_32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_sched_setaffinity_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_sched_setaffinity_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 204 long sys_sched_getaffinity ['pid_t pid', ' unsigned int len', 'unsigned long __user *user_mask_ptr']
+case 204: {
+if (PPP_CHECK_CB(on_sys_sched_getaffinity_enter) || PPP_CHECK_CB(on_sys_sched_getaffinity_return)) {
+uint32_t arg0 = get_32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_sched_getaffinity_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_sched_getaffinity_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 205 int set_thread_area ['struct user_desc *u_info']
+case 205: {
+if (PPP_CHECK_CB(on_set_thread_area_enter) || PPP_CHECK_CB(on_set_thread_area_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_set_thread_area_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_set_thread_area_enter, env,pc,arg0) ; 
+}
+}; break;
+// 206 long sys_io_setup ['unsigned nr_reqs', ' aio_context_t __user *ctx']
+case 206: {
+if (PPP_CHECK_CB(on_sys_io_setup_enter) || PPP_CHECK_CB(on_sys_io_setup_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_io_setup_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_io_setup_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 207 long sys_io_destroy ['aio_context_t ctx']
+case 207: {
+if (PPP_CHECK_CB(on_sys_io_destroy_enter) || PPP_CHECK_CB(on_sys_io_destroy_return)) {
+uint32_t arg0 = get_32(env, 0);
+if (PPP_CHECK_CB(on_sys_io_destroy_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_io_destroy_enter, env,pc,arg0) ; 
+}
+}; break;
+// 208 long sys_io_getevents ['aio_context_t ctx_id', 'long min_nr', 'long nr', 'struct io_event __user *events', 'struct timespec __user *timeout']
+case 208: {
+if (PPP_CHECK_CB(on_sys_io_getevents_enter) || PPP_CHECK_CB(on_sys_io_getevents_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_long arg1 = get_s64(env, 1);
+target_long arg2 = get_s64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_sys_io_getevents_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_long));
+memcpy(rp.params[2], &arg2, sizeof(target_long));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_io_getevents_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 209 long sys_io_submit ['aio_context_t', ' long', 'struct iocb __user * __user *']
+case 209: {
+if (PPP_CHECK_CB(on_sys_io_submit_enter) || PPP_CHECK_CB(on_sys_io_submit_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_long arg1 = get_s64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_io_submit_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_long));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_io_submit_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 210 long sys_io_cancel ['aio_context_t ctx_id', ' struct iocb __user *iocb', 'struct io_event __user *result']
+case 210: {
+if (PPP_CHECK_CB(on_sys_io_cancel_enter) || PPP_CHECK_CB(on_sys_io_cancel_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_io_cancel_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_io_cancel_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 211 int get_thread_area ['struct user_desc *u_info']
+case 211: {
+if (PPP_CHECK_CB(on_get_thread_area_enter) || PPP_CHECK_CB(on_get_thread_area_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_get_thread_area_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_get_thread_area_enter, env,pc,arg0) ; 
+}
+}; break;
+// 212 long sys_lookup_dcookie ['u64 cookie64', ' char __user *buf', ' size_t len']
+case 212: {
+if (PPP_CHECK_CB(on_sys_lookup_dcookie_enter) || PPP_CHECK_CB(on_sys_lookup_dcookie_return)) {
+uint64_t arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_lookup_dcookie_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint64_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_lookup_dcookie_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 213 long sys_epoll_create ['int size']
+case 213: {
+if (PPP_CHECK_CB(on_sys_epoll_create_enter) || PPP_CHECK_CB(on_sys_epoll_create_return)) {
+int32_t arg0 = get_s32(env, 0);
+if (PPP_CHECK_CB(on_sys_epoll_create_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_epoll_create_enter, env,pc,arg0) ; 
+}
+}; break;
+// 216 long sys_remap_file_pages ['unsigned long start', ' unsigned long size', 'unsigned long prot', ' unsigned long pgoff', 'unsigned long flags']
+case 216: {
+if (PPP_CHECK_CB(on_sys_remap_file_pages_enter) || PPP_CHECK_CB(on_sys_remap_file_pages_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_sys_remap_file_pages_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_remap_file_pages_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 217 long sys_getdents64 ['unsigned int fd', 'struct linux_dirent64 __user *dirent', 'unsigned int count']
+case 217: {
+if (PPP_CHECK_CB(on_sys_getdents64_enter) || PPP_CHECK_CB(on_sys_getdents64_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+if (PPP_CHECK_CB(on_sys_getdents64_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_getdents64_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 218 long sys_set_tid_address ['int __user *tidptr']
+case 218: {
+if (PPP_CHECK_CB(on_sys_set_tid_address_enter) || PPP_CHECK_CB(on_sys_set_tid_address_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_sys_set_tid_address_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_set_tid_address_enter, env,pc,arg0) ; 
+}
+}; break;
+// 219 long sys_restart_syscall ['void']
+case 219: {
+if (PPP_CHECK_CB(on_sys_restart_syscall_return)) {
+}
+PPP_RUN_CB(on_sys_restart_syscall_enter, env,pc) ; 
+}; break;
+// 220 long sys_semtimedop ['int semid', ' struct sembuf __user *sops', 'unsigned nsops', 'const struct timespec __user *timeout']
+case 220: {
+if (PPP_CHECK_CB(on_sys_semtimedop_enter) || PPP_CHECK_CB(on_sys_semtimedop_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_sys_semtimedop_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_semtimedop_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 221 long sys_fadvise64 ['int fd', ' loff_t offset', ' size_t len', ' int advice']
+case 221: {
+if (PPP_CHECK_CB(on_sys_fadvise64_enter) || PPP_CHECK_CB(on_sys_fadvise64_return)) {
+int32_t arg0 = get_s32(env, 0);
+uint64_t arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+int32_t arg3 = get_s32(env, 3);
+if (PPP_CHECK_CB(on_sys_fadvise64_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint64_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_fadvise64_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 222 long sys_timer_create ['clockid_t which_clock', 'struct sigevent __user *timer_event_spec', 'timer_t __user * created_timer_id']
+case 222: {
+if (PPP_CHECK_CB(on_sys_timer_create_enter) || PPP_CHECK_CB(on_sys_timer_create_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_timer_create_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_timer_create_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 223 long sys_timer_settime ['timer_t timer_id', ' int flags', 'const struct itimerspec __user *new_setting', 'struct itimerspec __user *old_setting']
+case 223: {
+if (PPP_CHECK_CB(on_sys_timer_settime_enter) || PPP_CHECK_CB(on_sys_timer_settime_return)) {
+uint32_t arg0 = get_32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_sys_timer_settime_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_timer_settime_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 224 long sys_timer_gettime ['timer_t timer_id', 'struct itimerspec __user *setting']
+case 224: {
+if (PPP_CHECK_CB(on_sys_timer_gettime_enter) || PPP_CHECK_CB(on_sys_timer_gettime_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_timer_gettime_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_timer_gettime_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 225 long sys_timer_getoverrun ['timer_t timer_id']
+case 225: {
+if (PPP_CHECK_CB(on_sys_timer_getoverrun_enter) || PPP_CHECK_CB(on_sys_timer_getoverrun_return)) {
+uint32_t arg0 = get_32(env, 0);
+if (PPP_CHECK_CB(on_sys_timer_getoverrun_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_timer_getoverrun_enter, env,pc,arg0) ; 
+}
+}; break;
+// 226 long sys_timer_delete ['timer_t timer_id']
+case 226: {
+if (PPP_CHECK_CB(on_sys_timer_delete_enter) || PPP_CHECK_CB(on_sys_timer_delete_return)) {
+uint32_t arg0 = get_32(env, 0);
+if (PPP_CHECK_CB(on_sys_timer_delete_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_timer_delete_enter, env,pc,arg0) ; 
+}
+}; break;
+// 227 long sys_clock_settime ['clockid_t which_clock', 'const struct timespec __user *tp']
+case 227: {
+if (PPP_CHECK_CB(on_sys_clock_settime_enter) || PPP_CHECK_CB(on_sys_clock_settime_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_clock_settime_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_clock_settime_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 228 long sys_clock_gettime ['clockid_t which_clock', 'struct timespec __user *tp']
+case 228: {
+if (PPP_CHECK_CB(on_sys_clock_gettime_enter) || PPP_CHECK_CB(on_sys_clock_gettime_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_clock_gettime_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_clock_gettime_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 229 long sys_clock_getres ['clockid_t which_clock', 'struct timespec __user *tp']
+case 229: {
+if (PPP_CHECK_CB(on_sys_clock_getres_enter) || PPP_CHECK_CB(on_sys_clock_getres_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_clock_getres_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_clock_getres_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 230 long sys_clock_nanosleep ['clockid_t which_clock', ' int flags', 'const struct timespec __user *rqtp', 'struct timespec __user *rmtp']
+case 230: {
+if (PPP_CHECK_CB(on_sys_clock_nanosleep_enter) || PPP_CHECK_CB(on_sys_clock_nanosleep_return)) {
+uint32_t arg0 = get_32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_sys_clock_nanosleep_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_clock_nanosleep_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 231 long sys_exit_group ['int error_code']
+case 231: {
+if (PPP_CHECK_CB(on_sys_exit_group_enter) || PPP_CHECK_CB(on_sys_exit_group_return)) {
+int32_t arg0 = get_s32(env, 0);
+if (PPP_CHECK_CB(on_sys_exit_group_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_exit_group_enter, env,pc,arg0) ; 
+}
+}; break;
+// 232 long sys_epoll_wait ['int epfd', ' struct epoll_event __user *events', 'int maxevents', ' int timeout']
+case 232: {
+if (PPP_CHECK_CB(on_sys_epoll_wait_enter) || PPP_CHECK_CB(on_sys_epoll_wait_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+int32_t arg2 = get_s32(env, 2);
+int32_t arg3 = get_s32(env, 3);
+if (PPP_CHECK_CB(on_sys_epoll_wait_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+memcpy(rp.params[3], &arg3, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_epoll_wait_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 233 long sys_epoll_ctl ['int epfd', ' int op', ' int fd', 'struct epoll_event __user *event']
+case 233: {
+if (PPP_CHECK_CB(on_sys_epoll_ctl_enter) || PPP_CHECK_CB(on_sys_epoll_ctl_return)) {
+int32_t arg0 = get_s32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+int32_t arg2 = get_s32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_sys_epoll_ctl_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_epoll_ctl_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 234 long sys_tgkill ['int tgid', ' int pid', ' int sig']
+case 234: {
+if (PPP_CHECK_CB(on_sys_tgkill_enter) || PPP_CHECK_CB(on_sys_tgkill_return)) {
+int32_t arg0 = get_s32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+int32_t arg2 = get_s32(env, 2);
+if (PPP_CHECK_CB(on_sys_tgkill_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_tgkill_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 235 long sys_utimes ['char __user *filename', 'struct timeval __user *utimes']
+case 235: {
+if (PPP_CHECK_CB(on_sys_utimes_enter) || PPP_CHECK_CB(on_sys_utimes_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_utimes_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_utimes_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 237 long sys_mbind ['unsigned long start', ' unsigned long len', 'unsigned long mode', 'unsigned long __user *nmask', 'unsigned long maxnode', 'unsigned flags']
+case 237: {
+if (PPP_CHECK_CB(on_sys_mbind_enter) || PPP_CHECK_CB(on_sys_mbind_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+uint32_t arg5 = get_32(env, 5);
+if (PPP_CHECK_CB(on_sys_mbind_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_mbind_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 238 long sys_set_mempolicy ['int mode', ' unsigned long __user *nmask', 'unsigned long maxnode']
+case 238: {
+if (PPP_CHECK_CB(on_sys_set_mempolicy_enter) || PPP_CHECK_CB(on_sys_set_mempolicy_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_set_mempolicy_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_set_mempolicy_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 239 long sys_get_mempolicy ['int __user *policy', 'unsigned long __user *nmask', 'unsigned long maxnode', 'unsigned long addr', ' unsigned long flags']
+case 239: {
+if (PPP_CHECK_CB(on_sys_get_mempolicy_enter) || PPP_CHECK_CB(on_sys_get_mempolicy_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_sys_get_mempolicy_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_get_mempolicy_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 240 long sys_mq_open ['const char __user *name', ' int oflag', ' mode_t mode', ' struct mq_attr __user *attr']
+case 240: {
+if (PPP_CHECK_CB(on_sys_mq_open_enter) || PPP_CHECK_CB(on_sys_mq_open_return)) {
+target_ulong arg0 = get_64(env, 0);
+int32_t arg1 = get_s32(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_sys_mq_open_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_mq_open_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 241 long sys_mq_unlink ['const char __user *name']
+case 241: {
+if (PPP_CHECK_CB(on_sys_mq_unlink_enter) || PPP_CHECK_CB(on_sys_mq_unlink_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_sys_mq_unlink_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_mq_unlink_enter, env,pc,arg0) ; 
+}
+}; break;
+// 242 long sys_mq_timedsend ['mqd_t mqdes', ' const char __user *msg_ptr', ' size_t msg_len', ' unsigned int msg_prio', ' const struct timespec __user *abs_timeout']
+case 242: {
+if (PPP_CHECK_CB(on_sys_mq_timedsend_enter) || PPP_CHECK_CB(on_sys_mq_timedsend_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_sys_mq_timedsend_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_mq_timedsend_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 243 long sys_mq_timedreceive ['mqd_t mqdes', ' char __user *msg_ptr', ' size_t msg_len', ' unsigned int __user *msg_prio', ' const struct timespec __user *abs_timeout']
+case 243: {
+if (PPP_CHECK_CB(on_sys_mq_timedreceive_enter) || PPP_CHECK_CB(on_sys_mq_timedreceive_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_sys_mq_timedreceive_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_mq_timedreceive_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 244 long sys_mq_notify ['mqd_t mqdes', ' const struct sigevent __user *notification']
+case 244: {
+if (PPP_CHECK_CB(on_sys_mq_notify_enter) || PPP_CHECK_CB(on_sys_mq_notify_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_mq_notify_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_mq_notify_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 245 long sys_mq_getsetattr ['mqd_t mqdes', ' const struct mq_attr __user *mqstat', ' struct mq_attr __user *omqstat']
+case 245: {
+if (PPP_CHECK_CB(on_sys_mq_getsetattr_enter) || PPP_CHECK_CB(on_sys_mq_getsetattr_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_mq_getsetattr_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_mq_getsetattr_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 246 long sys_kexec_load ['unsigned long entry', ' unsigned long nr_segments', 'struct kexec_segment __user *segments', 'unsigned long flags']
+case 246: {
+if (PPP_CHECK_CB(on_sys_kexec_load_enter) || PPP_CHECK_CB(on_sys_kexec_load_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_sys_kexec_load_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_kexec_load_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 247 long sys_waitid ['int which', ' pid_t pid', 'struct siginfo __user *infop', 'int options', ' struct rusage __user *ru']
+case 247: {
+if (PPP_CHECK_CB(on_sys_waitid_enter) || PPP_CHECK_CB(on_sys_waitid_return)) {
+int32_t arg0 = get_s32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+int32_t arg3 = get_s32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_sys_waitid_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(int32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_waitid_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 248 long sys_add_key ['const char __user *_type', 'const char __user *_description', 'const void __user *_payload', 'size_t plen', 'key_serial_t destringid']
+case 248: {
+if (PPP_CHECK_CB(on_sys_add_key_enter) || PPP_CHECK_CB(on_sys_add_key_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+uint32_t arg4 = get_32(env, 4);
+if (PPP_CHECK_CB(on_sys_add_key_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_add_key_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 249 long sys_request_key ['const char __user *_type', 'const char __user *_description', 'const char __user *_callout_info', 'key_serial_t destringid']
+case 249: {
+if (PPP_CHECK_CB(on_sys_request_key_enter) || PPP_CHECK_CB(on_sys_request_key_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_sys_request_key_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_request_key_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 250 long sys_keyctl ['int cmd', ' unsigned long arg2', ' unsigned long arg3', 'unsigned long arg4', ' unsigned long arg5']
+case 250: {
+if (PPP_CHECK_CB(on_sys_keyctl_enter) || PPP_CHECK_CB(on_sys_keyctl_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_sys_keyctl_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_keyctl_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 251 long sys_ioprio_set ['int which', ' int who', ' int ioprio']
+case 251: {
+if (PPP_CHECK_CB(on_sys_ioprio_set_enter) || PPP_CHECK_CB(on_sys_ioprio_set_return)) {
+int32_t arg0 = get_s32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+int32_t arg2 = get_s32(env, 2);
+if (PPP_CHECK_CB(on_sys_ioprio_set_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_ioprio_set_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 252 long sys_ioprio_get ['int which', ' int who']
+case 252: {
+if (PPP_CHECK_CB(on_sys_ioprio_get_enter) || PPP_CHECK_CB(on_sys_ioprio_get_return)) {
+int32_t arg0 = get_s32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+if (PPP_CHECK_CB(on_sys_ioprio_get_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_ioprio_get_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 253 long sys_inotify_init ['void']
+case 253: {
+if (PPP_CHECK_CB(on_sys_inotify_init_return)) {
+}
+PPP_RUN_CB(on_sys_inotify_init_enter, env,pc) ; 
+}; break;
+// 254 long sys_inotify_add_watch ['int fd', ' const char __user *path', 'u32 mask']
+case 254: {
+if (PPP_CHECK_CB(on_sys_inotify_add_watch_enter) || PPP_CHECK_CB(on_sys_inotify_add_watch_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+if (PPP_CHECK_CB(on_sys_inotify_add_watch_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_inotify_add_watch_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 255 long sys_inotify_rm_watch ['int fd', ' __s32 wd']
+case 255: {
+if (PPP_CHECK_CB(on_sys_inotify_rm_watch_enter) || PPP_CHECK_CB(on_sys_inotify_rm_watch_return)) {
+int32_t arg0 = get_s32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+if (PPP_CHECK_CB(on_sys_inotify_rm_watch_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_inotify_rm_watch_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 256 long sys_migrate_pages ['pid_t pid', ' unsigned long maxnode', 'const unsigned long __user *from', 'const unsigned long __user *to']
+case 256: {
+if (PPP_CHECK_CB(on_sys_migrate_pages_enter) || PPP_CHECK_CB(on_sys_migrate_pages_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_sys_migrate_pages_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_migrate_pages_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 257 long sys_openat ['int dfd', ' const char __user *filename', ' int flags', 'int mode']
+case 257: {
+if (PPP_CHECK_CB(on_sys_openat_enter) || PPP_CHECK_CB(on_sys_openat_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+int32_t arg2 = get_s32(env, 2);
+int32_t arg3 = get_s32(env, 3);
+if (PPP_CHECK_CB(on_sys_openat_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+memcpy(rp.params[3], &arg3, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_openat_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 258 long sys_mkdirat ['int dfd', ' const char __user * pathname', ' int mode']
+case 258: {
+if (PPP_CHECK_CB(on_sys_mkdirat_enter) || PPP_CHECK_CB(on_sys_mkdirat_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+int32_t arg2 = get_s32(env, 2);
+if (PPP_CHECK_CB(on_sys_mkdirat_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_mkdirat_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 259 long sys_mknodat ['int dfd', ' const char __user * filename', ' int mode', 'unsigned dev']
+case 259: {
+if (PPP_CHECK_CB(on_sys_mknodat_enter) || PPP_CHECK_CB(on_sys_mknodat_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+int32_t arg2 = get_s32(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_sys_mknodat_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_mknodat_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 260 long sys_fchownat ['int dfd', ' const char __user *filename', ' uid_t user', 'gid_t group', ' int flag']
+case 260: {
+if (PPP_CHECK_CB(on_sys_fchownat_enter) || PPP_CHECK_CB(on_sys_fchownat_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+uint32_t arg3 = get_32(env, 3);
+int32_t arg4 = get_s32(env, 4);
+if (PPP_CHECK_CB(on_sys_fchownat_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_fchownat_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 261 long sys_futimesat ['int dfd', ' const char __user *filename', 'struct timeval __user *utimes']
+case 261: {
+if (PPP_CHECK_CB(on_sys_futimesat_enter) || PPP_CHECK_CB(on_sys_futimesat_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_futimesat_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_futimesat_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 262 long sys_newfstatat ['int dfd', ' const char __user *filename', ' struct stat __user *statbuf', ' int flag']
+case 262: {
+if (PPP_CHECK_CB(on_sys_newfstatat_enter) || PPP_CHECK_CB(on_sys_newfstatat_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+int32_t arg3 = get_s32(env, 3);
+if (PPP_CHECK_CB(on_sys_newfstatat_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_newfstatat_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 263 long sys_unlinkat ['int dfd', ' const char __user * pathname', ' int flag']
+case 263: {
+if (PPP_CHECK_CB(on_sys_unlinkat_enter) || PPP_CHECK_CB(on_sys_unlinkat_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+int32_t arg2 = get_s32(env, 2);
+if (PPP_CHECK_CB(on_sys_unlinkat_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_unlinkat_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 264 long sys_renameat ['int olddfd', ' const char __user * oldname', 'int newdfd', ' const char __user * newname']
+case 264: {
+if (PPP_CHECK_CB(on_sys_renameat_enter) || PPP_CHECK_CB(on_sys_renameat_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+int32_t arg2 = get_s32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_sys_renameat_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_renameat_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 265 long sys_linkat ['int olddfd', ' const char __user *oldname', 'int newdfd', ' const char __user *newname', ' int flags']
+case 265: {
+if (PPP_CHECK_CB(on_sys_linkat_enter) || PPP_CHECK_CB(on_sys_linkat_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+int32_t arg2 = get_s32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+int32_t arg4 = get_s32(env, 4);
+if (PPP_CHECK_CB(on_sys_linkat_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_linkat_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 266 long sys_symlinkat ['const char __user * oldname', 'int newdfd', ' const char __user * newname']
+case 266: {
+if (PPP_CHECK_CB(on_sys_symlinkat_enter) || PPP_CHECK_CB(on_sys_symlinkat_return)) {
+target_ulong arg0 = get_64(env, 0);
+int32_t arg1 = get_s32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_symlinkat_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_symlinkat_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 267 long sys_readlinkat ['int dfd', ' const char __user *path', ' char __user *buf', 'int bufsiz']
+case 267: {
+if (PPP_CHECK_CB(on_sys_readlinkat_enter) || PPP_CHECK_CB(on_sys_readlinkat_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+int32_t arg3 = get_s32(env, 3);
+if (PPP_CHECK_CB(on_sys_readlinkat_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_readlinkat_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 268 long sys_fchmodat ['int dfd', ' const char __user * filename', 'mode_t mode']
+case 268: {
+if (PPP_CHECK_CB(on_sys_fchmodat_enter) || PPP_CHECK_CB(on_sys_fchmodat_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+if (PPP_CHECK_CB(on_sys_fchmodat_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_fchmodat_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 269 long sys_faccessat ['int dfd', ' const char __user *filename', ' int mode']
+case 269: {
+if (PPP_CHECK_CB(on_sys_faccessat_enter) || PPP_CHECK_CB(on_sys_faccessat_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+int32_t arg2 = get_s32(env, 2);
+if (PPP_CHECK_CB(on_sys_faccessat_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_faccessat_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 270 long sys_pselect6 ['int', ' fd_set __user *', ' fd_set __user *', 'fd_set __user *', ' struct timespec __user *', 'void __user *']
+case 270: {
+if (PPP_CHECK_CB(on_sys_pselect6_enter) || PPP_CHECK_CB(on_sys_pselect6_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_sys_pselect6_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_pselect6_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 271 long sys_ppoll ['struct pollfd __user *', ' unsigned int', 'struct timespec __user *', ' const sigset_t __user *', 'size_t']
+case 271: {
+if (PPP_CHECK_CB(on_sys_ppoll_enter) || PPP_CHECK_CB(on_sys_ppoll_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_sys_ppoll_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_ppoll_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 272 long sys_unshare ['unsigned long unshare_flags']
+case 272: {
+if (PPP_CHECK_CB(on_sys_unshare_enter) || PPP_CHECK_CB(on_sys_unshare_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_sys_unshare_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_unshare_enter, env,pc,arg0) ; 
+}
+}; break;
+// 273 long sys_set_robust_list ['struct robust_list_head __user *head', 'size_t len']
+case 273: {
+if (PPP_CHECK_CB(on_sys_set_robust_list_enter) || PPP_CHECK_CB(on_sys_set_robust_list_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_set_robust_list_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_set_robust_list_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 274 long sys_get_robust_list ['int pid', 'struct robust_list_head __user * __user *head_ptr', 'size_t __user *len_ptr']
+case 274: {
+if (PPP_CHECK_CB(on_sys_get_robust_list_enter) || PPP_CHECK_CB(on_sys_get_robust_list_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_get_robust_list_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_get_robust_list_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 275 long sys_splice ['int fd_in', ' loff_t __user *off_in', 'int fd_out', ' loff_t __user *off_out', 'size_t len', ' unsigned int flags']
+case 275: {
+if (PPP_CHECK_CB(on_sys_splice_enter) || PPP_CHECK_CB(on_sys_splice_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+int32_t arg2 = get_s32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+uint32_t arg5 = get_32(env, 5);
+if (PPP_CHECK_CB(on_sys_splice_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_splice_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 276 long sys_tee ['int fdin', ' int fdout', ' size_t len', ' unsigned int flags']
+case 276: {
+if (PPP_CHECK_CB(on_sys_tee_enter) || PPP_CHECK_CB(on_sys_tee_return)) {
+int32_t arg0 = get_s32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_sys_tee_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_tee_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 277 long sys_sync_file_range ['int fd', ' loff_t offset', ' loff_t nbytes', 'unsigned int flags']
+case 277: {
+if (PPP_CHECK_CB(on_sys_sync_file_range_enter) || PPP_CHECK_CB(on_sys_sync_file_range_return)) {
+int32_t arg0 = get_s32(env, 0);
+uint64_t arg1 = get_64(env, 1);
+uint64_t arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_sys_sync_file_range_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint64_t));
+memcpy(rp.params[2], &arg2, sizeof(uint64_t));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_sync_file_range_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 278 long sys_vmsplice ['int fd', ' const struct iovec __user *iov', 'unsigned long nr_segs', ' unsigned int flags']
+case 278: {
+if (PPP_CHECK_CB(on_sys_vmsplice_enter) || PPP_CHECK_CB(on_sys_vmsplice_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_sys_vmsplice_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_vmsplice_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 279 long sys_move_pages ['pid_t pid', ' unsigned long nr_pages', 'const void __user * __user *pages', 'const int __user *nodes', 'int __user *status', 'int flags']
+case 279: {
+if (PPP_CHECK_CB(on_sys_move_pages_enter) || PPP_CHECK_CB(on_sys_move_pages_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+int32_t arg5 = get_s32(env, 5);
+if (PPP_CHECK_CB(on_sys_move_pages_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_move_pages_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 280 long sys_utimensat ['int dfd', ' const char __user *filename', 'struct timespec __user *utimes', ' int flags']
+case 280: {
+if (PPP_CHECK_CB(on_sys_utimensat_enter) || PPP_CHECK_CB(on_sys_utimensat_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+int32_t arg3 = get_s32(env, 3);
+if (PPP_CHECK_CB(on_sys_utimensat_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_utimensat_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 281 long sys_epoll_pwait ['int epfd', ' struct epoll_event __user *events', 'int maxevents', ' int timeout', 'const sigset_t __user *sigmask', 'size_t sigsetsize']
+case 281: {
+if (PPP_CHECK_CB(on_sys_epoll_pwait_enter) || PPP_CHECK_CB(on_sys_epoll_pwait_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+int32_t arg2 = get_s32(env, 2);
+int32_t arg3 = get_s32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_sys_epoll_pwait_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+memcpy(rp.params[3], &arg3, sizeof(int32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_epoll_pwait_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 282 long sys_signalfd ['int ufd', ' sigset_t __user *user_mask', ' size_t sizemask']
+case 282: {
+if (PPP_CHECK_CB(on_sys_signalfd_enter) || PPP_CHECK_CB(on_sys_signalfd_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_signalfd_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_signalfd_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 283 long sys_timerfd_create ['int clockid', ' int flags']
+case 283: {
+if (PPP_CHECK_CB(on_sys_timerfd_create_enter) || PPP_CHECK_CB(on_sys_timerfd_create_return)) {
+int32_t arg0 = get_s32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+if (PPP_CHECK_CB(on_sys_timerfd_create_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_timerfd_create_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 284 long sys_eventfd ['unsigned int count']
+case 284: {
+if (PPP_CHECK_CB(on_sys_eventfd_enter) || PPP_CHECK_CB(on_sys_eventfd_return)) {
+uint32_t arg0 = get_32(env, 0);
+if (PPP_CHECK_CB(on_sys_eventfd_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_eventfd_enter, env,pc,arg0) ; 
+}
+}; break;
+// 285 long sys_fallocate ['int fd', ' int mode', ' loff_t offset', ' loff_t len']
+case 285: {
+if (PPP_CHECK_CB(on_sys_fallocate_enter) || PPP_CHECK_CB(on_sys_fallocate_return)) {
+int32_t arg0 = get_s32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+uint64_t arg2 = get_64(env, 2);
+uint64_t arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_sys_fallocate_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+memcpy(rp.params[2], &arg2, sizeof(uint64_t));
+memcpy(rp.params[3], &arg3, sizeof(uint64_t));
+}
+PPP_RUN_CB(on_sys_fallocate_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 286 long sys_timerfd_settime ['int ufd', ' int flags', 'const struct itimerspec __user *utmr', 'struct itimerspec __user *otmr']
+case 286: {
+if (PPP_CHECK_CB(on_sys_timerfd_settime_enter) || PPP_CHECK_CB(on_sys_timerfd_settime_return)) {
+int32_t arg0 = get_s32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_sys_timerfd_settime_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_timerfd_settime_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 287 long sys_timerfd_gettime ['int ufd', ' struct itimerspec __user *otmr']
+case 287: {
+if (PPP_CHECK_CB(on_sys_timerfd_gettime_enter) || PPP_CHECK_CB(on_sys_timerfd_gettime_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_timerfd_gettime_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_timerfd_gettime_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 288 long sys_accept4 ['int fd', ' struct sockaddr __user *upeer_sockaddr', ' int __user *upeer_addrlen', ' int flags']
+case 288: {
+if (PPP_CHECK_CB(on_sys_accept4_enter) || PPP_CHECK_CB(on_sys_accept4_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+int32_t arg3 = get_s32(env, 3);
+if (PPP_CHECK_CB(on_sys_accept4_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_accept4_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 289 long sys_signalfd4 ['int ufd', ' sigset_t __user *user_mask', ' size_t sizemask', ' int flags']
+case 289: {
+if (PPP_CHECK_CB(on_sys_signalfd4_enter) || PPP_CHECK_CB(on_sys_signalfd4_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+int32_t arg3 = get_s32(env, 3);
+if (PPP_CHECK_CB(on_sys_signalfd4_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_signalfd4_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 290 long sys_eventfd2 ['unsigned int count', ' int flags']
+case 290: {
+if (PPP_CHECK_CB(on_sys_eventfd2_enter) || PPP_CHECK_CB(on_sys_eventfd2_return)) {
+uint32_t arg0 = get_32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+if (PPP_CHECK_CB(on_sys_eventfd2_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_eventfd2_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 291 long sys_epoll_create1 ['int flags']
+case 291: {
+if (PPP_CHECK_CB(on_sys_epoll_create1_enter) || PPP_CHECK_CB(on_sys_epoll_create1_return)) {
+int32_t arg0 = get_s32(env, 0);
+if (PPP_CHECK_CB(on_sys_epoll_create1_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_epoll_create1_enter, env,pc,arg0) ; 
+}
+}; break;
+// 292 long sys_dup3 ['unsigned int oldfd', ' unsigned int newfd', ' int flags']
+case 292: {
+if (PPP_CHECK_CB(on_sys_dup3_enter) || PPP_CHECK_CB(on_sys_dup3_return)) {
+uint32_t arg0 = get_32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+int32_t arg2 = get_s32(env, 2);
+if (PPP_CHECK_CB(on_sys_dup3_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_dup3_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 293 long sys_pipe2 ['int __user *fildes', ' int flags']
+case 293: {
+if (PPP_CHECK_CB(on_sys_pipe2_enter) || PPP_CHECK_CB(on_sys_pipe2_return)) {
+target_ulong arg0 = get_64(env, 0);
+int32_t arg1 = get_s32(env, 1);
+if (PPP_CHECK_CB(on_sys_pipe2_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_pipe2_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 294 long sys_inotify_init1 ['int flags']
+case 294: {
+if (PPP_CHECK_CB(on_sys_inotify_init1_enter) || PPP_CHECK_CB(on_sys_inotify_init1_return)) {
+int32_t arg0 = get_s32(env, 0);
+if (PPP_CHECK_CB(on_sys_inotify_init1_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_inotify_init1_enter, env,pc,arg0) ; 
+}
+}; break;
+// 295 long sys_preadv ['unsigned long fd', ' const struct iovec __user *vec', 'unsigned long vlen', ' unsigned long pos_l', ' unsigned long pos_h']
+case 295: {
+if (PPP_CHECK_CB(on_sys_preadv_enter) || PPP_CHECK_CB(on_sys_preadv_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_sys_preadv_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_preadv_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 296 long sys_pwritev ['unsigned long fd', ' const struct iovec __user *vec', 'unsigned long vlen', ' unsigned long pos_l', ' unsigned long pos_h']
+case 296: {
+if (PPP_CHECK_CB(on_sys_pwritev_enter) || PPP_CHECK_CB(on_sys_pwritev_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_sys_pwritev_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_pwritev_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 297 long sys_rt_tgsigqueueinfo ['pid_t tgid', ' pid_t  pid', ' int sig', 'siginfo_t __user *uinfo']
+case 297: {
+if (PPP_CHECK_CB(on_sys_rt_tgsigqueueinfo_enter) || PPP_CHECK_CB(on_sys_rt_tgsigqueueinfo_return)) {
+uint32_t arg0 = get_32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+int32_t arg2 = get_s32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_sys_rt_tgsigqueueinfo_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_rt_tgsigqueueinfo_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 298 long sys_perf_event_open ['struct perf_event_attr __user *attr_uptr', 'pid_t pid', ' int cpu', ' int group_fd', ' unsigned long flags']
+case 298: {
+if (PPP_CHECK_CB(on_sys_perf_event_open_enter) || PPP_CHECK_CB(on_sys_perf_event_open_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+int32_t arg2 = get_s32(env, 2);
+int32_t arg3 = get_s32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_sys_perf_event_open_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+memcpy(rp.params[3], &arg3, sizeof(int32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_perf_event_open_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 299 long sys_recvmmsg ['int fd', ' struct mmsghdr __user *msg', 'unsigned int vlen', ' unsigned flags', 'struct timespec __user *timeout']
+case 299: {
+if (PPP_CHECK_CB(on_sys_recvmmsg_enter) || PPP_CHECK_CB(on_sys_recvmmsg_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_sys_recvmmsg_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_recvmmsg_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 300 long sys_fanotify_init ['unsigned int flags', ' unsigned int event_f_flags']
+case 300: {
+if (PPP_CHECK_CB(on_sys_fanotify_init_enter) || PPP_CHECK_CB(on_sys_fanotify_init_return)) {
+uint32_t arg0 = get_32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+if (PPP_CHECK_CB(on_sys_fanotify_init_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_fanotify_init_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 301 long sys_fanotify_mark ['int fanotify_fd', ' unsigned int flags', 'u64 mask', ' int fd', 'const char  __user *pathname']
+case 301: {
+if (PPP_CHECK_CB(on_sys_fanotify_mark_enter) || PPP_CHECK_CB(on_sys_fanotify_mark_return)) {
+int32_t arg0 = get_s32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+uint64_t arg2 = get_64(env, 2);
+int32_t arg3 = get_s32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_sys_fanotify_mark_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(uint64_t));
+memcpy(rp.params[3], &arg3, sizeof(int32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_fanotify_mark_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 302 long sys_prlimit64 ['pid_t pid', ' unsigned int resource', 'const struct rlimit64 __user *new_rlim', 'struct rlimit64 __user *old_rlim']
+case 302: {
+if (PPP_CHECK_CB(on_sys_prlimit64_enter) || PPP_CHECK_CB(on_sys_prlimit64_return)) {
+uint32_t arg0 = get_32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_sys_prlimit64_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_prlimit64_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 303 long sys_name_to_handle_at ['int dfd', ' const char __user *name', 'struct file_handle __user *handle', 'int __user *mnt_id', ' int flag']
+case 303: {
+if (PPP_CHECK_CB(on_sys_name_to_handle_at_enter) || PPP_CHECK_CB(on_sys_name_to_handle_at_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+int32_t arg4 = get_s32(env, 4);
+if (PPP_CHECK_CB(on_sys_name_to_handle_at_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_name_to_handle_at_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 304 long sys_open_by_handle_at ['int mountdirfd', 'struct file_handle __user *handle', 'int flags']
+case 304: {
+if (PPP_CHECK_CB(on_sys_open_by_handle_at_enter) || PPP_CHECK_CB(on_sys_open_by_handle_at_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+int32_t arg2 = get_s32(env, 2);
+if (PPP_CHECK_CB(on_sys_open_by_handle_at_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_open_by_handle_at_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 305 long sys_clock_adjtime ['clockid_t which_clock', 'struct timex __user *tx']
+case 305: {
+if (PPP_CHECK_CB(on_sys_clock_adjtime_enter) || PPP_CHECK_CB(on_sys_clock_adjtime_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_sys_clock_adjtime_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_clock_adjtime_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 306 long sys_syncfs ['int fd']
+case 306: {
+if (PPP_CHECK_CB(on_sys_syncfs_enter) || PPP_CHECK_CB(on_sys_syncfs_return)) {
+int32_t arg0 = get_s32(env, 0);
+if (PPP_CHECK_CB(on_sys_syncfs_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_syncfs_enter, env,pc,arg0) ; 
+}
+}; break;
+// 307 long sys_sendmmsg ['int fd', ' struct mmsghdr __user *msg', 'unsigned int vlen', ' unsigned flags']
+case 307: {
+if (PPP_CHECK_CB(on_sys_sendmmsg_enter) || PPP_CHECK_CB(on_sys_sendmmsg_return)) {
+int32_t arg0 = get_s32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_sys_sendmmsg_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_sendmmsg_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 308 long sys_setns ['int fd', ' int nstype']
+case 308: {
+if (PPP_CHECK_CB(on_sys_setns_enter) || PPP_CHECK_CB(on_sys_setns_return)) {
+int32_t arg0 = get_s32(env, 0);
+int32_t arg1 = get_s32(env, 1);
+if (PPP_CHECK_CB(on_sys_setns_return)) {
+memcpy(rp.params[0], &arg0, sizeof(int32_t));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_setns_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 309 long sys_getcpu ['unsigned __user *cpu', ' unsigned __user *node', ' struct getcpu_cache __user *cache']
+case 309: {
+if (PPP_CHECK_CB(on_sys_getcpu_enter) || PPP_CHECK_CB(on_sys_getcpu_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_sys_getcpu_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_getcpu_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 310 long sys_process_vm_readv ['pid_t pid', 'const struct iovec __user *lvec', 'unsigned long liovcnt', 'const struct iovec __user *rvec', 'unsigned long riovcnt', 'unsigned long flags']
+case 310: {
+if (PPP_CHECK_CB(on_sys_process_vm_readv_enter) || PPP_CHECK_CB(on_sys_process_vm_readv_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_sys_process_vm_readv_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_process_vm_readv_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 311 long sys_process_vm_writev ['pid_t pid', 'const struct iovec __user *lvec', 'unsigned long liovcnt', 'const struct iovec __user *rvec', 'unsigned long riovcnt', 'unsigned long flags']
+case 311: {
+if (PPP_CHECK_CB(on_sys_process_vm_writev_enter) || PPP_CHECK_CB(on_sys_process_vm_writev_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_sys_process_vm_writev_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_process_vm_writev_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+default:
+PPP_RUN_CB(on_unknown_sys_enter, env, pc, EAX);
+}
+PPP_RUN_CB(on_all_sys_enter, env, pc, EAX);
+appendReturnPoint(rp);
+#endif
+ } 
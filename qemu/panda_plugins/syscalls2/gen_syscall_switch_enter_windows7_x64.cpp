@@ -0,0 +1,6376 @@
+
+
+extern "C" {
+#include "panda_plugin.h" 
+}
+
+#include "syscalls2.h" 
+#include "panda_common.h"
+#include "panda_plugin_plugin.h"
+
+extern "C" {
+#include "gen_syscalls_ext_typedefs.h"
+#include "gen_syscall_ppp_extern_enter.h"
+#include "gen_syscall_ppp_extern_return.h"
+}
+
+void syscall_enter_switch_windows7_x64 ( CPUState *env, target_ulong pc ) {  // osarch
+#ifdef TARGET_X86_64                                          // GUARD
+    // zeroed so a return callback registered after this enter sees 0s,
+    // not stack garbage, for args nobody asked us to save
+    ReturnPoint rp = {};
+    rp.ordinal = EAX;                        // CALLNO
+    rp.proc_id = panda_current_asid(env);
+    rp.retaddr = calc_retaddr(env, pc);
+    switch( EAX ) {                          // CALLNO
+// 0 NTSTATUS NtMapUserPhysicalPagesScatter ['PVOID *VirtualAddresses', ' ULONG_PTR NumberOfPages', ' PULONG_PTR UserPfnArray']
+case 0: {
+if (PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_enter) || PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtMapUserPhysicalPagesScatter_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 1 NTSTATUS NtWaitForSingleObject ['HANDLE Handle', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout']
+case 1: {
+if (PPP_CHECK_CB(on_NtWaitForSingleObject_enter) || PPP_CHECK_CB(on_NtWaitForSingleObject_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtWaitForSingleObject_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtWaitForSingleObject_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 2 NTSTATUS NtCallbackReturn ['PVOID OutputBuffer', ' ULONG OutputLength', ' NTSTATUS Status']
+case 2: {
+if (PPP_CHECK_CB(on_NtCallbackReturn_enter) || PPP_CHECK_CB(on_NtCallbackReturn_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+uint32_t arg2 = get_32(env, 2);
+if (PPP_CHECK_CB(on_NtCallbackReturn_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCallbackReturn_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 3 NTSTATUS NtReadFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length', ' PLARGE_INTEGER ByteOffset', ' PULONG Key']
+case 3: {
+if (PPP_CHECK_CB(on_NtReadFile_enter) || PPP_CHECK_CB(on_NtReadFile_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+uint32_t arg6 = get_32(env, 6);
+target_ulong arg7 = get_64(env, 7);
+target_ulong arg8 = get_64(env, 8);
+if (PPP_CHECK_CB(on_NtReadFile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(uint32_t));
+memcpy(rp.params[7], &arg7, sizeof(target_ulong));
+memcpy(rp.params[8], &arg8, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtReadFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
+}; break;
+// 4 NTSTATUS NtDeviceIoControlFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG IoControlCode', ' PVOID InputBuffer', ' ULONG InputBufferLength', ' PVOID OutputBuffer', ' ULONG OutputBufferLength']
+case 4: {
+if (PPP_CHECK_CB(on_NtDeviceIoControlFile_enter) || PPP_CHECK_CB(on_NtDeviceIoControlFile_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+uint32_t arg5 = get_32(env, 5);
+target_ulong arg6 = get_64(env, 6);
+uint32_t arg7 = get_32(env, 7);
+target_ulong arg8 = get_64(env, 8);
+uint32_t arg9 = get_32(env, 9);
+if (PPP_CHECK_CB(on_NtDeviceIoControlFile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(uint32_t));
+memcpy(rp.params[6], &arg6, sizeof(target_ulong));
+memcpy(rp.params[7], &arg7, sizeof(uint32_t));
+memcpy(rp.params[8], &arg8, sizeof(target_ulong));
+memcpy(rp.params[9], &arg9, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtDeviceIoControlFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+}
+}; break;
+// 5 NTSTATUS NtWriteFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length', ' PLARGE_INTEGER ByteOffset', ' PULONG Key']
+case 5: {
+if (PPP_CHECK_CB(on_NtWriteFile_enter) || PPP_CHECK_CB(on_NtWriteFile_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+uint32_t arg6 = get_32(env, 6);
+target_ulong arg7 = get_64(env, 7);
+target_ulong arg8 = get_64(env, 8);
+if (PPP_CHECK_CB(on_NtWriteFile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(uint32_t));
+memcpy(rp.params[7], &arg7, sizeof(target_ulong));
+memcpy(rp.params[8], &arg8, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtWriteFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
+}; break;
+// 6 NTSTATUS NtRemoveIoCompletion ['HANDLE IoCompletionHandle', ' PVOID *KeyContext', ' PVOID *ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PLARGE_INTEGER Timeout']
+case 6: {
+if (PPP_CHECK_CB(on_NtRemoveIoCompletion_enter) || PPP_CHECK_CB(on_NtRemoveIoCompletion_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtRemoveIoCompletion_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtRemoveIoCompletion_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 7 NTSTATUS NtReleaseSemaphore ['HANDLE SemaphoreHandle', ' LONG ReleaseCount', ' PLONG PreviousCount']
+case 7: {
+if (PPP_CHECK_CB(on_NtReleaseSemaphore_enter) || PPP_CHECK_CB(on_NtReleaseSemaphore_return)) {
+target_ulong arg0 = get_64(env, 0);
+int32_t arg1 = get_s32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtReleaseSemaphore_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(int32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtReleaseSemaphore_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 8 NTSTATUS NtReplyWaitReceivePort ['HANDLE PortHandle', ' PVOID *PortContext ', ' PPORT_MESSAGE ReplyMessage', ' PPORT_MESSAGE ReceiveMessage']
+case 8: {
+if (PPP_CHECK_CB(on_NtReplyWaitReceivePort_enter) || PPP_CHECK_CB(on_NtReplyWaitReceivePort_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_NtReplyWaitReceivePort_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtReplyWaitReceivePort_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 9 NTSTATUS NtReplyPort ['HANDLE PortHandle', ' PPORT_MESSAGE ReplyMessage']
+case 9: {
+if (PPP_CHECK_CB(on_NtReplyPort_enter) || PPP_CHECK_CB(on_NtReplyPort_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtReplyPort_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtReplyPort_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 10 NTSTATUS NtSetInformationThread ['HANDLE ThreadHandle', ' THREADINFOCLASS ThreadInformationClass', ' PVOID ThreadInformation', ' ULONG ThreadInformationLength']
+case 10: {
+if (PPP_CHECK_CB(on_NtSetInformationThread_enter) || PPP_CHECK_CB(on_NtSetInformationThread_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_NtSetInformationThread_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetInformationThread_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 11 NTSTATUS NtSetEvent ['HANDLE EventHandle', ' PLONG PreviousState']
+case 11: {
+if (PPP_CHECK_CB(on_NtSetEvent_enter) || PPP_CHECK_CB(on_NtSetEvent_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtSetEvent_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetEvent_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 12 NTSTATUS NtClose ['HANDLE Handle']
+case 12: {
+if (PPP_CHECK_CB(on_NtClose_enter) || PPP_CHECK_CB(on_NtClose_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtClose_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtClose_enter, env,pc,arg0) ; 
+}
+}; break;
+// 13 NTSTATUS NtQueryObject ['HANDLE Handle', ' OBJECT_INFORMATION_CLASS ObjectInformationClass', ' PVOID ObjectInformation', ' ULONG ObjectInformationLength', ' PULONG ReturnLength']
+case 13: {
+if (PPP_CHECK_CB(on_NtQueryObject_enter) || PPP_CHECK_CB(on_NtQueryObject_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtQueryObject_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryObject_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 14 NTSTATUS NtQueryInformationFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID FileInformation', ' ULONG Length', ' FILE_INFORMATION_CLASS FileInformationClass']
+case 14: {
+if (PPP_CHECK_CB(on_NtQueryInformationFile_enter) || PPP_CHECK_CB(on_NtQueryInformationFile_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+uint32_t arg4 = get_32(env, 4);
+if (PPP_CHECK_CB(on_NtQueryInformationFile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtQueryInformationFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 15 NTSTATUS NtOpenKey ['PHANDLE KeyHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 15: {
+if (PPP_CHECK_CB(on_NtOpenKey_enter) || PPP_CHECK_CB(on_NtOpenKey_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtOpenKey_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenKey_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 16 NTSTATUS NtEnumerateValueKey ['HANDLE KeyHandle', ' ULONG Index', ' KEY_VALUE_INFORMATION_CLASS KeyValueInformationClass', ' PVOID KeyValueInformation', ' ULONG Length', ' PULONG ResultLength']
+case 16: {
+if (PPP_CHECK_CB(on_NtEnumerateValueKey_enter) || PPP_CHECK_CB(on_NtEnumerateValueKey_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+uint32_t arg4 = get_32(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_NtEnumerateValueKey_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtEnumerateValueKey_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 17 NTSTATUS NtFindAtom ['PWSTR AtomName', ' ULONG Length', ' PRTL_ATOM Atom']
+case 17: {
+if (PPP_CHECK_CB(on_NtFindAtom_enter) || PPP_CHECK_CB(on_NtFindAtom_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtFindAtom_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtFindAtom_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 18 NTSTATUS NtQueryDefaultLocale ['BOOLEAN UserProfile', ' PLCID DefaultLocaleId']
+case 18: {
+if (PPP_CHECK_CB(on_NtQueryDefaultLocale_enter) || PPP_CHECK_CB(on_NtQueryDefaultLocale_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtQueryDefaultLocale_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryDefaultLocale_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 19 NTSTATUS NtQueryKey ['HANDLE KeyHandle', ' KEY_INFORMATION_CLASS KeyInformationClass', ' PVOID KeyInformation', ' ULONG Length', ' PULONG ResultLength']
+case 19: {
+if (PPP_CHECK_CB(on_NtQueryKey_enter) || PPP_CHECK_CB(on_NtQueryKey_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtQueryKey_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryKey_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 20 NTSTATUS NtQueryValueKey ['HANDLE KeyHandle', ' PUNICODE_STRING ValueName', ' KEY_VALUE_INFORMATION_CLASS KeyValueInformationClass', ' PVOID KeyValueInformation', ' ULONG Length', ' PULONG ResultLength']
+case 20: {
+if (PPP_CHECK_CB(on_NtQueryValueKey_enter) || PPP_CHECK_CB(on_NtQueryValueKey_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+uint32_t arg4 = get_32(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_NtQueryValueKey_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryValueKey_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 21 NTSTATUS NtAllocateVirtualMemory ['HANDLE ProcessHandle', ' PVOID *BaseAddress', ' ULONG_PTR ZeroBits', ' PSIZE_T RegionSize', ' ULONG AllocationType', ' ULONG Protect']
+case 21: {
+if (PPP_CHECK_CB(on_NtAllocateVirtualMemory_enter) || PPP_CHECK_CB(on_NtAllocateVirtualMemory_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+uint32_t arg4 = get_32(env, 4);
+uint32_t arg5 = get_32(env, 5);
+if (PPP_CHECK_CB(on_NtAllocateVirtualMemory_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtAllocateVirtualMemory_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 22 NTSTATUS NtQueryInformationProcess ['HANDLE ProcessHandle', ' PROCESSINFOCLASS ProcessInformationClass', ' PVOID ProcessInformation', ' ULONG ProcessInformationLength', ' PULONG ReturnLength']
+case 22: {
+if (PPP_CHECK_CB(on_NtQueryInformationProcess_enter) || PPP_CHECK_CB(on_NtQueryInformationProcess_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtQueryInformationProcess_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryInformationProcess_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 23 NTSTATUS NtWaitForMultipleObjects32 ['ULONG Count', ' LONG Handles[]', ' WAIT_TYPE WaitType', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout']
+case 23: {
+if (PPP_CHECK_CB(on_NtWaitForMultipleObjects32_enter) || PPP_CHECK_CB(on_NtWaitForMultipleObjects32_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtWaitForMultipleObjects32_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtWaitForMultipleObjects32_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 24 NTSTATUS NtWriteFileGather ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PFILE_SEGMENT_ELEMENT SegmentArray', ' ULONG Length', ' PLARGE_INTEGER ByteOffset', ' PULONG Key']
+case 24: {
+if (PPP_CHECK_CB(on_NtWriteFileGather_enter) || PPP_CHECK_CB(on_NtWriteFileGather_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+uint32_t arg6 = get_32(env, 6);
+target_ulong arg7 = get_64(env, 7);
+target_ulong arg8 = get_64(env, 8);
+if (PPP_CHECK_CB(on_NtWriteFileGather_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(uint32_t));
+memcpy(rp.params[7], &arg7, sizeof(target_ulong));
+memcpy(rp.params[8], &arg8, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtWriteFileGather_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
+}; break;
+// 25 NTSTATUS NtSetInformationProcess ['HANDLE ProcessHandle', ' PROCESSINFOCLASS ProcessInformationClass', ' PVOID ProcessInformation', ' ULONG ProcessInformationLength']
+case 25: {
+if (PPP_CHECK_CB(on_NtSetInformationProcess_enter) || PPP_CHECK_CB(on_NtSetInformationProcess_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_NtSetInformationProcess_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetInformationProcess_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 26 NTSTATUS NtCreateKey ['PHANDLE KeyHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG TitleIndex', ' PUNICODE_STRING Class', ' ULONG CreateOptions', ' PULONG Disposition']
+case 26: {
+if (PPP_CHECK_CB(on_NtCreateKey_enter) || PPP_CHECK_CB(on_NtCreateKey_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+uint32_t arg5 = get_32(env, 5);
+target_ulong arg6 = get_64(env, 6);
+if (PPP_CHECK_CB(on_NtCreateKey_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(uint32_t));
+memcpy(rp.params[6], &arg6, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateKey_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+}
+}; break;
+// 27 NTSTATUS NtFreeVirtualMemory ['HANDLE ProcessHandle', ' PVOID *BaseAddress', ' PSIZE_T RegionSize', ' ULONG FreeType']
+case 27: {
+if (PPP_CHECK_CB(on_NtFreeVirtualMemory_enter) || PPP_CHECK_CB(on_NtFreeVirtualMemory_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_NtFreeVirtualMemory_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtFreeVirtualMemory_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 28 NTSTATUS NtImpersonateClientOfPort ['HANDLE PortHandle', ' PPORT_MESSAGE Message']
+case 28: {
+if (PPP_CHECK_CB(on_NtImpersonateClientOfPort_enter) || PPP_CHECK_CB(on_NtImpersonateClientOfPort_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtImpersonateClientOfPort_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtImpersonateClientOfPort_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 29 NTSTATUS NtReleaseMutant ['HANDLE MutantHandle', ' PLONG PreviousCount']
+case 29: {
+if (PPP_CHECK_CB(on_NtReleaseMutant_enter) || PPP_CHECK_CB(on_NtReleaseMutant_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtReleaseMutant_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtReleaseMutant_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 30 NTSTATUS NtQueryInformationToken ['HANDLE TokenHandle', ' TOKEN_INFORMATION_CLASS TokenInformationClass', ' PVOID TokenInformation', ' ULONG TokenInformationLength', ' PULONG ReturnLength']
+case 30: {
+if (PPP_CHECK_CB(on_NtQueryInformationToken_enter) || PPP_CHECK_CB(on_NtQueryInformationToken_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtQueryInformationToken_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryInformationToken_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 31 NTSTATUS NtRequestWaitReplyPort ['HANDLE PortHandle', ' PPORT_MESSAGE RequestMessage', ' PPORT_MESSAGE ReplyMessage']
+case 31: {
+if (PPP_CHECK_CB(on_NtRequestWaitReplyPort_enter) || PPP_CHECK_CB(on_NtRequestWaitReplyPort_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtRequestWaitReplyPort_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtRequestWaitReplyPort_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 32 NTSTATUS NtQueryVirtualMemory ['HANDLE ProcessHandle', ' PVOID BaseAddress', ' MEMORY_INFORMATION_CLASS MemoryInformationClass', ' PVOID MemoryInformation', ' SIZE_T MemoryInformationLength', ' PSIZE_T ReturnLength']
+case 32: {
+if (PPP_CHECK_CB(on_NtQueryVirtualMemory_enter) || PPP_CHECK_CB(on_NtQueryVirtualMemory_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_NtQueryVirtualMemory_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryVirtualMemory_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 33 NTSTATUS NtOpenThreadToken ['HANDLE ThreadHandle', ' ACCESS_MASK DesiredAccess', ' BOOLEAN OpenAsSelf', ' PHANDLE TokenHandle']
+case 33: {
+if (PPP_CHECK_CB(on_NtOpenThreadToken_enter) || PPP_CHECK_CB(on_NtOpenThreadToken_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_NtOpenThreadToken_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenThreadToken_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 34 NTSTATUS NtQueryInformationThread ['HANDLE ThreadHandle', ' THREADINFOCLASS ThreadInformationClass', ' PVOID ThreadInformation', ' ULONG ThreadInformationLength', ' PULONG ReturnLength']
+case 34: {
+if (PPP_CHECK_CB(on_NtQueryInformationThread_enter) || PPP_CHECK_CB(on_NtQueryInformationThread_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtQueryInformationThread_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryInformationThread_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 35 NTSTATUS NtOpenProcess ['PHANDLE ProcessHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PCLIENT_ID ClientId']
+case 35: {
+if (PPP_CHECK_CB(on_NtOpenProcess_enter) || PPP_CHECK_CB(on_NtOpenProcess_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_NtOpenProcess_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenProcess_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 36 NTSTATUS NtSetInformationFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID FileInformation', ' ULONG Length', ' FILE_INFORMATION_CLASS FileInformationClass']
+case 36: {
+if (PPP_CHECK_CB(on_NtSetInformationFile_enter) || PPP_CHECK_CB(on_NtSetInformationFile_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+uint32_t arg4 = get_32(env, 4);
+if (PPP_CHECK_CB(on_NtSetInformationFile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetInformationFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 37 NTSTATUS NtMapViewOfSection ['HANDLE SectionHandle', ' HANDLE ProcessHandle', ' PVOID *BaseAddress', ' ULONG_PTR ZeroBits', ' SIZE_T CommitSize', ' PLARGE_INTEGER SectionOffset', ' PSIZE_T ViewSize', ' SECTION_INHERIT InheritDisposition', ' ULONG AllocationType', ' WIN32_PROTECTION_MASK Win32Protect']
+case 37: {
+if (PPP_CHECK_CB(on_NtMapViewOfSection_enter) || PPP_CHECK_CB(on_NtMapViewOfSection_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+target_ulong arg6 = get_64(env, 6);
+uint32_t arg7 = get_32(env, 7);
+uint32_t arg8 = get_32(env, 8);
+uint32_t arg9 = get_32(env, 9);
+if (PPP_CHECK_CB(on_NtMapViewOfSection_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(target_ulong));
+memcpy(rp.params[7], &arg7, sizeof(uint32_t));
+memcpy(rp.params[8], &arg8, sizeof(uint32_t));
+memcpy(rp.params[9], &arg9, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtMapViewOfSection_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+}
+}; break;
+// 38 NTSTATUS NtAccessCheckAndAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' PUNICODE_STRING ObjectTypeName', ' PUNICODE_STRING ObjectName', ' PSECURITY_DESCRIPTOR SecurityDescriptor', ' ACCESS_MASK DesiredAccess', ' PGENERIC_MAPPING GenericMapping', ' BOOLEAN ObjectCreation', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus', ' PBOOLEAN GenerateOnClose']
+case 38: {
+if (PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_enter) || PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+uint32_t arg5 = get_32(env, 5);
+target_ulong arg6 = get_64(env, 6);
+uint32_t arg7 = get_32(env, 7);
+target_ulong arg8 = get_64(env, 8);
+target_ulong arg9 = get_64(env, 9);
+target_ulong arg10 = get_64(env, 10);
+if (PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(uint32_t));
+memcpy(rp.params[6], &arg6, sizeof(target_ulong));
+memcpy(rp.params[7], &arg7, sizeof(uint32_t));
+memcpy(rp.params[8], &arg8, sizeof(target_ulong));
+memcpy(rp.params[9], &arg9, sizeof(target_ulong));
+memcpy(rp.params[10], &arg10, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAccessCheckAndAuditAlarm_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+}
+}; break;
+// 39 NTSTATUS NtUnmapViewOfSection ['HANDLE ProcessHandle', ' PVOID BaseAddress']
+case 39: {
+if (PPP_CHECK_CB(on_NtUnmapViewOfSection_enter) || PPP_CHECK_CB(on_NtUnmapViewOfSection_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtUnmapViewOfSection_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtUnmapViewOfSection_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 40 NTSTATUS NtReplyWaitReceivePortEx ['HANDLE PortHandle', ' PVOID *PortContext', ' PPORT_MESSAGE ReplyMessage', ' PPORT_MESSAGE ReceiveMessage', ' PLARGE_INTEGER Timeout']
+case 40: {
+if (PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_enter) || PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtReplyWaitReceivePortEx_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 41 NTSTATUS NtTerminateProcess ['HANDLE ProcessHandle', ' NTSTATUS ExitStatus']
+case 41: {
+if (PPP_CHECK_CB(on_NtTerminateProcess_enter) || PPP_CHECK_CB(on_NtTerminateProcess_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+if (PPP_CHECK_CB(on_NtTerminateProcess_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtTerminateProcess_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 42 NTSTATUS NtSetEventBoostPriority ['HANDLE EventHandle']
+case 42: {
+if (PPP_CHECK_CB(on_NtSetEventBoostPriority_enter) || PPP_CHECK_CB(on_NtSetEventBoostPriority_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtSetEventBoostPriority_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetEventBoostPriority_enter, env,pc,arg0) ; 
+}
+}; break;
+// 43 NTSTATUS NtReadFileScatter ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PFILE_SEGMENT_ELEMENT SegmentArray', ' ULONG Length', ' PLARGE_INTEGER ByteOffset', ' PULONG Key']
+case 43: {
+if (PPP_CHECK_CB(on_NtReadFileScatter_enter) || PPP_CHECK_CB(on_NtReadFileScatter_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+uint32_t arg6 = get_32(env, 6);
+target_ulong arg7 = get_64(env, 7);
+target_ulong arg8 = get_64(env, 8);
+if (PPP_CHECK_CB(on_NtReadFileScatter_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(uint32_t));
+memcpy(rp.params[7], &arg7, sizeof(target_ulong));
+memcpy(rp.params[8], &arg8, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtReadFileScatter_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
+}; break;
+// 44 NTSTATUS NtOpenThreadTokenEx ['HANDLE ThreadHandle', ' ACCESS_MASK DesiredAccess', ' BOOLEAN OpenAsSelf', ' ULONG HandleAttributes', ' PHANDLE TokenHandle']
+case 44: {
+if (PPP_CHECK_CB(on_NtOpenThreadTokenEx_enter) || PPP_CHECK_CB(on_NtOpenThreadTokenEx_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+uint32_t arg2 = get_32(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtOpenThreadTokenEx_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenThreadTokenEx_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 45 NTSTATUS NtOpenProcessTokenEx ['HANDLE ProcessHandle', ' ACCESS_MASK DesiredAccess', ' ULONG HandleAttributes', ' PHANDLE TokenHandle']
+case 45: {
+if (PPP_CHECK_CB(on_NtOpenProcessTokenEx_enter) || PPP_CHECK_CB(on_NtOpenProcessTokenEx_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_NtOpenProcessTokenEx_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenProcessTokenEx_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 46 NTSTATUS NtQueryPerformanceCounter ['PLARGE_INTEGER PerformanceCounter', ' PLARGE_INTEGER PerformanceFrequency']
+case 46: {
+if (PPP_CHECK_CB(on_NtQueryPerformanceCounter_enter) || PPP_CHECK_CB(on_NtQueryPerformanceCounter_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtQueryPerformanceCounter_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryPerformanceCounter_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 47 NTSTATUS NtEnumerateKey ['HANDLE KeyHandle', ' ULONG Index', ' KEY_INFORMATION_CLASS KeyInformationClass', ' PVOID KeyInformation', ' ULONG Length', ' PULONG ResultLength']
+case 47: {
+if (PPP_CHECK_CB(on_NtEnumerateKey_enter) || PPP_CHECK_CB(on_NtEnumerateKey_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+uint32_t arg4 = get_32(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_NtEnumerateKey_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtEnumerateKey_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 48 NTSTATUS NtOpenFile ['PHANDLE FileHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG ShareAccess', ' ULONG OpenOptions']
+case 48: {
+if (PPP_CHECK_CB(on_NtOpenFile_enter) || PPP_CHECK_CB(on_NtOpenFile_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+uint32_t arg4 = get_32(env, 4);
+uint32_t arg5 = get_32(env, 5);
+if (PPP_CHECK_CB(on_NtOpenFile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtOpenFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 49 NTSTATUS NtDelayExecution ['BOOLEAN Alertable', ' PLARGE_INTEGER DelayInterval']
+case 49: {
+if (PPP_CHECK_CB(on_NtDelayExecution_enter) || PPP_CHECK_CB(on_NtDelayExecution_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtDelayExecution_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtDelayExecution_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 50 NTSTATUS NtQueryDirectoryFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID FileInformation', ' ULONG Length', ' FILE_INFORMATION_CLASS FileInformationClass', ' BOOLEAN ReturnSingleEntry', ' PUNICODE_STRING FileName', ' BOOLEAN RestartScan']
+case 50: {
+if (PPP_CHECK_CB(on_NtQueryDirectoryFile_enter) || PPP_CHECK_CB(on_NtQueryDirectoryFile_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+uint32_t arg6 = get_32(env, 6);
+uint32_t arg7 = get_32(env, 7);
+uint32_t arg8 = get_32(env, 8);
+target_ulong arg9 = get_64(env, 9);
+uint32_t arg10 = get_32(env, 10);
+if (PPP_CHECK_CB(on_NtQueryDirectoryFile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(uint32_t));
+memcpy(rp.params[7], &arg7, sizeof(uint32_t));
+memcpy(rp.params[8], &arg8, sizeof(uint32_t));
+memcpy(rp.params[9], &arg9, sizeof(target_ulong));
+memcpy(rp.params[10], &arg10, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtQueryDirectoryFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+}
+}; break;
+// 51 NTSTATUS NtQuerySystemInformation ['SYSTEM_INFORMATION_CLASS SystemInformationClass', ' PVOID SystemInformation', ' ULONG SystemInformationLength', ' PULONG ReturnLength']
+case 51: {
+if (PPP_CHECK_CB(on_NtQuerySystemInformation_enter) || PPP_CHECK_CB(on_NtQuerySystemInformation_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_NtQuerySystemInformation_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQuerySystemInformation_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 52 NTSTATUS NtOpenSection ['PHANDLE SectionHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 52: {
+if (PPP_CHECK_CB(on_NtOpenSection_enter) || PPP_CHECK_CB(on_NtOpenSection_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtOpenSection_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenSection_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 53 NTSTATUS NtQueryTimer ['HANDLE TimerHandle', ' TIMER_INFORMATION_CLASS TimerInformationClass', ' PVOID TimerInformation', ' ULONG TimerInformationLength', ' PULONG ReturnLength']
+case 53: {
+if (PPP_CHECK_CB(on_NtQueryTimer_enter) || PPP_CHECK_CB(on_NtQueryTimer_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtQueryTimer_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryTimer_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 54 NTSTATUS NtFsControlFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG IoControlCode', ' PVOID InputBuffer', ' ULONG InputBufferLength', ' PVOID OutputBuffer', ' ULONG OutputBufferLength']
+case 54: {
+if (PPP_CHECK_CB(on_NtFsControlFile_enter) || PPP_CHECK_CB(on_NtFsControlFile_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+uint32_t arg5 = get_32(env, 5);
+target_ulong arg6 = get_64(env, 6);
+uint32_t arg7 = get_32(env, 7);
+target_ulong arg8 = get_64(env, 8);
+uint32_t arg9 = get_32(env, 9);
+if (PPP_CHECK_CB(on_NtFsControlFile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(uint32_t));
+memcpy(rp.params[6], &arg6, sizeof(target_ulong));
+memcpy(rp.params[7], &arg7, sizeof(uint32_t));
+memcpy(rp.params[8], &arg8, sizeof(target_ulong));
+memcpy(rp.params[9], &arg9, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtFsControlFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+}
+}; break;
+// 55 NTSTATUS NtWriteVirtualMemory ['HANDLE ProcessHandle', ' PVOID BaseAddress', ' PVOID Buffer', ' SIZE_T BufferSize', ' PSIZE_T NumberOfBytesWritten']
+case 55: {
+if (PPP_CHECK_CB(on_NtWriteVirtualMemory_enter) || PPP_CHECK_CB(on_NtWriteVirtualMemory_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtWriteVirtualMemory_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtWriteVirtualMemory_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 56 NTSTATUS NtCloseObjectAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' BOOLEAN GenerateOnClose']
+case 56: {
+if (PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_enter) || PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+if (PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCloseObjectAuditAlarm_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 57 NTSTATUS NtDuplicateObject ['HANDLE SourceProcessHandle', ' HANDLE SourceHandle', ' HANDLE TargetProcessHandle', ' PHANDLE TargetHandle', ' ACCESS_MASK DesiredAccess', ' ULONG HandleAttributes', ' ULONG Options']
+case 57: {
+if (PPP_CHECK_CB(on_NtDuplicateObject_enter) || PPP_CHECK_CB(on_NtDuplicateObject_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+uint32_t arg4 = get_32(env, 4);
+uint32_t arg5 = get_32(env, 5);
+uint32_t arg6 = get_32(env, 6);
+if (PPP_CHECK_CB(on_NtDuplicateObject_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(uint32_t));
+memcpy(rp.params[6], &arg6, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtDuplicateObject_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+}
+}; break;
+// 58 NTSTATUS NtQueryAttributesFile ['POBJECT_ATTRIBUTES ObjectAttributes', ' PFILE_BASIC_INFORMATION FileInformation']
+case 58: {
+if (PPP_CHECK_CB(on_NtQueryAttributesFile_enter) || PPP_CHECK_CB(on_NtQueryAttributesFile_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtQueryAttributesFile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryAttributesFile_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 59 NTSTATUS NtClearEvent ['HANDLE EventHandle']
+case 59: {
+if (PPP_CHECK_CB(on_NtClearEvent_enter) || PPP_CHECK_CB(on_NtClearEvent_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtClearEvent_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtClearEvent_enter, env,pc,arg0) ; 
+}
+}; break;
+// 60 NTSTATUS NtReadVirtualMemory ['HANDLE ProcessHandle', ' PVOID BaseAddress', ' PVOID Buffer', ' SIZE_T BufferSize', ' PSIZE_T NumberOfBytesRead']
+case 60: {
+if (PPP_CHECK_CB(on_NtReadVirtualMemory_enter) || PPP_CHECK_CB(on_NtReadVirtualMemory_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtReadVirtualMemory_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtReadVirtualMemory_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 61 NTSTATUS NtOpenEvent ['PHANDLE EventHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 61: {
+if (PPP_CHECK_CB(on_NtOpenEvent_enter) || PPP_CHECK_CB(on_NtOpenEvent_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtOpenEvent_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenEvent_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 62 NTSTATUS NtAdjustPrivilegesToken ['HANDLE TokenHandle', ' BOOLEAN DisableAllPrivileges', ' PTOKEN_PRIVILEGES NewState', ' ULONG BufferLength', ' PTOKEN_PRIVILEGES PreviousState', ' PULONG ReturnLength']
+case 62: {
+if (PPP_CHECK_CB(on_NtAdjustPrivilegesToken_enter) || PPP_CHECK_CB(on_NtAdjustPrivilegesToken_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_NtAdjustPrivilegesToken_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAdjustPrivilegesToken_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 63 NTSTATUS NtDuplicateToken ['HANDLE ExistingTokenHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' BOOLEAN EffectiveOnly', ' TOKEN_TYPE TokenType', ' PHANDLE NewTokenHandle']
+case 63: {
+if (PPP_CHECK_CB(on_NtDuplicateToken_enter) || PPP_CHECK_CB(on_NtDuplicateToken_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+uint32_t arg4 = get_32(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_NtDuplicateToken_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtDuplicateToken_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 64 NTSTATUS NtContinue ['PCONTEXT ContextRecord', ' BOOLEAN TestAlert']
+case 64: {
+if (PPP_CHECK_CB(on_NtContinue_enter) || PPP_CHECK_CB(on_NtContinue_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+if (PPP_CHECK_CB(on_NtContinue_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtContinue_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 65 NTSTATUS NtQueryDefaultUILanguage ['LANGID *DefaultUILanguageId']
+case 65: {
+if (PPP_CHECK_CB(on_NtQueryDefaultUILanguage_enter) || PPP_CHECK_CB(on_NtQueryDefaultUILanguage_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtQueryDefaultUILanguage_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryDefaultUILanguage_enter, env,pc,arg0) ; 
+}
+}; break;
+// 66 NTSTATUS NtQueueApcThread ['HANDLE ThreadHandle', ' PPS_APC_ROUTINE ApcRoutine', ' PVOID ApcArgument1', ' PVOID ApcArgument2', ' PVOID ApcArgument3']
+case 66: {
+if (PPP_CHECK_CB(on_NtQueueApcThread_enter) || PPP_CHECK_CB(on_NtQueueApcThread_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtQueueApcThread_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueueApcThread_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 67 NTSTATUS NtYieldExecution ['']
+case 67: {
+if (PPP_CHECK_CB(on_NtYieldExecution_return)) {
+}
+PPP_RUN_CB(on_NtYieldExecution_enter, env,pc) ; 
+}; break;
+// 68 NTSTATUS NtAddAtom ['PWSTR AtomName', ' ULONG Length', ' PRTL_ATOM Atom']
+case 68: {
+if (PPP_CHECK_CB(on_NtAddAtom_enter) || PPP_CHECK_CB(on_NtAddAtom_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtAddAtom_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAddAtom_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 69 NTSTATUS NtCreateEvent ['PHANDLE EventHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' EVENT_TYPE EventType', ' BOOLEAN InitialState']
+case 69: {
+if (PPP_CHECK_CB(on_NtCreateEvent_enter) || PPP_CHECK_CB(on_NtCreateEvent_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+uint32_t arg4 = get_32(env, 4);
+if (PPP_CHECK_CB(on_NtCreateEvent_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCreateEvent_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 70 NTSTATUS NtQueryVolumeInformationFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID FsInformation', ' ULONG Length', ' FS_INFORMATION_CLASS FsInformationClass']
+case 70: {
+if (PPP_CHECK_CB(on_NtQueryVolumeInformationFile_enter) || PPP_CHECK_CB(on_NtQueryVolumeInformationFile_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+uint32_t arg4 = get_32(env, 4);
+if (PPP_CHECK_CB(on_NtQueryVolumeInformationFile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtQueryVolumeInformationFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 71 NTSTATUS NtCreateSection ['PHANDLE SectionHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PLARGE_INTEGER MaximumSize', ' ULONG SectionPageProtection', ' ULONG AllocationAttributes', ' HANDLE FileHandle']
+case 71: {
+if (PPP_CHECK_CB(on_NtCreateSection_enter) || PPP_CHECK_CB(on_NtCreateSection_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+uint32_t arg4 = get_32(env, 4);
+uint32_t arg5 = get_32(env, 5);
+target_ulong arg6 = get_64(env, 6);
+if (PPP_CHECK_CB(on_NtCreateSection_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(uint32_t));
+memcpy(rp.params[6], &arg6, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateSection_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+}
+}; break;
+// 72 NTSTATUS NtFlushBuffersFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock']
+case 72: {
+if (PPP_CHECK_CB(on_NtFlushBuffersFile_enter) || PPP_CHECK_CB(on_NtFlushBuffersFile_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtFlushBuffersFile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtFlushBuffersFile_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 73 NTSTATUS NtApphelpCacheControl ['APPHELPCOMMAND type', ' PVOID buf']
+case 73: {
+if (PPP_CHECK_CB(on_NtApphelpCacheControl_enter) || PPP_CHECK_CB(on_NtApphelpCacheControl_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtApphelpCacheControl_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtApphelpCacheControl_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 74 NTSTATUS NtCreateProcessEx ['PHANDLE ProcessHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' HANDLE ParentProcess', ' ULONG Flags', ' HANDLE SectionHandle', ' HANDLE DebugPort', ' HANDLE ExceptionPort', ' ULONG JobMemberLevel']
+case 74: {
+if (PPP_CHECK_CB(on_NtCreateProcessEx_enter) || PPP_CHECK_CB(on_NtCreateProcessEx_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+uint32_t arg4 = get_32(env, 4);
+target_ulong arg5 = get_64(env, 5);
+target_ulong arg6 = get_64(env, 6);
+target_ulong arg7 = get_64(env, 7);
+uint32_t arg8 = get_32(env, 8);
+if (PPP_CHECK_CB(on_NtCreateProcessEx_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(target_ulong));
+memcpy(rp.params[7], &arg7, sizeof(target_ulong));
+memcpy(rp.params[8], &arg8, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCreateProcessEx_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
+}; break;
+// 75 NTSTATUS NtCreateThread ['PHANDLE ThreadHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' HANDLE ProcessHandle', ' PCLIENT_ID ClientId', ' PCONTEXT ThreadContext', ' PINITIAL_TEB InitialTeb', ' BOOLEAN CreateSuspended']
+case 75: {
+if (PPP_CHECK_CB(on_NtCreateThread_enter) || PPP_CHECK_CB(on_NtCreateThread_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+target_ulong arg6 = get_64(env, 6);
+uint32_t arg7 = get_32(env, 7);
+if (PPP_CHECK_CB(on_NtCreateThread_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(target_ulong));
+memcpy(rp.params[7], &arg7, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCreateThread_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}
+}; break;
+// 76 NTSTATUS NtIsProcessInJob ['HANDLE ProcessHandle', ' HANDLE JobHandle']
+case 76: {
+if (PPP_CHECK_CB(on_NtIsProcessInJob_enter) || PPP_CHECK_CB(on_NtIsProcessInJob_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtIsProcessInJob_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtIsProcessInJob_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 77 NTSTATUS NtProtectVirtualMemory ['HANDLE ProcessHandle', ' PVOID *BaseAddress', ' PSIZE_T RegionSize', ' WIN32_PROTECTION_MASK NewProtectWin32', ' PULONG OldProtect']
+case 77: {
+if (PPP_CHECK_CB(on_NtProtectVirtualMemory_enter) || PPP_CHECK_CB(on_NtProtectVirtualMemory_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtProtectVirtualMemory_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtProtectVirtualMemory_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 78 NTSTATUS NtQuerySection ['HANDLE SectionHandle', ' SECTION_INFORMATION_CLASS SectionInformationClass', ' PVOID SectionInformation', ' SIZE_T SectionInformationLength', ' PSIZE_T ReturnLength']
+case 78: {
+if (PPP_CHECK_CB(on_NtQuerySection_enter) || PPP_CHECK_CB(on_NtQuerySection_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtQuerySection_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQuerySection_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 79 NTSTATUS NtResumeThread ['HANDLE ThreadHandle', ' PULONG PreviousSuspendCount']
+case 79: {
+if (PPP_CHECK_CB(on_NtResumeThread_enter) || PPP_CHECK_CB(on_NtResumeThread_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtResumeThread_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtResumeThread_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 80 NTSTATUS NtTerminateThread ['HANDLE ThreadHandle', ' NTSTATUS ExitStatus']
+case 80: {
+if (PPP_CHECK_CB(on_NtTerminateThread_enter) || PPP_CHECK_CB(on_NtTerminateThread_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+if (PPP_CHECK_CB(on_NtTerminateThread_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtTerminateThread_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 81 NTSTATUS NtReadRequestData ['HANDLE PortHandle', ' PPORT_MESSAGE Message', ' ULONG DataEntryIndex', ' PVOID Buffer', ' SIZE_T BufferSize', ' PSIZE_T NumberOfBytesRead']
+case 81: {
+if (PPP_CHECK_CB(on_NtReadRequestData_enter) || PPP_CHECK_CB(on_NtReadRequestData_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_NtReadRequestData_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtReadRequestData_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 82 NTSTATUS NtCreateFile ['PHANDLE FileHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PIO_STATUS_BLOCK IoStatusBlock', ' PLARGE_INTEGER AllocationSize', ' ULONG FileAttributes', ' ULONG ShareAccess', ' ULONG CreateDisposition', ' ULONG CreateOptions', ' PVOID EaBuffer', ' ULONG EaLength']
+case 82: {
+if (PPP_CHECK_CB(on_NtCreateFile_enter) || PPP_CHECK_CB(on_NtCreateFile_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+uint32_t arg5 = get_32(env, 5);
+uint32_t arg6 = get_32(env, 6);
+uint32_t arg7 = get_32(env, 7);
+uint32_t arg8 = get_32(env, 8);
+target_ulong arg9 = get_64(env, 9);
+uint32_t arg10 = get_32(env, 10);
+if (PPP_CHECK_CB(on_NtCreateFile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(uint32_t));
+memcpy(rp.params[6], &arg6, sizeof(uint32_t));
+memcpy(rp.params[7], &arg7, sizeof(uint32_t));
+memcpy(rp.params[8], &arg8, sizeof(uint32_t));
+memcpy(rp.params[9], &arg9, sizeof(target_ulong));
+memcpy(rp.params[10], &arg10, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCreateFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+}
+}; break;
+// 83 NTSTATUS NtQueryEvent ['HANDLE EventHandle', ' EVENT_INFORMATION_CLASS EventInformationClass', ' PVOID EventInformation', ' ULONG EventInformationLength', ' PULONG ReturnLength']
+case 83: {
+if (PPP_CHECK_CB(on_NtQueryEvent_enter) || PPP_CHECK_CB(on_NtQueryEvent_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtQueryEvent_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryEvent_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 84 NTSTATUS NtWriteRequestData ['HANDLE PortHandle', ' PPORT_MESSAGE Message', ' ULONG DataEntryIndex', ' PVOID Buffer', ' SIZE_T BufferSize', ' PSIZE_T NumberOfBytesWritten']
+case 84: {
+if (PPP_CHECK_CB(on_NtWriteRequestData_enter) || PPP_CHECK_CB(on_NtWriteRequestData_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_NtWriteRequestData_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtWriteRequestData_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 85 NTSTATUS NtOpenDirectoryObject ['PHANDLE DirectoryHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 85: {
+if (PPP_CHECK_CB(on_NtOpenDirectoryObject_enter) || PPP_CHECK_CB(on_NtOpenDirectoryObject_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtOpenDirectoryObject_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenDirectoryObject_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 86 NTSTATUS NtAccessCheckByTypeAndAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' PUNICODE_STRING ObjectTypeName', ' PUNICODE_STRING ObjectName', ' PSECURITY_DESCRIPTOR SecurityDescriptor', ' PSID PrincipalSelfSid', ' ACCESS_MASK DesiredAccess', ' AUDIT_EVENT_TYPE AuditType', ' ULONG Flags', ' POBJECT_TYPE_LIST ObjectTypeList', ' ULONG ObjectTypeListLength', ' PGENERIC_MAPPING GenericMapping', ' BOOLEAN ObjectCreation', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus', ' PBOOLEAN GenerateOnClose']
+case 86: {
+if (PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_enter) || PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+uint32_t arg6 = get_32(env, 6);
+uint32_t arg7 = get_32(env, 7);
+uint32_t arg8 = get_32(env, 8);
+target_ulong arg9 = get_64(env, 9);
+uint32_t arg10 = get_32(env, 10);
+target_ulong arg11 = get_64(env, 11);
+uint32_t arg12 = get_32(env, 12);
+target_ulong arg13 = get_64(env, 13);
+target_ulong arg14 = get_64(env, 14);
+target_ulong arg15 = get_64(env, 15);
+if (PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(uint32_t));
+memcpy(rp.params[7], &arg7, sizeof(uint32_t));
+memcpy(rp.params[8], &arg8, sizeof(uint32_t));
+memcpy(rp.params[9], &arg9, sizeof(target_ulong));
+memcpy(rp.params[10], &arg10, sizeof(uint32_t));
+memcpy(rp.params[11], &arg11, sizeof(target_ulong));
+memcpy(rp.params[12], &arg12, sizeof(uint32_t));
+memcpy(rp.params[13], &arg13, sizeof(target_ulong));
+memcpy(rp.params[14], &arg14, sizeof(target_ulong));
+memcpy(rp.params[15], &arg15, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAccessCheckByTypeAndAuditAlarm_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13,arg14,arg15) ; 
+}
+}; break;
+// 87 NTSTATUS NtQuerySystemTime ['PLARGE_INTEGER SystemTime']
+case 87: {
+if (PPP_CHECK_CB(on_NtQuerySystemTime_enter) || PPP_CHECK_CB(on_NtQuerySystemTime_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtQuerySystemTime_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQuerySystemTime_enter, env,pc,arg0) ; 
+}
+}; break;
+// 88 NTSTATUS NtWaitForMultipleObjects ['ULONG Count', ' HANDLE Handles[]', ' WAIT_TYPE WaitType', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout']
+case 88: {
+if (PPP_CHECK_CB(on_NtWaitForMultipleObjects_enter) || PPP_CHECK_CB(on_NtWaitForMultipleObjects_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtWaitForMultipleObjects_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtWaitForMultipleObjects_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 89 NTSTATUS NtSetInformationObject ['HANDLE Handle', ' OBJECT_INFORMATION_CLASS ObjectInformationClass', ' PVOID ObjectInformation', ' ULONG ObjectInformationLength']
+case 89: {
+if (PPP_CHECK_CB(on_NtSetInformationObject_enter) || PPP_CHECK_CB(on_NtSetInformationObject_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_NtSetInformationObject_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetInformationObject_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 90 NTSTATUS NtCancelIoFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock']
+case 90: {
+if (PPP_CHECK_CB(on_NtCancelIoFile_enter) || PPP_CHECK_CB(on_NtCancelIoFile_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtCancelIoFile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCancelIoFile_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 91 NTSTATUS NtTraceEvent ['HANDLE TraceHandle', ' ULONG Flags', ' ULONG FieldSize', ' PVOID Fields']
+case 91: {
+if (PPP_CHECK_CB(on_NtTraceEvent_enter) || PPP_CHECK_CB(on_NtTraceEvent_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_NtTraceEvent_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtTraceEvent_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 92 NTSTATUS NtPowerInformation ['POWER_INFORMATION_LEVEL InformationLevel', ' PVOID InputBuffer', ' ULONG InputBufferLength', ' PVOID OutputBuffer', ' ULONG OutputBufferLength']
+case 92: {
+if (PPP_CHECK_CB(on_NtPowerInformation_enter) || PPP_CHECK_CB(on_NtPowerInformation_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+uint32_t arg4 = get_32(env, 4);
+if (PPP_CHECK_CB(on_NtPowerInformation_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtPowerInformation_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 93 NTSTATUS NtSetValueKey ['HANDLE KeyHandle', ' PUNICODE_STRING ValueName', ' ULONG TitleIndex', ' ULONG Type', ' PVOID Data', ' ULONG DataSize']
+case 93: {
+if (PPP_CHECK_CB(on_NtSetValueKey_enter) || PPP_CHECK_CB(on_NtSetValueKey_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+uint32_t arg5 = get_32(env, 5);
+if (PPP_CHECK_CB(on_NtSetValueKey_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetValueKey_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 94 NTSTATUS NtCancelTimer ['HANDLE TimerHandle', ' PBOOLEAN CurrentState']
+case 94: {
+if (PPP_CHECK_CB(on_NtCancelTimer_enter) || PPP_CHECK_CB(on_NtCancelTimer_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtCancelTimer_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCancelTimer_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 95 NTSTATUS NtSetTimer ['HANDLE TimerHandle', ' PLARGE_INTEGER DueTime', ' PTIMER_APC_ROUTINE TimerApcRoutine', ' PVOID TimerContext', ' BOOLEAN WakeTimer', ' LONG Period', ' PBOOLEAN PreviousState']
+case 95: {
+if (PPP_CHECK_CB(on_NtSetTimer_enter) || PPP_CHECK_CB(on_NtSetTimer_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+uint32_t arg4 = get_32(env, 4);
+int32_t arg5 = get_s32(env, 5);
+target_ulong arg6 = get_64(env, 6);
+if (PPP_CHECK_CB(on_NtSetTimer_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(int32_t));
+memcpy(rp.params[6], &arg6, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetTimer_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+}
+}; break;
+// 96 NTSTATUS NtAcceptConnectPort ['PHANDLE PortHandle', ' PVOID PortContext', ' PPORT_MESSAGE ConnectionRequest', ' BOOLEAN AcceptConnection', ' PPORT_VIEW ServerView', ' PREMOTE_PORT_VIEW ClientView']
+case 96: {
+if (PPP_CHECK_CB(on_NtAcceptConnectPort_enter) || PPP_CHECK_CB(on_NtAcceptConnectPort_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_NtAcceptConnectPort_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAcceptConnectPort_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 97 NTSTATUS NtAccessCheck ['PSECURITY_DESCRIPTOR SecurityDescriptor', ' HANDLE ClientToken', ' ACCESS_MASK DesiredAccess', ' PGENERIC_MAPPING GenericMapping', ' PPRIVILEGE_SET PrivilegeSet', ' PULONG PrivilegeSetLength', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus']
+case 97: {
+if (PPP_CHECK_CB(on_NtAccessCheck_enter) || PPP_CHECK_CB(on_NtAccessCheck_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+target_ulong arg6 = get_64(env, 6);
+target_ulong arg7 = get_64(env, 7);
+if (PPP_CHECK_CB(on_NtAccessCheck_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(target_ulong));
+memcpy(rp.params[7], &arg7, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAccessCheck_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}
+}; break;
+// 98 NTSTATUS NtAccessCheckByType ['PSECURITY_DESCRIPTOR SecurityDescriptor', ' PSID PrincipalSelfSid', ' HANDLE ClientToken', ' ACCESS_MASK DesiredAccess', ' POBJECT_TYPE_LIST ObjectTypeList', ' ULONG ObjectTypeListLength', ' PGENERIC_MAPPING GenericMapping', ' PPRIVILEGE_SET PrivilegeSet', ' PULONG PrivilegeSetLength', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus']
+case 98: {
+if (PPP_CHECK_CB(on_NtAccessCheckByType_enter) || PPP_CHECK_CB(on_NtAccessCheckByType_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+uint32_t arg5 = get_32(env, 5);
+target_ulong arg6 = get_64(env, 6);
+target_ulong arg7 = get_64(env, 7);
+target_ulong arg8 = get_64(env, 8);
+target_ulong arg9 = get_64(env, 9);
+target_ulong arg10 = get_64(env, 10);
+if (PPP_CHECK_CB(on_NtAccessCheckByType_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(uint32_t));
+memcpy(rp.params[6], &arg6, sizeof(target_ulong));
+memcpy(rp.params[7], &arg7, sizeof(target_ulong));
+memcpy(rp.params[8], &arg8, sizeof(target_ulong));
+memcpy(rp.params[9], &arg9, sizeof(target_ulong));
+memcpy(rp.params[10], &arg10, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAccessCheckByType_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+}
+}; break;
+// 99 NTSTATUS NtAccessCheckByTypeResultList ['PSECURITY_DESCRIPTOR SecurityDescriptor', ' PSID PrincipalSelfSid', ' HANDLE ClientToken', ' ACCESS_MASK DesiredAccess', ' POBJECT_TYPE_LIST ObjectTypeList', ' ULONG ObjectTypeListLength', ' PGENERIC_MAPPING GenericMapping', ' PPRIVILEGE_SET PrivilegeSet', ' PULONG PrivilegeSetLength', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus']
+case 99: {
+if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_enter) || PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+uint32_t arg5 = get_32(env, 5);
+target_ulong arg6 = get_64(env, 6);
+target_ulong arg7 = get_64(env, 7);
+target_ulong arg8 = get_64(env, 8);
+target_ulong arg9 = get_64(env, 9);
+target_ulong arg10 = get_64(env, 10);
+if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(uint32_t));
+memcpy(rp.params[6], &arg6, sizeof(target_ulong));
+memcpy(rp.params[7], &arg7, sizeof(target_ulong));
+memcpy(rp.params[8], &arg8, sizeof(target_ulong));
+memcpy(rp.params[9], &arg9, sizeof(target_ulong));
+memcpy(rp.params[10], &arg10, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAccessCheckByTypeResultList_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+}
+}; break;
+// 100 NTSTATUS NtAccessCheckByTypeResultListAndAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' PUNICODE_STRING ObjectTypeName', ' PUNICODE_STRING ObjectName', ' PSECURITY_DESCRIPTOR SecurityDescriptor', ' PSID PrincipalSelfSid', ' ACCESS_MASK DesiredAccess', ' AUDIT_EVENT_TYPE AuditType', ' ULONG Flags', ' POBJECT_TYPE_LIST ObjectTypeList', ' ULONG ObjectTypeListLength', ' PGENERIC_MAPPING GenericMapping', ' BOOLEAN ObjectCreation', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus', ' PBOOLEAN GenerateOnClose']
+case 100: {
+if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_enter) || PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+uint32_t arg6 = get_32(env, 6);
+uint32_t arg7 = get_32(env, 7);
+uint32_t arg8 = get_32(env, 8);
+target_ulong arg9 = get_64(env, 9);
+uint32_t arg10 = get_32(env, 10);
+target_ulong arg11 = get_64(env, 11);
+uint32_t arg12 = get_32(env, 12);
+target_ulong arg13 = get_64(env, 13);
+target_ulong arg14 = get_64(env, 14);
+target_ulong arg15 = get_64(env, 15);
+if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(uint32_t));
+memcpy(rp.params[7], &arg7, sizeof(uint32_t));
+memcpy(rp.params[8], &arg8, sizeof(uint32_t));
+memcpy(rp.params[9], &arg9, sizeof(target_ulong));
+memcpy(rp.params[10], &arg10, sizeof(uint32_t));
+memcpy(rp.params[11], &arg11, sizeof(target_ulong));
+memcpy(rp.params[12], &arg12, sizeof(uint32_t));
+memcpy(rp.params[13], &arg13, sizeof(target_ulong));
+memcpy(rp.params[14], &arg14, sizeof(target_ulong));
+memcpy(rp.params[15], &arg15, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13,arg14,arg15) ; 
+}
+}; break;
+// 101 NTSTATUS NtAccessCheckByTypeResultListAndAuditAlarmByHandle ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' HANDLE ClientToken', ' PUNICODE_STRING ObjectTypeName', ' PUNICODE_STRING ObjectName', ' PSECURITY_DESCRIPTOR SecurityDescriptor', ' PSID PrincipalSelfSid', ' ACCESS_MASK DesiredAccess', ' AUDIT_EVENT_TYPE AuditType', ' ULONG Flags', ' POBJECT_TYPE_LIST ObjectTypeList', ' ULONG ObjectTypeListLength', ' PGENERIC_MAPPING GenericMapping', ' BOOLEAN ObjectCreation', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus', ' PBOOLEAN GenerateOnClose']
+case 101: {
+if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_enter) || PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+target_ulong arg6 = get_64(env, 6);
+uint32_t arg7 = get_32(env, 7);
+uint32_t arg8 = get_32(env, 8);
+uint32_t arg9 = get_32(env, 9);
+target_ulong arg10 = get_64(env, 10);
+uint32_t arg11 = get_32(env, 11);
+target_ulong arg12 = get_64(env, 12);
+uint32_t arg13 = get_32(env, 13);
+target_ulong arg14 = get_64(env, 14);
+target_ulong arg15 = get_64(env, 15);
+target_ulong arg16 = get_64(env, 16);
+if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(target_ulong));
+memcpy(rp.params[7], &arg7, sizeof(uint32_t));
+memcpy(rp.params[8], &arg8, sizeof(uint32_t));
+memcpy(rp.params[9], &arg9, sizeof(uint32_t));
+memcpy(rp.params[10], &arg10, sizeof(target_ulong));
+memcpy(rp.params[11], &arg11, sizeof(uint32_t));
+memcpy(rp.params[12], &arg12, sizeof(target_ulong));
+memcpy(rp.params[13], &arg13, sizeof(uint32_t));
+memcpy(rp.params[14], &arg14, sizeof(target_ulong));
+memcpy(rp.params[15], &arg15, sizeof(target_ulong));
+memcpy(rp.params[16], &arg16, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13,arg14,arg15,arg16) ; 
+}
+}; break;
+// 102 NTSTATUS NtAddBootEntry ['PBOOT_ENTRY BootEntry', ' PULONG Id']
+case 102: {
+if (PPP_CHECK_CB(on_NtAddBootEntry_enter) || PPP_CHECK_CB(on_NtAddBootEntry_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtAddBootEntry_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAddBootEntry_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 103 NTSTATUS NtAddDriverEntry ['PEFI_DRIVER_ENTRY DriverEntry', ' PULONG Id']
+case 103: {
+if (PPP_CHECK_CB(on_NtAddDriverEntry_enter) || PPP_CHECK_CB(on_NtAddDriverEntry_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtAddDriverEntry_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAddDriverEntry_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 104 NTSTATUS NtAdjustGroupsToken ['HANDLE TokenHandle', ' BOOLEAN ResetToDefault', ' PTOKEN_GROUPS NewState', ' ULONG BufferLength', ' PTOKEN_GROUPS PreviousState', ' PULONG ReturnLength']
+case 104: {
+if (PPP_CHECK_CB(on_NtAdjustGroupsToken_enter) || PPP_CHECK_CB(on_NtAdjustGroupsToken_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_NtAdjustGroupsToken_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAdjustGroupsToken_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 105 NTSTATUS NtAlertResumeThread ['HANDLE ThreadHandle', ' PULONG PreviousSuspendCount']
+case 105: {
+if (PPP_CHECK_CB(on_NtAlertResumeThread_enter) || PPP_CHECK_CB(on_NtAlertResumeThread_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtAlertResumeThread_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlertResumeThread_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 106 NTSTATUS NtAlertThread ['HANDLE ThreadHandle']
+case 106: {
+if (PPP_CHECK_CB(on_NtAlertThread_enter) || PPP_CHECK_CB(on_NtAlertThread_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtAlertThread_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlertThread_enter, env,pc,arg0) ; 
+}
+}; break;
+// 107 NTSTATUS NtAllocateLocallyUniqueId ['PLUID Luid']
+case 107: {
+if (PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_enter) || PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAllocateLocallyUniqueId_enter, env,pc,arg0) ; 
+}
+}; break;
+// 108 NTSTATUS NtAllocateReserveObject ['PHANDLE MemoryReserveHandle', ' POBJECT_ATTRIBUTES ObjectAttributes', ' MEMORY_RESERVE_TYPE Type']
+case 108: {
+if (PPP_CHECK_CB(on_NtAllocateReserveObject_enter) || PPP_CHECK_CB(on_NtAllocateReserveObject_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+if (PPP_CHECK_CB(on_NtAllocateReserveObject_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtAllocateReserveObject_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 109 NTSTATUS NtAllocateUserPhysicalPages ['HANDLE ProcessHandle', ' PULONG_PTR NumberOfPages', ' PULONG_PTR UserPfnArray']
+case 109: {
+if (PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_enter) || PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAllocateUserPhysicalPages_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 110 NTSTATUS NtAllocateUuids ['PULARGE_INTEGER Time', ' PULONG Range', ' PULONG Sequence', ' PCHAR Seed']
+case 110: {
+if (PPP_CHECK_CB(on_NtAllocateUuids_enter) || PPP_CHECK_CB(on_NtAllocateUuids_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_NtAllocateUuids_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAllocateUuids_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 111 NTSTATUS NtAlpcAcceptConnectPort ['PHANDLE PortHandle', ' HANDLE ConnectionPortHandle', ' ULONG Flags', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PALPC_PORT_ATTRIBUTES PortAttributes', ' PVOID PortContext', ' PPORT_MESSAGE ConnectionRequest', ' PALPC_MESSAGE_ATTRIBUTES ConnectionMessageAttributes', ' BOOLEAN AcceptConnection']
+case 111: {
+if (PPP_CHECK_CB(on_NtAlpcAcceptConnectPort_enter) || PPP_CHECK_CB(on_NtAlpcAcceptConnectPort_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+target_ulong arg6 = get_64(env, 6);
+target_ulong arg7 = get_64(env, 7);
+uint32_t arg8 = get_32(env, 8);
+if (PPP_CHECK_CB(on_NtAlpcAcceptConnectPort_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(target_ulong));
+memcpy(rp.params[7], &arg7, sizeof(target_ulong));
+memcpy(rp.params[8], &arg8, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtAlpcAcceptConnectPort_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
+}; break;
+// 112 NTSTATUS NtAlpcCancelMessage ['HANDLE PortHandle', ' ULONG Flags', ' PALPC_CONTEXT_ATTR MessageContext']
+case 112: {
+if (PPP_CHECK_CB(on_NtAlpcCancelMessage_enter) || PPP_CHECK_CB(on_NtAlpcCancelMessage_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtAlpcCancelMessage_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcCancelMessage_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 113 NTSTATUS NtAlpcConnectPort ['PHANDLE PortHandle', ' PUNICODE_STRING PortName', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PALPC_PORT_ATTRIBUTES PortAttributes', ' ULONG Flags', ' PSID RequiredServerSid', ' PPORT_MESSAGE ConnectionMessage', ' PULONG BufferLength', ' PALPC_MESSAGE_ATTRIBUTES OutMessageAttributes', ' PALPC_MESSAGE_ATTRIBUTES InMessageAttributes', ' PLARGE_INTEGER Timeout']
+case 113: {
+if (PPP_CHECK_CB(on_NtAlpcConnectPort_enter) || PPP_CHECK_CB(on_NtAlpcConnectPort_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+uint32_t arg4 = get_32(env, 4);
+target_ulong arg5 = get_64(env, 5);
+target_ulong arg6 = get_64(env, 6);
+target_ulong arg7 = get_64(env, 7);
+target_ulong arg8 = get_64(env, 8);
+target_ulong arg9 = get_64(env, 9);
+target_ulong arg10 = get_64(env, 10);
+if (PPP_CHECK_CB(on_NtAlpcConnectPort_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(target_ulong));
+memcpy(rp.params[7], &arg7, sizeof(target_ulong));
+memcpy(rp.params[8], &arg8, sizeof(target_ulong));
+memcpy(rp.params[9], &arg9, sizeof(target_ulong));
+memcpy(rp.params[10], &arg10, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcConnectPort_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+}
+}; break;
+// 114 NTSTATUS NtAlpcCreatePort ['PHANDLE PortHandle', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PALPC_PORT_ATTRIBUTES PortAttributes']
+case 114: {
+if (PPP_CHECK_CB(on_NtAlpcCreatePort_enter) || PPP_CHECK_CB(on_NtAlpcCreatePort_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtAlpcCreatePort_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcCreatePort_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 115 NTSTATUS NtAlpcCreatePortSection ['HANDLE PortHandle', ' ULONG Flags', ' HANDLE SectionHandle', ' SIZE_T SectionSize', ' PALPC_HANDLE AlpcSectionHandle', ' PSIZE_T ActualSectionSize']
+case 115: {
+if (PPP_CHECK_CB(on_NtAlpcCreatePortSection_enter) || PPP_CHECK_CB(on_NtAlpcCreatePortSection_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_NtAlpcCreatePortSection_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcCreatePortSection_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 116 NTSTATUS NtAlpcCreateResourceReserve ['HANDLE PortHandle', ' ULONG Flags', ' SIZE_T MessageSize', ' PALPC_HANDLE ResourceId']
+case 116: {
+if (PPP_CHECK_CB(on_NtAlpcCreateResourceReserve_enter) || PPP_CHECK_CB(on_NtAlpcCreateResourceReserve_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_NtAlpcCreateResourceReserve_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcCreateResourceReserve_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 117 NTSTATUS NtAlpcCreateSectionView ['HANDLE PortHandle', ' ULONG Flags', ' PALPC_DATA_VIEW_ATTR ViewAttributes']
+case 117: {
+if (PPP_CHECK_CB(on_NtAlpcCreateSectionView_enter) || PPP_CHECK_CB(on_NtAlpcCreateSectionView_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtAlpcCreateSectionView_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcCreateSectionView_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 118 NTSTATUS NtAlpcCreateSecurityContext ['HANDLE PortHandle', ' ULONG Flags', ' PALPC_SECURITY_ATTR SecurityAttribute']
+case 118: {
+if (PPP_CHECK_CB(on_NtAlpcCreateSecurityContext_enter) || PPP_CHECK_CB(on_NtAlpcCreateSecurityContext_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtAlpcCreateSecurityContext_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcCreateSecurityContext_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 119 NTSTATUS NtAlpcDeletePortSection ['HANDLE PortHandle', ' ULONG Flags', ' ALPC_HANDLE SectionHandle']
+case 119: {
+if (PPP_CHECK_CB(on_NtAlpcDeletePortSection_enter) || PPP_CHECK_CB(on_NtAlpcDeletePortSection_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtAlpcDeletePortSection_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcDeletePortSection_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 120 NTSTATUS NtAlpcDeleteResourceReserve ['HANDLE PortHandle', ' ULONG Flags', ' ALPC_HANDLE ResourceId']
+case 120: {
+if (PPP_CHECK_CB(on_NtAlpcDeleteResourceReserve_enter) || PPP_CHECK_CB(on_NtAlpcDeleteResourceReserve_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtAlpcDeleteResourceReserve_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcDeleteResourceReserve_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 121 NTSTATUS NtAlpcDeleteSectionView ['HANDLE PortHandle', ' ULONG Flags', ' PVOID ViewBase']
+case 121: {
+if (PPP_CHECK_CB(on_NtAlpcDeleteSectionView_enter) || PPP_CHECK_CB(on_NtAlpcDeleteSectionView_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtAlpcDeleteSectionView_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcDeleteSectionView_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 122 NTSTATUS NtAlpcDeleteSecurityContext ['HANDLE PortHandle', ' ULONG Flags', ' ALPC_HANDLE ContextHandle']
+case 122: {
+if (PPP_CHECK_CB(on_NtAlpcDeleteSecurityContext_enter) || PPP_CHECK_CB(on_NtAlpcDeleteSecurityContext_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtAlpcDeleteSecurityContext_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcDeleteSecurityContext_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 123 NTSTATUS NtAlpcDisconnectPort ['HANDLE PortHandle', ' ULONG Flags']
+case 123: {
+if (PPP_CHECK_CB(on_NtAlpcDisconnectPort_enter) || PPP_CHECK_CB(on_NtAlpcDisconnectPort_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+if (PPP_CHECK_CB(on_NtAlpcDisconnectPort_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtAlpcDisconnectPort_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 124 NTSTATUS NtAlpcImpersonateClientOfPort ['HANDLE PortHandle', ' PPORT_MESSAGE PortMessage', ' PVOID Reserved']
+case 124: {
+if (PPP_CHECK_CB(on_NtAlpcImpersonateClientOfPort_enter) || PPP_CHECK_CB(on_NtAlpcImpersonateClientOfPort_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtAlpcImpersonateClientOfPort_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcImpersonateClientOfPort_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 125 NTSTATUS NtAlpcOpenSenderProcess ['PHANDLE ProcessHandle', ' HANDLE PortHandle', ' PPORT_MESSAGE PortMessage', ' ULONG Flags', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 125: {
+if (PPP_CHECK_CB(on_NtAlpcOpenSenderProcess_enter) || PPP_CHECK_CB(on_NtAlpcOpenSenderProcess_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+uint32_t arg4 = get_32(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_NtAlpcOpenSenderProcess_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcOpenSenderProcess_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 126 NTSTATUS NtAlpcOpenSenderThread ['PHANDLE ThreadHandle', ' HANDLE PortHandle', ' PPORT_MESSAGE PortMessage', ' ULONG Flags', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 126: {
+if (PPP_CHECK_CB(on_NtAlpcOpenSenderThread_enter) || PPP_CHECK_CB(on_NtAlpcOpenSenderThread_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+uint32_t arg4 = get_32(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_NtAlpcOpenSenderThread_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcOpenSenderThread_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 127 NTSTATUS NtAlpcQueryInformation ['HANDLE PortHandle', ' ALPC_PORT_INFORMATION_CLASS PortInformationClass', ' PVOID PortInformation', ' ULONG Length', ' PULONG ReturnLength']
+case 127: {
+if (PPP_CHECK_CB(on_NtAlpcQueryInformation_enter) || PPP_CHECK_CB(on_NtAlpcQueryInformation_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtAlpcQueryInformation_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcQueryInformation_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 128 NTSTATUS NtAlpcQueryInformationMessage ['HANDLE PortHandle', ' PPORT_MESSAGE PortMessage', ' ALPC_MESSAGE_INFORMATION_CLASS MessageInformationClass', ' PVOID MessageInformation', ' ULONG Length', ' PULONG ReturnLength']
+case 128: {
+if (PPP_CHECK_CB(on_NtAlpcQueryInformationMessage_enter) || PPP_CHECK_CB(on_NtAlpcQueryInformationMessage_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+uint32_t arg4 = get_32(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_NtAlpcQueryInformationMessage_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcQueryInformationMessage_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 129 NTSTATUS NtAlpcRevokeSecurityContext ['HANDLE PortHandle', ' ULONG Flags', ' ALPC_HANDLE ContextHandle']
+case 129: {
+if (PPP_CHECK_CB(on_NtAlpcRevokeSecurityContext_enter) || PPP_CHECK_CB(on_NtAlpcRevokeSecurityContext_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtAlpcRevokeSecurityContext_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcRevokeSecurityContext_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 130 NTSTATUS NtAlpcSendWaitReceivePort ['HANDLE PortHandle', ' ULONG Flags', ' PPORT_MESSAGE SendMessage', ' PALPC_MESSAGE_ATTRIBUTES SendMessageAttributes', ' PPORT_MESSAGE ReceiveMessage', ' PULONG BufferLength', ' PALPC_MESSAGE_ATTRIBUTES ReceiveMessageAttributes', ' PLARGE_INTEGER Timeout']
+case 130: {
+if (PPP_CHECK_CB(on_NtAlpcSendWaitReceivePort_enter) || PPP_CHECK_CB(on_NtAlpcSendWaitReceivePort_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+target_ulong arg6 = get_64(env, 6);
+target_ulong arg7 = get_64(env, 7);
+if (PPP_CHECK_CB(on_NtAlpcSendWaitReceivePort_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(target_ulong));
+memcpy(rp.params[7], &arg7, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcSendWaitReceivePort_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}
+}; break;
+// 131 NTSTATUS NtAlpcSetInformation ['HANDLE PortHandle', ' ALPC_PORT_INFORMATION_CLASS PortInformationClass', ' PVOID PortInformation', ' ULONG Length']
+case 131: {
+if (PPP_CHECK_CB(on_NtAlpcSetInformation_enter) || PPP_CHECK_CB(on_NtAlpcSetInformation_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_NtAlpcSetInformation_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtAlpcSetInformation_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 132 NTSTATUS NtAreMappedFilesTheSame ['PVOID File1MappedAsAnImage', ' PVOID File2MappedAsFile']
+case 132: {
+if (PPP_CHECK_CB(on_NtAreMappedFilesTheSame_enter) || PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAreMappedFilesTheSame_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 133 NTSTATUS NtAssignProcessToJobObject ['HANDLE JobHandle', ' HANDLE ProcessHandle']
+case 133: {
+if (PPP_CHECK_CB(on_NtAssignProcessToJobObject_enter) || PPP_CHECK_CB(on_NtAssignProcessToJobObject_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtAssignProcessToJobObject_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAssignProcessToJobObject_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 134 NTSTATUS NtCancelIoFileEx ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoRequestToCancel', ' PIO_STATUS_BLOCK IoStatusBlock']
+case 134: {
+if (PPP_CHECK_CB(on_NtCancelIoFileEx_enter) || PPP_CHECK_CB(on_NtCancelIoFileEx_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtCancelIoFileEx_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCancelIoFileEx_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 135 NTSTATUS NtCancelSynchronousIoFile ['HANDLE ThreadHandle', ' PIO_STATUS_BLOCK IoRequestToCancel', ' PIO_STATUS_BLOCK IoStatusBlock']
+case 135: {
+if (PPP_CHECK_CB(on_NtCancelSynchronousIoFile_enter) || PPP_CHECK_CB(on_NtCancelSynchronousIoFile_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtCancelSynchronousIoFile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCancelSynchronousIoFile_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 136 NTSTATUS NtCommitComplete ['HANDLE EnlistmentHandle', ' PLARGE_INTEGER TmVirtualClock']
+case 136: {
+if (PPP_CHECK_CB(on_NtCommitComplete_enter) || PPP_CHECK_CB(on_NtCommitComplete_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtCommitComplete_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCommitComplete_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 137 NTSTATUS NtCommitEnlistment ['HANDLE EnlistmentHandle', ' PLARGE_INTEGER TmVirtualClock']
+case 137: {
+if (PPP_CHECK_CB(on_NtCommitEnlistment_enter) || PPP_CHECK_CB(on_NtCommitEnlistment_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtCommitEnlistment_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCommitEnlistment_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 138 NTSTATUS NtCommitTransaction ['HANDLE TransactionHandle', ' BOOLEAN Wait']
+case 138: {
+if (PPP_CHECK_CB(on_NtCommitTransaction_enter) || PPP_CHECK_CB(on_NtCommitTransaction_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+if (PPP_CHECK_CB(on_NtCommitTransaction_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCommitTransaction_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 139 NTSTATUS NtCompactKeys ['ULONG Count', ' HANDLE KeyArray[]']
+case 139: {
+if (PPP_CHECK_CB(on_NtCompactKeys_enter) || PPP_CHECK_CB(on_NtCompactKeys_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtCompactKeys_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCompactKeys_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 140 NTSTATUS NtCompareTokens ['HANDLE FirstTokenHandle', ' HANDLE SecondTokenHandle', ' PBOOLEAN Equal']
+case 140: {
+if (PPP_CHECK_CB(on_NtCompareTokens_enter) || PPP_CHECK_CB(on_NtCompareTokens_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtCompareTokens_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCompareTokens_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 141 NTSTATUS NtCompleteConnectPort ['HANDLE PortHandle']
+case 141: {
+if (PPP_CHECK_CB(on_NtCompleteConnectPort_enter) || PPP_CHECK_CB(on_NtCompleteConnectPort_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtCompleteConnectPort_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCompleteConnectPort_enter, env,pc,arg0) ; 
+}
+}; break;
+// 142 NTSTATUS NtCompressKey ['HANDLE Key']
+case 142: {
+if (PPP_CHECK_CB(on_NtCompressKey_enter) || PPP_CHECK_CB(on_NtCompressKey_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtCompressKey_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCompressKey_enter, env,pc,arg0) ; 
+}
+}; break;
+// 143 NTSTATUS NtConnectPort ['PHANDLE PortHandle', ' PUNICODE_STRING PortName', ' PSECURITY_QUALITY_OF_SERVICE SecurityQos', ' PPORT_VIEW ClientView', ' PREMOTE_PORT_VIEW ServerView', ' PULONG MaxMessageLength', ' PVOID ConnectionInformation', ' PULONG ConnectionInformationLength']
+case 143: {
+if (PPP_CHECK_CB(on_NtConnectPort_enter) || PPP_CHECK_CB(on_NtConnectPort_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+target_ulong arg6 = get_64(env, 6);
+target_ulong arg7 = get_64(env, 7);
+if (PPP_CHECK_CB(on_NtConnectPort_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(target_ulong));
+memcpy(rp.params[7], &arg7, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtConnectPort_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}
+}; break;
+// 144 NTSTATUS NtCreateDebugObject ['PHANDLE DebugObjectHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG Flags']
+case 144: {
+if (PPP_CHECK_CB(on_NtCreateDebugObject_enter) || PPP_CHECK_CB(on_NtCreateDebugObject_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_NtCreateDebugObject_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCreateDebugObject_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 145 NTSTATUS NtCreateDirectoryObject ['PHANDLE DirectoryHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 145: {
+if (PPP_CHECK_CB(on_NtCreateDirectoryObject_enter) || PPP_CHECK_CB(on_NtCreateDirectoryObject_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtCreateDirectoryObject_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateDirectoryObject_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 146 NTSTATUS NtCreateEnlistment ['PHANDLE EnlistmentHandle', ' ACCESS_MASK DesiredAccess', ' HANDLE ResourceManagerHandle', ' HANDLE TransactionHandle', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG CreateOptions', ' NOTIFICATION_MASK NotificationMask', ' PVOID EnlistmentKey']
+case 146: {
+if (PPP_CHECK_CB(on_NtCreateEnlistment_enter) || PPP_CHECK_CB(on_NtCreateEnlistment_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+uint32_t arg5 = get_32(env, 5);
+uint32_t arg6 = get_32(env, 6);
+target_ulong arg7 = get_64(env, 7);
+if (PPP_CHECK_CB(on_NtCreateEnlistment_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(uint32_t));
+memcpy(rp.params[6], &arg6, sizeof(uint32_t));
+memcpy(rp.params[7], &arg7, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateEnlistment_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}
+}; break;
+// 147 NTSTATUS NtCreateEventPair ['PHANDLE EventPairHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 147: {
+if (PPP_CHECK_CB(on_NtCreateEventPair_enter) || PPP_CHECK_CB(on_NtCreateEventPair_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtCreateEventPair_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateEventPair_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 148 NTSTATUS NtCreateIoCompletion ['PHANDLE IoCompletionHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG Count']
+case 148: {
+if (PPP_CHECK_CB(on_NtCreateIoCompletion_enter) || PPP_CHECK_CB(on_NtCreateIoCompletion_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_NtCreateIoCompletion_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCreateIoCompletion_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 149 NTSTATUS NtCreateJobObject ['PHANDLE JobHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 149: {
+if (PPP_CHECK_CB(on_NtCreateJobObject_enter) || PPP_CHECK_CB(on_NtCreateJobObject_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtCreateJobObject_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateJobObject_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 150 NTSTATUS NtCreateJobSet ['ULONG NumJob', ' PJOB_SET_ARRAY UserJobSet', ' ULONG Flags']
+case 150: {
+if (PPP_CHECK_CB(on_NtCreateJobSet_enter) || PPP_CHECK_CB(on_NtCreateJobSet_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+if (PPP_CHECK_CB(on_NtCreateJobSet_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCreateJobSet_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 151 NTSTATUS NtCreateKeyTransacted ['PHANDLE KeyHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG TitleIndex', ' PUNICODE_STRING Class', ' ULONG CreateOptions', ' HANDLE TransactionHandle', ' PULONG Disposition']
+case 151: {
+if (PPP_CHECK_CB(on_NtCreateKeyTransacted_enter) || PPP_CHECK_CB(on_NtCreateKeyTransacted_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+uint32_t arg5 = get_32(env, 5);
+target_ulong arg6 = get_64(env, 6);
+target_ulong arg7 = get_64(env, 7);
+if (PPP_CHECK_CB(on_NtCreateKeyTransacted_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(uint32_t));
+memcpy(rp.params[6], &arg6, sizeof(target_ulong));
+memcpy(rp.params[7], &arg7, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateKeyTransacted_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}
+}; break;
+// 152 NTSTATUS NtCreateKeyedEvent ['PHANDLE KeyedEventHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG Flags']
+case 152: {
+if (PPP_CHECK_CB(on_NtCreateKeyedEvent_enter) || PPP_CHECK_CB(on_NtCreateKeyedEvent_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_NtCreateKeyedEvent_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCreateKeyedEvent_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 153 NTSTATUS NtCreateMailslotFile ['PHANDLE FileHandle', ' ULONG DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG CreateOptions', ' ULONG MailslotQuota', ' ULONG MaximumMessageSize', ' PLARGE_INTEGER ReadTimeout']
+case 153: {
+if (PPP_CHECK_CB(on_NtCreateMailslotFile_enter) || PPP_CHECK_CB(on_NtCreateMailslotFile_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+uint32_t arg4 = get_32(env, 4);
+uint32_t arg5 = get_32(env, 5);
+uint32_t arg6 = get_32(env, 6);
+target_ulong arg7 = get_64(env, 7);
+if (PPP_CHECK_CB(on_NtCreateMailslotFile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(uint32_t));
+memcpy(rp.params[6], &arg6, sizeof(uint32_t));
+memcpy(rp.params[7], &arg7, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateMailslotFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}
+}; break;
+// 154 NTSTATUS NtCreateMutant ['PHANDLE MutantHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' BOOLEAN InitialOwner']
+case 154: {
+if (PPP_CHECK_CB(on_NtCreateMutant_enter) || PPP_CHECK_CB(on_NtCreateMutant_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_NtCreateMutant_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCreateMutant_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 155 NTSTATUS NtCreateNamedPipeFile ['PHANDLE FileHandle', ' ULONG DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG ShareAccess', ' ULONG CreateDisposition', ' ULONG CreateOptions', ' ULONG NamedPipeType', ' ULONG ReadMode', ' ULONG CompletionMode', ' ULONG MaximumInstances', ' ULONG InboundQuota', ' ULONG OutboundQuota', ' PLARGE_INTEGER DefaultTimeout']
+case 155: {
+if (PPP_CHECK_CB(on_NtCreateNamedPipeFile_enter) || PPP_CHECK_CB(on_NtCreateNamedPipeFile_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+uint32_t arg4 = get_32(env, 4);
+uint32_t arg5 = get_32(env, 5);
+uint32_t arg6 = get_32(env, 6);
+uint32_t arg7 = get_32(env, 7);
+uint32_t arg8 = get_32(env, 8);
+uint32_t arg9 = get_32(env, 9);
+uint32_t arg10 = get_32(env, 10);
+uint32_t arg11 = get_32(env, 11);
+uint32_t arg12 = get_32(env, 12);
+target_ulong arg13 = get_64(env, 13);
+if (PPP_CHECK_CB(on_NtCreateNamedPipeFile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(uint32_t));
+memcpy(rp.params[6], &arg6, sizeof(uint32_t));
+memcpy(rp.params[7], &arg7, sizeof(uint32_t));
+memcpy(rp.params[8], &arg8, sizeof(uint32_t));
+memcpy(rp.params[9], &arg9, sizeof(uint32_t));
+memcpy(rp.params[10], &arg10, sizeof(uint32_t));
+memcpy(rp.params[11], &arg11, sizeof(uint32_t));
+memcpy(rp.params[12], &arg12, sizeof(uint32_t));
+memcpy(rp.params[13], &arg13, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateNamedPipeFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13) ; 
+}
+}; break;
+// 156 NTSTATUS NtCreatePagingFile ['PUNICODE_STRING PageFileName', ' PLARGE_INTEGER MinimumSize', ' PLARGE_INTEGER MaximumSize', ' ULONG Priority']
+case 156: {
+if (PPP_CHECK_CB(on_NtCreatePagingFile_enter) || PPP_CHECK_CB(on_NtCreatePagingFile_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_NtCreatePagingFile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCreatePagingFile_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 157 NTSTATUS NtCreatePort ['PHANDLE PortHandle', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG MaxConnectionInfoLength', ' ULONG MaxMessageLength', ' ULONG MaxPoolUsage']
+case 157: {
+if (PPP_CHECK_CB(on_NtCreatePort_enter) || PPP_CHECK_CB(on_NtCreatePort_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+uint32_t arg3 = get_32(env, 3);
+uint32_t arg4 = get_32(env, 4);
+if (PPP_CHECK_CB(on_NtCreatePort_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCreatePort_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 158 NTSTATUS NtCreatePrivateNamespace ['PHANDLE NamespaceHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PVOID BoundaryDescriptor']
+case 158: {
+if (PPP_CHECK_CB(on_NtCreatePrivateNamespace_enter) || PPP_CHECK_CB(on_NtCreatePrivateNamespace_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_NtCreatePrivateNamespace_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreatePrivateNamespace_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 159 NTSTATUS NtCreateProcess ['PHANDLE ProcessHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' HANDLE ParentProcess', ' BOOLEAN InheritObjectTable', ' HANDLE SectionHandle', ' HANDLE DebugPort', ' HANDLE ExceptionPort']
+case 159: {
+if (PPP_CHECK_CB(on_NtCreateProcess_enter) || PPP_CHECK_CB(on_NtCreateProcess_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+uint32_t arg4 = get_32(env, 4);
+target_ulong arg5 = get_64(env, 5);
+target_ulong arg6 = get_64(env, 6);
+target_ulong arg7 = get_64(env, 7);
+if (PPP_CHECK_CB(on_NtCreateProcess_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(target_ulong));
+memcpy(rp.params[7], &arg7, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateProcess_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}
+}; break;
+// 160 NTSTATUS NtCreateProfile ['PHANDLE ProfileHandle', ' HANDLE Process', ' PVOID RangeBase', ' SIZE_T RangeSize', ' ULONG BucketSize', ' PULONG Buffer', ' ULONG BufferSize', ' KPROFILE_SOURCE ProfileSource', ' KAFFINITY Affinity']
+case 160: {
+if (PPP_CHECK_CB(on_NtCreateProfile_enter) || PPP_CHECK_CB(on_NtCreateProfile_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+uint32_t arg4 = get_32(env, 4);
+target_ulong arg5 = get_64(env, 5);
+uint32_t arg6 = get_32(env, 6);
+uint32_t arg7 = get_32(env, 7);
+target_ulong arg8 = get_64(env, 8);
+if (PPP_CHECK_CB(on_NtCreateProfile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(uint32_t));
+memcpy(rp.params[7], &arg7, sizeof(uint32_t));
+memcpy(rp.params[8], &arg8, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateProfile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
+}; break;
+// 161 NTSTATUS NtCreateProfileEx ['PHANDLE ProfileHandle', ' HANDLE Process', ' PVOID ProfileBase', ' SIZE_T ProfileSize', ' ULONG BucketSize', ' PULONG Buffer', ' ULONG BufferSize', ' KPROFILE_SOURCE ProfileSource', ' ULONG GroupAffinityCount', ' PGROUP_AFFINITY GroupAffinity']
+case 161: {
+if (PPP_CHECK_CB(on_NtCreateProfileEx_enter) || PPP_CHECK_CB(on_NtCreateProfileEx_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+uint32_t arg4 = get_32(env, 4);
+target_ulong arg5 = get_64(env, 5);
+uint32_t arg6 = get_32(env, 6);
+uint32_t arg7 = get_32(env, 7);
+uint32_t arg8 = get_32(env, 8);
+target_ulong arg9 = get_64(env, 9);
+if (PPP_CHECK_CB(on_NtCreateProfileEx_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(uint32_t));
+memcpy(rp.params[7], &arg7, sizeof(uint32_t));
+memcpy(rp.params[8], &arg8, sizeof(uint32_t));
+memcpy(rp.params[9], &arg9, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateProfileEx_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+}
+}; break;
+// 162 NTSTATUS NtCreateResourceManager ['PHANDLE ResourceManagerHandle', ' ACCESS_MASK DesiredAccess', ' HANDLE TmHandle', ' LPGUID RmGuid', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG CreateOptions', ' PUNICODE_STRING Description']
+case 162: {
+if (PPP_CHECK_CB(on_NtCreateResourceManager_enter) || PPP_CHECK_CB(on_NtCreateResourceManager_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+uint32_t arg5 = get_32(env, 5);
+target_ulong arg6 = get_64(env, 6);
+if (PPP_CHECK_CB(on_NtCreateResourceManager_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(uint32_t));
+memcpy(rp.params[6], &arg6, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateResourceManager_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+}
+}; break;
+// 163 NTSTATUS NtCreateSemaphore ['PHANDLE SemaphoreHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' LONG InitialCount', ' LONG MaximumCount']
+case 163: {
+if (PPP_CHECK_CB(on_NtCreateSemaphore_enter) || PPP_CHECK_CB(on_NtCreateSemaphore_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+int32_t arg3 = get_s32(env, 3);
+int32_t arg4 = get_s32(env, 4);
+if (PPP_CHECK_CB(on_NtCreateSemaphore_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(int32_t));
+memcpy(rp.params[4], &arg4, sizeof(int32_t));
+}
+PPP_RUN_CB(on_NtCreateSemaphore_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 164 NTSTATUS NtCreateSymbolicLinkObject ['PHANDLE LinkHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PUNICODE_STRING LinkTarget']
+case 164: {
+if (PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_enter) || PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateSymbolicLinkObject_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 165 NTSTATUS NtCreateThreadEx ['PHANDLE ThreadHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' HANDLE ProcessHandle', ' PVOID StartRoutine', ' PVOID Argument', ' ULONG CreateFlags', ' ULONG_PTR ZeroBits', ' SIZE_T StackSize', ' SIZE_T MaximumStackSize', ' PPS_ATTRIBUTE_LIST AttributeList']
+case 165: {
+if (PPP_CHECK_CB(on_NtCreateThreadEx_enter) || PPP_CHECK_CB(on_NtCreateThreadEx_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+uint32_t arg6 = get_32(env, 6);
+target_ulong arg7 = get_64(env, 7);
+target_ulong arg8 = get_64(env, 8);
+target_ulong arg9 = get_64(env, 9);
+target_ulong arg10 = get_64(env, 10);
+if (PPP_CHECK_CB(on_NtCreateThreadEx_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(uint32_t));
+memcpy(rp.params[7], &arg7, sizeof(target_ulong));
+memcpy(rp.params[8], &arg8, sizeof(target_ulong));
+memcpy(rp.params[9], &arg9, sizeof(target_ulong));
+memcpy(rp.params[10], &arg10, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateThreadEx_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+}
+}; break;
+// 166 NTSTATUS NtCreateTimer ['PHANDLE TimerHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' TIMER_TYPE TimerType']
+case 166: {
+if (PPP_CHECK_CB(on_NtCreateTimer_enter) || PPP_CHECK_CB(on_NtCreateTimer_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_NtCreateTimer_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCreateTimer_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 167 NTSTATUS NtCreateToken ['PHANDLE TokenHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' TOKEN_TYPE TokenType', ' PLUID AuthenticationId', ' PLARGE_INTEGER ExpirationTime', ' PTOKEN_USER User', ' PTOKEN_GROUPS Groups', ' PTOKEN_PRIVILEGES Privileges', ' PTOKEN_OWNER Owner', ' PTOKEN_PRIMARY_GROUP PrimaryGroup', ' PTOKEN_DEFAULT_DACL DefaultDacl', ' PTOKEN_SOURCE TokenSource']
+case 167: {
+if (PPP_CHECK_CB(on_NtCreateToken_enter) || PPP_CHECK_CB(on_NtCreateToken_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+target_ulong arg6 = get_64(env, 6);
+target_ulong arg7 = get_64(env, 7);
+target_ulong arg8 = get_64(env, 8);
+target_ulong arg9 = get_64(env, 9);
+target_ulong arg10 = get_64(env, 10);
+target_ulong arg11 = get_64(env, 11);
+target_ulong arg12 = get_64(env, 12);
+if (PPP_CHECK_CB(on_NtCreateToken_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(target_ulong));
+memcpy(rp.params[7], &arg7, sizeof(target_ulong));
+memcpy(rp.params[8], &arg8, sizeof(target_ulong));
+memcpy(rp.params[9], &arg9, sizeof(target_ulong));
+memcpy(rp.params[10], &arg10, sizeof(target_ulong));
+memcpy(rp.params[11], &arg11, sizeof(target_ulong));
+memcpy(rp.params[12], &arg12, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateToken_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12) ; 
+}
+}; break;
+// 168 NTSTATUS NtCreateTransaction ['PHANDLE TransactionHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' LPGUID Uow', ' HANDLE TmHandle', ' ULONG CreateOptions', ' ULONG IsolationLevel', ' ULONG IsolationFlags', ' PLARGE_INTEGER Timeout', ' PUNICODE_STRING Description']
+case 168: {
+if (PPP_CHECK_CB(on_NtCreateTransaction_enter) || PPP_CHECK_CB(on_NtCreateTransaction_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+uint32_t arg5 = get_32(env, 5);
+uint32_t arg6 = get_32(env, 6);
+uint32_t arg7 = get_32(env, 7);
+target_ulong arg8 = get_64(env, 8);
+target_ulong arg9 = get_64(env, 9);
+if (PPP_CHECK_CB(on_NtCreateTransaction_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(uint32_t));
+memcpy(rp.params[6], &arg6, sizeof(uint32_t));
+memcpy(rp.params[7], &arg7, sizeof(uint32_t));
+memcpy(rp.params[8], &arg8, sizeof(target_ulong));
+memcpy(rp.params[9], &arg9, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateTransaction_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+}
+}; break;
+// 169 NTSTATUS NtCreateTransactionManager ['PHANDLE TmHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PUNICODE_STRING LogFileName', ' ULONG CreateOptions', ' ULONG CommitStrength']
+case 169: {
+if (PPP_CHECK_CB(on_NtCreateTransactionManager_enter) || PPP_CHECK_CB(on_NtCreateTransactionManager_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+uint32_t arg4 = get_32(env, 4);
+uint32_t arg5 = get_32(env, 5);
+if (PPP_CHECK_CB(on_NtCreateTransactionManager_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCreateTransactionManager_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 170 NTSTATUS NtCreateUserProcess ['PHANDLE ProcessHandle', ' PHANDLE ThreadHandle', ' ACCESS_MASK ProcessDesiredAccess', ' ACCESS_MASK ThreadDesiredAccess', ' POBJECT_ATTRIBUTES ProcessObjectAttributes', ' POBJECT_ATTRIBUTES ThreadObjectAttributes', ' ULONG ProcessFlags', ' ULONG ThreadFlags', ' PRTL_USER_PROCESS_PARAMETERS ProcessParameters', ' PPROCESS_CREATE_INFO CreateInfo', ' PPROCESS_ATTRIBUTE_LIST AttributeList']
+case 170: {
+if (PPP_CHECK_CB(on_NtCreateUserProcess_enter) || PPP_CHECK_CB(on_NtCreateUserProcess_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+uint32_t arg6 = get_32(env, 6);
+uint32_t arg7 = get_32(env, 7);
+target_ulong arg8 = get_64(env, 8);
+target_ulong arg9 = get_64(env, 9);
+target_ulong arg10 = get_64(env, 10);
+if (PPP_CHECK_CB(on_NtCreateUserProcess_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(uint32_t));
+memcpy(rp.params[7], &arg7, sizeof(uint32_t));
+memcpy(rp.params[8], &arg8, sizeof(target_ulong));
+memcpy(rp.params[9], &arg9, sizeof(target_ulong));
+memcpy(rp.params[10], &arg10, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateUserProcess_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+}
+}; break;
+// 171 NTSTATUS NtCreateWaitablePort ['PHANDLE PortHandle', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG MaxConnectionInfoLength', ' ULONG MaxMessageLength', ' ULONG MaxPoolUsage']
+case 171: {
+if (PPP_CHECK_CB(on_NtCreateWaitablePort_enter) || PPP_CHECK_CB(on_NtCreateWaitablePort_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+uint32_t arg3 = get_32(env, 3);
+uint32_t arg4 = get_32(env, 4);
+if (PPP_CHECK_CB(on_NtCreateWaitablePort_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCreateWaitablePort_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 172 NTSTATUS NtCreateWorkerFactory ['PHANDLE WorkerFactoryHandleReturn', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' HANDLE CompletionPortHandle', ' HANDLE WorkerProcessHandle', ' PVOID StartRoutine', ' PVOID StartParameter', ' ULONG MaxThreadCount', ' SIZE_T StackReserve', ' SIZE_T StackCommit']
+case 172: {
+if (PPP_CHECK_CB(on_NtCreateWorkerFactory_enter) || PPP_CHECK_CB(on_NtCreateWorkerFactory_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+target_ulong arg6 = get_64(env, 6);
+uint32_t arg7 = get_32(env, 7);
+target_ulong arg8 = get_64(env, 8);
+target_ulong arg9 = get_64(env, 9);
+if (PPP_CHECK_CB(on_NtCreateWorkerFactory_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(target_ulong));
+memcpy(rp.params[7], &arg7, sizeof(uint32_t));
+memcpy(rp.params[8], &arg8, sizeof(target_ulong));
+memcpy(rp.params[9], &arg9, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateWorkerFactory_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+}
+}; break;
+// 173 NTSTATUS NtDebugActiveProcess ['HANDLE ProcessHandle', ' HANDLE DebugObjectHandle']
+case 173: {
+if (PPP_CHECK_CB(on_NtDebugActiveProcess_enter) || PPP_CHECK_CB(on_NtDebugActiveProcess_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtDebugActiveProcess_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtDebugActiveProcess_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 174 NTSTATUS NtDebugContinue ['HANDLE DebugObjectHandle', ' PCLIENT_ID ClientId', ' NTSTATUS ContinueStatus']
+case 174: {
+if (PPP_CHECK_CB(on_NtDebugContinue_enter) || PPP_CHECK_CB(on_NtDebugContinue_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+if (PPP_CHECK_CB(on_NtDebugContinue_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtDebugContinue_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 175 NTSTATUS NtDeleteAtom ['RTL_ATOM Atom']
+case 175: {
+if (PPP_CHECK_CB(on_NtDeleteAtom_enter) || PPP_CHECK_CB(on_NtDeleteAtom_return)) {
+uint32_t arg0 = get_32(env, 0);
+if (PPP_CHECK_CB(on_NtDeleteAtom_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtDeleteAtom_enter, env,pc,arg0) ; 
+}
+}; break;
+// 176 NTSTATUS NtDeleteBootEntry ['ULONG Id']
+case 176: {
+if (PPP_CHECK_CB(on_NtDeleteBootEntry_enter) || PPP_CHECK_CB(on_NtDeleteBootEntry_return)) {
+uint32_t arg0 = get_32(env, 0);
+if (PPP_CHECK_CB(on_NtDeleteBootEntry_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtDeleteBootEntry_enter, env,pc,arg0) ; 
+}
+}; break;
+// 177 NTSTATUS NtDeleteDriverEntry ['ULONG Id']
+case 177: {
+if (PPP_CHECK_CB(on_NtDeleteDriverEntry_enter) || PPP_CHECK_CB(on_NtDeleteDriverEntry_return)) {
+uint32_t arg0 = get_32(env, 0);
+if (PPP_CHECK_CB(on_NtDeleteDriverEntry_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtDeleteDriverEntry_enter, env,pc,arg0) ; 
+}
+}; break;
+// 178 NTSTATUS NtDeleteFile ['POBJECT_ATTRIBUTES ObjectAttributes']
+case 178: {
+if (PPP_CHECK_CB(on_NtDeleteFile_enter) || PPP_CHECK_CB(on_NtDeleteFile_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtDeleteFile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtDeleteFile_enter, env,pc,arg0) ; 
+}
+}; break;
+// 179 NTSTATUS NtDeleteKey ['HANDLE KeyHandle']
+case 179: {
+if (PPP_CHECK_CB(on_NtDeleteKey_enter) || PPP_CHECK_CB(on_NtDeleteKey_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtDeleteKey_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtDeleteKey_enter, env,pc,arg0) ; 
+}
+}; break;
+// 180 NTSTATUS NtDeleteObjectAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' BOOLEAN GenerateOnClose']
+case 180: {
+if (PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_enter) || PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+if (PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtDeleteObjectAuditAlarm_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 181 NTSTATUS NtDeletePrivateNamespace ['HANDLE NamespaceHandle']
+case 181: {
+if (PPP_CHECK_CB(on_NtDeletePrivateNamespace_enter) || PPP_CHECK_CB(on_NtDeletePrivateNamespace_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtDeletePrivateNamespace_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtDeletePrivateNamespace_enter, env,pc,arg0) ; 
+}
+}; break;
+// 182 NTSTATUS NtDeleteValueKey ['HANDLE KeyHandle', ' PUNICODE_STRING ValueName']
+case 182: {
+if (PPP_CHECK_CB(on_NtDeleteValueKey_enter) || PPP_CHECK_CB(on_NtDeleteValueKey_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtDeleteValueKey_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtDeleteValueKey_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 183 NTSTATUS NtDisableLastKnownGood ['']
+case 183: {
+if (PPP_CHECK_CB(on_NtDisableLastKnownGood_return)) {
+}
+PPP_RUN_CB(on_NtDisableLastKnownGood_enter, env,pc) ; 
+}; break;
+// 184 NTSTATUS NtDisplayString ['PUNICODE_STRING String']
+case 184: {
+if (PPP_CHECK_CB(on_NtDisplayString_enter) || PPP_CHECK_CB(on_NtDisplayString_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtDisplayString_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtDisplayString_enter, env,pc,arg0) ; 
+}
+}; break;
+// 185 NTSTATUS NtDrawText ['PUNICODE_STRING Text']
+case 185: {
+if (PPP_CHECK_CB(on_NtDrawText_enter) || PPP_CHECK_CB(on_NtDrawText_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtDrawText_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtDrawText_enter, env,pc,arg0) ; 
+}
+}; break;
+// 186 NTSTATUS NtEnableLastKnownGood ['']
+case 186: {
+if (PPP_CHECK_CB(on_NtEnableLastKnownGood_return)) {
+}
+PPP_RUN_CB(on_NtEnableLastKnownGood_enter, env,pc) ; 
+}; break;
+// 187 NTSTATUS NtEnumerateBootEntries ['PVOID Buffer', ' PULONG BufferLength']
+case 187: {
+if (PPP_CHECK_CB(on_NtEnumerateBootEntries_enter) || PPP_CHECK_CB(on_NtEnumerateBootEntries_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtEnumerateBootEntries_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtEnumerateBootEntries_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 188 NTSTATUS NtEnumerateDriverEntries ['PVOID Buffer', ' PULONG BufferLength']
+case 188: {
+if (PPP_CHECK_CB(on_NtEnumerateDriverEntries_enter) || PPP_CHECK_CB(on_NtEnumerateDriverEntries_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtEnumerateDriverEntries_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtEnumerateDriverEntries_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 189 NTSTATUS NtEnumerateSystemEnvironmentValuesEx ['ULONG InformationClass', ' PVOID Buffer', ' PULONG BufferLength']
+case 189: {
+if (PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_enter) || PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtEnumerateSystemEnvironmentValuesEx_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 190 NTSTATUS NtEnumerateTransactionObject ['HANDLE RootObjectHandle', ' KTMOBJECT_TYPE QueryType', ' PKTMOBJECT_CURSOR ObjectCursor', ' ULONG ObjectCursorLength', ' PULONG ReturnLength']
+case 190: {
+if (PPP_CHECK_CB(on_NtEnumerateTransactionObject_enter) || PPP_CHECK_CB(on_NtEnumerateTransactionObject_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtEnumerateTransactionObject_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtEnumerateTransactionObject_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 191 NTSTATUS NtExtendSection ['HANDLE SectionHandle', ' PLARGE_INTEGER NewSectionSize']
+case 191: {
+if (PPP_CHECK_CB(on_NtExtendSection_enter) || PPP_CHECK_CB(on_NtExtendSection_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtExtendSection_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtExtendSection_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 192 NTSTATUS NtFilterToken ['HANDLE ExistingTokenHandle', ' ULONG Flags', ' PTOKEN_GROUPS SidsToDisable', ' PTOKEN_PRIVILEGES PrivilegesToDelete', ' PTOKEN_GROUPS RestrictedSids', ' PHANDLE NewTokenHandle']
+case 192: {
+if (PPP_CHECK_CB(on_NtFilterToken_enter) || PPP_CHECK_CB(on_NtFilterToken_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_NtFilterToken_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtFilterToken_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 193 NTSTATUS NtFlushInstallUILanguage ['LANGID InstallUILanguage', ' ULONG SetComittedFlag']
+case 193: {
+if (PPP_CHECK_CB(on_NtFlushInstallUILanguage_enter) || PPP_CHECK_CB(on_NtFlushInstallUILanguage_return)) {
+uint32_t arg0 = get_32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+if (PPP_CHECK_CB(on_NtFlushInstallUILanguage_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtFlushInstallUILanguage_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 194 NTSTATUS NtFlushInstructionCache ['HANDLE ProcessHandle', ' PVOID BaseAddress', ' SIZE_T Length']
+case 194: {
+if (PPP_CHECK_CB(on_NtFlushInstructionCache_enter) || PPP_CHECK_CB(on_NtFlushInstructionCache_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtFlushInstructionCache_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtFlushInstructionCache_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 195 NTSTATUS NtFlushKey ['HANDLE KeyHandle']
+case 195: {
+if (PPP_CHECK_CB(on_NtFlushKey_enter) || PPP_CHECK_CB(on_NtFlushKey_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtFlushKey_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtFlushKey_enter, env,pc,arg0) ; 
+}
+}; break;
+// 196 VOID NtFlushProcessWriteBuffers ['']
+case 196: {
+if (PPP_CHECK_CB(on_NtFlushProcessWriteBuffers_return)) {
+}
+PPP_RUN_CB(on_NtFlushProcessWriteBuffers_enter, env,pc) ; 
+}; break;
+// 197 NTSTATUS NtFlushVirtualMemory ['HANDLE ProcessHandle', ' PVOID *BaseAddress', ' PSIZE_T RegionSize', ' PIO_STATUS_BLOCK IoStatus']
+case 197: {
+if (PPP_CHECK_CB(on_NtFlushVirtualMemory_enter) || PPP_CHECK_CB(on_NtFlushVirtualMemory_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_NtFlushVirtualMemory_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtFlushVirtualMemory_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 198 NTSTATUS NtFlushWriteBuffer ['']
+case 198: {
+if (PPP_CHECK_CB(on_NtFlushWriteBuffer_return)) {
+}
+PPP_RUN_CB(on_NtFlushWriteBuffer_enter, env,pc) ; 
+}; break;
+// 199 NTSTATUS NtFreeUserPhysicalPages ['HANDLE ProcessHandle', ' PULONG_PTR NumberOfPages', ' PULONG_PTR UserPfnArray']
+case 199: {
+if (PPP_CHECK_CB(on_NtFreeUserPhysicalPages_enter) || PPP_CHECK_CB(on_NtFreeUserPhysicalPages_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtFreeUserPhysicalPages_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtFreeUserPhysicalPages_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 200 NTSTATUS NtFreezeRegistry ['ULONG TimeOutInSeconds']
+case 200: {
+if (PPP_CHECK_CB(on_NtFreezeRegistry_enter) || PPP_CHECK_CB(on_NtFreezeRegistry_return)) {
+uint32_t arg0 = get_32(env, 0);
+if (PPP_CHECK_CB(on_NtFreezeRegistry_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtFreezeRegistry_enter, env,pc,arg0) ; 
+}
+}; break;
+// 201 NTSTATUS NtFreezeTransactions ['PLARGE_INTEGER FreezeTimeout', ' PLARGE_INTEGER ThawTimeout']
+case 201: {
+if (PPP_CHECK_CB(on_NtFreezeTransactions_enter) || PPP_CHECK_CB(on_NtFreezeTransactions_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtFreezeTransactions_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtFreezeTransactions_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 202 NTSTATUS NtGetContextThread ['HANDLE ThreadHandle', ' PCONTEXT ThreadContext']
+case 202: {
+if (PPP_CHECK_CB(on_NtGetContextThread_enter) || PPP_CHECK_CB(on_NtGetContextThread_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtGetContextThread_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtGetContextThread_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 203 ULONG NtGetCurrentProcessorNumber ['']
+case 203: {
+if (PPP_CHECK_CB(on_NtGetCurrentProcessorNumber_return)) {
+}
+PPP_RUN_CB(on_NtGetCurrentProcessorNumber_enter, env,pc) ; 
+}; break;
+// 204 NTSTATUS NtGetDevicePowerState ['HANDLE Device', ' DEVICE_POWER_STATE *State']
+case 204: {
+if (PPP_CHECK_CB(on_NtGetDevicePowerState_enter) || PPP_CHECK_CB(on_NtGetDevicePowerState_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtGetDevicePowerState_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtGetDevicePowerState_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 205 NTSTATUS NtGetMUIRegistryInfo ['ULONG Flags', ' PULONG DataSize', ' PVOID Data']
+case 205: {
+if (PPP_CHECK_CB(on_NtGetMUIRegistryInfo_enter) || PPP_CHECK_CB(on_NtGetMUIRegistryInfo_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtGetMUIRegistryInfo_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtGetMUIRegistryInfo_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 206 NTSTATUS NtGetNextProcess ['HANDLE ProcessHandle', ' ACCESS_MASK DesiredAccess', ' ULONG HandleAttributes', ' ULONG Flags', ' PHANDLE NewProcessHandle']
+case 206: {
+if (PPP_CHECK_CB(on_NtGetNextProcess_enter) || PPP_CHECK_CB(on_NtGetNextProcess_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+uint32_t arg2 = get_32(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtGetNextProcess_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtGetNextProcess_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 207 NTSTATUS NtGetNextThread ['HANDLE ProcessHandle', ' HANDLE ThreadHandle', ' ACCESS_MASK DesiredAccess', ' ULONG HandleAttributes', ' ULONG Flags', ' PHANDLE NewThreadHandle']
+case 207: {
+if (PPP_CHECK_CB(on_NtGetNextThread_enter) || PPP_CHECK_CB(on_NtGetNextThread_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+uint32_t arg3 = get_32(env, 3);
+uint32_t arg4 = get_32(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_NtGetNextThread_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtGetNextThread_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 208 NTSTATUS NtGetNlsSectionPtr ['ULONG SectionType', ' ULONG SectionData', ' PVOID ContextData', ' PVOID *SectionPointer', ' PULONG SectionSize']
+case 208: {
+if (PPP_CHECK_CB(on_NtGetNlsSectionPtr_enter) || PPP_CHECK_CB(on_NtGetNlsSectionPtr_return)) {
+uint32_t arg0 = get_32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtGetNlsSectionPtr_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtGetNlsSectionPtr_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 209 NTSTATUS NtGetNotificationResourceManager ['HANDLE ResourceManagerHandle', ' PTRANSACTION_NOTIFICATION TransactionNotification', ' ULONG NotificationLength', ' PLARGE_INTEGER Timeout', ' PULONG ReturnLength', ' ULONG Asynchronous', ' ULONG_PTR AsynchronousContext']
+case 209: {
+if (PPP_CHECK_CB(on_NtGetNotificationResourceManager_enter) || PPP_CHECK_CB(on_NtGetNotificationResourceManager_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+uint32_t arg5 = get_32(env, 5);
+target_ulong arg6 = get_64(env, 6);
+if (PPP_CHECK_CB(on_NtGetNotificationResourceManager_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(uint32_t));
+memcpy(rp.params[6], &arg6, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtGetNotificationResourceManager_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+}
+}; break;
+// 210 NTSTATUS NtGetPlugPlayEvent ['HANDLE EventHandle', ' PVOID Context', ' PPLUGPLAY_EVENT_BLOCK EventBlock', ' ULONG EventBufferSize']
+case 210: {
+if (PPP_CHECK_CB(on_NtGetPlugPlayEvent_enter) || PPP_CHECK_CB(on_NtGetPlugPlayEvent_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_NtGetPlugPlayEvent_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtGetPlugPlayEvent_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 211 NTSTATUS NtGetWriteWatch ['HANDLE ProcessHandle', ' ULONG Flags', ' PVOID BaseAddress', ' SIZE_T RegionSize', ' PVOID *UserAddressArray', ' PULONG_PTR EntriesInUserAddressArray', ' PULONG Granularity']
+case 211: {
+if (PPP_CHECK_CB(on_NtGetWriteWatch_enter) || PPP_CHECK_CB(on_NtGetWriteWatch_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+target_ulong arg6 = get_64(env, 6);
+if (PPP_CHECK_CB(on_NtGetWriteWatch_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtGetWriteWatch_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+}
+}; break;
+// 212 NTSTATUS NtImpersonateAnonymousToken ['HANDLE ThreadHandle']
+case 212: {
+if (PPP_CHECK_CB(on_NtImpersonateAnonymousToken_enter) || PPP_CHECK_CB(on_NtImpersonateAnonymousToken_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtImpersonateAnonymousToken_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtImpersonateAnonymousToken_enter, env,pc,arg0) ; 
+}
+}; break;
+// 213 NTSTATUS NtImpersonateThread ['HANDLE ServerThreadHandle', ' HANDLE ClientThreadHandle', ' PSECURITY_QUALITY_OF_SERVICE SecurityQos']
+case 213: {
+if (PPP_CHECK_CB(on_NtImpersonateThread_enter) || PPP_CHECK_CB(on_NtImpersonateThread_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtImpersonateThread_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtImpersonateThread_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 214 NTSTATUS NtInitializeNlsFiles ['PVOID *BaseAddress', ' PLCID DefaultLocaleId', ' PLARGE_INTEGER DefaultCasingTableSize']
+case 214: {
+if (PPP_CHECK_CB(on_NtInitializeNlsFiles_enter) || PPP_CHECK_CB(on_NtInitializeNlsFiles_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtInitializeNlsFiles_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtInitializeNlsFiles_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 215 NTSTATUS NtInitializeRegistry ['USHORT BootCondition']
+case 215: {
+if (PPP_CHECK_CB(on_NtInitializeRegistry_enter) || PPP_CHECK_CB(on_NtInitializeRegistry_return)) {
+uint32_t arg0 = get_32(env, 0);
+if (PPP_CHECK_CB(on_NtInitializeRegistry_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtInitializeRegistry_enter, env,pc,arg0) ; 
+}
+}; break;
+// 216 NTSTATUS NtInitiatePowerAction ['POWER_ACTION SystemAction', ' SYSTEM_POWER_STATE MinSystemState', ' ULONG Flags', ' BOOLEAN Asynchronous']
+case 216: {
+if (PPP_CHECK_CB(on_NtInitiatePowerAction_enter) || PPP_CHECK_CB(on_NtInitiatePowerAction_return)) {
+uint32_t arg0 = get_32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+uint32_t arg2 = get_32(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_NtInitiatePowerAction_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtInitiatePowerAction_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 217 BOOLEAN NtIsSystemResumeAutomatic ['']
+case 217: {
+if (PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_return)) {
+}
+PPP_RUN_CB(on_NtIsSystemResumeAutomatic_enter, env,pc) ; 
+}; break;
+// 218 NTSTATUS NtIsUILanguageComitted ['']
+case 218: {
+if (PPP_CHECK_CB(on_NtIsUILanguageComitted_return)) {
+}
+PPP_RUN_CB(on_NtIsUILanguageComitted_enter, env,pc) ; 
+}; break;
+// 219 NTSTATUS NtListenPort ['HANDLE PortHandle', ' PPORT_MESSAGE ConnectionRequest']
+case 219: {
+if (PPP_CHECK_CB(on_NtListenPort_enter) || PPP_CHECK_CB(on_NtListenPort_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtListenPort_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtListenPort_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 220 NTSTATUS NtLoadDriver ['PUNICODE_STRING DriverServiceName']
+case 220: {
+if (PPP_CHECK_CB(on_NtLoadDriver_enter) || PPP_CHECK_CB(on_NtLoadDriver_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtLoadDriver_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtLoadDriver_enter, env,pc,arg0) ; 
+}
+}; break;
+// 221 NTSTATUS NtLoadKey ['POBJECT_ATTRIBUTES TargetKey', ' POBJECT_ATTRIBUTES SourceFile']
+case 221: {
+if (PPP_CHECK_CB(on_NtLoadKey_enter) || PPP_CHECK_CB(on_NtLoadKey_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtLoadKey_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtLoadKey_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 222 NTSTATUS NtLoadKey2 ['POBJECT_ATTRIBUTES TargetKey', ' POBJECT_ATTRIBUTES SourceFile', ' ULONG Flags']
+case 222: {
+if (PPP_CHECK_CB(on_NtLoadKey2_enter) || PPP_CHECK_CB(on_NtLoadKey2_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+if (PPP_CHECK_CB(on_NtLoadKey2_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtLoadKey2_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 223 NTSTATUS NtLoadKeyEx ['POBJECT_ATTRIBUTES TargetKey', ' POBJECT_ATTRIBUTES SourceFile', ' ULONG Flags', ' HANDLE TrustClassKey ']
+case 223: {
+if (PPP_CHECK_CB(on_NtLoadKeyEx_enter) || PPP_CHECK_CB(on_NtLoadKeyEx_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_NtLoadKeyEx_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtLoadKeyEx_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 224 NTSTATUS NtLockFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PLARGE_INTEGER ByteOffset', ' PLARGE_INTEGER Length', ' ULONG Key', ' BOOLEAN FailImmediately', ' BOOLEAN ExclusiveLock']
+case 224: {
+if (PPP_CHECK_CB(on_NtLockFile_enter) || PPP_CHECK_CB(on_NtLockFile_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+target_ulong arg6 = get_64(env, 6);
+uint32_t arg7 = get_32(env, 7);
+uint32_t arg8 = get_32(env, 8);
+uint32_t arg9 = get_32(env, 9);
+if (PPP_CHECK_CB(on_NtLockFile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(target_ulong));
+memcpy(rp.params[7], &arg7, sizeof(uint32_t));
+memcpy(rp.params[8], &arg8, sizeof(uint32_t));
+memcpy(rp.params[9], &arg9, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtLockFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+}
+}; break;
+// 225 NTSTATUS NtLockProductActivationKeys ['ULONG *pPrivateVer', ' ULONG *pSafeMode']
+case 225: {
+if (PPP_CHECK_CB(on_NtLockProductActivationKeys_enter) || PPP_CHECK_CB(on_NtLockProductActivationKeys_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtLockProductActivationKeys_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtLockProductActivationKeys_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 226 NTSTATUS NtLockRegistryKey ['HANDLE KeyHandle']
+case 226: {
+if (PPP_CHECK_CB(on_NtLockRegistryKey_enter) || PPP_CHECK_CB(on_NtLockRegistryKey_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtLockRegistryKey_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtLockRegistryKey_enter, env,pc,arg0) ; 
+}
+}; break;
+// 227 NTSTATUS NtLockVirtualMemory ['HANDLE ProcessHandle', ' PVOID *BaseAddress', ' PSIZE_T RegionSize', ' ULONG MapType']
+case 227: {
+if (PPP_CHECK_CB(on_NtLockVirtualMemory_enter) || PPP_CHECK_CB(on_NtLockVirtualMemory_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_NtLockVirtualMemory_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtLockVirtualMemory_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 228 NTSTATUS NtMakePermanentObject ['HANDLE Handle']
+case 228: {
+if (PPP_CHECK_CB(on_NtMakePermanentObject_enter) || PPP_CHECK_CB(on_NtMakePermanentObject_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtMakePermanentObject_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtMakePermanentObject_enter, env,pc,arg0) ; 
+}
+}; break;
+// 229 NTSTATUS NtMakeTemporaryObject ['HANDLE Handle']
+case 229: {
+if (PPP_CHECK_CB(on_NtMakeTemporaryObject_enter) || PPP_CHECK_CB(on_NtMakeTemporaryObject_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtMakeTemporaryObject_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtMakeTemporaryObject_enter, env,pc,arg0) ; 
+}
+}; break;
+// 230 NTSTATUS NtMapCMFModule ['ULONG What', ' ULONG Index', ' PULONG CacheIndexOut', ' PULONG CacheFlagsOut', ' PULONG ViewSizeOut', ' PVOID *BaseAddress']
+case 230: {
+if (PPP_CHECK_CB(on_NtMapCMFModule_enter) || PPP_CHECK_CB(on_NtMapCMFModule_return)) {
+uint32_t arg0 = get_32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_NtMapCMFModule_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtMapCMFModule_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 231 NTSTATUS NtMapUserPhysicalPages ['PVOID VirtualAddress', ' ULONG_PTR NumberOfPages', ' PULONG_PTR UserPfnArray']
+case 231: {
+if (PPP_CHECK_CB(on_NtMapUserPhysicalPages_enter) || PPP_CHECK_CB(on_NtMapUserPhysicalPages_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtMapUserPhysicalPages_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtMapUserPhysicalPages_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 232 NTSTATUS NtModifyBootEntry ['PBOOT_ENTRY BootEntry']
+case 232: {
+if (PPP_CHECK_CB(on_NtModifyBootEntry_enter) || PPP_CHECK_CB(on_NtModifyBootEntry_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtModifyBootEntry_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtModifyBootEntry_enter, env,pc,arg0) ; 
+}
+}; break;
+// 233 NTSTATUS NtModifyDriverEntry ['PEFI_DRIVER_ENTRY DriverEntry']
+case 233: {
+if (PPP_CHECK_CB(on_NtModifyDriverEntry_enter) || PPP_CHECK_CB(on_NtModifyDriverEntry_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtModifyDriverEntry_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtModifyDriverEntry_enter, env,pc,arg0) ; 
+}
+}; break;
+// 234 NTSTATUS NtNotifyChangeDirectoryFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length', ' ULONG CompletionFilter', ' BOOLEAN WatchTree']
+case 234: {
+if (PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_enter) || PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+uint32_t arg6 = get_32(env, 6);
+uint32_t arg7 = get_32(env, 7);
+uint32_t arg8 = get_32(env, 8);
+if (PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(uint32_t));
+memcpy(rp.params[7], &arg7, sizeof(uint32_t));
+memcpy(rp.params[8], &arg8, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtNotifyChangeDirectoryFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
+}; break;
+// 235 NTSTATUS NtNotifyChangeKey ['HANDLE KeyHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG CompletionFilter', ' BOOLEAN WatchTree', ' PVOID Buffer', ' ULONG BufferSize', ' BOOLEAN Asynchronous']
+case 235: {
+if (PPP_CHECK_CB(on_NtNotifyChangeKey_enter) || PPP_CHECK_CB(on_NtNotifyChangeKey_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+uint32_t arg5 = get_32(env, 5);
+uint32_t arg6 = get_32(env, 6);
+target_ulong arg7 = get_64(env, 7);
+uint32_t arg8 = get_32(env, 8);
+uint32_t arg9 = get_32(env, 9);
+if (PPP_CHECK_CB(on_NtNotifyChangeKey_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(uint32_t));
+memcpy(rp.params[6], &arg6, sizeof(uint32_t));
+memcpy(rp.params[7], &arg7, sizeof(target_ulong));
+memcpy(rp.params[8], &arg8, sizeof(uint32_t));
+memcpy(rp.params[9], &arg9, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtNotifyChangeKey_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+}
+}; break;
+// 236 NTSTATUS NtNotifyChangeMultipleKeys ['HANDLE MasterKeyHandle', ' ULONG Count', ' OBJECT_ATTRIBUTES SlaveObjects[]', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG CompletionFilter', ' BOOLEAN WatchTree', ' PVOID Buffer', ' ULONG BufferSize', ' BOOLEAN Asynchronous']
+case 236: {
+if (PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_enter) || PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+target_ulong arg6 = get_64(env, 6);
+uint32_t arg7 = get_32(env, 7);
+uint32_t arg8 = get_32(env, 8);
+target_ulong arg9 = get_64(env, 9);
+uint32_t arg10 = get_32(env, 10);
+uint32_t arg11 = get_32(env, 11);
+if (PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(target_ulong));
+memcpy(rp.params[7], &arg7, sizeof(uint32_t));
+memcpy(rp.params[8], &arg8, sizeof(uint32_t));
+memcpy(rp.params[9], &arg9, sizeof(target_ulong));
+memcpy(rp.params[10], &arg10, sizeof(uint32_t));
+memcpy(rp.params[11], &arg11, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtNotifyChangeMultipleKeys_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11) ; 
+}
+}; break;
+// 237 NTSTATUS NtNotifyChangeSession ['HANDLE Session', ' ULONG IoStateSequence', ' PVOID Reserved', ' ULONG Action', ' IO_SESSION_STATE IoState', ' IO_SESSION_STATE IoState2', ' PVOID Buffer', ' ULONG BufferSize']
+case 237: {
+if (PPP_CHECK_CB(on_NtNotifyChangeSession_enter) || PPP_CHECK_CB(on_NtNotifyChangeSession_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+uint32_t arg4 = get_32(env, 4);
+uint32_t arg5 = get_32(env, 5);
+target_ulong arg6 = get_64(env, 6);
+uint32_t arg7 = get_32(env, 7);
+if (PPP_CHECK_CB(on_NtNotifyChangeSession_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(uint32_t));
+memcpy(rp.params[6], &arg6, sizeof(target_ulong));
+memcpy(rp.params[7], &arg7, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtNotifyChangeSession_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}
+}; break;
+// 238 NTSTATUS NtOpenEnlistment ['PHANDLE EnlistmentHandle', ' ACCESS_MASK DesiredAccess', ' HANDLE ResourceManagerHandle', ' LPGUID EnlistmentGuid', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 238: {
+if (PPP_CHECK_CB(on_NtOpenEnlistment_enter) || PPP_CHECK_CB(on_NtOpenEnlistment_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtOpenEnlistment_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenEnlistment_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 239 NTSTATUS NtOpenEventPair ['PHANDLE EventPairHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 239: {
+if (PPP_CHECK_CB(on_NtOpenEventPair_enter) || PPP_CHECK_CB(on_NtOpenEventPair_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtOpenEventPair_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenEventPair_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 240 NTSTATUS NtOpenIoCompletion ['PHANDLE IoCompletionHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 240: {
+if (PPP_CHECK_CB(on_NtOpenIoCompletion_enter) || PPP_CHECK_CB(on_NtOpenIoCompletion_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtOpenIoCompletion_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenIoCompletion_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 241 NTSTATUS NtOpenJobObject ['PHANDLE JobHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 241: {
+if (PPP_CHECK_CB(on_NtOpenJobObject_enter) || PPP_CHECK_CB(on_NtOpenJobObject_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtOpenJobObject_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenJobObject_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 242 NTSTATUS NtOpenKeyEx ['PHANDLE KeyHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG OpenOptions']
+case 242: {
+if (PPP_CHECK_CB(on_NtOpenKeyEx_enter) || PPP_CHECK_CB(on_NtOpenKeyEx_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_NtOpenKeyEx_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtOpenKeyEx_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 243 NTSTATUS NtOpenKeyTransacted ['PHANDLE KeyHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' HANDLE TransactionHandle']
+case 243: {
+if (PPP_CHECK_CB(on_NtOpenKeyTransacted_enter) || PPP_CHECK_CB(on_NtOpenKeyTransacted_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_NtOpenKeyTransacted_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenKeyTransacted_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 244 NTSTATUS NtOpenKeyTransactedEx ['PHANDLE KeyHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG OpenOptions', ' HANDLE TransactionHandle']
+case 244: {
+if (PPP_CHECK_CB(on_NtOpenKeyTransactedEx_enter) || PPP_CHECK_CB(on_NtOpenKeyTransactedEx_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtOpenKeyTransactedEx_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenKeyTransactedEx_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 245 NTSTATUS NtOpenKeyedEvent ['PHANDLE KeyedEventHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 245: {
+if (PPP_CHECK_CB(on_NtOpenKeyedEvent_enter) || PPP_CHECK_CB(on_NtOpenKeyedEvent_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtOpenKeyedEvent_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenKeyedEvent_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 246 NTSTATUS NtOpenMutant ['PHANDLE MutantHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 246: {
+if (PPP_CHECK_CB(on_NtOpenMutant_enter) || PPP_CHECK_CB(on_NtOpenMutant_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtOpenMutant_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenMutant_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 247 NTSTATUS NtOpenObjectAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' PUNICODE_STRING ObjectTypeName', ' PUNICODE_STRING ObjectName', ' PSECURITY_DESCRIPTOR SecurityDescriptor', ' HANDLE ClientToken', ' ACCESS_MASK DesiredAccess', ' ACCESS_MASK GrantedAccess', ' PPRIVILEGE_SET Privileges', ' BOOLEAN ObjectCreation', ' BOOLEAN AccessGranted', ' PBOOLEAN GenerateOnClose']
+case 247: {
+if (PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_enter) || PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+uint32_t arg6 = get_32(env, 6);
+uint32_t arg7 = get_32(env, 7);
+target_ulong arg8 = get_64(env, 8);
+uint32_t arg9 = get_32(env, 9);
+uint32_t arg10 = get_32(env, 10);
+target_ulong arg11 = get_64(env, 11);
+if (PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(uint32_t));
+memcpy(rp.params[7], &arg7, sizeof(uint32_t));
+memcpy(rp.params[8], &arg8, sizeof(target_ulong));
+memcpy(rp.params[9], &arg9, sizeof(uint32_t));
+memcpy(rp.params[10], &arg10, sizeof(uint32_t));
+memcpy(rp.params[11], &arg11, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenObjectAuditAlarm_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11) ; 
+}
+}; break;
+// 248 NTSTATUS NtOpenPrivateNamespace ['PHANDLE NamespaceHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PVOID BoundaryDescriptor']
+case 248: {
+if (PPP_CHECK_CB(on_NtOpenPrivateNamespace_enter) || PPP_CHECK_CB(on_NtOpenPrivateNamespace_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_NtOpenPrivateNamespace_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenPrivateNamespace_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 249 NTSTATUS NtOpenProcessToken ['HANDLE ProcessHandle', ' ACCESS_MASK DesiredAccess', ' PHANDLE TokenHandle']
+case 249: {
+if (PPP_CHECK_CB(on_NtOpenProcessToken_enter) || PPP_CHECK_CB(on_NtOpenProcessToken_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtOpenProcessToken_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenProcessToken_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 250 NTSTATUS NtOpenResourceManager ['PHANDLE ResourceManagerHandle', ' ACCESS_MASK DesiredAccess', ' HANDLE TmHandle', ' LPGUID ResourceManagerGuid', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 250: {
+if (PPP_CHECK_CB(on_NtOpenResourceManager_enter) || PPP_CHECK_CB(on_NtOpenResourceManager_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtOpenResourceManager_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenResourceManager_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 251 NTSTATUS NtOpenSemaphore ['PHANDLE SemaphoreHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 251: {
+if (PPP_CHECK_CB(on_NtOpenSemaphore_enter) || PPP_CHECK_CB(on_NtOpenSemaphore_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtOpenSemaphore_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenSemaphore_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 252 NTSTATUS NtOpenSession ['PHANDLE SessionHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 252: {
+if (PPP_CHECK_CB(on_NtOpenSession_enter) || PPP_CHECK_CB(on_NtOpenSession_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtOpenSession_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenSession_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 253 NTSTATUS NtOpenSymbolicLinkObject ['PHANDLE LinkHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 253: {
+if (PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_enter) || PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenSymbolicLinkObject_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 254 NTSTATUS NtOpenThread ['PHANDLE ThreadHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PCLIENT_ID ClientId']
+case 254: {
+if (PPP_CHECK_CB(on_NtOpenThread_enter) || PPP_CHECK_CB(on_NtOpenThread_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_NtOpenThread_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenThread_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 255 NTSTATUS NtOpenTimer ['PHANDLE TimerHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 255: {
+if (PPP_CHECK_CB(on_NtOpenTimer_enter) || PPP_CHECK_CB(on_NtOpenTimer_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtOpenTimer_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenTimer_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 256 NTSTATUS NtOpenTransaction ['PHANDLE TransactionHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' LPGUID Uow', ' HANDLE TmHandle']
+case 256: {
+if (PPP_CHECK_CB(on_NtOpenTransaction_enter) || PPP_CHECK_CB(on_NtOpenTransaction_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtOpenTransaction_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenTransaction_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 257 NTSTATUS NtOpenTransactionManager ['PHANDLE TmHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PUNICODE_STRING LogFileName', ' LPGUID TmIdentity', ' ULONG OpenOptions']
+case 257: {
+if (PPP_CHECK_CB(on_NtOpenTransactionManager_enter) || PPP_CHECK_CB(on_NtOpenTransactionManager_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+uint32_t arg5 = get_32(env, 5);
+if (PPP_CHECK_CB(on_NtOpenTransactionManager_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtOpenTransactionManager_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 258 NTSTATUS NtPlugPlayControl ['PLUGPLAY_CONTROL_CLASS PnPControlClass', ' PVOID PnPControlData', ' ULONG PnPControlDataLength']
+case 258: {
+if (PPP_CHECK_CB(on_NtPlugPlayControl_enter) || PPP_CHECK_CB(on_NtPlugPlayControl_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+if (PPP_CHECK_CB(on_NtPlugPlayControl_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtPlugPlayControl_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 259 NTSTATUS NtPrePrepareComplete ['HANDLE EnlistmentHandle', ' PLARGE_INTEGER TmVirtualClock']
+case 259: {
+if (PPP_CHECK_CB(on_NtPrePrepareComplete_enter) || PPP_CHECK_CB(on_NtPrePrepareComplete_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtPrePrepareComplete_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtPrePrepareComplete_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 260 NTSTATUS NtPrePrepareEnlistment ['HANDLE EnlistmentHandle', ' PLARGE_INTEGER TmVirtualClock']
+case 260: {
+if (PPP_CHECK_CB(on_NtPrePrepareEnlistment_enter) || PPP_CHECK_CB(on_NtPrePrepareEnlistment_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtPrePrepareEnlistment_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtPrePrepareEnlistment_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 261 NTSTATUS NtPrepareComplete ['HANDLE EnlistmentHandle', ' PLARGE_INTEGER TmVirtualClock']
+case 261: {
+if (PPP_CHECK_CB(on_NtPrepareComplete_enter) || PPP_CHECK_CB(on_NtPrepareComplete_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtPrepareComplete_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtPrepareComplete_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 262 NTSTATUS NtPrepareEnlistment ['HANDLE EnlistmentHandle', ' PLARGE_INTEGER TmVirtualClock']
+case 262: {
+if (PPP_CHECK_CB(on_NtPrepareEnlistment_enter) || PPP_CHECK_CB(on_NtPrepareEnlistment_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtPrepareEnlistment_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtPrepareEnlistment_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 263 NTSTATUS NtPrivilegeCheck ['HANDLE ClientToken', ' PPRIVILEGE_SET RequiredPrivileges', ' PBOOLEAN Result']
+case 263: {
+if (PPP_CHECK_CB(on_NtPrivilegeCheck_enter) || PPP_CHECK_CB(on_NtPrivilegeCheck_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtPrivilegeCheck_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtPrivilegeCheck_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 264 NTSTATUS NtPrivilegeObjectAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' HANDLE ClientToken', ' ACCESS_MASK DesiredAccess', ' PPRIVILEGE_SET Privileges', ' BOOLEAN AccessGranted']
+case 264: {
+if (PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_enter) || PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+uint32_t arg5 = get_32(env, 5);
+if (PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtPrivilegeObjectAuditAlarm_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 265 NTSTATUS NtPrivilegedServiceAuditAlarm ['PUNICODE_STRING SubsystemName', ' PUNICODE_STRING ServiceName', ' HANDLE ClientToken', ' PPRIVILEGE_SET Privileges', ' BOOLEAN AccessGranted']
+case 265: {
+if (PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_enter) || PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+uint32_t arg4 = get_32(env, 4);
+if (PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtPrivilegedServiceAuditAlarm_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 266 NTSTATUS NtPropagationComplete ['HANDLE ResourceManagerHandle', ' ULONG RequestCookie', ' ULONG BufferLength', ' PVOID Buffer']
+case 266: {
+if (PPP_CHECK_CB(on_NtPropagationComplete_enter) || PPP_CHECK_CB(on_NtPropagationComplete_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_NtPropagationComplete_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtPropagationComplete_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 267 NTSTATUS NtPropagationFailed ['HANDLE ResourceManagerHandle', ' ULONG RequestCookie', ' NTSTATUS PropStatus']
+case 267: {
+if (PPP_CHECK_CB(on_NtPropagationFailed_enter) || PPP_CHECK_CB(on_NtPropagationFailed_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+uint32_t arg2 = get_32(env, 2);
+if (PPP_CHECK_CB(on_NtPropagationFailed_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtPropagationFailed_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 268 NTSTATUS NtPulseEvent ['HANDLE EventHandle', ' PLONG PreviousState']
+case 268: {
+if (PPP_CHECK_CB(on_NtPulseEvent_enter) || PPP_CHECK_CB(on_NtPulseEvent_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtPulseEvent_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtPulseEvent_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 269 NTSTATUS NtQueryBootEntryOrder ['PULONG Ids', ' PULONG Count']
+case 269: {
+if (PPP_CHECK_CB(on_NtQueryBootEntryOrder_enter) || PPP_CHECK_CB(on_NtQueryBootEntryOrder_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtQueryBootEntryOrder_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryBootEntryOrder_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 270 NTSTATUS NtQueryBootOptions ['PBOOT_OPTIONS BootOptions', ' PULONG BootOptionsLength']
+case 270: {
+if (PPP_CHECK_CB(on_NtQueryBootOptions_enter) || PPP_CHECK_CB(on_NtQueryBootOptions_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtQueryBootOptions_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryBootOptions_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 271 NTSTATUS NtQueryDebugFilterState ['ULONG ComponentId', ' ULONG Level']
+case 271: {
+if (PPP_CHECK_CB(on_NtQueryDebugFilterState_enter) || PPP_CHECK_CB(on_NtQueryDebugFilterState_return)) {
+uint32_t arg0 = get_32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+if (PPP_CHECK_CB(on_NtQueryDebugFilterState_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtQueryDebugFilterState_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 272 NTSTATUS NtQueryDirectoryObject ['HANDLE DirectoryHandle', ' PVOID Buffer', ' ULONG Length', ' BOOLEAN ReturnSingleEntry', ' BOOLEAN RestartScan', ' PULONG Context', ' PULONG ReturnLength']
+case 272: {
+if (PPP_CHECK_CB(on_NtQueryDirectoryObject_enter) || PPP_CHECK_CB(on_NtQueryDirectoryObject_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+uint32_t arg3 = get_32(env, 3);
+uint32_t arg4 = get_32(env, 4);
+target_ulong arg5 = get_64(env, 5);
+target_ulong arg6 = get_64(env, 6);
+if (PPP_CHECK_CB(on_NtQueryDirectoryObject_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryDirectoryObject_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+}
+}; break;
+// 273 NTSTATUS NtQueryDriverEntryOrder ['PULONG Ids', ' PULONG Count']
+case 273: {
+if (PPP_CHECK_CB(on_NtQueryDriverEntryOrder_enter) || PPP_CHECK_CB(on_NtQueryDriverEntryOrder_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtQueryDriverEntryOrder_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryDriverEntryOrder_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 274 NTSTATUS NtQueryEaFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length', ' BOOLEAN ReturnSingleEntry', ' PVOID EaList', ' ULONG EaListLength', ' PULONG EaIndex', ' BOOLEAN RestartScan']
+case 274: {
+if (PPP_CHECK_CB(on_NtQueryEaFile_enter) || PPP_CHECK_CB(on_NtQueryEaFile_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+uint32_t arg4 = get_32(env, 4);
+target_ulong arg5 = get_64(env, 5);
+uint32_t arg6 = get_32(env, 6);
+target_ulong arg7 = get_64(env, 7);
+uint32_t arg8 = get_32(env, 8);
+if (PPP_CHECK_CB(on_NtQueryEaFile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(uint32_t));
+memcpy(rp.params[7], &arg7, sizeof(target_ulong));
+memcpy(rp.params[8], &arg8, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtQueryEaFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
+}; break;
+// 275 NTSTATUS NtQueryFullAttributesFile ['POBJECT_ATTRIBUTES ObjectAttributes', ' PFILE_NETWORK_OPEN_INFORMATION FileInformation']
+case 275: {
+if (PPP_CHECK_CB(on_NtQueryFullAttributesFile_enter) || PPP_CHECK_CB(on_NtQueryFullAttributesFile_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtQueryFullAttributesFile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryFullAttributesFile_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 276 NTSTATUS NtQueryInformationAtom ['RTL_ATOM Atom', ' ATOM_INFORMATION_CLASS InformationClass', ' PVOID AtomInformation', ' ULONG AtomInformationLength', ' PULONG ReturnLength']
+case 276: {
+if (PPP_CHECK_CB(on_NtQueryInformationAtom_enter) || PPP_CHECK_CB(on_NtQueryInformationAtom_return)) {
+uint32_t arg0 = get_32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtQueryInformationAtom_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryInformationAtom_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 277 NTSTATUS NtQueryInformationEnlistment ['HANDLE EnlistmentHandle', ' ENLISTMENT_INFORMATION_CLASS EnlistmentInformationClass', ' PVOID EnlistmentInformation', ' ULONG EnlistmentInformationLength', ' PULONG ReturnLength']
+case 277: {
+if (PPP_CHECK_CB(on_NtQueryInformationEnlistment_enter) || PPP_CHECK_CB(on_NtQueryInformationEnlistment_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtQueryInformationEnlistment_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryInformationEnlistment_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 278 NTSTATUS NtQueryInformationJobObject ['HANDLE JobHandle', ' JOBOBJECTINFOCLASS JobObjectInformationClass', ' PVOID JobObjectInformation', ' ULONG JobObjectInformationLength', ' PULONG ReturnLength']
+case 278: {
+if (PPP_CHECK_CB(on_NtQueryInformationJobObject_enter) || PPP_CHECK_CB(on_NtQueryInformationJobObject_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtQueryInformationJobObject_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryInformationJobObject_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 279 NTSTATUS NtQueryInformationPort ['HANDLE PortHandle', ' PORT_INFORMATION_CLASS PortInformationClass', ' PVOID PortInformation', ' ULONG Length', ' PULONG ReturnLength']
+case 279: {
+if (PPP_CHECK_CB(on_NtQueryInformationPort_enter) || PPP_CHECK_CB(on_NtQueryInformationPort_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtQueryInformationPort_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryInformationPort_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 280 NTSTATUS NtQueryInformationResourceManager ['HANDLE ResourceManagerHandle', ' RESOURCEMANAGER_INFORMATION_CLASS ResourceManagerInformationClass', ' PVOID ResourceManagerInformation', ' ULONG ResourceManagerInformationLength', ' PULONG ReturnLength']
+case 280: {
+if (PPP_CHECK_CB(on_NtQueryInformationResourceManager_enter) || PPP_CHECK_CB(on_NtQueryInformationResourceManager_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtQueryInformationResourceManager_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryInformationResourceManager_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 281 NTSTATUS NtQueryInformationTransaction ['HANDLE TransactionHandle', ' TRANSACTION_INFORMATION_CLASS TransactionInformationClass', ' PVOID TransactionInformation', ' ULONG TransactionInformationLength', ' PULONG ReturnLength']
+case 281: {
+if (PPP_CHECK_CB(on_NtQueryInformationTransaction_enter) || PPP_CHECK_CB(on_NtQueryInformationTransaction_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtQueryInformationTransaction_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryInformationTransaction_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 282 NTSTATUS NtQueryInformationTransactionManager ['HANDLE TransactionManagerHandle', ' TRANSACTIONMANAGER_INFORMATION_CLASS TransactionManagerInformationClass', ' PVOID TransactionManagerInformation', ' ULONG TransactionManagerInformationLength', ' PULONG ReturnLength']
+case 282: {
+if (PPP_CHECK_CB(on_NtQueryInformationTransactionManager_enter) || PPP_CHECK_CB(on_NtQueryInformationTransactionManager_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtQueryInformationTransactionManager_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryInformationTransactionManager_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 283 NTSTATUS NtQueryInformationWorkerFactory ['HANDLE WorkerFactoryHandle', ' WORKERFACTORYINFOCLASS WorkerFactoryInformationClass', ' PVOID WorkerFactoryInformation', ' ULONG WorkerFactoryInformationLength', ' PULONG ReturnLength']
+case 283: {
+if (PPP_CHECK_CB(on_NtQueryInformationWorkerFactory_enter) || PPP_CHECK_CB(on_NtQueryInformationWorkerFactory_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtQueryInformationWorkerFactory_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryInformationWorkerFactory_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 284 NTSTATUS NtQueryInstallUILanguage ['LANGID *InstallUILanguageId']
+case 284: {
+if (PPP_CHECK_CB(on_NtQueryInstallUILanguage_enter) || PPP_CHECK_CB(on_NtQueryInstallUILanguage_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtQueryInstallUILanguage_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryInstallUILanguage_enter, env,pc,arg0) ; 
+}
+}; break;
+// 285 NTSTATUS NtQueryIntervalProfile ['KPROFILE_SOURCE ProfileSource', ' PULONG Interval']
+case 285: {
+if (PPP_CHECK_CB(on_NtQueryIntervalProfile_enter) || PPP_CHECK_CB(on_NtQueryIntervalProfile_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtQueryIntervalProfile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryIntervalProfile_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 286 NTSTATUS NtQueryIoCompletion ['HANDLE IoCompletionHandle', ' IO_COMPLETION_INFORMATION_CLASS IoCompletionInformationClass', ' PVOID IoCompletionInformation', ' ULONG IoCompletionInformationLength', ' PULONG ReturnLength']
+case 286: {
+if (PPP_CHECK_CB(on_NtQueryIoCompletion_enter) || PPP_CHECK_CB(on_NtQueryIoCompletion_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtQueryIoCompletion_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryIoCompletion_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 287 NTSTATUS NtQueryLicenseValue ['PUNICODE_STRING Name', ' PULONG Type', ' PVOID Buffer', ' ULONG Length', ' PULONG ReturnedLength']
+case 287: {
+if (PPP_CHECK_CB(on_NtQueryLicenseValue_enter) || PPP_CHECK_CB(on_NtQueryLicenseValue_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtQueryLicenseValue_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryLicenseValue_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 288 NTSTATUS NtQueryMultipleValueKey ['HANDLE KeyHandle', ' PKEY_VALUE_ENTRY ValueEntries', ' ULONG EntryCount', ' PVOID ValueBuffer', ' PULONG BufferLength', ' PULONG RequiredBufferLength']
+case 288: {
+if (PPP_CHECK_CB(on_NtQueryMultipleValueKey_enter) || PPP_CHECK_CB(on_NtQueryMultipleValueKey_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_NtQueryMultipleValueKey_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryMultipleValueKey_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 289 NTSTATUS NtQueryMutant ['HANDLE MutantHandle', ' MUTANT_INFORMATION_CLASS MutantInformationClass', ' PVOID MutantInformation', ' ULONG MutantInformationLength', ' PULONG ReturnLength']
+case 289: {
+if (PPP_CHECK_CB(on_NtQueryMutant_enter) || PPP_CHECK_CB(on_NtQueryMutant_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtQueryMutant_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryMutant_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 290 NTSTATUS NtQueryOpenSubKeys ['POBJECT_ATTRIBUTES TargetKey', ' PULONG HandleCount']
+case 290: {
+if (PPP_CHECK_CB(on_NtQueryOpenSubKeys_enter) || PPP_CHECK_CB(on_NtQueryOpenSubKeys_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtQueryOpenSubKeys_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryOpenSubKeys_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 291 NTSTATUS NtQueryOpenSubKeysEx ['POBJECT_ATTRIBUTES TargetKey', ' ULONG BufferLength', ' PVOID Buffer', ' PULONG RequiredSize']
+case 291: {
+if (PPP_CHECK_CB(on_NtQueryOpenSubKeysEx_enter) || PPP_CHECK_CB(on_NtQueryOpenSubKeysEx_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_NtQueryOpenSubKeysEx_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryOpenSubKeysEx_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 292 NTSTATUS NtQueryPortInformationProcess ['']
+case 292: {
+if (PPP_CHECK_CB(on_NtQueryPortInformationProcess_return)) {
+}
+PPP_RUN_CB(on_NtQueryPortInformationProcess_enter, env,pc) ; 
+}; break;
+// 293 NTSTATUS NtQueryQuotaInformationFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length', ' BOOLEAN ReturnSingleEntry', ' PVOID SidList', ' ULONG SidListLength', ' PULONG StartSid', ' BOOLEAN RestartScan']
+case 293: {
+if (PPP_CHECK_CB(on_NtQueryQuotaInformationFile_enter) || PPP_CHECK_CB(on_NtQueryQuotaInformationFile_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+uint32_t arg4 = get_32(env, 4);
+target_ulong arg5 = get_64(env, 5);
+uint32_t arg6 = get_32(env, 6);
+target_ulong arg7 = get_64(env, 7);
+uint32_t arg8 = get_32(env, 8);
+if (PPP_CHECK_CB(on_NtQueryQuotaInformationFile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(uint32_t));
+memcpy(rp.params[7], &arg7, sizeof(target_ulong));
+memcpy(rp.params[8], &arg8, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtQueryQuotaInformationFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
+}; break;
+// 294 NTSTATUS NtQuerySecurityAttributesToken ['HANDLE TokenHandle', ' PUNICODE_STRING Attributes', ' ULONG NumberOfAttributes', ' PVOID Buffer', ' ULONG Length', ' PULONG ReturnLength']
+case 294: {
+if (PPP_CHECK_CB(on_NtQuerySecurityAttributesToken_enter) || PPP_CHECK_CB(on_NtQuerySecurityAttributesToken_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+uint32_t arg4 = get_32(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_NtQuerySecurityAttributesToken_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQuerySecurityAttributesToken_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 295 NTSTATUS NtQuerySecurityObject ['HANDLE Handle', ' SECURITY_INFORMATION SecurityInformation', ' PSECURITY_DESCRIPTOR SecurityDescriptor', ' ULONG Length', ' PULONG LengthNeeded']
+case 295: {
+if (PPP_CHECK_CB(on_NtQuerySecurityObject_enter) || PPP_CHECK_CB(on_NtQuerySecurityObject_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtQuerySecurityObject_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQuerySecurityObject_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 296 NTSTATUS NtQuerySemaphore ['HANDLE SemaphoreHandle', ' SEMAPHORE_INFORMATION_CLASS SemaphoreInformationClass', ' PVOID SemaphoreInformation', ' ULONG SemaphoreInformationLength', ' PULONG ReturnLength']
+case 296: {
+if (PPP_CHECK_CB(on_NtQuerySemaphore_enter) || PPP_CHECK_CB(on_NtQuerySemaphore_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtQuerySemaphore_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQuerySemaphore_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 297 NTSTATUS NtQuerySymbolicLinkObject ['HANDLE LinkHandle', ' PUNICODE_STRING LinkTarget', ' PULONG ReturnedLength']
+case 297: {
+if (PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_enter) || PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQuerySymbolicLinkObject_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 298 NTSTATUS NtQuerySystemEnvironmentValue ['PUNICODE_STRING VariableName', ' PWSTR VariableValue', ' USHORT ValueLength', ' PUSHORT ReturnLength']
+case 298: {
+if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_enter) || PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQuerySystemEnvironmentValue_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 299 NTSTATUS NtQuerySystemEnvironmentValueEx ['PUNICODE_STRING VariableName', ' LPGUID VendorGuid', ' PVOID Value', ' PULONG ValueLength', ' PULONG Attributes']
+case 299: {
+if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_enter) || PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQuerySystemEnvironmentValueEx_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 300 NTSTATUS NtQuerySystemInformationEx ['SYSTEM_INFORMATION_CLASS SystemInformationClass', ' PVOID QueryInformation', ' ULONG QueryInformationLength', ' PVOID SystemInformation', ' ULONG SystemInformationLength', ' PULONG ReturnLength']
+case 300: {
+if (PPP_CHECK_CB(on_NtQuerySystemInformationEx_enter) || PPP_CHECK_CB(on_NtQuerySystemInformationEx_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+uint32_t arg4 = get_32(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_NtQuerySystemInformationEx_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQuerySystemInformationEx_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 301 NTSTATUS NtQueryTimerResolution ['PULONG MaximumTime', ' PULONG MinimumTime', ' PULONG CurrentTime']
+case 301: {
+if (PPP_CHECK_CB(on_NtQueryTimerResolution_enter) || PPP_CHECK_CB(on_NtQueryTimerResolution_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtQueryTimerResolution_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryTimerResolution_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 302 NTSTATUS NtQueueApcThreadEx ['HANDLE ThreadHandle', ' HANDLE UserApcReserveHandle', ' PPS_APC_ROUTINE ApcRoutine', ' PVOID ApcArgument1', ' PVOID ApcArgument2', ' PVOID ApcArgument3']
+case 302: {
+if (PPP_CHECK_CB(on_NtQueueApcThreadEx_enter) || PPP_CHECK_CB(on_NtQueueApcThreadEx_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_NtQueueApcThreadEx_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueueApcThreadEx_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 303 NTSTATUS NtRaiseException ['PEXCEPTION_RECORD ExceptionRecord', ' PCONTEXT ContextRecord', ' BOOLEAN FirstChance']
+case 303: {
+if (PPP_CHECK_CB(on_NtRaiseException_enter) || PPP_CHECK_CB(on_NtRaiseException_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+if (PPP_CHECK_CB(on_NtRaiseException_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtRaiseException_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 304 NTSTATUS NtRaiseHardError ['NTSTATUS ErrorStatus', ' ULONG NumberOfParameters', ' ULONG UnicodeStringParameterMask', ' PULONG_PTR Parameters', ' ULONG ValidResponseOptions', ' PULONG Response']
+case 304: {
+if (PPP_CHECK_CB(on_NtRaiseHardError_enter) || PPP_CHECK_CB(on_NtRaiseHardError_return)) {
+uint32_t arg0 = get_32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+uint32_t arg4 = get_32(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_NtRaiseHardError_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtRaiseHardError_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 305 NTSTATUS NtReadOnlyEnlistment ['HANDLE EnlistmentHandle', ' PLARGE_INTEGER TmVirtualClock']
+case 305: {
+if (PPP_CHECK_CB(on_NtReadOnlyEnlistment_enter) || PPP_CHECK_CB(on_NtReadOnlyEnlistment_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtReadOnlyEnlistment_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtReadOnlyEnlistment_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 306 NTSTATUS NtRecoverEnlistment ['HANDLE EnlistmentHandle', ' PVOID EnlistmentKey']
+case 306: {
+if (PPP_CHECK_CB(on_NtRecoverEnlistment_enter) || PPP_CHECK_CB(on_NtRecoverEnlistment_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtRecoverEnlistment_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtRecoverEnlistment_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 307 NTSTATUS NtRecoverResourceManager ['HANDLE ResourceManagerHandle']
+case 307: {
+if (PPP_CHECK_CB(on_NtRecoverResourceManager_enter) || PPP_CHECK_CB(on_NtRecoverResourceManager_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtRecoverResourceManager_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtRecoverResourceManager_enter, env,pc,arg0) ; 
+}
+}; break;
+// 308 NTSTATUS NtRecoverTransactionManager ['HANDLE TransactionManagerHandle']
+case 308: {
+if (PPP_CHECK_CB(on_NtRecoverTransactionManager_enter) || PPP_CHECK_CB(on_NtRecoverTransactionManager_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtRecoverTransactionManager_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtRecoverTransactionManager_enter, env,pc,arg0) ; 
+}
+}; break;
+// 309 NTSTATUS NtRegisterProtocolAddressInformation ['HANDLE ResourceManager', ' PCRM_PROTOCOL_ID ProtocolId', ' ULONG ProtocolInformationSize', ' PVOID ProtocolInformation', ' ULONG CreateOptions']
+case 309: {
+if (PPP_CHECK_CB(on_NtRegisterProtocolAddressInformation_enter) || PPP_CHECK_CB(on_NtRegisterProtocolAddressInformation_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+uint32_t arg4 = get_32(env, 4);
+if (PPP_CHECK_CB(on_NtRegisterProtocolAddressInformation_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtRegisterProtocolAddressInformation_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 310 NTSTATUS NtRegisterThreadTerminatePort ['HANDLE PortHandle']
+case 310: {
+if (PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_enter) || PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtRegisterThreadTerminatePort_enter, env,pc,arg0) ; 
+}
+}; break;
+// 311 NTSTATUS NtReleaseKeyedEvent ['HANDLE KeyedEventHandle', ' PVOID KeyValue', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout']
+case 311: {
+if (PPP_CHECK_CB(on_NtReleaseKeyedEvent_enter) || PPP_CHECK_CB(on_NtReleaseKeyedEvent_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_NtReleaseKeyedEvent_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtReleaseKeyedEvent_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 312 NTSTATUS NtReleaseWorkerFactoryWorker ['HANDLE WorkerFactoryHandle']
+case 312: {
+if (PPP_CHECK_CB(on_NtReleaseWorkerFactoryWorker_enter) || PPP_CHECK_CB(on_NtReleaseWorkerFactoryWorker_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtReleaseWorkerFactoryWorker_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtReleaseWorkerFactoryWorker_enter, env,pc,arg0) ; 
+}
+}; break;
+// 313 NTSTATUS NtRemoveIoCompletionEx ['HANDLE IoCompletionHandle', ' PFILE_IO_COMPLETION_INFORMATION IoCompletionInformation', ' ULONG Count', ' PULONG NumEntriesRemoved', ' PLARGE_INTEGER Timeout', ' BOOLEAN Alertable']
+case 313: {
+if (PPP_CHECK_CB(on_NtRemoveIoCompletionEx_enter) || PPP_CHECK_CB(on_NtRemoveIoCompletionEx_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+uint32_t arg5 = get_32(env, 5);
+if (PPP_CHECK_CB(on_NtRemoveIoCompletionEx_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtRemoveIoCompletionEx_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 314 NTSTATUS NtRemoveProcessDebug ['HANDLE ProcessHandle', ' HANDLE DebugObjectHandle']
+case 314: {
+if (PPP_CHECK_CB(on_NtRemoveProcessDebug_enter) || PPP_CHECK_CB(on_NtRemoveProcessDebug_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtRemoveProcessDebug_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtRemoveProcessDebug_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 315 NTSTATUS NtRenameKey ['HANDLE KeyHandle', ' PUNICODE_STRING NewName']
+case 315: {
+if (PPP_CHECK_CB(on_NtRenameKey_enter) || PPP_CHECK_CB(on_NtRenameKey_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtRenameKey_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtRenameKey_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 316 NTSTATUS NtRenameTransactionManager ['PUNICODE_STRING LogFileName', ' LPGUID ExistingTransactionManagerGuid']
+case 316: {
+if (PPP_CHECK_CB(on_NtRenameTransactionManager_enter) || PPP_CHECK_CB(on_NtRenameTransactionManager_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtRenameTransactionManager_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtRenameTransactionManager_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 317 NTSTATUS NtReplaceKey ['POBJECT_ATTRIBUTES NewFile', ' HANDLE TargetHandle', ' POBJECT_ATTRIBUTES OldFile']
+case 317: {
+if (PPP_CHECK_CB(on_NtReplaceKey_enter) || PPP_CHECK_CB(on_NtReplaceKey_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtReplaceKey_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtReplaceKey_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 318 NTSTATUS NtReplacePartitionUnit ['PUNICODE_STRING TargetInstancePath', ' PUNICODE_STRING SpareInstancePath', ' ULONG Flags']
+case 318: {
+if (PPP_CHECK_CB(on_NtReplacePartitionUnit_enter) || PPP_CHECK_CB(on_NtReplacePartitionUnit_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+if (PPP_CHECK_CB(on_NtReplacePartitionUnit_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtReplacePartitionUnit_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 319 NTSTATUS NtReplyWaitReplyPort ['HANDLE PortHandle', ' PPORT_MESSAGE ReplyMessage']
+case 319: {
+if (PPP_CHECK_CB(on_NtReplyWaitReplyPort_enter) || PPP_CHECK_CB(on_NtReplyWaitReplyPort_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtReplyWaitReplyPort_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtReplyWaitReplyPort_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 320 NTSTATUS NtRequestPort ['HANDLE PortHandle', ' PPORT_MESSAGE RequestMessage']
+case 320: {
+if (PPP_CHECK_CB(on_NtRequestPort_enter) || PPP_CHECK_CB(on_NtRequestPort_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtRequestPort_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtRequestPort_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 321 NTSTATUS NtResetEvent ['HANDLE EventHandle', ' PLONG PreviousState']
+case 321: {
+if (PPP_CHECK_CB(on_NtResetEvent_enter) || PPP_CHECK_CB(on_NtResetEvent_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtResetEvent_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtResetEvent_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 322 NTSTATUS NtResetWriteWatch ['HANDLE ProcessHandle', ' PVOID BaseAddress', ' SIZE_T RegionSize']
+case 322: {
+if (PPP_CHECK_CB(on_NtResetWriteWatch_enter) || PPP_CHECK_CB(on_NtResetWriteWatch_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtResetWriteWatch_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtResetWriteWatch_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 323 NTSTATUS NtRestoreKey ['HANDLE KeyHandle', ' HANDLE FileHandle', ' ULONG Flags']
+case 323: {
+if (PPP_CHECK_CB(on_NtRestoreKey_enter) || PPP_CHECK_CB(on_NtRestoreKey_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+if (PPP_CHECK_CB(on_NtRestoreKey_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtRestoreKey_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 324 NTSTATUS NtResumeProcess ['HANDLE ProcessHandle']
+case 324: {
+if (PPP_CHECK_CB(on_NtResumeProcess_enter) || PPP_CHECK_CB(on_NtResumeProcess_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtResumeProcess_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtResumeProcess_enter, env,pc,arg0) ; 
+}
+}; break;
+// 325 NTSTATUS NtRollbackComplete ['HANDLE EnlistmentHandle', ' PLARGE_INTEGER TmVirtualClock']
+case 325: {
+if (PPP_CHECK_CB(on_NtRollbackComplete_enter) || PPP_CHECK_CB(on_NtRollbackComplete_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtRollbackComplete_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtRollbackComplete_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 326 NTSTATUS NtRollbackEnlistment ['HANDLE EnlistmentHandle', ' PLARGE_INTEGER TmVirtualClock']
+case 326: {
+if (PPP_CHECK_CB(on_NtRollbackEnlistment_enter) || PPP_CHECK_CB(on_NtRollbackEnlistment_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtRollbackEnlistment_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtRollbackEnlistment_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 327 NTSTATUS NtRollbackTransaction ['HANDLE TransactionHandle', ' BOOLEAN Wait']
+case 327: {
+if (PPP_CHECK_CB(on_NtRollbackTransaction_enter) || PPP_CHECK_CB(on_NtRollbackTransaction_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+if (PPP_CHECK_CB(on_NtRollbackTransaction_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtRollbackTransaction_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 328 NTSTATUS NtRollforwardTransactionManager ['HANDLE TransactionManagerHandle', ' PLARGE_INTEGER TmVirtualClock']
+case 328: {
+if (PPP_CHECK_CB(on_NtRollforwardTransactionManager_enter) || PPP_CHECK_CB(on_NtRollforwardTransactionManager_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtRollforwardTransactionManager_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtRollforwardTransactionManager_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 329 NTSTATUS NtSaveKey ['HANDLE KeyHandle', ' HANDLE FileHandle']
+case 329: {
+if (PPP_CHECK_CB(on_NtSaveKey_enter) || PPP_CHECK_CB(on_NtSaveKey_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtSaveKey_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSaveKey_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 330 NTSTATUS NtSaveKeyEx ['HANDLE KeyHandle', ' HANDLE FileHandle', ' ULONG Format']
+case 330: {
+if (PPP_CHECK_CB(on_NtSaveKeyEx_enter) || PPP_CHECK_CB(on_NtSaveKeyEx_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+if (PPP_CHECK_CB(on_NtSaveKeyEx_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSaveKeyEx_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 331 NTSTATUS NtSaveMergedKeys ['HANDLE HighPrecedenceKeyHandle', ' HANDLE LowPrecedenceKeyHandle', ' HANDLE FileHandle']
+case 331: {
+if (PPP_CHECK_CB(on_NtSaveMergedKeys_enter) || PPP_CHECK_CB(on_NtSaveMergedKeys_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtSaveMergedKeys_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSaveMergedKeys_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 332 NTSTATUS NtSecureConnectPort ['PHANDLE PortHandle', ' PUNICODE_STRING PortName', ' PSECURITY_QUALITY_OF_SERVICE SecurityQos', ' PPORT_VIEW ClientView', ' PSID RequiredServerSid', ' PREMOTE_PORT_VIEW ServerView', ' PULONG MaxMessageLength', ' PVOID ConnectionInformation', ' PULONG ConnectionInformationLength']
+case 332: {
+if (PPP_CHECK_CB(on_NtSecureConnectPort_enter) || PPP_CHECK_CB(on_NtSecureConnectPort_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+target_ulong arg4 = get_64(env, 4);
+target_ulong arg5 = get_64(env, 5);
+target_ulong arg6 = get_64(env, 6);
+target_ulong arg7 = get_64(env, 7);
+target_ulong arg8 = get_64(env, 8);
+if (PPP_CHECK_CB(on_NtSecureConnectPort_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+memcpy(rp.params[6], &arg6, sizeof(target_ulong));
+memcpy(rp.params[7], &arg7, sizeof(target_ulong));
+memcpy(rp.params[8], &arg8, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSecureConnectPort_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
+}; break;
+// 333 NTSTATUS NtSerializeBoot ['']
+case 333: {
+if (PPP_CHECK_CB(on_NtSerializeBoot_return)) {
+}
+PPP_RUN_CB(on_NtSerializeBoot_enter, env,pc) ; 
+}; break;
+// 334 NTSTATUS NtSetBootEntryOrder ['PULONG Ids', ' ULONG Count']
+case 334: {
+if (PPP_CHECK_CB(on_NtSetBootEntryOrder_enter) || PPP_CHECK_CB(on_NtSetBootEntryOrder_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+if (PPP_CHECK_CB(on_NtSetBootEntryOrder_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetBootEntryOrder_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 335 NTSTATUS NtSetBootOptions ['PBOOT_OPTIONS BootOptions', ' ULONG FieldsToChange']
+case 335: {
+if (PPP_CHECK_CB(on_NtSetBootOptions_enter) || PPP_CHECK_CB(on_NtSetBootOptions_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+if (PPP_CHECK_CB(on_NtSetBootOptions_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetBootOptions_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 336 NTSTATUS NtSetContextThread ['HANDLE ThreadHandle', ' PCONTEXT ThreadContext']
+case 336: {
+if (PPP_CHECK_CB(on_NtSetContextThread_enter) || PPP_CHECK_CB(on_NtSetContextThread_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtSetContextThread_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetContextThread_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 337 NTSTATUS NtSetDebugFilterState ['ULONG ComponentId', ' ULONG Level', ' BOOLEAN State']
+case 337: {
+if (PPP_CHECK_CB(on_NtSetDebugFilterState_enter) || PPP_CHECK_CB(on_NtSetDebugFilterState_return)) {
+uint32_t arg0 = get_32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+uint32_t arg2 = get_32(env, 2);
+if (PPP_CHECK_CB(on_NtSetDebugFilterState_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetDebugFilterState_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 338 NTSTATUS NtSetDefaultHardErrorPort ['HANDLE DefaultHardErrorPort']
+case 338: {
+if (PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_enter) || PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetDefaultHardErrorPort_enter, env,pc,arg0) ; 
+}
+}; break;
+// 339 NTSTATUS NtSetDefaultLocale ['BOOLEAN UserProfile', ' LCID DefaultLocaleId']
+case 339: {
+if (PPP_CHECK_CB(on_NtSetDefaultLocale_enter) || PPP_CHECK_CB(on_NtSetDefaultLocale_return)) {
+uint32_t arg0 = get_32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+if (PPP_CHECK_CB(on_NtSetDefaultLocale_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetDefaultLocale_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 340 NTSTATUS NtSetDefaultUILanguage ['LANGID DefaultUILanguageId']
+case 340: {
+if (PPP_CHECK_CB(on_NtSetDefaultUILanguage_enter) || PPP_CHECK_CB(on_NtSetDefaultUILanguage_return)) {
+uint32_t arg0 = get_32(env, 0);
+if (PPP_CHECK_CB(on_NtSetDefaultUILanguage_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetDefaultUILanguage_enter, env,pc,arg0) ; 
+}
+}; break;
+// 341 NTSTATUS NtSetDriverEntryOrder ['PULONG Ids', ' ULONG Count']
+case 341: {
+if (PPP_CHECK_CB(on_NtSetDriverEntryOrder_enter) || PPP_CHECK_CB(on_NtSetDriverEntryOrder_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+if (PPP_CHECK_CB(on_NtSetDriverEntryOrder_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetDriverEntryOrder_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 342 NTSTATUS NtSetEaFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length']
+case 342: {
+if (PPP_CHECK_CB(on_NtSetEaFile_enter) || PPP_CHECK_CB(on_NtSetEaFile_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_NtSetEaFile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetEaFile_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 343 NTSTATUS NtSetHighEventPair ['HANDLE EventPairHandle']
+case 343: {
+if (PPP_CHECK_CB(on_NtSetHighEventPair_enter) || PPP_CHECK_CB(on_NtSetHighEventPair_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtSetHighEventPair_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetHighEventPair_enter, env,pc,arg0) ; 
+}
+}; break;
+// 344 NTSTATUS NtSetHighWaitLowEventPair ['HANDLE EventPairHandle']
+case 344: {
+if (PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_enter) || PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetHighWaitLowEventPair_enter, env,pc,arg0) ; 
+}
+}; break;
+// 345 NTSTATUS NtSetInformationDebugObject ['HANDLE DebugObjectHandle', ' DEBUGOBJECTINFOCLASS DebugObjectInformationClass', ' PVOID DebugInformation', ' ULONG DebugInformationLength', ' PULONG ReturnLength']
+case 345: {
+if (PPP_CHECK_CB(on_NtSetInformationDebugObject_enter) || PPP_CHECK_CB(on_NtSetInformationDebugObject_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtSetInformationDebugObject_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetInformationDebugObject_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 346 NTSTATUS NtSetInformationEnlistment ['HANDLE EnlistmentHandle', ' ENLISTMENT_INFORMATION_CLASS EnlistmentInformationClass', ' PVOID EnlistmentInformation', ' ULONG EnlistmentInformationLength']
+case 346: {
+if (PPP_CHECK_CB(on_NtSetInformationEnlistment_enter) || PPP_CHECK_CB(on_NtSetInformationEnlistment_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_NtSetInformationEnlistment_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetInformationEnlistment_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 347 NTSTATUS NtSetInformationJobObject ['HANDLE JobHandle', ' JOBOBJECTINFOCLASS JobObjectInformationClass', ' PVOID JobObjectInformation', ' ULONG JobObjectInformationLength']
+case 347: {
+if (PPP_CHECK_CB(on_NtSetInformationJobObject_enter) || PPP_CHECK_CB(on_NtSetInformationJobObject_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_NtSetInformationJobObject_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetInformationJobObject_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 348 NTSTATUS NtSetInformationKey ['HANDLE KeyHandle', ' KEY_SET_INFORMATION_CLASS KeySetInformationClass', ' PVOID KeySetInformation', ' ULONG KeySetInformationLength']
+case 348: {
+if (PPP_CHECK_CB(on_NtSetInformationKey_enter) || PPP_CHECK_CB(on_NtSetInformationKey_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_NtSetInformationKey_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetInformationKey_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 349 NTSTATUS NtSetInformationResourceManager ['HANDLE ResourceManagerHandle', ' RESOURCEMANAGER_INFORMATION_CLASS ResourceManagerInformationClass', ' PVOID ResourceManagerInformation', ' ULONG ResourceManagerInformationLength']
+case 349: {
+if (PPP_CHECK_CB(on_NtSetInformationResourceManager_enter) || PPP_CHECK_CB(on_NtSetInformationResourceManager_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_NtSetInformationResourceManager_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetInformationResourceManager_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 350 NTSTATUS NtSetInformationToken ['HANDLE TokenHandle', ' TOKEN_INFORMATION_CLASS TokenInformationClass', ' PVOID TokenInformation', ' ULONG TokenInformationLength']
+case 350: {
+if (PPP_CHECK_CB(on_NtSetInformationToken_enter) || PPP_CHECK_CB(on_NtSetInformationToken_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_NtSetInformationToken_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetInformationToken_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 351 NTSTATUS NtSetInformationTransaction ['HANDLE TransactionHandle', ' TRANSACTION_INFORMATION_CLASS TransactionInformationClass', ' PVOID TransactionInformation', ' ULONG TransactionInformationLength']
+case 351: {
+if (PPP_CHECK_CB(on_NtSetInformationTransaction_enter) || PPP_CHECK_CB(on_NtSetInformationTransaction_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_NtSetInformationTransaction_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetInformationTransaction_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 352 NTSTATUS NtSetInformationTransactionManager ['HANDLE TmHandle', ' TRANSACTIONMANAGER_INFORMATION_CLASS TransactionManagerInformationClass', ' PVOID TransactionManagerInformation', ' ULONG TransactionManagerInformationLength']
+case 352: {
+if (PPP_CHECK_CB(on_NtSetInformationTransactionManager_enter) || PPP_CHECK_CB(on_NtSetInformationTransactionManager_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_NtSetInformationTransactionManager_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetInformationTransactionManager_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 353 NTSTATUS NtSetInformationWorkerFactory ['HANDLE WorkerFactoryHandle', ' WORKERFACTORYINFOCLASS WorkerFactoryInformationClass', ' PVOID WorkerFactoryInformation', ' ULONG WorkerFactoryInformationLength']
+case 353: {
+if (PPP_CHECK_CB(on_NtSetInformationWorkerFactory_enter) || PPP_CHECK_CB(on_NtSetInformationWorkerFactory_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_NtSetInformationWorkerFactory_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetInformationWorkerFactory_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 354 NTSTATUS NtSetIntervalProfile ['ULONG Interval', ' KPROFILE_SOURCE Source']
+case 354: {
+if (PPP_CHECK_CB(on_NtSetIntervalProfile_enter) || PPP_CHECK_CB(on_NtSetIntervalProfile_return)) {
+uint32_t arg0 = get_32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+if (PPP_CHECK_CB(on_NtSetIntervalProfile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetIntervalProfile_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 355 NTSTATUS NtSetIoCompletion ['HANDLE IoCompletionHandle', ' PVOID KeyContext', ' PVOID ApcContext', ' NTSTATUS IoStatus', ' ULONG_PTR IoStatusInformation']
+case 355: {
+if (PPP_CHECK_CB(on_NtSetIoCompletion_enter) || PPP_CHECK_CB(on_NtSetIoCompletion_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+target_ulong arg4 = get_64(env, 4);
+if (PPP_CHECK_CB(on_NtSetIoCompletion_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetIoCompletion_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 356 NTSTATUS NtSetIoCompletionEx ['HANDLE IoCompletionHandle', ' HANDLE IoCompletionReserveHandle', ' PVOID KeyContext', ' PVOID ApcContext', ' NTSTATUS IoStatus', ' ULONG_PTR IoStatusInformation']
+case 356: {
+if (PPP_CHECK_CB(on_NtSetIoCompletionEx_enter) || PPP_CHECK_CB(on_NtSetIoCompletionEx_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+uint32_t arg4 = get_32(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_NtSetIoCompletionEx_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetIoCompletionEx_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 357 NTSTATUS NtSetLdtEntries ['ULONG Selector0', ' ULONG Entry0Low', ' ULONG Entry0Hi', ' ULONG Selector1', ' ULONG Entry1Low', ' ULONG Entry1Hi']
+case 357: {
+if (PPP_CHECK_CB(on_NtSetLdtEntries_enter) || PPP_CHECK_CB(on_NtSetLdtEntries_return)) {
+uint32_t arg0 = get_32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+uint32_t arg2 = get_32(env, 2);
+uint32_t arg3 = get_32(env, 3);
+uint32_t arg4 = get_32(env, 4);
+uint32_t arg5 = get_32(env, 5);
+if (PPP_CHECK_CB(on_NtSetLdtEntries_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetLdtEntries_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 358 NTSTATUS NtSetLowEventPair ['HANDLE EventPairHandle']
+case 358: {
+if (PPP_CHECK_CB(on_NtSetLowEventPair_enter) || PPP_CHECK_CB(on_NtSetLowEventPair_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtSetLowEventPair_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetLowEventPair_enter, env,pc,arg0) ; 
+}
+}; break;
+// 359 NTSTATUS NtSetLowWaitHighEventPair ['HANDLE EventPairHandle']
+case 359: {
+if (PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_enter) || PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetLowWaitHighEventPair_enter, env,pc,arg0) ; 
+}
+}; break;
+// 360 NTSTATUS NtSetQuotaInformationFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length']
+case 360: {
+if (PPP_CHECK_CB(on_NtSetQuotaInformationFile_enter) || PPP_CHECK_CB(on_NtSetQuotaInformationFile_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_NtSetQuotaInformationFile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetQuotaInformationFile_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 361 NTSTATUS NtSetSecurityObject ['HANDLE Handle', ' SECURITY_INFORMATION SecurityInformation', ' PSECURITY_DESCRIPTOR SecurityDescriptor']
+case 361: {
+if (PPP_CHECK_CB(on_NtSetSecurityObject_enter) || PPP_CHECK_CB(on_NtSetSecurityObject_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtSetSecurityObject_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetSecurityObject_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 362 NTSTATUS NtSetSystemEnvironmentValue ['PUNICODE_STRING VariableName', ' PUNICODE_STRING VariableValue']
+case 362: {
+if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_enter) || PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetSystemEnvironmentValue_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 363 NTSTATUS NtSetSystemEnvironmentValueEx ['PUNICODE_STRING VariableName', ' LPGUID VendorGuid', ' PVOID Value', ' ULONG ValueLength', ' ULONG Attributes']
+case 363: {
+if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValueEx_enter) || PPP_CHECK_CB(on_NtSetSystemEnvironmentValueEx_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+uint32_t arg4 = get_32(env, 4);
+if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValueEx_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetSystemEnvironmentValueEx_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 364 NTSTATUS NtSetSystemInformation ['SYSTEM_INFORMATION_CLASS SystemInformationClass', ' PVOID SystemInformation', ' ULONG SystemInformationLength']
+case 364: {
+if (PPP_CHECK_CB(on_NtSetSystemInformation_enter) || PPP_CHECK_CB(on_NtSetSystemInformation_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+if (PPP_CHECK_CB(on_NtSetSystemInformation_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetSystemInformation_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 365 NTSTATUS NtSetSystemPowerState ['POWER_ACTION SystemAction', ' SYSTEM_POWER_STATE MinSystemState', ' ULONG Flags']
+case 365: {
+if (PPP_CHECK_CB(on_NtSetSystemPowerState_enter) || PPP_CHECK_CB(on_NtSetSystemPowerState_return)) {
+uint32_t arg0 = get_32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+uint32_t arg2 = get_32(env, 2);
+if (PPP_CHECK_CB(on_NtSetSystemPowerState_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetSystemPowerState_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 366 NTSTATUS NtSetSystemTime ['PLARGE_INTEGER SystemTime', ' PLARGE_INTEGER PreviousTime']
+case 366: {
+if (PPP_CHECK_CB(on_NtSetSystemTime_enter) || PPP_CHECK_CB(on_NtSetSystemTime_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtSetSystemTime_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetSystemTime_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 367 NTSTATUS NtSetThreadExecutionState ['EXECUTION_STATE esFlags', ' PEXECUTION_STATE PreviousFlags']
+case 367: {
+if (PPP_CHECK_CB(on_NtSetThreadExecutionState_enter) || PPP_CHECK_CB(on_NtSetThreadExecutionState_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtSetThreadExecutionState_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetThreadExecutionState_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 368 NTSTATUS NtSetTimerEx ['HANDLE TimerHandle', ' TIMER_SET_INFORMATION_CLASS TimerSetInformationClass', ' PVOID TimerSetInformation', ' ULONG TimerSetInformationLength']
+case 368: {
+if (PPP_CHECK_CB(on_NtSetTimerEx_enter) || PPP_CHECK_CB(on_NtSetTimerEx_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_NtSetTimerEx_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetTimerEx_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 369 NTSTATUS NtSetTimerResolution ['ULONG DesiredTime', ' BOOLEAN SetResolution', ' PULONG ActualTime']
+case 369: {
+if (PPP_CHECK_CB(on_NtSetTimerResolution_enter) || PPP_CHECK_CB(on_NtSetTimerResolution_return)) {
+uint32_t arg0 = get_32(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+if (PPP_CHECK_CB(on_NtSetTimerResolution_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetTimerResolution_enter, env,pc,arg0,arg1,arg2) ; 
+}
+}; break;
+// 370 NTSTATUS NtSetUuidSeed ['PCHAR Seed']
+case 370: {
+if (PPP_CHECK_CB(on_NtSetUuidSeed_enter) || PPP_CHECK_CB(on_NtSetUuidSeed_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtSetUuidSeed_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetUuidSeed_enter, env,pc,arg0) ; 
+}
+}; break;
+// 371 NTSTATUS NtSetVolumeInformationFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID FsInformation', ' ULONG Length', ' FS_INFORMATION_CLASS FsInformationClass']
+case 371: {
+if (PPP_CHECK_CB(on_NtSetVolumeInformationFile_enter) || PPP_CHECK_CB(on_NtSetVolumeInformationFile_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+uint32_t arg4 = get_32(env, 4);
+if (PPP_CHECK_CB(on_NtSetVolumeInformationFile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetVolumeInformationFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 372 NTSTATUS NtShutdownSystem ['SHUTDOWN_ACTION Action']
+case 372: {
+if (PPP_CHECK_CB(on_NtShutdownSystem_enter) || PPP_CHECK_CB(on_NtShutdownSystem_return)) {
+uint32_t arg0 = get_32(env, 0);
+if (PPP_CHECK_CB(on_NtShutdownSystem_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtShutdownSystem_enter, env,pc,arg0) ; 
+}
+}; break;
+// 373 NTSTATUS NtShutdownWorkerFactory ['HANDLE WorkerFactoryHandle', ' LONG *PendingWorkerCount']
+case 373: {
+if (PPP_CHECK_CB(on_NtShutdownWorkerFactory_enter) || PPP_CHECK_CB(on_NtShutdownWorkerFactory_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtShutdownWorkerFactory_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtShutdownWorkerFactory_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 374 NTSTATUS NtSignalAndWaitForSingleObject ['HANDLE SignalHandle', ' HANDLE WaitHandle', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout']
+case 374: {
+if (PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_enter) || PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSignalAndWaitForSingleObject_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 375 NTSTATUS NtSinglePhaseReject ['HANDLE EnlistmentHandle', ' PLARGE_INTEGER TmVirtualClock']
+case 375: {
+if (PPP_CHECK_CB(on_NtSinglePhaseReject_enter) || PPP_CHECK_CB(on_NtSinglePhaseReject_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtSinglePhaseReject_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSinglePhaseReject_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 376 NTSTATUS NtStartProfile ['HANDLE ProfileHandle']
+case 376: {
+if (PPP_CHECK_CB(on_NtStartProfile_enter) || PPP_CHECK_CB(on_NtStartProfile_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtStartProfile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtStartProfile_enter, env,pc,arg0) ; 
+}
+}; break;
+// 377 NTSTATUS NtStopProfile ['HANDLE ProfileHandle']
+case 377: {
+if (PPP_CHECK_CB(on_NtStopProfile_enter) || PPP_CHECK_CB(on_NtStopProfile_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtStopProfile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtStopProfile_enter, env,pc,arg0) ; 
+}
+}; break;
+// 378 NTSTATUS NtSuspendProcess ['HANDLE ProcessHandle']
+case 378: {
+if (PPP_CHECK_CB(on_NtSuspendProcess_enter) || PPP_CHECK_CB(on_NtSuspendProcess_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtSuspendProcess_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSuspendProcess_enter, env,pc,arg0) ; 
+}
+}; break;
+// 379 NTSTATUS NtSuspendThread ['HANDLE ThreadHandle', ' PULONG PreviousSuspendCount']
+case 379: {
+if (PPP_CHECK_CB(on_NtSuspendThread_enter) || PPP_CHECK_CB(on_NtSuspendThread_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtSuspendThread_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSuspendThread_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 380 NTSTATUS NtSystemDebugControl ['SYSDBG_COMMAND Command', ' PVOID InputBuffer', ' ULONG InputBufferLength', ' PVOID OutputBuffer', ' ULONG OutputBufferLength', ' PULONG ReturnLength']
+case 380: {
+if (PPP_CHECK_CB(on_NtSystemDebugControl_enter) || PPP_CHECK_CB(on_NtSystemDebugControl_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+uint32_t arg4 = get_32(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_NtSystemDebugControl_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSystemDebugControl_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 381 NTSTATUS NtTerminateJobObject ['HANDLE JobHandle', ' NTSTATUS ExitStatus']
+case 381: {
+if (PPP_CHECK_CB(on_NtTerminateJobObject_enter) || PPP_CHECK_CB(on_NtTerminateJobObject_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+if (PPP_CHECK_CB(on_NtTerminateJobObject_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtTerminateJobObject_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 382 NTSTATUS NtTestAlert ['']
+case 382: {
+if (PPP_CHECK_CB(on_NtTestAlert_return)) {
+}
+PPP_RUN_CB(on_NtTestAlert_enter, env,pc) ; 
+}; break;
+// 383 NTSTATUS NtThawRegistry ['']
+case 383: {
+if (PPP_CHECK_CB(on_NtThawRegistry_return)) {
+}
+PPP_RUN_CB(on_NtThawRegistry_enter, env,pc) ; 
+}; break;
+// 384 NTSTATUS NtThawTransactions ['']
+case 384: {
+if (PPP_CHECK_CB(on_NtThawTransactions_return)) {
+}
+PPP_RUN_CB(on_NtThawTransactions_enter, env,pc) ; 
+}; break;
+// 385 NTSTATUS NtTraceControl ['ULONG FunctionCode', ' PVOID InBuffer', ' ULONG InBufferLen', ' PVOID OutBuffer', ' ULONG OutBufferLen', ' PULONG ReturnLength']
+case 385: {
+if (PPP_CHECK_CB(on_NtTraceControl_enter) || PPP_CHECK_CB(on_NtTraceControl_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+uint32_t arg4 = get_32(env, 4);
+target_ulong arg5 = get_64(env, 5);
+if (PPP_CHECK_CB(on_NtTraceControl_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+memcpy(rp.params[5], &arg5, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtTraceControl_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
+}; break;
+// 386 NTSTATUS NtTranslateFilePath ['PFILE_PATH InputFilePath', ' ULONG OutputType', ' PFILE_PATH OutputFilePath', ' PULONG OutputFilePathLength']
+case 386: {
+if (PPP_CHECK_CB(on_NtTranslateFilePath_enter) || PPP_CHECK_CB(on_NtTranslateFilePath_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_NtTranslateFilePath_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtTranslateFilePath_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 387 NTSTATUS NtUmsThreadYield ['PVOID SchedulerParam']
+case 387: {
+if (PPP_CHECK_CB(on_NtUmsThreadYield_enter) || PPP_CHECK_CB(on_NtUmsThreadYield_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtUmsThreadYield_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtUmsThreadYield_enter, env,pc,arg0) ; 
+}
+}; break;
+// 388 NTSTATUS NtUnloadDriver ['PUNICODE_STRING DriverServiceName']
+case 388: {
+if (PPP_CHECK_CB(on_NtUnloadDriver_enter) || PPP_CHECK_CB(on_NtUnloadDriver_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtUnloadDriver_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtUnloadDriver_enter, env,pc,arg0) ; 
+}
+}; break;
+// 389 NTSTATUS NtUnloadKey ['POBJECT_ATTRIBUTES TargetKey']
+case 389: {
+if (PPP_CHECK_CB(on_NtUnloadKey_enter) || PPP_CHECK_CB(on_NtUnloadKey_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtUnloadKey_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtUnloadKey_enter, env,pc,arg0) ; 
+}
+}; break;
+// 390 NTSTATUS NtUnloadKey2 ['POBJECT_ATTRIBUTES TargetKey', ' ULONG Flags']
+case 390: {
+if (PPP_CHECK_CB(on_NtUnloadKey2_enter) || PPP_CHECK_CB(on_NtUnloadKey2_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+if (PPP_CHECK_CB(on_NtUnloadKey2_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtUnloadKey2_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 391 NTSTATUS NtUnloadKeyEx ['POBJECT_ATTRIBUTES TargetKey', ' HANDLE Event']
+case 391: {
+if (PPP_CHECK_CB(on_NtUnloadKeyEx_enter) || PPP_CHECK_CB(on_NtUnloadKeyEx_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtUnloadKeyEx_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtUnloadKeyEx_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 392 NTSTATUS NtUnlockFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PLARGE_INTEGER ByteOffset', ' PLARGE_INTEGER Length', ' ULONG Key']
+case 392: {
+if (PPP_CHECK_CB(on_NtUnlockFile_enter) || PPP_CHECK_CB(on_NtUnlockFile_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+uint32_t arg4 = get_32(env, 4);
+if (PPP_CHECK_CB(on_NtUnlockFile_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+memcpy(rp.params[4], &arg4, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtUnlockFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
+}; break;
+// 393 NTSTATUS NtUnlockVirtualMemory ['HANDLE ProcessHandle', ' PVOID *BaseAddress', ' PSIZE_T RegionSize', ' ULONG MapType']
+case 393: {
+if (PPP_CHECK_CB(on_NtUnlockVirtualMemory_enter) || PPP_CHECK_CB(on_NtUnlockVirtualMemory_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+target_ulong arg2 = get_64(env, 2);
+uint32_t arg3 = get_32(env, 3);
+if (PPP_CHECK_CB(on_NtUnlockVirtualMemory_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtUnlockVirtualMemory_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 394 NTSTATUS NtVdmControl ['VDMSERVICECLASS Service', ' PVOID ServiceData']
+case 394: {
+if (PPP_CHECK_CB(on_NtVdmControl_enter) || PPP_CHECK_CB(on_NtVdmControl_return)) {
+uint32_t arg0 = get_32(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtVdmControl_return)) {
+memcpy(rp.params[0], &arg0, sizeof(uint32_t));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtVdmControl_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 395 NTSTATUS NtWaitForDebugEvent ['HANDLE DebugObjectHandle', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout', ' PDBGUI_WAIT_STATE_CHANGE WaitStateChange']
+case 395: {
+if (PPP_CHECK_CB(on_NtWaitForDebugEvent_enter) || PPP_CHECK_CB(on_NtWaitForDebugEvent_return)) {
+target_ulong arg0 = get_64(env, 0);
+uint32_t arg1 = get_32(env, 1);
+target_ulong arg2 = get_64(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_NtWaitForDebugEvent_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(uint32_t));
+memcpy(rp.params[2], &arg2, sizeof(target_ulong));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtWaitForDebugEvent_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 396 NTSTATUS NtWaitForKeyedEvent ['HANDLE KeyedEventHandle', ' PVOID KeyValue', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout']
+case 396: {
+if (PPP_CHECK_CB(on_NtWaitForKeyedEvent_enter) || PPP_CHECK_CB(on_NtWaitForKeyedEvent_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+uint32_t arg2 = get_32(env, 2);
+target_ulong arg3 = get_64(env, 3);
+if (PPP_CHECK_CB(on_NtWaitForKeyedEvent_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+memcpy(rp.params[2], &arg2, sizeof(uint32_t));
+memcpy(rp.params[3], &arg3, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtWaitForKeyedEvent_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+}
+}; break;
+// 397 NTSTATUS NtWaitForWorkViaWorkerFactory ['HANDLE WorkerFactoryHandle', ' PFILE_IO_COMPLETION_INFORMATION MiniPacket']
+case 397: {
+if (PPP_CHECK_CB(on_NtWaitForWorkViaWorkerFactory_enter) || PPP_CHECK_CB(on_NtWaitForWorkViaWorkerFactory_return)) {
+target_ulong arg0 = get_64(env, 0);
+target_ulong arg1 = get_64(env, 1);
+if (PPP_CHECK_CB(on_NtWaitForWorkViaWorkerFactory_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+memcpy(rp.params[1], &arg1, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtWaitForWorkViaWorkerFactory_enter, env,pc,arg0,arg1) ; 
+}
+}; break;
+// 398 NTSTATUS NtWaitHighEventPair ['HANDLE EventPairHandle']
+case 398: {
+if (PPP_CHECK_CB(on_NtWaitHighEventPair_enter) || PPP_CHECK_CB(on_NtWaitHighEventPair_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtWaitHighEventPair_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtWaitHighEventPair_enter, env,pc,arg0) ; 
+}
+}; break;
+// 399 NTSTATUS NtWaitLowEventPair ['HANDLE EventPairHandle']
+case 399: {
+if (PPP_CHECK_CB(on_NtWaitLowEventPair_enter) || PPP_CHECK_CB(on_NtWaitLowEventPair_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtWaitLowEventPair_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtWaitLowEventPair_enter, env,pc,arg0) ; 
+}
+}; break;
+// 400 NTSTATUS NtWorkerFactoryWorkerReady ['HANDLE WorkerFactoryHandle']
+case 400: {
+if (PPP_CHECK_CB(on_NtWorkerFactoryWorkerReady_enter) || PPP_CHECK_CB(on_NtWorkerFactoryWorkerReady_return)) {
+target_ulong arg0 = get_64(env, 0);
+if (PPP_CHECK_CB(on_NtWorkerFactoryWorkerReady_return)) {
+memcpy(rp.params[0], &arg0, sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtWorkerFactoryWorkerReady_enter, env,pc,arg0) ; 
+}
+}; break;
+default:
+PPP_RUN_CB(on_unknown_sys_enter, env, pc, EAX);
+}
+PPP_RUN_CB(on_all_sys_enter, env, pc, EAX);
+appendReturnPoint(rp);
+#endif
+ } 
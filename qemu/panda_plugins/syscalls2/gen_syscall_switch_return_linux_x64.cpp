@@ -0,0 +1,3434 @@
+
+
+extern "C" {
+#include "panda_plugin.h" 
+}
+
+#include "syscalls2.h" 
+#include "panda_common.h"
+#include "panda_plugin_plugin.h"
+
+extern "C" {
+#include "gen_syscalls_ext_typedefs.h"
+#include "gen_syscall_ppp_extern_return.h"
+}
+
+void syscall_return_switch_linux_x64 ( CPUState *env, target_ulong pc, target_ulong ordinal, ReturnPoint &rp) {  // osarch
+#ifdef TARGET_X86_64                                          // GUARD
+    switch( ordinal ) {                          // CALLNO
+// 0 long sys_read ['unsigned int fd', ' char __user *buf', ' size_t count']
+case 0: {
+uint32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_read_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_read_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 1 long sys_write ['unsigned int fd', ' const char __user *buf', 'size_t count']
+case 1: {
+uint32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_write_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_write_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 2 long sys_open ['const char __user *filename', 'int flags', ' int mode']
+case 2: {
+target_ulong arg0;
+int32_t arg1;
+int32_t arg2;
+if (PPP_CHECK_CB(on_sys_open_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_open_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 3 long sys_close ['unsigned int fd']
+case 3: {
+uint32_t arg0;
+if (PPP_CHECK_CB(on_sys_close_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_close_return, env,pc,arg0) ; 
+}; break;
+// 4 long sys_newstat ['const char __user *filename', 'struct stat __user *statbuf']
+case 4: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_newstat_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_newstat_return, env,pc,arg0,arg1) ; 
+}; break;
+// 5 long sys_newfstat ['unsigned int fd', ' struct stat __user *statbuf']
+case 5: {
+uint32_t arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_newfstat_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_newfstat_return, env,pc,arg0,arg1) ; 
+}; break;
+// 6 long sys_newlstat ['const char __user *filename', 'struct stat __user *statbuf']
+case 6: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_newlstat_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_newlstat_return, env,pc,arg0,arg1) ; 
+}; break;
+// 7 long sys_poll ['struct pollfd __user *ufds', ' unsigned int nfds', 'long timeout']
+case 7: {
+target_ulong arg0;
+uint32_t arg1;
+target_long arg2;
+if (PPP_CHECK_CB(on_sys_poll_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_long));
+}
+PPP_RUN_CB(on_sys_poll_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 8 long sys_lseek ['unsigned int fd', ' off_t offset', 'unsigned int origin']
+case 8: {
+uint32_t arg0;
+target_ulong arg1;
+uint32_t arg2;
+if (PPP_CHECK_CB(on_sys_lseek_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_lseek_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 9 long sys_mmap ['unsigned long addr', ' unsigned long len', ' unsigned long prot', ' unsigned long flags', ' unsigned long fd', ' unsigned long off']
+case 9: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_sys_mmap_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_mmap_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 10 long sys_mprotect ['unsigned long start', ' size_t len', 'unsigned long prot']
+case 10: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_mprotect_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_mprotect_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 11 long sys_munmap ['unsigned long addr', ' size_t len']
+case 11: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_munmap_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_munmap_return, env,pc,arg0,arg1) ; 
+}; break;
+// 12 long sys_brk ['unsigned long brk']
+case 12: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_sys_brk_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_brk_return, env,pc,arg0) ; 
+}; break;
+// 13 long rt_sigaction ['int sig', ' const struct sigaction __user * act', ' struct sigaction __user * oact', '  size_t sigsetsize']
+case 13: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_rt_sigaction_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_rt_sigaction_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 14 long sys_rt_sigprocmask ['int how', ' sigset_t __user *set', 'sigset_t __user *oset', ' size_t sigsetsize']
+case 14: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_sys_rt_sigprocmask_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_rt_sigprocmask_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 15 int sys_rt_sigreturn ['unsigned long __unused']
+case 15: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_sys_rt_sigreturn_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_rt_sigreturn_return, env,pc,arg0) ; 
+}; break;
+// 16 long sys_ioctl ['unsigned int fd', ' unsigned int cmd', 'unsigned long arg']
+case 16: {
+uint32_t arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_ioctl_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_ioctl_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 17 long sys_pread64 ['unsigned int fd', ' char __user *buf', 'size_t count', ' loff_t pos']
+case 17: {
+uint32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+uint64_t arg3;
+if (PPP_CHECK_CB(on_sys_pread64_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint64_t));
+}
+PPP_RUN_CB(on_sys_pread64_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 18 long sys_pwrite64 ['unsigned int fd', ' const char __user *buf', 'size_t count', ' loff_t pos']
+case 18: {
+uint32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+uint64_t arg3;
+if (PPP_CHECK_CB(on_sys_pwrite64_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint64_t));
+}
+PPP_RUN_CB(on_sys_pwrite64_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 19 long sys_readv ['unsigned long fd', 'const struct iovec __user *vec', 'unsigned long vlen']
+case 19: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_readv_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_readv_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 20 long sys_writev ['unsigned long fd', 'const struct iovec __user *vec', 'unsigned long vlen']
+case 20: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_writev_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_writev_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 21 long sys_access ['const char __user *filename', ' int mode']
+case 21: {
+target_ulong arg0;
+int32_t arg1;
+if (PPP_CHECK_CB(on_sys_access_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_access_return, env,pc,arg0,arg1) ; 
+}; break;
+// 22 long sys_pipe ['int __user *fildes']
+case 22: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_sys_pipe_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_pipe_return, env,pc,arg0) ; 
+}; break;
+// 23 long sys_select ['int n', ' fd_set __user *inp', ' fd_set __user *outp', 'fd_set __user *exp', ' struct timeval __user *tvp']
+case 23: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_sys_select_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_select_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 24 long sys_sched_yield ['void']
+case 24: {
+if (PPP_CHECK_CB(on_sys_sched_yield_return)) {
+}
+PPP_RUN_CB(on_sys_sched_yield_return, env,pc) ; 
+}; break;
+// 25 long sys_mremap ['unsigned long addr', 'unsigned long old_len', ' unsigned long new_len', 'unsigned long flags', ' unsigned long new_addr']
+case 25: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_sys_mremap_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_mremap_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 26 long sys_msync ['unsigned long start', ' size_t len', ' int flags']
+case 26: {
+target_ulong arg0;
+target_ulong arg1;
+int32_t arg2;
+if (PPP_CHECK_CB(on_sys_msync_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_msync_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 27 long sys_mincore ['unsigned long start', ' size_t len', 'unsigned char __user * vec']
+case 27: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_mincore_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_mincore_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 28 long sys_madvise ['unsigned long start', ' size_t len', ' int behavior']
+case 28: {
+target_ulong arg0;
+target_ulong arg1;
+int32_t arg2;
+if (PPP_CHECK_CB(on_sys_madvise_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_madvise_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 29 long sys_shmget ['key_t key', ' size_t size', ' int flag']
+case 29: {
+uint32_t arg0;
+target_ulong arg1;
+int32_t arg2;
+if (PPP_CHECK_CB(on_sys_shmget_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_shmget_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 30 long sys_shmat ['int shmid', ' char __user *shmaddr', ' int shmflg']
+case 30: {
+int32_t arg0;
+target_ulong arg1;
+int32_t arg2;
+if (PPP_CHECK_CB(on_sys_shmat_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_shmat_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 31 long sys_shmctl ['int shmid', ' int cmd', ' struct shmid_ds __user *buf']
+case 31: {
+int32_t arg0;
+int32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_shmctl_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_shmctl_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 32 long sys_dup ['unsigned int fildes']
+case 32: {
+uint32_t arg0;
+if (PPP_CHECK_CB(on_sys_dup_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_dup_return, env,pc,arg0) ; 
+}; break;
+// 33 long sys_dup2 ['unsigned int oldfd', ' unsigned int newfd']
+case 33: {
+uint32_t arg0;
+uint32_t arg1;
+if (PPP_CHECK_CB(on_sys_dup2_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_dup2_return, env,pc,arg0,arg1) ; 
+}; break;
+// 34 long sys_pause ['void']
+case 34: {
+if (PPP_CHECK_CB(on_sys_pause_return)) {
+}
+PPP_RUN_CB(on_sys_pause_return, env,pc) ; 
+}; break;
+// 35 long sys_nanosleep ['struct timespec __user *rqtp', ' struct timespec __user *rmtp']
+case 35: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_nanosleep_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_nanosleep_return, env,pc,arg0,arg1) ; 
+}; break;
+// 36 long sys_getitimer ['int which', ' struct itimerval __user *value']
+case 36: {
+int32_t arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_getitimer_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_getitimer_return, env,pc,arg0,arg1) ; 
+}; break;
+// 37 long sys_alarm ['unsigned int seconds']
+case 37: {
+uint32_t arg0;
+if (PPP_CHECK_CB(on_sys_alarm_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_alarm_return, env,pc,arg0) ; 
+}; break;
+// 38 long sys_setitimer ['int which', 'struct itimerval __user *value', 'struct itimerval __user *ovalue']
+case 38: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_setitimer_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_setitimer_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 39 long sys_getpid ['void']
+case 39: {
+if (PPP_CHECK_CB(on_sys_getpid_return)) {
+}
+PPP_RUN_CB(on_sys_getpid_return, env,pc) ; 
+}; break;
+// 40 long sys_sendfile64 ['int out_fd', ' int in_fd', 'loff_t __user *offset', ' size_t count']
+case 40: {
+int32_t arg0;
+int32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_sys_sendfile64_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_sendfile64_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 41 long sys_socket ['int', ' int', ' int']
+case 41: {
+int32_t arg0;
+int32_t arg1;
+int32_t arg2;
+if (PPP_CHECK_CB(on_sys_socket_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_socket_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 42 long sys_connect ['int', ' struct sockaddr __user *', ' int']
+case 42: {
+int32_t arg0;
+target_ulong arg1;
+int32_t arg2;
+if (PPP_CHECK_CB(on_sys_connect_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_connect_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 43 long sys_accept ['int', ' struct sockaddr __user *', ' int __user *']
+case 43: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_accept_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_accept_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 44 long sys_sendto ['int', ' void __user *', ' size_t', ' unsigned', 'struct sockaddr __user *', ' int']
+case 44: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+int32_t arg5;
+if (PPP_CHECK_CB(on_sys_sendto_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_sendto_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 45 long sys_recvfrom ['int', ' void __user *', ' size_t', ' unsigned', 'struct sockaddr __user *', ' int __user *']
+case 45: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_sys_recvfrom_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_recvfrom_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 46 long sys_sendmsg ['int fd', ' struct msghdr __user *msg', ' unsigned flags']
+case 46: {
+int32_t arg0;
+target_ulong arg1;
+uint32_t arg2;
+if (PPP_CHECK_CB(on_sys_sendmsg_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_sendmsg_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 47 long sys_recvmsg ['int fd', ' struct msghdr __user *msg', ' unsigned flags']
+case 47: {
+int32_t arg0;
+target_ulong arg1;
+uint32_t arg2;
+if (PPP_CHECK_CB(on_sys_recvmsg_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_recvmsg_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 48 long sys_shutdown ['int', ' int']
+case 48: {
+int32_t arg0;
+int32_t arg1;
+if (PPP_CHECK_CB(on_sys_shutdown_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_shutdown_return, env,pc,arg0,arg1) ; 
+}; break;
+// 49 long sys_bind ['int', ' struct sockaddr __user *', ' int']
+case 49: {
+int32_t arg0;
+target_ulong arg1;
+int32_t arg2;
+if (PPP_CHECK_CB(on_sys_bind_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_bind_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 50 long sys_listen ['int', ' int']
+case 50: {
+int32_t arg0;
+int32_t arg1;
+if (PPP_CHECK_CB(on_sys_listen_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_listen_return, env,pc,arg0,arg1) ; 
+}; break;
+// 51 long sys_getsockname ['int', ' struct sockaddr __user *', ' int __user *']
+case 51: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_getsockname_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_getsockname_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 52 long sys_getpeername ['int', ' struct sockaddr __user *', ' int __user *']
+case 52: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_getpeername_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_getpeername_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 53 long sys_socketpair ['int', ' int', ' int', ' int __user *']
+case 53: {
+int32_t arg0;
+int32_t arg1;
+int32_t arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_sys_socketpair_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_socketpair_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 54 long sys_setsockopt ['int fd', ' int level', ' int optname', 'char __user *optval', ' int optlen']
+case 54: {
+int32_t arg0;
+int32_t arg1;
+int32_t arg2;
+target_ulong arg3;
+int32_t arg4;
+if (PPP_CHECK_CB(on_sys_setsockopt_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_setsockopt_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 55 long sys_getsockopt ['int fd', ' int level', ' int optname', 'char __user *optval', ' int __user *optlen']
+case 55: {
+int32_t arg0;
+int32_t arg1;
+int32_t arg2;
+target_ulong arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_sys_getsockopt_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_getsockopt_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 56 long sys_clone ['unsigned long flags', ' void *child_stack', ' void *ptid', ' void *ctid', ' unsigned long tls']
+case 56: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_sys_clone_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_clone_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 57 pid_t sys_fork ['']
+case 57: {
+if (PPP_CHECK_CB(on_sys_fork_return)) {
+}
+PPP_RUN_CB(on_sys_fork_return, env,pc) ; 
+}; break;
+// 58 pid_t sys_vfork ['']
+case 58: {
+if (PPP_CHECK_CB(on_sys_vfork_return)) {
+}
+PPP_RUN_CB(on_sys_vfork_return, env,pc) ; 
+}; break;
+// 59 int sys_execve ['const char *filename', ' const char *argv[]', ' const char *const envp[]']
+case 59: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_execve_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_execve_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 60 long sys_exit ['int error_code']
+case 60: {
+int32_t arg0;
+if (PPP_CHECK_CB(on_sys_exit_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_exit_return, env,pc,arg0) ; 
+}; break;
+// 61 long sys_wait4 ['pid_t pid', ' int __user *stat_addr', 'int options', ' struct rusage __user *ru']
+case 61: {
+uint32_t arg0;
+target_ulong arg1;
+int32_t arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_sys_wait4_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_wait4_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 62 long sys_kill ['int pid', ' int sig']
+case 62: {
+int32_t arg0;
+int32_t arg1;
+if (PPP_CHECK_CB(on_sys_kill_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_kill_return, env,pc,arg0,arg1) ; 
+}; break;
+// 63 long sys_newuname ['struct new_utsname __user *name']
+case 63: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_sys_newuname_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_newuname_return, env,pc,arg0) ; 
+}; break;
+// 64 long sys_semget ['key_t key', ' int nsems', ' int semflg']
+case 64: {
+uint32_t arg0;
+int32_t arg1;
+int32_t arg2;
+if (PPP_CHECK_CB(on_sys_semget_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_semget_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 65 long sys_semop ['int semid', ' struct sembuf __user *sops', 'unsigned nsops']
+case 65: {
+int32_t arg0;
+target_ulong arg1;
+uint32_t arg2;
+if (PPP_CHECK_CB(on_sys_semop_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_semop_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 66 long sys_semctl ['int semid', ' int semnum', ' int cmd', ' union semun arg']
+case 66: {
+int32_t arg0;
+int32_t arg1;
+int32_t arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_sys_semctl_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_semctl_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 67 long sys_shmdt ['char __user *shmaddr']
+case 67: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_sys_shmdt_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_shmdt_return, env,pc,arg0) ; 
+}; break;
+// 68 long sys_msgget ['key_t key', ' int msgflg']
+case 68: {
+uint32_t arg0;
+int32_t arg1;
+if (PPP_CHECK_CB(on_sys_msgget_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_msgget_return, env,pc,arg0,arg1) ; 
+}; break;
+// 69 long sys_msgsnd ['int msqid', ' struct msgbuf __user *msgp', 'size_t msgsz', ' int msgflg']
+case 69: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+int32_t arg3;
+if (PPP_CHECK_CB(on_sys_msgsnd_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_msgsnd_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 70 long sys_msgrcv ['int msqid', ' struct msgbuf __user *msgp', 'size_t msgsz', ' long msgtyp', ' int msgflg']
+case 70: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_long arg3;
+int32_t arg4;
+if (PPP_CHECK_CB(on_sys_msgrcv_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_long));
+memcpy(&arg4, rp.params[4], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_msgrcv_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 71 long sys_msgctl ['int msqid', ' int cmd', ' struct msqid_ds __user *buf']
+case 71: {
+int32_t arg0;
+int32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_msgctl_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_msgctl_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 72 long sys_fcntl ['unsigned int fd', ' unsigned int cmd', ' unsigned long arg']
+case 72: {
+uint32_t arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_fcntl_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_fcntl_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 73 long sys_flock ['unsigned int fd', ' unsigned int cmd']
+case 73: {
+uint32_t arg0;
+uint32_t arg1;
+if (PPP_CHECK_CB(on_sys_flock_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_flock_return, env,pc,arg0,arg1) ; 
+}; break;
+// 74 long sys_fsync ['unsigned int fd']
+case 74: {
+uint32_t arg0;
+if (PPP_CHECK_CB(on_sys_fsync_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_fsync_return, env,pc,arg0) ; 
+}; break;
+// 75 long sys_fdatasync ['unsigned int fd']
+case 75: {
+uint32_t arg0;
+if (PPP_CHECK_CB(on_sys_fdatasync_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_fdatasync_return, env,pc,arg0) ; 
+}; break;
+// 76 long sys_truncate ['const char __user *path', ' long length']
+case 76: {
+target_ulong arg0;
+target_long arg1;
+if (PPP_CHECK_CB(on_sys_truncate_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_long));
+}
+PPP_RUN_CB(on_sys_truncate_return, env,pc,arg0,arg1) ; 
+}; break;
+// 77 long sys_ftruncate ['unsigned int fd', ' unsigned long length']
+case 77: {
+uint32_t arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_ftruncate_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_ftruncate_return, env,pc,arg0,arg1) ; 
+}; break;
+// 78 long sys_getdents ['unsigned int fd', 'struct linux_dirent __user *dirent', 'unsigned int count']
+case 78: {
+uint32_t arg0;
+target_ulong arg1;
+uint32_t arg2;
+if (PPP_CHECK_CB(on_sys_getdents_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_getdents_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 79 long sys_getcwd ['char __user *buf', ' unsigned long size']
+case 79: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_getcwd_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_getcwd_return, env,pc,arg0,arg1) ; 
+}; break;
+// 80 long sys_chdir ['const char __user *filename']
+case 80: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_sys_chdir_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_chdir_return, env,pc,arg0) ; 
+}; break;
+// 81 long sys_fchdir ['unsigned int fd']
+case 81: {
+uint32_t arg0;
+if (PPP_CHECK_CB(on_sys_fchdir_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_fchdir_return, env,pc,arg0) ; 
+}; break;
+// 82 long sys_rename ['const char __user *oldname', 'const char __user *newname']
+case 82: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_rename_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_rename_return, env,pc,arg0,arg1) ; 
+}; break;
+// 83 long sys_mkdir ['const char __user *pathname', ' int mode']
+case 83: {
+target_ulong arg0;
+int32_t arg1;
+if (PPP_CHECK_CB(on_sys_mkdir_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_mkdir_return, env,pc,arg0,arg1) ; 
+}; break;
+// 84 long sys_rmdir ['const char __user *pathname']
+case 84: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_sys_rmdir_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_rmdir_return, env,pc,arg0) ; 
+}; break;
+// 85 long sys_creat ['const char __user *pathname', ' int mode']
+case 85: {
+target_ulong arg0;
+int32_t arg1;
+if (PPP_CHECK_CB(on_sys_creat_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_creat_return, env,pc,arg0,arg1) ; 
+}; break;
+// 86 long sys_link ['const char __user *oldname', 'const char __user *newname']
+case 86: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_link_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_link_return, env,pc,arg0,arg1) ; 
+}; break;
+// 87 long sys_unlink ['const char __user *pathname']
+case 87: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_sys_unlink_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_unlink_return, env,pc,arg0) ; 
+}; break;
+// 88 long sys_symlink ['const char __user *old', ' const char __user *new']
+case 88: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_symlink_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_symlink_return, env,pc,arg0,arg1) ; 
+}; break;
+// 89 long sys_readlink ['const char __user *path', 'char __user *buf', ' int bufsiz']
+case 89: {
+target_ulong arg0;
+target_ulong arg1;
+int32_t arg2;
+if (PPP_CHECK_CB(on_sys_readlink_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_readlink_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 90 long sys_chmod ['const char __user *filename', ' mode_t mode']
+case 90: {
+target_ulong arg0;
+uint32_t arg1;
+if (PPP_CHECK_CB(on_sys_chmod_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_chmod_return, env,pc,arg0,arg1) ; 
+}; break;
+// 91 long sys_fchmod ['unsigned int fd', ' mode_t mode']
+case 91: {
+uint32_t arg0;
+uint32_t arg1;
+if (PPP_CHECK_CB(on_sys_fchmod_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_fchmod_return, env,pc,arg0,arg1) ; 
+}; break;
+// 92 long sys_chown ['const char __user *filename', 'uid_t user', ' gid_t group']
+case 92: {
+target_ulong arg0;
+uint32_t arg1;
+uint32_t arg2;
+if (PPP_CHECK_CB(on_sys_chown_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_chown_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 93 long sys_fchown ['unsigned int fd', ' uid_t user', ' gid_t group']
+case 93: {
+uint32_t arg0;
+uint32_t arg1;
+uint32_t arg2;
+if (PPP_CHECK_CB(on_sys_fchown_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_fchown_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 94 long sys_lchown ['const char __user *filename', 'uid_t user', ' gid_t group']
+case 94: {
+target_ulong arg0;
+uint32_t arg1;
+uint32_t arg2;
+if (PPP_CHECK_CB(on_sys_lchown_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_lchown_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 95 long sys_umask ['int mask']
+case 95: {
+int32_t arg0;
+if (PPP_CHECK_CB(on_sys_umask_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_umask_return, env,pc,arg0) ; 
+}; break;
+// 96 long sys_gettimeofday ['struct timeval __user *tv', 'struct timezone __user *tz']
+case 96: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_gettimeofday_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_gettimeofday_return, env,pc,arg0,arg1) ; 
+}; break;
+// 97 long sys_getrlimit ['unsigned int resource', 'struct rlimit __user *rlim']
+case 97: {
+uint32_t arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_getrlimit_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_getrlimit_return, env,pc,arg0,arg1) ; 
+}; break;
+// 98 long sys_getrusage ['int who', ' struct rusage __user *ru']
+case 98: {
+int32_t arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_getrusage_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_getrusage_return, env,pc,arg0,arg1) ; 
+}; break;
+// 99 long sys_sysinfo ['struct sysinfo __user *info']
+case 99: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_sys_sysinfo_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_sysinfo_return, env,pc,arg0) ; 
+}; break;
+// 100 long sys_times ['struct tms __user *tbuf']
+case 100: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_sys_times_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_times_return, env,pc,arg0) ; 
+}; break;
+// 101 long sys_ptrace ['long request', ' long pid', ' unsigned long addr', 'unsigned long data']
+case 101: {
+target_long arg0;
+target_long arg1;
+target_ulong arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_sys_ptrace_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_long));
+memcpy(&arg1, rp.params[1], sizeof(target_long));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_ptrace_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 102 long sys_getuid ['void']
+case 102: {
+if (PPP_CHECK_CB(on_sys_getuid_return)) {
+}
+PPP_RUN_CB(on_sys_getuid_return, env,pc) ; 
+}; break;
+// 103 long sys_syslog ['int type', ' char __user *buf', ' int len']
+case 103: {
+int32_t arg0;
+target_ulong arg1;
+int32_t arg2;
+if (PPP_CHECK_CB(on_sys_syslog_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_syslog_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 104 long sys_getgid ['void']
+case 104: {
+if (PPP_CHECK_CB(on_sys_getgid_return)) {
+}
+PPP_RUN_CB(on_sys_getgid_return, env,pc) ; 
+}; break;
+// 105 long sys_setuid ['uid_t uid']
+case 105: {
+uint32_t arg0;
+if (PPP_CHECK_CB(on_sys_setuid_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_setuid_return, env,pc,arg0) ; 
+}; break;
+// 106 long sys_setgid ['gid_t gid']
+case 106: {
+uint32_t arg0;
+if (PPP_CHECK_CB(on_sys_setgid_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_setgid_return, env,pc,arg0) ; 
+}; break;
+// 107 long sys_geteuid ['void']
+case 107: {
+if (PPP_CHECK_CB(on_sys_geteuid_return)) {
+}
+PPP_RUN_CB(on_sys_geteuid_return, env,pc) ; 
+}; break;
+// 108 long sys_getegid ['void']
+case 108: {
+if (PPP_CHECK_CB(on_sys_getegid_return)) {
+}
+PPP_RUN_CB(on_sys_getegid_return, env,pc) ; 
+}; break;
+// 109 long sys_setpgid ['pid_t pid', ' pid_t pgid']
+case 109: {
+uint32_t arg0;
+uint32_t arg1;
+if (PPP_CHECK_CB(on_sys_setpgid_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_setpgid_return, env,pc,arg0,arg1) ; 
+}; break;
+// 110 long sys_getppid ['void']
+case 110: {
+if (PPP_CHECK_CB(on_sys_getppid_return)) {
+}
+PPP_RUN_CB(on_sys_getppid_return, env,pc) ; 
+}; break;
+// 111 long sys_getpgrp ['void']
+case 111: {
+if (PPP_CHECK_CB(on_sys_getpgrp_return)) {
+}
+PPP_RUN_CB(on_sys_getpgrp_return, env,pc) ; 
+}; break;
+// 112 long sys_setsid ['void']
+case 112: {
+if (PPP_CHECK_CB(on_sys_setsid_return)) {
+}
+PPP_RUN_CB(on_sys_setsid_return, env,pc) ; 
+}; break;
+// 113 long sys_setreuid ['uid_t ruid', ' uid_t euid']
+case 113: {
+uint32_t arg0;
+uint32_t arg1;
+if (PPP_CHECK_CB(on_sys_setreuid_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_setreuid_return, env,pc,arg0,arg1) ; 
+}; break;
+// 114 long sys_setregid ['gid_t rgid', ' gid_t egid']
+case 114: {
+uint32_t arg0;
+uint32_t arg1;
+if (PPP_CHECK_CB(on_sys_setregid_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_setregid_return, env,pc,arg0,arg1) ; 
+}; break;
+// 115 long sys_getgroups ['int gidsetsize', ' gid_t __user *grouplist']
+case 115: {
+int32_t arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_getgroups_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_getgroups_return, env,pc,arg0,arg1) ; 
+}; break;
+// 116 long sys_setgroups ['int gidsetsize', ' gid_t __user *grouplist']
+case 116: {
+int32_t arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_setgroups_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_setgroups_return, env,pc,arg0,arg1) ; 
+}; break;
+// 117 long sys_setresuid ['uid_t ruid', ' uid_t euid', ' uid_t suid']
+case 117: {
+uint32_t arg0;
+uint32_t arg1;
+uint32_t arg2;
+if (PPP_CHECK_CB(on_sys_setresuid_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_setresuid_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 118 long sys_getresuid ['uid_t __user *ruid', ' uid_t __user *euid', ' uid_t __user *suid']
+case 118: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_getresuid_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_getresuid_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 119 long sys_setresgid ['gid_t rgid', ' gid_t egid', ' gid_t sgid']
+case 119: {
+uint32_t arg0;
+uint32_t arg1;
+uint32_t arg2;
+if (PPP_CHECK_CB(on_sys_setresgid_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_setresgid_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 120 long sys_getresgid ['gid_t __user *rgid', ' gid_t __user *egid', ' gid_t __user *sgid']
+case 120: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_getresgid_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_getresgid_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 121 long sys_getpgid ['pid_t pid']
+case 121: {
+uint32_t arg0;
+if (PPP_CHECK_CB(on_sys_getpgid_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_getpgid_return, env,pc,arg0) ; 
+}; break;
+// 122 long sys_setfsuid ['uid_t uid']
+case 122: {
+uint32_t arg0;
+if (PPP_CHECK_CB(on_sys_setfsuid_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_setfsuid_return, env,pc,arg0) ; 
+}; break;
+// 123 long sys_setfsgid ['gid_t gid']
+case 123: {
+uint32_t arg0;
+if (PPP_CHECK_CB(on_sys_setfsgid_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_setfsgid_return, env,pc,arg0) ; 
+}; break;
+// 124 long sys_getsid ['pid_t pid']
+case 124: {
+uint32_t arg0;
+if (PPP_CHECK_CB(on_sys_getsid_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_getsid_return, env,pc,arg0) ; 
+}; break;
+// 125 long sys_capget ['cap_user_header_t header', 'cap_user_data_t dataptr']
+case 125: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_capget_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_capget_return, env,pc,arg0,arg1) ; 
+}; break;
+// 126 long sys_capset ['cap_user_header_t header', 'const cap_user_data_t data']
+case 126: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_capset_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_capset_return, env,pc,arg0,arg1) ; 
+}; break;
+// 127 long sys_rt_sigpending ['sigset_t __user *set', ' size_t sigsetsize']
+case 127: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_rt_sigpending_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_rt_sigpending_return, env,pc,arg0,arg1) ; 
+}; break;
+// 128 long sys_rt_sigtimedwait ['const sigset_t __user *uthese', 'siginfo_t __user *uinfo', 'const struct timespec __user *uts', 'size_t sigsetsize']
+case 128: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_sys_rt_sigtimedwait_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_rt_sigtimedwait_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 129 long sys_rt_sigqueueinfo ['int pid', ' int sig', ' siginfo_t __user *uinfo']
+case 129: {
+int32_t arg0;
+int32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_rt_sigqueueinfo_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_rt_sigqueueinfo_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 130 int sys_rt_sigsuspend ['sigset_t __user *unewset', ' size_t sigsetsize']
+case 130: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_rt_sigsuspend_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_rt_sigsuspend_return, env,pc,arg0,arg1) ; 
+}; break;
+// 131 int sys_sigaltstack ['const stack_t *ss', ' stack_t *oss']
+case 131: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_sigaltstack_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_sigaltstack_return, env,pc,arg0,arg1) ; 
+}; break;
+// 132 long sys_utime ['char __user *filename', 'struct utimbuf __user *times']
+case 132: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_utime_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_utime_return, env,pc,arg0,arg1) ; 
+}; break;
+// 133 long sys_mknod ['const char __user *filename', ' int mode', 'unsigned dev']
+case 133: {
+target_ulong arg0;
+int32_t arg1;
+uint32_t arg2;
+if (PPP_CHECK_CB(on_sys_mknod_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_mknod_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 134 long sys_uselib ['const char __user *library']
+case 134: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_sys_uselib_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_uselib_return, env,pc,arg0) ; 
+}; break;
+// 135 long sys_personality ['unsigned int personality']
+case 135: {
+uint32_t arg0;
+if (PPP_CHECK_CB(on_sys_personality_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_personality_return, env,pc,arg0) ; 
+}; break;
+// 136 long sys_ustat ['unsigned dev', ' struct ustat __user *ubuf']
+case 136: {
+uint32_t arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_ustat_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_ustat_return, env,pc,arg0,arg1) ; 
+}; break;
+// 137 long sys_statfs ['const char __user * path', 'struct statfs __user *buf']
+case 137: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_statfs_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_statfs_return, env,pc,arg0,arg1) ; 
+}; break;
+// 138 long sys_fstatfs ['unsigned int fd', ' struct statfs __user *buf']
+case 138: {
+uint32_t arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_fstatfs_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_fstatfs_return, env,pc,arg0,arg1) ; 
+}; break;
+// 139 long sys_sysfs ['int option', 'unsigned long arg1', ' unsigned long arg2']
+case 139: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_sysfs_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_sysfs_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 140 long sys_getpriority ['int which', ' int who']
+case 140: {
+int32_t arg0;
+int32_t arg1;
+if (PPP_CHECK_CB(on_sys_getpriority_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_getpriority_return, env,pc,arg0,arg1) ; 
+}; break;
+// 141 long sys_setpriority ['int which', ' int who', ' int niceval']
+case 141: {
+int32_t arg0;
+int32_t arg1;
+int32_t arg2;
+if (PPP_CHECK_CB(on_sys_setpriority_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_setpriority_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 142 long sys_sched_setparam ['pid_t pid', 'struct sched_param __user *param']
+case 142: {
+uint32_t arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_sched_setparam_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_sched_setparam_return, env,pc,arg0,arg1) ; 
+}; break;
+// 143 long sys_sched_getparam ['pid_t pid', 'struct sched_param __user *param']
+case 143: {
+uint32_t arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_sched_getparam_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_sched_getparam_return, env,pc,arg0,arg1) ; 
+}; break;
+// 144 long sys_sched_setscheduler ['pid_t pid', ' int policy', 'struct sched_param __user *param']
+case 144: {
+uint32_t arg0;
+int32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_sched_setscheduler_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_sched_setscheduler_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 145 long sys_sched_getscheduler ['pid_t pid']
+case 145: {
+uint32_t arg0;
+if (PPP_CHECK_CB(on_sys_sched_getscheduler_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_sched_getscheduler_return, env,pc,arg0) ; 
+}; break;
+// 146 long sys_sched_get_priority_max ['int policy']
+case 146: {
+int32_t arg0;
+if (PPP_CHECK_CB(on_sys_sched_get_priority_max_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_sched_get_priority_max_return, env,pc,arg0) ; 
+}; break;
+// 147 long sys_sched_get_priority_min ['int policy']
+case 147: {
+int32_t arg0;
+if (PPP_CHECK_CB(on_sys_sched_get_priority_min_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_sched_get_priority_min_return, env,pc,arg0) ; 
+}; break;
+// 148 long sys_sched_rr_get_interval ['pid_t pid', 'struct timespec __user *interval']
+case 148: {
+uint32_t arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_sched_rr_get_interval_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_sched_rr_get_interval_return, env,pc,arg0,arg1) ; 
+}; break;
+// 149 long sys_mlock ['unsigned long start', ' size_t len']
+case 149: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_mlock_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_mlock_return, env,pc,arg0,arg1) ; 
+}; break;
+// 150 long sys_munlock ['unsigned long start', ' size_t len']
+case 150: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_munlock_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_munlock_return, env,pc,arg0,arg1) ; 
+}; break;
+// 151 long sys_mlockall ['int flags']
+case 151: {
+int32_t arg0;
+if (PPP_CHECK_CB(on_sys_mlockall_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_mlockall_return, env,pc,arg0) ; 
+}; break;
+// 152 long sys_munlockall ['void']
+case 152: {
+if (PPP_CHECK_CB(on_sys_munlockall_return)) {
+}
+PPP_RUN_CB(on_sys_munlockall_return, env,pc) ; 
+}; break;
+// 153 long sys_vhangup ['void']
+case 153: {
+if (PPP_CHECK_CB(on_sys_vhangup_return)) {
+}
+PPP_RUN_CB(on_sys_vhangup_return, env,pc) ; 
+}; break;
+// 154 int sys_modify_ldt ['int func', ' void *ptr', ' unsigned long bytecount']
+case 154: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_modify_ldt_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_modify_ldt_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 155 long sys_pivot_root ['const char __user *new_root', 'const char __user *put_old']
+case 155: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_pivot_root_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_pivot_root_return, env,pc,arg0,arg1) ; 
+}; break;
+// 156 long sys_sysctl ['struct __sysctl_args __user *args']
+case 156: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_sys_sysctl_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_sysctl_return, env,pc,arg0) ; 
+}; break;
+// 157 long sys_prctl ['int option', ' unsigned long arg2', ' unsigned long arg3', 'unsigned long arg4', ' unsigned long arg5']
+case 157: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_sys_prctl_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_prctl_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 158 long sys_arch_prctl ['int code', ' unsigned long addr']
+case 158: {
+int32_t arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_arch_prctl_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_arch_prctl_return, env,pc,arg0,arg1) ; 
+}; break;
+// 159 long sys_adjtimex ['struct timex __user *txc_p']
+case 159: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_sys_adjtimex_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_adjtimex_return, env,pc,arg0) ; 
+}; break;
+// 160 long sys_setrlimit ['unsigned int resource', 'struct rlimit __user *rlim']
+case 160: {
+uint32_t arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_setrlimit_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_setrlimit_return, env,pc,arg0,arg1) ; 
+}; break;
+// 161 long sys_chroot ['const char __user *filename']
+case 161: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_sys_chroot_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_chroot_return, env,pc,arg0) ; 
+}; break;
+// 162 long sys_sync ['void']
+case 162: {
+if (PPP_CHECK_CB(on_sys_sync_return)) {
+}
+PPP_RUN_CB(on_sys_sync_return, env,pc) ; 
+}; break;
+// 163 long sys_acct ['const char __user *name']
+case 163: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_sys_acct_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_acct_return, env,pc,arg0) ; 
+}; break;
+// 164 long sys_settimeofday ['struct timeval __user *tv', 'struct timezone __user *tz']
+case 164: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_settimeofday_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_settimeofday_return, env,pc,arg0,arg1) ; 
+}; break;
+// 165 long sys_mount ['char __user *dev_name', ' char __user *dir_name', 'char __user *type', ' unsigned long flags', 'void __user *data']
+case 165: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_sys_mount_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_mount_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 166 long sys_umount ['char __user *name', ' int flags']
+case 166: {
+target_ulong arg0;
+int32_t arg1;
+if (PPP_CHECK_CB(on_sys_umount_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_umount_return, env,pc,arg0,arg1) ; 
+}; break;
+// 167 long sys_swapon ['const char __user *specialfile', ' int swap_flags']
+case 167: {
+target_ulong arg0;
+int32_t arg1;
+if (PPP_CHECK_CB(on_sys_swapon_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_swapon_return, env,pc,arg0,arg1) ; 
+}; break;
+// 168 long sys_swapoff ['const char __user *specialfile']
+case 168: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_sys_swapoff_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_swapoff_return, env,pc,arg0) ; 
+}; break;
+// 169 long sys_reboot ['int magic1', ' int magic2', ' unsigned int cmd', 'void __user *arg']
+case 169: {
+int32_t arg0;
+int32_t arg1;
+uint32_t arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_sys_reboot_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_reboot_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 170 long sys_sethostname ['char __user *name', ' int len']
+case 170: {
+target_ulong arg0;
+int32_t arg1;
+if (PPP_CHECK_CB(on_sys_sethostname_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_sethostname_return, env,pc,arg0,arg1) ; 
+}; break;
+// 171 long sys_setdomainname ['char __user *name', ' int len']
+case 171: {
+target_ulong arg0;
+int32_t arg1;
+if (PPP_CHECK_CB(on_sys_setdomainname_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_setdomainname_return, env,pc,arg0,arg1) ; 
+}; break;
+// 172 int sys_iopl ['int level']
+case 172: {
+int32_t arg0;
+if (PPP_CHECK_CB(on_sys_iopl_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_iopl_return, env,pc,arg0) ; 
+}; break;
+// 173 long sys_ioperm ['unsigned long from', ' unsigned long num', ' int on']
+case 173: {
+target_ulong arg0;
+target_ulong arg1;
+int32_t arg2;
+if (PPP_CHECK_CB(on_sys_ioperm_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_ioperm_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 175 long sys_init_module ['void __user *umod', ' unsigned long len', 'const char __user *uargs']
+case 175: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_init_module_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_init_module_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 176 long sys_delete_module ['const char __user *name_user', 'unsigned int flags']
+case 176: {
+target_ulong arg0;
+uint32_t arg1;
+if (PPP_CHECK_CB(on_sys_delete_module_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_delete_module_return, env,pc,arg0,arg1) ; 
+}; break;
+// 179 long sys_quotactl ['unsigned int cmd', ' const char __user *special', 'qid_t id', ' void __user *addr']
+case 179: {
+uint32_t arg0;
+target_ulong arg1;
+uint32_t arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_sys_quotactl_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_quotactl_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 180 long sys_nfsservctl ['int cmd', 'struct nfsctl_arg __user *arg', 'void __user *res']
+case 180: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_nfsservctl_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_nfsservctl_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 186 long sys_gettid ['void']
+case 186: {
+if (PPP_CHECK_CB(on_sys_gettid_return)) {
+}
+PPP_RUN_CB(on_sys_gettid_return, env,pc) ; 
+}; break;
+// 187 long sys_readahead ['int fd', ' loff_t offset', ' size_t count']
+case 187: {
+int32_t arg0;
+uint64_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_readahead_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint64_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_readahead_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 188 long sys_setxattr ['const char __user *path', ' const char __user *name', 'const void __user *value', ' size_t size', ' int flags']
+case 188: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+int32_t arg4;
+if (PPP_CHECK_CB(on_sys_setxattr_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_setxattr_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 189 long sys_lsetxattr ['const char __user *path', ' const char __user *name', 'const void __user *value', ' size_t size', ' int flags']
+case 189: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+int32_t arg4;
+if (PPP_CHECK_CB(on_sys_lsetxattr_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_lsetxattr_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 190 long sys_fsetxattr ['int fd', ' const char __user *name', 'const void __user *value', ' size_t size', ' int flags']
+case 190: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+int32_t arg4;
+if (PPP_CHECK_CB(on_sys_fsetxattr_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_fsetxattr_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 191 long sys_getxattr ['const char __user *path', ' const char __user *name', 'void __user *value', ' size_t size']
+case 191: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_sys_getxattr_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_getxattr_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 192 long sys_lgetxattr ['const char __user *path', ' const char __user *name', 'void __user *value', ' size_t size']
+case 192: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_sys_lgetxattr_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_lgetxattr_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 193 long sys_fgetxattr ['int fd', ' const char __user *name', 'void __user *value', ' size_t size']
+case 193: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_sys_fgetxattr_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_fgetxattr_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 194 long sys_listxattr ['const char __user *path', ' char __user *list', 'size_t size']
+case 194: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_listxattr_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_listxattr_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 195 long sys_llistxattr ['const char __user *path', ' char __user *list', 'size_t size']
+case 195: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_llistxattr_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_llistxattr_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 196 long sys_flistxattr ['int fd', ' char __user *list', ' size_t size']
+case 196: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_flistxattr_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_flistxattr_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 197 long sys_removexattr ['const char __user *path', 'const char __user *name']
+case 197: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_removexattr_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_removexattr_return, env,pc,arg0,arg1) ; 
+}; break;
+// 198 long sys_lremovexattr ['const char __user *path', 'const char __user *name']
+case 198: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_lremovexattr_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_lremovexattr_return, env,pc,arg0,arg1) ; 
+}; break;
+// 199 long sys_fremovexattr ['int fd', ' const char __user *name']
+case 199: {
+int32_t arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_fremovexattr_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_fremovexattr_return, env,pc,arg0,arg1) ; 
+}; break;
+// 200 long sys_tkill ['int pid', ' int sig']
+case 200: {
+int32_t arg0;
+int32_t arg1;
+if (PPP_CHECK_CB(on_sys_tkill_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_tkill_return, env,pc,arg0,arg1) ; 
+}; break;
+// 201 long sys_time ['time_t __user *tloc']
+case 201: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_sys_time_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_time_return, env,pc,arg0) ; 
+}; break;
+// 202 long sys_futex ['u32 __user *uaddr', ' int op', ' u32 val', 'struct timespec __user *utime', ' u32 __user *uaddr2', 'u32 val3']
+case 202: {
+target_ulong arg0;
+int32_t arg1;
+uint32_t arg2;
+target_ulong arg3;
+target_ulong arg4;
+uint32_t arg5;
+if (PPP_CHECK_CB(on_sys_futex_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_futex_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 203 long sys_sched_setaffinity ['pid_t pid', ' unsigned int len', 'unsigned long __user *user_mask_ptr']
+case 203: {
+uint32_t arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_sched_setaffinity_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_sched_setaffinity_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 204 long sys_sched_getaffinity ['pid_t pid', ' unsigned int len', 'unsigned long __user *user_mask_ptr']
+case 204: {
+uint32_t arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_sched_getaffinity_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_sched_getaffinity_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 205 int set_thread_area ['struct user_desc *u_info']
+case 205: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_set_thread_area_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_set_thread_area_return, env,pc,arg0) ; 
+}; break;
+// 206 long sys_io_setup ['unsigned nr_reqs', ' aio_context_t __user *ctx']
+case 206: {
+uint32_t arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_io_setup_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_io_setup_return, env,pc,arg0,arg1) ; 
+}; break;
+// 207 long sys_io_destroy ['aio_context_t ctx']
+case 207: {
+uint32_t arg0;
+if (PPP_CHECK_CB(on_sys_io_destroy_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_io_destroy_return, env,pc,arg0) ; 
+}; break;
+// 208 long sys_io_getevents ['aio_context_t ctx_id', 'long min_nr', 'long nr', 'struct io_event __user *events', 'struct timespec __user *timeout']
+case 208: {
+uint32_t arg0;
+target_long arg1;
+target_long arg2;
+target_ulong arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_sys_io_getevents_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_long));
+memcpy(&arg2, rp.params[2], sizeof(target_long));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_io_getevents_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 209 long sys_io_submit ['aio_context_t', ' long', 'struct iocb __user * __user *']
+case 209: {
+uint32_t arg0;
+target_long arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_io_submit_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_long));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_io_submit_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 210 long sys_io_cancel ['aio_context_t ctx_id', ' struct iocb __user *iocb', 'struct io_event __user *result']
+case 210: {
+uint32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_io_cancel_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_io_cancel_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 211 int get_thread_area ['struct user_desc *u_info']
+case 211: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_get_thread_area_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_get_thread_area_return, env,pc,arg0) ; 
+}; break;
+// 212 long sys_lookup_dcookie ['u64 cookie64', ' char __user *buf', ' size_t len']
+case 212: {
+uint64_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_lookup_dcookie_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint64_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_lookup_dcookie_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 213 long sys_epoll_create ['int size']
+case 213: {
+int32_t arg0;
+if (PPP_CHECK_CB(on_sys_epoll_create_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_epoll_create_return, env,pc,arg0) ; 
+}; break;
+// 216 long sys_remap_file_pages ['unsigned long start', ' unsigned long size', 'unsigned long prot', ' unsigned long pgoff', 'unsigned long flags']
+case 216: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_sys_remap_file_pages_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_remap_file_pages_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 217 long sys_getdents64 ['unsigned int fd', 'struct linux_dirent64 __user *dirent', 'unsigned int count']
+case 217: {
+uint32_t arg0;
+target_ulong arg1;
+uint32_t arg2;
+if (PPP_CHECK_CB(on_sys_getdents64_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_getdents64_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 218 long sys_set_tid_address ['int __user *tidptr']
+case 218: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_sys_set_tid_address_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_set_tid_address_return, env,pc,arg0) ; 
+}; break;
+// 219 long sys_restart_syscall ['void']
+case 219: {
+if (PPP_CHECK_CB(on_sys_restart_syscall_return)) {
+}
+PPP_RUN_CB(on_sys_restart_syscall_return, env,pc) ; 
+}; break;
+// 220 long sys_semtimedop ['int semid', ' struct sembuf __user *sops', 'unsigned nsops', 'const struct timespec __user *timeout']
+case 220: {
+int32_t arg0;
+target_ulong arg1;
+uint32_t arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_sys_semtimedop_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_semtimedop_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 221 long sys_fadvise64 ['int fd', ' loff_t offset', ' size_t len', ' int advice']
+case 221: {
+int32_t arg0;
+uint64_t arg1;
+target_ulong arg2;
+int32_t arg3;
+if (PPP_CHECK_CB(on_sys_fadvise64_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint64_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_fadvise64_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 222 long sys_timer_create ['clockid_t which_clock', 'struct sigevent __user *timer_event_spec', 'timer_t __user * created_timer_id']
+case 222: {
+uint32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_timer_create_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_timer_create_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 223 long sys_timer_settime ['timer_t timer_id', ' int flags', 'const struct itimerspec __user *new_setting', 'struct itimerspec __user *old_setting']
+case 223: {
+uint32_t arg0;
+int32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_sys_timer_settime_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_timer_settime_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 224 long sys_timer_gettime ['timer_t timer_id', 'struct itimerspec __user *setting']
+case 224: {
+uint32_t arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_timer_gettime_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_timer_gettime_return, env,pc,arg0,arg1) ; 
+}; break;
+// 225 long sys_timer_getoverrun ['timer_t timer_id']
+case 225: {
+uint32_t arg0;
+if (PPP_CHECK_CB(on_sys_timer_getoverrun_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_timer_getoverrun_return, env,pc,arg0) ; 
+}; break;
+// 226 long sys_timer_delete ['timer_t timer_id']
+case 226: {
+uint32_t arg0;
+if (PPP_CHECK_CB(on_sys_timer_delete_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_timer_delete_return, env,pc,arg0) ; 
+}; break;
+// 227 long sys_clock_settime ['clockid_t which_clock', 'const struct timespec __user *tp']
+case 227: {
+uint32_t arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_clock_settime_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_clock_settime_return, env,pc,arg0,arg1) ; 
+}; break;
+// 228 long sys_clock_gettime ['clockid_t which_clock', 'struct timespec __user *tp']
+case 228: {
+uint32_t arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_clock_gettime_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_clock_gettime_return, env,pc,arg0,arg1) ; 
+}; break;
+// 229 long sys_clock_getres ['clockid_t which_clock', 'struct timespec __user *tp']
+case 229: {
+uint32_t arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_clock_getres_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_clock_getres_return, env,pc,arg0,arg1) ; 
+}; break;
+// 230 long sys_clock_nanosleep ['clockid_t which_clock', ' int flags', 'const struct timespec __user *rqtp', 'struct timespec __user *rmtp']
+case 230: {
+uint32_t arg0;
+int32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_sys_clock_nanosleep_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_clock_nanosleep_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 231 long sys_exit_group ['int error_code']
+case 231: {
+int32_t arg0;
+if (PPP_CHECK_CB(on_sys_exit_group_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_exit_group_return, env,pc,arg0) ; 
+}; break;
+// 232 long sys_epoll_wait ['int epfd', ' struct epoll_event __user *events', 'int maxevents', ' int timeout']
+case 232: {
+int32_t arg0;
+target_ulong arg1;
+int32_t arg2;
+int32_t arg3;
+if (PPP_CHECK_CB(on_sys_epoll_wait_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+memcpy(&arg3, rp.params[3], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_epoll_wait_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 233 long sys_epoll_ctl ['int epfd', ' int op', ' int fd', 'struct epoll_event __user *event']
+case 233: {
+int32_t arg0;
+int32_t arg1;
+int32_t arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_sys_epoll_ctl_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_epoll_ctl_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 234 long sys_tgkill ['int tgid', ' int pid', ' int sig']
+case 234: {
+int32_t arg0;
+int32_t arg1;
+int32_t arg2;
+if (PPP_CHECK_CB(on_sys_tgkill_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_tgkill_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 235 long sys_utimes ['char __user *filename', 'struct timeval __user *utimes']
+case 235: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_utimes_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_utimes_return, env,pc,arg0,arg1) ; 
+}; break;
+// 237 long sys_mbind ['unsigned long start', ' unsigned long len', 'unsigned long mode', 'unsigned long __user *nmask', 'unsigned long maxnode', 'unsigned flags']
+case 237: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+uint32_t arg5;
+if (PPP_CHECK_CB(on_sys_mbind_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_mbind_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 238 long sys_set_mempolicy ['int mode', ' unsigned long __user *nmask', 'unsigned long maxnode']
+case 238: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_set_mempolicy_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_set_mempolicy_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 239 long sys_get_mempolicy ['int __user *policy', 'unsigned long __user *nmask', 'unsigned long maxnode', 'unsigned long addr', ' unsigned long flags']
+case 239: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_sys_get_mempolicy_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_get_mempolicy_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 240 long sys_mq_open ['const char __user *name', ' int oflag', ' mode_t mode', ' struct mq_attr __user *attr']
+case 240: {
+target_ulong arg0;
+int32_t arg1;
+uint32_t arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_sys_mq_open_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_mq_open_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 241 long sys_mq_unlink ['const char __user *name']
+case 241: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_sys_mq_unlink_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_mq_unlink_return, env,pc,arg0) ; 
+}; break;
+// 242 long sys_mq_timedsend ['mqd_t mqdes', ' const char __user *msg_ptr', ' size_t msg_len', ' unsigned int msg_prio', ' const struct timespec __user *abs_timeout']
+case 242: {
+uint32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_sys_mq_timedsend_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_mq_timedsend_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 243 long sys_mq_timedreceive ['mqd_t mqdes', ' char __user *msg_ptr', ' size_t msg_len', ' unsigned int __user *msg_prio', ' const struct timespec __user *abs_timeout']
+case 243: {
+uint32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_sys_mq_timedreceive_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_mq_timedreceive_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 244 long sys_mq_notify ['mqd_t mqdes', ' const struct sigevent __user *notification']
+case 244: {
+uint32_t arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_mq_notify_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_mq_notify_return, env,pc,arg0,arg1) ; 
+}; break;
+// 245 long sys_mq_getsetattr ['mqd_t mqdes', ' const struct mq_attr __user *mqstat', ' struct mq_attr __user *omqstat']
+case 245: {
+uint32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_mq_getsetattr_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_mq_getsetattr_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 246 long sys_kexec_load ['unsigned long entry', ' unsigned long nr_segments', 'struct kexec_segment __user *segments', 'unsigned long flags']
+case 246: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_sys_kexec_load_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_kexec_load_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 247 long sys_waitid ['int which', ' pid_t pid', 'struct siginfo __user *infop', 'int options', ' struct rusage __user *ru']
+case 247: {
+int32_t arg0;
+uint32_t arg1;
+target_ulong arg2;
+int32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_sys_waitid_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(int32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_waitid_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 248 long sys_add_key ['const char __user *_type', 'const char __user *_description', 'const void __user *_payload', 'size_t plen', 'key_serial_t destringid']
+case 248: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+uint32_t arg4;
+if (PPP_CHECK_CB(on_sys_add_key_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_add_key_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 249 long sys_request_key ['const char __user *_type', 'const char __user *_description', 'const char __user *_callout_info', 'key_serial_t destringid']
+case 249: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_sys_request_key_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_request_key_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 250 long sys_keyctl ['int cmd', ' unsigned long arg2', ' unsigned long arg3', 'unsigned long arg4', ' unsigned long arg5']
+case 250: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_sys_keyctl_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_keyctl_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 251 long sys_ioprio_set ['int which', ' int who', ' int ioprio']
+case 251: {
+int32_t arg0;
+int32_t arg1;
+int32_t arg2;
+if (PPP_CHECK_CB(on_sys_ioprio_set_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_ioprio_set_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 252 long sys_ioprio_get ['int which', ' int who']
+case 252: {
+int32_t arg0;
+int32_t arg1;
+if (PPP_CHECK_CB(on_sys_ioprio_get_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_ioprio_get_return, env,pc,arg0,arg1) ; 
+}; break;
+// 253 long sys_inotify_init ['void']
+case 253: {
+if (PPP_CHECK_CB(on_sys_inotify_init_return)) {
+}
+PPP_RUN_CB(on_sys_inotify_init_return, env,pc) ; 
+}; break;
+// 254 long sys_inotify_add_watch ['int fd', ' const char __user *path', 'u32 mask']
+case 254: {
+int32_t arg0;
+target_ulong arg1;
+uint32_t arg2;
+if (PPP_CHECK_CB(on_sys_inotify_add_watch_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_inotify_add_watch_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 255 long sys_inotify_rm_watch ['int fd', ' __s32 wd']
+case 255: {
+int32_t arg0;
+int32_t arg1;
+if (PPP_CHECK_CB(on_sys_inotify_rm_watch_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_inotify_rm_watch_return, env,pc,arg0,arg1) ; 
+}; break;
+// 256 long sys_migrate_pages ['pid_t pid', ' unsigned long maxnode', 'const unsigned long __user *from', 'const unsigned long __user *to']
+case 256: {
+uint32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_sys_migrate_pages_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_migrate_pages_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 257 long sys_openat ['int dfd', ' const char __user *filename', ' int flags', 'int mode']
+case 257: {
+int32_t arg0;
+target_ulong arg1;
+int32_t arg2;
+int32_t arg3;
+if (PPP_CHECK_CB(on_sys_openat_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+memcpy(&arg3, rp.params[3], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_openat_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 258 long sys_mkdirat ['int dfd', ' const char __user * pathname', ' int mode']
+case 258: {
+int32_t arg0;
+target_ulong arg1;
+int32_t arg2;
+if (PPP_CHECK_CB(on_sys_mkdirat_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_mkdirat_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 259 long sys_mknodat ['int dfd', ' const char __user * filename', ' int mode', 'unsigned dev']
+case 259: {
+int32_t arg0;
+target_ulong arg1;
+int32_t arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_sys_mknodat_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_mknodat_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 260 long sys_fchownat ['int dfd', ' const char __user *filename', ' uid_t user', 'gid_t group', ' int flag']
+case 260: {
+int32_t arg0;
+target_ulong arg1;
+uint32_t arg2;
+uint32_t arg3;
+int32_t arg4;
+if (PPP_CHECK_CB(on_sys_fchownat_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_fchownat_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 261 long sys_futimesat ['int dfd', ' const char __user *filename', 'struct timeval __user *utimes']
+case 261: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_futimesat_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_futimesat_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 262 long sys_newfstatat ['int dfd', ' const char __user *filename', ' struct stat __user *statbuf', ' int flag']
+case 262: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+int32_t arg3;
+if (PPP_CHECK_CB(on_sys_newfstatat_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_newfstatat_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 263 long sys_unlinkat ['int dfd', ' const char __user * pathname', ' int flag']
+case 263: {
+int32_t arg0;
+target_ulong arg1;
+int32_t arg2;
+if (PPP_CHECK_CB(on_sys_unlinkat_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_unlinkat_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 264 long sys_renameat ['int olddfd', ' const char __user * oldname', 'int newdfd', ' const char __user * newname']
+case 264: {
+int32_t arg0;
+target_ulong arg1;
+int32_t arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_sys_renameat_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_renameat_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 265 long sys_linkat ['int olddfd', ' const char __user *oldname', 'int newdfd', ' const char __user *newname', ' int flags']
+case 265: {
+int32_t arg0;
+target_ulong arg1;
+int32_t arg2;
+target_ulong arg3;
+int32_t arg4;
+if (PPP_CHECK_CB(on_sys_linkat_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_linkat_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 266 long sys_symlinkat ['const char __user * oldname', 'int newdfd', ' const char __user * newname']
+case 266: {
+target_ulong arg0;
+int32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_symlinkat_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_symlinkat_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 267 long sys_readlinkat ['int dfd', ' const char __user *path', ' char __user *buf', 'int bufsiz']
+case 267: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+int32_t arg3;
+if (PPP_CHECK_CB(on_sys_readlinkat_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_readlinkat_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 268 long sys_fchmodat ['int dfd', ' const char __user * filename', 'mode_t mode']
+case 268: {
+int32_t arg0;
+target_ulong arg1;
+uint32_t arg2;
+if (PPP_CHECK_CB(on_sys_fchmodat_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_fchmodat_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 269 long sys_faccessat ['int dfd', ' const char __user *filename', ' int mode']
+case 269: {
+int32_t arg0;
+target_ulong arg1;
+int32_t arg2;
+if (PPP_CHECK_CB(on_sys_faccessat_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_faccessat_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 270 long sys_pselect6 ['int', ' fd_set __user *', ' fd_set __user *', 'fd_set __user *', ' struct timespec __user *', 'void __user *']
+case 270: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_sys_pselect6_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_pselect6_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 271 long sys_ppoll ['struct pollfd __user *', ' unsigned int', 'struct timespec __user *', ' const sigset_t __user *', 'size_t']
+case 271: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_sys_ppoll_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_ppoll_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 272 long sys_unshare ['unsigned long unshare_flags']
+case 272: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_sys_unshare_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_unshare_return, env,pc,arg0) ; 
+}; break;
+// 273 long sys_set_robust_list ['struct robust_list_head __user *head', 'size_t len']
+case 273: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_set_robust_list_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_set_robust_list_return, env,pc,arg0,arg1) ; 
+}; break;
+// 274 long sys_get_robust_list ['int pid', 'struct robust_list_head __user * __user *head_ptr', 'size_t __user *len_ptr']
+case 274: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_get_robust_list_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_get_robust_list_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 275 long sys_splice ['int fd_in', ' loff_t __user *off_in', 'int fd_out', ' loff_t __user *off_out', 'size_t len', ' unsigned int flags']
+case 275: {
+int32_t arg0;
+target_ulong arg1;
+int32_t arg2;
+target_ulong arg3;
+target_ulong arg4;
+uint32_t arg5;
+if (PPP_CHECK_CB(on_sys_splice_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_splice_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 276 long sys_tee ['int fdin', ' int fdout', ' size_t len', ' unsigned int flags']
+case 276: {
+int32_t arg0;
+int32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_sys_tee_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_tee_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 277 long sys_sync_file_range ['int fd', ' loff_t offset', ' loff_t nbytes', 'unsigned int flags']
+case 277: {
+int32_t arg0;
+uint64_t arg1;
+uint64_t arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_sys_sync_file_range_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint64_t));
+memcpy(&arg2, rp.params[2], sizeof(uint64_t));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_sync_file_range_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 278 long sys_vmsplice ['int fd', ' const struct iovec __user *iov', 'unsigned long nr_segs', ' unsigned int flags']
+case 278: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_sys_vmsplice_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_vmsplice_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 279 long sys_move_pages ['pid_t pid', ' unsigned long nr_pages', 'const void __user * __user *pages', 'const int __user *nodes', 'int __user *status', 'int flags']
+case 279: {
+uint32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+int32_t arg5;
+if (PPP_CHECK_CB(on_sys_move_pages_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_move_pages_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 280 long sys_utimensat ['int dfd', ' const char __user *filename', 'struct timespec __user *utimes', ' int flags']
+case 280: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+int32_t arg3;
+if (PPP_CHECK_CB(on_sys_utimensat_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_utimensat_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 281 long sys_epoll_pwait ['int epfd', ' struct epoll_event __user *events', 'int maxevents', ' int timeout', 'const sigset_t __user *sigmask', 'size_t sigsetsize']
+case 281: {
+int32_t arg0;
+target_ulong arg1;
+int32_t arg2;
+int32_t arg3;
+target_ulong arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_sys_epoll_pwait_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+memcpy(&arg3, rp.params[3], sizeof(int32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_epoll_pwait_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 282 long sys_signalfd ['int ufd', ' sigset_t __user *user_mask', ' size_t sizemask']
+case 282: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_signalfd_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_signalfd_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 283 long sys_timerfd_create ['int clockid', ' int flags']
+case 283: {
+int32_t arg0;
+int32_t arg1;
+if (PPP_CHECK_CB(on_sys_timerfd_create_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_timerfd_create_return, env,pc,arg0,arg1) ; 
+}; break;
+// 284 long sys_eventfd ['unsigned int count']
+case 284: {
+uint32_t arg0;
+if (PPP_CHECK_CB(on_sys_eventfd_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_eventfd_return, env,pc,arg0) ; 
+}; break;
+// 285 long sys_fallocate ['int fd', ' int mode', ' loff_t offset', ' loff_t len']
+case 285: {
+int32_t arg0;
+int32_t arg1;
+uint64_t arg2;
+uint64_t arg3;
+if (PPP_CHECK_CB(on_sys_fallocate_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+memcpy(&arg2, rp.params[2], sizeof(uint64_t));
+memcpy(&arg3, rp.params[3], sizeof(uint64_t));
+}
+PPP_RUN_CB(on_sys_fallocate_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 286 long sys_timerfd_settime ['int ufd', ' int flags', 'const struct itimerspec __user *utmr', 'struct itimerspec __user *otmr']
+case 286: {
+int32_t arg0;
+int32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_sys_timerfd_settime_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_timerfd_settime_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 287 long sys_timerfd_gettime ['int ufd', ' struct itimerspec __user *otmr']
+case 287: {
+int32_t arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_timerfd_gettime_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_timerfd_gettime_return, env,pc,arg0,arg1) ; 
+}; break;
+// 288 long sys_accept4 ['int fd', ' struct sockaddr __user *upeer_sockaddr', ' int __user *upeer_addrlen', ' int flags']
+case 288: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+int32_t arg3;
+if (PPP_CHECK_CB(on_sys_accept4_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_accept4_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 289 long sys_signalfd4 ['int ufd', ' sigset_t __user *user_mask', ' size_t sizemask', ' int flags']
+case 289: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+int32_t arg3;
+if (PPP_CHECK_CB(on_sys_signalfd4_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_signalfd4_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 290 long sys_eventfd2 ['unsigned int count', ' int flags']
+case 290: {
+uint32_t arg0;
+int32_t arg1;
+if (PPP_CHECK_CB(on_sys_eventfd2_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_eventfd2_return, env,pc,arg0,arg1) ; 
+}; break;
+// 291 long sys_epoll_create1 ['int flags']
+case 291: {
+int32_t arg0;
+if (PPP_CHECK_CB(on_sys_epoll_create1_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_epoll_create1_return, env,pc,arg0) ; 
+}; break;
+// 292 long sys_dup3 ['unsigned int oldfd', ' unsigned int newfd', ' int flags']
+case 292: {
+uint32_t arg0;
+uint32_t arg1;
+int32_t arg2;
+if (PPP_CHECK_CB(on_sys_dup3_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_dup3_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 293 long sys_pipe2 ['int __user *fildes', ' int flags']
+case 293: {
+target_ulong arg0;
+int32_t arg1;
+if (PPP_CHECK_CB(on_sys_pipe2_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_pipe2_return, env,pc,arg0,arg1) ; 
+}; break;
+// 294 long sys_inotify_init1 ['int flags']
+case 294: {
+int32_t arg0;
+if (PPP_CHECK_CB(on_sys_inotify_init1_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_inotify_init1_return, env,pc,arg0) ; 
+}; break;
+// 295 long sys_preadv ['unsigned long fd', ' const struct iovec __user *vec', 'unsigned long vlen', ' unsigned long pos_l', ' unsigned long pos_h']
+case 295: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_sys_preadv_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_preadv_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 296 long sys_pwritev ['unsigned long fd', ' const struct iovec __user *vec', 'unsigned long vlen', ' unsigned long pos_l', ' unsigned long pos_h']
+case 296: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_sys_pwritev_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_pwritev_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 297 long sys_rt_tgsigqueueinfo ['pid_t tgid', ' pid_t  pid', ' int sig', 'siginfo_t __user *uinfo']
+case 297: {
+uint32_t arg0;
+uint32_t arg1;
+int32_t arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_sys_rt_tgsigqueueinfo_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_rt_tgsigqueueinfo_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 298 long sys_perf_event_open ['struct perf_event_attr __user *attr_uptr', 'pid_t pid', ' int cpu', ' int group_fd', ' unsigned long flags']
+case 298: {
+target_ulong arg0;
+uint32_t arg1;
+int32_t arg2;
+int32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_sys_perf_event_open_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+memcpy(&arg3, rp.params[3], sizeof(int32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_perf_event_open_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 299 long sys_recvmmsg ['int fd', ' struct mmsghdr __user *msg', 'unsigned int vlen', ' unsigned flags', 'struct timespec __user *timeout']
+case 299: {
+int32_t arg0;
+target_ulong arg1;
+uint32_t arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_sys_recvmmsg_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_recvmmsg_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 300 long sys_fanotify_init ['unsigned int flags', ' unsigned int event_f_flags']
+case 300: {
+uint32_t arg0;
+uint32_t arg1;
+if (PPP_CHECK_CB(on_sys_fanotify_init_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_fanotify_init_return, env,pc,arg0,arg1) ; 
+}; break;
+// 301 long sys_fanotify_mark ['int fanotify_fd', ' unsigned int flags', 'u64 mask', ' int fd', 'const char  __user *pathname']
+case 301: {
+int32_t arg0;
+uint32_t arg1;
+uint64_t arg2;
+int32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_sys_fanotify_mark_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(uint64_t));
+memcpy(&arg3, rp.params[3], sizeof(int32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_fanotify_mark_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 302 long sys_prlimit64 ['pid_t pid', ' unsigned int resource', 'const struct rlimit64 __user *new_rlim', 'struct rlimit64 __user *old_rlim']
+case 302: {
+uint32_t arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_sys_prlimit64_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_prlimit64_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 303 long sys_name_to_handle_at ['int dfd', ' const char __user *name', 'struct file_handle __user *handle', 'int __user *mnt_id', ' int flag']
+case 303: {
+int32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+int32_t arg4;
+if (PPP_CHECK_CB(on_sys_name_to_handle_at_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_name_to_handle_at_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 304 long sys_open_by_handle_at ['int mountdirfd', 'struct file_handle __user *handle', 'int flags']
+case 304: {
+int32_t arg0;
+target_ulong arg1;
+int32_t arg2;
+if (PPP_CHECK_CB(on_sys_open_by_handle_at_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_open_by_handle_at_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 305 long sys_clock_adjtime ['clockid_t which_clock', 'struct timex __user *tx']
+case 305: {
+uint32_t arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_sys_clock_adjtime_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_clock_adjtime_return, env,pc,arg0,arg1) ; 
+}; break;
+// 306 long sys_syncfs ['int fd']
+case 306: {
+int32_t arg0;
+if (PPP_CHECK_CB(on_sys_syncfs_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_syncfs_return, env,pc,arg0) ; 
+}; break;
+// 307 long sys_sendmmsg ['int fd', ' struct mmsghdr __user *msg', 'unsigned int vlen', ' unsigned flags']
+case 307: {
+int32_t arg0;
+target_ulong arg1;
+uint32_t arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_sys_sendmmsg_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_sys_sendmmsg_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 308 long sys_setns ['int fd', ' int nstype']
+case 308: {
+int32_t arg0;
+int32_t arg1;
+if (PPP_CHECK_CB(on_sys_setns_return)) {
+memcpy(&arg0, rp.params[0], sizeof(int32_t));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+}
+PPP_RUN_CB(on_sys_setns_return, env,pc,arg0,arg1) ; 
+}; break;
+// 309 long sys_getcpu ['unsigned __user *cpu', ' unsigned __user *node', ' struct getcpu_cache __user *cache']
+case 309: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_sys_getcpu_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_getcpu_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 310 long sys_process_vm_readv ['pid_t pid', 'const struct iovec __user *lvec', 'unsigned long liovcnt', 'const struct iovec __user *rvec', 'unsigned long riovcnt', 'unsigned long flags']
+case 310: {
+uint32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_sys_process_vm_readv_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_process_vm_readv_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 311 long sys_process_vm_writev ['pid_t pid', 'const struct iovec __user *lvec', 'unsigned long liovcnt', 'const struct iovec __user *rvec', 'unsigned long riovcnt', 'unsigned long flags']
+case 311: {
+uint32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_sys_process_vm_writev_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_sys_process_vm_writev_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+default:
+PPP_RUN_CB(on_unknown_sys_return, env, pc, EAX);
+}
+PPP_RUN_CB(on_all_sys_return, env, pc, EAX);
+#endif
+ } 
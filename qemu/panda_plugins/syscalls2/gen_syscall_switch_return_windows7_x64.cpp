@@ -0,0 +1,5592 @@
+
+
+extern "C" {
+#include "panda_plugin.h" 
+}
+
+#include "syscalls2.h" 
+#include "panda_common.h"
+#include "panda_plugin_plugin.h"
+
+extern "C" {
+#include "gen_syscalls_ext_typedefs.h"
+#include "gen_syscall_ppp_extern_return.h"
+}
+
+void syscall_return_switch_windows7_x64 ( CPUState *env, target_ulong pc, target_ulong ordinal, ReturnPoint &rp) {  // osarch
+#ifdef TARGET_X86_64                                          // GUARD
+    switch( ordinal ) {                          // CALLNO
+// 0 NTSTATUS NtMapUserPhysicalPagesScatter ['PVOID *VirtualAddresses', ' ULONG_PTR NumberOfPages', ' PULONG_PTR UserPfnArray']
+case 0: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtMapUserPhysicalPagesScatter_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 1 NTSTATUS NtWaitForSingleObject ['HANDLE Handle', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout']
+case 1: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtWaitForSingleObject_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtWaitForSingleObject_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 2 NTSTATUS NtCallbackReturn ['PVOID OutputBuffer', ' ULONG OutputLength', ' NTSTATUS Status']
+case 2: {
+target_ulong arg0;
+uint32_t arg1;
+uint32_t arg2;
+if (PPP_CHECK_CB(on_NtCallbackReturn_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCallbackReturn_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 3 NTSTATUS NtReadFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length', ' PLARGE_INTEGER ByteOffset', ' PULONG Key']
+case 3: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+uint32_t arg6;
+target_ulong arg7;
+target_ulong arg8;
+if (PPP_CHECK_CB(on_NtReadFile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(uint32_t));
+memcpy(&arg7, rp.params[7], sizeof(target_ulong));
+memcpy(&arg8, rp.params[8], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtReadFile_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}; break;
+// 4 NTSTATUS NtDeviceIoControlFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG IoControlCode', ' PVOID InputBuffer', ' ULONG InputBufferLength', ' PVOID OutputBuffer', ' ULONG OutputBufferLength']
+case 4: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+uint32_t arg5;
+target_ulong arg6;
+uint32_t arg7;
+target_ulong arg8;
+uint32_t arg9;
+if (PPP_CHECK_CB(on_NtDeviceIoControlFile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+memcpy(&arg6, rp.params[6], sizeof(target_ulong));
+memcpy(&arg7, rp.params[7], sizeof(uint32_t));
+memcpy(&arg8, rp.params[8], sizeof(target_ulong));
+memcpy(&arg9, rp.params[9], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtDeviceIoControlFile_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+}; break;
+// 5 NTSTATUS NtWriteFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length', ' PLARGE_INTEGER ByteOffset', ' PULONG Key']
+case 5: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+uint32_t arg6;
+target_ulong arg7;
+target_ulong arg8;
+if (PPP_CHECK_CB(on_NtWriteFile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(uint32_t));
+memcpy(&arg7, rp.params[7], sizeof(target_ulong));
+memcpy(&arg8, rp.params[8], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtWriteFile_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}; break;
+// 6 NTSTATUS NtRemoveIoCompletion ['HANDLE IoCompletionHandle', ' PVOID *KeyContext', ' PVOID *ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PLARGE_INTEGER Timeout']
+case 6: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtRemoveIoCompletion_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtRemoveIoCompletion_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 7 NTSTATUS NtReleaseSemaphore ['HANDLE SemaphoreHandle', ' LONG ReleaseCount', ' PLONG PreviousCount']
+case 7: {
+target_ulong arg0;
+int32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtReleaseSemaphore_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(int32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtReleaseSemaphore_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 8 NTSTATUS NtReplyWaitReceivePort ['HANDLE PortHandle', ' PVOID *PortContext ', ' PPORT_MESSAGE ReplyMessage', ' PPORT_MESSAGE ReceiveMessage']
+case 8: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_NtReplyWaitReceivePort_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtReplyWaitReceivePort_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 9 NTSTATUS NtReplyPort ['HANDLE PortHandle', ' PPORT_MESSAGE ReplyMessage']
+case 9: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtReplyPort_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtReplyPort_return, env,pc,arg0,arg1) ; 
+}; break;
+// 10 NTSTATUS NtSetInformationThread ['HANDLE ThreadHandle', ' THREADINFOCLASS ThreadInformationClass', ' PVOID ThreadInformation', ' ULONG ThreadInformationLength']
+case 10: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_NtSetInformationThread_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetInformationThread_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 11 NTSTATUS NtSetEvent ['HANDLE EventHandle', ' PLONG PreviousState']
+case 11: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtSetEvent_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetEvent_return, env,pc,arg0,arg1) ; 
+}; break;
+// 12 NTSTATUS NtClose ['HANDLE Handle']
+case 12: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtClose_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtClose_return, env,pc,arg0) ; 
+}; break;
+// 13 NTSTATUS NtQueryObject ['HANDLE Handle', ' OBJECT_INFORMATION_CLASS ObjectInformationClass', ' PVOID ObjectInformation', ' ULONG ObjectInformationLength', ' PULONG ReturnLength']
+case 13: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtQueryObject_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryObject_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 14 NTSTATUS NtQueryInformationFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID FileInformation', ' ULONG Length', ' FILE_INFORMATION_CLASS FileInformationClass']
+case 14: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+uint32_t arg3;
+uint32_t arg4;
+if (PPP_CHECK_CB(on_NtQueryInformationFile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtQueryInformationFile_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 15 NTSTATUS NtOpenKey ['PHANDLE KeyHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 15: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtOpenKey_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenKey_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 16 NTSTATUS NtEnumerateValueKey ['HANDLE KeyHandle', ' ULONG Index', ' KEY_VALUE_INFORMATION_CLASS KeyValueInformationClass', ' PVOID KeyValueInformation', ' ULONG Length', ' PULONG ResultLength']
+case 16: {
+target_ulong arg0;
+uint32_t arg1;
+uint32_t arg2;
+target_ulong arg3;
+uint32_t arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_NtEnumerateValueKey_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtEnumerateValueKey_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 17 NTSTATUS NtFindAtom ['PWSTR AtomName', ' ULONG Length', ' PRTL_ATOM Atom']
+case 17: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtFindAtom_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtFindAtom_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 18 NTSTATUS NtQueryDefaultLocale ['BOOLEAN UserProfile', ' PLCID DefaultLocaleId']
+case 18: {
+uint32_t arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtQueryDefaultLocale_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryDefaultLocale_return, env,pc,arg0,arg1) ; 
+}; break;
+// 19 NTSTATUS NtQueryKey ['HANDLE KeyHandle', ' KEY_INFORMATION_CLASS KeyInformationClass', ' PVOID KeyInformation', ' ULONG Length', ' PULONG ResultLength']
+case 19: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtQueryKey_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryKey_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 20 NTSTATUS NtQueryValueKey ['HANDLE KeyHandle', ' PUNICODE_STRING ValueName', ' KEY_VALUE_INFORMATION_CLASS KeyValueInformationClass', ' PVOID KeyValueInformation', ' ULONG Length', ' PULONG ResultLength']
+case 20: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+target_ulong arg3;
+uint32_t arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_NtQueryValueKey_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryValueKey_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 21 NTSTATUS NtAllocateVirtualMemory ['HANDLE ProcessHandle', ' PVOID *BaseAddress', ' ULONG_PTR ZeroBits', ' PSIZE_T RegionSize', ' ULONG AllocationType', ' ULONG Protect']
+case 21: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+uint32_t arg4;
+uint32_t arg5;
+if (PPP_CHECK_CB(on_NtAllocateVirtualMemory_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtAllocateVirtualMemory_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 22 NTSTATUS NtQueryInformationProcess ['HANDLE ProcessHandle', ' PROCESSINFOCLASS ProcessInformationClass', ' PVOID ProcessInformation', ' ULONG ProcessInformationLength', ' PULONG ReturnLength']
+case 22: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtQueryInformationProcess_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryInformationProcess_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 23 NTSTATUS NtWaitForMultipleObjects32 ['ULONG Count', ' LONG Handles[]', ' WAIT_TYPE WaitType', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout']
+case 23: {
+uint32_t arg0;
+target_ulong arg1;
+uint32_t arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtWaitForMultipleObjects32_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtWaitForMultipleObjects32_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 24 NTSTATUS NtWriteFileGather ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PFILE_SEGMENT_ELEMENT SegmentArray', ' ULONG Length', ' PLARGE_INTEGER ByteOffset', ' PULONG Key']
+case 24: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+uint32_t arg6;
+target_ulong arg7;
+target_ulong arg8;
+if (PPP_CHECK_CB(on_NtWriteFileGather_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(uint32_t));
+memcpy(&arg7, rp.params[7], sizeof(target_ulong));
+memcpy(&arg8, rp.params[8], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtWriteFileGather_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}; break;
+// 25 NTSTATUS NtSetInformationProcess ['HANDLE ProcessHandle', ' PROCESSINFOCLASS ProcessInformationClass', ' PVOID ProcessInformation', ' ULONG ProcessInformationLength']
+case 25: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_NtSetInformationProcess_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetInformationProcess_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 26 NTSTATUS NtCreateKey ['PHANDLE KeyHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG TitleIndex', ' PUNICODE_STRING Class', ' ULONG CreateOptions', ' PULONG Disposition']
+case 26: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+uint32_t arg5;
+target_ulong arg6;
+if (PPP_CHECK_CB(on_NtCreateKey_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+memcpy(&arg6, rp.params[6], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateKey_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+}; break;
+// 27 NTSTATUS NtFreeVirtualMemory ['HANDLE ProcessHandle', ' PVOID *BaseAddress', ' PSIZE_T RegionSize', ' ULONG FreeType']
+case 27: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_NtFreeVirtualMemory_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtFreeVirtualMemory_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 28 NTSTATUS NtImpersonateClientOfPort ['HANDLE PortHandle', ' PPORT_MESSAGE Message']
+case 28: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtImpersonateClientOfPort_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtImpersonateClientOfPort_return, env,pc,arg0,arg1) ; 
+}; break;
+// 29 NTSTATUS NtReleaseMutant ['HANDLE MutantHandle', ' PLONG PreviousCount']
+case 29: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtReleaseMutant_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtReleaseMutant_return, env,pc,arg0,arg1) ; 
+}; break;
+// 30 NTSTATUS NtQueryInformationToken ['HANDLE TokenHandle', ' TOKEN_INFORMATION_CLASS TokenInformationClass', ' PVOID TokenInformation', ' ULONG TokenInformationLength', ' PULONG ReturnLength']
+case 30: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtQueryInformationToken_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryInformationToken_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 31 NTSTATUS NtRequestWaitReplyPort ['HANDLE PortHandle', ' PPORT_MESSAGE RequestMessage', ' PPORT_MESSAGE ReplyMessage']
+case 31: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtRequestWaitReplyPort_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtRequestWaitReplyPort_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 32 NTSTATUS NtQueryVirtualMemory ['HANDLE ProcessHandle', ' PVOID BaseAddress', ' MEMORY_INFORMATION_CLASS MemoryInformationClass', ' PVOID MemoryInformation', ' SIZE_T MemoryInformationLength', ' PSIZE_T ReturnLength']
+case 32: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_NtQueryVirtualMemory_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryVirtualMemory_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 33 NTSTATUS NtOpenThreadToken ['HANDLE ThreadHandle', ' ACCESS_MASK DesiredAccess', ' BOOLEAN OpenAsSelf', ' PHANDLE TokenHandle']
+case 33: {
+target_ulong arg0;
+uint32_t arg1;
+uint32_t arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_NtOpenThreadToken_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenThreadToken_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 34 NTSTATUS NtQueryInformationThread ['HANDLE ThreadHandle', ' THREADINFOCLASS ThreadInformationClass', ' PVOID ThreadInformation', ' ULONG ThreadInformationLength', ' PULONG ReturnLength']
+case 34: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtQueryInformationThread_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryInformationThread_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 35 NTSTATUS NtOpenProcess ['PHANDLE ProcessHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PCLIENT_ID ClientId']
+case 35: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_NtOpenProcess_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenProcess_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 36 NTSTATUS NtSetInformationFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID FileInformation', ' ULONG Length', ' FILE_INFORMATION_CLASS FileInformationClass']
+case 36: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+uint32_t arg3;
+uint32_t arg4;
+if (PPP_CHECK_CB(on_NtSetInformationFile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetInformationFile_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 37 NTSTATUS NtMapViewOfSection ['HANDLE SectionHandle', ' HANDLE ProcessHandle', ' PVOID *BaseAddress', ' ULONG_PTR ZeroBits', ' SIZE_T CommitSize', ' PLARGE_INTEGER SectionOffset', ' PSIZE_T ViewSize', ' SECTION_INHERIT InheritDisposition', ' ULONG AllocationType', ' WIN32_PROTECTION_MASK Win32Protect']
+case 37: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+target_ulong arg6;
+uint32_t arg7;
+uint32_t arg8;
+uint32_t arg9;
+if (PPP_CHECK_CB(on_NtMapViewOfSection_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(target_ulong));
+memcpy(&arg7, rp.params[7], sizeof(uint32_t));
+memcpy(&arg8, rp.params[8], sizeof(uint32_t));
+memcpy(&arg9, rp.params[9], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtMapViewOfSection_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+}; break;
+// 38 NTSTATUS NtAccessCheckAndAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' PUNICODE_STRING ObjectTypeName', ' PUNICODE_STRING ObjectName', ' PSECURITY_DESCRIPTOR SecurityDescriptor', ' ACCESS_MASK DesiredAccess', ' PGENERIC_MAPPING GenericMapping', ' BOOLEAN ObjectCreation', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus', ' PBOOLEAN GenerateOnClose']
+case 38: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+uint32_t arg5;
+target_ulong arg6;
+uint32_t arg7;
+target_ulong arg8;
+target_ulong arg9;
+target_ulong arg10;
+if (PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+memcpy(&arg6, rp.params[6], sizeof(target_ulong));
+memcpy(&arg7, rp.params[7], sizeof(uint32_t));
+memcpy(&arg8, rp.params[8], sizeof(target_ulong));
+memcpy(&arg9, rp.params[9], sizeof(target_ulong));
+memcpy(&arg10, rp.params[10], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAccessCheckAndAuditAlarm_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+}; break;
+// 39 NTSTATUS NtUnmapViewOfSection ['HANDLE ProcessHandle', ' PVOID BaseAddress']
+case 39: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtUnmapViewOfSection_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtUnmapViewOfSection_return, env,pc,arg0,arg1) ; 
+}; break;
+// 40 NTSTATUS NtReplyWaitReceivePortEx ['HANDLE PortHandle', ' PVOID *PortContext', ' PPORT_MESSAGE ReplyMessage', ' PPORT_MESSAGE ReceiveMessage', ' PLARGE_INTEGER Timeout']
+case 40: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtReplyWaitReceivePortEx_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 41 NTSTATUS NtTerminateProcess ['HANDLE ProcessHandle', ' NTSTATUS ExitStatus']
+case 41: {
+target_ulong arg0;
+uint32_t arg1;
+if (PPP_CHECK_CB(on_NtTerminateProcess_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtTerminateProcess_return, env,pc,arg0,arg1) ; 
+}; break;
+// 42 NTSTATUS NtSetEventBoostPriority ['HANDLE EventHandle']
+case 42: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtSetEventBoostPriority_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetEventBoostPriority_return, env,pc,arg0) ; 
+}; break;
+// 43 NTSTATUS NtReadFileScatter ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PFILE_SEGMENT_ELEMENT SegmentArray', ' ULONG Length', ' PLARGE_INTEGER ByteOffset', ' PULONG Key']
+case 43: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+uint32_t arg6;
+target_ulong arg7;
+target_ulong arg8;
+if (PPP_CHECK_CB(on_NtReadFileScatter_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(uint32_t));
+memcpy(&arg7, rp.params[7], sizeof(target_ulong));
+memcpy(&arg8, rp.params[8], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtReadFileScatter_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}; break;
+// 44 NTSTATUS NtOpenThreadTokenEx ['HANDLE ThreadHandle', ' ACCESS_MASK DesiredAccess', ' BOOLEAN OpenAsSelf', ' ULONG HandleAttributes', ' PHANDLE TokenHandle']
+case 44: {
+target_ulong arg0;
+uint32_t arg1;
+uint32_t arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtOpenThreadTokenEx_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenThreadTokenEx_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 45 NTSTATUS NtOpenProcessTokenEx ['HANDLE ProcessHandle', ' ACCESS_MASK DesiredAccess', ' ULONG HandleAttributes', ' PHANDLE TokenHandle']
+case 45: {
+target_ulong arg0;
+uint32_t arg1;
+uint32_t arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_NtOpenProcessTokenEx_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenProcessTokenEx_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 46 NTSTATUS NtQueryPerformanceCounter ['PLARGE_INTEGER PerformanceCounter', ' PLARGE_INTEGER PerformanceFrequency']
+case 46: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtQueryPerformanceCounter_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryPerformanceCounter_return, env,pc,arg0,arg1) ; 
+}; break;
+// 47 NTSTATUS NtEnumerateKey ['HANDLE KeyHandle', ' ULONG Index', ' KEY_INFORMATION_CLASS KeyInformationClass', ' PVOID KeyInformation', ' ULONG Length', ' PULONG ResultLength']
+case 47: {
+target_ulong arg0;
+uint32_t arg1;
+uint32_t arg2;
+target_ulong arg3;
+uint32_t arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_NtEnumerateKey_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtEnumerateKey_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 48 NTSTATUS NtOpenFile ['PHANDLE FileHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG ShareAccess', ' ULONG OpenOptions']
+case 48: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+uint32_t arg4;
+uint32_t arg5;
+if (PPP_CHECK_CB(on_NtOpenFile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtOpenFile_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 49 NTSTATUS NtDelayExecution ['BOOLEAN Alertable', ' PLARGE_INTEGER DelayInterval']
+case 49: {
+uint32_t arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtDelayExecution_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtDelayExecution_return, env,pc,arg0,arg1) ; 
+}; break;
+// 50 NTSTATUS NtQueryDirectoryFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID FileInformation', ' ULONG Length', ' FILE_INFORMATION_CLASS FileInformationClass', ' BOOLEAN ReturnSingleEntry', ' PUNICODE_STRING FileName', ' BOOLEAN RestartScan']
+case 50: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+uint32_t arg6;
+uint32_t arg7;
+uint32_t arg8;
+target_ulong arg9;
+uint32_t arg10;
+if (PPP_CHECK_CB(on_NtQueryDirectoryFile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(uint32_t));
+memcpy(&arg7, rp.params[7], sizeof(uint32_t));
+memcpy(&arg8, rp.params[8], sizeof(uint32_t));
+memcpy(&arg9, rp.params[9], sizeof(target_ulong));
+memcpy(&arg10, rp.params[10], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtQueryDirectoryFile_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+}; break;
+// 51 NTSTATUS NtQuerySystemInformation ['SYSTEM_INFORMATION_CLASS SystemInformationClass', ' PVOID SystemInformation', ' ULONG SystemInformationLength', ' PULONG ReturnLength']
+case 51: {
+uint32_t arg0;
+target_ulong arg1;
+uint32_t arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_NtQuerySystemInformation_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQuerySystemInformation_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 52 NTSTATUS NtOpenSection ['PHANDLE SectionHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 52: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtOpenSection_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenSection_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 53 NTSTATUS NtQueryTimer ['HANDLE TimerHandle', ' TIMER_INFORMATION_CLASS TimerInformationClass', ' PVOID TimerInformation', ' ULONG TimerInformationLength', ' PULONG ReturnLength']
+case 53: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtQueryTimer_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryTimer_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 54 NTSTATUS NtFsControlFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG IoControlCode', ' PVOID InputBuffer', ' ULONG InputBufferLength', ' PVOID OutputBuffer', ' ULONG OutputBufferLength']
+case 54: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+uint32_t arg5;
+target_ulong arg6;
+uint32_t arg7;
+target_ulong arg8;
+uint32_t arg9;
+if (PPP_CHECK_CB(on_NtFsControlFile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+memcpy(&arg6, rp.params[6], sizeof(target_ulong));
+memcpy(&arg7, rp.params[7], sizeof(uint32_t));
+memcpy(&arg8, rp.params[8], sizeof(target_ulong));
+memcpy(&arg9, rp.params[9], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtFsControlFile_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+}; break;
+// 55 NTSTATUS NtWriteVirtualMemory ['HANDLE ProcessHandle', ' PVOID BaseAddress', ' PVOID Buffer', ' SIZE_T BufferSize', ' PSIZE_T NumberOfBytesWritten']
+case 55: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtWriteVirtualMemory_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtWriteVirtualMemory_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 56 NTSTATUS NtCloseObjectAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' BOOLEAN GenerateOnClose']
+case 56: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+if (PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCloseObjectAuditAlarm_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 57 NTSTATUS NtDuplicateObject ['HANDLE SourceProcessHandle', ' HANDLE SourceHandle', ' HANDLE TargetProcessHandle', ' PHANDLE TargetHandle', ' ACCESS_MASK DesiredAccess', ' ULONG HandleAttributes', ' ULONG Options']
+case 57: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+uint32_t arg4;
+uint32_t arg5;
+uint32_t arg6;
+if (PPP_CHECK_CB(on_NtDuplicateObject_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+memcpy(&arg6, rp.params[6], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtDuplicateObject_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+}; break;
+// 58 NTSTATUS NtQueryAttributesFile ['POBJECT_ATTRIBUTES ObjectAttributes', ' PFILE_BASIC_INFORMATION FileInformation']
+case 58: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtQueryAttributesFile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryAttributesFile_return, env,pc,arg0,arg1) ; 
+}; break;
+// 59 NTSTATUS NtClearEvent ['HANDLE EventHandle']
+case 59: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtClearEvent_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtClearEvent_return, env,pc,arg0) ; 
+}; break;
+// 60 NTSTATUS NtReadVirtualMemory ['HANDLE ProcessHandle', ' PVOID BaseAddress', ' PVOID Buffer', ' SIZE_T BufferSize', ' PSIZE_T NumberOfBytesRead']
+case 60: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtReadVirtualMemory_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtReadVirtualMemory_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 61 NTSTATUS NtOpenEvent ['PHANDLE EventHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 61: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtOpenEvent_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenEvent_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 62 NTSTATUS NtAdjustPrivilegesToken ['HANDLE TokenHandle', ' BOOLEAN DisableAllPrivileges', ' PTOKEN_PRIVILEGES NewState', ' ULONG BufferLength', ' PTOKEN_PRIVILEGES PreviousState', ' PULONG ReturnLength']
+case 62: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_NtAdjustPrivilegesToken_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAdjustPrivilegesToken_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 63 NTSTATUS NtDuplicateToken ['HANDLE ExistingTokenHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' BOOLEAN EffectiveOnly', ' TOKEN_TYPE TokenType', ' PHANDLE NewTokenHandle']
+case 63: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+uint32_t arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_NtDuplicateToken_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtDuplicateToken_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 64 NTSTATUS NtContinue ['PCONTEXT ContextRecord', ' BOOLEAN TestAlert']
+case 64: {
+target_ulong arg0;
+uint32_t arg1;
+if (PPP_CHECK_CB(on_NtContinue_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtContinue_return, env,pc,arg0,arg1) ; 
+}; break;
+// 65 NTSTATUS NtQueryDefaultUILanguage ['LANGID *DefaultUILanguageId']
+case 65: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtQueryDefaultUILanguage_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryDefaultUILanguage_return, env,pc,arg0) ; 
+}; break;
+// 66 NTSTATUS NtQueueApcThread ['HANDLE ThreadHandle', ' PPS_APC_ROUTINE ApcRoutine', ' PVOID ApcArgument1', ' PVOID ApcArgument2', ' PVOID ApcArgument3']
+case 66: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtQueueApcThread_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueueApcThread_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 67 NTSTATUS NtYieldExecution ['']
+case 67: {
+if (PPP_CHECK_CB(on_NtYieldExecution_return)) {
+}
+PPP_RUN_CB(on_NtYieldExecution_return, env,pc) ; 
+}; break;
+// 68 NTSTATUS NtAddAtom ['PWSTR AtomName', ' ULONG Length', ' PRTL_ATOM Atom']
+case 68: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtAddAtom_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAddAtom_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 69 NTSTATUS NtCreateEvent ['PHANDLE EventHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' EVENT_TYPE EventType', ' BOOLEAN InitialState']
+case 69: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+uint32_t arg4;
+if (PPP_CHECK_CB(on_NtCreateEvent_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCreateEvent_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 70 NTSTATUS NtQueryVolumeInformationFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID FsInformation', ' ULONG Length', ' FS_INFORMATION_CLASS FsInformationClass']
+case 70: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+uint32_t arg3;
+uint32_t arg4;
+if (PPP_CHECK_CB(on_NtQueryVolumeInformationFile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtQueryVolumeInformationFile_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 71 NTSTATUS NtCreateSection ['PHANDLE SectionHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PLARGE_INTEGER MaximumSize', ' ULONG SectionPageProtection', ' ULONG AllocationAttributes', ' HANDLE FileHandle']
+case 71: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+uint32_t arg4;
+uint32_t arg5;
+target_ulong arg6;
+if (PPP_CHECK_CB(on_NtCreateSection_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+memcpy(&arg6, rp.params[6], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateSection_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+}; break;
+// 72 NTSTATUS NtFlushBuffersFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock']
+case 72: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtFlushBuffersFile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtFlushBuffersFile_return, env,pc,arg0,arg1) ; 
+}; break;
+// 73 NTSTATUS NtApphelpCacheControl ['APPHELPCOMMAND type', ' PVOID buf']
+case 73: {
+uint32_t arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtApphelpCacheControl_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtApphelpCacheControl_return, env,pc,arg0,arg1) ; 
+}; break;
+// 74 NTSTATUS NtCreateProcessEx ['PHANDLE ProcessHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' HANDLE ParentProcess', ' ULONG Flags', ' HANDLE SectionHandle', ' HANDLE DebugPort', ' HANDLE ExceptionPort', ' ULONG JobMemberLevel']
+case 74: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+uint32_t arg4;
+target_ulong arg5;
+target_ulong arg6;
+target_ulong arg7;
+uint32_t arg8;
+if (PPP_CHECK_CB(on_NtCreateProcessEx_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(target_ulong));
+memcpy(&arg7, rp.params[7], sizeof(target_ulong));
+memcpy(&arg8, rp.params[8], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCreateProcessEx_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}; break;
+// 75 NTSTATUS NtCreateThread ['PHANDLE ThreadHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' HANDLE ProcessHandle', ' PCLIENT_ID ClientId', ' PCONTEXT ThreadContext', ' PINITIAL_TEB InitialTeb', ' BOOLEAN CreateSuspended']
+case 75: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+target_ulong arg6;
+uint32_t arg7;
+if (PPP_CHECK_CB(on_NtCreateThread_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(target_ulong));
+memcpy(&arg7, rp.params[7], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCreateThread_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}; break;
+// 76 NTSTATUS NtIsProcessInJob ['HANDLE ProcessHandle', ' HANDLE JobHandle']
+case 76: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtIsProcessInJob_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtIsProcessInJob_return, env,pc,arg0,arg1) ; 
+}; break;
+// 77 NTSTATUS NtProtectVirtualMemory ['HANDLE ProcessHandle', ' PVOID *BaseAddress', ' PSIZE_T RegionSize', ' WIN32_PROTECTION_MASK NewProtectWin32', ' PULONG OldProtect']
+case 77: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtProtectVirtualMemory_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtProtectVirtualMemory_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 78 NTSTATUS NtQuerySection ['HANDLE SectionHandle', ' SECTION_INFORMATION_CLASS SectionInformationClass', ' PVOID SectionInformation', ' SIZE_T SectionInformationLength', ' PSIZE_T ReturnLength']
+case 78: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtQuerySection_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQuerySection_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 79 NTSTATUS NtResumeThread ['HANDLE ThreadHandle', ' PULONG PreviousSuspendCount']
+case 79: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtResumeThread_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtResumeThread_return, env,pc,arg0,arg1) ; 
+}; break;
+// 80 NTSTATUS NtTerminateThread ['HANDLE ThreadHandle', ' NTSTATUS ExitStatus']
+case 80: {
+target_ulong arg0;
+uint32_t arg1;
+if (PPP_CHECK_CB(on_NtTerminateThread_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtTerminateThread_return, env,pc,arg0,arg1) ; 
+}; break;
+// 81 NTSTATUS NtReadRequestData ['HANDLE PortHandle', ' PPORT_MESSAGE Message', ' ULONG DataEntryIndex', ' PVOID Buffer', ' SIZE_T BufferSize', ' PSIZE_T NumberOfBytesRead']
+case 81: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_NtReadRequestData_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtReadRequestData_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 82 NTSTATUS NtCreateFile ['PHANDLE FileHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PIO_STATUS_BLOCK IoStatusBlock', ' PLARGE_INTEGER AllocationSize', ' ULONG FileAttributes', ' ULONG ShareAccess', ' ULONG CreateDisposition', ' ULONG CreateOptions', ' PVOID EaBuffer', ' ULONG EaLength']
+case 82: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+uint32_t arg5;
+uint32_t arg6;
+uint32_t arg7;
+uint32_t arg8;
+target_ulong arg9;
+uint32_t arg10;
+if (PPP_CHECK_CB(on_NtCreateFile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+memcpy(&arg6, rp.params[6], sizeof(uint32_t));
+memcpy(&arg7, rp.params[7], sizeof(uint32_t));
+memcpy(&arg8, rp.params[8], sizeof(uint32_t));
+memcpy(&arg9, rp.params[9], sizeof(target_ulong));
+memcpy(&arg10, rp.params[10], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCreateFile_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+}; break;
+// 83 NTSTATUS NtQueryEvent ['HANDLE EventHandle', ' EVENT_INFORMATION_CLASS EventInformationClass', ' PVOID EventInformation', ' ULONG EventInformationLength', ' PULONG ReturnLength']
+case 83: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtQueryEvent_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryEvent_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 84 NTSTATUS NtWriteRequestData ['HANDLE PortHandle', ' PPORT_MESSAGE Message', ' ULONG DataEntryIndex', ' PVOID Buffer', ' SIZE_T BufferSize', ' PSIZE_T NumberOfBytesWritten']
+case 84: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_NtWriteRequestData_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtWriteRequestData_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 85 NTSTATUS NtOpenDirectoryObject ['PHANDLE DirectoryHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 85: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtOpenDirectoryObject_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenDirectoryObject_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 86 NTSTATUS NtAccessCheckByTypeAndAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' PUNICODE_STRING ObjectTypeName', ' PUNICODE_STRING ObjectName', ' PSECURITY_DESCRIPTOR SecurityDescriptor', ' PSID PrincipalSelfSid', ' ACCESS_MASK DesiredAccess', ' AUDIT_EVENT_TYPE AuditType', ' ULONG Flags', ' POBJECT_TYPE_LIST ObjectTypeList', ' ULONG ObjectTypeListLength', ' PGENERIC_MAPPING GenericMapping', ' BOOLEAN ObjectCreation', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus', ' PBOOLEAN GenerateOnClose']
+case 86: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+uint32_t arg6;
+uint32_t arg7;
+uint32_t arg8;
+target_ulong arg9;
+uint32_t arg10;
+target_ulong arg11;
+uint32_t arg12;
+target_ulong arg13;
+target_ulong arg14;
+target_ulong arg15;
+if (PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(uint32_t));
+memcpy(&arg7, rp.params[7], sizeof(uint32_t));
+memcpy(&arg8, rp.params[8], sizeof(uint32_t));
+memcpy(&arg9, rp.params[9], sizeof(target_ulong));
+memcpy(&arg10, rp.params[10], sizeof(uint32_t));
+memcpy(&arg11, rp.params[11], sizeof(target_ulong));
+memcpy(&arg12, rp.params[12], sizeof(uint32_t));
+memcpy(&arg13, rp.params[13], sizeof(target_ulong));
+memcpy(&arg14, rp.params[14], sizeof(target_ulong));
+memcpy(&arg15, rp.params[15], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAccessCheckByTypeAndAuditAlarm_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13,arg14,arg15) ; 
+}; break;
+// 87 NTSTATUS NtQuerySystemTime ['PLARGE_INTEGER SystemTime']
+case 87: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtQuerySystemTime_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQuerySystemTime_return, env,pc,arg0) ; 
+}; break;
+// 88 NTSTATUS NtWaitForMultipleObjects ['ULONG Count', ' HANDLE Handles[]', ' WAIT_TYPE WaitType', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout']
+case 88: {
+uint32_t arg0;
+target_ulong arg1;
+uint32_t arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtWaitForMultipleObjects_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtWaitForMultipleObjects_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 89 NTSTATUS NtSetInformationObject ['HANDLE Handle', ' OBJECT_INFORMATION_CLASS ObjectInformationClass', ' PVOID ObjectInformation', ' ULONG ObjectInformationLength']
+case 89: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_NtSetInformationObject_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetInformationObject_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 90 NTSTATUS NtCancelIoFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock']
+case 90: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtCancelIoFile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCancelIoFile_return, env,pc,arg0,arg1) ; 
+}; break;
+// 91 NTSTATUS NtTraceEvent ['HANDLE TraceHandle', ' ULONG Flags', ' ULONG FieldSize', ' PVOID Fields']
+case 91: {
+target_ulong arg0;
+uint32_t arg1;
+uint32_t arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_NtTraceEvent_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtTraceEvent_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 92 NTSTATUS NtPowerInformation ['POWER_INFORMATION_LEVEL InformationLevel', ' PVOID InputBuffer', ' ULONG InputBufferLength', ' PVOID OutputBuffer', ' ULONG OutputBufferLength']
+case 92: {
+uint32_t arg0;
+target_ulong arg1;
+uint32_t arg2;
+target_ulong arg3;
+uint32_t arg4;
+if (PPP_CHECK_CB(on_NtPowerInformation_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtPowerInformation_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 93 NTSTATUS NtSetValueKey ['HANDLE KeyHandle', ' PUNICODE_STRING ValueName', ' ULONG TitleIndex', ' ULONG Type', ' PVOID Data', ' ULONG DataSize']
+case 93: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+uint32_t arg3;
+target_ulong arg4;
+uint32_t arg5;
+if (PPP_CHECK_CB(on_NtSetValueKey_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetValueKey_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 94 NTSTATUS NtCancelTimer ['HANDLE TimerHandle', ' PBOOLEAN CurrentState']
+case 94: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtCancelTimer_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCancelTimer_return, env,pc,arg0,arg1) ; 
+}; break;
+// 95 NTSTATUS NtSetTimer ['HANDLE TimerHandle', ' PLARGE_INTEGER DueTime', ' PTIMER_APC_ROUTINE TimerApcRoutine', ' PVOID TimerContext', ' BOOLEAN WakeTimer', ' LONG Period', ' PBOOLEAN PreviousState']
+case 95: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+uint32_t arg4;
+int32_t arg5;
+target_ulong arg6;
+if (PPP_CHECK_CB(on_NtSetTimer_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(int32_t));
+memcpy(&arg6, rp.params[6], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetTimer_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+}; break;
+// 96 NTSTATUS NtAcceptConnectPort ['PHANDLE PortHandle', ' PVOID PortContext', ' PPORT_MESSAGE ConnectionRequest', ' BOOLEAN AcceptConnection', ' PPORT_VIEW ServerView', ' PREMOTE_PORT_VIEW ClientView']
+case 96: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_NtAcceptConnectPort_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAcceptConnectPort_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 97 NTSTATUS NtAccessCheck ['PSECURITY_DESCRIPTOR SecurityDescriptor', ' HANDLE ClientToken', ' ACCESS_MASK DesiredAccess', ' PGENERIC_MAPPING GenericMapping', ' PPRIVILEGE_SET PrivilegeSet', ' PULONG PrivilegeSetLength', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus']
+case 97: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+target_ulong arg6;
+target_ulong arg7;
+if (PPP_CHECK_CB(on_NtAccessCheck_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(target_ulong));
+memcpy(&arg7, rp.params[7], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAccessCheck_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}; break;
+// 98 NTSTATUS NtAccessCheckByType ['PSECURITY_DESCRIPTOR SecurityDescriptor', ' PSID PrincipalSelfSid', ' HANDLE ClientToken', ' ACCESS_MASK DesiredAccess', ' POBJECT_TYPE_LIST ObjectTypeList', ' ULONG ObjectTypeListLength', ' PGENERIC_MAPPING GenericMapping', ' PPRIVILEGE_SET PrivilegeSet', ' PULONG PrivilegeSetLength', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus']
+case 98: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+uint32_t arg5;
+target_ulong arg6;
+target_ulong arg7;
+target_ulong arg8;
+target_ulong arg9;
+target_ulong arg10;
+if (PPP_CHECK_CB(on_NtAccessCheckByType_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+memcpy(&arg6, rp.params[6], sizeof(target_ulong));
+memcpy(&arg7, rp.params[7], sizeof(target_ulong));
+memcpy(&arg8, rp.params[8], sizeof(target_ulong));
+memcpy(&arg9, rp.params[9], sizeof(target_ulong));
+memcpy(&arg10, rp.params[10], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAccessCheckByType_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+}; break;
+// 99 NTSTATUS NtAccessCheckByTypeResultList ['PSECURITY_DESCRIPTOR SecurityDescriptor', ' PSID PrincipalSelfSid', ' HANDLE ClientToken', ' ACCESS_MASK DesiredAccess', ' POBJECT_TYPE_LIST ObjectTypeList', ' ULONG ObjectTypeListLength', ' PGENERIC_MAPPING GenericMapping', ' PPRIVILEGE_SET PrivilegeSet', ' PULONG PrivilegeSetLength', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus']
+case 99: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+uint32_t arg5;
+target_ulong arg6;
+target_ulong arg7;
+target_ulong arg8;
+target_ulong arg9;
+target_ulong arg10;
+if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+memcpy(&arg6, rp.params[6], sizeof(target_ulong));
+memcpy(&arg7, rp.params[7], sizeof(target_ulong));
+memcpy(&arg8, rp.params[8], sizeof(target_ulong));
+memcpy(&arg9, rp.params[9], sizeof(target_ulong));
+memcpy(&arg10, rp.params[10], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAccessCheckByTypeResultList_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+}; break;
+// 100 NTSTATUS NtAccessCheckByTypeResultListAndAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' PUNICODE_STRING ObjectTypeName', ' PUNICODE_STRING ObjectName', ' PSECURITY_DESCRIPTOR SecurityDescriptor', ' PSID PrincipalSelfSid', ' ACCESS_MASK DesiredAccess', ' AUDIT_EVENT_TYPE AuditType', ' ULONG Flags', ' POBJECT_TYPE_LIST ObjectTypeList', ' ULONG ObjectTypeListLength', ' PGENERIC_MAPPING GenericMapping', ' BOOLEAN ObjectCreation', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus', ' PBOOLEAN GenerateOnClose']
+case 100: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+uint32_t arg6;
+uint32_t arg7;
+uint32_t arg8;
+target_ulong arg9;
+uint32_t arg10;
+target_ulong arg11;
+uint32_t arg12;
+target_ulong arg13;
+target_ulong arg14;
+target_ulong arg15;
+if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(uint32_t));
+memcpy(&arg7, rp.params[7], sizeof(uint32_t));
+memcpy(&arg8, rp.params[8], sizeof(uint32_t));
+memcpy(&arg9, rp.params[9], sizeof(target_ulong));
+memcpy(&arg10, rp.params[10], sizeof(uint32_t));
+memcpy(&arg11, rp.params[11], sizeof(target_ulong));
+memcpy(&arg12, rp.params[12], sizeof(uint32_t));
+memcpy(&arg13, rp.params[13], sizeof(target_ulong));
+memcpy(&arg14, rp.params[14], sizeof(target_ulong));
+memcpy(&arg15, rp.params[15], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13,arg14,arg15) ; 
+}; break;
+// 101 NTSTATUS NtAccessCheckByTypeResultListAndAuditAlarmByHandle ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' HANDLE ClientToken', ' PUNICODE_STRING ObjectTypeName', ' PUNICODE_STRING ObjectName', ' PSECURITY_DESCRIPTOR SecurityDescriptor', ' PSID PrincipalSelfSid', ' ACCESS_MASK DesiredAccess', ' AUDIT_EVENT_TYPE AuditType', ' ULONG Flags', ' POBJECT_TYPE_LIST ObjectTypeList', ' ULONG ObjectTypeListLength', ' PGENERIC_MAPPING GenericMapping', ' BOOLEAN ObjectCreation', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus', ' PBOOLEAN GenerateOnClose']
+case 101: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+target_ulong arg6;
+uint32_t arg7;
+uint32_t arg8;
+uint32_t arg9;
+target_ulong arg10;
+uint32_t arg11;
+target_ulong arg12;
+uint32_t arg13;
+target_ulong arg14;
+target_ulong arg15;
+target_ulong arg16;
+if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(target_ulong));
+memcpy(&arg7, rp.params[7], sizeof(uint32_t));
+memcpy(&arg8, rp.params[8], sizeof(uint32_t));
+memcpy(&arg9, rp.params[9], sizeof(uint32_t));
+memcpy(&arg10, rp.params[10], sizeof(target_ulong));
+memcpy(&arg11, rp.params[11], sizeof(uint32_t));
+memcpy(&arg12, rp.params[12], sizeof(target_ulong));
+memcpy(&arg13, rp.params[13], sizeof(uint32_t));
+memcpy(&arg14, rp.params[14], sizeof(target_ulong));
+memcpy(&arg15, rp.params[15], sizeof(target_ulong));
+memcpy(&arg16, rp.params[16], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13,arg14,arg15,arg16) ; 
+}; break;
+// 102 NTSTATUS NtAddBootEntry ['PBOOT_ENTRY BootEntry', ' PULONG Id']
+case 102: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtAddBootEntry_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAddBootEntry_return, env,pc,arg0,arg1) ; 
+}; break;
+// 103 NTSTATUS NtAddDriverEntry ['PEFI_DRIVER_ENTRY DriverEntry', ' PULONG Id']
+case 103: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtAddDriverEntry_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAddDriverEntry_return, env,pc,arg0,arg1) ; 
+}; break;
+// 104 NTSTATUS NtAdjustGroupsToken ['HANDLE TokenHandle', ' BOOLEAN ResetToDefault', ' PTOKEN_GROUPS NewState', ' ULONG BufferLength', ' PTOKEN_GROUPS PreviousState', ' PULONG ReturnLength']
+case 104: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_NtAdjustGroupsToken_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAdjustGroupsToken_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 105 NTSTATUS NtAlertResumeThread ['HANDLE ThreadHandle', ' PULONG PreviousSuspendCount']
+case 105: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtAlertResumeThread_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlertResumeThread_return, env,pc,arg0,arg1) ; 
+}; break;
+// 106 NTSTATUS NtAlertThread ['HANDLE ThreadHandle']
+case 106: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtAlertThread_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlertThread_return, env,pc,arg0) ; 
+}; break;
+// 107 NTSTATUS NtAllocateLocallyUniqueId ['PLUID Luid']
+case 107: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAllocateLocallyUniqueId_return, env,pc,arg0) ; 
+}; break;
+// 108 NTSTATUS NtAllocateReserveObject ['PHANDLE MemoryReserveHandle', ' POBJECT_ATTRIBUTES ObjectAttributes', ' MEMORY_RESERVE_TYPE Type']
+case 108: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+if (PPP_CHECK_CB(on_NtAllocateReserveObject_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtAllocateReserveObject_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 109 NTSTATUS NtAllocateUserPhysicalPages ['HANDLE ProcessHandle', ' PULONG_PTR NumberOfPages', ' PULONG_PTR UserPfnArray']
+case 109: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAllocateUserPhysicalPages_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 110 NTSTATUS NtAllocateUuids ['PULARGE_INTEGER Time', ' PULONG Range', ' PULONG Sequence', ' PCHAR Seed']
+case 110: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_NtAllocateUuids_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAllocateUuids_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 111 NTSTATUS NtAlpcAcceptConnectPort ['PHANDLE PortHandle', ' HANDLE ConnectionPortHandle', ' ULONG Flags', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PALPC_PORT_ATTRIBUTES PortAttributes', ' PVOID PortContext', ' PPORT_MESSAGE ConnectionRequest', ' PALPC_MESSAGE_ATTRIBUTES ConnectionMessageAttributes', ' BOOLEAN AcceptConnection']
+case 111: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+target_ulong arg6;
+target_ulong arg7;
+uint32_t arg8;
+if (PPP_CHECK_CB(on_NtAlpcAcceptConnectPort_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(target_ulong));
+memcpy(&arg7, rp.params[7], sizeof(target_ulong));
+memcpy(&arg8, rp.params[8], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtAlpcAcceptConnectPort_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}; break;
+// 112 NTSTATUS NtAlpcCancelMessage ['HANDLE PortHandle', ' ULONG Flags', ' PALPC_CONTEXT_ATTR MessageContext']
+case 112: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtAlpcCancelMessage_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcCancelMessage_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 113 NTSTATUS NtAlpcConnectPort ['PHANDLE PortHandle', ' PUNICODE_STRING PortName', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PALPC_PORT_ATTRIBUTES PortAttributes', ' ULONG Flags', ' PSID RequiredServerSid', ' PPORT_MESSAGE ConnectionMessage', ' PULONG BufferLength', ' PALPC_MESSAGE_ATTRIBUTES OutMessageAttributes', ' PALPC_MESSAGE_ATTRIBUTES InMessageAttributes', ' PLARGE_INTEGER Timeout']
+case 113: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+uint32_t arg4;
+target_ulong arg5;
+target_ulong arg6;
+target_ulong arg7;
+target_ulong arg8;
+target_ulong arg9;
+target_ulong arg10;
+if (PPP_CHECK_CB(on_NtAlpcConnectPort_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(target_ulong));
+memcpy(&arg7, rp.params[7], sizeof(target_ulong));
+memcpy(&arg8, rp.params[8], sizeof(target_ulong));
+memcpy(&arg9, rp.params[9], sizeof(target_ulong));
+memcpy(&arg10, rp.params[10], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcConnectPort_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+}; break;
+// 114 NTSTATUS NtAlpcCreatePort ['PHANDLE PortHandle', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PALPC_PORT_ATTRIBUTES PortAttributes']
+case 114: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtAlpcCreatePort_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcCreatePort_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 115 NTSTATUS NtAlpcCreatePortSection ['HANDLE PortHandle', ' ULONG Flags', ' HANDLE SectionHandle', ' SIZE_T SectionSize', ' PALPC_HANDLE AlpcSectionHandle', ' PSIZE_T ActualSectionSize']
+case 115: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_NtAlpcCreatePortSection_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcCreatePortSection_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 116 NTSTATUS NtAlpcCreateResourceReserve ['HANDLE PortHandle', ' ULONG Flags', ' SIZE_T MessageSize', ' PALPC_HANDLE ResourceId']
+case 116: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_NtAlpcCreateResourceReserve_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcCreateResourceReserve_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 117 NTSTATUS NtAlpcCreateSectionView ['HANDLE PortHandle', ' ULONG Flags', ' PALPC_DATA_VIEW_ATTR ViewAttributes']
+case 117: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtAlpcCreateSectionView_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcCreateSectionView_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 118 NTSTATUS NtAlpcCreateSecurityContext ['HANDLE PortHandle', ' ULONG Flags', ' PALPC_SECURITY_ATTR SecurityAttribute']
+case 118: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtAlpcCreateSecurityContext_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcCreateSecurityContext_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 119 NTSTATUS NtAlpcDeletePortSection ['HANDLE PortHandle', ' ULONG Flags', ' ALPC_HANDLE SectionHandle']
+case 119: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtAlpcDeletePortSection_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcDeletePortSection_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 120 NTSTATUS NtAlpcDeleteResourceReserve ['HANDLE PortHandle', ' ULONG Flags', ' ALPC_HANDLE ResourceId']
+case 120: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtAlpcDeleteResourceReserve_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcDeleteResourceReserve_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 121 NTSTATUS NtAlpcDeleteSectionView ['HANDLE PortHandle', ' ULONG Flags', ' PVOID ViewBase']
+case 121: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtAlpcDeleteSectionView_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcDeleteSectionView_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 122 NTSTATUS NtAlpcDeleteSecurityContext ['HANDLE PortHandle', ' ULONG Flags', ' ALPC_HANDLE ContextHandle']
+case 122: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtAlpcDeleteSecurityContext_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcDeleteSecurityContext_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 123 NTSTATUS NtAlpcDisconnectPort ['HANDLE PortHandle', ' ULONG Flags']
+case 123: {
+target_ulong arg0;
+uint32_t arg1;
+if (PPP_CHECK_CB(on_NtAlpcDisconnectPort_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtAlpcDisconnectPort_return, env,pc,arg0,arg1) ; 
+}; break;
+// 124 NTSTATUS NtAlpcImpersonateClientOfPort ['HANDLE PortHandle', ' PPORT_MESSAGE PortMessage', ' PVOID Reserved']
+case 124: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtAlpcImpersonateClientOfPort_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcImpersonateClientOfPort_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 125 NTSTATUS NtAlpcOpenSenderProcess ['PHANDLE ProcessHandle', ' HANDLE PortHandle', ' PPORT_MESSAGE PortMessage', ' ULONG Flags', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 125: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+uint32_t arg3;
+uint32_t arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_NtAlpcOpenSenderProcess_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcOpenSenderProcess_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 126 NTSTATUS NtAlpcOpenSenderThread ['PHANDLE ThreadHandle', ' HANDLE PortHandle', ' PPORT_MESSAGE PortMessage', ' ULONG Flags', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 126: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+uint32_t arg3;
+uint32_t arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_NtAlpcOpenSenderThread_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcOpenSenderThread_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 127 NTSTATUS NtAlpcQueryInformation ['HANDLE PortHandle', ' ALPC_PORT_INFORMATION_CLASS PortInformationClass', ' PVOID PortInformation', ' ULONG Length', ' PULONG ReturnLength']
+case 127: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtAlpcQueryInformation_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcQueryInformation_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 128 NTSTATUS NtAlpcQueryInformationMessage ['HANDLE PortHandle', ' PPORT_MESSAGE PortMessage', ' ALPC_MESSAGE_INFORMATION_CLASS MessageInformationClass', ' PVOID MessageInformation', ' ULONG Length', ' PULONG ReturnLength']
+case 128: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+target_ulong arg3;
+uint32_t arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_NtAlpcQueryInformationMessage_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcQueryInformationMessage_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 129 NTSTATUS NtAlpcRevokeSecurityContext ['HANDLE PortHandle', ' ULONG Flags', ' ALPC_HANDLE ContextHandle']
+case 129: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtAlpcRevokeSecurityContext_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcRevokeSecurityContext_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 130 NTSTATUS NtAlpcSendWaitReceivePort ['HANDLE PortHandle', ' ULONG Flags', ' PPORT_MESSAGE SendMessage', ' PALPC_MESSAGE_ATTRIBUTES SendMessageAttributes', ' PPORT_MESSAGE ReceiveMessage', ' PULONG BufferLength', ' PALPC_MESSAGE_ATTRIBUTES ReceiveMessageAttributes', ' PLARGE_INTEGER Timeout']
+case 130: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+target_ulong arg6;
+target_ulong arg7;
+if (PPP_CHECK_CB(on_NtAlpcSendWaitReceivePort_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(target_ulong));
+memcpy(&arg7, rp.params[7], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAlpcSendWaitReceivePort_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}; break;
+// 131 NTSTATUS NtAlpcSetInformation ['HANDLE PortHandle', ' ALPC_PORT_INFORMATION_CLASS PortInformationClass', ' PVOID PortInformation', ' ULONG Length']
+case 131: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_NtAlpcSetInformation_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtAlpcSetInformation_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 132 NTSTATUS NtAreMappedFilesTheSame ['PVOID File1MappedAsAnImage', ' PVOID File2MappedAsFile']
+case 132: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAreMappedFilesTheSame_return, env,pc,arg0,arg1) ; 
+}; break;
+// 133 NTSTATUS NtAssignProcessToJobObject ['HANDLE JobHandle', ' HANDLE ProcessHandle']
+case 133: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtAssignProcessToJobObject_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtAssignProcessToJobObject_return, env,pc,arg0,arg1) ; 
+}; break;
+// 134 NTSTATUS NtCancelIoFileEx ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoRequestToCancel', ' PIO_STATUS_BLOCK IoStatusBlock']
+case 134: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtCancelIoFileEx_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCancelIoFileEx_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 135 NTSTATUS NtCancelSynchronousIoFile ['HANDLE ThreadHandle', ' PIO_STATUS_BLOCK IoRequestToCancel', ' PIO_STATUS_BLOCK IoStatusBlock']
+case 135: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtCancelSynchronousIoFile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCancelSynchronousIoFile_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 136 NTSTATUS NtCommitComplete ['HANDLE EnlistmentHandle', ' PLARGE_INTEGER TmVirtualClock']
+case 136: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtCommitComplete_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCommitComplete_return, env,pc,arg0,arg1) ; 
+}; break;
+// 137 NTSTATUS NtCommitEnlistment ['HANDLE EnlistmentHandle', ' PLARGE_INTEGER TmVirtualClock']
+case 137: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtCommitEnlistment_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCommitEnlistment_return, env,pc,arg0,arg1) ; 
+}; break;
+// 138 NTSTATUS NtCommitTransaction ['HANDLE TransactionHandle', ' BOOLEAN Wait']
+case 138: {
+target_ulong arg0;
+uint32_t arg1;
+if (PPP_CHECK_CB(on_NtCommitTransaction_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCommitTransaction_return, env,pc,arg0,arg1) ; 
+}; break;
+// 139 NTSTATUS NtCompactKeys ['ULONG Count', ' HANDLE KeyArray[]']
+case 139: {
+uint32_t arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtCompactKeys_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCompactKeys_return, env,pc,arg0,arg1) ; 
+}; break;
+// 140 NTSTATUS NtCompareTokens ['HANDLE FirstTokenHandle', ' HANDLE SecondTokenHandle', ' PBOOLEAN Equal']
+case 140: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtCompareTokens_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCompareTokens_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 141 NTSTATUS NtCompleteConnectPort ['HANDLE PortHandle']
+case 141: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtCompleteConnectPort_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCompleteConnectPort_return, env,pc,arg0) ; 
+}; break;
+// 142 NTSTATUS NtCompressKey ['HANDLE Key']
+case 142: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtCompressKey_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCompressKey_return, env,pc,arg0) ; 
+}; break;
+// 143 NTSTATUS NtConnectPort ['PHANDLE PortHandle', ' PUNICODE_STRING PortName', ' PSECURITY_QUALITY_OF_SERVICE SecurityQos', ' PPORT_VIEW ClientView', ' PREMOTE_PORT_VIEW ServerView', ' PULONG MaxMessageLength', ' PVOID ConnectionInformation', ' PULONG ConnectionInformationLength']
+case 143: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+target_ulong arg6;
+target_ulong arg7;
+if (PPP_CHECK_CB(on_NtConnectPort_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(target_ulong));
+memcpy(&arg7, rp.params[7], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtConnectPort_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}; break;
+// 144 NTSTATUS NtCreateDebugObject ['PHANDLE DebugObjectHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG Flags']
+case 144: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_NtCreateDebugObject_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCreateDebugObject_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 145 NTSTATUS NtCreateDirectoryObject ['PHANDLE DirectoryHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 145: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtCreateDirectoryObject_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateDirectoryObject_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 146 NTSTATUS NtCreateEnlistment ['PHANDLE EnlistmentHandle', ' ACCESS_MASK DesiredAccess', ' HANDLE ResourceManagerHandle', ' HANDLE TransactionHandle', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG CreateOptions', ' NOTIFICATION_MASK NotificationMask', ' PVOID EnlistmentKey']
+case 146: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+uint32_t arg5;
+uint32_t arg6;
+target_ulong arg7;
+if (PPP_CHECK_CB(on_NtCreateEnlistment_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+memcpy(&arg6, rp.params[6], sizeof(uint32_t));
+memcpy(&arg7, rp.params[7], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateEnlistment_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}; break;
+// 147 NTSTATUS NtCreateEventPair ['PHANDLE EventPairHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 147: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtCreateEventPair_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateEventPair_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 148 NTSTATUS NtCreateIoCompletion ['PHANDLE IoCompletionHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG Count']
+case 148: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_NtCreateIoCompletion_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCreateIoCompletion_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 149 NTSTATUS NtCreateJobObject ['PHANDLE JobHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 149: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtCreateJobObject_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateJobObject_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 150 NTSTATUS NtCreateJobSet ['ULONG NumJob', ' PJOB_SET_ARRAY UserJobSet', ' ULONG Flags']
+case 150: {
+uint32_t arg0;
+target_ulong arg1;
+uint32_t arg2;
+if (PPP_CHECK_CB(on_NtCreateJobSet_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCreateJobSet_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 151 NTSTATUS NtCreateKeyTransacted ['PHANDLE KeyHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG TitleIndex', ' PUNICODE_STRING Class', ' ULONG CreateOptions', ' HANDLE TransactionHandle', ' PULONG Disposition']
+case 151: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+uint32_t arg5;
+target_ulong arg6;
+target_ulong arg7;
+if (PPP_CHECK_CB(on_NtCreateKeyTransacted_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+memcpy(&arg6, rp.params[6], sizeof(target_ulong));
+memcpy(&arg7, rp.params[7], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateKeyTransacted_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}; break;
+// 152 NTSTATUS NtCreateKeyedEvent ['PHANDLE KeyedEventHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG Flags']
+case 152: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_NtCreateKeyedEvent_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCreateKeyedEvent_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 153 NTSTATUS NtCreateMailslotFile ['PHANDLE FileHandle', ' ULONG DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG CreateOptions', ' ULONG MailslotQuota', ' ULONG MaximumMessageSize', ' PLARGE_INTEGER ReadTimeout']
+case 153: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+uint32_t arg4;
+uint32_t arg5;
+uint32_t arg6;
+target_ulong arg7;
+if (PPP_CHECK_CB(on_NtCreateMailslotFile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+memcpy(&arg6, rp.params[6], sizeof(uint32_t));
+memcpy(&arg7, rp.params[7], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateMailslotFile_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}; break;
+// 154 NTSTATUS NtCreateMutant ['PHANDLE MutantHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' BOOLEAN InitialOwner']
+case 154: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_NtCreateMutant_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCreateMutant_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 155 NTSTATUS NtCreateNamedPipeFile ['PHANDLE FileHandle', ' ULONG DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG ShareAccess', ' ULONG CreateDisposition', ' ULONG CreateOptions', ' ULONG NamedPipeType', ' ULONG ReadMode', ' ULONG CompletionMode', ' ULONG MaximumInstances', ' ULONG InboundQuota', ' ULONG OutboundQuota', ' PLARGE_INTEGER DefaultTimeout']
+case 155: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+uint32_t arg4;
+uint32_t arg5;
+uint32_t arg6;
+uint32_t arg7;
+uint32_t arg8;
+uint32_t arg9;
+uint32_t arg10;
+uint32_t arg11;
+uint32_t arg12;
+target_ulong arg13;
+if (PPP_CHECK_CB(on_NtCreateNamedPipeFile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+memcpy(&arg6, rp.params[6], sizeof(uint32_t));
+memcpy(&arg7, rp.params[7], sizeof(uint32_t));
+memcpy(&arg8, rp.params[8], sizeof(uint32_t));
+memcpy(&arg9, rp.params[9], sizeof(uint32_t));
+memcpy(&arg10, rp.params[10], sizeof(uint32_t));
+memcpy(&arg11, rp.params[11], sizeof(uint32_t));
+memcpy(&arg12, rp.params[12], sizeof(uint32_t));
+memcpy(&arg13, rp.params[13], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateNamedPipeFile_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13) ; 
+}; break;
+// 156 NTSTATUS NtCreatePagingFile ['PUNICODE_STRING PageFileName', ' PLARGE_INTEGER MinimumSize', ' PLARGE_INTEGER MaximumSize', ' ULONG Priority']
+case 156: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_NtCreatePagingFile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCreatePagingFile_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 157 NTSTATUS NtCreatePort ['PHANDLE PortHandle', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG MaxConnectionInfoLength', ' ULONG MaxMessageLength', ' ULONG MaxPoolUsage']
+case 157: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+uint32_t arg3;
+uint32_t arg4;
+if (PPP_CHECK_CB(on_NtCreatePort_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCreatePort_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 158 NTSTATUS NtCreatePrivateNamespace ['PHANDLE NamespaceHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PVOID BoundaryDescriptor']
+case 158: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_NtCreatePrivateNamespace_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreatePrivateNamespace_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 159 NTSTATUS NtCreateProcess ['PHANDLE ProcessHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' HANDLE ParentProcess', ' BOOLEAN InheritObjectTable', ' HANDLE SectionHandle', ' HANDLE DebugPort', ' HANDLE ExceptionPort']
+case 159: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+uint32_t arg4;
+target_ulong arg5;
+target_ulong arg6;
+target_ulong arg7;
+if (PPP_CHECK_CB(on_NtCreateProcess_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(target_ulong));
+memcpy(&arg7, rp.params[7], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateProcess_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}; break;
+// 160 NTSTATUS NtCreateProfile ['PHANDLE ProfileHandle', ' HANDLE Process', ' PVOID RangeBase', ' SIZE_T RangeSize', ' ULONG BucketSize', ' PULONG Buffer', ' ULONG BufferSize', ' KPROFILE_SOURCE ProfileSource', ' KAFFINITY Affinity']
+case 160: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+uint32_t arg4;
+target_ulong arg5;
+uint32_t arg6;
+uint32_t arg7;
+target_ulong arg8;
+if (PPP_CHECK_CB(on_NtCreateProfile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(uint32_t));
+memcpy(&arg7, rp.params[7], sizeof(uint32_t));
+memcpy(&arg8, rp.params[8], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateProfile_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}; break;
+// 161 NTSTATUS NtCreateProfileEx ['PHANDLE ProfileHandle', ' HANDLE Process', ' PVOID ProfileBase', ' SIZE_T ProfileSize', ' ULONG BucketSize', ' PULONG Buffer', ' ULONG BufferSize', ' KPROFILE_SOURCE ProfileSource', ' ULONG GroupAffinityCount', ' PGROUP_AFFINITY GroupAffinity']
+case 161: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+uint32_t arg4;
+target_ulong arg5;
+uint32_t arg6;
+uint32_t arg7;
+uint32_t arg8;
+target_ulong arg9;
+if (PPP_CHECK_CB(on_NtCreateProfileEx_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(uint32_t));
+memcpy(&arg7, rp.params[7], sizeof(uint32_t));
+memcpy(&arg8, rp.params[8], sizeof(uint32_t));
+memcpy(&arg9, rp.params[9], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateProfileEx_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+}; break;
+// 162 NTSTATUS NtCreateResourceManager ['PHANDLE ResourceManagerHandle', ' ACCESS_MASK DesiredAccess', ' HANDLE TmHandle', ' LPGUID RmGuid', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG CreateOptions', ' PUNICODE_STRING Description']
+case 162: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+uint32_t arg5;
+target_ulong arg6;
+if (PPP_CHECK_CB(on_NtCreateResourceManager_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+memcpy(&arg6, rp.params[6], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateResourceManager_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+}; break;
+// 163 NTSTATUS NtCreateSemaphore ['PHANDLE SemaphoreHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' LONG InitialCount', ' LONG MaximumCount']
+case 163: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+int32_t arg3;
+int32_t arg4;
+if (PPP_CHECK_CB(on_NtCreateSemaphore_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(int32_t));
+memcpy(&arg4, rp.params[4], sizeof(int32_t));
+}
+PPP_RUN_CB(on_NtCreateSemaphore_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 164 NTSTATUS NtCreateSymbolicLinkObject ['PHANDLE LinkHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PUNICODE_STRING LinkTarget']
+case 164: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateSymbolicLinkObject_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 165 NTSTATUS NtCreateThreadEx ['PHANDLE ThreadHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' HANDLE ProcessHandle', ' PVOID StartRoutine', ' PVOID Argument', ' ULONG CreateFlags', ' ULONG_PTR ZeroBits', ' SIZE_T StackSize', ' SIZE_T MaximumStackSize', ' PPS_ATTRIBUTE_LIST AttributeList']
+case 165: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+uint32_t arg6;
+target_ulong arg7;
+target_ulong arg8;
+target_ulong arg9;
+target_ulong arg10;
+if (PPP_CHECK_CB(on_NtCreateThreadEx_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(uint32_t));
+memcpy(&arg7, rp.params[7], sizeof(target_ulong));
+memcpy(&arg8, rp.params[8], sizeof(target_ulong));
+memcpy(&arg9, rp.params[9], sizeof(target_ulong));
+memcpy(&arg10, rp.params[10], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateThreadEx_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+}; break;
+// 166 NTSTATUS NtCreateTimer ['PHANDLE TimerHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' TIMER_TYPE TimerType']
+case 166: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_NtCreateTimer_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCreateTimer_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 167 NTSTATUS NtCreateToken ['PHANDLE TokenHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' TOKEN_TYPE TokenType', ' PLUID AuthenticationId', ' PLARGE_INTEGER ExpirationTime', ' PTOKEN_USER User', ' PTOKEN_GROUPS Groups', ' PTOKEN_PRIVILEGES Privileges', ' PTOKEN_OWNER Owner', ' PTOKEN_PRIMARY_GROUP PrimaryGroup', ' PTOKEN_DEFAULT_DACL DefaultDacl', ' PTOKEN_SOURCE TokenSource']
+case 167: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+target_ulong arg5;
+target_ulong arg6;
+target_ulong arg7;
+target_ulong arg8;
+target_ulong arg9;
+target_ulong arg10;
+target_ulong arg11;
+target_ulong arg12;
+if (PPP_CHECK_CB(on_NtCreateToken_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(target_ulong));
+memcpy(&arg7, rp.params[7], sizeof(target_ulong));
+memcpy(&arg8, rp.params[8], sizeof(target_ulong));
+memcpy(&arg9, rp.params[9], sizeof(target_ulong));
+memcpy(&arg10, rp.params[10], sizeof(target_ulong));
+memcpy(&arg11, rp.params[11], sizeof(target_ulong));
+memcpy(&arg12, rp.params[12], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateToken_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12) ; 
+}; break;
+// 168 NTSTATUS NtCreateTransaction ['PHANDLE TransactionHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' LPGUID Uow', ' HANDLE TmHandle', ' ULONG CreateOptions', ' ULONG IsolationLevel', ' ULONG IsolationFlags', ' PLARGE_INTEGER Timeout', ' PUNICODE_STRING Description']
+case 168: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+uint32_t arg5;
+uint32_t arg6;
+uint32_t arg7;
+target_ulong arg8;
+target_ulong arg9;
+if (PPP_CHECK_CB(on_NtCreateTransaction_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+memcpy(&arg6, rp.params[6], sizeof(uint32_t));
+memcpy(&arg7, rp.params[7], sizeof(uint32_t));
+memcpy(&arg8, rp.params[8], sizeof(target_ulong));
+memcpy(&arg9, rp.params[9], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateTransaction_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+}; break;
+// 169 NTSTATUS NtCreateTransactionManager ['PHANDLE TmHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PUNICODE_STRING LogFileName', ' ULONG CreateOptions', ' ULONG CommitStrength']
+case 169: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+uint32_t arg4;
+uint32_t arg5;
+if (PPP_CHECK_CB(on_NtCreateTransactionManager_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCreateTransactionManager_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 170 NTSTATUS NtCreateUserProcess ['PHANDLE ProcessHandle', ' PHANDLE ThreadHandle', ' ACCESS_MASK ProcessDesiredAccess', ' ACCESS_MASK ThreadDesiredAccess', ' POBJECT_ATTRIBUTES ProcessObjectAttributes', ' POBJECT_ATTRIBUTES ThreadObjectAttributes', ' ULONG ProcessFlags', ' ULONG ThreadFlags', ' PRTL_USER_PROCESS_PARAMETERS ProcessParameters', ' PPROCESS_CREATE_INFO CreateInfo', ' PPROCESS_ATTRIBUTE_LIST AttributeList']
+case 170: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+uint32_t arg3;
+target_ulong arg4;
+target_ulong arg5;
+uint32_t arg6;
+uint32_t arg7;
+target_ulong arg8;
+target_ulong arg9;
+target_ulong arg10;
+if (PPP_CHECK_CB(on_NtCreateUserProcess_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(uint32_t));
+memcpy(&arg7, rp.params[7], sizeof(uint32_t));
+memcpy(&arg8, rp.params[8], sizeof(target_ulong));
+memcpy(&arg9, rp.params[9], sizeof(target_ulong));
+memcpy(&arg10, rp.params[10], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateUserProcess_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+}; break;
+// 171 NTSTATUS NtCreateWaitablePort ['PHANDLE PortHandle', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG MaxConnectionInfoLength', ' ULONG MaxMessageLength', ' ULONG MaxPoolUsage']
+case 171: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+uint32_t arg3;
+uint32_t arg4;
+if (PPP_CHECK_CB(on_NtCreateWaitablePort_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtCreateWaitablePort_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 172 NTSTATUS NtCreateWorkerFactory ['PHANDLE WorkerFactoryHandleReturn', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' HANDLE CompletionPortHandle', ' HANDLE WorkerProcessHandle', ' PVOID StartRoutine', ' PVOID StartParameter', ' ULONG MaxThreadCount', ' SIZE_T StackReserve', ' SIZE_T StackCommit']
+case 172: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+target_ulong arg6;
+uint32_t arg7;
+target_ulong arg8;
+target_ulong arg9;
+if (PPP_CHECK_CB(on_NtCreateWorkerFactory_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(target_ulong));
+memcpy(&arg7, rp.params[7], sizeof(uint32_t));
+memcpy(&arg8, rp.params[8], sizeof(target_ulong));
+memcpy(&arg9, rp.params[9], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtCreateWorkerFactory_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+}; break;
+// 173 NTSTATUS NtDebugActiveProcess ['HANDLE ProcessHandle', ' HANDLE DebugObjectHandle']
+case 173: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtDebugActiveProcess_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtDebugActiveProcess_return, env,pc,arg0,arg1) ; 
+}; break;
+// 174 NTSTATUS NtDebugContinue ['HANDLE DebugObjectHandle', ' PCLIENT_ID ClientId', ' NTSTATUS ContinueStatus']
+case 174: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+if (PPP_CHECK_CB(on_NtDebugContinue_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtDebugContinue_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 175 NTSTATUS NtDeleteAtom ['RTL_ATOM Atom']
+case 175: {
+uint32_t arg0;
+if (PPP_CHECK_CB(on_NtDeleteAtom_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtDeleteAtom_return, env,pc,arg0) ; 
+}; break;
+// 176 NTSTATUS NtDeleteBootEntry ['ULONG Id']
+case 176: {
+uint32_t arg0;
+if (PPP_CHECK_CB(on_NtDeleteBootEntry_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtDeleteBootEntry_return, env,pc,arg0) ; 
+}; break;
+// 177 NTSTATUS NtDeleteDriverEntry ['ULONG Id']
+case 177: {
+uint32_t arg0;
+if (PPP_CHECK_CB(on_NtDeleteDriverEntry_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtDeleteDriverEntry_return, env,pc,arg0) ; 
+}; break;
+// 178 NTSTATUS NtDeleteFile ['POBJECT_ATTRIBUTES ObjectAttributes']
+case 178: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtDeleteFile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtDeleteFile_return, env,pc,arg0) ; 
+}; break;
+// 179 NTSTATUS NtDeleteKey ['HANDLE KeyHandle']
+case 179: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtDeleteKey_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtDeleteKey_return, env,pc,arg0) ; 
+}; break;
+// 180 NTSTATUS NtDeleteObjectAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' BOOLEAN GenerateOnClose']
+case 180: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+if (PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtDeleteObjectAuditAlarm_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 181 NTSTATUS NtDeletePrivateNamespace ['HANDLE NamespaceHandle']
+case 181: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtDeletePrivateNamespace_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtDeletePrivateNamespace_return, env,pc,arg0) ; 
+}; break;
+// 182 NTSTATUS NtDeleteValueKey ['HANDLE KeyHandle', ' PUNICODE_STRING ValueName']
+case 182: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtDeleteValueKey_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtDeleteValueKey_return, env,pc,arg0,arg1) ; 
+}; break;
+// 183 NTSTATUS NtDisableLastKnownGood ['']
+case 183: {
+if (PPP_CHECK_CB(on_NtDisableLastKnownGood_return)) {
+}
+PPP_RUN_CB(on_NtDisableLastKnownGood_return, env,pc) ; 
+}; break;
+// 184 NTSTATUS NtDisplayString ['PUNICODE_STRING String']
+case 184: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtDisplayString_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtDisplayString_return, env,pc,arg0) ; 
+}; break;
+// 185 NTSTATUS NtDrawText ['PUNICODE_STRING Text']
+case 185: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtDrawText_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtDrawText_return, env,pc,arg0) ; 
+}; break;
+// 186 NTSTATUS NtEnableLastKnownGood ['']
+case 186: {
+if (PPP_CHECK_CB(on_NtEnableLastKnownGood_return)) {
+}
+PPP_RUN_CB(on_NtEnableLastKnownGood_return, env,pc) ; 
+}; break;
+// 187 NTSTATUS NtEnumerateBootEntries ['PVOID Buffer', ' PULONG BufferLength']
+case 187: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtEnumerateBootEntries_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtEnumerateBootEntries_return, env,pc,arg0,arg1) ; 
+}; break;
+// 188 NTSTATUS NtEnumerateDriverEntries ['PVOID Buffer', ' PULONG BufferLength']
+case 188: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtEnumerateDriverEntries_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtEnumerateDriverEntries_return, env,pc,arg0,arg1) ; 
+}; break;
+// 189 NTSTATUS NtEnumerateSystemEnvironmentValuesEx ['ULONG InformationClass', ' PVOID Buffer', ' PULONG BufferLength']
+case 189: {
+uint32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtEnumerateSystemEnvironmentValuesEx_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 190 NTSTATUS NtEnumerateTransactionObject ['HANDLE RootObjectHandle', ' KTMOBJECT_TYPE QueryType', ' PKTMOBJECT_CURSOR ObjectCursor', ' ULONG ObjectCursorLength', ' PULONG ReturnLength']
+case 190: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtEnumerateTransactionObject_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtEnumerateTransactionObject_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 191 NTSTATUS NtExtendSection ['HANDLE SectionHandle', ' PLARGE_INTEGER NewSectionSize']
+case 191: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtExtendSection_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtExtendSection_return, env,pc,arg0,arg1) ; 
+}; break;
+// 192 NTSTATUS NtFilterToken ['HANDLE ExistingTokenHandle', ' ULONG Flags', ' PTOKEN_GROUPS SidsToDisable', ' PTOKEN_PRIVILEGES PrivilegesToDelete', ' PTOKEN_GROUPS RestrictedSids', ' PHANDLE NewTokenHandle']
+case 192: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_NtFilterToken_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtFilterToken_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 193 NTSTATUS NtFlushInstallUILanguage ['LANGID InstallUILanguage', ' ULONG SetComittedFlag']
+case 193: {
+uint32_t arg0;
+uint32_t arg1;
+if (PPP_CHECK_CB(on_NtFlushInstallUILanguage_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtFlushInstallUILanguage_return, env,pc,arg0,arg1) ; 
+}; break;
+// 194 NTSTATUS NtFlushInstructionCache ['HANDLE ProcessHandle', ' PVOID BaseAddress', ' SIZE_T Length']
+case 194: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtFlushInstructionCache_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtFlushInstructionCache_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 195 NTSTATUS NtFlushKey ['HANDLE KeyHandle']
+case 195: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtFlushKey_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtFlushKey_return, env,pc,arg0) ; 
+}; break;
+// 196 VOID NtFlushProcessWriteBuffers ['']
+case 196: {
+if (PPP_CHECK_CB(on_NtFlushProcessWriteBuffers_return)) {
+}
+PPP_RUN_CB(on_NtFlushProcessWriteBuffers_return, env,pc) ; 
+}; break;
+// 197 NTSTATUS NtFlushVirtualMemory ['HANDLE ProcessHandle', ' PVOID *BaseAddress', ' PSIZE_T RegionSize', ' PIO_STATUS_BLOCK IoStatus']
+case 197: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_NtFlushVirtualMemory_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtFlushVirtualMemory_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 198 NTSTATUS NtFlushWriteBuffer ['']
+case 198: {
+if (PPP_CHECK_CB(on_NtFlushWriteBuffer_return)) {
+}
+PPP_RUN_CB(on_NtFlushWriteBuffer_return, env,pc) ; 
+}; break;
+// 199 NTSTATUS NtFreeUserPhysicalPages ['HANDLE ProcessHandle', ' PULONG_PTR NumberOfPages', ' PULONG_PTR UserPfnArray']
+case 199: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtFreeUserPhysicalPages_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtFreeUserPhysicalPages_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 200 NTSTATUS NtFreezeRegistry ['ULONG TimeOutInSeconds']
+case 200: {
+uint32_t arg0;
+if (PPP_CHECK_CB(on_NtFreezeRegistry_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtFreezeRegistry_return, env,pc,arg0) ; 
+}; break;
+// 201 NTSTATUS NtFreezeTransactions ['PLARGE_INTEGER FreezeTimeout', ' PLARGE_INTEGER ThawTimeout']
+case 201: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtFreezeTransactions_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtFreezeTransactions_return, env,pc,arg0,arg1) ; 
+}; break;
+// 202 NTSTATUS NtGetContextThread ['HANDLE ThreadHandle', ' PCONTEXT ThreadContext']
+case 202: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtGetContextThread_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtGetContextThread_return, env,pc,arg0,arg1) ; 
+}; break;
+// 203 ULONG NtGetCurrentProcessorNumber ['']
+case 203: {
+if (PPP_CHECK_CB(on_NtGetCurrentProcessorNumber_return)) {
+}
+PPP_RUN_CB(on_NtGetCurrentProcessorNumber_return, env,pc) ; 
+}; break;
+// 204 NTSTATUS NtGetDevicePowerState ['HANDLE Device', ' DEVICE_POWER_STATE *State']
+case 204: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtGetDevicePowerState_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtGetDevicePowerState_return, env,pc,arg0,arg1) ; 
+}; break;
+// 205 NTSTATUS NtGetMUIRegistryInfo ['ULONG Flags', ' PULONG DataSize', ' PVOID Data']
+case 205: {
+uint32_t arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtGetMUIRegistryInfo_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtGetMUIRegistryInfo_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 206 NTSTATUS NtGetNextProcess ['HANDLE ProcessHandle', ' ACCESS_MASK DesiredAccess', ' ULONG HandleAttributes', ' ULONG Flags', ' PHANDLE NewProcessHandle']
+case 206: {
+target_ulong arg0;
+uint32_t arg1;
+uint32_t arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtGetNextProcess_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtGetNextProcess_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 207 NTSTATUS NtGetNextThread ['HANDLE ProcessHandle', ' HANDLE ThreadHandle', ' ACCESS_MASK DesiredAccess', ' ULONG HandleAttributes', ' ULONG Flags', ' PHANDLE NewThreadHandle']
+case 207: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+uint32_t arg3;
+uint32_t arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_NtGetNextThread_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtGetNextThread_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 208 NTSTATUS NtGetNlsSectionPtr ['ULONG SectionType', ' ULONG SectionData', ' PVOID ContextData', ' PVOID *SectionPointer', ' PULONG SectionSize']
+case 208: {
+uint32_t arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtGetNlsSectionPtr_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtGetNlsSectionPtr_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 209 NTSTATUS NtGetNotificationResourceManager ['HANDLE ResourceManagerHandle', ' PTRANSACTION_NOTIFICATION TransactionNotification', ' ULONG NotificationLength', ' PLARGE_INTEGER Timeout', ' PULONG ReturnLength', ' ULONG Asynchronous', ' ULONG_PTR AsynchronousContext']
+case 209: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+target_ulong arg3;
+target_ulong arg4;
+uint32_t arg5;
+target_ulong arg6;
+if (PPP_CHECK_CB(on_NtGetNotificationResourceManager_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+memcpy(&arg6, rp.params[6], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtGetNotificationResourceManager_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+}; break;
+// 210 NTSTATUS NtGetPlugPlayEvent ['HANDLE EventHandle', ' PVOID Context', ' PPLUGPLAY_EVENT_BLOCK EventBlock', ' ULONG EventBufferSize']
+case 210: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_NtGetPlugPlayEvent_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtGetPlugPlayEvent_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 211 NTSTATUS NtGetWriteWatch ['HANDLE ProcessHandle', ' ULONG Flags', ' PVOID BaseAddress', ' SIZE_T RegionSize', ' PVOID *UserAddressArray', ' PULONG_PTR EntriesInUserAddressArray', ' PULONG Granularity']
+case 211: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+target_ulong arg6;
+if (PPP_CHECK_CB(on_NtGetWriteWatch_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtGetWriteWatch_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+}; break;
+// 212 NTSTATUS NtImpersonateAnonymousToken ['HANDLE ThreadHandle']
+case 212: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtImpersonateAnonymousToken_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtImpersonateAnonymousToken_return, env,pc,arg0) ; 
+}; break;
+// 213 NTSTATUS NtImpersonateThread ['HANDLE ServerThreadHandle', ' HANDLE ClientThreadHandle', ' PSECURITY_QUALITY_OF_SERVICE SecurityQos']
+case 213: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtImpersonateThread_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtImpersonateThread_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 214 NTSTATUS NtInitializeNlsFiles ['PVOID *BaseAddress', ' PLCID DefaultLocaleId', ' PLARGE_INTEGER DefaultCasingTableSize']
+case 214: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtInitializeNlsFiles_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtInitializeNlsFiles_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 215 NTSTATUS NtInitializeRegistry ['USHORT BootCondition']
+case 215: {
+uint32_t arg0;
+if (PPP_CHECK_CB(on_NtInitializeRegistry_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtInitializeRegistry_return, env,pc,arg0) ; 
+}; break;
+// 216 NTSTATUS NtInitiatePowerAction ['POWER_ACTION SystemAction', ' SYSTEM_POWER_STATE MinSystemState', ' ULONG Flags', ' BOOLEAN Asynchronous']
+case 216: {
+uint32_t arg0;
+uint32_t arg1;
+uint32_t arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_NtInitiatePowerAction_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtInitiatePowerAction_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 217 BOOLEAN NtIsSystemResumeAutomatic ['']
+case 217: {
+if (PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_return)) {
+}
+PPP_RUN_CB(on_NtIsSystemResumeAutomatic_return, env,pc) ; 
+}; break;
+// 218 NTSTATUS NtIsUILanguageComitted ['']
+case 218: {
+if (PPP_CHECK_CB(on_NtIsUILanguageComitted_return)) {
+}
+PPP_RUN_CB(on_NtIsUILanguageComitted_return, env,pc) ; 
+}; break;
+// 219 NTSTATUS NtListenPort ['HANDLE PortHandle', ' PPORT_MESSAGE ConnectionRequest']
+case 219: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtListenPort_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtListenPort_return, env,pc,arg0,arg1) ; 
+}; break;
+// 220 NTSTATUS NtLoadDriver ['PUNICODE_STRING DriverServiceName']
+case 220: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtLoadDriver_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtLoadDriver_return, env,pc,arg0) ; 
+}; break;
+// 221 NTSTATUS NtLoadKey ['POBJECT_ATTRIBUTES TargetKey', ' POBJECT_ATTRIBUTES SourceFile']
+case 221: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtLoadKey_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtLoadKey_return, env,pc,arg0,arg1) ; 
+}; break;
+// 222 NTSTATUS NtLoadKey2 ['POBJECT_ATTRIBUTES TargetKey', ' POBJECT_ATTRIBUTES SourceFile', ' ULONG Flags']
+case 222: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+if (PPP_CHECK_CB(on_NtLoadKey2_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtLoadKey2_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 223 NTSTATUS NtLoadKeyEx ['POBJECT_ATTRIBUTES TargetKey', ' POBJECT_ATTRIBUTES SourceFile', ' ULONG Flags', ' HANDLE TrustClassKey ']
+case 223: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_NtLoadKeyEx_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtLoadKeyEx_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 224 NTSTATUS NtLockFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PLARGE_INTEGER ByteOffset', ' PLARGE_INTEGER Length', ' ULONG Key', ' BOOLEAN FailImmediately', ' BOOLEAN ExclusiveLock']
+case 224: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+target_ulong arg6;
+uint32_t arg7;
+uint32_t arg8;
+uint32_t arg9;
+if (PPP_CHECK_CB(on_NtLockFile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(target_ulong));
+memcpy(&arg7, rp.params[7], sizeof(uint32_t));
+memcpy(&arg8, rp.params[8], sizeof(uint32_t));
+memcpy(&arg9, rp.params[9], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtLockFile_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+}; break;
+// 225 NTSTATUS NtLockProductActivationKeys ['ULONG *pPrivateVer', ' ULONG *pSafeMode']
+case 225: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtLockProductActivationKeys_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtLockProductActivationKeys_return, env,pc,arg0,arg1) ; 
+}; break;
+// 226 NTSTATUS NtLockRegistryKey ['HANDLE KeyHandle']
+case 226: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtLockRegistryKey_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtLockRegistryKey_return, env,pc,arg0) ; 
+}; break;
+// 227 NTSTATUS NtLockVirtualMemory ['HANDLE ProcessHandle', ' PVOID *BaseAddress', ' PSIZE_T RegionSize', ' ULONG MapType']
+case 227: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_NtLockVirtualMemory_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtLockVirtualMemory_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 228 NTSTATUS NtMakePermanentObject ['HANDLE Handle']
+case 228: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtMakePermanentObject_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtMakePermanentObject_return, env,pc,arg0) ; 
+}; break;
+// 229 NTSTATUS NtMakeTemporaryObject ['HANDLE Handle']
+case 229: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtMakeTemporaryObject_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtMakeTemporaryObject_return, env,pc,arg0) ; 
+}; break;
+// 230 NTSTATUS NtMapCMFModule ['ULONG What', ' ULONG Index', ' PULONG CacheIndexOut', ' PULONG CacheFlagsOut', ' PULONG ViewSizeOut', ' PVOID *BaseAddress']
+case 230: {
+uint32_t arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_NtMapCMFModule_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtMapCMFModule_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 231 NTSTATUS NtMapUserPhysicalPages ['PVOID VirtualAddress', ' ULONG_PTR NumberOfPages', ' PULONG_PTR UserPfnArray']
+case 231: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtMapUserPhysicalPages_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtMapUserPhysicalPages_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 232 NTSTATUS NtModifyBootEntry ['PBOOT_ENTRY BootEntry']
+case 232: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtModifyBootEntry_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtModifyBootEntry_return, env,pc,arg0) ; 
+}; break;
+// 233 NTSTATUS NtModifyDriverEntry ['PEFI_DRIVER_ENTRY DriverEntry']
+case 233: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtModifyDriverEntry_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtModifyDriverEntry_return, env,pc,arg0) ; 
+}; break;
+// 234 NTSTATUS NtNotifyChangeDirectoryFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length', ' ULONG CompletionFilter', ' BOOLEAN WatchTree']
+case 234: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+uint32_t arg6;
+uint32_t arg7;
+uint32_t arg8;
+if (PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(uint32_t));
+memcpy(&arg7, rp.params[7], sizeof(uint32_t));
+memcpy(&arg8, rp.params[8], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtNotifyChangeDirectoryFile_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}; break;
+// 235 NTSTATUS NtNotifyChangeKey ['HANDLE KeyHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG CompletionFilter', ' BOOLEAN WatchTree', ' PVOID Buffer', ' ULONG BufferSize', ' BOOLEAN Asynchronous']
+case 235: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+uint32_t arg5;
+uint32_t arg6;
+target_ulong arg7;
+uint32_t arg8;
+uint32_t arg9;
+if (PPP_CHECK_CB(on_NtNotifyChangeKey_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+memcpy(&arg6, rp.params[6], sizeof(uint32_t));
+memcpy(&arg7, rp.params[7], sizeof(target_ulong));
+memcpy(&arg8, rp.params[8], sizeof(uint32_t));
+memcpy(&arg9, rp.params[9], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtNotifyChangeKey_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+}; break;
+// 236 NTSTATUS NtNotifyChangeMultipleKeys ['HANDLE MasterKeyHandle', ' ULONG Count', ' OBJECT_ATTRIBUTES SlaveObjects[]', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG CompletionFilter', ' BOOLEAN WatchTree', ' PVOID Buffer', ' ULONG BufferSize', ' BOOLEAN Asynchronous']
+case 236: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+target_ulong arg6;
+uint32_t arg7;
+uint32_t arg8;
+target_ulong arg9;
+uint32_t arg10;
+uint32_t arg11;
+if (PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(target_ulong));
+memcpy(&arg7, rp.params[7], sizeof(uint32_t));
+memcpy(&arg8, rp.params[8], sizeof(uint32_t));
+memcpy(&arg9, rp.params[9], sizeof(target_ulong));
+memcpy(&arg10, rp.params[10], sizeof(uint32_t));
+memcpy(&arg11, rp.params[11], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtNotifyChangeMultipleKeys_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11) ; 
+}; break;
+// 237 NTSTATUS NtNotifyChangeSession ['HANDLE Session', ' ULONG IoStateSequence', ' PVOID Reserved', ' ULONG Action', ' IO_SESSION_STATE IoState', ' IO_SESSION_STATE IoState2', ' PVOID Buffer', ' ULONG BufferSize']
+case 237: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+uint32_t arg4;
+uint32_t arg5;
+target_ulong arg6;
+uint32_t arg7;
+if (PPP_CHECK_CB(on_NtNotifyChangeSession_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+memcpy(&arg6, rp.params[6], sizeof(target_ulong));
+memcpy(&arg7, rp.params[7], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtNotifyChangeSession_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}; break;
+// 238 NTSTATUS NtOpenEnlistment ['PHANDLE EnlistmentHandle', ' ACCESS_MASK DesiredAccess', ' HANDLE ResourceManagerHandle', ' LPGUID EnlistmentGuid', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 238: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtOpenEnlistment_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenEnlistment_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 239 NTSTATUS NtOpenEventPair ['PHANDLE EventPairHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 239: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtOpenEventPair_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenEventPair_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 240 NTSTATUS NtOpenIoCompletion ['PHANDLE IoCompletionHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 240: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtOpenIoCompletion_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenIoCompletion_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 241 NTSTATUS NtOpenJobObject ['PHANDLE JobHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 241: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtOpenJobObject_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenJobObject_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 242 NTSTATUS NtOpenKeyEx ['PHANDLE KeyHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG OpenOptions']
+case 242: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_NtOpenKeyEx_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtOpenKeyEx_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 243 NTSTATUS NtOpenKeyTransacted ['PHANDLE KeyHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' HANDLE TransactionHandle']
+case 243: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_NtOpenKeyTransacted_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenKeyTransacted_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 244 NTSTATUS NtOpenKeyTransactedEx ['PHANDLE KeyHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG OpenOptions', ' HANDLE TransactionHandle']
+case 244: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtOpenKeyTransactedEx_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenKeyTransactedEx_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 245 NTSTATUS NtOpenKeyedEvent ['PHANDLE KeyedEventHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 245: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtOpenKeyedEvent_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenKeyedEvent_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 246 NTSTATUS NtOpenMutant ['PHANDLE MutantHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 246: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtOpenMutant_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenMutant_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 247 NTSTATUS NtOpenObjectAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' PUNICODE_STRING ObjectTypeName', ' PUNICODE_STRING ObjectName', ' PSECURITY_DESCRIPTOR SecurityDescriptor', ' HANDLE ClientToken', ' ACCESS_MASK DesiredAccess', ' ACCESS_MASK GrantedAccess', ' PPRIVILEGE_SET Privileges', ' BOOLEAN ObjectCreation', ' BOOLEAN AccessGranted', ' PBOOLEAN GenerateOnClose']
+case 247: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+uint32_t arg6;
+uint32_t arg7;
+target_ulong arg8;
+uint32_t arg9;
+uint32_t arg10;
+target_ulong arg11;
+if (PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(uint32_t));
+memcpy(&arg7, rp.params[7], sizeof(uint32_t));
+memcpy(&arg8, rp.params[8], sizeof(target_ulong));
+memcpy(&arg9, rp.params[9], sizeof(uint32_t));
+memcpy(&arg10, rp.params[10], sizeof(uint32_t));
+memcpy(&arg11, rp.params[11], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenObjectAuditAlarm_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11) ; 
+}; break;
+// 248 NTSTATUS NtOpenPrivateNamespace ['PHANDLE NamespaceHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PVOID BoundaryDescriptor']
+case 248: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_NtOpenPrivateNamespace_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenPrivateNamespace_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 249 NTSTATUS NtOpenProcessToken ['HANDLE ProcessHandle', ' ACCESS_MASK DesiredAccess', ' PHANDLE TokenHandle']
+case 249: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtOpenProcessToken_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenProcessToken_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 250 NTSTATUS NtOpenResourceManager ['PHANDLE ResourceManagerHandle', ' ACCESS_MASK DesiredAccess', ' HANDLE TmHandle', ' LPGUID ResourceManagerGuid', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 250: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtOpenResourceManager_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenResourceManager_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 251 NTSTATUS NtOpenSemaphore ['PHANDLE SemaphoreHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 251: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtOpenSemaphore_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenSemaphore_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 252 NTSTATUS NtOpenSession ['PHANDLE SessionHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 252: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtOpenSession_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenSession_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 253 NTSTATUS NtOpenSymbolicLinkObject ['PHANDLE LinkHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 253: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenSymbolicLinkObject_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 254 NTSTATUS NtOpenThread ['PHANDLE ThreadHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PCLIENT_ID ClientId']
+case 254: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_NtOpenThread_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenThread_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 255 NTSTATUS NtOpenTimer ['PHANDLE TimerHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
+case 255: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtOpenTimer_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenTimer_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 256 NTSTATUS NtOpenTransaction ['PHANDLE TransactionHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' LPGUID Uow', ' HANDLE TmHandle']
+case 256: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtOpenTransaction_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtOpenTransaction_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 257 NTSTATUS NtOpenTransactionManager ['PHANDLE TmHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PUNICODE_STRING LogFileName', ' LPGUID TmIdentity', ' ULONG OpenOptions']
+case 257: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+uint32_t arg5;
+if (PPP_CHECK_CB(on_NtOpenTransactionManager_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtOpenTransactionManager_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 258 NTSTATUS NtPlugPlayControl ['PLUGPLAY_CONTROL_CLASS PnPControlClass', ' PVOID PnPControlData', ' ULONG PnPControlDataLength']
+case 258: {
+uint32_t arg0;
+target_ulong arg1;
+uint32_t arg2;
+if (PPP_CHECK_CB(on_NtPlugPlayControl_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtPlugPlayControl_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 259 NTSTATUS NtPrePrepareComplete ['HANDLE EnlistmentHandle', ' PLARGE_INTEGER TmVirtualClock']
+case 259: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtPrePrepareComplete_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtPrePrepareComplete_return, env,pc,arg0,arg1) ; 
+}; break;
+// 260 NTSTATUS NtPrePrepareEnlistment ['HANDLE EnlistmentHandle', ' PLARGE_INTEGER TmVirtualClock']
+case 260: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtPrePrepareEnlistment_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtPrePrepareEnlistment_return, env,pc,arg0,arg1) ; 
+}; break;
+// 261 NTSTATUS NtPrepareComplete ['HANDLE EnlistmentHandle', ' PLARGE_INTEGER TmVirtualClock']
+case 261: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtPrepareComplete_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtPrepareComplete_return, env,pc,arg0,arg1) ; 
+}; break;
+// 262 NTSTATUS NtPrepareEnlistment ['HANDLE EnlistmentHandle', ' PLARGE_INTEGER TmVirtualClock']
+case 262: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtPrepareEnlistment_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtPrepareEnlistment_return, env,pc,arg0,arg1) ; 
+}; break;
+// 263 NTSTATUS NtPrivilegeCheck ['HANDLE ClientToken', ' PPRIVILEGE_SET RequiredPrivileges', ' PBOOLEAN Result']
+case 263: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtPrivilegeCheck_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtPrivilegeCheck_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 264 NTSTATUS NtPrivilegeObjectAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' HANDLE ClientToken', ' ACCESS_MASK DesiredAccess', ' PPRIVILEGE_SET Privileges', ' BOOLEAN AccessGranted']
+case 264: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+uint32_t arg5;
+if (PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtPrivilegeObjectAuditAlarm_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 265 NTSTATUS NtPrivilegedServiceAuditAlarm ['PUNICODE_STRING SubsystemName', ' PUNICODE_STRING ServiceName', ' HANDLE ClientToken', ' PPRIVILEGE_SET Privileges', ' BOOLEAN AccessGranted']
+case 265: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+uint32_t arg4;
+if (PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtPrivilegedServiceAuditAlarm_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 266 NTSTATUS NtPropagationComplete ['HANDLE ResourceManagerHandle', ' ULONG RequestCookie', ' ULONG BufferLength', ' PVOID Buffer']
+case 266: {
+target_ulong arg0;
+uint32_t arg1;
+uint32_t arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_NtPropagationComplete_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtPropagationComplete_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 267 NTSTATUS NtPropagationFailed ['HANDLE ResourceManagerHandle', ' ULONG RequestCookie', ' NTSTATUS PropStatus']
+case 267: {
+target_ulong arg0;
+uint32_t arg1;
+uint32_t arg2;
+if (PPP_CHECK_CB(on_NtPropagationFailed_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtPropagationFailed_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 268 NTSTATUS NtPulseEvent ['HANDLE EventHandle', ' PLONG PreviousState']
+case 268: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtPulseEvent_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtPulseEvent_return, env,pc,arg0,arg1) ; 
+}; break;
+// 269 NTSTATUS NtQueryBootEntryOrder ['PULONG Ids', ' PULONG Count']
+case 269: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtQueryBootEntryOrder_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryBootEntryOrder_return, env,pc,arg0,arg1) ; 
+}; break;
+// 270 NTSTATUS NtQueryBootOptions ['PBOOT_OPTIONS BootOptions', ' PULONG BootOptionsLength']
+case 270: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtQueryBootOptions_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryBootOptions_return, env,pc,arg0,arg1) ; 
+}; break;
+// 271 NTSTATUS NtQueryDebugFilterState ['ULONG ComponentId', ' ULONG Level']
+case 271: {
+uint32_t arg0;
+uint32_t arg1;
+if (PPP_CHECK_CB(on_NtQueryDebugFilterState_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtQueryDebugFilterState_return, env,pc,arg0,arg1) ; 
+}; break;
+// 272 NTSTATUS NtQueryDirectoryObject ['HANDLE DirectoryHandle', ' PVOID Buffer', ' ULONG Length', ' BOOLEAN ReturnSingleEntry', ' BOOLEAN RestartScan', ' PULONG Context', ' PULONG ReturnLength']
+case 272: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+uint32_t arg3;
+uint32_t arg4;
+target_ulong arg5;
+target_ulong arg6;
+if (PPP_CHECK_CB(on_NtQueryDirectoryObject_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryDirectoryObject_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+}; break;
+// 273 NTSTATUS NtQueryDriverEntryOrder ['PULONG Ids', ' PULONG Count']
+case 273: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtQueryDriverEntryOrder_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryDriverEntryOrder_return, env,pc,arg0,arg1) ; 
+}; break;
+// 274 NTSTATUS NtQueryEaFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length', ' BOOLEAN ReturnSingleEntry', ' PVOID EaList', ' ULONG EaListLength', ' PULONG EaIndex', ' BOOLEAN RestartScan']
+case 274: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+uint32_t arg3;
+uint32_t arg4;
+target_ulong arg5;
+uint32_t arg6;
+target_ulong arg7;
+uint32_t arg8;
+if (PPP_CHECK_CB(on_NtQueryEaFile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(uint32_t));
+memcpy(&arg7, rp.params[7], sizeof(target_ulong));
+memcpy(&arg8, rp.params[8], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtQueryEaFile_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}; break;
+// 275 NTSTATUS NtQueryFullAttributesFile ['POBJECT_ATTRIBUTES ObjectAttributes', ' PFILE_NETWORK_OPEN_INFORMATION FileInformation']
+case 275: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtQueryFullAttributesFile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryFullAttributesFile_return, env,pc,arg0,arg1) ; 
+}; break;
+// 276 NTSTATUS NtQueryInformationAtom ['RTL_ATOM Atom', ' ATOM_INFORMATION_CLASS InformationClass', ' PVOID AtomInformation', ' ULONG AtomInformationLength', ' PULONG ReturnLength']
+case 276: {
+uint32_t arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtQueryInformationAtom_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryInformationAtom_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 277 NTSTATUS NtQueryInformationEnlistment ['HANDLE EnlistmentHandle', ' ENLISTMENT_INFORMATION_CLASS EnlistmentInformationClass', ' PVOID EnlistmentInformation', ' ULONG EnlistmentInformationLength', ' PULONG ReturnLength']
+case 277: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtQueryInformationEnlistment_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryInformationEnlistment_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 278 NTSTATUS NtQueryInformationJobObject ['HANDLE JobHandle', ' JOBOBJECTINFOCLASS JobObjectInformationClass', ' PVOID JobObjectInformation', ' ULONG JobObjectInformationLength', ' PULONG ReturnLength']
+case 278: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtQueryInformationJobObject_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryInformationJobObject_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 279 NTSTATUS NtQueryInformationPort ['HANDLE PortHandle', ' PORT_INFORMATION_CLASS PortInformationClass', ' PVOID PortInformation', ' ULONG Length', ' PULONG ReturnLength']
+case 279: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtQueryInformationPort_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryInformationPort_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 280 NTSTATUS NtQueryInformationResourceManager ['HANDLE ResourceManagerHandle', ' RESOURCEMANAGER_INFORMATION_CLASS ResourceManagerInformationClass', ' PVOID ResourceManagerInformation', ' ULONG ResourceManagerInformationLength', ' PULONG ReturnLength']
+case 280: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtQueryInformationResourceManager_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryInformationResourceManager_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 281 NTSTATUS NtQueryInformationTransaction ['HANDLE TransactionHandle', ' TRANSACTION_INFORMATION_CLASS TransactionInformationClass', ' PVOID TransactionInformation', ' ULONG TransactionInformationLength', ' PULONG ReturnLength']
+case 281: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtQueryInformationTransaction_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryInformationTransaction_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 282 NTSTATUS NtQueryInformationTransactionManager ['HANDLE TransactionManagerHandle', ' TRANSACTIONMANAGER_INFORMATION_CLASS TransactionManagerInformationClass', ' PVOID TransactionManagerInformation', ' ULONG TransactionManagerInformationLength', ' PULONG ReturnLength']
+case 282: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtQueryInformationTransactionManager_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryInformationTransactionManager_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 283 NTSTATUS NtQueryInformationWorkerFactory ['HANDLE WorkerFactoryHandle', ' WORKERFACTORYINFOCLASS WorkerFactoryInformationClass', ' PVOID WorkerFactoryInformation', ' ULONG WorkerFactoryInformationLength', ' PULONG ReturnLength']
+case 283: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtQueryInformationWorkerFactory_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryInformationWorkerFactory_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 284 NTSTATUS NtQueryInstallUILanguage ['LANGID *InstallUILanguageId']
+case 284: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtQueryInstallUILanguage_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryInstallUILanguage_return, env,pc,arg0) ; 
+}; break;
+// 285 NTSTATUS NtQueryIntervalProfile ['KPROFILE_SOURCE ProfileSource', ' PULONG Interval']
+case 285: {
+uint32_t arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtQueryIntervalProfile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryIntervalProfile_return, env,pc,arg0,arg1) ; 
+}; break;
+// 286 NTSTATUS NtQueryIoCompletion ['HANDLE IoCompletionHandle', ' IO_COMPLETION_INFORMATION_CLASS IoCompletionInformationClass', ' PVOID IoCompletionInformation', ' ULONG IoCompletionInformationLength', ' PULONG ReturnLength']
+case 286: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtQueryIoCompletion_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryIoCompletion_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 287 NTSTATUS NtQueryLicenseValue ['PUNICODE_STRING Name', ' PULONG Type', ' PVOID Buffer', ' ULONG Length', ' PULONG ReturnedLength']
+case 287: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtQueryLicenseValue_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryLicenseValue_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 288 NTSTATUS NtQueryMultipleValueKey ['HANDLE KeyHandle', ' PKEY_VALUE_ENTRY ValueEntries', ' ULONG EntryCount', ' PVOID ValueBuffer', ' PULONG BufferLength', ' PULONG RequiredBufferLength']
+case 288: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_NtQueryMultipleValueKey_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryMultipleValueKey_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 289 NTSTATUS NtQueryMutant ['HANDLE MutantHandle', ' MUTANT_INFORMATION_CLASS MutantInformationClass', ' PVOID MutantInformation', ' ULONG MutantInformationLength', ' PULONG ReturnLength']
+case 289: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtQueryMutant_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryMutant_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 290 NTSTATUS NtQueryOpenSubKeys ['POBJECT_ATTRIBUTES TargetKey', ' PULONG HandleCount']
+case 290: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtQueryOpenSubKeys_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryOpenSubKeys_return, env,pc,arg0,arg1) ; 
+}; break;
+// 291 NTSTATUS NtQueryOpenSubKeysEx ['POBJECT_ATTRIBUTES TargetKey', ' ULONG BufferLength', ' PVOID Buffer', ' PULONG RequiredSize']
+case 291: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_NtQueryOpenSubKeysEx_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryOpenSubKeysEx_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 292 NTSTATUS NtQueryPortInformationProcess ['']
+case 292: {
+if (PPP_CHECK_CB(on_NtQueryPortInformationProcess_return)) {
+}
+PPP_RUN_CB(on_NtQueryPortInformationProcess_return, env,pc) ; 
+}; break;
+// 293 NTSTATUS NtQueryQuotaInformationFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length', ' BOOLEAN ReturnSingleEntry', ' PVOID SidList', ' ULONG SidListLength', ' PULONG StartSid', ' BOOLEAN RestartScan']
+case 293: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+uint32_t arg3;
+uint32_t arg4;
+target_ulong arg5;
+uint32_t arg6;
+target_ulong arg7;
+uint32_t arg8;
+if (PPP_CHECK_CB(on_NtQueryQuotaInformationFile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(uint32_t));
+memcpy(&arg7, rp.params[7], sizeof(target_ulong));
+memcpy(&arg8, rp.params[8], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtQueryQuotaInformationFile_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}; break;
+// 294 NTSTATUS NtQuerySecurityAttributesToken ['HANDLE TokenHandle', ' PUNICODE_STRING Attributes', ' ULONG NumberOfAttributes', ' PVOID Buffer', ' ULONG Length', ' PULONG ReturnLength']
+case 294: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+target_ulong arg3;
+uint32_t arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_NtQuerySecurityAttributesToken_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQuerySecurityAttributesToken_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 295 NTSTATUS NtQuerySecurityObject ['HANDLE Handle', ' SECURITY_INFORMATION SecurityInformation', ' PSECURITY_DESCRIPTOR SecurityDescriptor', ' ULONG Length', ' PULONG LengthNeeded']
+case 295: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtQuerySecurityObject_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQuerySecurityObject_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 296 NTSTATUS NtQuerySemaphore ['HANDLE SemaphoreHandle', ' SEMAPHORE_INFORMATION_CLASS SemaphoreInformationClass', ' PVOID SemaphoreInformation', ' ULONG SemaphoreInformationLength', ' PULONG ReturnLength']
+case 296: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtQuerySemaphore_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQuerySemaphore_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 297 NTSTATUS NtQuerySymbolicLinkObject ['HANDLE LinkHandle', ' PUNICODE_STRING LinkTarget', ' PULONG ReturnedLength']
+case 297: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQuerySymbolicLinkObject_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 298 NTSTATUS NtQuerySystemEnvironmentValue ['PUNICODE_STRING VariableName', ' PWSTR VariableValue', ' USHORT ValueLength', ' PUSHORT ReturnLength']
+case 298: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQuerySystemEnvironmentValue_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 299 NTSTATUS NtQuerySystemEnvironmentValueEx ['PUNICODE_STRING VariableName', ' LPGUID VendorGuid', ' PVOID Value', ' PULONG ValueLength', ' PULONG Attributes']
+case 299: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQuerySystemEnvironmentValueEx_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 300 NTSTATUS NtQuerySystemInformationEx ['SYSTEM_INFORMATION_CLASS SystemInformationClass', ' PVOID QueryInformation', ' ULONG QueryInformationLength', ' PVOID SystemInformation', ' ULONG SystemInformationLength', ' PULONG ReturnLength']
+case 300: {
+uint32_t arg0;
+target_ulong arg1;
+uint32_t arg2;
+target_ulong arg3;
+uint32_t arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_NtQuerySystemInformationEx_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQuerySystemInformationEx_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 301 NTSTATUS NtQueryTimerResolution ['PULONG MaximumTime', ' PULONG MinimumTime', ' PULONG CurrentTime']
+case 301: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtQueryTimerResolution_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueryTimerResolution_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 302 NTSTATUS NtQueueApcThreadEx ['HANDLE ThreadHandle', ' HANDLE UserApcReserveHandle', ' PPS_APC_ROUTINE ApcRoutine', ' PVOID ApcArgument1', ' PVOID ApcArgument2', ' PVOID ApcArgument3']
+case 302: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_NtQueueApcThreadEx_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtQueueApcThreadEx_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 303 NTSTATUS NtRaiseException ['PEXCEPTION_RECORD ExceptionRecord', ' PCONTEXT ContextRecord', ' BOOLEAN FirstChance']
+case 303: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+if (PPP_CHECK_CB(on_NtRaiseException_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtRaiseException_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 304 NTSTATUS NtRaiseHardError ['NTSTATUS ErrorStatus', ' ULONG NumberOfParameters', ' ULONG UnicodeStringParameterMask', ' PULONG_PTR Parameters', ' ULONG ValidResponseOptions', ' PULONG Response']
+case 304: {
+uint32_t arg0;
+uint32_t arg1;
+uint32_t arg2;
+target_ulong arg3;
+uint32_t arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_NtRaiseHardError_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtRaiseHardError_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 305 NTSTATUS NtReadOnlyEnlistment ['HANDLE EnlistmentHandle', ' PLARGE_INTEGER TmVirtualClock']
+case 305: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtReadOnlyEnlistment_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtReadOnlyEnlistment_return, env,pc,arg0,arg1) ; 
+}; break;
+// 306 NTSTATUS NtRecoverEnlistment ['HANDLE EnlistmentHandle', ' PVOID EnlistmentKey']
+case 306: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtRecoverEnlistment_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtRecoverEnlistment_return, env,pc,arg0,arg1) ; 
+}; break;
+// 307 NTSTATUS NtRecoverResourceManager ['HANDLE ResourceManagerHandle']
+case 307: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtRecoverResourceManager_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtRecoverResourceManager_return, env,pc,arg0) ; 
+}; break;
+// 308 NTSTATUS NtRecoverTransactionManager ['HANDLE TransactionManagerHandle']
+case 308: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtRecoverTransactionManager_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtRecoverTransactionManager_return, env,pc,arg0) ; 
+}; break;
+// 309 NTSTATUS NtRegisterProtocolAddressInformation ['HANDLE ResourceManager', ' PCRM_PROTOCOL_ID ProtocolId', ' ULONG ProtocolInformationSize', ' PVOID ProtocolInformation', ' ULONG CreateOptions']
+case 309: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+target_ulong arg3;
+uint32_t arg4;
+if (PPP_CHECK_CB(on_NtRegisterProtocolAddressInformation_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtRegisterProtocolAddressInformation_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 310 NTSTATUS NtRegisterThreadTerminatePort ['HANDLE PortHandle']
+case 310: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtRegisterThreadTerminatePort_return, env,pc,arg0) ; 
+}; break;
+// 311 NTSTATUS NtReleaseKeyedEvent ['HANDLE KeyedEventHandle', ' PVOID KeyValue', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout']
+case 311: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_NtReleaseKeyedEvent_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtReleaseKeyedEvent_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 312 NTSTATUS NtReleaseWorkerFactoryWorker ['HANDLE WorkerFactoryHandle']
+case 312: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtReleaseWorkerFactoryWorker_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtReleaseWorkerFactoryWorker_return, env,pc,arg0) ; 
+}; break;
+// 313 NTSTATUS NtRemoveIoCompletionEx ['HANDLE IoCompletionHandle', ' PFILE_IO_COMPLETION_INFORMATION IoCompletionInformation', ' ULONG Count', ' PULONG NumEntriesRemoved', ' PLARGE_INTEGER Timeout', ' BOOLEAN Alertable']
+case 313: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+target_ulong arg3;
+target_ulong arg4;
+uint32_t arg5;
+if (PPP_CHECK_CB(on_NtRemoveIoCompletionEx_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtRemoveIoCompletionEx_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 314 NTSTATUS NtRemoveProcessDebug ['HANDLE ProcessHandle', ' HANDLE DebugObjectHandle']
+case 314: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtRemoveProcessDebug_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtRemoveProcessDebug_return, env,pc,arg0,arg1) ; 
+}; break;
+// 315 NTSTATUS NtRenameKey ['HANDLE KeyHandle', ' PUNICODE_STRING NewName']
+case 315: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtRenameKey_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtRenameKey_return, env,pc,arg0,arg1) ; 
+}; break;
+// 316 NTSTATUS NtRenameTransactionManager ['PUNICODE_STRING LogFileName', ' LPGUID ExistingTransactionManagerGuid']
+case 316: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtRenameTransactionManager_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtRenameTransactionManager_return, env,pc,arg0,arg1) ; 
+}; break;
+// 317 NTSTATUS NtReplaceKey ['POBJECT_ATTRIBUTES NewFile', ' HANDLE TargetHandle', ' POBJECT_ATTRIBUTES OldFile']
+case 317: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtReplaceKey_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtReplaceKey_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 318 NTSTATUS NtReplacePartitionUnit ['PUNICODE_STRING TargetInstancePath', ' PUNICODE_STRING SpareInstancePath', ' ULONG Flags']
+case 318: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+if (PPP_CHECK_CB(on_NtReplacePartitionUnit_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtReplacePartitionUnit_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 319 NTSTATUS NtReplyWaitReplyPort ['HANDLE PortHandle', ' PPORT_MESSAGE ReplyMessage']
+case 319: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtReplyWaitReplyPort_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtReplyWaitReplyPort_return, env,pc,arg0,arg1) ; 
+}; break;
+// 320 NTSTATUS NtRequestPort ['HANDLE PortHandle', ' PPORT_MESSAGE RequestMessage']
+case 320: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtRequestPort_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtRequestPort_return, env,pc,arg0,arg1) ; 
+}; break;
+// 321 NTSTATUS NtResetEvent ['HANDLE EventHandle', ' PLONG PreviousState']
+case 321: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtResetEvent_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtResetEvent_return, env,pc,arg0,arg1) ; 
+}; break;
+// 322 NTSTATUS NtResetWriteWatch ['HANDLE ProcessHandle', ' PVOID BaseAddress', ' SIZE_T RegionSize']
+case 322: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtResetWriteWatch_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtResetWriteWatch_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 323 NTSTATUS NtRestoreKey ['HANDLE KeyHandle', ' HANDLE FileHandle', ' ULONG Flags']
+case 323: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+if (PPP_CHECK_CB(on_NtRestoreKey_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtRestoreKey_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 324 NTSTATUS NtResumeProcess ['HANDLE ProcessHandle']
+case 324: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtResumeProcess_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtResumeProcess_return, env,pc,arg0) ; 
+}; break;
+// 325 NTSTATUS NtRollbackComplete ['HANDLE EnlistmentHandle', ' PLARGE_INTEGER TmVirtualClock']
+case 325: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtRollbackComplete_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtRollbackComplete_return, env,pc,arg0,arg1) ; 
+}; break;
+// 326 NTSTATUS NtRollbackEnlistment ['HANDLE EnlistmentHandle', ' PLARGE_INTEGER TmVirtualClock']
+case 326: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtRollbackEnlistment_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtRollbackEnlistment_return, env,pc,arg0,arg1) ; 
+}; break;
+// 327 NTSTATUS NtRollbackTransaction ['HANDLE TransactionHandle', ' BOOLEAN Wait']
+case 327: {
+target_ulong arg0;
+uint32_t arg1;
+if (PPP_CHECK_CB(on_NtRollbackTransaction_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtRollbackTransaction_return, env,pc,arg0,arg1) ; 
+}; break;
+// 328 NTSTATUS NtRollforwardTransactionManager ['HANDLE TransactionManagerHandle', ' PLARGE_INTEGER TmVirtualClock']
+case 328: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtRollforwardTransactionManager_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtRollforwardTransactionManager_return, env,pc,arg0,arg1) ; 
+}; break;
+// 329 NTSTATUS NtSaveKey ['HANDLE KeyHandle', ' HANDLE FileHandle']
+case 329: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtSaveKey_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSaveKey_return, env,pc,arg0,arg1) ; 
+}; break;
+// 330 NTSTATUS NtSaveKeyEx ['HANDLE KeyHandle', ' HANDLE FileHandle', ' ULONG Format']
+case 330: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+if (PPP_CHECK_CB(on_NtSaveKeyEx_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSaveKeyEx_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 331 NTSTATUS NtSaveMergedKeys ['HANDLE HighPrecedenceKeyHandle', ' HANDLE LowPrecedenceKeyHandle', ' HANDLE FileHandle']
+case 331: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtSaveMergedKeys_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSaveMergedKeys_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 332 NTSTATUS NtSecureConnectPort ['PHANDLE PortHandle', ' PUNICODE_STRING PortName', ' PSECURITY_QUALITY_OF_SERVICE SecurityQos', ' PPORT_VIEW ClientView', ' PSID RequiredServerSid', ' PREMOTE_PORT_VIEW ServerView', ' PULONG MaxMessageLength', ' PVOID ConnectionInformation', ' PULONG ConnectionInformationLength']
+case 332: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+target_ulong arg4;
+target_ulong arg5;
+target_ulong arg6;
+target_ulong arg7;
+target_ulong arg8;
+if (PPP_CHECK_CB(on_NtSecureConnectPort_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+memcpy(&arg6, rp.params[6], sizeof(target_ulong));
+memcpy(&arg7, rp.params[7], sizeof(target_ulong));
+memcpy(&arg8, rp.params[8], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSecureConnectPort_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}; break;
+// 333 NTSTATUS NtSerializeBoot ['']
+case 333: {
+if (PPP_CHECK_CB(on_NtSerializeBoot_return)) {
+}
+PPP_RUN_CB(on_NtSerializeBoot_return, env,pc) ; 
+}; break;
+// 334 NTSTATUS NtSetBootEntryOrder ['PULONG Ids', ' ULONG Count']
+case 334: {
+target_ulong arg0;
+uint32_t arg1;
+if (PPP_CHECK_CB(on_NtSetBootEntryOrder_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetBootEntryOrder_return, env,pc,arg0,arg1) ; 
+}; break;
+// 335 NTSTATUS NtSetBootOptions ['PBOOT_OPTIONS BootOptions', ' ULONG FieldsToChange']
+case 335: {
+target_ulong arg0;
+uint32_t arg1;
+if (PPP_CHECK_CB(on_NtSetBootOptions_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetBootOptions_return, env,pc,arg0,arg1) ; 
+}; break;
+// 336 NTSTATUS NtSetContextThread ['HANDLE ThreadHandle', ' PCONTEXT ThreadContext']
+case 336: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtSetContextThread_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetContextThread_return, env,pc,arg0,arg1) ; 
+}; break;
+// 337 NTSTATUS NtSetDebugFilterState ['ULONG ComponentId', ' ULONG Level', ' BOOLEAN State']
+case 337: {
+uint32_t arg0;
+uint32_t arg1;
+uint32_t arg2;
+if (PPP_CHECK_CB(on_NtSetDebugFilterState_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetDebugFilterState_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 338 NTSTATUS NtSetDefaultHardErrorPort ['HANDLE DefaultHardErrorPort']
+case 338: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetDefaultHardErrorPort_return, env,pc,arg0) ; 
+}; break;
+// 339 NTSTATUS NtSetDefaultLocale ['BOOLEAN UserProfile', ' LCID DefaultLocaleId']
+case 339: {
+uint32_t arg0;
+uint32_t arg1;
+if (PPP_CHECK_CB(on_NtSetDefaultLocale_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetDefaultLocale_return, env,pc,arg0,arg1) ; 
+}; break;
+// 340 NTSTATUS NtSetDefaultUILanguage ['LANGID DefaultUILanguageId']
+case 340: {
+uint32_t arg0;
+if (PPP_CHECK_CB(on_NtSetDefaultUILanguage_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetDefaultUILanguage_return, env,pc,arg0) ; 
+}; break;
+// 341 NTSTATUS NtSetDriverEntryOrder ['PULONG Ids', ' ULONG Count']
+case 341: {
+target_ulong arg0;
+uint32_t arg1;
+if (PPP_CHECK_CB(on_NtSetDriverEntryOrder_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetDriverEntryOrder_return, env,pc,arg0,arg1) ; 
+}; break;
+// 342 NTSTATUS NtSetEaFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length']
+case 342: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_NtSetEaFile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetEaFile_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 343 NTSTATUS NtSetHighEventPair ['HANDLE EventPairHandle']
+case 343: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtSetHighEventPair_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetHighEventPair_return, env,pc,arg0) ; 
+}; break;
+// 344 NTSTATUS NtSetHighWaitLowEventPair ['HANDLE EventPairHandle']
+case 344: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetHighWaitLowEventPair_return, env,pc,arg0) ; 
+}; break;
+// 345 NTSTATUS NtSetInformationDebugObject ['HANDLE DebugObjectHandle', ' DEBUGOBJECTINFOCLASS DebugObjectInformationClass', ' PVOID DebugInformation', ' ULONG DebugInformationLength', ' PULONG ReturnLength']
+case 345: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtSetInformationDebugObject_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetInformationDebugObject_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 346 NTSTATUS NtSetInformationEnlistment ['HANDLE EnlistmentHandle', ' ENLISTMENT_INFORMATION_CLASS EnlistmentInformationClass', ' PVOID EnlistmentInformation', ' ULONG EnlistmentInformationLength']
+case 346: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_NtSetInformationEnlistment_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetInformationEnlistment_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 347 NTSTATUS NtSetInformationJobObject ['HANDLE JobHandle', ' JOBOBJECTINFOCLASS JobObjectInformationClass', ' PVOID JobObjectInformation', ' ULONG JobObjectInformationLength']
+case 347: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_NtSetInformationJobObject_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetInformationJobObject_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 348 NTSTATUS NtSetInformationKey ['HANDLE KeyHandle', ' KEY_SET_INFORMATION_CLASS KeySetInformationClass', ' PVOID KeySetInformation', ' ULONG KeySetInformationLength']
+case 348: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_NtSetInformationKey_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetInformationKey_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 349 NTSTATUS NtSetInformationResourceManager ['HANDLE ResourceManagerHandle', ' RESOURCEMANAGER_INFORMATION_CLASS ResourceManagerInformationClass', ' PVOID ResourceManagerInformation', ' ULONG ResourceManagerInformationLength']
+case 349: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_NtSetInformationResourceManager_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetInformationResourceManager_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 350 NTSTATUS NtSetInformationToken ['HANDLE TokenHandle', ' TOKEN_INFORMATION_CLASS TokenInformationClass', ' PVOID TokenInformation', ' ULONG TokenInformationLength']
+case 350: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_NtSetInformationToken_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetInformationToken_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 351 NTSTATUS NtSetInformationTransaction ['HANDLE TransactionHandle', ' TRANSACTION_INFORMATION_CLASS TransactionInformationClass', ' PVOID TransactionInformation', ' ULONG TransactionInformationLength']
+case 351: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_NtSetInformationTransaction_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetInformationTransaction_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 352 NTSTATUS NtSetInformationTransactionManager ['HANDLE TmHandle', ' TRANSACTIONMANAGER_INFORMATION_CLASS TransactionManagerInformationClass', ' PVOID TransactionManagerInformation', ' ULONG TransactionManagerInformationLength']
+case 352: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_NtSetInformationTransactionManager_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetInformationTransactionManager_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 353 NTSTATUS NtSetInformationWorkerFactory ['HANDLE WorkerFactoryHandle', ' WORKERFACTORYINFOCLASS WorkerFactoryInformationClass', ' PVOID WorkerFactoryInformation', ' ULONG WorkerFactoryInformationLength']
+case 353: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_NtSetInformationWorkerFactory_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetInformationWorkerFactory_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 354 NTSTATUS NtSetIntervalProfile ['ULONG Interval', ' KPROFILE_SOURCE Source']
+case 354: {
+uint32_t arg0;
+uint32_t arg1;
+if (PPP_CHECK_CB(on_NtSetIntervalProfile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetIntervalProfile_return, env,pc,arg0,arg1) ; 
+}; break;
+// 355 NTSTATUS NtSetIoCompletion ['HANDLE IoCompletionHandle', ' PVOID KeyContext', ' PVOID ApcContext', ' NTSTATUS IoStatus', ' ULONG_PTR IoStatusInformation']
+case 355: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+uint32_t arg3;
+target_ulong arg4;
+if (PPP_CHECK_CB(on_NtSetIoCompletion_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetIoCompletion_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 356 NTSTATUS NtSetIoCompletionEx ['HANDLE IoCompletionHandle', ' HANDLE IoCompletionReserveHandle', ' PVOID KeyContext', ' PVOID ApcContext', ' NTSTATUS IoStatus', ' ULONG_PTR IoStatusInformation']
+case 356: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+uint32_t arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_NtSetIoCompletionEx_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetIoCompletionEx_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 357 NTSTATUS NtSetLdtEntries ['ULONG Selector0', ' ULONG Entry0Low', ' ULONG Entry0Hi', ' ULONG Selector1', ' ULONG Entry1Low', ' ULONG Entry1Hi']
+case 357: {
+uint32_t arg0;
+uint32_t arg1;
+uint32_t arg2;
+uint32_t arg3;
+uint32_t arg4;
+uint32_t arg5;
+if (PPP_CHECK_CB(on_NtSetLdtEntries_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetLdtEntries_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 358 NTSTATUS NtSetLowEventPair ['HANDLE EventPairHandle']
+case 358: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtSetLowEventPair_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetLowEventPair_return, env,pc,arg0) ; 
+}; break;
+// 359 NTSTATUS NtSetLowWaitHighEventPair ['HANDLE EventPairHandle']
+case 359: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetLowWaitHighEventPair_return, env,pc,arg0) ; 
+}; break;
+// 360 NTSTATUS NtSetQuotaInformationFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length']
+case 360: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_NtSetQuotaInformationFile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetQuotaInformationFile_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 361 NTSTATUS NtSetSecurityObject ['HANDLE Handle', ' SECURITY_INFORMATION SecurityInformation', ' PSECURITY_DESCRIPTOR SecurityDescriptor']
+case 361: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtSetSecurityObject_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetSecurityObject_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 362 NTSTATUS NtSetSystemEnvironmentValue ['PUNICODE_STRING VariableName', ' PUNICODE_STRING VariableValue']
+case 362: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetSystemEnvironmentValue_return, env,pc,arg0,arg1) ; 
+}; break;
+// 363 NTSTATUS NtSetSystemEnvironmentValueEx ['PUNICODE_STRING VariableName', ' LPGUID VendorGuid', ' PVOID Value', ' ULONG ValueLength', ' ULONG Attributes']
+case 363: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+uint32_t arg3;
+uint32_t arg4;
+if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValueEx_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetSystemEnvironmentValueEx_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 364 NTSTATUS NtSetSystemInformation ['SYSTEM_INFORMATION_CLASS SystemInformationClass', ' PVOID SystemInformation', ' ULONG SystemInformationLength']
+case 364: {
+uint32_t arg0;
+target_ulong arg1;
+uint32_t arg2;
+if (PPP_CHECK_CB(on_NtSetSystemInformation_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetSystemInformation_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 365 NTSTATUS NtSetSystemPowerState ['POWER_ACTION SystemAction', ' SYSTEM_POWER_STATE MinSystemState', ' ULONG Flags']
+case 365: {
+uint32_t arg0;
+uint32_t arg1;
+uint32_t arg2;
+if (PPP_CHECK_CB(on_NtSetSystemPowerState_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetSystemPowerState_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 366 NTSTATUS NtSetSystemTime ['PLARGE_INTEGER SystemTime', ' PLARGE_INTEGER PreviousTime']
+case 366: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtSetSystemTime_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetSystemTime_return, env,pc,arg0,arg1) ; 
+}; break;
+// 367 NTSTATUS NtSetThreadExecutionState ['EXECUTION_STATE esFlags', ' PEXECUTION_STATE PreviousFlags']
+case 367: {
+uint32_t arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtSetThreadExecutionState_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetThreadExecutionState_return, env,pc,arg0,arg1) ; 
+}; break;
+// 368 NTSTATUS NtSetTimerEx ['HANDLE TimerHandle', ' TIMER_SET_INFORMATION_CLASS TimerSetInformationClass', ' PVOID TimerSetInformation', ' ULONG TimerSetInformationLength']
+case 368: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_NtSetTimerEx_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetTimerEx_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 369 NTSTATUS NtSetTimerResolution ['ULONG DesiredTime', ' BOOLEAN SetResolution', ' PULONG ActualTime']
+case 369: {
+uint32_t arg0;
+uint32_t arg1;
+target_ulong arg2;
+if (PPP_CHECK_CB(on_NtSetTimerResolution_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetTimerResolution_return, env,pc,arg0,arg1,arg2) ; 
+}; break;
+// 370 NTSTATUS NtSetUuidSeed ['PCHAR Seed']
+case 370: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtSetUuidSeed_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSetUuidSeed_return, env,pc,arg0) ; 
+}; break;
+// 371 NTSTATUS NtSetVolumeInformationFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID FsInformation', ' ULONG Length', ' FS_INFORMATION_CLASS FsInformationClass']
+case 371: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+uint32_t arg3;
+uint32_t arg4;
+if (PPP_CHECK_CB(on_NtSetVolumeInformationFile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtSetVolumeInformationFile_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 372 NTSTATUS NtShutdownSystem ['SHUTDOWN_ACTION Action']
+case 372: {
+uint32_t arg0;
+if (PPP_CHECK_CB(on_NtShutdownSystem_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtShutdownSystem_return, env,pc,arg0) ; 
+}; break;
+// 373 NTSTATUS NtShutdownWorkerFactory ['HANDLE WorkerFactoryHandle', ' LONG *PendingWorkerCount']
+case 373: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtShutdownWorkerFactory_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtShutdownWorkerFactory_return, env,pc,arg0,arg1) ; 
+}; break;
+// 374 NTSTATUS NtSignalAndWaitForSingleObject ['HANDLE SignalHandle', ' HANDLE WaitHandle', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout']
+case 374: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSignalAndWaitForSingleObject_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 375 NTSTATUS NtSinglePhaseReject ['HANDLE EnlistmentHandle', ' PLARGE_INTEGER TmVirtualClock']
+case 375: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtSinglePhaseReject_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSinglePhaseReject_return, env,pc,arg0,arg1) ; 
+}; break;
+// 376 NTSTATUS NtStartProfile ['HANDLE ProfileHandle']
+case 376: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtStartProfile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtStartProfile_return, env,pc,arg0) ; 
+}; break;
+// 377 NTSTATUS NtStopProfile ['HANDLE ProfileHandle']
+case 377: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtStopProfile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtStopProfile_return, env,pc,arg0) ; 
+}; break;
+// 378 NTSTATUS NtSuspendProcess ['HANDLE ProcessHandle']
+case 378: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtSuspendProcess_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSuspendProcess_return, env,pc,arg0) ; 
+}; break;
+// 379 NTSTATUS NtSuspendThread ['HANDLE ThreadHandle', ' PULONG PreviousSuspendCount']
+case 379: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtSuspendThread_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSuspendThread_return, env,pc,arg0,arg1) ; 
+}; break;
+// 380 NTSTATUS NtSystemDebugControl ['SYSDBG_COMMAND Command', ' PVOID InputBuffer', ' ULONG InputBufferLength', ' PVOID OutputBuffer', ' ULONG OutputBufferLength', ' PULONG ReturnLength']
+case 380: {
+uint32_t arg0;
+target_ulong arg1;
+uint32_t arg2;
+target_ulong arg3;
+uint32_t arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_NtSystemDebugControl_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtSystemDebugControl_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 381 NTSTATUS NtTerminateJobObject ['HANDLE JobHandle', ' NTSTATUS ExitStatus']
+case 381: {
+target_ulong arg0;
+uint32_t arg1;
+if (PPP_CHECK_CB(on_NtTerminateJobObject_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtTerminateJobObject_return, env,pc,arg0,arg1) ; 
+}; break;
+// 382 NTSTATUS NtTestAlert ['']
+case 382: {
+if (PPP_CHECK_CB(on_NtTestAlert_return)) {
+}
+PPP_RUN_CB(on_NtTestAlert_return, env,pc) ; 
+}; break;
+// 383 NTSTATUS NtThawRegistry ['']
+case 383: {
+if (PPP_CHECK_CB(on_NtThawRegistry_return)) {
+}
+PPP_RUN_CB(on_NtThawRegistry_return, env,pc) ; 
+}; break;
+// 384 NTSTATUS NtThawTransactions ['']
+case 384: {
+if (PPP_CHECK_CB(on_NtThawTransactions_return)) {
+}
+PPP_RUN_CB(on_NtThawTransactions_return, env,pc) ; 
+}; break;
+// 385 NTSTATUS NtTraceControl ['ULONG FunctionCode', ' PVOID InBuffer', ' ULONG InBufferLen', ' PVOID OutBuffer', ' ULONG OutBufferLen', ' PULONG ReturnLength']
+case 385: {
+uint32_t arg0;
+target_ulong arg1;
+uint32_t arg2;
+target_ulong arg3;
+uint32_t arg4;
+target_ulong arg5;
+if (PPP_CHECK_CB(on_NtTraceControl_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+memcpy(&arg5, rp.params[5], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtTraceControl_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}; break;
+// 386 NTSTATUS NtTranslateFilePath ['PFILE_PATH InputFilePath', ' ULONG OutputType', ' PFILE_PATH OutputFilePath', ' PULONG OutputFilePathLength']
+case 386: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_NtTranslateFilePath_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtTranslateFilePath_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 387 NTSTATUS NtUmsThreadYield ['PVOID SchedulerParam']
+case 387: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtUmsThreadYield_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtUmsThreadYield_return, env,pc,arg0) ; 
+}; break;
+// 388 NTSTATUS NtUnloadDriver ['PUNICODE_STRING DriverServiceName']
+case 388: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtUnloadDriver_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtUnloadDriver_return, env,pc,arg0) ; 
+}; break;
+// 389 NTSTATUS NtUnloadKey ['POBJECT_ATTRIBUTES TargetKey']
+case 389: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtUnloadKey_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtUnloadKey_return, env,pc,arg0) ; 
+}; break;
+// 390 NTSTATUS NtUnloadKey2 ['POBJECT_ATTRIBUTES TargetKey', ' ULONG Flags']
+case 390: {
+target_ulong arg0;
+uint32_t arg1;
+if (PPP_CHECK_CB(on_NtUnloadKey2_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtUnloadKey2_return, env,pc,arg0,arg1) ; 
+}; break;
+// 391 NTSTATUS NtUnloadKeyEx ['POBJECT_ATTRIBUTES TargetKey', ' HANDLE Event']
+case 391: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtUnloadKeyEx_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtUnloadKeyEx_return, env,pc,arg0,arg1) ; 
+}; break;
+// 392 NTSTATUS NtUnlockFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PLARGE_INTEGER ByteOffset', ' PLARGE_INTEGER Length', ' ULONG Key']
+case 392: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+target_ulong arg3;
+uint32_t arg4;
+if (PPP_CHECK_CB(on_NtUnlockFile_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtUnlockFile_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}; break;
+// 393 NTSTATUS NtUnlockVirtualMemory ['HANDLE ProcessHandle', ' PVOID *BaseAddress', ' PSIZE_T RegionSize', ' ULONG MapType']
+case 393: {
+target_ulong arg0;
+target_ulong arg1;
+target_ulong arg2;
+uint32_t arg3;
+if (PPP_CHECK_CB(on_NtUnlockVirtualMemory_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+}
+PPP_RUN_CB(on_NtUnlockVirtualMemory_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 394 NTSTATUS NtVdmControl ['VDMSERVICECLASS Service', ' PVOID ServiceData']
+case 394: {
+uint32_t arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtVdmControl_return)) {
+memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtVdmControl_return, env,pc,arg0,arg1) ; 
+}; break;
+// 395 NTSTATUS NtWaitForDebugEvent ['HANDLE DebugObjectHandle', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout', ' PDBGUI_WAIT_STATE_CHANGE WaitStateChange']
+case 395: {
+target_ulong arg0;
+uint32_t arg1;
+target_ulong arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_NtWaitForDebugEvent_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+memcpy(&arg2, rp.params[2], sizeof(target_ulong));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtWaitForDebugEvent_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 396 NTSTATUS NtWaitForKeyedEvent ['HANDLE KeyedEventHandle', ' PVOID KeyValue', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout']
+case 396: {
+target_ulong arg0;
+target_ulong arg1;
+uint32_t arg2;
+target_ulong arg3;
+if (PPP_CHECK_CB(on_NtWaitForKeyedEvent_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+memcpy(&arg3, rp.params[3], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtWaitForKeyedEvent_return, env,pc,arg0,arg1,arg2,arg3) ; 
+}; break;
+// 397 NTSTATUS NtWaitForWorkViaWorkerFactory ['HANDLE WorkerFactoryHandle', ' PFILE_IO_COMPLETION_INFORMATION MiniPacket']
+case 397: {
+target_ulong arg0;
+target_ulong arg1;
+if (PPP_CHECK_CB(on_NtWaitForWorkViaWorkerFactory_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+memcpy(&arg1, rp.params[1], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtWaitForWorkViaWorkerFactory_return, env,pc,arg0,arg1) ; 
+}; break;
+// 398 NTSTATUS NtWaitHighEventPair ['HANDLE EventPairHandle']
+case 398: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtWaitHighEventPair_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtWaitHighEventPair_return, env,pc,arg0) ; 
+}; break;
+// 399 NTSTATUS NtWaitLowEventPair ['HANDLE EventPairHandle']
+case 399: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtWaitLowEventPair_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtWaitLowEventPair_return, env,pc,arg0) ; 
+}; break;
+// 400 NTSTATUS NtWorkerFactoryWorkerReady ['HANDLE WorkerFactoryHandle']
+case 400: {
+target_ulong arg0;
+if (PPP_CHECK_CB(on_NtWorkerFactoryWorkerReady_return)) {
+memcpy(&arg0, rp.params[0], sizeof(target_ulong));
+}
+PPP_RUN_CB(on_NtWorkerFactoryWorkerReady_return, env,pc,arg0) ; 
+}; break;
+default:
+PPP_RUN_CB(on_unknown_sys_return, env, pc, EAX);
+}
+PPP_RUN_CB(on_all_sys_return, env, pc, EAX);
+#endif
+ } 
@@ -1 +1 @@
-python ./syscall_parser.py ./ linux arm linux x86 windows7 x86 windowsxp_sp2 x86 windowsxp_sp3 x86
+python ./syscall_parser.py ./ linux arm linux x86 windows7 x86 windowsxp_sp2 x86 windowsxp_sp3 x86 linux x64 windows7 x64
@@ -24,11 +24,12 @@ from sys import argv,exit
 
 KNOWN_OS = set(["linux", "windows7", "windowsxp_sp2", "windowsxp_sp3"])
 arch32 = set(['x86', 'arm'])
+KNOWN_ARCH = arch32 | set(['x64'])
 
 def usage():
     print "Usage syscall_parser.py <destdir> <os> <arch> [<os> <arch> ...]"
     print "os can be", " or ".join(KNOWN_OS)
-    print "arch can be x86 or arm"
+    print "arch can be x86, x64 or arm"
     exit(1)
 
 if len(argv[2:]) % 2 != 0:
@@ -46,6 +47,10 @@ if not os.path.isdir(DESTDIR):
 typedefs = defaultdict(set)
 cb_names_enter = defaultdict(set)
 cb_names_return = defaultdict(set)
+# Argument types of each callback, per guard. 32- and 64-bit x86 guests
+# share one build (and one set of callbacks) under TARGET_I386, so the
+# same callback name must come out with the same types for every profile.
+cb_arg_types = {}
 
 # Common to every OS, so we put them here
 # A little goofy, but we use #if 1 as the keyname because it will
@@ -63,20 +68,30 @@ for OS, ARCH in zip(argv[2::2], argv[3::2]):
     if OS not in KNOWN_OS:
         usage()
 
-    if not (ARCH == 'arm' or ARCH == 'x86'):
+    if ARCH not in KNOWN_ARCH:
         usage()
 
     print "os is [%s] arch is [%s]" % (OS, ARCH)
 
+    # GUARD protects the callback typedefs and PPP boilerplate,
+    # SWITCH_GUARD the generated switch itself.
     if ARCH=="x86":
         CALLNO="EAX"
         SP = "ESP" 
         GUARD = "#ifdef TARGET_I386" 
+        SWITCH_GUARD = GUARD
+
+    if ARCH=="x64":
+        CALLNO="EAX"
+        SP = "ESP"
+        GUARD = "#ifdef TARGET_I386"
+        SWITCH_GUARD = "#ifdef TARGET_X86_64"
 
     if ARCH=="arm":
         CALLNO = "env->regs[7]"
         SP = "env->regs[13]"
         GUARD = "#ifdef TARGET_ARM"
+        SWITCH_GUARD = GUARD
 
        
     osarch = "%s_%s" % (OS, ARCH)
@@ -99,6 +114,14 @@ for OS, ARCH in zip(argv[2::2], argv[3::2]):
                 'PUCHAR', 'PULARGE_INTEGER', 'PULONG', 'PULONG_PTR', 'PUNICODE_STRING', 'PVOID', 'PWSTR']
     types_16 = ['old_uid_t', 'uid_t', 'mode_t', 'gid_t', 'pid_t', 'USHORT']
     types_pointer = ['cap_user_data_t', 'cap_user_header_t', '__sighandler_t', '...']
+    # Types as wide as a guest register: 4 bytes on x86, 8 on x64
+    types_word = ["unsigned long", "size_t", "off_t", 'SIZE_T', 'HANDLE', 'ULONG_PTR', 'KAFFINITY']
+    # Windows types that start with P but are not pointers
+    win_not_pointer = ['POWER_ACTION', 'POWER_INFORMATION_LEVEL']
+    def is_win_pointer_type(arg):
+        t = arg.split()[0]
+        return (OS != 'linux' and re.match("^L?P[A-Z]", t) is not None
+                and not t.endswith('CLASS') and t not in win_not_pointer)
 
     syscall_enter_switch = """
 
@@ -118,12 +141,14 @@ extern "C" {
 
 void syscall_enter_switch_%s ( CPUState *env, target_ulong pc ) {  // osarch
 %s                                          // GUARD
-    ReturnPoint rp;
+    // zeroed so a return callback registered after this enter sees 0s,
+    // not stack garbage, for args nobody asked us to save
+    ReturnPoint rp = {};
     rp.ordinal = %s;                        // CALLNO
     rp.proc_id = panda_current_asid(env);
     rp.retaddr = calc_retaddr(env, pc);
     switch( %s ) {                          // CALLNO
-""" % (osarch, GUARD, CALLNO, CALLNO)
+""" % (osarch, SWITCH_GUARD, CALLNO, CALLNO)
 
 
     syscall_return_switch = """
@@ -144,7 +169,7 @@ extern "C" {
 void syscall_return_switch_%s ( CPUState *env, target_ulong pc, target_ulong ordinal, ReturnPoint &rp) {  // osarch
 %s                                          // GUARD
     switch( ordinal ) {                          // CALLNO
-""" % (osarch, GUARD)
+""" % (osarch, SWITCH_GUARD)
 
 
 
@@ -156,9 +181,15 @@ void syscall_return_switch_%s ( CPUState *env, target_ulong pc, target_ulong ord
     BYTES_4   = '4BYTE'
     BYTES_2   = '2BYTE'
     SIGNED_4  = '4SIGNED'
-    # C types for callback arguments
-    ARG_TYPE_C_TRANSLATIONS = { CHAR_STAR:  'uint32_t' if ARCH in arch32 else 'uint64_t', # pointer
-                                POINTER:    'uint32_t' if ARCH in arch32 else 'uint64_t', # pointer
+    WORD      = 'WORD'
+    SIGNED_WORD = 'SWORD'
+    # C types for callback arguments. On x86 anything register-sized is a
+    # target_ulong, so that 32- and 64-bit guests can share callbacks.
+    x86_family = ARCH in ['x86', 'x64']
+    ARG_TYPE_C_TRANSLATIONS = { CHAR_STAR:  'target_ulong' if x86_family else 'uint32_t', # pointer
+                                POINTER:    'target_ulong' if x86_family else 'uint32_t', # pointer
+                                WORD:       'target_ulong' if x86_family else 'uint32_t',
+                                SIGNED_WORD: 'target_long' if x86_family else 'int32_t',
                                 BYTES_8:    'uint64_t',
                                 BYTES_4:    'uint32_t',
                                 SIGNED_4:   'int32_t',
@@ -170,8 +201,18 @@ void syscall_return_switch_%s ( CPUState *env, target_ulong pc, target_ulong ord
     # Functions to emit the code that gets the nth syscall argument of a
     # given type.
     def get_pointer(argnum):
-        return get_32(argnum) if ARCH in arch32 else get_64(argnum)
-        
+        return get_word(argnum)
+
+    def get_word(argnum):
+        ctype = ARG_TYPE_C_TRANSLATIONS[WORD]
+        getter = "get_32" if ARCH in arch32 else "get_64"
+        return "%s arg%d = %s(env, %d);\n" % (ctype, argnum, getter, argnum)
+
+    def get_sword(argnum):
+        ctype = ARG_TYPE_C_TRANSLATIONS[SIGNED_WORD]
+        getter = "get_s32" if ARCH in arch32 else "get_s64"
+        return "%s arg%d = %s(env, %d);\n" % (ctype, argnum, getter, argnum)
+
     def get_32(argnum):
         return "uint32_t arg%d = get_32(env, %d);\n" % (argnum, argnum)
 
@@ -258,12 +299,18 @@ void syscall_return_switch_%s ( CPUState *env, target_ulong pc, target_ulong ord
                 if charre.search(arg) and not argname.endswith('buf') and argname != '...' and not argname.endswith('[]'):
                     thisarg.type = CHAR_STAR
                     arg_types.append(thisarg)
-                elif '*' in arg or any([x in arg for x in types_pointer]) or argname.endswith('[]'):
+                elif '*' in arg or any([x in arg for x in types_pointer]) or argname.endswith('[]') or is_win_pointer_type(arg):
                     thisarg.type = POINTER
                     arg_types.append(thisarg)
                 elif any([x in arg for x in types_64]):
                     thisarg.type = BYTES_8
                     arg_types.append(thisarg)
+                elif any([x in arg for x in types_word]):
+                    thisarg.type = WORD
+                    arg_types.append(thisarg)
+                elif re.search(r"\blong\b", arg) and 'unsigned' not in arg:
+                    thisarg.type = SIGNED_WORD
+                    arg_types.append(thisarg)
                 elif any([x in arg for x in types_32]) or any([x in arg for x in types_16]):
                     thisarg.type = BYTES_4
                     arg_types.append(thisarg)
@@ -283,6 +330,10 @@ void syscall_return_switch_%s ( CPUState *env, target_ulong pc, target_ulong ord
 
             syscall_enter_switch += "case " + callno + ": {\n"
             syscall_return_switch += "case " + callno + ": {\n"
+            # Don't read the arguments out of the guest unless someone is
+            # listening for this syscall
+            if arg_types:
+                syscall_enter_switch += "if (PPP_CHECK_CB(on_{0}_enter) || PPP_CHECK_CB(on_{0}_return)) {{\n".format(callname)
             argno = 0
             for i, val in enumerate(arg_types):
                 arg_type = val.type
@@ -291,6 +342,10 @@ void syscall_return_switch_%s ( CPUState *env, target_ulong pc, target_ulong ord
                     syscall_enter_switch += get_pointer(i)
                 elif arg_type == POINTER:
                     syscall_enter_switch += get_pointer(i)
+                elif arg_type == WORD:
+                    syscall_enter_switch += get_word(i)
+                elif arg_type == SIGNED_WORD:
+                    syscall_enter_switch += get_sword(i)
                 elif arg_type == BYTES_4:
                     syscall_enter_switch += get_32(i)
                 elif arg_type == SIGNED_4:
@@ -308,10 +363,20 @@ void syscall_return_switch_%s ( CPUState *env, target_ulong pc, target_ulong ord
             _c_args = ",".join(['env', 'pc'] + ["arg%d" % i for i in range(len(arg_types))])
             # declaration info (type and name) for each arg passed to C++ and C callbacks
             _c_args_types = ",".join(['CPUState* env', 'target_ulong pc'] + [ARG_TYPE_C_TRANSLATIONS[x.type] + " " + x.name for i, x in enumerate(arg_types)])
-            typedef = "typedef void (*on_{0}_t)({1});".format(callname + "_enter", _c_args_types)
-            typedefs[GUARD].add(typedef)
-            typedef = "typedef void (*on_{0}_t)({1});".format(callname + "_return", _c_args_types)
-            typedefs[GUARD].add(typedef )
+            _c_types = [ARG_TYPE_C_TRANSLATIONS[x.type] for x in arg_types]
+            if (GUARD, callname) in cb_arg_types:
+                if cb_arg_types[(GUARD, callname)] != _c_types:
+                    print "ERROR: %s has different argument types in %s than in an earlier profile: %s vs %s" % \
+                        (callname, osarch, _c_types, cb_arg_types[(GUARD, callname)])
+                    exit(1)
+                # already declared by an earlier profile
+                _c_args_types = None
+            cb_arg_types[(GUARD, callname)] = _c_types
+            if _c_args_types is not None:
+                typedef = "typedef void (*on_{0}_t)({1});".format(callname + "_enter", _c_args_types)
+                typedefs[GUARD].add(typedef)
+                typedef = "typedef void (*on_{0}_t)({1});".format(callname + "_return", _c_args_types)
+                typedefs[GUARD].add(typedef )
             cb_names_enter[GUARD].add("on_{0}".format(callname + "_enter"))
             cb_names_return[GUARD].add("on_{0}".format(callname + "_return"))
             # Marshal the args into the ReturnPoint for use at the return site
@@ -330,6 +395,8 @@ void syscall_return_switch_%s ( CPUState *env, target_ulong pc, target_ulong ord
             syscall_return_switch += "}\n"
             # prototype for the C++ callback (with arg types and names)
             syscall_enter_switch += "PPP_RUN_CB(on_{0}_enter, {1}) ; \n".format(callname, _c_args)
+            if arg_types:
+                syscall_enter_switch += "}\n"
             syscall_enter_switch += "}; break;"+'\n'
             syscall_return_switch += "PPP_RUN_CB(on_{0}_return, {1}) ; \n".format(callname, _c_args)
             syscall_return_switch += "}; break;"+'\n'
@@ -35,6 +35,7 @@ extern "C" {
 #include <vector>
 
 #include "syscalls2.h"
+#include "../common/open_hash.h"
 
 bool translate_callback(CPUState *env, target_ulong pc);
 int exec_callback(CPUState *env, target_ulong pc);
@@ -53,9 +54,11 @@ void registerExecPreCallback(void (*callback)(CPUState*, target_ulong));
 #include "gen_syscall_ppp_register_return.cpp"
 
 }
+typedef std::pair<target_ulong, target_ulong> pc_asid_t;
+typedef open_hash_pair<target_ulong, target_ulong> pc_asid_hash;
+
 // Used to confirm that entry into syscalls2 exec callback is from the sycalls2 translate callback
-std::set<std::pair <target_ulong, target_ulong>> syscallPCpoints; 
-//std::set<target_ulong> syscallPCpoints; 
+OpenHashMap<pc_asid_t, bool, pc_asid_hash> syscallPCpoints;
 
 // Forward declarations
 int32_t get_s32_generic(CPUState *env, uint32_t argnum);
@@ -117,6 +120,17 @@ target_ulong calc_retaddr_linux_x86(CPUState* env, target_ulong pc) {
 #endif
 }
 
+// On x86_64 the syscall instruction returns to the instruction right
+// after it, for both Linux and Windows.
+target_ulong calc_retaddr_x64(CPUState* env, target_ulong pc) {
+#if defined(TARGET_X86_64)
+    return pc+2;
+#else
+    // shouldn't happen
+    assert (1==0);
+#endif
+}
+
 target_ulong calc_retaddr_linux_arm(CPUState* env, target_ulong pc) {
 #if defined(TARGET_ARM)
     // Normal syscalls: return addr is stored in LR
@@ -165,6 +179,29 @@ uint32_t get_linux_x86_argnum(CPUState *env, uint32_t argnum) {
     return 0;
 }
 
+// x86_64 Linux: rdi, rsi, rdx, r10, r8, r9. The kernel only clobbers rax,
+// rcx and r11, so these are still valid at return.
+uint64_t get_linux_x64_argnum(CPUState *env, uint32_t argnum) {
+#if defined(TARGET_X86_64)
+    switch (argnum) {
+    case 0:
+        return env->regs[R_EDI];
+    case 1:
+        return env->regs[R_ESI];
+    case 2:
+        return env->regs[R_EDX];
+    case 3:
+        return env->regs[10];
+    case 4:
+        return env->regs[8];
+    case 5:
+        return env->regs[9];
+    }
+    assert (1==0);
+#endif
+    return 0;
+}
+
 static uint32_t get_win_syscall_arg(CPUState* env, int nr) {
 #if defined(TARGET_I386)
     // At sysenter on Windows7, args start at EDX+8
@@ -176,6 +213,29 @@ static uint32_t get_win_syscall_arg(CPUState* env, int nr) {
     return 0;
 }
 
+// x86_64 Windows: the ntdll stub copies rcx to r10, so the first four
+// args are r10, rdx, r8, r9. The rest are on the stack above the return
+// address and the 4-slot home area.
+static uint64_t get_win64_syscall_arg(CPUState* env, int nr) {
+#if defined(TARGET_X86_64)
+    switch (nr) {
+    case 0:
+        return env->regs[10];
+    case 1:
+        return env->regs[R_EDX];
+    case 2:
+        return env->regs[8];
+    case 3:
+        return env->regs[9];
+    }
+    uint64_t arg = 0;
+    panda_virtual_memory_rw(env, env->regs[R_ESP] + 8 + (8*nr),
+                            (uint8_t *) &arg, 8, false);
+    return arg;
+#endif
+    return 0;
+}
+
 uint32_t get_32_linux_x86 (CPUState *env, uint32_t argnum) {
     assert (argnum < 6);
     return (uint32_t) get_linux_x86_argnum(env, argnum);
@@ -188,6 +248,14 @@ uint32_t get_32_windows_x86 (CPUState *env, uint32_t argnum) {
     return (uint32_t) get_win_syscall_arg(env, argnum);
 }
 
+uint32_t get_32_linux_x64 (CPUState *env, uint32_t argnum) {
+    assert (argnum < 6);
+    return (uint32_t) get_linux_x64_argnum(env, argnum);
+}
+uint32_t get_32_windows_x64 (CPUState *env, uint32_t argnum) {
+    return (uint32_t) get_win64_syscall_arg(env, argnum);
+}
+
 uint64_t get_64_linux_x86(CPUState *env, uint32_t argnum) {
     assert (argnum < 6);
     return (((uint64_t) get_linux_x86_argnum(env, argnum)) << 32) | (get_linux_x86_argnum(env, argnum));
@@ -198,6 +266,15 @@ uint64_t get_64_linux_arm(CPUState *env, uint32_t argnum) {
     return (((uint64_t) env->regs[argnum]) << 32) | (env->regs[argnum+1]);
 }
 
+uint64_t get_64_linux_x64(CPUState *env, uint32_t argnum) {
+    assert (argnum < 6);
+    return get_linux_x64_argnum(env, argnum);
+}
+
+uint64_t get_64_windows_x64(CPUState *env, uint32_t argnum) {
+    return get_win64_syscall_arg(env, argnum);
+}
+
 uint64_t get_64_windows_x86(CPUState *env, uint32_t argnum) {
     assert (false && "64-bit arguments not supported on Windows 7 x86");
     return 0;
@@ -216,6 +293,37 @@ static uint32_t get_win_syscall_return_arg(CPUState* env, int nr) {
 #endif
 }
 
+// Windows x64 register arguments of the syscall being entered, saved by
+// exec_callback and copied into its ReturnPoint by appendReturnPoint
+static uint64_t win64_enter_reg_args[4];
+// the ReturnPoint whose return callbacks are running
+static const ReturnPoint *current_return;
+
+static uint64_t get_win64_syscall_return_arg(CPUState* env, int nr) {
+#if defined(TARGET_X86_64)
+    // The register arguments are volatile and gone by now, so hand back
+    // the values saved at entry.
+    if (nr < 4) {
+        return current_return ? current_return->reg_args[nr] : 0;
+    }
+    // rsp is unchanged when we get back to the stub
+    uint64_t arg = 0;
+    panda_virtual_memory_rw(env, env->regs[R_ESP] + 8 + (8*nr),
+                            (uint8_t *) &arg, 8, false);
+    return arg;
+#else
+    return 0;
+#endif
+}
+
+uint32_t get_return_32_windows_x64 (CPUState *env, uint32_t argnum) {
+    return (uint32_t) get_win64_syscall_return_arg(env, argnum);
+}
+
+uint64_t get_return_64_windows_x64(CPUState *env, uint32_t argnum) {
+    return get_win64_syscall_return_arg(env, argnum);
+}
+
 uint32_t get_return_32_windows_x86 (CPUState *env, uint32_t argnum) {
     return get_win_syscall_return_arg(env, argnum);
 }
@@ -230,6 +338,8 @@ enum ProfileType {
     PROFILE_WINDOWSXP_SP2_X86,
     PROFILE_WINDOWSXP_SP3_X86,
     PROFILE_WINDOWS7_X86,
+    PROFILE_LINUX_X64,
+    PROFILE_WINDOWS7_X64,
     PROFILE_LAST
 };
 
@@ -318,6 +428,34 @@ Profile profiles[PROFILE_LAST] = {
         .get_return_s32 = get_return_s32_generic,
         .get_return_64 = get_return_64_windows_x86,
         .get_return_s64 = get_return_s64_generic,
+    },
+    {
+        .enter_switch = syscall_enter_switch_linux_x64,
+        .return_switch = syscall_return_switch_linux_x64,
+        .get_return_val = get_return_val_x86,
+        .calc_retaddr = calc_retaddr_x64,
+        .get_32 = get_32_linux_x64,
+        .get_s32 = get_s32_generic,
+        .get_64 = get_64_linux_x64,
+        .get_s64 = get_s64_generic,
+        .get_return_32 = get_32_linux_x64,
+        .get_return_s32 = get_return_s32_generic,
+        .get_return_64 = get_64_linux_x64,
+        .get_return_s64 = get_return_s64_generic,
+    },
+    {
+        .enter_switch = syscall_enter_switch_windows7_x64,
+        .return_switch = syscall_return_switch_windows7_x64,
+        .get_return_val = get_return_val_x86,
+        .calc_retaddr = calc_retaddr_x64,
+        .get_32 = get_32_windows_x64,
+        .get_s32 = get_s32_generic,
+        .get_64 = get_64_windows_x64,
+        .get_s64 = get_s64_generic,
+        .get_return_32 = get_return_32_windows_x64,
+        .get_return_s32 = get_return_s32_generic,
+        .get_return_64 = get_return_64_windows_x64,
+        .get_return_s64 = get_return_s64_generic,
     }
 };
 
@@ -378,24 +516,44 @@ void registerExecPreCallback(void (*callback)(CPUState*, target_ulong)){
 }
 
 // always return to same process
-static std::map < std::pair < target_ulong, target_ulong >, ReturnPoint > returns; 
+static OpenHashMap<pc_asid_t, ReturnPoint, pc_asid_hash> returns;
+
+// Counting filter over the return addresses in returns, so the
+// before-block check can reject almost every block on tb->pc alone,
+// without computing the asid or probing the table.
+#define RETADDR_FILTER_BITS 12
+static uint16_t retaddr_filter[1 << RETADDR_FILTER_BITS];
+
+static inline uint32_t retaddr_filter_idx(target_ulong pc) {
+    return open_hash_mix(pc) & ((1 << RETADDR_FILTER_BITS) - 1);
+}
 
 void appendReturnPoint(ReturnPoint &rp){
-    returns[std::make_pair(rp.retaddr,rp.proc_id)] = rp;
+    memcpy(rp.reg_args, win64_enter_reg_args, sizeof(rp.reg_args));
+    if (returns.insert(std::make_pair(rp.retaddr,rp.proc_id), rp)) {
+        retaddr_filter[retaddr_filter_idx(rp.retaddr)]++;
+    }
 }
 
 
 static int returned_check_callback(CPUState *env, TranslationBlock* tb){
+    // Nearly always nothing is outstanding, or nothing is due at this pc
+    if (likely(returns.empty())) return false;
+    if (likely(retaddr_filter[retaddr_filter_idx(tb->pc)] == 0)) return false;
+
     // check if any of the internally tracked syscalls has returned
     // only one should be at its return point for any given basic block
-    std::pair < target_ulong, target_ulong > ret_key = std::make_pair(tb->pc, panda_current_asid(env));
-    if (returns.count(ret_key) != 0) {
-        ReturnPoint &retVal = returns[ret_key];
-        syscalls_profile->return_switch(env, tb->pc, retVal.ordinal, retVal);
-        // used by remove_if to delete from returns list those values
-        // that have been processed
-        //        retVal.retaddr = retVal.proc_id = 0;
+    pc_asid_t ret_key = std::make_pair(tb->pc, panda_current_asid(env));
+    ReturnPoint *found = returns.find(ret_key);
+    if (found) {
+        // Copy out and remove first: the return callbacks may add new
+        // return points, which can move entries around in the table.
+        ReturnPoint retVal = *found;
         returns.erase(ret_key);
+        retaddr_filter[retaddr_filter_idx(tb->pc)]--;
+        current_return = &retVal;
+        syscalls_profile->return_switch(env, tb->pc, retVal.ordinal, retVal);
+        current_return = NULL;
     }
     
     return false;
@@ -407,11 +565,16 @@ static int returned_check_callback(CPUState *env, TranslationBlock* tb){
 int exec_callback(CPUState *env, target_ulong pc) {
     // check if pc, asid pair was for a valid syscall translation point
     // if so run exec_callback
-    if (syscallPCpoints.end() != syscallPCpoints.find(std::make_pair(pc, panda_current_asid(env)))){
+    if (syscallPCpoints.contains(std::make_pair(pc, panda_current_asid(env)))){
         // run any code we need to update our state
         for(const auto callback : preExecCallbacks){
             callback(env, pc);
         }
+        if (syscalls_profile == &profiles[PROFILE_WINDOWS7_X64]) {
+            for (int i = 0; i < 4; i++) {
+                win64_enter_reg_args[i] = get_win64_syscall_arg(env, i);
+            }
+        }
         syscalls_profile->enter_switch(env, pc);
     }
     return 0;
@@ -425,17 +588,24 @@ bool translate_callback(CPUState *env, target_ulong pc) {
     panda_virtual_memory_rw(env, pc, buf, 2, 0);
     // Check if the instruction is syscall (0F 05)
     if (buf[0]== 0x0F && buf[1] == 0x05) {
-        syscallPCpoints.insert(std::make_pair(pc, panda_current_asid(env)));
+        syscallPCpoints.insert(std::make_pair(pc, panda_current_asid(env)), true);
         return true;
     }
+    // The 64-bit profiles only know the native syscall entry. int 0x80 and
+    // sysenter there are 32-bit compat calls, with i386 numbers and
+    // argument registers, which their switches would misdecode.
+    else if (syscalls_profile == &profiles[PROFILE_LINUX_X64] ||
+             syscalls_profile == &profiles[PROFILE_WINDOWS7_X64]) {
+        return false;
+    }
     // Check if the instruction is int 0x80 (CD 80)
     else if (buf[0]== 0xCD && buf[1] == 0x80) {
-        syscallPCpoints.insert(std::make_pair(pc, panda_current_asid(env)));
+        syscallPCpoints.insert(std::make_pair(pc, panda_current_asid(env)), true);
         return true;
     }
     // Check if the instruction is sysenter (0F 34)
     else if (buf[0]== 0x0F && buf[1] == 0x34) {
-        syscallPCpoints.insert(std::make_pair(pc, panda_current_asid(env)));
+        syscallPCpoints.insert(std::make_pair(pc, panda_current_asid(env)), true);
         return true;
     }
     else {
@@ -449,12 +619,12 @@ bool translate_callback(CPUState *env, target_ulong pc) {
         panda_virtual_memory_rw(env, pc, buf, 4, 0);
         // EABI
         if ( ((buf[3] & 0x0F) ==  0x0F)  && (buf[2] == 0) && (buf[1] == 0) && (buf[0] == 0) ) {
-            syscallPCpoints.insert(std::make_pair(pc, panda_current_asid(env)));
+            syscallPCpoints.insert(std::make_pair(pc, panda_current_asid(env)), true);
             return true;
         }
 #if defined(CAPTURE_ARM_OABI)
         else if (((buf[3] & 0x0F) == 0x0F)  && (buf[2] == 0x90)) {  // old ABI
-            syscallPCpoints.insert(std::make_pair(pc, panda_current_asid(env)));
+            syscallPCpoints.insert(std::make_pair(pc, panda_current_asid(env)), true);
             return true;
         }
 #endif
@@ -463,7 +633,7 @@ bool translate_callback(CPUState *env, target_ulong pc) {
         panda_virtual_memory_rw(env, pc, buf, 2, 0);
         // check for Thumb mode syscall
         if (buf[1] == 0xDF && buf[0] == 0){
-            syscallPCpoints.insert(std::make_pair(pc, panda_current_asid(env)));
+            syscallPCpoints.insert(std::make_pair(pc, panda_current_asid(env)), true);
             return true;
         }
     }
@@ -486,12 +656,19 @@ bool init_plugin(void *self) {
     assert (!(panda_os_type == OST_UNKNOWN));
     if (panda_os_type == OST_LINUX) {
 #if defined(TARGET_I386) 
-        if (panda_os_bits != 32) {
-            printf ("syscalls2: no support for 64-bit linux\n");
+        if (panda_os_bits == 64) {
+#if defined(TARGET_X86_64)
+            printf ("syscalls2: using profile for linux x86 64-bit\n");
+            syscalls_profile = &profiles[PROFILE_LINUX_X64];
+#else
+            printf ("syscalls2: 64-bit linux needs an x86_64 target\n");
             return false;
+#endif
+        }
+        else {
+            printf ("syscalls2: using profile for linux x86 32-bit\n");
+            syscalls_profile = &profiles[PROFILE_LINUX_X86];
         }
-        printf ("syscalls2: using profile for linux x86 32-bit\n");
-        syscalls_profile = &profiles[PROFILE_LINUX_X86];
 #endif        
 #if defined(TARGET_ARM) 
         printf ("syscalls2: using profile for linux arm\n");
@@ -500,22 +677,35 @@ bool init_plugin(void *self) {
     }
     if (panda_os_type == OST_WINDOWS) {   
 #if defined(TARGET_I386) 
-        if (panda_os_bits != 32) {
-            printf ("syscalls2: no support for 64-bit windows\n");
+        if (panda_os_bits == 64) {
+#if defined(TARGET_X86_64)
+            if (0 == strcmp(panda_os_details, "7")) {
+                printf ("syscalls2: using profile for windows 7 x86 64-bit\n");
+                syscalls_profile = &profiles[PROFILE_WINDOWS7_X64];
+            }
+            else {
+                printf ("syscalls2: no support for 64-bit windows %s\n", panda_os_details);
+                return false;
+            }
+#else
+            printf ("syscalls2: 64-bit windows needs an x86_64 target\n");
             return false;
-        }        
-        if (0 == strcmp(panda_os_details, "xpsp2")) {
-            printf ("syscalls2: using profile for windows sp2 x86 32-bit\n");
-            syscalls_profile = &profiles[PROFILE_WINDOWSXP_SP2_X86];
-        }    
-        if (0 == strcmp(panda_os_details, "xpsp3")) {
-            printf ("syscalls2: using profile for windows sp3 x86 32-bit\n");
-            syscalls_profile = &profiles[PROFILE_WINDOWSXP_SP3_X86];
-        }    
-        if (0 == strcmp(panda_os_details, "7")) {
-            printf ("syscalls2: using profile for windows 7 x86 32-bit\n");
-            syscalls_profile = &profiles[PROFILE_WINDOWS7_X86];
-        }            
+#endif
+        }
+        else {
+            if (0 == strcmp(panda_os_details, "xpsp2")) {
+                printf ("syscalls2: using profile for windows sp2 x86 32-bit\n");
+                syscalls_profile = &profiles[PROFILE_WINDOWSXP_SP2_X86];
+            }
+            if (0 == strcmp(panda_os_details, "xpsp3")) {
+                printf ("syscalls2: using profile for windows sp3 x86 32-bit\n");
+                syscalls_profile = &profiles[PROFILE_WINDOWSXP_SP3_X86];
+            }
+            if (0 == strcmp(panda_os_details, "7")) {
+                printf ("syscalls2: using profile for windows 7 x86 32-bit\n");
+                syscalls_profile = &profiles[PROFILE_WINDOWS7_X86];
+            }
+        }
 #endif       
     }
     assert (syscalls_profile);
@@ -39,6 +39,9 @@ struct ReturnPoint {
     target_ulong retaddr;
     target_ulong proc_id;
     uint8_t params[SYSCALL_MAX_ARGS][8];
+    // Windows x64 only: the four register arguments, which the kernel
+    // does not preserve, for get_return_* at the return
+    uint64_t reg_args[4];
 };
 
 typedef void (*pre_exec_callback_t)(CPUState*, target_ulong);
@@ -131,6 +131,15 @@ LabelSetP label_set_singleton(uint32_t label) {
     return LSA.alloc(temp);
 }
 
+void label_set_singleton_range(uint32_t first, uint32_t n, LabelSetP *out) {
+    // alloc() swaps temp into the arena, leaving it empty for the next one
+    std::set<uint32_t> temp;
+    for (uint32_t i = 0; i < n; i++) {
+        temp.insert(first + i);
+        out[i] = LSA.alloc(temp);
+    }
+}
+
 std::set<uint32_t> label_set_render_set(LabelSetP ls) {
     if (ls) return *ls;
     else return std::set<uint32_t>();
@@ -33,6 +33,9 @@ LabelSetP label_set_union(LabelSetP ls1, LabelSetP ls2);
 LabelSetP label_set_singleton(uint32_t label);
 }
 
+// out[i] = singleton set of label first + i, for i < n
+void label_set_singleton_range(uint32_t first, uint32_t n, LabelSetP *out);
+
 void label_set_iter(LabelSetP ls, void (*leaf)(uint32_t, void *), void *user);
 std::set<uint32_t> label_set_render_set(LabelSetP ls);
 
@@ -58,6 +58,8 @@ extern int loglevel;
 void taint2_enable_taint(void);
 int taint2_enabled(void);
 void taint2_label_ram(uint64_t pa, uint32_t l) ;
+uint32_t taint2_label_ram_range(CPUState *env, uint64_t vaddr, uint32_t len,
+    uint32_t first_label, bool positional);
 void taint2_add_taint_ram_pos(CPUState *env, uint64_t addr, uint32_t length);
 void taint2_add_taint_ram_single_label(CPUState *env, uint64_t addr,
     uint32_t length, long label);
@@ -739,51 +741,81 @@ void __taint2_label_ram(uint64_t pa, uint32_t l) {
 
 uint32_t taint_pos_count = 0;
 
-void label_byte(CPUState *env, target_ulong virt_addr, uint32_t label_num) {
-    target_phys_addr_t pa = panda_virt_to_phys(env, virt_addr);
-    if (pandalog) {
-        Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
-        ple.has_taint_label_virtual_addr = 1;
-        ple.has_taint_label_physical_addr = 1;
-        ple.has_taint_label_number = 1;
-        ple.taint_label_virtual_addr = virt_addr;
-        ple.taint_label_physical_addr = pa;
-        ple.taint_label_number = label_num;
-        pandalog_write_entry(&ple);
+static void log_label_range(target_ulong va, target_phys_addr_t pa,
+        uint32_t len, uint32_t first_label, bool positional) {
+    Panda__TaintLabelRange tlr = PANDA__TAINT_LABEL_RANGE__INIT;
+    tlr.virtual_addr = va;
+    tlr.physical_addr = pa;
+    tlr.len = len;
+    tlr.first_label = first_label;
+    tlr.positional = positional;
+    Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
+    ple.taint_label_range = &tlr;
+    pandalog_write_entry(&ple);
+}
+
+// Label len bytes of guest virtual memory starting at vaddr. Each page is
+// translated once and the shadow is written a page at a time. Bytes on
+// unmapped pages are skipped. The pandalog gets one record per virtually
+// and physically contiguous run rather than one per byte. Returns number of bytes labeled.
+uint32_t __taint2_label_ram_range(CPUState *env, uint64_t vaddr, uint32_t len,
+        uint32_t first_label, bool positional) {
+    uint32_t labeled = 0;
+    // current physically contiguous run, for the pandalog
+    target_ulong run_va = 0;
+    target_phys_addr_t run_pa = 0;
+    uint32_t run_len = 0, run_label = 0;
+
+    uint32_t i = 0;
+    while (i < len) {
+        target_ulong va = vaddr + i;
+        uint32_t n = TARGET_PAGE_SIZE - (va & ~TARGET_PAGE_MASK);
+        if (n > len - i) n = len - i;
+        uint32_t label = positional ? first_label + i : first_label;
+        target_phys_addr_t pa = panda_virt_to_phys(env, va);
+        if (pa == (target_phys_addr_t)(-1)) {
+            printf("taint2: can't label " TARGET_FMT_lx "..." TARGET_FMT_lx
+                    ": not mapped\n", va, va + n - 1);
+            // a hole ends the run
+            if (pandalog && run_len > 0) {
+                log_label_range(run_va, run_pa, run_len, run_label, positional);
+                run_len = 0;
+            }
+        } else {
+            tp_label_ram_range(shadow, pa, n, label, positional);
+            labeled += n;
+            if (pandalog) {
+                if (run_len > 0 && va == run_va + run_len
+                        && pa == run_pa + run_len) {
+                    run_len += n;
+                } else {
+                    if (run_len > 0) log_label_range(run_va, run_pa, run_len, run_label, positional);
+                    run_va = va;
+                    run_pa = pa;
+                    run_len = n;
+                    run_label = label;
+                }
+            }
+        }
+        i += n;
     }
-    taint2_label_ram(pa, label_num);
+    if (pandalog && run_len > 0) log_label_range(run_va, run_pa, run_len, run_label, positional);
+    return labeled;
 }
 
 // Apply positional taint to a buffer of memory
 void taint2_add_taint_ram_pos(CPUState *env, uint64_t addr, uint32_t length){
-    for (unsigned i = 0; i < length; i++){
-        target_phys_addr_t pa = cpu_get_phys_addr(env, addr + i);
-        if (pa == (target_phys_addr_t)(-1)) {
-            printf("can't label addr=0x%lx: mmu hasn't mapped virt->phys, "
-                "i.e., it isnt actually there.\n", addr +i);
-            continue;
-        }
-        //taint2_label_ram(pa, i + taint_pos_count);
-        printf("taint2: adding positional taint label %d\n", i+taint_pos_count);
-        label_byte(env, addr+i, i+taint_pos_count);
-    }
+    printf("taint2: adding positional taint labels %u..%u\n",
+            taint_pos_count, taint_pos_count + length - 1);
+    __taint2_label_ram_range(env, addr, length, taint_pos_count, true);
     taint_pos_count += length;
 }
 
 // Apply single label taint to a buffer of memory
 void taint2_add_taint_ram_single_label(CPUState *env, uint64_t addr,
         uint32_t length, long label){
-    for (unsigned i = 0; i < length; i++){
-        target_phys_addr_t pa = cpu_get_phys_addr(env, addr + i);
-        if (pa == (target_phys_addr_t)(-1)) {
-            printf("can't label addr=0x%lx: mmu hasn't mapped virt->phys, "
-                "i.e., it isnt actually there.\n", addr +i);
-            continue;
-        }
-        //taint2_label_ram(pa, label);
-        printf("taint2: adding single taint label %lu\n", label);
-        label_byte(env, addr+i, label);
-    }
+    printf("taint2: adding single taint label %lu\n", label);
+    __taint2_label_ram_range(env, addr, length, label, false);
 }
 
 uint32_t __taint2_query(Addr a) {
@@ -898,6 +930,11 @@ void taint2_label_ram(uint64_t pa, uint32_t l) {
     __taint2_label_ram(pa, l);
 }
 
+uint32_t taint2_label_ram_range(CPUState *env, uint64_t vaddr, uint32_t len,
+        uint32_t first_label, bool positional) {
+    return __taint2_label_ram_range(env, vaddr, len, first_label, positional);
+}
+
 
 Panda__TaintQuery *taint2_query_pandalog (Addr addr, uint32_t offset) {
     return __taint2_query_pandalog(addr, offset);
@@ -86,6 +86,10 @@ void tp_label(Shad *shad, Addr *a, uint32_t l);
 
 void tp_label_ram(Shad *shad, uint64_t pa, uint32_t l);
 
+// label len bytes of ram starting at pa with first_label, first_label+1, ...
+// if positional, else all with first_label
+void tp_label_ram_range(Shad *shad, uint64_t pa, uint32_t len, uint32_t first_label, bool positional);
+
 LabelSetP tp_query(Shad *shad, Addr a);
 LabelSetP tp_query_ram(Shad *shad, uint64_t pa) ;
 LabelSetP tp_query_reg(Shad *shad, int reg_num, int offset);
@@ -1,5 +1,6 @@
 
 typedef void LabelSetP;
+typedef void CPUState;
 
 
 #include "taint2_int_fns.h"
@@ -19,6 +19,11 @@ int taint2_enabled(void);
 // label this phys addr in memory with label l
 void taint2_label_ram(uint64_t pa, uint32_t l);
 
+// label len bytes of guest virtual memory starting at vaddr.
+// if positional, byte i gets label first_label+i, else all get first_label.
+// bytes on unmapped pages are skipped. returns number of bytes labeled.
+uint32_t taint2_label_ram_range(CPUState *env, uint64_t vaddr, uint32_t len, uint32_t first_label, bool positional);
+
 // query fns return 0 if untainted, else cardinality of taint set
 uint32_t taint2_query(Addr a);
 uint32_t taint2_query_ram(uint64_t pa);
@@ -314,6 +314,8 @@ bool is_irrelevant(int64_t offset) {
     bool irrelevant = offset < 0 || (size_t)offset >= sizeof(CPUState);
     irrelevant |= offset == cpu_off(panda_guest_pc);
     irrelevant |= offset == cpu_off(rr_guest_instr_count);
+    irrelevant |= offset == cpu_off(rr_insn_idx);
+    irrelevant |= offset == cpu_off(rr_cur_tb);
     return irrelevant;
 #endif
 }
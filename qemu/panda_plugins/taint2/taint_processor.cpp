@@ -17,6 +17,7 @@ PANDAENDCOMMENT */
  */
 
 #include <stdio.h>
+#include <vector>
 
 #include "panda_plugin_plugin.h"
 #include "panda_memlog.h"
@@ -465,6 +466,28 @@ void tp_label_ram(Shad *shad, uint64_t pa, uint32_t l) {
     tp_label(shad, &a, l);
 }
 
+void tp_label_ram_range(Shad *shad, uint64_t pa, uint32_t len, uint32_t first_label, bool positional) {
+    assert (shad != NULL);
+    if (positional) {
+        std::vector<LabelSetP> sets(len);
+        label_set_singleton_range(first_label, len, sets.data());
+        for (uint32_t i = 0; i < len; i++) {
+            shad->ram->label(pa + i, sets[i]);
+        }
+        // labels are usually handed out in increasing order, so the end
+        // is the right hint
+        for (uint32_t i = 0; i < len; i++) {
+            labels_applied.insert(labels_applied.end(), first_label + i);
+        }
+    } else {
+        LabelSetP ls = label_set_singleton(first_label);
+        for (uint32_t i = 0; i < len; i++) {
+            shad->ram->label(pa + i, ls);
+        }
+        labels_applied.insert(first_label);
+    }
+}
+
 void tp_delete_ram(Shad *shad, uint64_t pa) {
     Addr a = make_maddr(pa);
     tp_delete(shad, &a);
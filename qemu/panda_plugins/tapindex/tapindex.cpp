@@ -28,6 +28,7 @@ extern "C" {
 }
 
 #include "../common/prog_point.h"
+#include "../common/prog_point_table.h"
 #include "pandalog.h"
 #include "../callstack_instr/callstack_instr_ext.h"
 #include "panda_plugin_plugin.h"
@@ -36,7 +37,6 @@ extern "C" {
 #include <stdlib.h>
 #include <ctype.h>
 #include <math.h>
-#include <map>
 #include <list>
 #include <algorithm>
 
@@ -51,8 +51,8 @@ int mem_read_callback(CPUState *env, target_ulong pc, target_ulong addr, target_
 
 }
 
-std::map<prog_point,target_ulong> read_tracker;
-std::map<prog_point,target_ulong> write_tracker;
+ProgPointTable<target_ulong> read_tracker;
+ProgPointTable<target_ulong> write_tracker;
 FILE *read_index;
 FILE *write_index;
 
@@ -115,20 +115,13 @@ void uninit_plugin(void *self) {
     fwrite(&target_ulong_size, sizeof(uint32_t), 1, read_index);
 
     // Save reads
-    std::map<prog_point,target_ulong>::iterator it;
-    for(it = read_tracker.begin(); it != read_tracker.end(); it++) {
-        fwrite(&it->first, sizeof(prog_point), 1, read_index);
-        fwrite(&it->second, sizeof(target_ulong), 1, read_index);
-    }
+    read_tracker.dump(read_index);
     fclose(read_index);
 
     // Cross platform support: need to know how big a target_ulong is
     fwrite(&target_ulong_size, sizeof(uint32_t), 1, write_index);
 
     // Save writes
-    for(it = write_tracker.begin(); it != write_tracker.end(); it++) {
-        fwrite(&it->first, sizeof(prog_point), 1, write_index);
-        fwrite(&it->second, sizeof(target_ulong), 1, write_index);
-    }
+    write_tracker.dump(write_index);
     fclose(write_index);
 }
@@ -32,12 +32,12 @@ extern "C" {
 #include <stdlib.h>
 #include <ctype.h>
 #include <math.h>
-#include <set>
 #include <iostream>
 #include <fstream>
 
 
 #include "../common/prog_point.h"
+#include "../common/prog_point_table.h"
 
 #include "pandalog.h"
 #include "../callstack_instr/callstack_instr_ext.h"
@@ -55,16 +55,24 @@ int write_mem_callback(CPUState *env, target_ulong pc, target_ulong addr, target
 
 uint64_t mem_counter;
 
-std::set<prog_point> tap_points;
+ProgPointTable<uint8_t> tap_points;
+// pcs of all tap points; most accesses come from elsewhere and can skip
+// building a prog point at all
+OpenHashMap<target_ulong,uint8_t> tap_pcs;
 gzFile read_tap_buffers;
 gzFile write_tap_buffers;
 
 int mem_callback(CPUState *env, target_ulong pc, target_ulong addr,
                        target_ulong size, void *buf, gzFile f) {
+    if (!tap_pcs.contains(env->panda_guest_pc)) {
+        mem_counter++;
+        return 1;
+    }
+
     prog_point p = {};
     get_prog_point(env, &p);
 
-    if (tap_points.find(p) != tap_points.end()) {
+    if (tap_points.contains(p)) {
         target_ulong callers[16] = {0};
         int nret = get_callers(callers, 16, env);
         for (unsigned int i = 0; i < size; i++) {
@@ -105,7 +113,8 @@ bool init_plugin(void *self) {
 
         printf("Adding tap point (" TARGET_FMT_lx "," TARGET_FMT_lx "," TARGET_FMT_lx ")\n",
                p.caller, p.pc, p.cr3);
-        tap_points.insert(p);
+        tap_points[p] = 1;
+        tap_pcs[p.pc] = 1;
     }
     taps.close();
 
@@ -31,9 +31,9 @@ extern "C" {
 #include <stdio.h>
 #include <stdlib.h>
 #include <ctype.h>
-#include <map>
 
 #include "../common/prog_point.h"
+#include "../common/prog_point_table.h"
 #include "pandalog.h"
 #include "../callstack_instr/callstack_instr_ext.h"
 
@@ -49,22 +49,24 @@ int mem_read_callback(CPUState *env, target_ulong pc, target_ulong addr, target_
 }
 
 struct text_counter {
-    std::map<uint8_t,unsigned int> hist;
+    unsigned int hist[256];
 };
 
-std::map<prog_point,text_counter> read_tracker;
-std::map<prog_point,text_counter> write_tracker;
+typedef ProgPointTable<text_counter> tracker_t;
+
+tracker_t read_tracker;
+tracker_t write_tracker;
 
 static int mem_callback(CPUState *env, target_ulong pc, target_ulong addr,
-                       target_ulong size, void *buf, std::map<prog_point,text_counter> &tracker) {
+                       target_ulong size, void *buf, tracker_t &tracker) {
     prog_point p = {};
 
     get_prog_point(env, &p);
 
-    text_counter &tc = tracker[p];
+    unsigned int *hist = tracker[p].hist;
+    uint8_t *bytes = (uint8_t *)buf;
     for (unsigned int i = 0; i < size; i++) {
-        uint8_t val = ((uint8_t *)buf)[i];
-        tc.hist[val]++;
+        hist[bytes[i]]++;
     }
  
     return 1;
@@ -101,21 +103,12 @@ bool init_plugin(void *self) {
     return true;
 }
 
-void write_report(FILE *report, std::map<prog_point,text_counter> &tracker) {
+void write_report(FILE *report, tracker_t &tracker) {
     // Cross platform support: need to know how big a target_ulong is
     uint32_t target_ulong_size = sizeof(target_ulong);
     fwrite(&target_ulong_size, sizeof(uint32_t), 1, report);
 
-    std::map<prog_point,text_counter>::iterator it;
-    for(it = tracker.begin(); it != tracker.end(); it++) {
-        fwrite(&it->first, sizeof(prog_point), 1, report);
-        unsigned int hist[256] = {};
-        for(int i = 0; i < 256; i++) {
-            if (it->second.hist.find(i) != it->second.hist.end())
-                hist[i] = it->second.hist[i];
-        }
-        fwrite(hist, sizeof(hist), 1, report);
-    }
+    tracker.dump(report);
 }
 
 void uninit_plugin(void *self) {
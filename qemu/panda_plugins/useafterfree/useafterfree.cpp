@@ -30,6 +30,11 @@ int before_block_exec(CPUState *env, TranslationBlock *tb);
 #include <stack>
 #include <set>
 #include <queue>
+#include <vector>
+#include <algorithm>
+#include <iterator>
+
+#include "../common/open_hash.h"
 
 // hack to avoid warnings about printf formats... sorry.
 #if defined(TARGET_I386) && TARGET_LONG_SIZE == 8
@@ -61,151 +66,237 @@ static target_ulong alloc_guest_addr, free_guest_addr, realloc_guest_addr;
 static target_ulong right_cr3;
 static unsigned word_size;
 
-struct range_info {
-    target_ulong heap, begin, end;
-    std::set<target_ulong> valid_ptrs; // Addresses of valid ptrs to this range
+// Byte-granular shadow of the heap, in chunks of 4K. For every byte we keep
+// whether it has ever been inside an allocation and whether it is inside
+// one right now; a byte is freed if the first is set and the second isn't.
+// This is what every memory access is checked against, so it has to be a
+// hash lookup and a bit test. Consecutive accesses mostly hit the same
+// chunk, which skips the hash.
+#define SHADOW_CHUNK_BITS 12
+#define SHADOW_CHUNK_SIZE (1 << SHADOW_CHUNK_BITS)
+#define SHADOW_CHUNK_WORDS (SHADOW_CHUNK_SIZE / 64)
+
+struct shadow_chunk {
+    uint64_t ever[SHADOW_CHUNK_WORDS];
+    uint64_t now[SHADOW_CHUNK_WORDS];
+};
 
-    range_info(target_ulong heap_, target_ulong begin_, target_ulong end_) {
-        heap = heap_; begin = begin_; end = end_;
+// Set or clear bits [from, to) of a chunk bitmap.
+static void set_bits(uint64_t *bits, uint32_t from, uint32_t to, bool val) {
+    while (from < to) {
+        uint32_t word = from / 64, bit = from % 64;
+        uint32_t n = std::min(to - from, 64 - bit);
+        uint64_t mask = (n == 64) ? ~0ULL : (((1ULL << n) - 1) << bit);
+        if (val) bits[word] |= mask;
+        else bits[word] &= ~mask;
+        from += n;
     }
-    range_info() {
-        heap = 0; begin = 0; end = 0;
+}
+
+struct heap_shadow {
+    OpenHashMap<target_ulong, shadow_chunk *> chunks;
+    target_ulong last_idx;
+    shadow_chunk *last_chunk;
+
+    heap_shadow() : chunks(1024), last_idx(0), last_chunk(NULL) {}
+
+    ~heap_shadow() {
+        chunks.for_each([](const target_ulong &, shadow_chunk *c) { delete c; });
     }
-};
 
-struct merge_range_set {
-    std::map<target_ulong, target_ulong> impl;
+    shadow_chunk *find(target_ulong addr) {
+        target_ulong idx = addr >> SHADOW_CHUNK_BITS;
+        if (last_chunk && idx == last_idx) return last_chunk;
+        shadow_chunk **c = chunks.find(idx);
+        if (!c) return NULL;
+        last_idx = idx;
+        last_chunk = *c;
+        return *c;
+    }
 
-    void insert(target_ulong heap, target_ulong begin, target_ulong end) {
-        auto it = impl.upper_bound(begin); // first range past begin
-        if (it != impl.begin()) { // possible overlap on left. have to handle.
-            it--;
-            if (begin < it->second) {
-                begin = std::min(begin, it->first);
-                it = impl.erase(it);
-            } else {
-                it++;
-            }
-        }
-        // Erase all subranges.
-        while (it != impl.end() && end > it->second) {
-            it = impl.erase(it);
-        }
-        // Handle right overlap. At this point should have end <= it->second
-        if (it != impl.end()) {
-            if (end >= it->first) { // merge when touching, even. performance.
-                end = std::max(end, it->second);
-                impl.erase(it);
-            }
-        }
-        impl[begin] = end;
+    shadow_chunk *get(target_ulong addr) {
+        shadow_chunk *c = find(addr);
+        if (c) return c;
+        c = new shadow_chunk();
+        chunks.insert(addr >> SHADOW_CHUNK_BITS, c);
+        last_idx = addr >> SHADOW_CHUNK_BITS;
+        last_chunk = c;
+        return c;
+    }
+
+    static bool test(const uint64_t *bits, target_ulong addr) {
+        uint32_t off = addr & (SHADOW_CHUNK_SIZE - 1);
+        return (bits[off / 64] >> (off % 64)) & 1;
+    }
+
+    bool ever(target_ulong addr) {
+        shadow_chunk *c = find(addr);
+        return c && test(c->ever, addr);
+    }
+
+    bool live(target_ulong addr) {
+        shadow_chunk *c = find(addr);
+        return c && test(c->now, addr);
     }
 
-    bool contains(target_ulong addr) {
-        if (impl.empty()) return false;
-        else {
-            auto it = impl.upper_bound(addr);
-            if (it != impl.begin()) it--; // now greatest <= addr
-            return addr >= it->first && addr < it->second;
+    bool freed(target_ulong addr) {
+        shadow_chunk *c = find(addr);
+        return c && test(c->ever, addr) && !test(c->now, addr);
+    }
+
+    // Mark [begin, end) in the ever (now == false) or now bitmap.
+    void mark(bool now, target_ulong begin, target_ulong end, bool val) {
+        while (begin < end) {
+            target_ulong chunk_end = (begin | (SHADOW_CHUNK_SIZE - 1)) + 1;
+            if (chunk_end == 0 || chunk_end > end) chunk_end = end;
+            // Clearing never needs a chunk that isn't there.
+            shadow_chunk *c = val ? get(begin) : find(begin);
+            if (c) {
+                set_bits(now ? c->now : c->ever,
+                        begin & (SHADOW_CHUNK_SIZE - 1),
+                        (chunk_end - 1) % SHADOW_CHUNK_SIZE + 1, val);
+            }
+            begin = chunk_end;
         }
     }
 
-    void dump() {
+    // Print the ranges that have ever been allocated, merged.
+    void dump_ever() {
+        std::vector<target_ulong> idxs;
+        chunks.for_each([&](const target_ulong &idx, shadow_chunk *) {
+            idxs.push_back(idx);
+        });
+        std::sort(idxs.begin(), idxs.end());
         printf("{  ");
-        for (auto it = impl.begin(); it != impl.end(); it++) {
-            printf("[%lx, %lx) ", it->first, it->second);
+        bool in_range = false;
+        target_ulong range_begin = 0, prev = 0;
+        for (auto idx : idxs) {
+            shadow_chunk *c = *chunks.find(idx);
+            for (uint32_t off = 0; off < SHADOW_CHUNK_SIZE; off++) {
+                target_ulong addr = (idx << SHADOW_CHUNK_BITS) + off;
+                bool set = (c->ever[off / 64] >> (off % 64)) & 1;
+                if (set && !(in_range && addr == prev + 1)) {
+                    if (in_range) printf("[%lx, %lx) ", range_begin, prev + 1);
+                    range_begin = addr;
+                }
+                if (set) prev = addr;
+                in_range = in_range || set;
+            }
         }
+        if (in_range) printf("[%lx, %lx) ", range_begin, prev + 1);
         printf(" }\n");
     }
 };
 
-// Set of ranges [begin, end).
-// Should satisfy guarantee that all ranges are disjoint at all times.
+struct range_info {
+    target_ulong heap, begin, end;
+
+    range_info(target_ulong heap_, target_ulong begin_, target_ulong end_) {
+        heap = heap_; begin = begin_; end = end_;
+    }
+    range_info() {
+        heap = 0; begin = 0; end = 0;
+    }
+};
+
+// Set of live allocations [begin, end), keyed by begin.
+// Ranges are disjoint at all times. Membership of single addresses is
+// answered by the shadow, which this keeps in sync; the map itself is only
+// walked when an allocation's bounds are needed.
+// Pointers into a range are forgotten when it leaves the set, however it
+// leaves, so a later allocation at the same addresses does not inherit them.
 struct range_set {
     std::map<target_ulong, range_info> impl; // map from range begin -> end
+    heap_shadow &shadow;
+    // the owning heap_state's pointer maps; see there
+    std::map<target_ulong, target_ulong> &valid_ptrs;
+    std::set<std::pair<target_ulong, target_ulong>> &ptrs_by_val;
+
+    range_set(heap_shadow &shadow_,
+            std::map<target_ulong, target_ulong> &valid_ptrs_,
+            std::set<std::pair<target_ulong, target_ulong>> &ptrs_by_val_)
+        : shadow(shadow_), valid_ptrs(valid_ptrs_), ptrs_by_val(ptrs_by_val_) {}
+
+    // Stop tracking the pointers whose value is in [begin, end).
+    void drop_ptrs(target_ulong begin, target_ulong end) {
+        auto first = ptrs_by_val.lower_bound(std::make_pair(begin, (target_ulong)0));
+        auto last = ptrs_by_val.lower_bound(std::make_pair(end, (target_ulong)0));
+        for (auto it = first; it != last; it++) {
+            valid_ptrs.erase(it->second);
+        }
+        ptrs_by_val.erase(first, last);
+    }
+
+    void erase(std::map<target_ulong, range_info>::iterator it) {
+        drop_ptrs(it->first, it->second.end);
+        shadow.mark(true, it->first, it->second.end, false);
+        impl.erase(it);
+    }
 
     bool insert(target_ulong heap, target_ulong begin, target_ulong end) {
         bool error = false;
 
-        // Check left overlap. FIXME make sure this is correct.
+        // Check left overlap.
         auto it = impl.upper_bound(begin);
         if (it != impl.begin()) {
-            it--; // now points to greatest elt <= begin
-            if (begin < it->second.end) {
-                printf("error! we shouldn't be merging [ %lx, %lx ). assuming missed free of [ %lx, %lx ).\n", begin, end, it->first, it->second.end);
+            auto prev = std::prev(it); // greatest elt <= begin
+            if (begin < prev->second.end) {
+                printf("error! we shouldn't be merging [ %lx, %lx ). assuming missed free of [ %lx, %lx ).\n", begin, end, prev->first, prev->second.end);
                 error = true;
-                impl.erase(it->first);
+                erase(prev);
             }
         }
 
         // Check right overlap.
-        it = impl.upper_bound(begin); // least elt > (begin, end);
-        if (it != impl.end()) {
-            if (end > it->first) {
-                printf("error! we shouldn't be merging. assuming missed free.\n");
-                error = true;
-                impl.erase(it->first);
-            }
+        while (it != impl.end() && end > it->first) {
+            printf("error! we shouldn't be merging. assuming missed free.\n");
+            error = true;
+            auto next = std::next(it);
+            erase(it);
+            it = next;
         }
 
-        range_info ri(heap, begin, end);
-        impl[begin] = ri;
+        impl[begin] = range_info(heap, begin, end);
+        shadow.mark(true, begin, end, true);
 
         return error;
     }
 
-    bool contains(target_ulong addr) {
-        if (impl.empty()) return false;
-        else {
-            auto it = impl.upper_bound(addr);
-            if (it != impl.begin()) it--; // now greatest <= addr
-            return addr >= it->first && addr < it->second.end;
-        }
-    }
-
     bool has_range(target_ulong begin) {
         return impl.count(begin) > 0;
     }
 
     void resize(target_ulong begin, target_ulong new_end) {
-        if (impl.count(begin) > 0) {
-            range_info &ri = impl[begin];
+        auto it = impl.find(begin);
+        if (it != impl.end()) {
+            range_info &ri = it->second;
+            if (new_end < ri.end) drop_ptrs(new_end, ri.end);
+            shadow.mark(true, begin, ri.end, false);
             ri.end = new_end;
+            shadow.mark(true, begin, ri.end, true);
         } else {
             printf("error! resizing nonexistent range @ %lx\n", begin);
         }
     }
 
-    range_info& operator[](target_ulong addr) {
-        if (impl.count(addr) > 0) return impl[addr];
+    // The range containing addr, or NULL.
+    range_info *find(target_ulong addr) {
         auto it = impl.upper_bound(addr);
-        if (it != impl.begin()) {
-            it--; // now points to greatest elt <= addr
-            if (addr >= it->first && addr < it->second.end) {
-                return it->second;
-            }
-        }
-        printf("error! lookup on nonexistent addr %lx\n", addr);
-        throw 0;
+        if (it == impl.begin()) return NULL;
+        it--; // now points to greatest elt <= addr
+        if (addr < it->second.end) return &it->second;
+        return NULL;
     }
 
     // We will only ever use this with alloc_now, which should never have an
     // overlapping range inserted. So we can implement this the easy way.
     void remove(target_ulong begin) {
-        if (impl.count(begin) == 0) {
+        auto it = impl.find(begin);
+        if (it == impl.end()) {
             printf("error! %lx not found!\n", begin);
             dump();
-
-            auto it = impl.upper_bound(begin);
-            if (it != impl.begin()) {
-                it--;
-                if (false) {// begin < it->second) {
-                    printf("freeing containing block.\n");
-                    impl.erase(it->first);
-                }
-            }
         } else {
-            impl.erase(begin);
+            erase(it);
         }
     }
 
@@ -225,18 +316,41 @@ struct read_info {
     }
 };
 
-// These are all per-cr3 data structs.
-static std::map<target_ulong, range_set> alloc_now; // Allocated now.
-static std::map<target_ulong, merge_range_set> alloc_ever; // Allocated ever.
-static std::map<target_ulong, std::stack<alloc_info>> alloc_stacks; // Track alloc callstack.
-static std::map<target_ulong, std::stack<free_info>> free_stacks; // Track free callstack.
-static std::map<target_ulong, std::stack<realloc_info>> realloc_stacks; // Reallocs
-// Map from pointer location to instr count of invalidation
-static std::map<target_ulong, std::map<target_ulong, uint64_t>> invalid_ptrs;
-// Map from cr3 => map from pointer location => pointer value
-static std::map<target_ulong, std::map<target_ulong, target_ulong>> valid_ptrs;
-static std::map<target_ulong, std::queue<target_ulong>> invalid_queue;
-static std::map<target_ulong, std::queue<read_info>> bad_read_queue;
+// Everything we track for one address space.
+struct heap_state {
+    heap_shadow shadow; // Allocated ever / now, per byte.
+    range_set alloc_now; // Allocated now.
+    std::stack<alloc_info> alloc_stack; // Track alloc callstack.
+    std::stack<free_info> free_stack; // Track free callstack.
+    std::stack<realloc_info> realloc_stack; // Reallocs
+    // Map from pointer location to instr count of invalidation
+    std::map<target_ulong, uint64_t> invalid_ptrs;
+    // Map from pointer location => pointer value
+    std::map<target_ulong, target_ulong> valid_ptrs;
+    // The same pointers as (value, location), so the pointers into a range
+    // can be found when it is freed.
+    std::set<std::pair<target_ulong, target_ulong>> ptrs_by_val;
+    std::queue<target_ulong> invalid_queue;
+    std::queue<read_info> bad_read_queue;
+
+    heap_state() : alloc_now(shadow, valid_ptrs, ptrs_by_val) {}
+
+    bool inside_memop() {
+        return !(alloc_stack.empty() && free_stack.empty());
+    }
+};
+
+static std::map<target_ulong, heap_state> heaps;
+static target_ulong last_cr3;
+static heap_state *last_heap = NULL;
+
+static heap_state &get_heap(target_ulong cr3) {
+    if (!last_heap || cr3 != last_cr3) {
+        last_heap = &heaps[cr3];
+        last_cr3 = cr3;
+    }
+    return *last_heap;
+}
 
 static int debug = 0;
 
@@ -251,10 +365,6 @@ bool is_right_proc(CPUState *env) {
     else return (env->cr[3] == right_cr3);
 }
 
-static bool inside_memop(target_ulong cr3) {
-    return !(alloc_stacks[cr3].empty() && free_stacks[cr3].empty());
-}
-
 // Assumes target+host have same endianness.
 static target_ulong get_word(CPUState *env, target_ulong addr) {
     target_ulong result = 0;
@@ -271,58 +381,63 @@ void process_ret(CPUState *env, target_ulong func) {
     if (!is_right_proc(env)) return;
 
     target_ulong cr3 = env->cr[3];
+    heap_state &h = get_heap(cr3);
 
     //printf("ret! %lx\n", env->eip);
-    if (!alloc_stacks[cr3].empty() && env->eip == alloc_stacks[cr3].top().retaddr) {
-        alloc_info info = alloc_stacks[cr3].top();
+    if (!h.alloc_stack.empty() && env->eip == h.alloc_stack.top().retaddr) {
+        alloc_info info = h.alloc_stack.top();
         target_ulong addr = env->regs[R_EAX];
-        if (!(alloc_stacks[cr3].size() == 2 && (info.size & 0x3ff) == 0x3f8)) {
+        if (!(h.alloc_stack.size() == 2 && (info.size & 0x3ff) == 0x3f8)) {
             // Otherwise RtlAllocateHeap is calling itself to get a big block
             // to split up into little blocks. No idea why. -ph
             if (addr != 0) {
-                alloc_now[cr3].insert(info.heap, addr, addr + info.size);
-                alloc_ever[cr3].insert(info.heap, addr, addr + info.size);
+                h.alloc_now.insert(info.heap, addr, addr + info.size);
+                h.shadow.mark(false, addr, addr + info.size, true);
             }
         }
         if (print) {
             printf("PP %lu: return from alloc; addr {%lx, %lx}, size %lx\n", rr_get_guest_instr_count(), env->cr[3], env->regs[R_EAX], info.size);
             printf("    alloc_now: ");
-            alloc_now[cr3].dump();
+            h.alloc_now.dump();
             printf("    alloc_ever: ");
-            alloc_ever[cr3].dump();
+            h.shadow.dump_ever();
             printf("\n");
         }
-        alloc_stacks[cr3].pop();
-    } else if (!free_stacks[cr3].empty() && env->eip == free_stacks[cr3].top().retaddr) {
-        free_info info = free_stacks[cr3].top();
-        if (info.addr > 0 && alloc_ever[cr3].contains(info.addr)) {
-            if (!alloc_now[cr3].contains(info.addr)) {
-                if (!inside_memop(cr3) && func >> 20 != alloc_guest_addr >> 20)
+        h.alloc_stack.pop();
+    } else if (!h.free_stack.empty() && env->eip == h.free_stack.top().retaddr) {
+        free_info info = h.free_stack.top();
+        if (info.addr > 0 && h.shadow.ever(info.addr)) {
+            if (!h.shadow.live(info.addr)) {
+                if (!h.inside_memop() && func >> 20 != alloc_guest_addr >> 20)
                     printf("DOUBLE FREE @ {%lx, %lx}! PC %lx\n", cr3, info.addr, env->eip);
-            } else if (free_stacks[cr3].size() == 1) {
-                range_info &ri = alloc_now[cr3][info.addr];
-                for (auto it = ri.valid_ptrs.begin(); it != ri.valid_ptrs.end(); it++) {
-                    if (ptrprint) printf("Invalidating pointer @ %lx\n", *it);
-                    // *it is the location of a pointer into the freed range
-                    if (alloc_now[cr3].contains(*it)) {
-                        invalid_queue[cr3].push(*it);
+            } else if (h.free_stack.size() == 1) {
+                range_info *ri = h.alloc_now.find(info.addr);
+                auto begin = h.ptrs_by_val.lower_bound(std::make_pair(ri->begin, (target_ulong)0));
+                auto end = h.ptrs_by_val.lower_bound(std::make_pair(ri->end, (target_ulong)0));
+                for (auto it = begin; it != end; it++) {
+                    target_ulong loc = it->second;
+                    if (ptrprint) printf("Invalidating pointer @ %lx\n", loc);
+                    // loc is the location of a pointer into the freed range
+                    if (h.shadow.live(loc)) {
+                        h.invalid_queue.push(loc);
                     }
-                    invalid_ptrs[cr3][*it] = rr_get_guest_instr_count();
-                    valid_ptrs[cr3].erase(*it);
+                    h.invalid_ptrs[loc] = rr_get_guest_instr_count();
+                    h.valid_ptrs.erase(loc);
                 }
-                alloc_now[cr3].remove(info.addr);
+                h.ptrs_by_val.erase(begin, end);
+                h.alloc_now.remove(info.addr);
             }
         }
         if (print) {
             printf("PP %lu: return from free; addr {%lx, %lx}!\n", rr_get_guest_instr_count(), env->cr[3], info.addr);
             printf("    alloc_now: ");
-            alloc_now[cr3].dump();
+            h.alloc_now.dump();
             printf("\n");
         }
 
-        free_stacks[cr3].pop();
-    } else if (!realloc_stacks[cr3].empty() && env->eip == realloc_stacks[cr3].top().retaddr) {
-        realloc_info info = realloc_stacks[cr3].top();
+        h.free_stack.pop();
+    } else if (!h.realloc_stack.empty() && env->eip == h.realloc_stack.top().retaddr) {
+        realloc_info info = h.realloc_stack.top();
         target_ulong newaddr = env->regs[R_EAX];
 
         if (!newaddr) {
@@ -330,23 +445,23 @@ void process_ret(CPUState *env, target_ulong func) {
             return;
         }
 
-        if (alloc_now[cr3].has_range(info.addr)) { // check original range
+        if (h.alloc_now.has_range(info.addr)) { // check original range
             if (info.addr == newaddr) {
-                alloc_now[cr3].resize(info.addr, info.addr + info.size);
+                h.alloc_now.resize(info.addr, info.addr + info.size);
             } else {
-                if (alloc_now[cr3].contains(info.addr)) {
+                if (h.shadow.live(info.addr)) {
                     printf("error! realloc isn't tracking ptrs.\n");
                 }
-                alloc_now[cr3].remove(info.addr);
+                h.alloc_now.remove(info.addr);
             }
         }
-        if (!alloc_now[cr3].has_range(newaddr)) { // check new range
-            alloc_now[cr3].insert(info.heap, newaddr, newaddr + info.size);
+        if (!h.alloc_now.has_range(newaddr)) { // check new range
+            h.alloc_now.insert(info.heap, newaddr, newaddr + info.size);
         } else {
-            alloc_now[cr3].resize(newaddr, newaddr + info.size);
+            h.alloc_now.resize(newaddr, newaddr + info.size);
         }
 
-        //alloc_now[cr3].dump();
+        //h.alloc_now.dump();
 
         //printf("realloc @ %lx to %lx, size %lx!\n", info.addr, newaddr, info.size);
     }
@@ -356,31 +471,28 @@ static int virt_mem_access(CPUState *env, target_ulong pc, target_ulong addr, ta
     if (!is_right_proc(env)) return 0;
 
     target_ulong cr3 = env->cr[3];
+    heap_state &h = get_heap(cr3);
 
     if (size >= word_size && is_write) { // The addresses we're overwriting don't contain ptrs anymore.
         target_ulong begin = addr, end = addr + size;
-        auto end_it = valid_ptrs[cr3].lower_bound(end);
-        for (auto it = valid_ptrs[cr3].lower_bound(begin); it != end_it;
-                it = valid_ptrs[cr3].erase(it)) {
+        auto end_it = h.valid_ptrs.lower_bound(end);
+        for (auto it = h.valid_ptrs.lower_bound(begin); it != end_it;
+                it = h.valid_ptrs.erase(it)) {
             // it->second is the value of a ptr. it->first is its location.
-            if (alloc_now[cr3].contains(it->second)) {
+            if (h.ptrs_by_val.erase(std::make_pair(it->second, it->first))) {
                 if (ptrprint) printf("Erasing pointer to %lx @ %lx.\n", it->second, it->first);
-                alloc_now[cr3][it->second].valid_ptrs.erase(it->first);
             }
         }
 
-        auto end_it2 = invalid_ptrs[cr3].lower_bound(end);
-        for (auto it = invalid_ptrs[cr3].lower_bound(begin); it != end_it2;
-                it = invalid_ptrs[cr3].erase(it)) {
+        auto end_it2 = h.invalid_ptrs.lower_bound(end);
+        for (auto it = h.invalid_ptrs.lower_bound(begin); it != end_it2;
+                it = h.invalid_ptrs.erase(it)) {
             if (ptrprint) printf("Erasing invalid pointer @ %lx.\n", it->first);
         }
     }
 
-    if (!inside_memop(cr3) && pc >> 20 != alloc_guest_addr >> 20) { // hack.
-        if (alloc_ever[cr3].contains(addr)
-                && !alloc_now[cr3].contains(addr)) {
-            //range_set ae = alloc_ever[cr3][it->first];
-            //range_set an = alloc_now[cr3][it->first];
+    if (!h.inside_memop() && pc >> 20 != alloc_guest_addr >> 20) { // hack.
+        if (h.shadow.freed(addr)) {
             printf("USE AFTER FREE %s @ {%lx, %lx}! PC %lx\n",
                     is_write ? "WRITE" : "READ", cr3, addr, pc);
             //panda_memsavep(fopen("uaf.raw", "w"));
@@ -393,21 +505,22 @@ static int virt_mem_access(CPUState *env, target_ulong pc, target_ulong addr, ta
             target_ulong val = *(uint32_t *)buf;
             // Might be writing a pointer. Track.
             if (is_write) {
-                if (alloc_now[cr3].contains(val)) { // actually creating pointer.
+                if (h.shadow.live(val)) { // actually creating pointer.
                     if (ptrprint) printf("Creating pointer to %lx @ %lx.\n", val, loc);
-                    alloc_now[cr3][val].valid_ptrs.insert(loc);
-                    try { valid_ptrs[cr3][loc] = val; } catch (int e) {}
-                } else if (alloc_ever[cr3].contains(val)) {
+                    h.ptrs_by_val.insert(std::make_pair(val, loc));
+                    h.valid_ptrs[loc] = val;
+                } else if (h.shadow.ever(val)) {
                     // Oops! We wrote an invalid pointer.
                     if (ptrprint) printf("Writing invalid pointer to %lx @ %lx.\n", val, loc);
-                    invalid_ptrs[cr3][loc] = rr_get_guest_instr_count();
+                    h.invalid_ptrs[loc] = rr_get_guest_instr_count();
                 }
             } else if (env->regs[R_ESP] != loc) { // Reading a pointer. Ignore stack reads.
                 // Leave safety window.
-                if (invalid_ptrs[cr3].count(loc) > 0 &&
-                        rr_get_guest_instr_count() - invalid_ptrs[cr3][loc] > safety_window &&
+                auto it = h.invalid_ptrs.find(loc);
+                if (it != h.invalid_ptrs.end() &&
+                        rr_get_guest_instr_count() - it->second > safety_window &&
                         val != 0) {
-                    bad_read_queue[cr3].push(read_info(pc, loc, val));
+                    h.bad_read_queue.push(read_info(pc, loc, val));
                 }
             }
         }
@@ -428,6 +541,7 @@ int before_block_exec(CPUState *env, TranslationBlock *tb) {
     if (!is_right_proc(env)) return 0;
 
     target_ulong cr3 = env->cr[3];
+    heap_state &h = get_heap(cr3);
 
     if (debug > 0) {
         printf("%lx ", tb->pc);
@@ -436,31 +550,32 @@ int before_block_exec(CPUState *env, TranslationBlock *tb) {
     }
 
     // Clear queue of potential bad reads.
-    while (bad_read_queue[cr3].size() > 0) {
-        read_info& ri = bad_read_queue[cr3].front();
+    while (h.bad_read_queue.size() > 0) {
+        read_info& ri = h.bad_read_queue.front();
         if (get_word(env, ri.loc) == ri.val) { // Still invalid.
             printf("READING INVALID POINTER %lx @ %lx!! PC %lx\n", ri.val, ri.loc, ri.pc);
         }
-        bad_read_queue[cr3].pop();
+        h.bad_read_queue.pop();
     }
 
     // Clear queue of potential dangling pointers.
-    while (invalid_queue[cr3].size() > 0) {
-        target_ulong loc = invalid_queue[cr3].front();
+    while (h.invalid_queue.size() > 0) {
+        target_ulong loc = h.invalid_queue.front();
 
-        if (invalid_ptrs[cr3].count(loc) == 0 || !alloc_now[cr3].contains(loc)) {
+        auto it = h.invalid_ptrs.find(loc);
+        if (it == h.invalid_ptrs.end() || !h.shadow.live(loc)) {
             // Pointer has been overwritten or deallocated; not dangling.
-            invalid_queue[cr3].pop();
+            h.invalid_queue.pop();
             continue;
         }
-        if (rr_get_guest_instr_count() - invalid_ptrs[cr3][loc] <= safety_window) {
+        if (rr_get_guest_instr_count() - it->second <= safety_window) {
             // Inside safety window still.
             break;
         }
 
         // Outside safety window and pointer is still dangling. Report.
         printf("POINTER RETENTION to %lx @ %lx!\n", get_word(env, loc), loc);
-        invalid_queue[cr3].pop();
+        h.invalid_queue.pop();
     }
 
     if (tb->pc == free_guest_addr) { // free
@@ -468,7 +583,7 @@ int before_block_exec(CPUState *env, TranslationBlock *tb) {
         info.retaddr = get_stack(env, 0);
         info.heap = get_stack(env, 1);
         info.addr = get_stack(env, 3);
-        free_stacks[cr3].push(info);
+        h.free_stack.push(info);
 
         //printf("found free @ %lx! ret to %lx\n", free_addr.addr, free_retaddr.addr);
     } else if (tb->pc == alloc_guest_addr) { // alloc
@@ -478,7 +593,7 @@ int before_block_exec(CPUState *env, TranslationBlock *tb) {
         info.retaddr = get_stack(env, 0);
         info.heap = get_stack(env, 1);
         info.size = get_stack(env, 3);
-        alloc_stacks[cr3].push(info);
+        h.alloc_stack.push(info);
 
         //debug = 100;
     } else if (tb->pc == realloc_guest_addr) { // realloc
@@ -487,7 +602,7 @@ int before_block_exec(CPUState *env, TranslationBlock *tb) {
         info.heap = get_stack(env, 1);
         info.addr = get_stack(env, 3);
         info.size = get_stack(env, 4);
-        realloc_stacks[cr3].push(info);
+        h.realloc_stack.push(info);
 
         //debug = 40;
     }
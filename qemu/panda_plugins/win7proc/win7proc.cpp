@@ -467,17 +467,17 @@ Panda__Process *create_panda_process (uint32_t pid, char *name) {
 void w7p_NtCreateUserProcess_return(
         CPUState* env,
         target_ulong pc,
-        uint32_t ProcessHandle,
-        uint32_t ThreadHandle,
+        target_ulong ProcessHandle,
+        target_ulong ThreadHandle,
         uint32_t ProcessDesiredAccess,
         uint32_t ThreadDesiredAccess,
-        uint32_t ProcessObjectAttributes,
-        uint32_t ThreadObjectAttributes,
+        target_ulong ProcessObjectAttributes,
+        target_ulong ThreadObjectAttributes,
         uint32_t ProcessFlags,
         uint32_t ThreadFlags,
-        uint32_t ProcessParameters,
-        uint32_t CreateInfo,
-        uint32_t AttributeList) {
+        target_ulong ProcessParameters,
+        target_ulong CreateInfo,
+        target_ulong AttributeList) {
     uint16_t procNameLen;
     uint32_t procNamePtr;
     char procName[260] = {};
@@ -518,7 +518,7 @@ void w7p_NtCreateUserProcess_return(
 void w7p_NtTerminateProcess_enter(
         CPUState* env,
         target_ulong pc,
-        uint32_t ProcessHandle,
+        target_ulong ProcessHandle,
         uint32_t ExitStatus) {
     Panda__Process *cur_p = create_panda_process(cur_pid, cur_procname);
     Panda__Process *term_p = 0;
@@ -564,16 +564,16 @@ uint32_t last_filehandle;
 void w7p_NtCreateFile_enter(
         CPUState* env,
         target_ulong pc,
-        uint32_t FileHandle,
+        target_ulong FileHandle,
         uint32_t DesiredAccess,
-        uint32_t ObjectAttributes,
-        uint32_t IoStatusBlock,
-        uint32_t AllocationSize,
+        target_ulong ObjectAttributes,
+        target_ulong IoStatusBlock,
+        target_ulong AllocationSize,
         uint32_t FileAttributes,
         uint32_t ShareAccess,
         uint32_t CreateDisposition,
         uint32_t CreateOptions,
-        uint32_t EaBuffer,
+        target_ulong EaBuffer,
         uint32_t EaLength) {
     char *fileName = get_objname(env, ObjectAttributes);
     //    printf ("ntcreatefile_enter %s\n", fileName);
@@ -587,16 +587,16 @@ void w7p_NtCreateFile_enter(
 void w7p_NtCreateFile_return(
         CPUState* env,
         target_ulong pc,
-        uint32_t FileHandle,
+        target_ulong FileHandle,
         uint32_t DesiredAccess,
-        uint32_t ObjectAttributes,
-        uint32_t IoStatusBlock,
-        uint32_t AllocationSize,
+        target_ulong ObjectAttributes,
+        target_ulong IoStatusBlock,
+        target_ulong AllocationSize,
         uint32_t FileAttributes,
         uint32_t ShareAccess,
         uint32_t CreateDisposition,
         uint32_t CreateOptions,
-        uint32_t EaBuffer,
+        target_ulong EaBuffer,
         uint32_t EaLength) {
     //    uint64_t instr = rr_get_guest_instr_count();
     //    printf ("%" PRIu64 " ntcreatefile_return: EAX = %x :  FileHandle = %x last_FileHandle = %x\n", instr, (unsigned int)EAX, FileHandle,  last_filehandle);
@@ -628,10 +628,10 @@ void w7p_NtCreateFile_return(
 void w7p_NtOpenFile_enter(
       CPUState* env,
       target_ulong pc,
-      uint32_t FileHandle,
+      target_ulong FileHandle,
       uint32_t DesiredAccess,
-      uint32_t ObjectAttributes,
-      uint32_t IoStatusBlock,
+      target_ulong ObjectAttributes,
+      target_ulong IoStatusBlock,
       uint32_t ShareAccess,
       uint32_t OpenOptions) {
     char *fileName = get_objname(env, ObjectAttributes);
@@ -648,10 +648,10 @@ void w7p_NtOpenFile_enter(
 void w7p_NtOpenFile_return(
     CPUState* env,
     target_ulong pc,
-    uint32_t FileHandle,
+    target_ulong FileHandle,
     uint32_t DesiredAccess,
-    uint32_t ObjectAttributes,
-    uint32_t IoStatusBlock,
+    target_ulong ObjectAttributes,
+    target_ulong IoStatusBlock,
     uint32_t ShareAccess,
     uint32_t OpenOptions) {
     //    uint64_t instr = rr_get_guest_instr_count();
@@ -674,15 +674,15 @@ void w7p_NtOpenFile_return(
 void w7p_NtReadFile_enter(
         CPUState* env,
         target_ulong pc,
-        uint32_t FileHandle,
-        uint32_t Event,
-        uint32_t UserApcRoutine,
-        uint32_t UserApcContext,
-        uint32_t IoStatusBlock,
-        uint32_t Buffer,
+        target_ulong FileHandle,
+        target_ulong Event,
+        target_ulong UserApcRoutine,
+        target_ulong UserApcContext,
+        target_ulong IoStatusBlock,
+        target_ulong Buffer,
         uint32_t BufferLength,
-        uint32_t ByteOffset,
-        uint32_t Key) {
+        target_ulong ByteOffset,
+        target_ulong Key) {
     char *fileName = get_handle_name(env, get_current_proc(env), FileHandle);
     Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
     ple.nt_read_file = create_cur_process_file(fileName, FileHandle);
@@ -693,7 +693,7 @@ void w7p_NtReadFile_enter(
 void w7p_NtDeleteFile_enter(
         CPUState* env,
         target_ulong pc,
-        uint32_t ObjectAttributes) {
+        target_ulong ObjectAttributes) {
     char *fileName = get_objname(env, ObjectAttributes);
     Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
     ple.nt_delete_file = create_cur_process_file(fileName, 0);
@@ -717,15 +717,15 @@ std::map <std::string, FILE *> writing_files;
 void w7p_NtWriteFile_enter(
         CPUState* env,
         target_ulong pc,
-        uint32_t FileHandle,
-        uint32_t Event,
-        uint32_t ApcRoutine,
-        uint32_t ApcContext,
-        uint32_t IoStatusBlock,
-        uint32_t Buffer,
+        target_ulong FileHandle,
+        target_ulong Event,
+        target_ulong ApcRoutine,
+        target_ulong ApcContext,
+        target_ulong IoStatusBlock,
+        target_ulong Buffer,
         uint32_t Length,
-        uint32_t ByteOffset,
-        uint32_t Key) {
+        target_ulong ByteOffset,
+        target_ulong Key) {
     char *fileName = get_handle_name(env, get_current_proc(env), FileHandle);
     Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
     ple.nt_write_file = create_cur_process_file(fileName, FileHandle);
@@ -793,9 +793,9 @@ typedef struct _FILE_RENAME_INFORMATION {
 
 void w7p_NtSetInformationFile_enter(CPUState* env,
                                     target_ulong pc,
-                                    uint32_t FileHandle,
-                                    uint32_t IoStatusBlock,
-                                    uint32_t FileInformation,  /* PVOID */
+                                    target_ulong FileHandle,
+                                    target_ulong IoStatusBlock,
+                                    target_ulong FileInformation,  /* PVOID */
                                     uint32_t Length,
                                     uint32_t FileInformationClass) {
     //    printf ("%" PRId64 " : SetInformationFile_enter %d\n", rr_get_guest_instr_count(), FileInformationClass);
@@ -883,13 +883,13 @@ char *get_key_objname(CPUState *env, target_ulong obj){
 void w7p_NtCreateKey_return(
         CPUState* env,
         target_ulong pc,
-        uint32_t pKeyHandle,
+        target_ulong pKeyHandle,
         uint32_t DesiredAccess,
-        uint32_t ObjectAttributes,
+        target_ulong ObjectAttributes,
         uint32_t TitleIndex,
-        uint32_t Class,
+        target_ulong Class,
         uint32_t CreateOptions,
-        uint32_t Disposition) {
+        target_ulong Disposition) {
     char *keyName = get_key_objname(env, ObjectAttributes);
     Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
     ple.nt_create_key = create_cur_process_key(keyName);
@@ -928,9 +928,9 @@ void w7p_NtCreateKeyTransacted_enter(
 void w7p_NtOpenKey_return (
         CPUState* env,
         target_ulong pc,
-        uint32_t pKeyHandle,
+        target_ulong pKeyHandle,
         uint32_t DesiredAccess,
-        uint32_t ObjectAttributes) {
+        target_ulong ObjectAttributes) {
     char *keyName = get_key_objname(env, ObjectAttributes);
     Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
     ple.nt_open_key = create_cur_process_key(keyName);
@@ -946,9 +946,9 @@ void w7p_NtOpenKey_return (
 void w7p_NtOpenKeyEx_return (
         CPUState* env,
         target_ulong pc,
-        uint32_t pKeyHandle,
+        target_ulong pKeyHandle,
         uint32_t DesiredAccess,
-        uint32_t ObjectAttributes,
+        target_ulong ObjectAttributes,
         uint32_t OpenOptions) {
     char *keyName = get_key_objname(env, ObjectAttributes);
     Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
@@ -1004,7 +1004,7 @@ void forget_reg_key(uint32_t KeyHandle) {
 void w7p_NtDeleteKey_enter (
         CPUState* env,
         target_ulong pc,
-        uint32_t KeyHandle) {
+        target_ulong KeyHandle) {
     Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
     char *keyname = get_keyname(KeyHandle);
     if (keyname) {
@@ -1019,11 +1019,11 @@ void w7p_NtDeleteKey_enter (
 void w7p_NtQueryKey_enter(
         CPUState* env,
         target_ulong pc,
-        uint32_t KeyHandle,
+        target_ulong KeyHandle,
         uint32_t KeyInformationClass,
-        uint32_t KeyInformation,
+        target_ulong KeyInformation,
         uint32_t Length,
-        uint32_t ResultLength) {
+        target_ulong ResultLength) {
     Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
     char *keyname = get_keyname(KeyHandle);
     if (keyname) {
@@ -1049,12 +1049,12 @@ Panda__ProcessKeyValue *create_cur_process_key_value (char *keyname, char *value
 void w7p_NtQueryValueKey_enter (
         CPUState* env,
         target_ulong pc,
-        uint32_t KeyHandle,
-        uint32_t ValueName,
+        target_ulong KeyHandle,
+        target_ulong ValueName,
         uint32_t KeyValueInformationClass,
-        uint32_t KeyValueInformation,
+        target_ulong KeyValueInformation,
         uint32_t Length,
-        uint32_t ResultLength) {
+        target_ulong ResultLength) {
     char *vn = read_unicode_string(env, ValueName);
     if (vn) {
         Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
@@ -1072,8 +1072,8 @@ void w7p_NtQueryValueKey_enter (
 void w7p_NtDeleteValueKey_enter(
         CPUState* env,
         target_ulong pc,
-        uint32_t KeyHandle,
-        uint32_t ValueName) {
+        target_ulong KeyHandle,
+        target_ulong ValueName) {
     char *vn = read_unicode_string(env, ValueName);
     if (vn) {
         Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
@@ -1101,12 +1101,12 @@ Panda__ProcessKeyIndex *create_cur_process_key_index(char *keyname, uint32_t ind
 void w7p_NtEnumerateKey_enter(
        CPUState* env,
        target_ulong pc,
-       uint32_t KeyHandle,
+       target_ulong KeyHandle,
        uint32_t Index,
        uint32_t KeyInformationClass,
-       uint32_t KeyInformation,
+       target_ulong KeyInformation,
        uint32_t Length,
-       uint32_t ResultLength) {
+       target_ulong ResultLength) {
     Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
     char *keyname = get_keyname(KeyHandle);
     if (keyname) {
@@ -1137,11 +1137,11 @@ void w7p_NtEnumerateValueKey_enter(
 void w7p_NtSetValueKey_enter(
         CPUState* env,
         target_ulong pc,
-        uint32_t KeyHandle,
-        uint32_t ValueName,
+        target_ulong KeyHandle,
+        target_ulong ValueName,
         uint32_t TitleIndex,
         uint32_t Type,
-        uint32_t Data,
+        target_ulong Data,
         uint32_t DataSize) {
     char *vn = read_unicode_string(env, ValueName);
     if (vn) {
@@ -1224,13 +1224,13 @@ void print_section(
 void w7p_NtCreateSection_return(
 	CPUState* env,
 	target_ulong pc,
-	uint32_t SectionHandle, //Pointer to a HANDLE variable that receives a handle to the section object.
+	target_ulong SectionHandle, //Pointer to a HANDLE variable that receives a handle to the section object.
 	uint32_t DesiredAccess, //Specifies an Access Mask
-	uint32_t ObjectAttributes, //Pointer to an OBJECT_ATTRIBUTES structure
-	uint32_t MaximumSize,
+	target_ulong ObjectAttributes, //Pointer to an OBJECT_ATTRIBUTES structure
+	target_ulong MaximumSize,
 	uint32_t SectionPageProtection,
 	uint32_t AllocationAttributes,
-	uint32_t FileHandle) { //Optional handle for an open file object. If NULL, backed by the paging file.
+	target_ulong FileHandle) { //Optional handle for an open file object. If NULL, backed by the paging file.
   //print_section(env, pc, SectionHandle, DesiredAccess, ObjectAttributes, true);
   //printf("  nt_create_section\n");
   char *sectionName = get_objname(env, ObjectAttributes);
@@ -1260,9 +1260,9 @@ void w7p_NtCreateSection_return(
 void w7p_NtOpenSection_return (
         CPUState* env,
 	target_ulong pc,
-	uint32_t SectionHandle,
+	target_ulong SectionHandle,
 	uint32_t DesiredAccess,
-	uint32_t ObjectAttributes){
+	target_ulong ObjectAttributes){
     //printf("  nt_open_section\n");
   char *sectionName = get_objname(env, ObjectAttributes);
 
@@ -1283,13 +1283,13 @@ void w7p_NtOpenSection_return (
 void w7p_NtMapViewOfSection_return(
         CPUState* env,
 	target_ulong pc,
-	uint32_t SectionHandle,
-	uint32_t ProcessHandle,
-	uint32_t BaseAddress,
-	uint32_t ZeroBits,
-	uint32_t CommitSize,
-	uint32_t SectionOffset,
-	uint32_t ViewSize,
+	target_ulong SectionHandle,
+	target_ulong ProcessHandle,
+	target_ulong BaseAddress,
+	target_ulong ZeroBits,
+	target_ulong CommitSize,
+	target_ulong SectionOffset,
+	target_ulong ViewSize,
 	uint32_t InheritDisposition,
 	uint32_t AllocationType,
 	uint32_t AccessProtection){
@@ -1418,8 +1418,8 @@ void print_port_pointer(CPUState *env, uint32_t PortHandle) {
 void w7p_NtCreatePort_return(
         CPUState* env,
 	target_ulong pc,
-	uint32_t PortHandle,
-	uint32_t ObjectAttributes,
+	target_ulong PortHandle,
+	target_ulong ObjectAttributes,
 	uint32_t MaxConnectionInfoLength,
 	uint32_t MaxMessageLength,
 	uint32_t MaxPoolUsag) {
@@ -1435,14 +1435,14 @@ void w7p_NtCreatePort_return(
 void w7p_NtConnectPort_return(
         CPUState* env,
 	target_ulong pc,
-	uint32_t PortHandle,
-	uint32_t PortName,
-	uint32_t SecurityQos,
-	uint32_t ClientView,
-	uint32_t ServerView,
-	uint32_t MaxMessageLength,
-	uint32_t ConnectionInformation,
-	uint32_t ConnectionInformationLength) {
+	target_ulong PortHandle,
+	target_ulong PortName,
+	target_ulong SecurityQos,
+	target_ulong ClientView,
+	target_ulong ServerView,
+	target_ulong MaxMessageLength,
+	target_ulong ConnectionInformation,
+	target_ulong ConnectionInformationLength) {
   HandleObject *ho = get_handle_object_current(env, PortHandle);
   if (ho == NULL) {
     return;
@@ -1455,8 +1455,8 @@ void w7p_NtConnectPort_return(
 void w7p_NtListenPort_return(
 	CPUState* env,
 	target_ulong pc,
-	uint32_t PortHandle,
-	uint32_t ConnectionRequest) {
+	target_ulong PortHandle,
+	target_ulong ConnectionRequest) {
   // Not very common
   HandleObject *ho = get_handle_object_current(env, PortHandle);
   if (ho == NULL) {
@@ -1469,12 +1469,12 @@ void w7p_NtListenPort_return(
 void w7p_NtAcceptConnectPort_return(
 	CPUState* env,
 	target_ulong pc,
-	uint32_t PortHandle,
-	uint32_t PortContext,
-	uint32_t ConnectionRequest,
+	target_ulong PortHandle,
+	target_ulong PortContext,
+	target_ulong ConnectionRequest,
 	uint32_t AcceptConnection,
-	uint32_t ServerView,
-	uint32_t ClientView) {
+	target_ulong ServerView,
+	target_ulong ClientView) {
   HandleObject *ho = get_handle_object_current(env, PortHandle);
   if (ho == NULL) {
     return;
@@ -1486,7 +1486,7 @@ void w7p_NtAcceptConnectPort_return(
 void w7p_NtCompleteConnectPort_return(
 	CPUState* env,
 	target_ulong pc,
-	uint32_t PortHandle) {
+	target_ulong PortHandle) {
   HandleObject *ho = get_handle_object_current(env, PortHandle);
   if (ho == NULL) {
     return;
@@ -1498,8 +1498,8 @@ void w7p_NtCompleteConnectPort_return(
 void w7p_NtRequestPort_return(
 	CPUState* env,
 	target_ulong pc,
-	uint32_t PortHandle,
-	uint32_t LpcMessage) {
+	target_ulong PortHandle,
+	target_ulong LpcMessage) {
   uint32_t eproc = get_current_proc(env);
   HandleObject *ho = get_handle_object(env, eproc, PortHandle);
   if (ho == NULL) {
@@ -1512,9 +1512,9 @@ void w7p_NtRequestPort_return(
 void w7p_NtRequestWaitReplyPort_return(
 	CPUState* env,
 	target_ulong pc,
-	uint32_t PortHandle, // not a pointer because consistency doesn't matter \s
-	uint32_t LpcReply,
-	uint32_t LpcRequest) {
+	target_ulong PortHandle, // not a pointer because consistency doesn't matter \s
+	target_ulong LpcReply,
+	target_ulong LpcRequest) {
   uint32_t eproc = get_current_proc(env);
   HandleObject *ho = get_handle_object(env, eproc, PortHandle);
   if (ho == NULL) {
@@ -1527,8 +1527,8 @@ void w7p_NtRequestWaitReplyPort_return(
 void w7p_NtReplyPort_return(
 	CPUState* env,
 	target_ulong pc,
-	uint32_t PortHandle,
-	uint32_t LpcReply) {
+	target_ulong PortHandle,
+	target_ulong LpcReply) {
   uint32_t eproc = get_current_proc(env);
   HandleObject *ho = get_handle_object(env, eproc, PortHandle);
   if (ho == NULL) {
@@ -1541,8 +1541,8 @@ void w7p_NtReplyPort_return(
 void w7p_NtReplyWaitReplyPort_return(
 	CPUState* env,
 	target_ulong pc,
-	uint32_t PortHandle,
-	uint32_t ReplyMessage) {
+	target_ulong PortHandle,
+	target_ulong ReplyMessage) {
   uint32_t eproc = get_current_proc(env);
   HandleObject *ho = get_handle_object(env, eproc, PortHandle);
   if (ho == NULL) {
@@ -1555,10 +1555,10 @@ void w7p_NtReplyWaitReplyPort_return(
 void w7p_NtReplyWaitReceivePort_return(
 	CPUState* env,
 	target_ulong pc,
-	uint32_t PortHandle,
-	uint32_t PortContext,
-	uint32_t ReplyMessage,
-	uint32_t ReceiveMessage) {
+	target_ulong PortHandle,
+	target_ulong PortContext,
+	target_ulong ReplyMessage,
+	target_ulong ReceiveMessage) {
   uint32_t eproc = get_current_proc(env);
   HandleObject *ho = get_handle_object(env, eproc, PortHandle);
   if (ho == NULL) {
@@ -1571,8 +1571,8 @@ void w7p_NtReplyWaitReceivePort_return(
 void w7p_NtImpersonateClientOfPort_return(
 	CPUState* env,
 	target_ulong pc,
-	uint32_t PortHandle,
-	uint32_t ClientMessage) {
+	target_ulong PortHandle,
+	target_ulong ClientMessage) {
   uint32_t eproc = get_current_proc(env);
   HandleObject *ho = get_handle_object(env, eproc, PortHandle);
   if (ho == NULL) {
@@ -1593,11 +1593,11 @@ Panda__VirtualMemory *create_panda_vm(uint32_t proc_pid, char *proc_name, uint32
 
 void w7p_NtReadVirtualMemory_return(CPUState* env,
 				    target_ulong pc,
-				    uint32_t ProcessHandle,
-				    uint32_t BaseAddress,
-				    uint32_t Buffer,
-				    uint32_t NumberOfBytesToRead,
-				    uint32_t NumberOfBytesRead) {
+				    target_ulong ProcessHandle,
+				    target_ulong BaseAddress,
+				    target_ulong Buffer,
+				    target_ulong NumberOfBytesToRead,
+				    target_ulong NumberOfBytesRead) {
     uint32_t eproc = get_current_proc(env);
     HandleObject *ho = get_handle_object(env, eproc, ProcessHandle);
     if (ho == NULL) {
@@ -1612,11 +1612,11 @@ void w7p_NtReadVirtualMemory_return(CPUState* env,
 }
 void w7p_NtWriteVirtualMemory_return(CPUState* env,
 				     target_ulong pc,
-				     uint32_t ProcessHandle,
-				     uint32_t BaseAddress,
-				     uint32_t Buffer,
-				     uint32_t NumberOfBytesToWrite,
-				     uint32_t NumberOfBytesWritten) {
+				     target_ulong ProcessHandle,
+				     target_ulong BaseAddress,
+				     target_ulong Buffer,
+				     target_ulong NumberOfBytesToWrite,
+				     target_ulong NumberOfBytesWritten) {
     uint32_t eproc = get_current_proc(env);
     HandleObject *ho = get_handle_object(env, eproc, ProcessHandle);
     if (ho == NULL) {
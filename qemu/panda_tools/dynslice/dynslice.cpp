@@ -10,9 +10,9 @@
 
 #include <bitset>
 #include <vector>
-#include <set>
-#include <stack>
 #include <map>
+#include <unordered_map>
+#include <algorithm>
 
 #include "llvm/IR/Constants.h"
 #include "llvm/IR/Instructions.h"
@@ -27,6 +27,7 @@
 
 #include "tubtf.h"
 #include "panda_memlog.h"
+#include "../../panda_plugins/common/open_hash.h"
 
 using namespace llvm;
 
@@ -230,20 +231,12 @@ void dump_tubt(TUBTEntry *row) {
     }
 }
 
-struct trace_entry {
-    uint32_t index; // index of instruction in the original function
-    Function *func;
-    Instruction *insn;
-    TUBTEntry *dyn;
-    TUBTEntry *dyn2; // Just for memcpy because it's a special snowflake
-};
-
 static SliceVar get_value_name(Value *v) {
     return std::make_pair(LLVM, (uint64_t)v);
 }
 
-static void insertValue(std::set<SliceVar> &s, Value *v) {
-    if (!isa<Constant>(v)) s.insert(get_value_name(v));
+static void insertValue(std::vector<SliceVar> &s, Value *v) {
+    if (!isa<Constant>(v)) s.push_back(get_value_name(v));
 }
 
 int getLoadSize(LoadInst *l) {
@@ -262,17 +255,17 @@ int getStoreSize(StoreInst *s) {
 // AddrEntry. NOTE: don't use this on __ld / __st, as the
 // MADDR type means something different in that context.
 // arg2 is the TUBT arg2 column
-void insertAddr(std::set<SliceVar> &s, AddrType typ, uint64_t arg2, int sz) {
+void insertAddr(std::vector<SliceVar> &s, AddrType typ, uint64_t arg2, int sz) {
     switch (typ) {
         case GREG:
-            s.insert(std::make_pair(REG, arg2));
+            s.push_back(std::make_pair(REG, arg2));
             break;
         case MADDR:
             for (int off = 0; off < sz; off++)
-                s.insert(std::make_pair(HOST, arg2+off));
+                s.push_back(std::make_pair(HOST, arg2+off));
             break;
         case GSPEC:
-            s.insert(std::make_pair(SPEC,arg2));
+            s.push_back(std::make_pair(SPEC,arg2));
             break;
         default:
             printf("Warning: unhandled address entry type %d\n", typ);
@@ -280,247 +273,263 @@ void insertAddr(std::set<SliceVar> &s, AddrType typ, uint64_t arg2, int sz) {
     }
 }
 
-// Handlers for individual instruction types
-
-static void handleStore(trace_entry &t,
-        std::set<SliceVar> &uses,
-        std::set<SliceVar> &defs) {
-    StoreInst *s = cast<StoreInst>(t.insn);
-    AddrType typ;
-    AddrFlag flag;
-    int off;
-    extract_addrentry(t.dyn->arg1, typ, flag, off);
-
-    if (!s->isVolatile() && flag != IRRELEVANT) {
-        insertAddr(defs, typ, t.dyn->arg2, getStoreSize(s));
-        Value *v = s->getValueOperand();
-        insertValue(uses, v);
-        Value *p = s->getPointerOperand();
-        insertValue(uses, p);
+// The working set. Slicing spends most of its time asking whether an
+// instruction defines anything in here, so it's a flat hash set rather
+// than a tree. The mapped value is unused.
+struct SliceVarHash {
+    size_t operator()(const SliceVar &s) const {
+        // OpenHashMap mixes this, so the combine can be cheap
+        return s.second * 8 + s.first;
     }
-    return;
-}
+};
+typedef OpenHashMap<SliceVar,uint8_t,SliceVarHash> WorkSet;
+
+typedef std::vector<std::pair<SliceVar,SliceVar>> ArgMap;
+
+// Everything about an instruction that doesn't depend on the dynamic log
+// is worked out once per LLVM function, the first time the function shows
+// up in the trace. Aligning and slicing a dynamic instance of a block then
+// only has to combine these summaries with the logged values, instead of
+// going back to the IR for every instruction of every block executed.
+
+// What an instruction consumes from the dynamic log during alignment
+enum DynKind {
+    DYN_NONE,       // nothing logged
+    DYN_SKIP,       // nothing logged, and left out of the trace
+    DYN_LOAD,
+    DYN_STORE,
+    DYN_MEMCPY,     // a load followed by a store
+    DYN_BRANCH,
+    DYN_SWITCH,
+    DYN_SELECT,
+    DYN_PHI,        // nothing logged; the incoming edge is known from the trace
+    DYN_DESCEND,    // call to a function with its own trace
+};
 
-static void handleLoad(trace_entry &t,
-        std::set<SliceVar> &uses,
-        std::set<SliceVar> &defs) {
-    LoadInst *l = cast<LoadInst>(t.insn);
-    AddrType typ;
-    AddrFlag flag;
-    int off;
-    extract_addrentry(t.dyn->arg1, typ, flag, off);
+// How the uses and defs of an instance are computed
+enum SliceKind {
+    SK_NONE,        // no uses or defs
+    SK_STATIC,      // just the static ones
+    SK_LOAD,
+    SK_STORE,
+    SK_GUEST_LOAD,  // __ld*
+    SK_GUEST_STORE, // __st*
+    SK_MEMCPY,
+    SK_MEMSET,
+    SK_HELPER,
+    SK_RET,
+    SK_PHI,
+    SK_SELECT,
+};
 
-    if (flag != IRRELEVANT) {
-        insertAddr(uses, typ, t.dyn->arg2, getLoadSize(l));
+struct InsnSummary {
+    Instruction *insn;
+    uint32_t index;             // bb_num << 16 | insn_index
+    DynKind dyn;
+    SliceKind kind;
+    int size;                   // bytes accessed by loads and stores
+    bool is_branch;             // non-return terminator, for -b
+    bool is_func_entry;         // first instruction of the function
+    std::vector<SliceVar> uses; // uses that don't depend on the log
+    std::vector<SliceVar> defs; // defs that don't depend on the log
+    std::vector<int> succ;      // DYN_BRANCH: successor block indices
+    Value *true_val;            // SK_SELECT
+    Value *false_val;
+    Function *callee;           // DYN_DESCEND
+    ArgMap argmap;              // DYN_DESCEND: callee argument => actual
+};
+
+struct BlockSummary {
+    BasicBlock *bb;
+    int index;
+    std::vector<InsnSummary> insns;
+    std::bitset<MAX_BITSET> *marks; // this block's entry in 'marked', once it has one
+};
+
+struct FuncSummary {
+    Function *func;
+    std::vector<BlockSummary> blocks; // blocks[0] is the entry block
+    std::map<BasicBlock*,int> block_index;
+};
+
+struct trace_entry {
+    FuncSummary *fs;
+    BlockSummary *bs;
+    const InsnSummary *is;
+    TUBTEntry *dyn;
+    TUBTEntry *dyn2;  // Just for memcpy because it's a special snowflake
+    Value *phi_val;   // incoming value a PHI picked
+};
+
+static int ldst_size(StringRef func_name) {
+    switch (func_name[4]) {
+        case 'q': return 8;
+        case 'l': return 4;
+        case 'w': return 2;
+        case 'b': return 1;
+        default: assert(false && "Invalid size in call to load/store");
     }
-    Value *p = l->getPointerOperand();
-    insertValue(uses, p);
-    // Even IRRELEVANT loads can define things
-    insertValue(defs, t.insn);
-    return;
+    return -1;
 }
 
-static void handleDefault(trace_entry &t,
-        std::set<SliceVar> &uses,
-        std::set<SliceVar> &defs) {
-    for (User::op_iterator i = t.insn->op_begin(), e = t.insn->op_end(); i != e; ++i) {
-        Value *v = *i;
-        if (!isa<BasicBlock>(v)) { // So that br doesn't end up with block refs
-            insertValue(uses, *i);
-        }
+static int const_bytes(Value *v) {
+    ConstantInt* CI = dyn_cast<ConstantInt>(v);
+    if (CI && CI->getBitWidth() <= 64) {
+        return CI->getSExtValue();
     }
-    insertValue(defs, t.insn);
-    return;
+    return 0;
 }
 
-static void handleCall(trace_entry &t,
-        std::set<SliceVar> &uses,
-        std::set<SliceVar> &defs) {
-    CallInst *c =  cast<CallInst>(t.insn);
+static void summarize_call(InsnSummary &is) {
+    CallInst *c =  cast<CallInst>(is.insn);
     Function *subf = c->getCalledFunction();
+    assert(subf != NULL);
     StringRef func_name = subf->getName();
     if (func_name.startswith("__ld")) {
-        char sz_c = func_name[4];
-        int size = -1;
-        switch(sz_c) {
-            case 'q': size = 8; break;
-            case 'l': size = 4; break;
-            case 'w': size = 2; break;
-            case 'b': size = 1; break;
-            default: assert(false && "Invalid size in call to load");
-        }
-        for (int off = 0; off < size; off++) {
-            uses.insert(std::make_pair(MEM, t.dyn->arg2 + off));
-        }
-        Value *load_addr = c->getArgOperand(0);
-        insertValue(uses, load_addr);
-        insertValue(defs, t.insn);
+        is.dyn = DYN_LOAD;
+        is.kind = SK_GUEST_LOAD;
+        is.size = ldst_size(func_name);
+        insertValue(is.uses, c->getArgOperand(0));
+        insertValue(is.defs, c);
     }
     else if (func_name.startswith("__st")) {
-        char sz_c = func_name[4];
-        int size = -1;
-        switch(sz_c) {
-            case 'q': size = 8; break;
-            case 'l': size = 4; break;
-            case 'w': size = 2; break;
-            case 'b': size = 1; break;
-            default: assert(false && "Invalid size in call to store");
-        }
-        for (int off = 0; off < size; off++) {
-            defs.insert(std::make_pair(MEM, t.dyn->arg2 + off));
-        }
-        Value *store_addr = c->getArgOperand(0);
-        Value *store_val  = c->getArgOperand(1);
-        insertValue(uses, store_addr);
-        insertValue(uses, store_val);
+        is.dyn = DYN_STORE;
+        is.kind = SK_GUEST_STORE;
+        is.size = ldst_size(func_name);
+        insertValue(is.uses, c->getArgOperand(0));
+        insertValue(is.uses, c->getArgOperand(1));
     }
     else if (func_name.startswith("llvm.memcpy")) {
-        AddrType typ;
-        AddrFlag flag;
-        int off;
-
-        // Get memcpy size
-        int bytes = 0;
-        Value *bytes_ir = const_cast<Value*>(c->getArgOperand(2));
-        ConstantInt* CI = dyn_cast<ConstantInt>(bytes_ir);
-        if (CI && CI->getBitWidth() <= 64) {
-            bytes = CI->getSExtValue();
-        }
-
-        // Load first
-        extract_addrentry(t.dyn->arg1, typ, flag, off);
-        if (flag != IRRELEVANT)
-            insertAddr(uses, typ, t.dyn->arg2, bytes);
-
-        // Now store
-        extract_addrentry(t.dyn2->arg1, typ, flag, off);
-        if (flag != IRRELEVANT)
-            insertAddr(defs, typ, t.dyn2->arg2, bytes);
-
+        is.dyn = DYN_MEMCPY;
+        is.kind = SK_MEMCPY;
+        is.size = const_bytes(c->getArgOperand(2));
         // Src/Dst pointers
-        insertValue(uses, c->getArgOperand(0));
-        insertValue(uses, c->getArgOperand(1));
-        
+        insertValue(is.uses, c->getArgOperand(0));
+        insertValue(is.uses, c->getArgOperand(1));
     }
     else if (func_name.startswith("llvm.memset")) {
-        AddrType typ;
-        AddrFlag flag;
-        int off;
-
-        int bytes = 0;
-        Value *bytes_ir  = const_cast<Value*>(c->getArgOperand(2));
-        ConstantInt* CI = dyn_cast<ConstantInt>(bytes_ir);
-        if (CI && CI->getBitWidth() <= 64) {
-            bytes = CI->getSExtValue();
-        }
-
-        // Now store
-        extract_addrentry(t.dyn->arg1, typ, flag, off);
-        if (flag != IRRELEVANT)
-            insertAddr(defs, typ, t.dyn->arg2, bytes);
-
-        // Dst pointer
-        insertValue(uses, c->getArgOperand(0));
-
-        // Value (if not constant)
-        insertValue(uses, c->getArgOperand(1));
+        is.dyn = DYN_STORE;
+        is.kind = SK_MEMSET;
+        is.size = const_bytes(c->getArgOperand(2));
+        // Dst pointer, and the value (if not constant)
+        insertValue(is.uses, c->getArgOperand(0));
+        insertValue(is.uses, c->getArgOperand(1));
     }
     else if (func_name.equals("helper_inb") ||
              func_name.equals("helper_inw") ||
              func_name.equals("helper_inl")) {
-        insertValue(uses, c->getArgOperand(0));
-        insertValue(defs, c);
+        is.dyn = DYN_LOAD;
+        is.kind = SK_STATIC;
+        insertValue(is.uses, c->getArgOperand(0));
+        insertValue(is.defs, c);
     }
     else if (func_name.equals("helper_outb") ||
              func_name.equals("helper_outw") ||
              func_name.equals("helper_outl")) {
         // We don't have any model of port I/O, so
         // we just ignore this one
+        is.dyn = DYN_STORE;
+        is.kind = SK_NONE;
     }
-    else if (func_name.equals("log_dynval")) {
-        // ignore
+    else if (func_name.equals("log_dynval") ||
+             subf->isDeclaration() ||
+             subf->isIntrinsic()) {
+        is.dyn = DYN_SKIP;
     }
     else {
         // call to some helper
+        is.dyn = DYN_DESCEND;
+        is.kind = SK_HELPER;
+        is.callee = subf;
         if (!c->getType()->isVoidTy()) {
-            insertValue(defs, c);
+            insertValue(is.defs, c);
         }
-        // Uses the return value of that function.
+        // Uses the return value of that function (added per instance).
         // Note that it does *not* use the arguments -- these will
         // get included automatically if they're needed to compute
         // the return value.
-        uses.insert(std::make_pair(FRET, ret_ctr));
-    }
-    return;
-}
-
-static void handleRet(trace_entry &t,
-        std::set<SliceVar> &uses,
-        std::set<SliceVar> &defs) {
 
-    ReturnInst *r = cast<ReturnInst>(t.insn);
-    Value *v = r->getReturnValue();
-    if (v != NULL) insertValue(uses, v);
-
-    defs.insert(std::make_pair(FRET, ret_ctr++));
-}
-
-static void handlePHI(trace_entry &t,
-        std::set<SliceVar> &uses,
-        std::set<SliceVar> &defs) {
-    // arg1 is the fake dynamic value we derived during trace alignment
-    PHINode *p = cast<PHINode>(t.insn);
-    Value *v = p->getIncomingValue(t.dyn->arg1);
-    insertValue(uses, v);
-    insertValue(defs, t.insn);
-}
-
-static void handleSelect(trace_entry &t,
-        std::set<SliceVar> &uses,
-        std::set<SliceVar> &defs) {
-
-    SelectInst *s = cast<SelectInst>(t.insn);
-    Value *v;
-    // These are negated in the dynamic log from what you'd expect
-    if (t.dyn->arg1 == 1)
-        v = s->getFalseValue();
-    else
-        v = s->getTrueValue();
-
-    insertValue(uses, v);
-    insertValue(uses, s->getCondition());
-    insertValue(defs, t.insn);
+        // Bind arguments to values for when we descend
+        Function::arg_iterator argIter;
+        unsigned p;
+        for (argIter = subf->arg_begin(), p = 0;
+             argIter != subf->arg_end() && p < c->getNumArgOperands();
+             argIter++, p++) {
+            is.argmap.push_back(std::make_pair(get_value_name(&*argIter),
+                        get_value_name(c->getArgOperand(p))));
+        }
+    }
 }
 
-// I don't *think* we can use LLVM's InstructionVisitor here because actually
-// want to operate on a trace element, not an Instruction (and hence we need
-// the accompanying dynamic info).
-void get_uses_and_defs(trace_entry &t,
-        std::set<SliceVar> &uses,
-        std::set<SliceVar> &defs) {
-    switch (t.insn->getOpcode()) {
-        case Instruction::Store:
-            handleStore(t, uses, defs);
+static void summarize_insn(FuncSummary &fs, InsnSummary &is) {
+    Instruction *insn = is.insn;
+    is.dyn = DYN_NONE;
+    is.kind = SK_STATIC;
+    is.is_branch = insn->isTerminator() && !isa<ReturnInst>(insn);
+
+    switch (insn->getOpcode()) {
+        case Instruction::Store: {
+            StoreInst *s = cast<StoreInst>(insn);
+            if (s->isVolatile()) {
+                is.dyn = DYN_SKIP;
+                is.kind = SK_NONE;
+                return;
+            }
+            is.dyn = DYN_STORE;
+            is.kind = SK_STORE;
+            is.size = getStoreSize(s);
+            insertValue(is.uses, s->getValueOperand());
+            insertValue(is.uses, s->getPointerOperand());
             return;
-        case Instruction::Load:
-            handleLoad(t, uses, defs);
+        }
+        case Instruction::Load: {
+            LoadInst *l = cast<LoadInst>(insn);
+            is.dyn = DYN_LOAD;
+            is.kind = SK_LOAD;
+            is.size = getLoadSize(l);
+            insertValue(is.uses, l->getPointerOperand());
+            // Even IRRELEVANT loads can define things
+            insertValue(is.defs, insn);
             return;
+        }
         case Instruction::Call:
-            handleCall(t, uses, defs);
+            summarize_call(is);
             return;
-        case Instruction::Ret:
-            handleRet(t, uses, defs);
+        case Instruction::Ret: {
+            ReturnInst *r = cast<ReturnInst>(insn);
+            Value *v = r->getReturnValue();
+            is.kind = SK_RET;
+            if (v != NULL) insertValue(is.uses, v);
             return;
+        }
         case Instruction::PHI:
-            handlePHI(t, uses, defs);
+            is.dyn = DYN_PHI;
+            is.kind = SK_PHI;
+            insertValue(is.defs, insn);
             return;
-        case Instruction::Select:
-            handleSelect(t, uses, defs);
+        case Instruction::Select: {
+            SelectInst *s = cast<SelectInst>(insn);
+            is.dyn = DYN_SELECT;
+            is.kind = SK_SELECT;
+            is.true_val = s->getTrueValue();
+            is.false_val = s->getFalseValue();
+            insertValue(is.uses, s->getCondition());
+            insertValue(is.defs, insn);
             return;
+        }
         case Instruction::Unreachable: // how do we even get these??
+            is.kind = SK_NONE;
             return;
-        case Instruction::Br:
+        case Instruction::Br: {
+            BranchInst *b = cast<BranchInst>(insn);
+            is.dyn = DYN_BRANCH;
+            for (unsigned i = 0; i < b->getNumSuccessors(); i++)
+                is.succ.push_back(fs.block_index[b->getSuccessor(i)]);
+            break;
+        }
         case Instruction::Switch:
+            is.dyn = DYN_SWITCH;
+            break;
         case Instruction::Add:
         case Instruction::Sub:
         case Instruction::Mul:
@@ -546,17 +555,125 @@ void get_uses_and_defs(trace_entry &t,
         case Instruction::ICmp:
         case Instruction::FCmp:
         case Instruction::Alloca:
-            handleDefault(t, uses, defs);
-            return;
+            break;
         default:
-            printf("Note: no model for %s, assuming uses={operands} defs={lhs}\n", t.insn->getOpcodeName());
-            // Try "default" operand handling
-            // defs = LHS, right = operands
+            printf("Note: no model for %s, assuming uses={operands} defs={lhs}\n", insn->getOpcodeName());
+            break;
+    }
+
+    // "default" operand handling: defs = LHS, uses = operands
+    for (User::op_iterator i = insn->op_begin(), e = insn->op_end(); i != e; ++i) {
+        Value *v = *i;
+        if (!isa<BasicBlock>(v)) { // So that br doesn't end up with block refs
+            insertValue(is.uses, v);
+        }
+    }
+    insertValue(is.defs, insn);
+}
+
+std::unordered_map<Function*,FuncSummary*> summaries;
+
+FuncSummary *get_summary(Function *f) {
+    FuncSummary *&fs = summaries[f];
+    if (fs) return fs;
+
+    fs = new FuncSummary;
+    fs->func = f;
+    int bb_index = 0;
+    for (Function::iterator it = f->begin(), ed = f->end(); it != ed; ++it) {
+        fs->block_index[&*it] = bb_index++;
+    }
+    fs->blocks.resize(bb_index);
+
+    bb_index = 0;
+    for (Function::iterator it = f->begin(), ed = f->end(); it != ed; ++it, ++bb_index) {
+        BlockSummary &bs = fs->blocks[bb_index];
+        bs.bb = &*it;
+        bs.index = bb_index;
+        bs.marks = NULL;
+        int insn_index = 0;
+        for (BasicBlock::iterator i = it->begin(), e = it->end(); i != e; ++i, ++insn_index) {
+            bs.insns.push_back(InsnSummary());
+            InsnSummary &is = bs.insns.back();
+            is.insn = &*i;
+            is.index = insn_index | (bb_index << 16);
+            is.is_func_entry = (bb_index == 0 && insn_index == 0);
+            summarize_insn(*fs, is);
+        }
+    }
+    return fs;
+}
+
+// I don't *think* we can use LLVM's InstructionVisitor here because actually
+// want to operate on a trace element, not an Instruction (and hence we need
+// the accompanying dynamic info).
+void get_uses_and_defs(trace_entry &t,
+        std::vector<SliceVar> &uses,
+        std::vector<SliceVar> &defs) {
+    const InsnSummary &is = *t.is;
+    AddrType typ;
+    AddrFlag flag;
+    int off;
 
-            handleDefault(t, uses, defs);
+    switch (is.kind) {
+        case SK_NONE:
             return;
+        case SK_STATIC:
+            break;
+        case SK_LOAD:
+            extract_addrentry(t.dyn->arg1, typ, flag, off);
+            if (flag != IRRELEVANT) {
+                insertAddr(uses, typ, t.dyn->arg2, is.size);
+            }
+            break;
+        case SK_STORE:
+            extract_addrentry(t.dyn->arg1, typ, flag, off);
+            if (flag == IRRELEVANT) return;
+            insertAddr(defs, typ, t.dyn->arg2, is.size);
+            break;
+        case SK_GUEST_LOAD:
+            for (int off = 0; off < is.size; off++) {
+                uses.push_back(std::make_pair(MEM, t.dyn->arg2 + off));
+            }
+            break;
+        case SK_GUEST_STORE:
+            for (int off = 0; off < is.size; off++) {
+                defs.push_back(std::make_pair(MEM, t.dyn->arg2 + off));
+            }
+            break;
+        case SK_MEMCPY:
+            // Load first
+            extract_addrentry(t.dyn->arg1, typ, flag, off);
+            if (flag != IRRELEVANT)
+                insertAddr(uses, typ, t.dyn->arg2, is.size);
+            // Now store
+            extract_addrentry(t.dyn2->arg1, typ, flag, off);
+            if (flag != IRRELEVANT)
+                insertAddr(defs, typ, t.dyn2->arg2, is.size);
+            break;
+        case SK_MEMSET:
+            extract_addrentry(t.dyn->arg1, typ, flag, off);
+            if (flag != IRRELEVANT)
+                insertAddr(defs, typ, t.dyn->arg2, is.size);
+            break;
+        case SK_HELPER:
+            uses.push_back(std::make_pair(FRET, ret_ctr));
+            break;
+        case SK_RET:
+            defs.push_back(std::make_pair(FRET, ret_ctr++));
+            break;
+        case SK_PHI:
+            // the incoming value we worked out during trace alignment
+            insertValue(uses, t.phi_val);
+            break;
+        case SK_SELECT:
+            // These are negated in the dynamic log from what you'd expect
+            insertValue(uses, t.dyn->arg1 == 1 ? is.false_val : is.true_val);
+            break;
     }
-    return;
+
+    uses.insert(uses.end(), is.uses.begin(), is.uses.end());
+    defs.insert(defs.end(), is.defs.begin(), is.defs.end());
 }
 
 std::map<std::pair<Function*,int>,std::bitset<MAX_BITSET>> marked;
@@ -573,12 +690,13 @@ void bits2bytes(std::bitset<MAX_BITSET> &bs, uint8_t out[]) {
 }
 
 void mark(trace_entry &t) {
-    int bb_num = t.index >> 16;
-    int insn_index = t.index & 0xffff;
+    int bb_num = t.is->index >> 16;
+    int insn_index = t.is->index & 0xffff;
     assert (insn_index < MAX_BITSET);
-    marked[std::make_pair(t.func,bb_num)][insn_index] = true;
+    if (!t.bs->marks) t.bs->marks = &marked[std::make_pair(t.fs->func,bb_num)];
+    (*t.bs->marks)[insn_index] = true;
     if (debug)
-        printf("Marking %s, block %d, instruction %d.\n", t.func->getName().str().c_str(), bb_num, insn_index);
+        printf("Marking %s, block %d, instruction %d.\n", t.fs->func->getName().str().c_str(), bb_num, insn_index);
 }
 
 void print_insn(Instruction *insn) {
@@ -590,27 +708,15 @@ void print_insn(Instruction *insn) {
     return;
 }
 
-bool is_ignored(Function *f) {
-    StringRef func_name = f->getName();
-    if (func_name.startswith("__ld") ||
-        func_name.startswith("__st") ||
-        func_name.startswith("llvm.memcpy") || 
-        func_name.startswith("llvm.memset") ||
-        func_name.equals("helper_inb") ||
-        func_name.equals("helper_inw") ||
-        func_name.equals("helper_inl") ||
-        func_name.equals("helper_outb") ||
-        func_name.equals("helper_outw") ||
-        func_name.equals("helper_outl") ||
-        func_name.equals("log_dynval"))
-        return true;
-    else
-        return false;
+void print_set(std::vector<SliceVar> &s) {
+    printf("{");
+    for (const SliceVar &w : s) printf(" %s", SliceVarStr(w).c_str());
+    printf(" }\n");
 }
 
-void print_set(std::set<SliceVar> &s) {
+void print_set(WorkSet &s) {
     printf("{");
-    for (const SliceVar &w : s) printf(" %s", SliceVarStr(w).c_str());
+    s.for_each([](const SliceVar &w, uint8_t) { printf(" %s", SliceVarStr(w).c_str()); });
     printf(" }\n");
 }
 
@@ -619,24 +725,25 @@ void print_set(std::set<SliceVar> &s) {
 // the defs and add in the uses.
 // Note that this *modifies* the working set 'work' and
 // updates the global map of LLVM functions => bitsets
-void slice_trace(std::vector<trace_entry> &trace,
-        std::set<SliceVar> &work) {
-    Function *entry_func = trace[0].func;
+void slice_trace(std::vector<trace_entry> &trace, WorkSet &work) {
+    Function *entry_func = trace[0].fs->func;
 
     // Keeps track of argument->value binding when we descend into
     // functions
-    std::stack<std::map<SliceVar,SliceVar>> argmap_stack;
+    std::vector<const ArgMap *> argmap_stack;
+
+    // Reused across instructions so they keep their capacity
+    static std::vector<SliceVar> uses, defs;
 
     for(std::vector<trace_entry>::reverse_iterator it = trace.rbegin();
             it != trace.rend(); it++) {
+        const InsnSummary &is = *it->is;
 
-        // Skip helper functions for now
-        // if (it->func != entry_func) continue;
-
-        if (debug) printf(">> %s\n", it->insn->getOpcodeName());
-        if (debug) print_insn(it->insn);
+        if (debug) printf(">> %s\n", is.insn->getOpcodeName());
+        if (debug) print_insn(is.insn);
 
-        std::set<SliceVar> uses, defs;
+        uses.clear();
+        defs.clear();
         get_uses_and_defs(*it, uses, defs);
 
         if (debug) printf("DEBUG: %lu defs, %lu uses\n", defs.size(), uses.size());
@@ -645,30 +752,28 @@ void slice_trace(std::vector<trace_entry> &trace,
         if (debug) printf("USES: ");
         if (debug) print_set(uses);
 
-        if (it->func != entry_func) {
+        if (it->fs->func != entry_func && !argmap_stack.empty()) {
             // If we're not at top level (i.e. we're in a helper function)
             // we need to map the uses through the current argument map. We
             // don't need to do this with the defs because you can't define
             // a function argument inside the function.
-            for (auto it = uses.begin(); it != uses.end(); ) {
-                std::map<SliceVar,SliceVar> &argmap = argmap_stack.top();
-                auto arg_it = argmap.find(*it);
-                if (arg_it != argmap.end()) {
-                    uses.erase(it++);
-                    uses.insert(arg_it->second);
-                }
-                else {
-                    ++it;
+            const ArgMap &argmap = *argmap_stack.back();
+            for (auto &u : uses) {
+                for (auto &binding : argmap) {
+                    if (binding.first == u) {
+                        u = binding.second;
+                        break;
+                    }
                 }
             }
 
             if (debug) printf("USES (remapped): ");
             if (debug) print_set(uses);
         }
-        
+
         bool has_overlap = false;
         for (auto &s : defs) {
-            if (work.find(s) != work.end()) {
+            if (work.contains(s)) {
                 has_overlap = true;
                 break;
             }
@@ -682,38 +787,27 @@ void slice_trace(std::vector<trace_entry> &trace,
 
             // Update the working set
             for (auto &d : defs) work.erase(d);
-            work.insert(uses.begin(), uses.end());
-
+            for (auto &u : uses) work.insert(u, 1);
         }
-        else if (it->insn->isTerminator() && !isa<ReturnInst>(it->insn) && include_branches) {
+        else if (is.is_branch && include_branches) {
             // Special case: branch/switch
             if (debug) printf("Current instruction is a branch, adding it.\n");
             mark(*it);
-            work.insert(uses.begin(), uses.end());
+            for (auto &u : uses) work.insert(u, 1);
         }
 
-        // Special handling for function calls. We need to bind arguments to values
-        if (CallInst *c = dyn_cast<CallInst>(it->insn)) {
-            std::map<SliceVar,SliceVar> argmap;
-            Function *subf = c->getCalledFunction();
-
-            if (!is_ignored(subf)) {
-                // Iterate over pairs of arguments & values
-                Function::arg_iterator argIter;
-                int p;
-                for (argIter = subf->arg_begin(), p = 0;
-                     argIter != subf->arg_end() && p < c->getNumArgOperands();
-                     argIter++, p++) {
-                    argmap[get_value_name(&*argIter)] = get_value_name(c->getArgOperand(p));
-                    if (debug) printf("ArgMap %s => %s\n", SliceVarStr(get_value_name(&*argIter)).c_str(), SliceVarStr(get_value_name(c->getArgOperand(p))).c_str());
-                }
-                argmap_stack.push(argmap);
+        // If we just processed the first instruction in the function,
+        // we must be about to exit the function, so pop the stack
+        if (is.is_func_entry && !argmap_stack.empty()) argmap_stack.pop_back();
+
+        // Calls come after the callee's instructions in the trace, so
+        // walking backward this is where we enter the callee
+        if (is.dyn == DYN_DESCEND) {
+            if (debug) {
+                for (auto &binding : is.argmap)
+                    printf("ArgMap %s => %s\n", SliceVarStr(binding.first).c_str(), SliceVarStr(binding.second).c_str());
             }
-        }
-        else if (&*(it->func->getEntryBlock().begin()) == &*(it->insn)) {
-            // If we just processed the first instruction in the function,
-            // we must be about to exit the function, so pop the stack
-            if(!argmap_stack.empty()) argmap_stack.pop();
+            argmap_stack.push_back(&is.argmap);
         }
 
         if (debug) printf("Working set: ");
@@ -725,35 +819,21 @@ void slice_trace(std::vector<trace_entry> &trace,
     work.erase(get_value_name(&*entry_func->arg_begin()));
 }
 
-// Find the index of a block in a function
-int getBlockIndex(Function *f, BasicBlock *b) {
-    int i = 0;
-    for (Function::iterator it = f->begin(), ed = f->end(); it != ed; ++it) {
-        if (&*it == b) return i;
-        i++;
-    }
-    return -1;
-}
-
 // Ugly to use a global here. But at an exception we have to return out of
 // an unknown number of levels of recursion.
 bool in_exception = false;
 
-TUBTEntry * process_func(Function *f, TUBTEntry *dynvals, std::vector<trace_entry> &serialized) {
+TUBTEntry * process_func(FuncSummary *fs, TUBTEntry *dynvals, std::vector<trace_entry> &serialized) {
     TUBTEntry *cursor = dynvals;
-    BasicBlock &entry = f->getEntryBlock();
-    BasicBlock *block = &entry;
+    int block = 0;  // entry block
+    int pred = -1;
     bool have_successor = true;
     while (have_successor) {
         have_successor = false;
-        
-        int bb_index = getBlockIndex(f, block);
-        int insn_index = 0;
-        for (BasicBlock::iterator i = block->begin(), e = block->end(); i != e; ++i) {
-            trace_entry t = {};
-            t.index = insn_index | (bb_index << 16);
-            insn_index++;
 
+        BlockSummary &bs = fs->blocks[block];
+        int next = -1;
+        for (const InsnSummary &is : bs.insns) {
             // Bail out if we're we're in an exception
             if (in_exception) return cursor;
 
@@ -767,163 +847,117 @@ TUBTEntry * process_func(Function *f, TUBTEntry *dynvals, std::vector<trace_entr
                 return cursor;
             }
 
-            if (debug) print_insn(&*i);
+            if (debug) print_insn(is.insn);
 
-            switch (i->getOpcode()) {
-                case Instruction::Load: {
+            trace_entry t = {};
+            t.fs = fs; t.bs = &bs; t.is = &is;
+
+            switch (is.dyn) {
+                case DYN_SKIP:
+                    continue;
+                case DYN_NONE:
+                    break;
+                case DYN_LOAD:
                     assert(cursor->type == TUBTFE_LLVM_DV_LOAD);
                     if (debug) dump_tubt(cursor);
-                    t.func = f; t.insn = i; t.dyn = cursor;
-                    serialized.push_back(t);
-                    cursor++;
+                    t.dyn = cursor++;
                     break;
-                }
-                case Instruction::Store: {
-                    StoreInst *s = cast<StoreInst>(&*i);
-                    if (!s->isVolatile()) {
-                        assert(cursor->type == TUBTFE_LLVM_DV_STORE);
-                        if (debug) dump_tubt(cursor);
-                        t.func = f; t.insn = i; t.dyn = cursor;
-                        serialized.push_back(t);
-                        cursor++;
-                    }
+                case DYN_STORE:
+                    assert(cursor->type == TUBTFE_LLVM_DV_STORE);
+                    if (debug) dump_tubt(cursor);
+                    t.dyn = cursor++;
                     break;
-                }
-                case Instruction::Br: {
+                case DYN_MEMCPY:
+                    assert(cursor->type == TUBTFE_LLVM_DV_LOAD);
+                    if (debug) dump_tubt(cursor);
+                    t.dyn = cursor++;
+                    assert(cursor->type == TUBTFE_LLVM_DV_STORE);
+                    if (debug) dump_tubt(cursor);
+                    t.dyn2 = cursor++;
+                    break;
+                case DYN_SELECT:
+                    assert(cursor->type == TUBTFE_LLVM_DV_SELECT);
+                    if (debug) dump_tubt(cursor);
+                    t.dyn = cursor++;
+                    break;
+                case DYN_BRANCH:
                     assert(cursor->type == TUBTFE_LLVM_DV_BRANCH);
-                    BranchInst *b = cast<BranchInst>(&*i);
-                    block = b->getSuccessor(cursor->arg1);
                     if (debug) dump_tubt(cursor);
-                    t.func = f; t.insn = i; t.dyn = cursor;
-                    serialized.push_back(t);
-                    cursor++;
-                    have_successor = true;
+                    next = is.succ[cursor->arg1];
+                    t.dyn = cursor++;
                     break;
-                }
-                case Instruction::Switch: {
+                case DYN_SWITCH: {
                     assert(cursor->type == TUBTFE_LLVM_DV_SWITCH);
-                    SwitchInst *s = cast<SwitchInst>(&*i);
+                    SwitchInst *s = cast<SwitchInst>(is.insn);
                     unsigned width = s->getCondition()->getType()->getPrimitiveSizeInBits();
                     IntegerType *intType = IntegerType::get(getGlobalContext(), width);
                     ConstantInt *caseVal = ConstantInt::get(intType, cursor->arg1);
                     SwitchInst::CaseIt caseIndex = s->findCaseValue(caseVal);
-                    block = s->getSuccessor(caseIndex.getSuccessorIndex());
-                    if (debug) dump_tubt(cursor);
-                    t.func = f; t.insn = i; t.dyn = cursor;
-                    serialized.push_back(t);
-                    cursor++;
-                    have_successor = true;
-                    break;
-                }
-                case Instruction::PHI: {
-                    // We don't actually have a dynamic log entry here, but for
-                    // convenience we do want to know which basic block we just
-                    // came from. So we peek at the previous non-PHI thing in
-                    // our trace, which should be the predecessor basic block
-                    // to this PHI
-                    PHINode *p = cast<PHINode>(&*i);
-                    TUBTEntry *new_dyn = new TUBTEntry;
-                    new_dyn->arg1 = -1; // sentinel
-                    // Find the last non-PHI instruction
-                    for (auto sit = serialized.rbegin(); sit != serialized.rend(); sit++) {
-                        if (sit->insn->getOpcode() != Instruction::PHI) {
-                            new_dyn->arg1 = p->getBasicBlockIndex(sit->insn->getParent());
-                            break;
-                        }
-                    }
-                    assert(new_dyn->arg1 != (uint64_t) -1);
-                    t.func = f; t.insn = i; t.dyn = new_dyn;
-                    serialized.push_back(t);
-                    break;
-                }
-                case Instruction::Select: {
-                    assert(cursor->type == TUBTFE_LLVM_DV_SELECT);
+                    next = fs->block_index[s->getSuccessor(caseIndex.getSuccessorIndex())];
                     if (debug) dump_tubt(cursor);
-                    t.func = f; t.insn = i; t.dyn = cursor;
-                    serialized.push_back(t);
-                    cursor++;
+                    t.dyn = cursor++;
                     break;
                 }
-                case Instruction::Call: {
-                    CallInst *c =  cast<CallInst>(&*i);
-                    Function *subf = c->getCalledFunction();
-                    assert(subf != NULL);
-                    StringRef func_name = subf->getName();
-                    if (func_name.startswith("__ld")) {
-                        assert(cursor->type == TUBTFE_LLVM_DV_LOAD);
-                        if (debug) dump_tubt(cursor);
-                        t.func = f; t.insn = i; t.dyn = cursor;
-                        serialized.push_back(t);
-                        cursor++;
-                    }
-                    else if (func_name.startswith("__st")) {
-                        assert(cursor->type == TUBTFE_LLVM_DV_STORE);
-                        if (debug) dump_tubt(cursor);
-                        t.func = f; t.insn = i; t.dyn = cursor;
-                        serialized.push_back(t);
-                        cursor++;
-                    }
-                    else if (func_name.startswith("llvm.memcpy")) {
-                        assert(cursor->type == TUBTFE_LLVM_DV_LOAD);
-                        if (debug) dump_tubt(cursor);
-                        t.func = f; t.insn = i; t.dyn = cursor;
-                        cursor++;
-                        assert(cursor->type == TUBTFE_LLVM_DV_STORE);
-                        if (debug) dump_tubt(cursor);
-                        t.dyn2 = cursor;
-                        serialized.push_back(t);
-                        cursor++;
-                    }
-                    else if (func_name.startswith("llvm.memset")) {
-                        assert(cursor->type == TUBTFE_LLVM_DV_STORE);
-                        if (debug) dump_tubt(cursor);
-                        t.func = f; t.insn = i; t.dyn = cursor;
-                        serialized.push_back(t);
-                        cursor++;
-                    }
-                    else if (func_name.equals("helper_inb") ||
-                             func_name.equals("helper_inw") ||
-                             func_name.equals("helper_inl")) {
-                        assert(cursor->type == TUBTFE_LLVM_DV_LOAD);
-                        if (debug) dump_tubt(cursor);
-                        t.func = f; t.insn = i; t.dyn = cursor;
-                        serialized.push_back(t);
-                        cursor++;
-                    }
-                    else if (func_name.equals("helper_outb") ||
-                             func_name.equals("helper_outw") ||
-                             func_name.equals("helper_outl")) {
-                        assert(cursor->type == TUBTFE_LLVM_DV_STORE);
-                        if (debug) dump_tubt(cursor);
-                        t.func = f; t.insn = i; t.dyn = cursor;
-                        serialized.push_back(t);
-                        cursor++;
-                    }
-                    else if (func_name.equals("log_dynval") ||
-                             subf->isDeclaration() ||
-                             subf->isIntrinsic()) {
-                        // ignore
-                    }
-                    else {
-                        // descend
-                        cursor = process_func(subf, cursor, serialized);
-                        // Put the call in *after* the instructions so we
-                        // can decide if we need the return value
-                        t.func = f; t.insn = i; t.dyn = NULL;
-                        serialized.push_back(t);
-                    }
+                case DYN_PHI: {
+                    // We don't actually have a dynamic log entry here, but
+                    // the block we just came from tells us which incoming
+                    // value was used
+                    PHINode *p = cast<PHINode>(is.insn);
+                    assert(pred >= 0);
+                    int incoming = p->getBasicBlockIndex(fs->blocks[pred].bb);
+                    assert(incoming >= 0);
+                    t.phi_val = p->getIncomingValue(incoming);
                     break;
                 }
-                default:
-                    t.func = f; t.insn = i; t.dyn = NULL;
-                    serialized.push_back(t);
+                case DYN_DESCEND:
+                    // descend
+                    cursor = process_func(get_summary(is.callee), cursor, serialized);
+                    // Put the call in *after* the instructions so we
+                    // can decide if we need the return value
                     break;
             }
+            serialized.push_back(t);
+        }
+
+        if (next >= 0) {
+            pred = block;
+            block = next;
+            have_successor = true;
         }
     }
     return cursor;
 }
 
+// Returns the TUBTFE_LLVM_FN row that starts the block ending at end, or
+// NULL if there is none before it.
+static TUBTEntry *prev_block(TUBTEntry *rows, TUBTEntry *end) {
+    TUBTEntry *p = end;
+    while (p != rows) {
+        --p;
+        if (p->type == TUBTFE_LLVM_FN) return p;
+    }
+    return NULL;
+}
+
+// Walking the log backward defeats the kernel's readahead, and left alone
+// every page we've touched stays resident. So we prefetch the window below
+// the cursor ourselves and drop the ones above it that we're done with.
+#define LOG_WINDOW ((uint64_t)64 << 20)
+
+static void advise_window(uint8_t *mapping, uint64_t len, uint64_t pos, uint64_t &cur_window) {
+    uint64_t w = pos / LOG_WINDOW;
+    if (w == cur_window) return;
+
+    uint64_t done = (w + 1) * LOG_WINDOW;
+    uint64_t done_end = (cur_window == (uint64_t)-1) ? len : std::min(len, (cur_window + 1) * LOG_WINDOW);
+    if (done < done_end) madvise(mapping + done, done_end - done, MADV_DONTNEED);
+
+    uint64_t want = (w > 0) ? (w - 1) * LOG_WINDOW : 0;
+    madvise(mapping + want, std::min(len, done) - want, MADV_WILLNEED);
+
+    cur_window = w;
+}
+
 static inline void update_progress(uint64_t cur, uint64_t total) {
     double pct = cur / (double)total;
     const int columns = 80;
@@ -947,6 +981,7 @@ void usage(char *prog) {
            "  -v                : show progress meter\n"
            "  -a                : just align, don't slice\n"
            "  -w                : print working set after each block\n"
+           "  -r                : <dynlog> was already reversed with logreverse_mmap\n"
            "  -n NUM -p PC      : skip ahead to TB NUM-PC\n"
            "  -o OUTPUT         : save results to OUTPUT\n"
            "  <llvm_mod>        : the LLVM bitcode module\n"
@@ -965,8 +1000,9 @@ int main(int argc, char **argv) {
     bool have_num = false, have_pc = false;
     bool print_work = false;
     bool align_only = false;
+    bool reversed = false;
     const char *output = NULL;
-    while ((opt = getopt(argc, argv, "vawbdn:p:o:")) != -1) {
+    while ((opt = getopt(argc, argv, "vawbdrn:p:o:")) != -1) {
         switch (opt) {
         case 'n':
             num = strtoul(optarg, NULL, 10);
@@ -988,6 +1024,9 @@ int main(int argc, char **argv) {
         case 'a':
             align_only = true;
             break;
+        case 'r':
+            reversed = true;
+            break;
         case 'o':
             output = optarg;
             break;
@@ -1026,9 +1065,9 @@ int main(int argc, char **argv) {
     char *tubt_log_fname = argv[optind+1];
 
     // Add the slicing criteria
-    std::set<SliceVar> work;
+    WorkSet work;
     for (int i = optind + 2; i < argc; i++) {
-        work.insert(VarFromStr(argv[i]));
+        work.insert(VarFromStr(argv[i]), 1);
     }
 
     struct stat st;
@@ -1037,13 +1076,16 @@ int main(int argc, char **argv) {
         exit(EXIT_FAILURE);
     }
 
+    // The log is only ever read, so map it read-only and private; nothing
+    // gets written back and the kernel can drop pages whenever it likes.
     uint64_t num_rows = (st.st_size - 20) / sizeof(TUBTEntry);
-    int fd = open(tubt_log_fname, O_RDWR|O_LARGEFILE);
-    uint8_t *mapping = (uint8_t *)mmap(NULL, st.st_size, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+    int fd = open(tubt_log_fname, O_RDONLY|O_LARGEFILE);
+    uint8_t *mapping = (uint8_t *)mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
     if (mapping == MAP_FAILED) {
         perror("mmap");
         return 1;
     }
+    madvise(mapping, st.st_size, reversed ? MADV_SEQUENTIAL : MADV_RANDOM);
 
     TUBTEntry *rows = (TUBTEntry *)(mapping + 20);
     TUBTEntry *endp = rows + num_rows;
@@ -1055,31 +1097,60 @@ int main(int argc, char **argv) {
 
     Module *mod = ParseIRFile(llvm_mod_fname, err, ctx);
 
-    TUBTEntry *cursor = rows;
+    // In a reversed log, cursor is the start of the next block to slice.
+    // Otherwise we walk from the end of the log toward the start, and
+    // cursor is the end of the next block to slice.
+    TUBTEntry *cursor = reversed ? rows : endp;
     if (have_pc) {
-        while (!(cursor->type == TUBTFE_LLVM_FN && cursor->pc == pc && cursor->arg1 == num)) cursor++;
+        if (reversed) {
+            while (!(cursor->type == TUBTFE_LLVM_FN && cursor->pc == pc && cursor->arg1 == num)) cursor++;
+        }
+        else {
+            TUBTEntry *fn;
+            while ((fn = prev_block(rows, cursor)) != NULL &&
+                    !(fn->pc == pc && fn->arg1 == num)) {
+                cursor = fn;
+            }
+            if (fn == NULL) {
+                fprintf(stderr, "ERROR: TB %lu-%lx not found in %s.\n", num, pc, tubt_log_fname);
+                exit(EXIT_FAILURE);
+            }
+        }
     }
 
     uint64_t rows_processed = 0;
+    uint64_t cur_window = (uint64_t)-1;
+
+    // One block's aligned trace at a time, reusing the storage
+    std::vector<trace_entry> aligned_block;
 
     printf("Slicing trace...\n");
-    while (cursor != endp) {
-        assert (cursor->type == TUBTFE_LLVM_FN);
+    while (true) {
+        TUBTEntry *fn_row;
+        if (reversed) {
+            if (cursor == endp) break;
+            fn_row = cursor;
+        }
+        else {
+            fn_row = prev_block(rows, cursor);
+            if (fn_row == NULL) break;
+            advise_window(mapping, st.st_size, (uint8_t *)fn_row - mapping, cur_window);
+        }
+
+        assert (fn_row->type == TUBTFE_LLVM_FN);
         char namebuf[128];
-        sprintf(namebuf, "tcg-llvm-tb-%llu-%llx", cursor->arg1, cursor->pc);
+        sprintf(namebuf, "tcg-llvm-tb-%llu-%llx", fn_row->arg1, fn_row->pc);
         if (debug) printf("********** %s **********\n", namebuf);
         Function *f = mod->getFunction(namebuf);
         assert(f != NULL);
 
-        TUBTEntry *dbgcurs = cursor + 1;
-        if (debug) while (dbgcurs->type != TUBTFE_LLVM_FN) dump_tubt(dbgcurs++);
-
-        cursor++; // Don't include the function entry
+        TUBTEntry *dbgcurs = fn_row + 1;
+        if (debug) while (dbgcurs != endp && dbgcurs->type != TUBTFE_LLVM_FN) dump_tubt(dbgcurs++);
 
         // Get the aligned trace of this block
         in_exception = false; // reset this in case the last function ended with an exception
-        std::vector<trace_entry> aligned_block;
-        cursor = process_func(f, cursor, aligned_block);
+        aligned_block.clear();
+        TUBTEntry *block_end = process_func(get_summary(f), fn_row + 1, aligned_block);
 
         // And slice it
         if (!align_only) slice_trace(aligned_block, work);
@@ -1087,7 +1158,14 @@ int main(int argc, char **argv) {
         if (print_work) printf("Working set: ");
         if (print_work) print_set(work);
 
-        rows_processed = cursor - rows;
+        if (reversed) {
+            cursor = block_end;
+            rows_processed = cursor - rows;
+        }
+        else {
+            cursor = fn_row;
+            rows_processed = endp - cursor;
+        }
         if (show_progress) update_progress(rows_processed, num_rows);
 
         if (work.empty() && !align_only) {
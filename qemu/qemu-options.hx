@@ -2468,11 +2468,13 @@ Show cursor.
 ETEXI
 
 DEF("tb-size", HAS_ARG, QEMU_OPTION_tb_size, \
-    "-tb-size n      set TB size\n", QEMU_ARCH_ALL)
+    "-tb-size n      set translation buffer size to n MB\n", QEMU_ARCH_ALL)
 STEXI
 @item -tb-size @var{n}
 @findex -tb-size
-Set TB size.
+Set the size of the translation buffer to @var{n} MB.  When it fills up all
+translated code is thrown away, so instrumented replays may want it larger;
+the flush counts at the end of a replay show how often that happened.
 ETEXI
 
 DEF("incoming", HAS_ARG, QEMU_OPTION_incoming, \
@@ -2613,6 +2615,29 @@ DEF("replay", HAS_ARG, QEMU_OPTION_replay,
     "-replay <snapshot>\n"
     "                replay the recording that starts at <snapshot>\n", QEMU_ARCH_ALL)
 
+DEF("replay-headless", 0, QEMU_OPTION_replay_headless,
+    "-replay-headless\n"
+    "                with -replay: no display, audio or default monitor;\n"
+    "                quit at the end, with status 0 only if the whole log replayed\n", QEMU_ARCH_ALL)
+
+DEF("rr-state-hash", HAS_ARG, QEMU_OPTION_rr_state_hash,
+    "-rr-state-hash <n>\n"
+    "                when recording, log a hash of the registers and of sampled\n"
+    "                RAM pages every <n> instructions; replay checks them and\n"
+    "                reports the first interval in which it diverged\n", QEMU_ARCH_ALL)
+
+DEF("rr-snp-format", HAS_ARG, QEMU_OPTION_rr_snp_format,
+    "-rr-snp-format stream|mapped|compressed|cas\n"
+    "                RAM encoding of the snapshot taken when recording starts;\n"
+    "                'mapped' writes a sparse <snapshot>.ram that replay mmaps,\n"
+    "                'compressed' a deduplicated, zlib-compressed <snapshot>.ram,\n"
+    "                'cas' page hashes, with pages kept in -rr-page-store\n", QEMU_ARCH_ALL)
+
+DEF("rr-page-store", HAS_ARG, QEMU_OPTION_rr_page_store,
+    "-rr-page-store <dir>\n"
+    "                content-addressed page store shared by recordings; implies\n"
+    "                -rr-snp-format cas, and on replay overrides the saved path\n", QEMU_ARCH_ALL)
+
 DEF("pandalog", HAS_ARG, QEMU_OPTION_pandalog,
     "-pandalog <filename>\n"
     "                enable panda logging to file\n", QEMU_ARCH_ALL)
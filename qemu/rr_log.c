@@ -94,6 +94,15 @@ volatile sig_atomic_t rr_end_replay_requested = 0;
 char * rr_requested_name = NULL;
 char * rr_snapshot_name  = NULL;
 
+int rr_replay_headless = 0;
+int rr_replay_status = 0;
+
+uint64_t rr_state_hash_interval = 0;
+//  record: instruction count at which the next state hash is due
+uint64_t rr_state_hash_next = 0;
+//  replay: instruction count of the last state hash that matched
+static uint64_t rr_state_hash_last_ok = 0;
+
 //
 //mz Other useful things
 //
@@ -120,8 +129,8 @@ uint8_t rr_replay_finished(void) {
 //mz "performance" counters - basically, how much of the log is taken up by
 //mz each kind of entry. 
 #ifdef RR_STATS
-volatile unsigned long long rr_number_of_log_entries[RR_LAST];
-volatile unsigned long long rr_size_of_log_entries[RR_LAST];
+volatile unsigned long long rr_number_of_log_entries[RR_NUM_LOG_ENTRY_KINDS];
+volatile unsigned long long rr_size_of_log_entries[RR_NUM_LOG_ENTRY_KINDS];
 #endif
 volatile unsigned long long rr_max_num_queue_entries;
 
@@ -180,6 +189,9 @@ static void rr_spit_log_entry(RR_log_entry item) {
         case RR_DEBUG:
             printf("\tRR_DEBUG\n");
             break;
+        case RR_STATE_HASH:
+            printf("\tRR_STATE_HASH\n");
+            break;
         default:
             printf("\tUNKNOWN RR log kind %d\n", item.header.kind);
             break;
@@ -338,6 +350,9 @@ static inline void rr_write_item(void) {
                 }
             }
             break;
+        case RR_STATE_HASH:
+            fwrite(&(item->variant.state_hash), sizeof(item->variant.state_hash), 1, rr_nondet_log->fp);
+            break;
         case RR_LAST:
         case RR_DEBUG:
             //mz nothing to write
@@ -597,6 +612,122 @@ static void rr_record_end_of_log(void) {
     rr_write_item();
 }
 
+/******************************************************************************************/
+/* STATE HASH */
+/******************************************************************************************/
+
+// RAM pages hashed per RR_STATE_HASH entry
+#define RR_STATE_HASH_PAGES 16
+
+#define RR_HASH_BASIS 0xcbf29ce484222325ULL
+#define RR_HASH_PRIME 0x100000001b3ULL
+
+// FNV-1a, a word at a time. Every step is invertible, so any single
+// changed word changes the result.
+static inline uint64_t rr_hash_word(uint64_t h, uint64_t w) {
+    return (h ^ w) * RR_HASH_PRIME;
+}
+
+static uint64_t rr_hash_regs(CPUState *env) {
+    uint64_t h = RR_HASH_BASIS;
+    int i;
+#if defined(TARGET_I386)
+    // inside cpu_exec the arithmetic flags are kept lazily in cc_op/cc_src,
+    // which depends on where blocks end; hash the architectural value
+    target_ulong eflags = env->eflags | cpu_cc_compute_all(env, CC_OP)
+        | (DF & DF_MASK);
+    for (i = 0; i < CPU_NB_REGS; i++) {
+        h = rr_hash_word(h, env->regs[i]);
+    }
+    h = rr_hash_word(h, env->eip);
+    h = rr_hash_word(h, eflags);
+    for (i = 0; i < 6; i++) {
+        h = rr_hash_word(h, env->segs[i].selector);
+        h = rr_hash_word(h, env->segs[i].base);
+    }
+    h = rr_hash_word(h, env->cr[0]);
+    h = rr_hash_word(h, env->cr[3]);
+    h = rr_hash_word(h, env->cr[4]);
+#elif defined(TARGET_ARM)
+    for (i = 0; i < 16; i++) {
+        h = rr_hash_word(h, env->regs[i]);
+    }
+    h = rr_hash_word(h, cpsr_read(env));
+#else
+    // no register hash for this target, only RAM is checked
+#endif
+    return h;
+}
+
+// Guest memory is the largest RAM block. The others (video memory,
+// option ROMs) are written by device models and are not part of what
+// replay reproduces.
+static RAMBlock *rr_state_hash_block(void) {
+    RAMBlock *block, *best = NULL;
+    QLIST_FOREACH(block, &ram_list.blocks, next) {
+        if (!best || block->length > best->length) {
+            best = block;
+        }
+    }
+    return best;
+}
+
+// splitmix64 finalizer, to pick pages from the seed
+static inline uint64_t rr_mix64(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+// Hash RR_STATE_HASH_PAGES guest pages chosen by seed. The seed is stored
+// in the entry, so record and replay look at the same pages without
+// depending on dirty bitmaps, which differ between the two.
+static uint64_t rr_hash_ram(uint64_t seed) {
+    RAMBlock *block = rr_state_hash_block();
+    uint64_t h = RR_HASH_BASIS;
+    uint64_t num_pages, page;
+    const uint64_t *p;
+    int i, j;
+
+    if (!block || !block->host) {
+        return h;
+    }
+    num_pages = block->length >> TARGET_PAGE_BITS;
+    for (i = 0; i < RR_STATE_HASH_PAGES && num_pages; i++) {
+        page = rr_mix64(seed + i) % num_pages;
+        p = (const uint64_t *)(block->host + (page << TARGET_PAGE_BITS));
+        h = rr_hash_word(h, page);
+        for (j = 0; j < TARGET_PAGE_SIZE / sizeof(uint64_t); j++) {
+            h = rr_hash_word(h, p[j]);
+        }
+    }
+    return h;
+}
+
+static void rr_record_state_hash(CPUState *env) {
+    RR_log_entry *item = &(rr_nondet_log->current_item);
+    uint64_t count = rr_get_guest_instr_count();
+    //mz just in case
+    memset(item, 0, sizeof(RR_log_entry));
+
+    item->header.kind = RR_STATE_HASH;
+    // not tied to any call site
+    item->header.callsite_loc = RR_CALLSITE_LAST;
+    item->header.prog_point = rr_prog_point();
+
+    item->variant.state_hash.seed = count;
+    item->variant.state_hash.regs = rr_hash_regs(env);
+    item->variant.state_hash.ram = rr_hash_ram(count);
+
+    rr_write_item();
+
+    // blocks don't end on multiples of the interval, so the next hash is
+    // due at the first block boundary past the next multiple
+    rr_state_hash_next = count - count % rr_state_hash_interval
+        + rr_state_hash_interval;
+}
+
 
 
 /******************************************************************************************/
@@ -848,6 +979,13 @@ static RR_log_entry *rr_read_item(void) {
                 }
             }
             break;
+        case RR_STATE_HASH:
+            rr_assert(fread(&(item->variant.state_hash), sizeof(item->variant.state_hash), 1, rr_nondet_log->fp) == 1);
+#ifdef RR_STATS
+            rr_size_of_log_entries[item->header.kind] += sizeof(item->variant.state_hash);
+#endif
+            rr_nondet_log->bytes_read += sizeof(item->variant.state_hash);
+            break;
         case RR_LAST:
         case RR_DEBUG:
             //mz nothing to read
@@ -887,7 +1025,8 @@ static void rr_fill_queue(void) {
         RR_log_entry entry = *log_entry;
         if ((entry.header.kind == RR_SKIPPED_CALL
                     && entry.header.callsite_loc == RR_CALLSITE_MAIN_LOOP_WAIT)
-                || entry.header.kind == RR_INTERRUPT_REQUEST) {
+                || entry.header.kind == RR_INTERRUPT_REQUEST
+                || entry.header.kind == RR_STATE_HASH) {
             break;
         }
 
@@ -1020,6 +1159,73 @@ void rr_replay_debug(RR_callsite_id call_site) {
     }
 }
 
+// Replay stops at the instruction count of each RR_STATE_HASH entry (see
+// rr_num_instr_before_next_interrupt), so the state is compared at the
+// same point it was hashed in record. A mismatch means replay diverged
+// somewhere since the last hash that matched.
+static void rr_replay_state_hash(CPUState *env) {
+    RR_log_entry *current_item = rr_queue_head;
+    RR_state_hash_args *logged = &current_item->variant.state_hash;
+    RR_prog_point log_point = current_item->header.prog_point;
+    uint64_t count = rr_get_guest_instr_count();
+    uint64_t regs = 0, ram = 0;
+
+    if (log_point.guest_instr_count > count) {
+        // not there yet
+        return;
+    }
+    if (log_point.guest_instr_count == count) {
+        regs = rr_hash_regs(env);
+        ram = rr_hash_ram(logged->seed);
+    }
+    if (log_point.guest_instr_count < count
+            || regs != logged->regs || ram != logged->ram) {
+        printf("STATE DIVERGED between instructions %" PRIu64
+               " and %" PRIu64 "\n",
+               rr_state_hash_last_ok, log_point.guest_instr_count);
+        if (log_point.guest_instr_count < count) {
+            printf(">>> replay ran past the state hash\n");
+        }
+        else {
+            if (regs != logged->regs) {
+                printf(">>> guest registers disagree\n");
+            }
+            if (ram != logged->ram) {
+                printf(">>> sampled guest RAM disagrees\n");
+            }
+        }
+        rr_signal_disagreement(rr_prog_point(), log_point);
+        rr_do_end_replay(/*is_error=*/1);
+        return;
+    }
+    rr_state_hash_last_ok = count;
+
+    rr_queue_head = rr_queue_head->next;
+    current_item->next = NULL;
+    if (current_item == rr_queue_tail) {
+        rr_queue_tail = NULL;
+    }
+    add_to_recycle_list(current_item);
+    //mz before we can return, we need to fill the queue with information
+    //up to the next interrupt value!
+    if (rr_queue_head == NULL) {
+        rr_fill_queue();
+    }
+}
+
+void rr_state_hash(CPUState *env) {
+    switch (rr_mode) {
+        case RR_RECORD:
+            rr_record_state_hash(env);
+            break;
+        case RR_REPLAY:
+            rr_replay_state_hash(env);
+            break;
+        default:
+            break;
+    }
+}
+
 //mz replay 1-byte input to the CPU
 void rr_replay_input_1(RR_callsite_id call_site, uint8_t *data) {
     RR_log_entry *current_item = get_next_entry(RR_INPUT_1, call_site, false);
@@ -1577,6 +1783,7 @@ int rr_do_begin_record(const char *file_name_full, void *cpu_state) {
   rr_create_record_log(name_buf);
   // reset record/replay counters and flags
   rr_reset_state(cpu_state);
+  rr_state_hash_next = rr_state_hash_interval;
   g_free(rr_path_base);
   g_free(rr_name_base);
   // set global to turn on recording
@@ -1667,6 +1874,7 @@ int rr_do_begin_replay(const char *file_name_full, void *cpu_state) {
   rr_create_replay_log(name_buf);
   // reset record/replay counters and flags
   rr_reset_state(cpu_state);
+  rr_state_hash_last_ok = 0;
   // set global to turn on replay
   rr_mode = RR_REPLAY;
 
@@ -1695,11 +1903,19 @@ void rr_do_end_replay(int is_error) {
     time_t rr_end_time;
     time(&rr_end_time);
     printf("Time taken was: %ld seconds.\n", rr_end_time - rr_start_time);
+    {
+        TBStats tbs;
+        tb_get_stats(&tbs);
+        printf("Translated %" PRIu64 " blocks in %" PRId64 " ms, "
+               "%d TB flushes (%d with the %lu MB buffer full).\n",
+               tbs.gen_count, tbs.gen_time_ns / 1000000, tbs.flush_count,
+               tbs.flush_full_count, tbs.code_gen_buffer_size >> 20);
+    }
     
 #ifdef RR_STATS
     int i;
     printf ("Stats:\n");
-    for (i = 0; i < RR_LAST; i++) {
+    for (i = 0; i < RR_NUM_LOG_ENTRY_KINDS; i++) {
         printf("%s number = %llu, size = %llu bytes\n", get_log_entry_kind_string(i), 
                 rr_number_of_log_entries[i], rr_size_of_log_entries[i]);
         rr_number_of_log_entries[i] = 0;
@@ -1732,6 +1948,7 @@ void rr_do_end_replay(int is_error) {
         else {
             printf("Replay terminated at user request.\n");
         }
+        rr_replay_status = 1;
     }
     // cleanup the queue
     {
@@ -1761,6 +1978,11 @@ void rr_do_end_replay(int is_error) {
     else {
 #ifdef RR_QUIT_AFTER_REPLAY
         qemu_system_shutdown_request();
+#else
+        // nothing to look at once a headless replay is over
+        if (rr_replay_headless) {
+            qemu_system_shutdown_request();
+        }
 #endif
     }
 #endif // CONFIG_SOFTMMU
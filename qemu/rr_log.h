@@ -81,6 +81,13 @@ typedef struct {
   uint64_t old_buf_addr;
 } RR_skipped_call_args;
 
+// payload of an RR_STATE_HASH entry
+typedef struct {
+    uint64_t seed;      // picks the RAM pages sampled; kept by scissors
+    uint64_t regs;      // hash of the guest registers
+    uint64_t ram;       // hash of the sampled RAM pages
+} RR_state_hash_args;
+
 // an item in a program-point indexed record/replay log
 typedef struct rr_log_entry_t {
     RR_header header;
@@ -100,6 +107,8 @@ typedef struct rr_log_entry_t {
         uint16_t exit_request;
         // if log_entry.kind == RR_SKIPPED_CALL
         RR_skipped_call_args call_args;
+        // if log_entry.kind == RR_STATE_HASH
+        RR_state_hash_args state_hash;
         // if log_entry.kind == RR_LAST
         // no variant fields
     } variant;
@@ -132,10 +141,11 @@ uint64_t replay_get_total_num_instructions(void);
 void panda_end_replay(void);
 
 extern CPUState *first_cpu;
+extern RR_log_entry *rr_queue_head;
 extern RR_log_entry *rr_queue_tail;
 static inline uint64_t rr_get_guest_instr_count(void) {
     assert(first_cpu);
-    return first_cpu->rr_guest_instr_count;
+    return first_cpu->rr_guest_instr_count + first_cpu->rr_insn_idx;
 }
 
 //mz program execution state
@@ -147,13 +157,42 @@ static inline RR_prog_point rr_prog_point(void) {
     ret.pc = env->eip;
     ret.secondary = env->regs[R_ECX];
 #else
-    ret.pc = env->panda_guest_pc;
+    // recovered from rr_cur_tb and rr_insn_idx, see translate-all.c
+    ret.pc = rr_get_guest_pc(env);
     ret.secondary = 0;
 #endif
-    ret.guest_instr_count = env->rr_guest_instr_count;
+    ret.guest_instr_count = env->rr_guest_instr_count + env->rr_insn_idx;
     return ret;
 }
 
+// cheap program point at a block boundary, for progress checks: the pc of
+//the block about to run instead of the pc of the last instruction counted
+static inline RR_prog_point rr_block_prog_point(TranslationBlock *tb) {
+    RR_prog_point ret = {0};
+    CPUState *env = first_cpu;
+
+    ret.pc = tb->pc;
+#ifdef TARGET_I386
+    ret.secondary = env->regs[R_ECX];
+#endif
+    ret.guest_instr_count = env->rr_guest_instr_count + env->rr_insn_idx;
+    return ret;
+}
+
+// Called at block boundaries in cpu_exec: record a state hash if one is
+// due, or check the one at the head of the replay queue.
+void rr_state_hash(CPUState *env);
+
+extern uint64_t rr_state_hash_next;
+static inline uint8_t rr_state_hash_due(void) {
+    if (rr_in_record()) {
+        return rr_state_hash_interval != 0 &&
+            rr_get_guest_instr_count() >= rr_state_hash_next;
+    }
+    return rr_in_replay() && rr_queue_head != NULL &&
+        rr_queue_head->header.kind == RR_STATE_HASH;
+}
+
 static inline uint64_t rr_num_instr_before_next_interrupt(void) {
     if (!rr_queue_tail) {
         return -1;
@@ -166,6 +205,7 @@ static inline uint64_t rr_num_instr_before_next_interrupt(void) {
             } // otherwise fall through
         case RR_LAST:
         case RR_INTERRUPT_REQUEST:
+        case RR_STATE_HASH:
             return last.header.prog_point.guest_instr_count -
                 rr_get_guest_instr_count();
         default:
@@ -52,6 +52,17 @@ extern volatile int rr_end_replay_requested;
 extern char *rr_requested_name;
 extern char *rr_snapshot_name;
 
+// -replay-headless: replay with no display, host audio or default monitor,
+// and quit when the log runs out. rr_replay_status is then the exit status:
+// nonzero unless the whole log was replayed.
+extern int rr_replay_headless;
+extern int rr_replay_status;
+
+// -rr-state-hash <n>: while recording, log a hash of the guest registers
+// and a sample of guest RAM every n instructions (0 = off). Replay checks
+// every hash it finds in the log and stops at the first mismatch.
+extern uint64_t rr_state_hash_interval;
+
 // used from monitor.c 
 int  rr_do_begin_record(const char *name, void *cpu_state);
 void rr_do_end_record(void);
@@ -135,6 +146,7 @@ static inline const char *get_skipped_call_kind_string(RR_skipped_call_kind kind
 // - IO input (1, 2, 4 and 8 bytes)
 // - interrupt request (value is stored only when non-zero)
 // - skipped call (as described above)
+// - state hash (see -rr-state-hash above)
 
 typedef enum {
     RR_INPUT_1,
@@ -145,7 +157,11 @@ typedef enum {
     RR_EXIT_REQUEST,
     RR_SKIPPED_CALL,
     RR_DEBUG,
-    RR_LAST
+    RR_LAST,
+    // kinds added after RR_LAST, so the kinds in existing logs keep their
+    // values
+    RR_STATE_HASH,
+    RR_NUM_LOG_ENTRY_KINDS
 } RR_log_entry_kind;
 
 static const char *log_entry_kind_str[] = {
@@ -157,12 +173,13 @@ static const char *log_entry_kind_str[] = {
     "RR_EXIT_REQUEST",
     "RR_SKIPPED_CALL",
     "RR_DEBUG",
-    "RR_LAST"
+    "RR_LAST",
+    "RR_STATE_HASH"
 };
 
 static inline const char *get_log_entry_kind_string(RR_log_entry_kind kind)
 {
-    if (kind <= RR_LAST)
+    if (kind < RR_NUM_LOG_ENTRY_KINDS)
         return log_entry_kind_str[kind];
     else
         return NULL;
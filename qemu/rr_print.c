@@ -176,6 +176,11 @@ static void rr_spit_log_entry(RR_log_entry item) {
         case RR_DEBUG:
             printf("RR_DEBUG\n");
             break;
+        case RR_STATE_HASH:
+            printf("RR_STATE_HASH regs=%016llx ram=%016llx\n",
+                   (unsigned long long)item.variant.state_hash.regs,
+                   (unsigned long long)item.variant.state_hash.ram);
+            break;
         default:
             printf("UNKNOWN RR log kind %d\n", item.header.kind);
             break;
@@ -317,6 +322,9 @@ static RR_log_entry *rr_read_item(void) {
                 }
             }
             break;
+        case RR_STATE_HASH:
+            assert(fread(&(item->variant.state_hash), sizeof(item->variant.state_hash), 1, rr_nondet_log->fp) == 1);
+            break;
         case RR_LAST:
         case RR_DEBUG:
             //mz nothing to read
@@ -0,0 +1,960 @@
+/* PANDABEGINCOMMENT
+ *
+ * Authors:
+ *  Tim Leek               tleek@ll.mit.edu
+ *  Ryan Whelan            rwhelan@ll.mit.edu
+ *  Joshua Hodosh          josh.hodosh@ll.mit.edu
+ *  Michael Zhivich        mzhivich@ll.mit.edu
+ *  Brendan Dolan-Gavitt   brendandg@gatech.edu
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <zlib.h>
+
+#include "config.h"
+#include "cpu.h"
+#include "hw/hw.h"
+#include "rr_snapshot_ram.h"
+
+/* Sidecar layout for RR_SNP_RAM_MAPPED: each RAM block's bytes, verbatim,
+   starting at a multiple of RR_SNP_RAM_ALIGN.  Pages that are all zero
+   are never written, so they are holes in a sparse file: they take no
+   disk space and read back (or fault in) as zeros without any I/O.  The
+   offsets live in the stream record, not in the sidecar.
+
+   Replay maps each block MAP_PRIVATE|MAP_FIXED over the guest RAM that
+   qemu_vmalloc set up, so loading is a handful of mmap calls however big
+   the guest is; pages are read on first touch and copied on first write,
+   and several replays of the same recording share the page cache. */
+
+// big enough for any host page size we run on
+#define RR_SNP_RAM_ALIGN 65536
+
+RRSnpRamFormat rr_snp_ram_format = RR_SNP_RAM_STREAM;
+
+static char *rr_snp_path;
+static bool rr_snp_is_mapped;
+static char *rr_snp_store;
+
+bool rr_snp_ram_set_format(const char *name) {
+    if (!strcmp(name, "stream")) {
+        rr_snp_ram_format = RR_SNP_RAM_STREAM;
+    } else if (!strcmp(name, "mapped")) {
+        rr_snp_ram_format = RR_SNP_RAM_MAPPED;
+    } else if (!strcmp(name, "compressed")) {
+        rr_snp_ram_format = RR_SNP_RAM_COMPRESSED;
+    } else if (!strcmp(name, "cas")) {
+        rr_snp_ram_format = RR_SNP_RAM_CAS;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+void rr_snp_ram_set_store(const char *dir) {
+    g_free(rr_snp_store);
+    rr_snp_store = g_strdup(dir);
+    rr_snp_ram_format = RR_SNP_RAM_CAS;
+}
+
+void rr_snp_ram_begin(const char *snapshot_path) {
+    g_free(rr_snp_path);
+    rr_snp_path = g_strdup(snapshot_path);
+}
+
+void rr_snp_ram_end(void) {
+    g_free(rr_snp_path);
+    rr_snp_path = NULL;
+}
+
+bool rr_snp_ram_save_active(void) {
+    return rr_snp_path != NULL && rr_snp_ram_format != RR_SNP_RAM_STREAM;
+}
+
+bool rr_snp_ram_mapped(void) {
+    return rr_snp_is_mapped;
+}
+
+static char *sidecar_path(void) {
+    return g_strdup_printf("%s.ram", rr_snp_path);
+}
+
+static inline ram_addr_t align_up(ram_addr_t x) {
+    return (x + RR_SNP_RAM_ALIGN - 1) & ~(ram_addr_t)(RR_SNP_RAM_ALIGN - 1);
+}
+
+static bool page_is_zero(const uint8_t *p) {
+    const uint64_t *w = (const uint64_t *)p;
+    int i;
+    for (i = 0; i < TARGET_PAGE_SIZE / 8; i += 4) {
+        if (w[i] | w[i + 1] | w[i + 2] | w[i + 3]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool pwrite_all(int fd, const uint8_t *buf, size_t len, off_t off) {
+    while (len > 0) {
+        ssize_t n = pwrite(fd, buf, len, off);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        buf += n;
+        len -= n;
+        off += n;
+    }
+    return true;
+}
+
+static bool pread_all(int fd, uint8_t *buf, size_t len, off_t off) {
+    while (len > 0) {
+        ssize_t n = pread(fd, buf, len, off);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        if (n == 0) {
+            // past the end of a sparse file: the rest is zeros
+            memset(buf, 0, len);
+            return true;
+        }
+        buf += n;
+        len -= n;
+        off += n;
+    }
+    return true;
+}
+
+// Write the non-zero runs of one block, leaving holes for zero pages.
+static bool write_block_sparse(int fd, RAMBlock *block, off_t base) {
+    ram_addr_t off = 0, run = 0;
+    bool in_run = false;
+
+    for (off = 0; off < block->length; off += TARGET_PAGE_SIZE) {
+        bool zero = page_is_zero(block->host + off);
+        if (!zero && !in_run) {
+            run = off;
+            in_run = true;
+        } else if (zero && in_run) {
+            if (!pwrite_all(fd, block->host + run, off - run, base + run)) {
+                return false;
+            }
+            in_run = false;
+        }
+    }
+    if (in_run) {
+        return pwrite_all(fd, block->host + run, block->length - run, base + run);
+    }
+    return true;
+}
+
+static void put_block_id(QEMUFile *f, RAMBlock *block) {
+    qemu_put_byte(f, strlen(block->idstr));
+    qemu_put_buffer(f, (uint8_t *)block->idstr, strlen(block->idstr));
+}
+
+static RAMBlock *get_block_id(QEMUFile *f) {
+    RAMBlock *block;
+    char id[256];
+    uint8_t len;
+
+    len = qemu_get_byte(f);
+    qemu_get_buffer(f, (uint8_t *)id, len);
+    id[len] = 0;
+
+    QLIST_FOREACH(block, &ram_list.blocks, next) {
+        if (!strncmp(id, block->idstr, sizeof(id))) {
+            return block;
+        }
+    }
+    fprintf(stderr, "rr snapshot: unknown RAM block %s\n", id);
+    return NULL;
+}
+
+static int save_mapped(QEMUFile *f, int fd) {
+    RAMBlock *block;
+    ram_addr_t file_off = 0;
+    int nblocks = 0;
+
+    QLIST_FOREACH(block, &ram_list.blocks, next) {
+        nblocks++;
+    }
+    qemu_put_be32(f, nblocks);
+
+    QLIST_FOREACH(block, &ram_list.blocks, next) {
+        if (!write_block_sparse(fd, block, file_off)) {
+            return -errno;
+        }
+        put_block_id(f, block);
+        qemu_put_be64(f, block->length);
+        qemu_put_be64(f, file_off);
+        file_off = align_up(file_off + block->length);
+    }
+    // trailing zero pages must still be inside the file
+    if (ftruncate(fd, file_off) != 0) {
+        return -errno;
+    }
+    return 0;
+}
+
+static int load_mapped(QEMUFile *f, int fd) {
+    long host_page = getpagesize();
+    int nblocks = qemu_get_be32(f);
+
+    while (nblocks-- > 0) {
+        RAMBlock *block = get_block_id(f);
+        ram_addr_t length = qemu_get_be64(f);
+        uint64_t file_off = qemu_get_be64(f);
+
+        if (!block) {
+            return -EINVAL;
+        }
+        if (block->length != length) {
+            fprintf(stderr, "rr snapshot: RAM block %s is %ld bytes, snapshot has %ld\n",
+                    block->idstr, (long)block->length, (long)length);
+            return -EINVAL;
+        }
+
+        if ((uintptr_t)block->host % host_page == 0 &&
+                file_off % host_page == 0 && length % host_page == 0) {
+            void *m = mmap(block->host, length, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_FIXED, fd, file_off);
+            if (m == block->host) {
+                rr_snp_is_mapped = true;
+                continue;
+            }
+        }
+        // can't map it in place; fall back to reading it
+        if (!pread_all(fd, block->host, length, file_off)) {
+            return -errno;
+        }
+    }
+    return 0;
+}
+
+/* Sidecar layout for RR_SNP_RAM_COMPRESSED: RAM is cut into chunks of up
+   to RR_SNP_CHUNK_PAGES pages (never straddling two blocks), and each chunk
+   is one zlib stream holding a descriptor per page followed by the bytes
+   of its PAGE_DATA pages.  The stream record lists the blocks in order and
+   the offset and compressed size of every chunk.
+
+   A page is PAGE_FILL if it is one byte repeated (is_dup_page in the
+   migration code), PAGE_REF if it is identical to an earlier page, which
+   is then named by its index in the whole of RAM, and PAGE_DATA otherwise.
+   Duplicates are found with a 64-bit hash and confirmed with memcmp, so a
+   hash collision only costs a missed dedup.
+
+   Hashing, compression and decompression are spread over a few threads;
+   the dedup pass and the file writes stay sequential.  REF pages are copied
+   after every chunk has been decompressed, since the page they name may
+   be in a chunk another thread is still working on. */
+
+#define RR_SNP_CHUNK_PAGES 256
+#define RR_SNP_MAX_THREADS 16
+// chunks compressed per batch, per thread, to bound memory use on save
+#define RR_SNP_BATCH_PER_THREAD 8
+
+enum { PAGE_DATA, PAGE_FILL, PAGE_REF };
+
+#define DESC(type, arg) ((uint64_t)(type) | ((uint64_t)(arg) << 8))
+#define DESC_TYPE(d) ((d) & 0xff)
+#define DESC_ARG(d) ((d) >> 8)
+
+typedef struct {
+    RAMBlock *block;
+    ram_addr_t offset;      // of the first page, within block
+    uint32_t npages;
+    uint64_t first_page;    // index of the first page in the whole of RAM
+    uint64_t file_off;
+    uint32_t csize;
+    uint8_t *cbuf;          // compressed chunk, on save
+} SnpChunk;
+
+typedef struct {
+    SnpChunk *chunks;
+    uint64_t nchunks;
+    uint64_t npages;
+    uint64_t *desc;         // per page
+    uint64_t *hash;         // per page, save only
+    volatile gint next;     // next chunk for a worker to claim
+    uint64_t end;           // one past the last chunk of this batch
+    volatile gint failed;
+} SnpRam;
+
+static inline uint8_t *chunk_page(SnpChunk *c, uint32_t i) {
+    return c->block->host + c->offset + (ram_addr_t)i * TARGET_PAGE_SIZE;
+}
+
+// Append the chunks of one block.
+static void layout_block(SnpRam *r, RAMBlock *block) {
+    uint64_t pages = block->length / TARGET_PAGE_SIZE;
+    uint64_t p;
+
+    for (p = 0; p < pages; p += RR_SNP_CHUNK_PAGES) {
+        SnpChunk *c;
+        r->chunks = g_renew(SnpChunk, r->chunks, r->nchunks + 1);
+        c = &r->chunks[r->nchunks++];
+        memset(c, 0, sizeof(*c));
+        c->block = block;
+        c->offset = p * TARGET_PAGE_SIZE;
+        c->npages = MIN(RR_SNP_CHUNK_PAGES, pages - p);
+        c->first_page = r->npages + p;
+    }
+    r->npages += pages;
+}
+
+static int snp_threads(void) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    if (n < 1) return 1;
+    return n > RR_SNP_MAX_THREADS ? RR_SNP_MAX_THREADS : n;
+}
+
+typedef struct {
+    SnpRam *r;
+    void (*fn)(SnpRam *r, SnpChunk *c);
+} SnpWork;
+
+static void *snp_worker(void *opaque) {
+    SnpWork *w = opaque;
+    SnpRam *r = w->r;
+    for (;;) {
+        uint64_t i = (uint64_t)g_atomic_int_exchange_and_add(&r->next, 1);
+        if (i >= r->end) break;
+        w->fn(r, &r->chunks[i]);
+    }
+    return NULL;
+}
+
+// Run fn on chunks [start, end) on up to snp_threads() threads. Like
+// qemu_thread_create, the workers run with all signals blocked.
+static void run_chunks(SnpRam *r, uint64_t start, uint64_t end,
+                       void (*fn)(SnpRam *r, SnpChunk *c)) {
+    pthread_t threads[RR_SNP_MAX_THREADS];
+    sigset_t all, old;
+    SnpWork w = { r, fn };
+    int n = snp_threads(), started = 0, i;
+
+    r->next = start;
+    r->end = end;
+    if (end - start < (uint64_t)n) n = end - start;
+
+    sigfillset(&all);
+    pthread_sigmask(SIG_SETMASK, &all, &old);
+    for (i = 0; i < n; i++) {
+        if (pthread_create(&threads[started], NULL, snp_worker, &w) == 0) {
+            started++;
+        }
+    }
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+
+    // whatever the threads did not get to (or all of it, if none started)
+    snp_worker(&w);
+    for (i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+}
+
+static uint64_t hash_page(const uint8_t *p) {
+    const uint64_t *w = (const uint64_t *)p;
+    uint64_t h = 0x9e3779b97f4a7c15ULL;
+    int i;
+    for (i = 0; i < TARGET_PAGE_SIZE / 8; i++) {
+        h = (h ^ w[i]) * 0xff51afd7ed558ccdULL;
+        h ^= h >> 29;
+    }
+    return h;
+}
+
+static bool page_is_fill(const uint8_t *p) {
+    const uint64_t *w = (const uint64_t *)p;
+    uint64_t v = w[0];
+    int i;
+    if (v != p[0] * 0x0101010101010101ULL) return false;
+    for (i = 1; i < TARGET_PAGE_SIZE / 8; i++) {
+        if (w[i] != v) return false;
+    }
+    return true;
+}
+
+static void hash_chunk(SnpRam *r, SnpChunk *c) {
+    uint32_t i;
+    for (i = 0; i < c->npages; i++) {
+        uint8_t *p = chunk_page(c, i);
+        uint64_t n = c->first_page + i;
+        if (page_is_fill(p)) {
+            r->desc[n] = DESC(PAGE_FILL, p[0]);
+        } else {
+            r->desc[n] = DESC(PAGE_DATA, 0);
+            r->hash[n] = hash_page(p);
+        }
+    }
+}
+
+static uint8_t *page_by_index(SnpRam *r, uint64_t n) {
+    // chunks are in page order; find the one holding page n
+    uint64_t lo = 0, hi = r->nchunks;
+    while (hi - lo > 1) {
+        uint64_t mid = (lo + hi) / 2;
+        if (r->chunks[mid].first_page <= n) lo = mid; else hi = mid;
+    }
+    return chunk_page(&r->chunks[lo], n - r->chunks[lo].first_page);
+}
+
+// Turn PAGE_DATA pages that repeat an earlier page into PAGE_REF.
+static void dedup_pages(SnpRam *r) {
+    uint64_t cap = 16, mask, n;
+    uint64_t *slots;    // page index + 1, 0 for empty
+
+    while (cap < r->npages * 2) cap <<= 1;
+    mask = cap - 1;
+    slots = g_new0(uint64_t, cap);
+
+    for (n = 0; n < r->npages; n++) {
+        uint64_t i;
+        if (DESC_TYPE(r->desc[n]) != PAGE_DATA) continue;
+        for (i = r->hash[n] & mask; slots[i]; i = (i + 1) & mask) {
+            uint64_t m = slots[i] - 1;
+            if (r->hash[m] == r->hash[n] &&
+                    !memcmp(page_by_index(r, m), page_by_index(r, n),
+                            TARGET_PAGE_SIZE)) {
+                r->desc[n] = DESC(PAGE_REF, m);
+                break;
+            }
+        }
+        if (!slots[i]) slots[i] = n + 1;
+    }
+    g_free(slots);
+}
+
+static void compress_chunk(SnpRam *r, SnpChunk *c) {
+    size_t desc_len = c->npages * sizeof(uint64_t);
+    size_t raw_len = desc_len, len = 0;
+    uint8_t *raw;
+    uLongf clen;
+    uint32_t i;
+
+    for (i = 0; i < c->npages; i++) {
+        if (DESC_TYPE(r->desc[c->first_page + i]) == PAGE_DATA) {
+            raw_len += TARGET_PAGE_SIZE;
+        }
+    }
+    raw = g_malloc(raw_len);
+    for (i = 0; i < c->npages; i++) {
+        stq_le_p(raw + i * sizeof(uint64_t), r->desc[c->first_page + i]);
+    }
+    len = desc_len;
+    for (i = 0; i < c->npages; i++) {
+        if (DESC_TYPE(r->desc[c->first_page + i]) == PAGE_DATA) {
+            memcpy(raw + len, chunk_page(c, i), TARGET_PAGE_SIZE);
+            len += TARGET_PAGE_SIZE;
+        }
+    }
+
+    clen = compressBound(raw_len);
+    c->cbuf = g_malloc(clen);
+    if (compress2(c->cbuf, &clen, raw, raw_len, Z_BEST_SPEED) != Z_OK) {
+        r->failed = 1;
+        clen = 0;
+    }
+    c->csize = clen;
+    g_free(raw);
+}
+
+static void put_block_list(QEMUFile *f) {
+    RAMBlock *block;
+    int nblocks = 0;
+
+    QLIST_FOREACH(block, &ram_list.blocks, next) {
+        nblocks++;
+    }
+    qemu_put_be32(f, nblocks);
+    QLIST_FOREACH(block, &ram_list.blocks, next) {
+        put_block_id(f, block);
+        qemu_put_be64(f, block->length);
+    }
+}
+
+// Read the list written by put_block_list and lay out chunks in that order.
+static int get_block_list(QEMUFile *f, SnpRam *r) {
+    int nblocks = qemu_get_be32(f);
+
+    while (nblocks-- > 0) {
+        RAMBlock *block = get_block_id(f);
+        ram_addr_t length = qemu_get_be64(f);
+        if (!block || block->length != length) {
+            return -EINVAL;
+        }
+        layout_block(r, block);
+    }
+    return 0;
+}
+
+static int save_compressed(QEMUFile *f, int fd) {
+    SnpRam r;
+    RAMBlock *block;
+    uint64_t start, batch, i;
+    off_t file_off = 0;
+    int ret = 0;
+
+    memset(&r, 0, sizeof(r));
+    QLIST_FOREACH(block, &ram_list.blocks, next) {
+        layout_block(&r, block);
+    }
+    r.desc = g_new(uint64_t, r.npages);
+    r.hash = g_new(uint64_t, r.npages);
+
+    run_chunks(&r, 0, r.nchunks, hash_chunk);
+    dedup_pages(&r);
+
+    batch = (uint64_t)snp_threads() * RR_SNP_BATCH_PER_THREAD;
+    for (start = 0; start < r.nchunks && ret == 0; start += batch) {
+        uint64_t end = MIN(start + batch, r.nchunks);
+        run_chunks(&r, start, end, compress_chunk);
+        for (i = start; i < end; i++) {
+            SnpChunk *c = &r.chunks[i];
+            if (ret == 0 && (r.failed ||
+                    !pwrite_all(fd, c->cbuf, c->csize, file_off))) {
+                ret = r.failed ? -EIO : -errno;
+            }
+            c->file_off = file_off;
+            file_off += c->csize;
+            g_free(c->cbuf);
+            c->cbuf = NULL;
+        }
+    }
+
+    if (ret == 0) {
+        put_block_list(f);
+        qemu_put_be64(f, r.nchunks);
+        for (i = 0; i < r.nchunks; i++) {
+            qemu_put_be64(f, r.chunks[i].file_off);
+            qemu_put_be32(f, r.chunks[i].csize);
+        }
+    }
+
+    g_free(r.chunks);
+    g_free(r.desc);
+    g_free(r.hash);
+    return ret;
+}
+
+typedef struct {
+    SnpRam r;
+    int fd;
+} SnpLoad;
+
+static void decompress_chunk(SnpRam *r, SnpChunk *c) {
+    int fd = container_of(r, SnpLoad, r)->fd;
+    size_t desc_len = c->npages * sizeof(uint64_t);
+    uLongf raw_len = desc_len + (size_t)c->npages * TARGET_PAGE_SIZE;
+    uint8_t *cbuf = g_malloc(c->csize);
+    uint8_t *raw = g_malloc(raw_len);
+    size_t len;
+    uint32_t i;
+
+    if (!pread_all(fd, cbuf, c->csize, c->file_off) ||
+            uncompress(raw, &raw_len, cbuf, c->csize) != Z_OK ||
+            raw_len < desc_len) {
+        r->failed = 1;
+        goto out;
+    }
+
+    len = desc_len;
+    for (i = 0; i < c->npages; i++) {
+        uint64_t d = ldq_le_p(raw + i * sizeof(uint64_t));
+        r->desc[c->first_page + i] = d;
+        switch (DESC_TYPE(d)) {
+        case PAGE_DATA:
+            if (len + TARGET_PAGE_SIZE > raw_len) {
+                r->failed = 1;
+                goto out;
+            }
+            memcpy(chunk_page(c, i), raw + len, TARGET_PAGE_SIZE);
+            len += TARGET_PAGE_SIZE;
+            break;
+        case PAGE_FILL:
+            memset(chunk_page(c, i), DESC_ARG(d), TARGET_PAGE_SIZE);
+            break;
+        case PAGE_REF:
+            if (DESC_ARG(d) >= c->first_page + i) {
+                r->failed = 1;
+                goto out;
+            }
+            break;
+        default:
+            r->failed = 1;
+            goto out;
+        }
+    }
+
+ out:
+    g_free(raw);
+    g_free(cbuf);
+}
+
+static int load_compressed(QEMUFile *f, int fd) {
+    SnpLoad l;
+    SnpRam *r = &l.r;
+    uint64_t n, nchunks;
+    int ret;
+
+    memset(&l, 0, sizeof(l));
+    l.fd = fd;
+    ret = get_block_list(f, r);
+    nchunks = qemu_get_be64(f);
+    if (ret == 0 && nchunks != r->nchunks) {
+        ret = -EINVAL;
+    }
+    if (ret < 0) {
+        fprintf(stderr, "rr snapshot: RAM layout does not match this machine\n");
+        g_free(r->chunks);
+        return ret;
+    }
+    for (n = 0; n < nchunks; n++) {
+        r->chunks[n].file_off = qemu_get_be64(f);
+        r->chunks[n].csize = qemu_get_be32(f);
+    }
+    r->desc = g_new(uint64_t, r->npages);
+
+    run_chunks(r, 0, r->nchunks, decompress_chunk);
+
+    if (r->failed) {
+        fprintf(stderr, "rr snapshot: corrupt compressed RAM sidecar\n");
+        ret = -EINVAL;
+    } else {
+        // every REF names an earlier non-REF page, all in place by now
+        for (n = 0; n < r->npages; n++) {
+            if (DESC_TYPE(r->desc[n]) == PAGE_REF) {
+                memcpy(page_by_index(r, n), page_by_index(r, DESC_ARG(r->desc[n])),
+                       TARGET_PAGE_SIZE);
+            }
+        }
+    }
+
+    g_free(r->chunks);
+    g_free(r->desc);
+    return ret;
+}
+
+/* Sidecar layout for RR_SNP_RAM_CAS: one CasRecord per page, in the block
+   order given in the stream record.  A page that is one byte repeated is
+   kept in its record; any other page is named by the SHA-256 of its
+   contents and lives in the page store as <store>/<h0h1>/<h2...h63>, so
+   the same page in any number of recordings is stored once.  Pages are
+   written to a temporary and renamed, which lets several recordings share
+   a store without locking; a page already in the store is not rewritten.
+
+   Loading reads each page from its own file.  They are not mmapped: that
+   would be one mapping per guest page, past vm.max_map_count for any
+   sizable guest.  The reads still come out of the shared page cache. */
+
+#define CAS_DIGEST_LEN 32
+
+enum { CAS_FILL, CAS_HASH };
+
+typedef struct {
+    uint8_t type;
+    uint8_t fill;
+    uint8_t digest[CAS_DIGEST_LEN];
+} QEMU_PACKED CasRecord;
+
+typedef struct {
+    SnpRam r;
+    int fd;
+    const char *store;
+} SnpCas;
+
+static char *cas_page_path(const char *store, const uint8_t *digest) {
+    char hex[CAS_DIGEST_LEN * 2 + 1];
+    int i;
+    for (i = 0; i < CAS_DIGEST_LEN; i++) {
+        snprintf(hex + 2 * i, 3, "%02x", digest[i]);
+    }
+    return g_strdup_printf("%s/%.2s/%s", store, hex, hex + 2);
+}
+
+static bool cas_put_page(const char *store, const uint8_t *digest,
+                         const uint8_t *page) {
+    char *path = cas_page_path(store, digest);
+    char *dir, *tmp;
+    struct stat st;
+    bool ok = true;
+    int fd;
+
+    if (stat(path, &st) == 0) {
+        g_free(path);
+        return true;
+    }
+
+    dir = g_path_get_dirname(path);
+    if (mkdir(dir, 0755) != 0 && errno != EEXIST) {
+        ok = false;
+    }
+    g_free(dir);
+
+    tmp = g_strdup_printf("%s.%d.%lx.tmp", path, getpid(),
+                          (unsigned long)pthread_self());
+    fd = ok ? open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0444) : -1;
+    if (fd < 0) {
+        ok = false;
+    } else {
+        ok = pwrite_all(fd, page, TARGET_PAGE_SIZE, 0);
+        ok = (close(fd) == 0) && ok;
+        // a concurrent writer of the same page renames identical bytes
+        ok = ok && rename(tmp, path) == 0;
+        if (!ok) {
+            unlink(tmp);
+        }
+    }
+    if (!ok) {
+        fprintf(stderr, "rr snapshot: can't write %s: %s\n", path, strerror(errno));
+    }
+    g_free(tmp);
+    g_free(path);
+    return ok;
+}
+
+static void cas_save_chunk(SnpRam *r, SnpChunk *c) {
+    SnpCas *cas = container_of(r, SnpCas, r);
+    CasRecord *recs = g_new0(CasRecord, c->npages);
+    GChecksum *sum = g_checksum_new(G_CHECKSUM_SHA256);
+    uint32_t i;
+
+    for (i = 0; i < c->npages && !r->failed; i++) {
+        uint8_t *p = chunk_page(c, i);
+        gsize len = CAS_DIGEST_LEN;
+
+        if (page_is_fill(p)) {
+            recs[i].type = CAS_FILL;
+            recs[i].fill = p[0];
+            continue;
+        }
+        recs[i].type = CAS_HASH;
+        g_checksum_reset(sum);
+        g_checksum_update(sum, p, TARGET_PAGE_SIZE);
+        g_checksum_get_digest(sum, recs[i].digest, &len);
+        if (!cas_put_page(cas->store, recs[i].digest, p)) {
+            r->failed = 1;
+        }
+    }
+    if (!r->failed && !pwrite_all(cas->fd, (uint8_t *)recs,
+                                  c->npages * sizeof(CasRecord),
+                                  c->first_page * sizeof(CasRecord))) {
+        r->failed = 1;
+    }
+    g_checksum_free(sum);
+    g_free(recs);
+}
+
+static void cas_load_chunk(SnpRam *r, SnpChunk *c) {
+    SnpCas *cas = container_of(r, SnpCas, r);
+    CasRecord *recs = g_new(CasRecord, c->npages);
+    uint32_t i;
+
+    if (!pread_all(cas->fd, (uint8_t *)recs, c->npages * sizeof(CasRecord),
+                   c->first_page * sizeof(CasRecord))) {
+        r->failed = 1;
+    }
+    for (i = 0; i < c->npages && !r->failed; i++) {
+        uint8_t *p = chunk_page(c, i);
+        char *path;
+        struct stat st;
+        int fd;
+
+        if (recs[i].type == CAS_FILL) {
+            memset(p, recs[i].fill, TARGET_PAGE_SIZE);
+            continue;
+        }
+        path = cas_page_path(cas->store, recs[i].digest);
+        fd = recs[i].type == CAS_HASH ? open(path, O_RDONLY) : -1;
+        if (fd < 0 || fstat(fd, &st) != 0 || st.st_size != TARGET_PAGE_SIZE ||
+                !pread_all(fd, p, TARGET_PAGE_SIZE, 0)) {
+            fprintf(stderr, "rr snapshot: missing or bad page %s\n", path);
+            r->failed = 1;
+        }
+        if (fd >= 0) {
+            close(fd);
+        }
+        g_free(path);
+    }
+    g_free(recs);
+}
+
+static int save_cas(QEMUFile *f, int fd) {
+    SnpCas cas;
+    RAMBlock *block;
+    int ret = 0;
+
+    if (!rr_snp_store) {
+        fprintf(stderr, "rr snapshot: 'cas' RAM encoding needs -rr-page-store\n");
+        return -EINVAL;
+    }
+    if (mkdir(rr_snp_store, 0755) != 0 && errno != EEXIST) {
+        ret = -errno;
+        fprintf(stderr, "rr snapshot: can't create %s: %s\n",
+                rr_snp_store, strerror(errno));
+        return ret;
+    }
+
+    memset(&cas, 0, sizeof(cas));
+    cas.fd = fd;
+    cas.store = rr_snp_store;
+    QLIST_FOREACH(block, &ram_list.blocks, next) {
+        layout_block(&cas.r, block);
+    }
+
+    run_chunks(&cas.r, 0, cas.r.nchunks, cas_save_chunk);
+
+    if (cas.r.failed) {
+        ret = -EIO;
+    } else {
+        qemu_put_be32(f, strlen(rr_snp_store));
+        qemu_put_buffer(f, (uint8_t *)rr_snp_store, strlen(rr_snp_store));
+        put_block_list(f);
+    }
+    g_free(cas.r.chunks);
+    return ret;
+}
+
+static int load_cas(QEMUFile *f, int fd) {
+    SnpCas cas;
+    uint32_t len = qemu_get_be32(f);
+    char *saved_store = g_malloc(len + 1);
+    int ret;
+
+    qemu_get_buffer(f, (uint8_t *)saved_store, len);
+    saved_store[len] = 0;
+
+    memset(&cas, 0, sizeof(cas));
+    cas.fd = fd;
+    // a replay host may have the store mounted somewhere else
+    cas.store = rr_snp_store ? rr_snp_store : saved_store;
+    ret = get_block_list(f, &cas.r);
+    if (ret < 0) {
+        fprintf(stderr, "rr snapshot: RAM layout does not match this machine\n");
+    } else {
+        run_chunks(&cas.r, 0, cas.r.nchunks, cas_load_chunk);
+        if (cas.r.failed) {
+            fprintf(stderr, "rr snapshot: can't load RAM from page store %s\n",
+                    cas.store);
+            ret = -EINVAL;
+        }
+    }
+
+    g_free(cas.r.chunks);
+    g_free(saved_store);
+    return ret;
+}
+
+int rr_snp_ram_save(QEMUFile *f) {
+    RAMBlock *block;
+    char *path = sidecar_path();
+    // write to a temporary and rename, so a replay that still has the old
+    // sidecar mapped keeps seeing the old contents
+    char *tmp = g_strdup_printf("%s.tmp", path);
+    int ret = -EINVAL;
+    int fd;
+
+    fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        ret = -errno;
+        goto out;
+    }
+
+    qemu_put_be32(f, rr_snp_ram_format);
+    switch (rr_snp_ram_format) {
+    case RR_SNP_RAM_MAPPED:
+        ret = save_mapped(f, fd);
+        break;
+    case RR_SNP_RAM_COMPRESSED:
+        ret = save_compressed(f, fd);
+        break;
+    case RR_SNP_RAM_CAS:
+        ret = save_cas(f, fd);
+        break;
+    default:
+        break;
+    }
+
+    if (close(fd) != 0 && ret == 0) {
+        ret = -errno;
+    }
+    if (ret == 0 && rename(tmp, path) != 0) {
+        ret = -errno;
+    }
+    if (ret < 0) {
+        unlink(tmp);
+        goto out;
+    }
+
+    // everything is in the sidecar; the stream only gets pages dirtied
+    // from here on
+    QLIST_FOREACH(block, &ram_list.blocks, next) {
+        cpu_physical_memory_reset_dirty(block->offset,
+                                        block->offset + block->length,
+                                        MIGRATION_DIRTY_FLAG);
+    }
+
+ out:
+    g_free(tmp);
+    g_free(path);
+    return ret;
+}
+
+int rr_snp_ram_load(QEMUFile *f) {
+    RRSnpRamFormat format = qemu_get_be32(f);
+    char *path;
+    int ret;
+    int fd;
+
+    if (!rr_snp_path) {
+        fprintf(stderr, "rr snapshot: RAM is in a sidecar file, "
+                "which only load_vmstate_rr can find\n");
+        return -EINVAL;
+    }
+
+    path = sidecar_path();
+    fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        ret = -errno;
+        fprintf(stderr, "rr snapshot: can't open %s: %s\n", path, strerror(errno));
+        g_free(path);
+        return ret;
+    }
+
+    switch (format) {
+    case RR_SNP_RAM_MAPPED:
+        ret = load_mapped(f, fd);
+        break;
+    case RR_SNP_RAM_COMPRESSED:
+        ret = load_compressed(f, fd);
+        break;
+    case RR_SNP_RAM_CAS:
+        ret = load_cas(f, fd);
+        break;
+    default:
+        fprintf(stderr, "rr snapshot: unknown RAM encoding %d\n", format);
+        ret = -EINVAL;
+        break;
+    }
+
+    // mappings stay valid after the fd is closed
+    close(fd);
+    g_free(path);
+    return ret;
+}
@@ -0,0 +1,67 @@
+/* PANDABEGINCOMMENT
+ *
+ * Authors:
+ *  Tim Leek               tleek@ll.mit.edu
+ *  Ryan Whelan            rwhelan@ll.mit.edu
+ *  Joshua Hodosh          josh.hodosh@ll.mit.edu
+ *  Michael Zhivich        mzhivich@ll.mit.edu
+ *  Brendan Dolan-Gavitt   brendandg@gatech.edu
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+
+#ifndef __RR_SNAPSHOT_RAM_H_
+#define __RR_SNAPSHOT_RAM_H_
+
+/* RAM encodings for record/replay snapshots.
+
+   By default the "ram" section of an rr snapshot is the ordinary migration
+   stream, one page at a time through QEMUFile.  The other encodings keep
+   the stream for device state and the RAM block list, and put guest RAM
+   into a sidecar file next to the snapshot (<snapshot>.ram).  The stream
+   only carries a RAM_SAVE_FLAG_RR_SIDECAR record saying how to read it,
+   so old snapshots still load and the choice is made at record time. */
+
+#include <stdbool.h>
+#include "qemu-common.h"
+
+typedef enum {
+    RR_SNP_RAM_STREAM,  // pages inline in the vmstate stream
+    RR_SNP_RAM_MAPPED,  // raw page-aligned sidecar, mmapped on replay
+    RR_SNP_RAM_COMPRESSED, // deduplicated, zlib chunks, threaded
+    RR_SNP_RAM_CAS,     // page hashes; contents in a shared page store
+} RRSnpRamFormat;
+
+extern RRSnpRamFormat rr_snp_ram_format;
+
+// Parse a -rr-snp-format argument. Returns false if the name is unknown.
+bool rr_snp_ram_set_format(const char *name);
+
+// Set the content-addressed page store directory (-rr-page-store). This
+// selects RR_SNP_RAM_CAS for recording, and on replay overrides the store
+// path saved in the snapshot.
+void rr_snp_ram_set_store(const char *dir);
+
+// do_savevm_rr and load_vmstate_rr bracket the vmstate save/load with
+// these so the ram section knows which snapshot it belongs to.
+void rr_snp_ram_begin(const char *snapshot_path);
+void rr_snp_ram_end(void);
+
+// True while saving an rr snapshot in a sidecar encoding.
+bool rr_snp_ram_save_active(void);
+
+// True once guest RAM is backed by a MAP_PRIVATE mapping of a snapshot,
+// where MADV_DONTNEED would bring back snapshot contents, not zeros.
+bool rr_snp_ram_mapped(void);
+
+// Write the sidecar and the stream record describing it, and clear the
+// migration dirty bits of everything written. Returns 0 or -errno.
+int rr_snp_ram_save(QEMUFile *f);
+
+// Read the stream record written by rr_snp_ram_save and fill guest RAM
+// from the sidecar. Returns 0 or -errno.
+int rr_snp_ram_load(QEMUFile *f);
+
+#endif
@@ -75,6 +75,7 @@
 #include "net.h"
 #include "monitor.h"
 #include "sysemu.h"
+#include "rr_snapshot_ram.h"
 #include "qemu-timer.h"
 #include "qemu-char.h"
 #include "audio/audio.h"
@@ -2280,7 +2281,9 @@ int do_savevm_rr(Monitor *mon, const char *name) {
         error_report("Could not open VM state file\n");
         return -1;
     }
+    rr_snp_ram_begin(name);
     ret = qemu_savevm_state(mon, f);
+    rr_snp_ram_end();
     qemu_fclose(f);
     if (ret < 0) {
         monitor_printf(mon, "Error %d while writing VM\n", ret);
@@ -2301,7 +2304,9 @@ int load_vmstate_rr(const char *name) {
     }
 
     qemu_system_reset(VMRESET_SILENT);
+    rr_snp_ram_begin(name);
     ret = qemu_loadvm_state(f);
+    rr_snp_ram_end();
 
     qemu_fclose(f);
     if (ret < 0) {
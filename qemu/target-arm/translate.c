@@ -9922,12 +9922,6 @@ static inline void gen_intermediate_code_internal(CPUState *env,
     if (max_insns == 0)
         max_insns = CF_COUNT_MASK;
 
-#ifdef CONFIG_SOFTMMU
-    // Terminate translation early if we have an interrupt coming up
-    if (!search_pc && rr_in_replay())
-        max_insns = max_insns < rr_num_instr_before_next_interrupt() ?
-                        max_insns : rr_num_instr_before_next_interrupt();
-#endif
     // But during search_pc always translate the same number we did last time
     if (search_pc)
         max_insns = tb->icount;
@@ -9939,6 +9933,11 @@ static inline void gen_intermediate_code_internal(CPUState *env,
 #endif
 
     gen_icount_start();
+#ifdef CONFIG_SOFTMMU
+    if (rr_mode != RR_OFF) {
+        gen_op_rr_tb_start(tb);
+    }
+#endif
 
     tcg_clear_temp_count();
 
@@ -10029,18 +10028,14 @@ static inline void gen_intermediate_code_internal(CPUState *env,
         if (num_insns + 1 == max_insns && (tb->cflags & CF_LAST_IO))
             gen_io_start();
 
-        if (
-#ifdef CONFIG_SOFTMMU
-            rr_mode != RR_OFF ||
-#endif
-            panda_update_pc) {
+        if (panda_update_pc || panda_use_memcb) {
             gen_op_update_panda_pc(dc->pc);
         }
 
 #ifdef CONFIG_SOFTMMU
         if (rr_mode != RR_OFF) {
-            gen_op_update_rr_icount();
             tb->num_guest_insns++;
+            gen_op_update_rr_insn_idx(tb->num_guest_insns);
         }
 #endif
 
@@ -10053,15 +10048,15 @@ static inline void gen_intermediate_code_internal(CPUState *env,
         }
 
         // PANDA: ask if anyone wants execution notification
-        bool panda_exec_cb = false;
-        panda_cb_list *plist;
-        for(plist = panda_cbs[PANDA_CB_INSN_TRANSLATE]; plist != NULL; plist = panda_cb_list_next(plist)) {
-            panda_exec_cb |= plist->entry.insn_translate(env, dc->pc);
+        uint32_t panda_exec_owners = 0;
+        if (unlikely(panda_cbs[PANDA_CB_INSN_TRANSLATE] != NULL)) {
+            panda_exec_owners = panda_insn_translate(env, dc->pc);
         }
 
-        // PANDA: Insert the instrumentation
-        if (unlikely(panda_exec_cb)) {
-            gen_helper_panda_insn_exec(tcg_const_tl(dc->pc));
+        // PANDA: Insert the instrumentation, for those plugins only
+        if (unlikely(panda_exec_owners)) {
+            gen_helper_panda_insn_exec(tcg_const_tl(dc->pc),
+                    tcg_const_i32(panda_exec_owners));
         }
 
         if (dc->thumb) {
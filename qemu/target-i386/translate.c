@@ -7829,13 +7829,9 @@ static void gen_intermediate_code_internal(CPUState *env,
     uint16_t *saved_gen_opc_ptr;
     TCGArg *saved_gen_opparam_ptr;
 
-    uint64_t until_interrupt;
-
     //    uint16_t saved_num_guest_insns = tb->num_guest_insns; // rw - icount?
 
     tb->num_guest_insns = 0; //rw - we now have tb->icount
-    // Cache this value. Shouldn't change over this function!
-    until_interrupt = rr_num_instr_before_next_interrupt();
 
     int num_insns;
     int max_insns;
@@ -7937,6 +7933,11 @@ static void gen_intermediate_code_internal(CPUState *env,
 #endif
 
     gen_icount_start();
+#ifdef CONFIG_SOFTMMU
+    if (rr_mode != RR_OFF) {
+        gen_op_rr_tb_start(tb);
+    }
+#endif
     for(;;) {
         if (unlikely(!QTAILQ_EMPTY(&env->breakpoints))) {
             QTAILQ_FOREACH(bp, &env->breakpoints, entry) {
@@ -7977,29 +7978,25 @@ static void gen_intermediate_code_internal(CPUState *env,
                 tcg_gen_debug_insn_start(pc_ptr);
 
             //mz let's count this instruction
-            if (
-#ifdef CONFIG_SOFTMMU
-                rr_mode != RR_OFF ||
-#endif
-                panda_update_pc) {
+            if (panda_update_pc || panda_use_memcb) {
                 gen_op_update_panda_pc(pc_ptr);
             }
 #ifdef CONFIG_SOFTMMU
             if (rr_mode != RR_OFF) {
-                gen_op_update_rr_icount();
+                gen_op_update_rr_insn_idx(tb->num_guest_insns + 1);
             }
 #endif
 
             // PANDA: ask if anyone wants execution notification
-            bool panda_exec_cb = false;
-            panda_cb_list *plist;
-            for(plist = panda_cbs[PANDA_CB_INSN_TRANSLATE]; plist != NULL; plist = panda_cb_list_next(plist)) {
-                panda_exec_cb |= plist->entry.insn_translate(env, pc_ptr);
+            uint32_t panda_exec_owners = 0;
+            if (unlikely(panda_cbs[PANDA_CB_INSN_TRANSLATE] != NULL)) {
+                panda_exec_owners = panda_insn_translate(env, pc_ptr);
             }
 
-            // PANDA: Insert the instrumentation
-            if (unlikely(panda_exec_cb)) {
-                gen_helper_panda_insn_exec(tcg_const_tl(pc_ptr));
+            // PANDA: Insert the instrumentation, for those plugins only
+            if (unlikely(panda_exec_owners)) {
+                gen_helper_panda_insn_exec(tcg_const_tl(pc_ptr),
+                        tcg_const_i32(panda_exec_owners));
             }
 
             //mz generate micro-ops for this instruction
@@ -8052,17 +8049,8 @@ static void gen_intermediate_code_internal(CPUState *env,
         }
 
 #ifdef CONFIG_SOFTMMU
-        if (rr_mode == RR_REPLAY) {
-            //mz make sure we'll terminate in time for next interrupt
-            //mz NOTE: we cannot muck with size of translation block if search_pc
-            //is set - must be the same as last translation!
-            if (search_pc == 0 && tb->num_guest_insns == until_interrupt) {
-                //printf("Terminating block %#x early because we have an interrupt coming up.\n", pc_start);
-                gen_jmp_im(pc_ptr - dc->cs_base);
-                gen_eob(dc);
-                break;
-            }
-        }
+        // blocks that would run past the next interrupt in replay are
+        // cut short by cpu_exec, which asks for a prefix via cflags
         if (rr_mode != RR_OFF) {
             //mz update EIP (otherwise it has already been updated by a gen_jmp_im instruction)
             //            assert( (pc_ptr - prev_pc_ptr) < sizeof(gen_op_add_eip) / sizeof(char *) );
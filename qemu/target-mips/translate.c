@@ -12415,10 +12415,6 @@ gen_intermediate_code_internal (CPUState *env, TranslationBlock *tb,
     if (max_insns == 0)
         max_insns = CF_COUNT_MASK;
 
-    // Terminate translation early if we have an interrupt coming up
-    if (!search_pc && rr_in_replay())
-        max_insns = max_insns < rr_num_instr_before_next_interrupt ?
-                        max_insns : rr_num_instr_before_next_interrupt;
     // But during search_pc always translate the same number we did last time
     if (search_pc)
         max_insns = tb->icount;
@@ -12428,6 +12424,9 @@ gen_intermediate_code_internal (CPUState *env, TranslationBlock *tb,
 
     LOG_DISAS("\ntb %p idx %d hflags %04x\n", tb, ctx.mem_idx, ctx.hflags);
     gen_icount_start();
+    if (rr_mode != RR_OFF) {
+        gen_op_rr_tb_start(tb);
+    }
     while (ctx.bstate == BS_NONE) {
         if (unlikely(!QTAILQ_EMPTY(&env->breakpoints))) {
             QTAILQ_FOREACH(bp, &env->breakpoints, entry) {
@@ -12458,13 +12457,13 @@ gen_intermediate_code_internal (CPUState *env, TranslationBlock *tb,
         if (num_insns + 1 == max_insns && (tb->cflags & CF_LAST_IO))
             gen_io_start();
 
-        if (rr_mode != RR_OFF || panda_update_pc) {
+        if (panda_update_pc || panda_use_memcb) {
             gen_op_update_panda_pc(ctx.pc);
         }
 
         if (rr_mode != RR_OFF) {
-            gen_op_update_rr_icount();
             tb->num_guest_insns++;
+            gen_op_update_rr_insn_idx(tb->num_guest_insns);
         }
 
         is_branch = 0;
@@ -5271,12 +5271,12 @@ static inline void gen_intermediate_code_internal(TranslationBlock * tb,
     if (max_insns == 0)
         max_insns = CF_COUNT_MASK;
 
-    if (rr_in_replay())
-        max_insns = max_insns < rr_num_instr_before_next_interrupt ?
-                        max_insns : rr_num_instr_before_next_interrupt;
     tb->num_guest_insns = 0;
 
     gen_icount_start();
+    if (rr_mode != RR_OFF) {
+        gen_op_rr_tb_start(tb);
+    }
     do {
         if (unlikely(!QTAILQ_EMPTY(&env->breakpoints))) {
             QTAILQ_FOREACH(bp, &env->breakpoints, entry) {
@@ -5306,13 +5306,13 @@ static inline void gen_intermediate_code_internal(TranslationBlock * tb,
         if (num_insns + 1 == max_insns && (tb->cflags & CF_LAST_IO))
             gen_io_start();
 
-        if (rr_mode != RR_OFF || panda_update_pc) {
+        if (panda_update_pc || panda_use_memcb) {
             gen_op_update_panda_pc(dc->pc);
         }
 
         if (rr_mode != RR_OFF) {
-            gen_op_update_rr_icount();
             tb->num_guest_insns++;
+            gen_op_update_rr_insn_idx(tb->num_guest_insns);
         }
 
         last_pc = dc->pc;
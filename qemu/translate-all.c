@@ -145,6 +145,61 @@ int cpu_gen_code(CPUState *env, TranslationBlock *tb, int *gen_code_size_ptr)
     return 0;
 }
 
+/* Record/replay only tracks the current TB and the index of the
+   instruction within it (see gen_op_rr_tb_start), so the guest pc of that
+   instruction is recovered here by retranslating the block with search_pc
+   set, the same way cpu_restore_state does.  The last answer is cached:
+   the rr log usually asks several times at the same point. */
+static TranslationBlock *rr_pc_cache_tb;
+static uint32_t rr_pc_cache_idx;
+static uint64_t rr_pc_cache_pc;
+
+uint64_t rr_get_guest_pc(CPUState *env)
+{
+    TranslationBlock *tb = env->rr_cur_tb;
+    uint32_t idx = env->rr_insn_idx;
+    int j, n;
+
+    /* panda_guest_pc is kept up to date when a plugin asked for precise
+       pcs or for memory callbacks, which are handed it as their pc, and
+       rr_forget_tb leaves the pc there when it drops a block. */
+    if (panda_update_pc || panda_use_memcb || tb == NULL || idx == 0)
+        return env->panda_guest_pc;
+    if (tb == rr_pc_cache_tb && idx == rr_pc_cache_idx)
+        return rr_pc_cache_pc;
+
+    tcg_func_start(&tcg_ctx);
+    gen_intermediate_code_pc(env, tb);
+    n = gen_opc_ptr - gen_opc_buf;
+    for (j = 0; j < n; j++) {
+        if (gen_opc_instr_start[j] && gen_opc_icount[j] == idx - 1)
+            break;
+    }
+    if (j == n)
+        return env->panda_guest_pc;
+
+    rr_pc_cache_tb = tb;
+    rr_pc_cache_idx = idx;
+    rr_pc_cache_pc = gen_opc_pc[j];
+    return rr_pc_cache_pc;
+}
+
+/* Called before tb is invalidated, or with NULL before all TBs are
+   flushed: pin down the pc of any CPU whose rr_cur_tb is going away. */
+void rr_forget_tb(TranslationBlock *tb)
+{
+    CPUState *env;
+
+    for (env = first_cpu; env != NULL; env = env->next_cpu) {
+        if (env->rr_cur_tb != NULL && (tb == NULL || env->rr_cur_tb == tb)) {
+            env->panda_guest_pc = rr_get_guest_pc(env);
+            env->rr_cur_tb = NULL;
+        }
+    }
+    if (tb == NULL || tb == rr_pc_cache_tb)
+        rr_pc_cache_tb = NULL;
+}
+
 /* The cpu state corresponding to 'searched_pc' is restored.
  */
 int cpu_restore_state(TranslationBlock *tb,
@@ -216,6 +216,7 @@ int panda_in_main_loop = 0;
 #include "ui/qemu-spice.h"
 
 #include "rr_log_all.h"
+#include "rr_snapshot_ram.h"
 #include "replay_fix.h"
 
 //#define DEBUG_NET
@@ -3240,6 +3241,32 @@ int main(int argc, char **argv, char **envp)
                 replay_name = optarg;
                 break;
 
+            case QEMU_OPTION_replay_headless:
+                rr_replay_headless = 1;
+                break;
+
+            case QEMU_OPTION_rr_state_hash:
+                {
+                    char *end;
+                    rr_state_hash_interval = strtoull(optarg, &end, 0);
+                    if (*end != '\0') {
+                        fprintf(stderr, "Invalid -rr-state-hash interval '%s'\n", optarg);
+                        exit(1);
+                    }
+                }
+                break;
+
+            case QEMU_OPTION_rr_snp_format:
+                if (!rr_snp_ram_set_format(optarg)) {
+                    fprintf(stderr, "Unknown snapshot RAM format '%s'\n", optarg);
+                    exit(1);
+                }
+                break;
+
+            case QEMU_OPTION_rr_page_store:
+                rr_snp_ram_set_store(optarg);
+                break;
+
             case QEMU_OPTION_pandalog:
                 pandalog = 1;
                 pandalog_open(optarg, "w");
@@ -3312,6 +3339,19 @@ int main(int argc, char **argv, char **envp)
         }
     }
     loc_set_none();
+
+    if (rr_replay_headless) {
+        if (!replay_name) {
+            fprintf(stderr, "-replay-headless needs -replay\n");
+            exit(1);
+        }
+        // Replay takes every guest input from the log, so none of the
+        // host-side ends of the devices have anything to do.
+        display_type = DT_NONE;
+        vnc_display = NULL;
+        default_monitor = 0;
+        setenv("QEMU_AUDIO_DRV", "none", 1);
+    }
     
 #if defined(CONFIG_ANDROID)
     if(android_input){
@@ -3870,5 +3910,6 @@ int main(int argc, char **argv, char **envp)
     }
 #endif
 
-    return 0;
+    // only a headless replay reports how far it got
+    return rr_replay_headless ? rr_replay_status : 0;
 }